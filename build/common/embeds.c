@@ -0,0 +1,2617 @@
+#include <string.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+    const char* path;
+    const uint8_t* compressed_data;
+    size_t compressed_bytecount;
+    size_t uncompressed_bytecount;
+} Entry;
+
+static const Entry entries[] = {
+    {
+        "readme.md",
+        (const uint8_t[]){
+            0xF1, 0x03, 0x23, 0x20, 0x45, 0x6D, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 
+            0x20, 0x46, 0x69, 0x6C, 0x65, 0x73, 0x0A, 0x0A, 0x07, 0x00, 0xF0, 0x03, 
+            0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x74, 
+            0x68, 0x69, 0x73, 0x20, 0x60, 0x65, 0x26, 0x00, 0xF1, 0x01, 0x60, 0x20, 
+            0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x61, 0x72, 
+            0x65, 0x20, 0x15, 0x00, 0x00, 0x3B, 0x00, 0xF0, 0x1F, 0x69, 0x6E, 0x74, 
+            0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 
+            0x65, 0x64, 0x20, 0x50, 0x79, 0x72, 0x6F, 0x20, 0x62, 0x69, 0x6E, 0x61, 
+            0x72, 0x79, 0x2E, 0x0A, 0x0A, 0x59, 0x6F, 0x75, 0x20, 0x63, 0x61, 0x6E, 
+            0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x2A, 0x00, 0x40, 0x73, 0x65, 
+            0x20, 0x66, 0x70, 0x00, 0x00, 0x62, 0x00, 0x01, 0x2C, 0x00, 0x50, 0x75, 
+            0x73, 0x69, 0x6E, 0x67, 0x1A, 0x00, 0xF4, 0x03, 0x20, 0x60, 0x73, 0x74, 
+            0x64, 0x3A, 0x3A, 0x70, 0x79, 0x72, 0x6F, 0x3A, 0x3A, 0x6C, 0x6F, 0x61, 
+            0x64, 0x5F, 0x67, 0x00, 0x10, 0x5F, 0x32, 0x00, 0xF7, 0x0E, 0x28, 0x29, 
+            0x60, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x0A, 
+            0x46, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x2C, 
+            0x20, 0x74, 0x6F, 0x61, 0x00, 0x03, 0xB3, 0x00, 0xD1, 0x2F, 0x66, 0x6F, 
+            0x6F, 0x2F, 0x62, 0x61, 0x72, 0x2E, 0x74, 0x78, 0x74, 0x60, 0x73, 0x00, 
+            0x33, 0x2C, 0x20, 0x79, 0x8E, 0x00, 0xF5, 0x02, 0x72, 0x75, 0x6E, 0x3A, 
+            0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 
+            0x20, 0x79, 0x00, 0x11, 0x3B, 0x16, 0x00, 0xEF, 0x76, 0x61, 0x72, 0x20, 
+            0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x91, 0x00, 
+            0x06, 0x17, 0x22, 0x63, 0x00, 0x55, 0x22, 0x29, 0x3B, 0x0A, 0x0A, 0x52, 
+            0x01, 0x00, 0xB0, 0x00, 0x11, 0x73, 0x2A, 0x01, 0xD1, 0x61, 0x75, 0x74, 
+            0x6F, 0x6D, 0x61, 0x74, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x26, 0x01, 
+            0x67, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0xF7, 0x00, 0x35, 0x4C, 0x5A, 
+            0x34, 0x19, 0x00, 0xFB, 0x02, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6C, 0x67, 
+            0x6F, 0x72, 0x69, 0x74, 0x68, 0x6D, 0x20, 0x61, 0x6E, 0x64, 0x41, 0x00, 
+            0x20, 0x75, 0x6E, 0x69, 0x01, 0x03, 0x43, 0x00, 0xC0, 0x6F, 0x6E, 0x20, 
+            0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x2E, 0x0A, 
+        },
+        357,
+        463,
+    },
+    {
+        "std/base64.pyro",
+        (const uint8_t[]){
+            0x3F, 0x23, 0x20, 0x2D, 0x01, 0x00, 0x16, 0xF2, 0x0F, 0x0A, 0x23, 0x20, 
+            0x20, 0x49, 0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 0x69, 0x7A, 0x65, 0x20, 
+            0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x69, 0x6E, 0x67, 
+            0x2F, 0x64, 0x65, 0x09, 0x00, 0x9F, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 
+            0x73, 0x2E, 0x0A, 0x59, 0x00, 0x1A, 0x2C, 0x0A, 0x23, 0x59, 0x00, 0x85, 
+            0x52, 0x46, 0x43, 0x2D, 0x34, 0x36, 0x34, 0x38, 0x62, 0x00, 0x02, 0x59, 
+            0x00, 0xF1, 0x03, 0x2E, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x62, 0x69, 0x6E, 
+            0x32, 0x72, 0x75, 0x6E, 0x65, 0x5F, 0x72, 0x66, 0x63, 0x25, 0x00, 0xB0, 
+            0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x30, 0x62, 0x31, 0x01, 
+            0x00, 0x88, 0x30, 0x20, 0x3D, 0x20, 0x27, 0x2B, 0x27, 0x2C, 0x14, 0x00, 
+            0x10, 0x31, 0x14, 0x00, 0xF3, 0x1D, 0x2F, 0x27, 0x2C, 0x0A, 0x7D, 0x3B, 
+            0x0A, 0x0A, 0x23, 0x20, 0x52, 0x75, 0x6E, 0x65, 0x73, 0x3A, 0x20, 0x41, 
+            0x2D, 0x5A, 0x2E, 0x0A, 0x66, 0x6F, 0x72, 0x20, 0x69, 0x20, 0x69, 0x6E, 
+            0x20, 0x24, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x28, 0x30, 0x2C, 0x20, 0x32, 
+            0x36, 0x29, 0x53, 0x00, 0x0C, 0x6C, 0x00, 0x70, 0x5B, 0x69, 0x5D, 0x20, 
+            0x3D, 0x20, 0x24, 0x7F, 0x00, 0xF7, 0x03, 0x28, 0x24, 0x69, 0x36, 0x34, 
+            0x28, 0x27, 0x41, 0x27, 0x29, 0x20, 0x2B, 0x20, 0x69, 0x29, 0x3B, 0x0A, 
+            0x7D, 0x5A, 0x00, 0x3E, 0x61, 0x2D, 0x7A, 0x5A, 0x00, 0x6F, 0x32, 0x36, 
+            0x2C, 0x20, 0x35, 0x32, 0x5B, 0x00, 0x17, 0x12, 0x61, 0x5B, 0x00, 0x20, 
+            0x20, 0x2D, 0x91, 0x00, 0x0A, 0x60, 0x00, 0x3E, 0x30, 0x2D, 0x39, 0x60, 
+            0x00, 0x5F, 0x35, 0x32, 0x2C, 0x20, 0x36, 0x60, 0x00, 0x18, 0x15, 0x30, 
+            0x60, 0x00, 0x24, 0x35, 0x32, 0xC0, 0x00, 0x0B, 0xE2, 0x01, 0x05, 0x89, 
+            0x01, 0x0A, 0xE2, 0x01, 0x02, 0x89, 0x01, 0x00, 0x06, 0x01, 0x48, 0x32, 
+            0x62, 0x69, 0x6E, 0x89, 0x01, 0x00, 0x60, 0x01, 0x00, 0x52, 0x01, 0xC0, 
+            0x28, 0x6B, 0x65, 0x79, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 
+            0x5D, 0x01, 0x0C, 0x49, 0x01, 0x03, 0x60, 0x01, 0x0C, 0x43, 0x00, 0x11, 
+            0x5B, 0x32, 0x00, 0x00, 0x64, 0x01, 0x33, 0x6B, 0x65, 0x79, 0xF3, 0x00, 
+            0x0F, 0xA2, 0x02, 0x03, 0x00, 0x8F, 0x02, 0x95, 0x53, 0x75, 0x70, 0x70, 
+            0x6F, 0x72, 0x74, 0x65, 0x64, 0x28, 0x02, 0x0F, 0x7B, 0x02, 0x08, 0x83, 
+            0x0A, 0x0A, 0x65, 0x6E, 0x75, 0x6D, 0x20, 0x45, 0xB4, 0x02, 0x03, 0x81, 
+            0x00, 0x33, 0x52, 0x46, 0x43, 0x44, 0x02, 0x1C, 0x28, 0xA3, 0x00, 0x1D, 
+            0x2C, 0x9E, 0x00, 0x22, 0x29, 0x2C, 0xE5, 0x01, 0x0F, 0x92, 0x00, 0x03, 
+            0x09, 0x02, 0x00, 0x00, 0x9F, 0x00, 0xFF, 0x11, 0x4D, 0x61, 0x72, 0x73, 
+            0x68, 0x61, 0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x62, 
+            0x75, 0x66, 0x2F, 0x73, 0x74, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x61, 
+            0x73, 0x65, 0x36, 0x34, 0x27, 0x03, 0x14, 0x52, 0x0A, 0x0A, 0x64, 0x65, 
+            0x66, 0xE2, 0x00, 0x52, 0x65, 0x5F, 0x74, 0x6F, 0x5F, 0x3D, 0x00, 0x11, 
+            0x28, 0x55, 0x00, 0x10, 0x3A, 0x56, 0x00, 0x52, 0x7C, 0x73, 0x74, 0x72, 
+            0x2C, 0x21, 0x00, 0x45, 0x69, 0x6E, 0x67, 0x3A, 0xE3, 0x00, 0x40, 0x29, 
+            0x20, 0x2D, 0x3E, 0x20, 0x00, 0x03, 0xEB, 0x00, 0x00, 0x3C, 0x03, 0x56, 
+            0x6D, 0x61, 0x70, 0x20, 0x3D, 0x2B, 0x00, 0x01, 0x6E, 0x01, 0x61, 0x28, 
+            0x29, 0x5B, 0x30, 0x5D, 0x3B, 0x2E, 0x03, 0x00, 0x23, 0x00, 0x72, 0x63, 
+            0x6F, 0x75, 0x6E, 0x74, 0x20, 0x3D, 0xB5, 0x00, 0x11, 0x3A, 0x0E, 0x00, 
+            0x22, 0x28, 0x29, 0x1F, 0x00, 0x70, 0x76, 0x61, 0x72, 0x20, 0x6F, 0x75, 
+            0x74, 0xCD, 0x00, 0x68, 0x3D, 0x20, 0x24, 0x62, 0x75, 0x66, 0x19, 0x00, 
+            0xB1, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x0A, 
+            0x4C, 0x00, 0x53, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x16, 0x00, 0x21, 0x3C, 
+            0x20, 0x48, 0x00, 0x03, 0x89, 0x00, 0x00, 0x02, 0x00, 0x00, 0x6A, 0x00, 
+            0xB3, 0x72, 0x65, 0x6D, 0x61, 0x69, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x3D, 
+            0x20, 0x00, 0x12, 0x2D, 0x30, 0x00, 0x03, 0x42, 0x00, 0x00, 0x02, 0x00, 
+            0x27, 0x69, 0x66, 0x27, 0x00, 0x47, 0x3E, 0x3D, 0x20, 0x33, 0x44, 0x00, 
+            0x00, 0x02, 0x00, 0x00, 0x48, 0x00, 0x30, 0x6B, 0x65, 0x79, 0xE0, 0x03, 
+            0x03, 0x12, 0x01, 0x51, 0x62, 0x79, 0x74, 0x65, 0x28, 0x77, 0x00, 0x34, 
+            0x29, 0x20, 0x26, 0x14, 0x04, 0x92, 0x31, 0x30, 0x30, 0x29, 0x20, 0x3E, 
+            0x3E, 0x20, 0x32, 0xC9, 0x00, 0x04, 0x02, 0x00, 0x02, 0xCD, 0x00, 0x71, 
+            0x3A, 0x77, 0x72, 0x69, 0x74, 0x65, 0x5F, 0x39, 0x00, 0x40, 0x6D, 0x61, 
+            0x70, 0x5B, 0x50, 0x00, 0x27, 0x5D, 0x29, 0x85, 0x00, 0x00, 0x02, 0x00, 
+            0x03, 0x69, 0x00, 0x5F, 0x32, 0x20, 0x3D, 0x20, 0x28, 0x6A, 0x00, 0x04, 
+            0x11, 0x30, 0x01, 0x00, 0xBF, 0x31, 0x31, 0x29, 0x20, 0x3C, 0x3C, 0x20, 
+            0x34, 0x29, 0x20, 0x7C, 0x2A, 0x00, 0x00, 0x46, 0x20, 0x2B, 0x20, 0x31, 
+            0x98, 0x00, 0x00, 0x31, 0x00, 0x01, 0x98, 0x00, 0x13, 0x34, 0x62, 0x01, 
+            0x04, 0x02, 0x00, 0x0F, 0x99, 0x00, 0x06, 0x1F, 0x32, 0x99, 0x00, 0x05, 
+            0x1F, 0x33, 0x99, 0x00, 0x02, 0x06, 0x6F, 0x00, 0x00, 0x6B, 0x00, 0x00, 
+            0x1E, 0x05, 0x01, 0x9D, 0x00, 0x1F, 0x32, 0x9D, 0x00, 0x06, 0x14, 0x32, 
+            0x9D, 0x00, 0x00, 0x30, 0x00, 0x03, 0x9D, 0x00, 0x00, 0x7D, 0x04, 0x04, 
+            0x99, 0x00, 0x00, 0x02, 0x00, 0x0F, 0x9D, 0x00, 0x06, 0x1F, 0x33, 0x9D, 
+            0x00, 0x05, 0x15, 0x34, 0x50, 0x02, 0x01, 0x65, 0x01, 0x01, 0x9E, 0x01, 
+            0x06, 0x6D, 0x00, 0x02, 0x99, 0x00, 0x2F, 0x31, 0x31, 0x66, 0x00, 0x14, 
+            0x1D, 0x34, 0x66, 0x00, 0x03, 0x50, 0x00, 0x3A, 0x3D, 0x20, 0x33, 0x43, 
+            0x00, 0x86, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x16, 0x00, 
+            0x12, 0x7D, 0x9C, 0x02, 0x00, 0x02, 0x00, 0x09, 0x5A, 0x02, 0x4F, 0x3D, 
+            0x3D, 0x20, 0x32, 0x5A, 0x02, 0xFF, 0x35, 0x06, 0x6D, 0x01, 0x00, 0x02, 
+            0x00, 0x0F, 0x2C, 0x02, 0x18, 0x0E, 0x2B, 0x00, 0x3C, 0x27, 0x3D, 0x27, 
+            0x87, 0x03, 0x05, 0xEB, 0x01, 0x0B, 0xCA, 0x03, 0x0F, 0xEB, 0x01, 0x0A, 
+            0x03, 0xBC, 0x03, 0x0F, 0x25, 0x04, 0x20, 0x0E, 0x94, 0x00, 0x0F, 0x21, 
+            0x04, 0x02, 0x03, 0x61, 0x00, 0x0F, 0x1D, 0x04, 0x18, 0x06, 0x26, 0x01, 
+            0x0F, 0x63, 0x00, 0x06, 0x0A, 0xEB, 0x03, 0x0E, 0x27, 0x00, 0x02, 0x1E, 
+            0x01, 0x00, 0x65, 0x01, 0x00, 0x02, 0x00, 0x0F, 0x20, 0x00, 0x05, 0x01, 
+            0x8C, 0x05, 0x00, 0x02, 0x00, 0x05, 0x3A, 0x01, 0x03, 0x68, 0x03, 0x03, 
+            0x0B, 0x03, 0x63, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0xD7, 0x05, 0x01, 
+            0x72, 0x07, 0x40, 0x70, 0x75, 0x62, 0x20, 0x72, 0x06, 0x0F, 0x6B, 0x06, 
+            0x05, 0x0B, 0x57, 0x06, 0x70, 0x69, 0x66, 0x20, 0x24, 0x69, 0x73, 0x5F, 
+            0x0E, 0x06, 0x01, 0x93, 0x06, 0x04, 0xE0, 0x08, 0x00, 0x02, 0x00, 0x6A, 
+            0x61, 0x73, 0x73, 0x65, 0x72, 0x74, 0x4B, 0x06, 0x76, 0x20, 0x3E, 0x20, 
+            0x30, 0x2C, 0x20, 0x22, 0x5E, 0x00, 0x22, 0x29, 0x3A, 0x21, 0x00, 0x00, 
+            0xAB, 0x06, 0xD6, 0x66, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6D, 
+            0x70, 0x74, 0x79, 0x22, 0xDD, 0x00, 0x03, 0xA5, 0x00, 0x01, 0x70, 0x0A, 
+            0x0D, 0x04, 0x07, 0x15, 0x2C, 0xF1, 0x06, 0x23, 0x3A, 0x3A, 0xCF, 0x07, 
+            0x03, 0x4E, 0x05, 0x03, 0xE3, 0x00, 0x03, 0xA2, 0x00, 0x32, 0x73, 0x74, 
+            0x72, 0xB9, 0x05, 0x0F, 0xA2, 0x00, 0x27, 0x30, 0x73, 0x74, 0x72, 0xAF, 
+            0x06, 0x0F, 0xA2, 0x00, 0x3E, 0x7C, 0x24, 0x70, 0x61, 0x6E, 0x69, 0x63, 
+            0x28, 0x15, 0x01, 0xF1, 0x01, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x61, 
+            0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x5B, 0x60, 0x01, 0x80, 
+            0x5D, 0x2C, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0xF7, 0x08, 0x14, 0x61, 
+            0x34, 0x01, 0x23, 0x6F, 0x72, 0x9C, 0x00, 0xC0, 0x2C, 0x20, 0x67, 0x6F, 
+            0x74, 0x20, 0x24, 0x7B, 0x24, 0x74, 0x79, 0x70, 0x69, 0x05, 0x64, 0x70, 
+            0x75, 0x74, 0x29, 0x7D, 0x22, 0xDE, 0x09, 0x09, 0xA3, 0x08, 0x0F, 0x02, 
+            0x00, 0x01, 0x00, 0xB7, 0x08, 0x3B, 0x55, 0x6E, 0x6D, 0xB9, 0x08, 0x01, 
+            0xAE, 0x08, 0x01, 0xB8, 0x08, 0x2F, 0x75, 0x66, 0xB5, 0x08, 0x12, 0x02, 
+            0xB3, 0x08, 0x01, 0x34, 0x0A, 0x31, 0x65, 0x5F, 0x34, 0x5A, 0x07, 0x23, 
+            0x73, 0x28, 0xA2, 0x02, 0x00, 0x45, 0x00, 0x60, 0x2C, 0x20, 0x6D, 0x61, 
+            0x70, 0x3A, 0x05, 0x00, 0x10, 0x5B, 0x64, 0x09, 0xE1, 0x2C, 0x20, 0x69, 
+            0x36, 0x34, 0x5D, 0x2C, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5F, 0xA9, 
+            0x02, 0x10, 0x3A, 0x13, 0x00, 0x20, 0x2C, 0x20, 0x2F, 0x06, 0x17, 0x31, 
+            0x0C, 0x00, 0x17, 0x32, 0x0C, 0x00, 0x17, 0x33, 0x0C, 0x00, 0x11, 0x34, 
+            0x0C, 0x00, 0x04, 0xD9, 0x01, 0x00, 0x8F, 0x03, 0x30, 0x62, 0x69, 0x6E, 
+            0xF0, 0x03, 0x00, 0xAF, 0x03, 0x01, 0x45, 0x00, 0x03, 0xE2, 0x08, 0x03, 
+            0x0C, 0x02, 0x30, 0x65, 0x72, 0x72, 0xF0, 0x09, 0x14, 0x31, 0x32, 0x00, 
+            0x00, 0x02, 0x00, 0x04, 0x85, 0x01, 0x04, 0x78, 0x01, 0x02, 0xF7, 0x00, 
+            0x45, 0x3A, 0x20, 0x75, 0x6E, 0x70, 0x01, 0xF1, 0x00, 0x63, 0x68, 0x61, 
+            0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x7B, 0x7D, 0x20, 0x61, 0x74, 
+            0x9F, 0x00, 0x11, 0x20, 0xB0, 0x00, 0xD2, 0x20, 0x7B, 0x7D, 0x22, 0x2C, 
+            0x20, 0x24, 0x64, 0x65, 0x62, 0x75, 0x67, 0x28, 0x20, 0x0C, 0x01, 0x77, 
+            0x00, 0x29, 0x29, 0x29, 0xD7, 0x00, 0x0A, 0x99, 0x02, 0x03, 0xA8, 0x00, 
+            0x00, 0x37, 0x04, 0x04, 0xA8, 0x00, 0x1F, 0x32, 0xA8, 0x00, 0x02, 0x05, 
+            0xD5, 0x0B, 0x00, 0x02, 0x00, 0x0F, 0xA8, 0x00, 0x41, 0x1B, 0x32, 0xA8, 
+            0x00, 0x01, 0x38, 0x08, 0x02, 0x80, 0x03, 0x03, 0x45, 0x03, 0x03, 0xAC, 
+            0x00, 0x00, 0x67, 0x08, 0x04, 0xAC, 0x00, 0x1F, 0x33, 0xAC, 0x00, 0x02, 
+            0x1F, 0x33, 0x54, 0x01, 0x4D, 0x1E, 0x33, 0xAC, 0x00, 0x04, 0x76, 0x06, 
+            0x0A, 0xAC, 0x00, 0x17, 0x34, 0xAC, 0x00, 0x1F, 0x34, 0xAC, 0x00, 0x02, 
+            0x1F, 0x34, 0xAC, 0x00, 0x4D, 0x1E, 0x34, 0xAC, 0x00, 0x1E, 0x33, 0x04, 
+            0x02, 0x31, 0x6F, 0x75, 0x74, 0x24, 0x03, 0x00, 0xB1, 0x02, 0x01, 0x97, 
+            0x02, 0x00, 0x41, 0x0A, 0x02, 0xA4, 0x09, 0x00, 0x95, 0x0C, 0x00, 0xB9, 
+            0x0A, 0x04, 0x32, 0x06, 0x00, 0x87, 0x01, 0x04, 0x2F, 0x00, 0x00, 0x38, 
+            0x02, 0x10, 0x28, 0x30, 0x00, 0x11, 0x32, 0xE9, 0x0A, 0x00, 0xB0, 0x09, 
+            0x00, 0x47, 0x09, 0x01, 0xE2, 0x09, 0x03, 0x7F, 0x0A, 0x01, 0xB2, 0x01, 
+            0x00, 0x06, 0x0B, 0x02, 0x1B, 0x00, 0x03, 0xD1, 0x09, 0x04, 0x2F, 0x01, 
+            0x08, 0x4D, 0x00, 0x00, 0xD9, 0x01, 0x09, 0x30, 0x00, 0x00, 0x02, 0x00, 
+            0x03, 0x4D, 0x00, 0x10, 0x36, 0x2F, 0x0A, 0x43, 0x62, 0x69, 0x6E, 0x34, 
+            0x4F, 0x06, 0x03, 0xCA, 0x03, 0x07, 0x37, 0x0B, 0x04, 0x93, 0x00, 0x04, 
+            0x35, 0x02, 0x0F, 0x22, 0x00, 0x07, 0x04, 0x7C, 0x00, 0x0F, 0x22, 0x00, 
+            0x07, 0x00, 0x21, 0x01, 0x19, 0x7D, 0x42, 0x04, 0x11, 0x33, 0x1E, 0x01, 
+            0x0F, 0x42, 0x04, 0x45, 0x04, 0x04, 0x02, 0x00, 0x0E, 0x01, 0x0F, 0x36, 
+            0x04, 0xFF, 0xEE, 0x05, 0xC8, 0x02, 0x00, 0x4E, 0x0D, 0x01, 0x0D, 0x02, 
+            0x0F, 0x8A, 0x03, 0x4F, 0x01, 0xA2, 0x09, 0x0F, 0x0F, 0x03, 0x07, 0x0F, 
+            0x53, 0x03, 0x13, 0x0A, 0x31, 0x03, 0x1F, 0x32, 0x31, 0x03, 0x3E, 0x0F, 
+            0x25, 0x03, 0xFF, 0x4E, 0x0F, 0x79, 0x02, 0x14, 0x0F, 0x2C, 0x02, 0x10, 
+            0x0A, 0x0A, 0x02, 0x4F, 0x66, 0x72, 0x6F, 0x6D, 0x32, 0x12, 0x41, 0x13, 
+            0x31, 0x50, 0x07, 0x00, 0x35, 0x05, 0x02, 0xDC, 0x11, 0x0F, 0x32, 0x12, 
+            0x85, 0x1B, 0x34, 0xD8, 0x0F, 0x09, 0x52, 0x12, 0x10, 0x3D, 0x20, 0x00, 
+            0x22, 0x26, 0x26, 0x81, 0x0C, 0x10, 0x3A, 0xB2, 0x09, 0x12, 0x28, 0xCE, 
+            0x00, 0x10, 0x2D, 0xA7, 0x11, 0x6B, 0x3D, 0x3D, 0x20, 0x27, 0x3D, 0x27, 
+            0x40, 0x00, 0x00, 0x02, 0x00, 0x2F, 0x69, 0x66, 0x32, 0x00, 0x01, 0x1F, 
+            0x32, 0x32, 0x00, 0x08, 0x00, 0x02, 0x00, 0x03, 0x10, 0x0B, 0x0A, 0x9D, 
+            0x03, 0x01, 0x0B, 0x0B, 0x12, 0x2C, 0x45, 0x0A, 0x00, 0x07, 0x00, 0x05, 
+            0x88, 0x00, 0x01, 0x57, 0x0A, 0x1E, 0x29, 0x13, 0x00, 0x01, 0x9B, 0x09, 
+            0x03, 0x44, 0x08, 0x0C, 0x02, 0x00, 0x01, 0x34, 0x00, 0x00, 0x09, 0x11, 
+            0x12, 0x34, 0xBC, 0x09, 0x0C, 0x02, 0x00, 0x0E, 0x26, 0x0F, 0x04, 0x02, 
+            0x00, 0x03, 0x3A, 0x09, 0x08, 0x02, 0x00, 0x03, 0xAF, 0x00, 0x0A, 0x7D, 
+            0x07, 0x0F, 0xAF, 0x00, 0x23, 0x0F, 0xC6, 0x00, 0x02, 0x1F, 0x32, 0xC6, 
+            0x00, 0x01, 0x0F, 0xC2, 0x00, 0x09, 0x0F, 0xBE, 0x00, 0x03, 0x0B, 0xBA, 
+            0x00, 0x03, 0xB6, 0x00, 0x0A, 0x75, 0x0C, 0x0F, 0xB6, 0x00, 0x3A, 0x0F, 
+            0xCD, 0x00, 0x02, 0x1C, 0x33, 0xCD, 0x00, 0x0F, 0xC9, 0x00, 0x05, 0x0E, 
+            0xC5, 0x00, 0x07, 0xC1, 0x00, 0x0C, 0x9C, 0x02, 0x0C, 0xEE, 0x14, 0x0F, 
+            0x78, 0x02, 0x03, 0x1F, 0x31, 0x78, 0x02, 0x08, 0x03, 0x0F, 0x01, 0x0F, 
+            0x74, 0x02, 0x44, 0x05, 0xE5, 0x00, 0x0B, 0x79, 0x13, 0x00, 0x02, 0x00, 
+            0x0E, 0xE9, 0x00, 0x00, 0x02, 0x00, 0x07, 0xED, 0x00, 0x00, 0x02, 0x00, 
+            0x03, 0x9F, 0x00, 0x0F, 0x64, 0x02, 0x57, 0x0F, 0xB2, 0x00, 0x05, 0x0E, 
+            0xAE, 0x00, 0x07, 0xAA, 0x00, 0x0C, 0x97, 0x01, 0x0C, 0x2B, 0x14, 0x03, 
+            0xC6, 0x00, 0x0F, 0x65, 0x01, 0x40, 0x05, 0xAF, 0x00, 0x0F, 0xEF, 0x12, 
+            0x1D, 0x96, 0x74, 0x72, 0x61, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x5F, 0xB3, 
+            0x0E, 0x1A, 0x3D, 0x9F, 0x0E, 0x07, 0x6B, 0x04, 0x06, 0xF3, 0x04, 0x08, 
+            0xC6, 0x02, 0x0F, 0x68, 0x0E, 0x10, 0x04, 0x66, 0x00, 0x16, 0x20, 0x66, 
+            0x00, 0x01, 0x08, 0x0F, 0x04, 0x18, 0x00, 0x06, 0x7E, 0x00, 0x03, 0xEB, 
+            0x03, 0x03, 0x55, 0x01, 0x03, 0xD0, 0x11, 0x02, 0xF5, 0x08, 0x01, 0xB3, 
+            0x06, 0x04, 0x75, 0x12, 0x0F, 0xB0, 0x06, 0x07, 0x0F, 0x77, 0x12, 0x33, 
+            0x08, 0x60, 0x00, 0x0F, 0x79, 0x12, 0x08, 0x01, 0x68, 0x07, 0x00, 0x02, 
+            0x00, 0x00, 0xE0, 0x06, 0x50, 0x72, 0x65, 0x73, 0x75, 0x6C, 0xE1, 0x06, 
+            0x34, 0x74, 0x72, 0x79, 0xEC, 0x01, 0x08, 0x48, 0x00, 0x01, 0x4A, 0x01, 
+            0x0F, 0x86, 0x12, 0x07, 0x00, 0x02, 0x00, 0x07, 0x77, 0x10, 0x02, 0x4E, 
+            0x00, 0x04, 0x50, 0x09, 0x04, 0x02, 0x00, 0x04, 0x6D, 0x01, 0x08, 0x58, 
+            0x00, 0x42, 0x29, 0x3A, 0x20, 0x7B, 0x2E, 0x00, 0x01, 0xC2, 0x11, 0x04, 
+            0x2B, 0x00, 0x03, 0x44, 0x01, 0x00, 0x02, 0x00, 0x03, 0x48, 0x01, 0x02, 
+            0x25, 0x00, 0x02, 0x22, 0x00, 0x03, 0x1E, 0x00, 0x03, 0x71, 0x00, 0x0F, 
+            0xF4, 0x12, 0x1D, 0x0B, 0x7F, 0x00, 0x01, 0xDA, 0x00, 0x03, 0x5A, 0x12, 
+            0x08, 0x98, 0x13, 0x0F, 0x1F, 0x01, 0xAE, 0x0F, 0x6F, 0x01, 0x04, 0x04, 
+            0xFB, 0x11, 0x0F, 0x73, 0x13, 0x30, 0x50, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 
+        },
+        2124,
+        8032,
+    },
+    {
+        "std/args.pyro",
+        (const uint8_t[]){
+            0xF5, 0x15, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x41, 0x72, 0x67, 0x53, 
+            0x74, 0x72, 0x65, 0x61, 0x6D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+            0x76, 0x61, 0x72, 0x20, 0x61, 0x72, 0x67, 0x73, 0x3A, 0x20, 0x76, 0x65, 
+            0x63, 0x3B, 0x13, 0x00, 0xF1, 0x01, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x3A, 
+            0x20, 0x69, 0x36, 0x34, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x0A, 0x19, 0x00, 
+            0xA5, 0x64, 0x65, 0x66, 0x20, 0x24, 0x69, 0x6E, 0x69, 0x74, 0x28, 0x32, 
+            0x00, 0x13, 0x29, 0x47, 0x00, 0x00, 0x02, 0x00, 0xE1, 0x61, 0x73, 0x73, 
+            0x65, 0x72, 0x74, 0x20, 0x24, 0x69, 0x73, 0x5F, 0x76, 0x65, 0x63, 0x24, 
+            0x00, 0x12, 0x29, 0x52, 0x00, 0x00, 0x02, 0x00, 0x50, 0x73, 0x65, 0x6C, 
+            0x66, 0x2E, 0x38, 0x00, 0x21, 0x20, 0x3D, 0x71, 0x00, 0x02, 0x1A, 0x00, 
+            0x12, 0x7D, 0x5A, 0x00, 0x31, 0x70, 0x75, 0x62, 0x5E, 0x00, 0xD7, 0x6E, 
+            0x65, 0x78, 0x74, 0x28, 0x29, 0x20, 0x2D, 0x3E, 0x20, 0x73, 0x74, 0x72, 
+            0x5B, 0x00, 0x01, 0x3D, 0x00, 0x01, 0x94, 0x00, 0x52, 0x20, 0x2B, 0x3D, 
+            0x20, 0x31, 0x3C, 0x00, 0x00, 0x02, 0x00, 0x62, 0x72, 0x65, 0x74, 0x75, 
+            0x72, 0x6E, 0x20, 0x00, 0x00, 0x5D, 0x00, 0x11, 0x5B, 0x0A, 0x00, 0x02, 
+            0x2A, 0x00, 0x42, 0x2D, 0x20, 0x31, 0x5D, 0x2A, 0x00, 0x0B, 0x66, 0x00, 
+            0x46, 0x68, 0x61, 0x73, 0x5F, 0x6A, 0x00, 0x47, 0x62, 0x6F, 0x6F, 0x6C, 
+            0x6B, 0x00, 0x08, 0x52, 0x00, 0x02, 0x48, 0x00, 0x16, 0x3C, 0x5F, 0x00, 
+            0x73, 0x3A, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x28, 0xD7, 0x00, 0x62, 0x7D, 
+            0x0A, 0x7D, 0x0A, 0x0A, 0x0A, 0x58, 0x01, 0x43, 0x46, 0x6C, 0x61, 0x67, 
+            0x46, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x57, 0x01, 0x01, 0x2C, 0x00, 0x0C, 
+            0x44, 0x01, 0x00, 0x1D, 0x00, 0x00, 0xEA, 0x00, 0x52, 0x66, 0x6F, 0x75, 
+            0x6E, 0x64, 0xEB, 0x00, 0x0F, 0x81, 0x00, 0x08, 0x01, 0x43, 0x00, 0x20, 
+            0x20, 0x3E, 0x82, 0x01, 0x00, 0xEE, 0x00, 0x0B, 0xC8, 0x00, 0x01, 0x1E, 
+            0x00, 0x02, 0x44, 0x00, 0x00, 0xA9, 0x01, 0x02, 0xD1, 0x01, 0x00, 0x02, 
+            0x00, 0x08, 0xC4, 0x00, 0x01, 0x25, 0x00, 0x04, 0x3F, 0x00, 0x06, 0xB0, 
+            0x00, 0x6B, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0xB2, 0x00, 0xF1, 0x06, 
+            0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x3A, 0x20, 0x63, 0x61, 0x6C, 0x6C, 
+            0x61, 0x62, 0x6C, 0x65, 0x3F, 0x28, 0x73, 0x74, 0x72, 0x8F, 0x01, 0x32, 
+            0x61, 0x6E, 0x79, 0x44, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xDD, 0x00, 0x86, 
+            0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x3A, 0x1A, 0x00, 0x00, 0x16, 
+            0x00, 0x52, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x4C, 0x02, 0x5D, 0x5B, 0x61, 
+            0x6E, 0x79, 0x5D, 0x39, 0x02, 0x08, 0x30, 0x02, 0x01, 0xAB, 0x01, 0x02, 
+            0x32, 0x00, 0x40, 0x20, 0x3D, 0x20, 0x24, 0x34, 0x02, 0x05, 0x59, 0x01, 
+            0x01, 0x70, 0x02, 0x00, 0x6C, 0x00, 0x00, 0x2C, 0x01, 0x71, 0x61, 0x70, 
+            0x70, 0x65, 0x6E, 0x64, 0x5F, 0x2B, 0x00, 0x11, 0x28, 0x06, 0x00, 0x10, 
+            0x3A, 0x20, 0x02, 0x08, 0x4C, 0x00, 0x22, 0x69, 0x66, 0xA5, 0x01, 0x02, 
+            0xC2, 0x00, 0x03, 0xD7, 0x00, 0x04, 0x02, 0x00, 0xF8, 0x01, 0x6C, 0x65, 
+            0x74, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x3D, 0x20, 0x74, 
+            0x72, 0x79, 0x2B, 0x00, 0x02, 0x50, 0x00, 0x03, 0x78, 0x00, 0x04, 0x02, 
+            0x00, 0x10, 0x69, 0xE8, 0x02, 0x62, 0x73, 0x5F, 0x65, 0x72, 0x72, 0x28, 
+            0x38, 0x00, 0x08, 0x6B, 0x00, 0x04, 0x02, 0x00, 0xF2, 0x02, 0x24, 0x70, 
+            0x61, 0x6E, 0x69, 0x63, 0x28, 0x22, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 
+            0x64, 0x20, 0x6F, 0x52, 0x01, 0x01, 0xA0, 0x00, 0x31, 0x20, 0x24, 0x7B, 
+            0x08, 0x00, 0x52, 0x7D, 0x3A, 0x20, 0x24, 0x7B, 0x43, 0x00, 0x2B, 0x7D, 
+            0x22, 0x65, 0x00, 0x03, 0xE5, 0x00, 0x04, 0x02, 0x00, 0x07, 0x0E, 0x01, 
+            0x12, 0x3A, 0xF1, 0x00, 0x04, 0x7C, 0x00, 0x02, 0x79, 0x01, 0x04, 0x02, 
+            0x00, 0x02, 0xDC, 0x01, 0x06, 0x14, 0x00, 0x07, 0x47, 0x00, 0x0F, 0x43, 
+            0x00, 0x00, 0x01, 0x86, 0x00, 0x07, 0x79, 0x00, 0x08, 0x3E, 0x00, 0x03, 
+            0x3A, 0x00, 0x04, 0x66, 0x01, 0x0F, 0x92, 0x02, 0x56, 0x01, 0x94, 0x00, 
+            0x0D, 0x4B, 0x03, 0x09, 0xF2, 0x01, 0x01, 0x23, 0x00, 0x02, 0xDA, 0x02, 
+            0x37, 0x61, 0x6E, 0x79, 0xCF, 0x01, 0x04, 0xE8, 0x01, 0x01, 0x21, 0x00, 
+            0x05, 0x44, 0x00, 0x00, 0x22, 0x03, 0x07, 0x25, 0x00, 0x00, 0x02, 0x00, 
+            0x02, 0xE9, 0x00, 0x02, 0xEA, 0x01, 0x03, 0x2D, 0x00, 0x35, 0x6C, 0x61, 
+            0x73, 0xBB, 0x03, 0x00, 0x02, 0x00, 0x6F, 0x7D, 0x20, 0x65, 0x6C, 0x73, 
+            0x65, 0x38, 0x00, 0x08, 0x03, 0xE4, 0x02, 0x08, 0x6C, 0x01, 0x01, 0x38, 
+            0x00, 0x0A, 0xB4, 0x04, 0x02, 0x5E, 0x00, 0x02, 0xAD, 0x00, 0x37, 0x76, 
+            0x65, 0x63, 0x50, 0x00, 0x0E, 0x84, 0x00, 0x02, 0x4B, 0x00, 0x02, 0x88, 
+            0x03, 0x00, 0x78, 0x01, 0x02, 0x3C, 0x04, 0x41, 0x41, 0x72, 0x67, 0x50, 
+            0x7A, 0x03, 0x03, 0x3C, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x4E, 0x03, 0x05, 
+            0x98, 0x05, 0x43, 0x5B, 0x73, 0x74, 0x72, 0xCB, 0x04, 0x04, 0x1C, 0x00, 
+            0xB2, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x5F, 0x6E, 0x61, 0x6D, 
+            0x0E, 0x03, 0x12, 0x3F, 0x5C, 0x00, 0x0C, 0x20, 0x00, 0x02, 0x11, 0x03, 
+            0x10, 0x3A, 0xF8, 0x05, 0x02, 0x64, 0x00, 0x13, 0x3F, 0x94, 0x03, 0x00, 
+            0x61, 0x00, 0x88, 0x68, 0x65, 0x6C, 0x70, 0x74, 0x65, 0x78, 0x74, 0x41, 
+            0x00, 0x00, 0x18, 0x00, 0x7C, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 
+            0x17, 0x00, 0x02, 0xE2, 0x02, 0x60, 0x73, 0x3A, 0x20, 0x6D, 0x61, 0x70, 
+            0x93, 0x00, 0x13, 0x2C, 0x46, 0x04, 0x03, 0x9B, 0x00, 0x00, 0x3A, 0x00, 
+            0x30, 0x66, 0x6C, 0x61, 0x4C, 0x06, 0x05, 0x21, 0x00, 0x00, 0x17, 0x05, 
+            0x07, 0x1F, 0x00, 0x03, 0xB6, 0x00, 0x08, 0x43, 0x00, 0x05, 0xFD, 0x00, 
+            0x08, 0x27, 0x00, 0x7B, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x8A, 
+            0x04, 0x07, 0x2D, 0x00, 0x03, 0xD3, 0x02, 0x00, 0x73, 0x00, 0x20, 0x65, 
+            0x6E, 0xAB, 0x04, 0x10, 0x5F, 0xCC, 0x00, 0x13, 0x5F, 0x60, 0x00, 0x12, 
+            0x3A, 0x54, 0x05, 0x73, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0xF1, 
+            0x00, 0x00, 0x4A, 0x04, 0x02, 0xBE, 0x06, 0x08, 0xCE, 0x03, 0x01, 0x34, 
+            0x03, 0x03, 0xD9, 0x00, 0x00, 0x86, 0x04, 0x34, 0x6D, 0x61, 0x70, 0xDF, 
+            0x05, 0x00, 0x02, 0x00, 0x01, 0x1F, 0x00, 0x01, 0xD5, 0x00, 0x0F, 0x1D, 
+            0x00, 0x05, 0x03, 0x73, 0x00, 0x0F, 0x20, 0x00, 0x06, 0x00, 0xC5, 0x01, 
+            0x00, 0x1C, 0x00, 0x0E, 0xDF, 0x04, 0x3B, 0x23, 0x20, 0x2D, 0x01, 0x00, 
+            0x21, 0x20, 0x23, 0x06, 0x03, 0xF5, 0x03, 0x23, 0x20, 0x20, 0x53, 0x65, 
+            0x74, 0x75, 0x70, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x73, 0x2E, 
+            0x20, 0x19, 0x00, 0x0B, 0x31, 0x00, 0x3A, 0x2D, 0x20, 0x23, 0x8D, 0x02, 
+            0x00, 0x06, 0x01, 0x00, 0xD2, 0x01, 0x20, 0x28, 0x2A, 0x78, 0x00, 0x01, 
+            0xBB, 0x05, 0x05, 0x61, 0x01, 0x88, 0x7C, 0x73, 0x74, 0x72, 0x7C, 0x6E, 
+            0x75, 0x6C, 0xEE, 0x06, 0x21, 0x69, 0x66, 0x8D, 0x07, 0x04, 0x8D, 0x03, 
+            0x3F, 0x20, 0x3D, 0x3D, 0x4A, 0x03, 0x0A, 0x04, 0x5F, 0x00, 0x02, 0x6C, 
+            0x02, 0x00, 0x02, 0x00, 0x03, 0x45, 0x03, 0x0F, 0x48, 0x00, 0x00, 0x13, 
+            0x31, 0xCE, 0x02, 0x04, 0x02, 0x00, 0x01, 0x4B, 0x01, 0x04, 0x41, 0x00, 
+            0x03, 0x05, 0x08, 0x23, 0x5B, 0x30, 0xF6, 0x01, 0x04, 0x02, 0x00, 0x07, 
+            0xD0, 0x07, 0x0D, 0x64, 0x00, 0x06, 0xE0, 0x06, 0x00, 0x02, 0x00, 0x04, 
+            0x7F, 0x05, 0x04, 0x52, 0x00, 0xF0, 0x04, 0x28, 0x29, 0x3A, 0x20, 0x65, 
+            0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x30, 0x20, 0x6F, 0x72, 
+            0x20, 0x31, 0xDB, 0x00, 0x72, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2C, 
+            0xDE, 0x04, 0x50, 0x20, 0x7B, 0x7D, 0x22, 0x2C, 0x16, 0x00, 0x05, 0x3A, 
+            0x04, 0x03, 0x48, 0x02, 0x00, 0x02, 0x00, 0x0F, 0xDD, 0x03, 0x03, 0x02, 
+            0x0A, 0x03, 0x0F, 0x4F, 0x01, 0x44, 0x03, 0x68, 0x03, 0x0D, 0xEA, 0x00, 
+            0x0F, 0x4E, 0x01, 0x15, 0x03, 0x40, 0x00, 0x0F, 0x4D, 0x01, 0x37, 0x03, 
+            0x51, 0x00, 0x0F, 0x4C, 0x01, 0x43, 0x00, 0x56, 0x08, 0x00, 0xD6, 0x03, 
+            0x14, 0x28, 0x09, 0x00, 0x06, 0xDF, 0x03, 0x00, 0x68, 0x08, 0x08, 0xDE, 
+            0x03, 0x0A, 0xB9, 0x02, 0x07, 0x49, 0x02, 0x01, 0x45, 0x02, 0x04, 0x40, 
+            0x00, 0x25, 0x20, 0x3D, 0x2A, 0x04, 0x06, 0x43, 0x01, 0x0D, 0x42, 0x02, 
+            0x0B, 0x5B, 0x06, 0x0F, 0x2F, 0x04, 0x00, 0x12, 0x28, 0x14, 0x00, 0x02, 
+            0x36, 0x04, 0x0F, 0x7B, 0x00, 0x0B, 0x02, 0x2A, 0x00, 0x09, 0x6D, 0x04, 
+            0x32, 0x20, 0x3D, 0x20, 0x16, 0x00, 0x0F, 0x84, 0x00, 0x17, 0x00, 0x51, 
+            0x04, 0x15, 0x28, 0xBA, 0x05, 0x08, 0x8F, 0x04, 0x00, 0xD1, 0x04, 0x00, 
+            0x1E, 0x00, 0x21, 0x20, 0x3D, 0x3B, 0x05, 0x08, 0x8B, 0x04, 0xD1, 0x66, 
+            0x6F, 0x72, 0x20, 0x61, 0x6C, 0x69, 0x61, 0x73, 0x20, 0x69, 0x6E, 0x20, 
+            0x3D, 0x00, 0x3B, 0x73, 0x70, 0x6C, 0xCE, 0x04, 0x00, 0x02, 0x00, 0x01, 
+            0x23, 0x01, 0x00, 0x44, 0x00, 0x21, 0x73, 0x5B, 0x2F, 0x00, 0x40, 0x5D, 
+            0x20, 0x3D, 0x20, 0x0F, 0x00, 0x06, 0x9F, 0x00, 0x02, 0xEA, 0x02, 0x00, 
+            0x02, 0x00, 0x0F, 0x2D, 0x01, 0x0D, 0x02, 0x19, 0x05, 0x06, 0xAB, 0x00, 
+            0x10, 0x2C, 0xA6, 0x0B, 0x05, 0xF8, 0x09, 0x30, 0x20, 0x3D, 0x20, 0x4F, 
+            0x04, 0x24, 0x2C, 0x20, 0x65, 0x06, 0x00, 0x99, 0x01, 0x00, 0x8D, 0x05, 
+            0x00, 0xCF, 0x01, 0x01, 0x48, 0x01, 0x00, 0xBD, 0x07, 0x02, 0x25, 0x00, 
+            0x0C, 0xE5, 0x00, 0x02, 0x5A, 0x00, 0x23, 0x20, 0x3D, 0x43, 0x06, 0x0F, 
+            0xE9, 0x00, 0x26, 0x02, 0x48, 0x00, 0x07, 0xEB, 0x00, 0x02, 0x11, 0x00, 
+            0x0F, 0xED, 0x00, 0x01, 0x02, 0x1A, 0x00, 0x04, 0xD6, 0x07, 0x24, 0x20, 
+            0x3D, 0xCC, 0x00, 0x06, 0x2C, 0x00, 0x03, 0x22, 0x00, 0x02, 0xCF, 0x00, 
+            0x23, 0x20, 0x3D, 0xD8, 0x00, 0x06, 0x20, 0x00, 0x0F, 0x2F, 0x01, 0x0D, 
+            0x03, 0x0C, 0x06, 0x06, 0x30, 0x01, 0x01, 0x05, 0x01, 0x05, 0x81, 0x05, 
+            0x0C, 0xC8, 0x02, 0x02, 0x37, 0x02, 0x0C, 0x4D, 0x02, 0x46, 0x74, 0x72, 
+            0x75, 0x65, 0x73, 0x00, 0x00, 0x11, 0x02, 0x24, 0x63, 0x6D, 0xC8, 0x07, 
+            0x26, 0x20, 0x3D, 0xC9, 0x07, 0x0F, 0x33, 0x01, 0x26, 0x03, 0xA6, 0x00, 
+            0x07, 0x34, 0x01, 0x06, 0x61, 0x00, 0x06, 0x79, 0x00, 0x0D, 0x25, 0x02, 
+            0x0C, 0x25, 0x00, 0x03, 0x58, 0x03, 0x0E, 0x94, 0x06, 0x01, 0x02, 0x00, 
+            0x05, 0xB2, 0x06, 0x40, 0x20, 0x49, 0x6E, 0x73, 0x96, 0x05, 0x00, 0x6E, 
+            0x0C, 0x0F, 0xD0, 0x06, 0x0F, 0x01, 0x02, 0x00, 0x0C, 0xD5, 0x06, 0x01, 
+            0xC3, 0x0C, 0x0B, 0x55, 0x01, 0x0A, 0xF1, 0x0C, 0x21, 0x69, 0x66, 0x12, 
+            0x03, 0x00, 0x1A, 0x03, 0x06, 0xFF, 0x02, 0x07, 0x6F, 0x01, 0x00, 0x02, 
+            0x00, 0x07, 0xBD, 0x01, 0x10, 0x2E, 0x10, 0x03, 0x20, 0x73, 0x5B, 0x45, 
+            0x03, 0x14, 0x5D, 0xFB, 0x06, 0x07, 0xFA, 0x00, 0x02, 0x18, 0x0A, 0x0C, 
+            0x54, 0x00, 0x02, 0x1D, 0x02, 0x0F, 0x56, 0x00, 0x09, 0x03, 0x22, 0x00, 
+            0x0F, 0x58, 0x00, 0x0C, 0x0F, 0xC7, 0x06, 0x03, 0x02, 0xE4, 0x00, 0xF1, 
+            0x0C, 0x29, 0x3A, 0x20, 0x27, 0x7B, 0x7D, 0x27, 0x20, 0x69, 0x73, 0x20, 
+            0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 
+            0x65, 0x72, 0x65, 0x64, 0xC4, 0x03, 0x00, 0xD7, 0x06, 0x02, 0x66, 0x00, 
+            0x01, 0xF0, 0x00, 0x21, 0x22, 0x2C, 0x07, 0x00, 0x08, 0xBC, 0x00, 0x01, 
+            0x41, 0x08, 0x03, 0x9B, 0x01, 0x00, 0x0C, 0x0A, 0x00, 0xF6, 0x08, 0x01, 
+            0xFC, 0x06, 0x0B, 0x40, 0x01, 0x01, 0x21, 0x09, 0x06, 0x8B, 0x00, 0x07, 
+            0x1D, 0x01, 0x03, 0x11, 0x01, 0x00, 0x1D, 0x01, 0x01, 0x59, 0x0B, 0x02, 
+            0x5D, 0x00, 0x0B, 0x53, 0x00, 0x01, 0xF5, 0x0A, 0x0B, 0x53, 0x00, 0x00, 
+            0xED, 0x03, 0x06, 0x52, 0x00, 0x0F, 0x3F, 0x01, 0x2D, 0x02, 0x62, 0x00, 
+            0x08, 0xDB, 0x00, 0x02, 0x97, 0x01, 0x06, 0x62, 0x00, 0x00, 0x02, 0x00, 
+            0x04, 0x06, 0x08, 0x03, 0x2E, 0x00, 0x0F, 0x3F, 0x01, 0x08, 0x0F, 0x37, 
+            0x01, 0x1F, 0x01, 0x54, 0x00, 0x1F, 0x73, 0xE5, 0x00, 0x4F, 0x1F, 0x73, 
+            0x7D, 0x02, 0x00, 0x0F, 0xE6, 0x00, 0x08, 0x1F, 0x73, 0xE7, 0x00, 0x34, 
+            0x0F, 0xB9, 0x03, 0x03, 0x06, 0xB8, 0x03, 0x00, 0x2F, 0x0C, 0xDF, 0x69, 
+            0x6E, 0x67, 0x20, 0x6D, 0x61, 0x63, 0x68, 0x69, 0x6E, 0x65, 0x72, 0x79, 
+            0x87, 0x0A, 0x08, 0x00, 0x02, 0x00, 0x0C, 0xB6, 0x03, 0x01, 0x46, 0x05, 
+            0x01, 0x06, 0x12, 0x60, 0x3A, 0x20, 0x69, 0x74, 0x65, 0x72, 0x19, 0x06, 
+            0x10, 0x3F, 0x37, 0x0C, 0x00, 0x91, 0x06, 0x00, 0x38, 0x06, 0x01, 0x1D, 
+            0x05, 0x47, 0x65, 0x72, 0x72, 0x3F, 0x53, 0x03, 0x03, 0xFA, 0x08, 0x07, 
+            0x12, 0x00, 0x00, 0x02, 0x00, 0x40, 0x69, 0x66, 0x20, 0x21, 0x91, 0x0F, 
+            0x04, 0x47, 0x00, 0x01, 0x56, 0x00, 0x08, 0x52, 0x06, 0x04, 0x02, 0x00, 
+            0x04, 0x0F, 0x02, 0x02, 0x7C, 0x00, 0x34, 0x29, 0x3A, 0x20, 0x9D, 0x0F, 
+            0x04, 0x0A, 0x0A, 0x20, 0x20, 0x5B, 0x18, 0x0B, 0x26, 0x5D, 0x2C, 0x2B, 
+            0x0A, 0x25, 0x61, 0x6E, 0x9E, 0x00, 0x0F, 0xA2, 0x0F, 0x0C, 0x01, 0x81, 
+            0x07, 0x20, 0x72, 0x67, 0x65, 0x04, 0x00, 0x45, 0x00, 0x0B, 0xA4, 0x00, 
+            0x00, 0x02, 0x00, 0x04, 0xA8, 0x00, 0x30, 0x73, 0x74, 0x72, 0xA3, 0x00, 
+            0x0F, 0xA2, 0x00, 0x01, 0x00, 0x02, 0x00, 0x0F, 0xA6, 0x00, 0x2B, 0x30, 
+            0x20, 0x6F, 0x66, 0xF0, 0x0D, 0x4C, 0x69, 0x6E, 0x67, 0x73, 0xB1, 0x00, 
+            0x00, 0x02, 0x00, 0x06, 0xB8, 0x05, 0x00, 0x02, 0x00, 0x03, 0xB7, 0x03, 
+            0x04, 0x02, 0x00, 0x00, 0x0A, 0x11, 0x30, 0x61, 0x72, 0x67, 0xA0, 0x13, 
+            0x00, 0x94, 0x0C, 0x00, 0x50, 0x01, 0x00, 0xA9, 0x00, 0x50, 0x73, 0x29, 
+            0x3A, 0x74, 0x6F, 0x15, 0x00, 0x08, 0x8A, 0x02, 0x00, 0x02, 0x00, 0x04, 
+            0x30, 0x00, 0x12, 0x73, 0x33, 0x14, 0x01, 0x7E, 0x06, 0x02, 0x3F, 0x14, 
+            0x00, 0x37, 0x00, 0x00, 0x32, 0x00, 0x13, 0x29, 0x5E, 0x0D, 0x04, 0x02, 
+            0x00, 0x03, 0x49, 0x04, 0x04, 0x66, 0x11, 0x11, 0x3A, 0x8A, 0x01, 0x03, 
+            0x40, 0x00, 0x01, 0x34, 0x00, 0x02, 0x0B, 0x00, 0x08, 0xD8, 0x03, 0x02, 
+            0xC2, 0x0C, 0x00, 0x02, 0x00, 0x00, 0x78, 0x11, 0x00, 0x5B, 0x01, 0x03, 
+            0x83, 0x04, 0x5B, 0x29, 0x20, 0x3C, 0x20, 0x32, 0x67, 0x01, 0x03, 0x60, 
+            0x00, 0x00, 0x40, 0x02, 0x02, 0x99, 0x04, 0x00, 0x02, 0x00, 0x07, 0xE6, 
+            0x00, 0x0F, 0xB2, 0x00, 0x08, 0x02, 0x5B, 0x00, 0x87, 0x73, 0x6C, 0x69, 
+            0x63, 0x65, 0x28, 0x31, 0x29, 0x82, 0x00, 0x03, 0x54, 0x00, 0x0F, 0xB4, 
+            0x00, 0x14, 0x03, 0x6D, 0x00, 0x00, 0x59, 0x05, 0x09, 0xDD, 0x00, 0x02, 
+            0xD9, 0x00, 0x01, 0x6A, 0x0F, 0x02, 0x23, 0x01, 0x08, 0xFF, 0x01, 0x00, 
+            0xC7, 0x07, 0xC1, 0x69, 0x73, 0x5F, 0x66, 0x69, 0x72, 0x73, 0x74, 0x5F, 
+            0x61, 0x72, 0x67, 0x89, 0x12, 0x00, 0xE8, 0x07, 0x01, 0xB0, 0x05, 0x00, 
+            0x02, 0x00, 0x60, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x3A, 0x09, 0x46, 
+            0x65, 0x61, 0x6D, 0x3A, 0xA3, 0x14, 0x08, 0x46, 0x00, 0x00, 0x02, 0x00, 
+            0x00, 0x4A, 0x00, 0x02, 0x41, 0x00, 0x03, 0x71, 0x00, 0x02, 0xCA, 0x14, 
+            0x07, 0x4A, 0x00, 0x00, 0x02, 0x00, 0x02, 0x48, 0x03, 0x00, 0xCF, 0x0D, 
+            0x4B, 0x22, 0x2D, 0x2D, 0x22, 0x44, 0x01, 0x00, 0x02, 0x00, 0x0F, 0x6F, 
+            0x00, 0x15, 0x04, 0x02, 0x00, 0x01, 0x57, 0x07, 0x01, 0x41, 0x01, 0x03, 
+            0x9D, 0x12, 0x09, 0x7E, 0x00, 0x07, 0x4D, 0x01, 0x04, 0x02, 0x00, 0x0F, 
+            0x88, 0x02, 0x0A, 0x01, 0x79, 0x11, 0x02, 0xA4, 0x00, 0xD0, 0x3A, 0x73, 
+            0x74, 0x61, 0x72, 0x74, 0x73, 0x5F, 0x77, 0x69, 0x74, 0x68, 0x28, 0xAD, 
+            0x00, 0x0C, 0xF1, 0x00, 0x00, 0x02, 0x00, 0x03, 0x2B, 0x00, 0xBF, 0x63, 
+            0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x28, 0x22, 0x3D, 0x27, 0x00, 
+            0x02, 0x00, 0x02, 0x00, 0x00, 0xA9, 0x00, 0xF2, 0x00, 0x3A, 0x68, 0x61, 
+            0x6E, 0x64, 0x6C, 0x65, 0x5F, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x73, 0x5F, 
+            0xFB, 0x05, 0x00, 0x7E, 0x02, 0x03, 0xFE, 0x01, 0x1F, 0x32, 0xB1, 0x00, 
+            0x02, 0x0F, 0x60, 0x06, 0x01, 0x04, 0x02, 0x00, 0x08, 0x56, 0x00, 0x4F, 
+            0x6C, 0x6F, 0x6E, 0x67, 0x54, 0x00, 0x01, 0x10, 0x2C, 0x97, 0x03, 0x0A, 
+            0xDC, 0x02, 0x04, 0x02, 0x00, 0x0F, 0x0D, 0x01, 0x24, 0x0F, 0xE5, 0x00, 
+            0x02, 0x02, 0x0C, 0x01, 0x02, 0xDB, 0x01, 0x51, 0x22, 0x20, 0x7C, 0x7C, 
+            0x20, 0xD9, 0x00, 0x30, 0x62, 0x79, 0x74, 0xD6, 0x02, 0xA0, 0x20, 0x3E, 
+            0x3D, 0x20, 0x27, 0x30, 0x27, 0x20, 0x26, 0x26, 0xAB, 0x04, 0x05, 0x16, 
+            0x00, 0x6F, 0x3C, 0x3D, 0x20, 0x27, 0x39, 0x27, 0x33, 0x01, 0x09, 0x01, 
+            0x9B, 0x17, 0x04, 0x79, 0x14, 0x3F, 0x61, 0x72, 0x67, 0x21, 0x01, 0x07, 
+            0x02, 0x80, 0x00, 0x0F, 0x8C, 0x01, 0x36, 0x09, 0x8A, 0x03, 0x04, 0x02, 
+            0x00, 0x03, 0x56, 0x10, 0x0A, 0x06, 0x07, 0x04, 0x02, 0x00, 0x08, 0x8C, 
+            0x01, 0x5E, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x8D, 0x01, 0x1F, 0x31, 0x8D, 
+            0x01, 0x2E, 0x09, 0xAD, 0x03, 0x22, 0x26, 0x26, 0x49, 0x14, 0x04, 0x3A, 
+            0x0B, 0x06, 0xFD, 0x00, 0x00, 0x2A, 0x01, 0x0F, 0x5E, 0x03, 0x00, 0x00, 
+            0xA3, 0x00, 0x04, 0x2E, 0x00, 0x01, 0xA3, 0x13, 0x02, 0xA3, 0x0F, 0x06, 
+            0xB2, 0x04, 0x04, 0x02, 0x00, 0x09, 0x29, 0x00, 0x01, 0x4F, 0x04, 0x3A, 
+            0x72, 0x20, 0x3D, 0x6D, 0x00, 0x00, 0xB2, 0x06, 0x04, 0x49, 0x17, 0x08, 
+            0x02, 0x00, 0x00, 0x09, 0x04, 0x05, 0x94, 0x0B, 0x03, 0x62, 0x05, 0x12, 
+            0x5F, 0x62, 0x0B, 0x00, 0xDC, 0x05, 0x02, 0x0A, 0x00, 0x1F, 0x28, 0x61, 
+            0x00, 0x00, 0x31, 0x2C, 0x20, 0x22, 0x6A, 0x00, 0x03, 0x34, 0x00, 0x0F, 
+            0x45, 0x06, 0x01, 0x0F, 0x58, 0x00, 0x04, 0x03, 0x9E, 0x04, 0x0C, 0xF4, 
+            0x05, 0x00, 0x02, 0x00, 0x04, 0x8E, 0x00, 0x00, 0x03, 0x0E, 0x00, 0xE5, 
+            0x0F, 0x00, 0x83, 0x00, 0x4F, 0x66, 0x69, 0x65, 0x6C, 0x82, 0x00, 0x05, 
+            0x04, 0x28, 0x00, 0x0F, 0x7E, 0x00, 0x01, 0x40, 0x69, 0x66, 0x20, 0x28, 
+            0x82, 0x00, 0x04, 0x24, 0x00, 0x0F, 0xB8, 0x02, 0x05, 0x08, 0x24, 0x00, 
+            0x00, 0x05, 0x03, 0x19, 0x2C, 0x39, 0x01, 0x11, 0x5F, 0xE5, 0x00, 0x1F, 
+            0x72, 0xC9, 0x02, 0x01, 0x05, 0x75, 0x05, 0x00, 0x02, 0x00, 0x03, 0xD0, 
+            0x05, 0x04, 0x02, 0x00, 0x04, 0x9B, 0x04, 0x0F, 0x01, 0x02, 0x02, 0x0F, 
+            0xB2, 0x0D, 0x01, 0x02, 0x6B, 0x03, 0x01, 0x90, 0x03, 0x00, 0x8C, 0x12, 
+            0x0F, 0x6D, 0x05, 0x01, 0x00, 0xB6, 0x16, 0x01, 0x1B, 0x04, 0x07, 0xD8, 
+            0x05, 0x0F, 0x36, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x48, 0x01, 0x00, 
+            0x7B, 0x0B, 0x00, 0x06, 0x02, 0x02, 0x33, 0x00, 0x04, 0xE0, 0x05, 0x00, 
+            0x1E, 0x00, 0x0C, 0x02, 0x00, 0x00, 0x59, 0x00, 0x00, 0x58, 0x1B, 0x03, 
+            0x6B, 0x02, 0x00, 0xD7, 0x12, 0x03, 0x22, 0x05, 0x00, 0x44, 0x00, 0x0F, 
+            0x38, 0x01, 0x05, 0x00, 0x02, 0x00, 0x08, 0x18, 0x02, 0x04, 0x0A, 0x0D, 
+            0x41, 0x65, 0x78, 0x69, 0x74, 0x88, 0x05, 0x01, 0x93, 0x0E, 0x00, 0x54, 
+            0x06, 0x00, 0x2A, 0x00, 0x0C, 0x02, 0x00, 0x0F, 0x9C, 0x03, 0x0A, 0x00, 
+            0x02, 0x00, 0x04, 0xDF, 0x08, 0x0C, 0xCA, 0x0C, 0x93, 0x63, 0x6F, 0x67, 
+            0x6E, 0x69, 0x73, 0x65, 0x64, 0x20, 0xAE, 0x00, 0x0E, 0xBE, 0x0C, 0x08, 
+            0x02, 0x00, 0x0A, 0x33, 0x05, 0x00, 0x02, 0x00, 0x0F, 0x79, 0x00, 0x0A, 
+            0x04, 0x75, 0x00, 0x05, 0x03, 0x14, 0x11, 0x61, 0xA6, 0x09, 0x01, 0xFF, 
+            0x13, 0x01, 0xBA, 0x09, 0x40, 0x74, 0x68, 0x65, 0x20, 0xA0, 0x01, 0x05, 
+            0x7E, 0x00, 0x0F, 0x19, 0x02, 0x22, 0x0E, 0x92, 0x04, 0x01, 0x49, 0x01, 
+            0x08, 0x19, 0x07, 0x00, 0x13, 0x04, 0x0A, 0x3A, 0x01, 0x0B, 0x62, 0x02, 
+            0x09, 0x5A, 0x02, 0x05, 0xA4, 0x16, 0x00, 0xE2, 0x00, 0x00, 0x02, 0x00, 
+            0x02, 0xF8, 0x00, 0x03, 0x33, 0x00, 0x11, 0x23, 0x86, 0x0B, 0x44, 0x65, 
+            0x20, 0x61, 0x6E, 0x5F, 0x1A, 0x21, 0x6F, 0x66, 0xCA, 0x00, 0x70, 0x66, 
+            0x6F, 0x72, 0x6D, 0x20, 0x2D, 0x2D, 0xE6, 0x01, 0x11, 0x3D, 0xA8, 0x0C, 
+            0x00, 0x1A, 0x0E, 0x22, 0x2D, 0x6E, 0x0C, 0x00, 0x11, 0x2E, 0xE0, 0x02, 
+            0x00, 0xA1, 0x08, 0x0F, 0x08, 0x07, 0x06, 0x00, 0x5D, 0x02, 0x08, 0x1F, 
+            0x02, 0x00, 0x77, 0x02, 0x02, 0xEE, 0x1C, 0x01, 0x9E, 0x1D, 0x11, 0x3A, 
+            0x0C, 0x00, 0x31, 0x5F, 0x6F, 0x66, 0x6A, 0x07, 0x06, 0x9D, 0x00, 0x00, 
+            0x27, 0x00, 0x00, 0x74, 0x00, 0x02, 0xCF, 0x04, 0x03, 0x4E, 0x07, 0x31, 
+            0x30, 0x2C, 0x20, 0x2F, 0x00, 0x07, 0x51, 0x01, 0x00, 0x28, 0x00, 0x02, 
+            0x97, 0x00, 0x02, 0x4F, 0x00, 0x02, 0x77, 0x07, 0x01, 0x26, 0x00, 0x48, 
+            0x20, 0x2B, 0x20, 0x31, 0x41, 0x04, 0x00, 0x34, 0x0B, 0x01, 0x44, 0x01, 
+            0x02, 0xA6, 0x07, 0x0F, 0xC3, 0x02, 0x0C, 0x04, 0xE7, 0x01, 0x0F, 0x5C, 
+            0x02, 0x06, 0x02, 0x46, 0x00, 0x01, 0x17, 0x0F, 0x0E, 0x60, 0x02, 0x03, 
+            0x56, 0x01, 0x00, 0x02, 0x00, 0x08, 0x73, 0x00, 0x03, 0xB1, 0x0F, 0x02, 
+            0xD9, 0x08, 0x08, 0x67, 0x1C, 0x03, 0xD2, 0x00, 0x03, 0x37, 0x00, 0x05, 
+            0x8D, 0x01, 0x10, 0x20, 0x02, 0x08, 0x11, 0x2D, 0x83, 0x01, 0x02, 0x6F, 
+            0x00, 0x67, 0x2C, 0x20, 0x69, 0x2E, 0x65, 0x2E, 0xA6, 0x01, 0x60, 0x62, 
+            0x65, 0x67, 0x69, 0x6E, 0x6E, 0x3E, 0x0D, 0x00, 0xD7, 0x08, 0xED, 0x20, 
+            0x61, 0x20, 0x64, 0x6F, 0x75, 0x62, 0x6C, 0x65, 0x20, 0x64, 0x61, 0x73, 
+            0x68, 0x9E, 0x01, 0x00, 0x4E, 0x00, 0x08, 0xC3, 0x06, 0x00, 0x9C, 0x01, 
+            0x04, 0xBF, 0x06, 0x0F, 0x4F, 0x0A, 0x04, 0x04, 0xF8, 0x03, 0x01, 0xC8, 
+            0x10, 0x0F, 0x8E, 0x06, 0x0A, 0x01, 0xE8, 0x00, 0x01, 0x27, 0x00, 0x01, 
+            0x48, 0x06, 0x11, 0x2E, 0x68, 0x10, 0x0B, 0x45, 0x1F, 0x03, 0x59, 0x03, 
+            0x04, 0x55, 0x00, 0x02, 0xD4, 0x00, 0x07, 0x89, 0x01, 0x00, 0xD2, 0x02, 
+            0x0B, 0xAF, 0x04, 0x00, 0x2C, 0x00, 0x02, 0x9F, 0x04, 0x06, 0xAA, 0x0A, 
+            0x0B, 0x23, 0x00, 0x00, 0x02, 0x00, 0x08, 0x08, 0x02, 0x09, 0x31, 0x0A, 
+            0x06, 0x53, 0x02, 0x04, 0x02, 0x00, 0x01, 0xA9, 0x00, 0x03, 0x7B, 0x00, 
+            0x01, 0xAB, 0x00, 0x03, 0x8D, 0x08, 0x0F, 0x90, 0x01, 0x00, 0x04, 0x02, 
+            0x00, 0x03, 0xB8, 0x00, 0x0E, 0x94, 0x03, 0x04, 0x26, 0x02, 0x02, 0x4F, 
+            0x00, 0xE8, 0x20, 0x2D, 0x2D, 0x7B, 0x7D, 0x20, 0x72, 0x65, 0x71, 0x75, 
+            0x69, 0x72, 0x65, 0x73, 0x19, 0x04, 0x02, 0x0D, 0x18, 0x03, 0xE6, 0x01, 
+            0x04, 0x02, 0x00, 0x02, 0x81, 0x03, 0x00, 0x02, 0x00, 0x03, 0x60, 0x00, 
+            0x02, 0xF1, 0x08, 0x07, 0xE1, 0x05, 0x04, 0x0F, 0x08, 0x00, 0x4F, 0x04, 
+            0x00, 0x6D, 0x19, 0x0B, 0xF9, 0x00, 0x00, 0xCA, 0x00, 0x0F, 0x4C, 0x05, 
+            0x08, 0x0E, 0x56, 0x00, 0x03, 0x76, 0x17, 0x06, 0x59, 0x00, 0x03, 0x11, 
+            0x00, 0x0F, 0x58, 0x00, 0x0B, 0x03, 0x25, 0x00, 0x08, 0x4C, 0x01, 0x03, 
+            0x5B, 0x00, 0x0A, 0x11, 0x01, 0x04, 0x0D, 0x01, 0x01, 0x06, 0x01, 0x07, 
+            0x59, 0x12, 0x05, 0x8F, 0x05, 0x00, 0x1E, 0x02, 0x00, 0x3F, 0x04, 0x03, 
+            0x2E, 0x01, 0x00, 0xE0, 0x03, 0x0D, 0x19, 0x01, 0x02, 0x15, 0x01, 0x0D, 
+            0x09, 0x03, 0x01, 0x7F, 0x09, 0x0F, 0x0A, 0x03, 0x1B, 0x4F, 0x73, 0x69, 
+            0x6E, 0x67, 0x0A, 0x03, 0x05, 0x01, 0x4F, 0x00, 0x0F, 0x0B, 0x03, 0x1C, 
+            0x00, 0xDC, 0x05, 0x21, 0x63, 0x68, 0xBF, 0x04, 0x00, 0xF3, 0x0A, 0x0B, 
+            0x34, 0x01, 0x00, 0xA8, 0x02, 0x00, 0x21, 0x07, 0x00, 0xE4, 0x00, 0x07, 
+            0xD2, 0x02, 0x00, 0x31, 0x00, 0x08, 0xFF, 0x04, 0x04, 0x02, 0x00, 0x00, 
+            0xBB, 0x01, 0x03, 0x1D, 0x14, 0x00, 0x23, 0x00, 0x0F, 0x2F, 0x03, 0x03, 
+            0x00, 0x02, 0x00, 0x03, 0x6A, 0x01, 0x04, 0x5F, 0x00, 0x02, 0x3B, 0x01, 
+            0x0F, 0x61, 0x00, 0x10, 0x00, 0x31, 0x00, 0x0F, 0x38, 0x03, 0x10, 0x00, 
+            0x02, 0x00, 0x0F, 0x3C, 0x03, 0x18, 0x00, 0x02, 0x00, 0x01, 0xBB, 0x00, 
+            0x03, 0x88, 0x00, 0x02, 0xBD, 0x00, 0x0F, 0x41, 0x03, 0x0F, 0x00, 0x02, 
+            0x00, 0x06, 0xCA, 0x00, 0x04, 0x31, 0x0C, 0x11, 0x5F, 0x24, 0x04, 0x01, 
+            0x56, 0x1F, 0x0C, 0xC4, 0x1B, 0x04, 0x02, 0x00, 0x04, 0x54, 0x02, 0x02, 
+            0x70, 0x00, 0x03, 0xB4, 0x14, 0x2F, 0x6E, 0x20, 0x68, 0x03, 0x08, 0x00, 
+            0x92, 0x00, 0x01, 0x7B, 0x1B, 0x0B, 0x6E, 0x03, 0x00, 0x02, 0x00, 0x03, 
+            0x83, 0x00, 0x0A, 0xB7, 0x02, 0x04, 0x02, 0x00, 0x0B, 0x6B, 0x00, 0x0F, 
+            0x63, 0x00, 0x0C, 0x0F, 0x5E, 0x00, 0x01, 0x01, 0x0E, 0x07, 0x04, 0x02, 
+            0x00, 0x03, 0x6C, 0x00, 0x21, 0x69, 0x66, 0x92, 0x00, 0x02, 0xD5, 0x03, 
+            0x06, 0x79, 0x03, 0x0F, 0xD2, 0x03, 0x04, 0x00, 0x02, 0x00, 0x00, 0x60, 
+            0x01, 0x0F, 0xD6, 0x03, 0x08, 0x00, 0x02, 0x00, 0x0F, 0x5C, 0x00, 0x00, 
+            0x16, 0x76, 0x5C, 0x00, 0x03, 0xB0, 0x03, 0x0B, 0xA1, 0x02, 0x00, 0x02, 
+            0x00, 0x0B, 0x5B, 0x00, 0x03, 0x29, 0x00, 0x08, 0xD9, 0x03, 0x00, 0x02, 
+            0x00, 0x06, 0x5E, 0x00, 0x0F, 0xA9, 0x01, 0x14, 0x04, 0x3A, 0x01, 0x02, 
+            0x2C, 0x07, 0x02, 0x3B, 0x01, 0x0F, 0x00, 0x04, 0x17, 0x00, 0x1F, 0x01, 
+            0x0F, 0xB1, 0x01, 0x01, 0x03, 0x87, 0x00, 0x0E, 0xAD, 0x01, 0x04, 0x6F, 
+            0x00, 0x00, 0xA2, 0x01, 0x0F, 0x67, 0x00, 0x17, 0x00, 0x5C, 0x06, 0x0A, 
+            0x0D, 0x06, 0x02, 0x6B, 0x04, 0x00, 0x02, 0x00, 0x02, 0x0A, 0x00, 0x05, 
+            0x75, 0x04, 0x00, 0x65, 0x14, 0x04, 0x02, 0x00, 0x06, 0xA7, 0x14, 0x9F, 
+            0x55, 0x74, 0x69, 0x6C, 0x69, 0x74, 0x69, 0x65, 0x73, 0x9F, 0x14, 0x04, 
+            0x0C, 0x97, 0x14, 0x0C, 0x99, 0x05, 0x07, 0x90, 0x01, 0x00, 0x9D, 0x03, 
+            0x00, 0x2D, 0x04, 0x0F, 0x06, 0x02, 0x04, 0x4A, 0x65, 0x63, 0x68, 0x6F, 
+            0x21, 0x00, 0x59, 0x3A, 0x73, 0x74, 0x72, 0x69, 0x30, 0x20, 0x02, 0xB3, 
+            0x00, 0x00, 0x02, 0x00, 0x10, 0x24, 0x69, 0x00, 0x23, 0x28, 0x30, 0x91, 
+            0x02, 0x03, 0xC5, 0x00, 0x04, 0x92, 0x17, 0x00, 0x1C, 0x00, 0x02, 0x6A, 
+            0x0B, 0x05, 0xED, 0x01, 0x0F, 0x88, 0x00, 0x00, 0x03, 0x1C, 0x00, 0x07, 
+            0x1A, 0x00, 0x00, 0x02, 0x00, 0x06, 0x87, 0x00, 0x03, 0x20, 0x00, 0x0F, 
+            0x86, 0x00, 0x1E, 0x00, 0x1A, 0x0A, 0x10, 0x24, 0xA4, 0x14, 0x08, 0x03, 
+            0x05, 0x00, 0x39, 0x13, 0x30, 0x62, 0x75, 0x66, 0xB8, 0x0D, 0x30, 0x62, 
+            0x75, 0x66, 0x7D, 0x02, 0x05, 0x38, 0x03, 0xB0, 0x62, 0x75, 0x66, 0x3A, 
+            0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x22, 0x95, 0x1C, 0x48, 0x73, 0x3A, 
+            0x5C, 0x6E, 0x15, 0x0A, 0x04, 0x37, 0x01, 0x04, 0x64, 0x05, 0x04, 0x3D, 
+            0x04, 0x1B, 0x30, 0xB9, 0x00, 0x00, 0xAA, 0x05, 0x01, 0x4E, 0x17, 0x11, 
+            0x2C, 0xCC, 0x18, 0x10, 0x29, 0x94, 0x02, 0x00, 0xFB, 0x02, 0x02, 0x71, 
+            0x05, 0x0B, 0x2D, 0x00, 0x00, 0x02, 0x00, 0x07, 0x78, 0x00, 0xA3, 0x20, 
+            0x20, 0x7B, 0x7D, 0x3A, 0x20, 0x7B, 0x7D, 0x5C, 0x6E, 0xD6, 0x09, 0x02, 
+            0x44, 0x00, 0x04, 0x29, 0x14, 0x03, 0x66, 0x01, 0x04, 0x02, 0x00, 0x06, 
+            0x86, 0x01, 0x0F, 0xAE, 0x02, 0x02, 0x08, 0x58, 0x00, 0x6A, 0x5B, 0x6E, 
+            0x6F, 0x6E, 0x65, 0x5D, 0xD1, 0x00, 0x03, 0xAD, 0x01, 0x00, 0x02, 0x00, 
+            0x07, 0x2B, 0x00, 0x22, 0x5C, 0x6E, 0xEE, 0x22, 0x0F, 0xFF, 0x00, 0x05, 
+            0x02, 0x0C, 0x05, 0x00, 0x04, 0x06, 0x0F, 0x01, 0x01, 0x10, 0x02, 0x2D, 
+            0x00, 0x06, 0x03, 0x01, 0x02, 0x10, 0x00, 0x0F, 0x05, 0x01, 0x12, 0x4A, 
+            0x28, 0x7B, 0x7D, 0x29, 0x0A, 0x01, 0x72, 0x24, 0x64, 0x65, 0x62, 0x75, 
+            0x67, 0x28, 0x44, 0x00, 0x04, 0xE0, 0x1C, 0x14, 0x29, 0x65, 0x00, 0x11, 
+            0x3A, 0x89, 0x0B, 0x1F, 0x73, 0x25, 0x01, 0x55, 0x13, 0x41, 0x75, 0x0D, 
+            0x0F, 0x27, 0x01, 0x05, 0x01, 0x2B, 0x0D, 0x0F, 0x24, 0x01, 0x0B, 0x00, 
+            0xDF, 0x14, 0x04, 0x1C, 0x02, 0x00, 0x2F, 0x00, 0x0F, 0x16, 0x01, 0x0F, 
+            0x01, 0x17, 0x02, 0x0F, 0x4B, 0x04, 0x0A, 0x0F, 0xDD, 0x13, 0x01, 0x07, 
+            0xDD, 0x01, 0x1F, 0x20, 0x09, 0x02, 0x1A, 0x12, 0x43, 0x7D, 0x25, 0x0F, 
+            0x08, 0x03, 0x04, 0x03, 0xDF, 0x0E, 0x02, 0xF8, 0x11, 0x0A, 0x28, 0x05, 
+            0x09, 0x72, 0x00, 0x03, 0xB7, 0x00, 0x01, 0x03, 0x03, 0x08, 0x34, 0x00, 
+            0x07, 0xCD, 0x02, 0x0F, 0xBF, 0x02, 0x0E, 0x0F, 0xB7, 0x00, 0x0D, 0x03, 
+            0x50, 0x23, 0x00, 0x78, 0x00, 0x31, 0x74, 0x6F, 0x5F, 0xF4, 0x03, 0x09, 
+            0x2F, 0x04, 0x50, 0x20, 0x7D, 0x0A, 0x7D, 0x0A, 
+        },
+        4040,
+        11290,
+    },
+    {
+        "std/json.pyro",
+        (const uint8_t[]){
+            0x3D, 0x23, 0x20, 0x2D, 0x01, 0x00, 0xF1, 0x08, 0x20, 0x23, 0x0A, 0x23, 
+            0x20, 0x20, 0x4D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x6C, 0x20, 0x74, 
+            0x6F, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x20, 0x17, 0x00, 0x0D, 0x2D, 0x00, 
+            0xB3, 0x2D, 0x20, 0x23, 0x0A, 0x0A, 0x0A, 0x64, 0x65, 0x66, 0x20, 0x6D, 
+            0x31, 0x00, 0xF0, 0x0D, 0x5F, 0x6D, 0x61, 0x70, 0x28, 0x63, 0x6F, 0x6E, 
+            0x74, 0x61, 0x69, 0x6E, 0x65, 0x72, 0x73, 0x3A, 0x20, 0x73, 0x74, 0x61, 
+            0x63, 0x6B, 0x2C, 0x20, 0x62, 0x75, 0x66, 0x3A, 0x05, 0x00, 0x60, 0x2C, 
+            0x20, 0x6D, 0x61, 0x70, 0x3A, 0x05, 0x00, 0xF7, 0x08, 0x2C, 0x20, 0x69, 
+            0x6E, 0x64, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x69, 0x36, 0x34, 0x2C, 0x20, 
+            0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x5F, 0x15, 0x00, 0x90, 0x29, 
+            0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x5F, 0x00, 0xE3, 0x70, 
+            0x3A, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x28, 0x29, 0x20, 0x3D, 0x3D, 0x20, 
+            0x30, 0x1A, 0x00, 0x00, 0x02, 0x00, 0x00, 0x5A, 0x00, 0xC1, 0x77, 0x72, 
+            0x69, 0x74, 0x65, 0x28, 0x22, 0x7B, 0x7D, 0x22, 0x29, 0x3B, 0x33, 0x00, 
+            0x00, 0x02, 0x00, 0x62, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x10, 0x00, 
+            0x21, 0x7D, 0x0A, 0x17, 0x00, 0xFA, 0x05, 0x76, 0x61, 0x72, 0x20, 0x73, 
+            0x70, 0x61, 0x63, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x22, 0x20, 0x22, 0x20, 
+            0x2A, 0x20, 0x28, 0x79, 0x00, 0x23, 0x20, 0x2B, 0x97, 0x00, 0x03, 0x49, 
+            0x00, 0x00, 0x32, 0x00, 0xF2, 0x00, 0x69, 0x73, 0x5F, 0x66, 0x69, 0x72, 
+            0x73, 0x74, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x52, 0x00, 0x08, 
+            0x77, 0x00, 0x00, 0x76, 0x00, 0x01, 0x60, 0x00, 0xF0, 0x04, 0x66, 0x6F, 
+            0x72, 0x20, 0x28, 0x6B, 0x65, 0x79, 0x2C, 0x20, 0x76, 0x61, 0x6C, 0x75, 
+            0x65, 0x29, 0x20, 0x69, 0x6E, 0xEB, 0x00, 0x07, 0xAE, 0x00, 0x23, 0x69, 
+            0x66, 0x60, 0x00, 0x29, 0x20, 0x3E, 0xC6, 0x00, 0x00, 0x02, 0x00, 0x06, 
+            0x53, 0x00, 0x05, 0x72, 0x00, 0xF0, 0x00, 0x3A, 0x3F, 0x20, 0x22, 0x5C, 
+            0x6E, 0x22, 0x20, 0x3A, 0x7C, 0x20, 0x22, 0x2C, 0x5C, 0x6E, 0x69, 0x00, 
+            0x00, 0x2A, 0x00, 0x00, 0x02, 0x00, 0x60, 0x7D, 0x20, 0x65, 0x6C, 0x73, 
+            0x65, 0x1D, 0x01, 0x15, 0x21, 0x2F, 0x00, 0x02, 0x30, 0x01, 0x04, 0x02, 
+            0x00, 0x06, 0x50, 0x00, 0x39, 0x22, 0x2C, 0x20, 0x3B, 0x00, 0x01, 0xAD, 
+            0x00, 0x00, 0x02, 0x00, 0x06, 0x23, 0x00, 0x02, 0x17, 0x01, 0x04, 0xC9, 
+            0x00, 0x00, 0x02, 0x00, 0xB0, 0x69, 0x66, 0x20, 0x21, 0x24, 0x69, 0x73, 
+            0x5F, 0x73, 0x74, 0x72, 0xD4, 0x00, 0x04, 0x8E, 0x01, 0x04, 0x02, 0x00, 
+            0x75, 0x24, 0x70, 0x61, 0x6E, 0x69, 0x63, 0x28, 0x4B, 0x00, 0x04, 0x02, 
+            0x00, 0xF3, 0x05, 0x22, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 
+            0x6B, 0x65, 0x79, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x7B, 0x7D, 0x08, 
+            0x01, 0xFD, 0x06, 0x2C, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 
+            0x64, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x2C, 
+            0x41, 0x00, 0x10, 0x24, 0x35, 0x00, 0x01, 0x72, 0x00, 0x0A, 0x1C, 0x00, 
+            0x03, 0x92, 0x01, 0x00, 0x02, 0x00, 0x03, 0xCF, 0x01, 0x00, 0x02, 0x00, 
+            0x06, 0xC2, 0x00, 0x61, 0x24, 0x64, 0x65, 0x62, 0x75, 0x67, 0x39, 0x00, 
+            0x07, 0x2B, 0x00, 0x06, 0x20, 0x00, 0x29, 0x22, 0x3A, 0x05, 0x01, 0x05, 
+            0xB2, 0x02, 0x01, 0xAB, 0x01, 0x07, 0xB4, 0x02, 0x01, 0xAD, 0x02, 0x03, 
+            0xC2, 0x01, 0x04, 0xA5, 0x02, 0x0C, 0xA0, 0x02, 0x0C, 0x27, 0x02, 0x00, 
+            0x02, 0x00, 0x05, 0x86, 0x01, 0x63, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 
+            0x28, 0x02, 0x03, 0xAB, 0x00, 0x0F, 0xF8, 0x01, 0x05, 0x07, 0x9F, 0x00, 
+            0x0A, 0xDF, 0x01, 0x07, 0x19, 0x00, 0x01, 0xA8, 0x02, 0x0A, 0xA7, 0x02, 
+            0x03, 0xE1, 0x00, 0x11, 0x7D, 0x3D, 0x01, 0x07, 0x2B, 0x00, 0x01, 0x01, 
+            0x03, 0x1C, 0x7D, 0x94, 0x03, 0x37, 0x76, 0x65, 0x63, 0xE0, 0x00, 0x0F, 
+            0x94, 0x03, 0x00, 0xC4, 0x76, 0x65, 0x63, 0x3A, 0x20, 0x76, 0x65, 0x63, 
+            0x7C, 0x74, 0x75, 0x70, 0xF3, 0x00, 0x0F, 0x98, 0x03, 0x12, 0x00, 0x39, 
+            0x00, 0x0F, 0x98, 0x03, 0x0F, 0x28, 0x5B, 0x5D, 0x7E, 0x02, 0x0F, 0x98, 
+            0x03, 0x56, 0x10, 0x5B, 0x76, 0x00, 0x01, 0x22, 0x01, 0x00, 0x98, 0x03, 
+            0x01, 0xE7, 0x01, 0x00, 0x89, 0x02, 0x3F, 0x76, 0x65, 0x63, 0x91, 0x03, 
+            0x9A, 0x00, 0x5C, 0x02, 0x00, 0x02, 0x00, 0x0F, 0xB1, 0x02, 0xC2, 0x01, 
+            0x1A, 0x02, 0x0D, 0xB1, 0x02, 0xF0, 0x06, 0x69, 0x6E, 0x73, 0x74, 0x61, 
+            0x6E, 0x63, 0x65, 0x5F, 0x77, 0x69, 0x74, 0x68, 0x5F, 0x6D, 0x65, 0x74, 
+            0x68, 0x6F, 0x64, 0x28, 0xE7, 0x02, 0x02, 0x43, 0x06, 0x54, 0x6F, 0x62, 
+            0x6A, 0x3A, 0x20, 0x24, 0x00, 0x0F, 0xB0, 0x02, 0x17, 0x00, 0xCC, 0x05, 
+            0x02, 0x4C, 0x00, 0x42, 0x20, 0x3D, 0x20, 0x24, 0x0A, 0x00, 0xB5, 0x28, 
+            0x6F, 0x62, 0x6A, 0x2C, 0x20, 0x22, 0x24, 0x6A, 0x73, 0x6F, 0x5E, 0x05, 
+            0x00, 0x28, 0x00, 0x00, 0x10, 0x00, 0x33, 0x20, 0x3D, 0x20, 0x25, 0x00, 
+            0x04, 0x17, 0x05, 0x08, 0x13, 0x05, 0x00, 0x22, 0x00, 0x08, 0x14, 0x05, 
+            0x0F, 0x10, 0x05, 0x01, 0x12, 0x22, 0x40, 0x00, 0x11, 0x20, 0x5F, 0x00, 
+            0xF0, 0x01, 0x28, 0x29, 0x20, 0x6F, 0x6E, 0x20, 0x6F, 0x62, 0x6A, 0x65, 
+            0x63, 0x74, 0x20, 0x6F, 0x66, 0x20, 0xE7, 0x04, 0x00, 0x1C, 0x05, 0x02, 
+            0x10, 0x03, 0x34, 0x65, 0x64, 0x20, 0x39, 0x05, 0x03, 0x19, 0x00, 0x0F, 
+            0x2E, 0x05, 0x0F, 0x02, 0x2A, 0x05, 0x3B, 0x6F, 0x62, 0x6A, 0x2A, 0x05, 
+            0x02, 0x18, 0x00, 0x01, 0xA1, 0x00, 0x06, 0x19, 0x00, 0x05, 0x33, 0x04, 
+            0x01, 0x12, 0x03, 0x06, 0x90, 0x04, 0x0F, 0x4F, 0x07, 0x06, 0x01, 0x40, 
+            0x00, 0x06, 0x7F, 0x02, 0x02, 0xA7, 0x00, 0x02, 0x10, 0x00, 0x03, 0x45, 
+            0x00, 0x00, 0x29, 0x01, 0x02, 0x57, 0x03, 0x00, 0x1A, 0x07, 0x70, 0x79, 
+            0x20, 0x66, 0x72, 0x6F, 0x6D, 0x5F, 0x37, 0x00, 0x10, 0x28, 0x05, 0x00, 
+            0x03, 0x71, 0x00, 0x30, 0x69, 0x66, 0x20, 0x46, 0x06, 0x41, 0x65, 0x72, 
+            0x72, 0x28, 0x2C, 0x00, 0x0F, 0x34, 0x01, 0x43, 0x00, 0xA5, 0x08, 0x0B, 
+            0x4C, 0x06, 0x02, 0x06, 0x01, 0x0A, 0x1E, 0x01, 0x03, 0x94, 0x00, 0x03, 
+            0xC0, 0x00, 0x71, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x5F, 0x97, 0x00, 
+            0x00, 0x5F, 0x02, 0x0F, 0xF5, 0x05, 0x0C, 0x0F, 0xAA, 0x02, 0x09, 0x07, 
+            0x40, 0x06, 0x0F, 0x60, 0x05, 0x00, 0x0F, 0xB1, 0x02, 0x24, 0x00, 0x3B, 
+            0x01, 0x60, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0xA7, 0x02, 0x1F, 0x29, 
+            0x02, 0x09, 0x95, 0x01, 0xB3, 0x00, 0x41, 0x5F, 0x6E, 0x61, 0x6D, 0x6F, 
+            0x05, 0x11, 0x24, 0x0F, 0x00, 0x02, 0xC2, 0x00, 0x0F, 0x78, 0x05, 0x9A, 
+            0x01, 0x28, 0x03, 0x00, 0x02, 0x00, 0x00, 0xE7, 0x02, 0x01, 0xC5, 0x00, 
+            0x02, 0x2A, 0x02, 0x00, 0x3D, 0x04, 0x01, 0x0F, 0x00, 0x00, 0x95, 0x01, 
+            0x21, 0x2C, 0x20, 0x0B, 0x00, 0x01, 0xEE, 0x00, 0x03, 0x5D, 0x02, 0x00, 
+            0x02, 0x00, 0x00, 0xAC, 0x04, 0x02, 0x95, 0x0A, 0x10, 0x60, 0x96, 0x0A, 
+            0x3F, 0x3A, 0x20, 0x60, 0x29, 0x00, 0x04, 0x0F, 0xD5, 0x05, 0x0D, 0x02, 
+            0x5E, 0x00, 0x01, 0xA2, 0x02, 0x04, 0xE9, 0x04, 0x0F, 0x8C, 0x08, 0xAC, 
+            0x00, 0x19, 0x0B, 0x0F, 0x2E, 0x03, 0x0B, 0x01, 0xEE, 0x00, 0x54, 0x3A, 
+            0x20, 0x61, 0x6E, 0x79, 0xF3, 0x00, 0x0F, 0x8C, 0x08, 0x12, 0x00, 0x66, 
+            0x04, 0x00, 0xAC, 0x0A, 0x01, 0x3F, 0x00, 0x08, 0x66, 0x04, 0x06, 0x8D, 
+            0x01, 0x03, 0x23, 0x0A, 0x02, 0x22, 0x00, 0x03, 0xAF, 0x01, 0x06, 0x48, 
+            0x0B, 0x00, 0x41, 0x00, 0x3E, 0x69, 0x36, 0x34, 0xA7, 0x04, 0x0F, 0x41, 
+            0x00, 0x19, 0x1F, 0x66, 0x41, 0x00, 0x2D, 0x4F, 0x62, 0x6F, 0x6F, 0x6C, 
+            0x83, 0x00, 0x2B, 0x3F, 0x6E, 0x75, 0x6C, 0x42, 0x00, 0x2C, 0x00, 0xC5, 
+            0x0D, 0x02, 0x25, 0x01, 0x0A, 0xB2, 0x03, 0x07, 0xE5, 0x04, 0x03, 0x0B, 
+            0x00, 0x1E, 0x73, 0xAB, 0x00, 0x00, 0x02, 0x00, 0x03, 0x0D, 0x07, 0xA1, 
+            0x22, 0x63, 0x79, 0x63, 0x6C, 0x65, 0x20, 0x64, 0x65, 0x74, 0xF6, 0x0B, 
+            0x01, 0xF8, 0x0D, 0x14, 0x20, 0x3A, 0x00, 0x70, 0x20, 0x69, 0x74, 0x73, 
+            0x65, 0x6C, 0x66, 0xA5, 0x09, 0x00, 0x33, 0x00, 0x00, 0x02, 0x00, 0x02, 
+            0xD0, 0x0A, 0x00, 0x02, 0x00, 0x03, 0x25, 0x00, 0x00, 0x43, 0x0E, 0x43, 
+            0x70, 0x75, 0x73, 0x68, 0x66, 0x00, 0x06, 0x2A, 0x00, 0x05, 0x38, 0x03, 
+            0x00, 0xAB, 0x00, 0x06, 0x2D, 0x00, 0x0F, 0xBC, 0x0B, 0x11, 0x03, 0xF8, 
+            0x01, 0x00, 0x02, 0x00, 0x06, 0x39, 0x00, 0x53, 0x3A, 0x70, 0x6F, 0x70, 
+            0x28, 0x1A, 0x00, 0x0A, 0x12, 0x02, 0x00, 0x3D, 0x0B, 0x0F, 0x0C, 0x01, 
+            0x42, 0x6F, 0x76, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x0F, 0x01, 0x3C, 0x00, 
+            0xAE, 0x00, 0x06, 0xD6, 0x00, 0x0F, 0x0F, 0x01, 0x40, 0x2F, 0x74, 0x75, 
+            0x1B, 0x02, 0x44, 0x5F, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x0E, 0x01, 0x9A, 
+            0x34, 0x68, 0x61, 0x73, 0x9C, 0x0A, 0x01, 0x21, 0x02, 0x06, 0x48, 0x0A, 
+            0x07, 0x36, 0x03, 0x05, 0xA9, 0x02, 0x04, 0xB0, 0x0A, 0x0C, 0xD4, 0x0A, 
+            0x03, 0xF0, 0x04, 0x04, 0xEB, 0x04, 0x0C, 0xDE, 0x05, 0x0F, 0x94, 0x02, 
+            0x02, 0x04, 0x4C, 0x00, 0x03, 0x17, 0x03, 0x07, 0x6F, 0x00, 0x0F, 0xA5, 
+            0x03, 0x31, 0x03, 0xA3, 0x0A, 0x03, 0x47, 0x02, 0x0F, 0xA8, 0x03, 0x34, 
+            0x05, 0xB3, 0x00, 0x03, 0x57, 0x00, 0x0F, 0x9E, 0x02, 0x3C, 0x15, 0x7B, 
+            0xAE, 0x07, 0x04, 0x7B, 0x04, 0x04, 0x4E, 0x0B, 0x61, 0x69, 0x6E, 0x70, 
+            0x75, 0x74, 0x3A, 0x55, 0x0B, 0x11, 0x3A, 0x56, 0x0B, 0x01, 0xAC, 0x01, 
+            0x00, 0x0B, 0x00, 0x23, 0x22, 0x2C, 0x24, 0x0A, 0x01, 0x12, 0x00, 0x3F, 
+            0x29, 0x2C, 0x20, 0x1F, 0x06, 0x02, 0x01, 0x9E, 0x0C, 0x40, 0x70, 0x75, 
+            0x62, 0x20, 0xE7, 0x12, 0x22, 0x74, 0x6F, 0xE0, 0x0A, 0x3E, 0x61, 0x72, 
+            0x67, 0xA1, 0x06, 0x80, 0x20, 0x3D, 0x20, 0x30, 0x29, 0x20, 0x2D, 0x3E, 
+            0xDB, 0x10, 0x03, 0x93, 0x01, 0x00, 0x3B, 0x08, 0x06, 0xF1, 0x00, 0x00, 
+            0x3A, 0x08, 0x01, 0x10, 0x13, 0x04, 0x6A, 0x04, 0x00, 0x1F, 0x00, 0x30, 
+            0x62, 0x75, 0x66, 0x18, 0x00, 0x30, 0x62, 0x75, 0x66, 0x16, 0x00, 0x01, 
+            0xC7, 0x00, 0x00, 0x17, 0x00, 0x50, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x4C, 
+            0x10, 0x00, 0x59, 0x0B, 0x05, 0x45, 0x02, 0x01, 0xAA, 0x00, 0x07, 0x3E, 
+            0x07, 0x03, 0xE1, 0x03, 0x36, 0x61, 0x72, 0x67, 0x40, 0x02, 0x13, 0x30, 
+            0x33, 0x02, 0x00, 0x3E, 0x0A, 0x03, 0x79, 0x0B, 0x02, 0x4D, 0x00, 0x08, 
+            0x14, 0x07, 0x04, 0x26, 0x01, 0x04, 0xD1, 0x00, 0x13, 0x29, 0x11, 0x01, 
+            0x03, 0x2A, 0x00, 0x02, 0x69, 0x05, 0x03, 0x27, 0x0B, 0x02, 0xFA, 0x0B, 
+            0x00, 0x7B, 0x0D, 0x31, 0x3A, 0x74, 0x6F, 0x0F, 0x12, 0x03, 0x0A, 0x0B, 
+            0x0F, 0x12, 0x14, 0x01, 0x00, 0x02, 0x00, 0x01, 0x2D, 0x14, 0x34, 0x20, 
+            0x55, 0x6E, 0xB7, 0x00, 0x01, 0x19, 0x0C, 0x0F, 0x48, 0x14, 0x0A, 0x00, 
+            0x02, 0x00, 0x01, 0x4C, 0x14, 0xA0, 0x23, 0x20, 0x54, 0x6F, 0x6B, 0x65, 
+            0x6E, 0x3A, 0x20, 0x24, 0x69, 0x04, 0x10, 0x74, 0x0C, 0x00, 0x10, 0x5F, 
+            0xBB, 0x01, 0x10, 0x2C, 0x49, 0x14, 0x12, 0x72, 0x1F, 0x14, 0xC0, 0x78, 
+            0x2C, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x2E, 0x0A, 0x1C, 
+            0x00, 0x00, 0x99, 0x01, 0x01, 0x36, 0x00, 0x92, 0x20, 0x74, 0x75, 0x70, 
+            0x5B, 0x73, 0x74, 0x72, 0x2C, 0x53, 0x14, 0x51, 0x69, 0x36, 0x34, 0x5D, 
+            0x3B, 0x54, 0x00, 0x00, 0x1E, 0x0C, 0x61, 0x20, 0x77, 0x68, 0x69, 0x74, 
+            0x65, 0xFE, 0x13, 0xF0, 0x02, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 
+            0x74, 0x65, 0x72, 0x73, 0x2E, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0xAF, 0x0C, 
+            0x17, 0x5F, 0x20, 0x00, 0x13, 0x3D, 0xBF, 0x01, 0xD0, 0x30, 0x78, 0x30, 
+            0x39, 0x2C, 0x20, 0x23, 0x20, 0x68, 0x6F, 0x72, 0x69, 0x7A, 0xD5, 0x14, 
+            0x51, 0x6C, 0x20, 0x74, 0x61, 0x62, 0xA4, 0x01, 0x40, 0x30, 0x78, 0x30, 
+            0x41, 0x1B, 0x00, 0x94, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x66, 0x65, 0x65, 
+            0x64, 0x16, 0x00, 0x10, 0x44, 0x16, 0x00, 0x83, 0x63, 0x61, 0x72, 0x72, 
+            0x69, 0x61, 0x67, 0x65, 0x85, 0x14, 0x03, 0x1C, 0x00, 0x20, 0x32, 0x30, 
+            0x1C, 0x00, 0x01, 0x83, 0x00, 0x20, 0x0A, 0x7D, 0x9A, 0x00, 0xB3, 0x63, 
+            0x6C, 0x61, 0x73, 0x73, 0x20, 0x4C, 0x65, 0x78, 0x65, 0x72, 0x72, 0x00, 
+            0x00, 0xFB, 0x01, 0x03, 0xB2, 0x02, 0x81, 0x73, 0x74, 0x72, 0x7C, 0x62, 
+            0x75, 0x66, 0x3B, 0x3D, 0x00, 0x00, 0x18, 0x00, 0x01, 0x69, 0x11, 0x01, 
+            0x0B, 0x09, 0x06, 0x14, 0x00, 0x00, 0x2F, 0x15, 0x1B, 0x78, 0x14, 0x00, 
+            0x00, 0x5A, 0x13, 0x83, 0x63, 0x74, 0x3A, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 
+            0x52, 0x02, 0x00, 0x23, 0x01, 0x6A, 0x24, 0x69, 0x6E, 0x69, 0x74, 0x28, 
+            0x5D, 0x00, 0x00, 0x57, 0x01, 0x06, 0x2D, 0x00, 0x08, 0x21, 0x02, 0x00, 
+            0x9B, 0x07, 0x11, 0x2E, 0x2D, 0x00, 0x31, 0x20, 0x3D, 0x20, 0x08, 0x00, 
+            0x02, 0x75, 0x00, 0x00, 0x02, 0x00, 0x01, 0x1C, 0x00, 0x01, 0x8E, 0x00, 
+            0x04, 0x1C, 0x00, 0x04, 0x9B, 0x0C, 0x0B, 0x24, 0x00, 0x01, 0x9E, 0x00, 
+            0x00, 0x17, 0x03, 0x0B, 0x18, 0x00, 0x02, 0x75, 0x00, 0x20, 0x20, 0x3D, 
+            0x2A, 0x03, 0x32, 0x69, 0x63, 0x74, 0x1E, 0x00, 0x03, 0x6E, 0x02, 0x04, 
+            0x6B, 0x03, 0x30, 0x6E, 0x65, 0x78, 0xEE, 0x15, 0x22, 0x2D, 0x3E, 0x12, 
+            0x02, 0x03, 0x20, 0x01, 0x00, 0x02, 0x00, 0x52, 0x77, 0x68, 0x69, 0x6C, 
+            0x65, 0x85, 0x00, 0x02, 0x61, 0x00, 0x12, 0x3C, 0x0D, 0x00, 0x02, 0x92, 
+            0x00, 0x22, 0x26, 0x26, 0x0E, 0x00, 0x01, 0xB4, 0x00, 0x66, 0x3A, 0x62, 
+            0x79, 0x74, 0x65, 0x28, 0x2B, 0x00, 0x01, 0x92, 0x15, 0x0C, 0xEE, 0x01, 
+            0x06, 0x3C, 0x04, 0x00, 0x02, 0x00, 0x06, 0x2D, 0x00, 0x52, 0x20, 0x2B, 
+            0x3D, 0x20, 0x31, 0x9C, 0x00, 0x00, 0x02, 0x00, 0x03, 0xA0, 0x00, 0x00, 
+            0x02, 0x00, 0x24, 0x69, 0x66, 0x64, 0x00, 0x0F, 0x7F, 0x00, 0x0C, 0xB7, 
+            0x6D, 0x61, 0x74, 0x63, 0x68, 0x28, 0x22, 0x2F, 0x2F, 0x22, 0x2C, 0x32, 
+            0x00, 0x08, 0x68, 0x01, 0x00, 0x02, 0x00, 0x04, 0x4F, 0x00, 0x03, 0x17, 
+            0x01, 0x0A, 0x90, 0x00, 0x00, 0x02, 0x00, 0x04, 0xAE, 0x03, 0x04, 0xD4, 
+            0x04, 0x42, 0x63, 0x6F, 0x6D, 0x6D, 0x2C, 0x06, 0x02, 0x09, 0x00, 0xF1, 
+            0x00, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 
+            0x6C, 0x6C, 0x6F, 0x77, 0x4C, 0x10, 0x03, 0x5C, 0x01, 0x63, 0x20, 0x6D, 
+            0x6F, 0x64, 0x65, 0x22, 0x13, 0x04, 0x04, 0x02, 0x00, 0x07, 0xCB, 0x00, 
+            0x00, 0x02, 0x00, 0x0F, 0x51, 0x01, 0x0B, 0x0E, 0x8F, 0x00, 0x0F, 0x23, 
+            0x01, 0x06, 0x04, 0x02, 0x00, 0x04, 0xD1, 0x00, 0x0F, 0x84, 0x01, 0x02, 
+            0x41, 0x20, 0x2D, 0x20, 0x31, 0xC6, 0x17, 0x47, 0x27, 0x5C, 0x6E, 0x27, 
+            0xD7, 0x01, 0x08, 0x02, 0x00, 0x56, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x7B, 
+            0x01, 0x04, 0x02, 0x00, 0x06, 0x20, 0x0A, 0x00, 0x02, 0x00, 0x0F, 0xC6, 
+            0x00, 0x1A, 0x0F, 0x17, 0x02, 0x2D, 0x00, 0x02, 0x00, 0x0F, 0xF8, 0x00, 
+            0x0A, 0x06, 0x9C, 0x00, 0x07, 0x98, 0x00, 0x06, 0x09, 0x01, 0x62, 0x64, 
+            0x65, 0x78, 0x20, 0x3E, 0x3D, 0x05, 0x02, 0x02, 0xA9, 0x02, 0x0A, 0x58, 
+            0x01, 0x02, 0x29, 0x04, 0x69, 0x20, 0x28, 0x22, 0x45, 0x4F, 0x46, 0x2D, 
+            0x02, 0x06, 0xD1, 0x05, 0x00, 0x02, 0x00, 0x0F, 0x5C, 0x00, 0x02, 0x07, 
+            0x6A, 0x02, 0x00, 0xFC, 0x0B, 0x09, 0x3F, 0x00, 0x0C, 0x6C, 0x02, 0x00, 
+            0x49, 0x04, 0x01, 0x57, 0x05, 0x99, 0x20, 0x3D, 0x20, 0x28, 0x22, 0x4E, 
+            0x55, 0x4C, 0x4C, 0x2F, 0x00, 0x3B, 0x2C, 0x20, 0x34, 0x2C, 0x02, 0x0A, 
+            0xF5, 0x00, 0x1A, 0x34, 0x95, 0x01, 0x03, 0xB6, 0x00, 0x01, 0x51, 0x00, 
+            0x06, 0x1A, 0x00, 0x0F, 0xA5, 0x00, 0x0D, 0x00, 0x46, 0x19, 0x09, 0x76, 
+            0x00, 0x0F, 0xA5, 0x00, 0x0B, 0x49, 0x54, 0x52, 0x55, 0x45, 0x2F, 0x00, 
+            0x0F, 0xA5, 0x00, 0x52, 0x01, 0xC4, 0x17, 0x09, 0x77, 0x00, 0x0F, 0xA6, 
+            0x00, 0x0B, 0x4C, 0x46, 0x41, 0x4C, 0x53, 0xA7, 0x00, 0x1F, 0x35, 0x4C, 
+            0x01, 0x0A, 0x16, 0x35, 0x32, 0x01, 0x00, 0x02, 0x00, 0x0F, 0x4C, 0x01, 
+            0x1C, 0x0D, 0xDA, 0x04, 0x5C, 0x3D, 0x3D, 0x20, 0x27, 0x5B, 0x51, 0x03, 
+            0x0A, 0xEF, 0x01, 0xC9, 0x4C, 0x45, 0x46, 0x54, 0x5F, 0x42, 0x52, 0x41, 
+            0x43, 0x4B, 0x45, 0x54, 0xDB, 0x00, 0x3F, 0x2C, 0x20, 0x31, 0xAB, 0x00, 
+            0x0A, 0x07, 0x07, 0x05, 0x00, 0x02, 0x00, 0x0F, 0xAB, 0x00, 0x31, 0x1F, 
+            0x5D, 0xAB, 0x00, 0x0B, 0x4F, 0x52, 0x49, 0x47, 0x48, 0xAC, 0x00, 0x76, 
+            0x1F, 0x7B, 0xAC, 0x00, 0x0B, 0x05, 0x57, 0x01, 0x0C, 0x00, 0x02, 0x0F, 
+            0x55, 0x01, 0x5E, 0x1F, 0x7D, 0xA9, 0x00, 0x0B, 0x06, 0x55, 0x01, 0x0F, 
+            0xAA, 0x00, 0x6E, 0x1F, 0x2D, 0xAA, 0x00, 0x0B, 0x5F, 0x4D, 0x49, 0x4E, 
+            0x55, 0x53, 0xA3, 0x02, 0x6D, 0x1F, 0x2C, 0xA4, 0x00, 0x0B, 0x5F, 0x43, 
+            0x4F, 0x4D, 0x4D, 0x41, 0xA4, 0x00, 0x6D, 0x1F, 0x3A, 0xA4, 0x00, 0x0D, 
+            0x10, 0x4C, 0x19, 0x17, 0x02, 0x78, 0x06, 0x01, 0x86, 0x06, 0x0F, 0x96, 
+            0x02, 0x60, 0x1C, 0x22, 0xA4, 0x00, 0x03, 0x40, 0x04, 0x00, 0x5B, 0x06, 
+            0x50, 0x3A, 0x72, 0x65, 0x61, 0x64, 0x55, 0x0C, 0x38, 0x69, 0x6E, 0x67, 
+            0x40, 0x0A, 0x0F, 0x44, 0x06, 0x06, 0x0D, 0xF8, 0x04, 0x6F, 0x3E, 0x3D, 
+            0x20, 0x27, 0x30, 0x27, 0xE1, 0x07, 0x0D, 0x5F, 0x3C, 0x3D, 0x20, 0x27, 
+            0x39, 0x88, 0x00, 0x0E, 0x51, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0xE0, 0x0C, 
+            0x00, 0xE7, 0x04, 0x00, 0x02, 0x00, 0x07, 0x88, 0x00, 0x00, 0x4C, 0x05, 
+            0x00, 0x96, 0x0A, 0x10, 0x5F, 0x83, 0x00, 0x13, 0x20, 0xCC, 0x07, 0x02, 
+            0x7E, 0x07, 0x00, 0x12, 0x00, 0x08, 0x67, 0x0A, 0x03, 0x77, 0x0B, 0x00, 
+            0x02, 0x00, 0x00, 0x36, 0x00, 0x00, 0x1F, 0x00, 0x50, 0x5F, 0x72, 0x65, 
+            0x70, 0x72, 0x30, 0x0B, 0x02, 0xDB, 0x0A, 0x02, 0x45, 0x00, 0x50, 0x3E, 
+            0x3D, 0x20, 0x33, 0x32, 0xBB, 0x00, 0x06, 0x58, 0x00, 0x6B, 0x3C, 0x3D, 
+            0x20, 0x31, 0x32, 0x33, 0x18, 0x09, 0x10, 0x24, 0xD9, 0x14, 0x65, 0x24, 
+            0x72, 0x75, 0x6E, 0x65, 0x28, 0x2A, 0x00, 0x21, 0x29, 0x29, 0x1A, 0x0C, 
+            0x00, 0x02, 0x00, 0x03, 0xB2, 0x12, 0x0A, 0x52, 0x08, 0x65, 0x22, 0x5C, 
+            0x5C, 0x78, 0x24, 0x7B, 0x2F, 0x00, 0x66, 0x3B, 0x30, 0x32, 0x58, 0x7D, 
+            0x22, 0x33, 0x00, 0x07, 0xA3, 0x00, 0x04, 0x5F, 0x0A, 0x25, 0x75, 0x6E, 
+            0xA0, 0x1F, 0x05, 0x22, 0x0D, 0x00, 0xA2, 0x1A, 0x21, 0x61, 0x74, 0xC2, 
+            0x00, 0x01, 0xBA, 0x20, 0x13, 0x78, 0x29, 0x0E, 0x00, 0x11, 0x00, 0x01, 
+            0xD3, 0x00, 0x09, 0xD9, 0x0A, 0x02, 0x38, 0x01, 0x03, 0x34, 0x01, 0x00, 
+            0x75, 0x0C, 0x09, 0xDE, 0x01, 0x00, 0x1C, 0x0F, 0x02, 0xA9, 0x0D, 0x06, 
+            0xAA, 0x00, 0x00, 0x04, 0x02, 0x02, 0x99, 0x02, 0x0B, 0x6F, 0x0B, 0x00, 
+            0x38, 0x01, 0x07, 0xF4, 0x0D, 0x06, 0x70, 0x01, 0x37, 0x64, 0x65, 0x78, 
+            0xBC, 0x00, 0x0F, 0xBC, 0x0A, 0x19, 0x00, 0x53, 0x00, 0x00, 0x10, 0x01, 
+            0x06, 0x4C, 0x00, 0x00, 0x3A, 0x09, 0x00, 0xCA, 0x00, 0x0F, 0xBC, 0x01, 
+            0x04, 0x00, 0x02, 0x00, 0x03, 0xB0, 0x01, 0x01, 0x5F, 0x07, 0x2C, 0x5C, 
+            0x5C, 0x42, 0x02, 0x00, 0x02, 0x00, 0x0A, 0xC3, 0x00, 0x12, 0x32, 0x04, 
+            0x01, 0x04, 0x02, 0x00, 0x03, 0x9B, 0x01, 0x08, 0x46, 0x00, 0x1F, 0x22, 
+            0x45, 0x00, 0x01, 0x0F, 0xF2, 0x0A, 0x00, 0x03, 0x3B, 0x00, 0x06, 0x2C, 
+            0x01, 0x04, 0x02, 0x00, 0x0A, 0x71, 0x00, 0x0B, 0x9C, 0x07, 0x0F, 0x88, 
+            0x0A, 0x2C, 0x06, 0x0C, 0x02, 0x70, 0x74, 0x65, 0x72, 0x6D, 0x69, 0x6E, 
+            0x61, 0xAE, 0x21, 0x00, 0x99, 0x0C, 0x80, 0x6E, 0x67, 0x3A, 0x20, 0x6F, 
+            0x70, 0x65, 0x6E, 0xBD, 0x21, 0x0F, 0x10, 0x02, 0x00, 0x08, 0xAB, 0x01, 
+            0x00, 0xE1, 0x0B, 0x06, 0x06, 0x01, 0x03, 0x0E, 0x02, 0x00, 0x02, 0x00, 
+            0x00, 0x81, 0x01, 0x00, 0x6F, 0x01, 0x12, 0x5F, 0x02, 0x0B, 0x17, 0x3D, 
+            0x97, 0x04, 0x28, 0x20, 0x2D, 0xE2, 0x0F, 0x06, 0x3E, 0x00, 0x0D, 0xEC, 
+            0x00, 0x05, 0xC2, 0x02, 0x03, 0x45, 0x04, 0x01, 0x29, 0x10, 0x70, 0x22, 
+            0x53, 0x54, 0x52, 0x49, 0x4E, 0x47, 0xE9, 0x04, 0x06, 0x33, 0x02, 0x03, 
+            0xA5, 0x02, 0x01, 0x6C, 0x00, 0x03, 0xDE, 0x08, 0x03, 0x8C, 0x00, 0x05, 
+            0x9A, 0x02, 0x04, 0xF0, 0x03, 0x0F, 0x9A, 0x02, 0x01, 0x00, 0xAD, 0x00, 
+            0x08, 0xD6, 0x00, 0x08, 0xAE, 0x00, 0x0F, 0xA0, 0x00, 0x11, 0x0F, 0x9A, 
+            0x02, 0x56, 0x06, 0x01, 0x05, 0x01, 0xDD, 0x02, 0x0F, 0xEA, 0x04, 0x02, 
+            0x00, 0x02, 0x00, 0x0D, 0x4B, 0x01, 0x00, 0x15, 0x00, 0x08, 0x02, 0x00, 
+            0x00, 0xAA, 0x12, 0x33, 0x69, 0x6E, 0x75, 0xBA, 0x22, 0x04, 0x02, 0x00, 
+            0x03, 0x34, 0x01, 0x04, 0x02, 0x00, 0x08, 0xCA, 0x02, 0x52, 0x2E, 0x27, 
+            0x20, 0x7C, 0x7C, 0x76, 0x00, 0x00, 0x1F, 0x03, 0x1A, 0x65, 0x0F, 0x00, 
+            0x1A, 0x2B, 0x0F, 0x00, 0x0D, 0xF2, 0x07, 0x00, 0x02, 0x00, 0x0F, 0x94, 
+            0x00, 0x33, 0x0B, 0x3D, 0x03, 0x07, 0xB2, 0x00, 0x00, 0xC5, 0x01, 0x0F, 
+            0x72, 0x02, 0x1C, 0x09, 0x58, 0x02, 0x6F, 0x4E, 0x55, 0x4D, 0x42, 0x45, 
+            0x52, 0x58, 0x02, 0x10, 0x00, 0x26, 0x14, 0x02, 0xCF, 0x11, 0x40, 0x50, 
+            0x61, 0x72, 0x73, 0x38, 0x05, 0x01, 0xA9, 0x02, 0x00, 0x80, 0x00, 0x02, 
+            0x67, 0x04, 0x00, 0x90, 0x0F, 0x0A, 0xD0, 0x11, 0x02, 0xFD, 0x10, 0x04, 
+            0xA8, 0x11, 0x00, 0x0E, 0x01, 0x00, 0x2E, 0x00, 0x10, 0x6C, 0x0E, 0x12, 
+            0x12, 0x3A, 0x15, 0x12, 0x06, 0x16, 0x00, 0x00, 0x64, 0x01, 0x11, 0x5F, 
+            0x67, 0x0D, 0x12, 0x3A, 0x10, 0x11, 0x03, 0x09, 0x03, 0x00, 0xCA, 0x02, 
+            0x0F, 0xD9, 0x11, 0x3C, 0x02, 0x97, 0x00, 0x0B, 0x9D, 0x11, 0x00, 0x02, 
+            0x00, 0x01, 0xAC, 0x01, 0x01, 0x9F, 0x00, 0x22, 0x20, 0x3D, 0xA0, 0x00, 
+            0x02, 0x4E, 0x12, 0x00, 0xFD, 0x03, 0x00, 0x45, 0x12, 0x03, 0x64, 0x03, 
+            0x00, 0x02, 0x00, 0x01, 0x2B, 0x00, 0x06, 0xB4, 0x00, 0x00, 0x4D, 0x00, 
+            0x05, 0x3D, 0x00, 0x10, 0x3A, 0x18, 0x00, 0x04, 0xEB, 0x07, 0x03, 0xAB, 
+            0x01, 0x00, 0xC7, 0x00, 0x02, 0x17, 0x00, 0x0F, 0x8A, 0x03, 0x05, 0x05, 
+            0x10, 0x15, 0x0B, 0x5B, 0x00, 0x02, 0x23, 0x01, 0x00, 0x02, 0x00, 0x0B, 
+            0x19, 0x00, 0x0F, 0x74, 0x00, 0x07, 0x00, 0x02, 0x00, 0x03, 0xE5, 0x01, 
+            0x02, 0x56, 0x00, 0x02, 0x44, 0x00, 0x07, 0x8B, 0x00, 0x61, 0x63, 0x68, 
+            0x65, 0x63, 0x6B, 0x28, 0x6F, 0x01, 0x10, 0x5F, 0x62, 0x14, 0x01, 0x87, 
+            0x12, 0x00, 0x4F, 0x13, 0x03, 0xD6, 0x01, 0x00, 0x02, 0x00, 0x03, 0x42, 
+            0x00, 0x0B, 0x76, 0x00, 0x30, 0x5B, 0x30, 0x5D, 0x2A, 0x06, 0x06, 0x3B, 
+            0x00, 0x0D, 0x5C, 0x00, 0x02, 0x13, 0x12, 0x06, 0x21, 0x00, 0x0F, 0x5C, 
+            0x00, 0x01, 0x04, 0x37, 0x10, 0x00, 0x13, 0x01, 0x02, 0xF6, 0x01, 0x0D, 
+            0x58, 0x00, 0x07, 0x8A, 0x00, 0x00, 0x02, 0x00, 0x00, 0x87, 0x00, 0x09, 
+            0x59, 0x01, 0x04, 0x02, 0x00, 0x03, 0xA7, 0x00, 0x00, 0x73, 0x0F, 0x02, 
+            0x8B, 0x00, 0x00, 0x02, 0x00, 0x06, 0x24, 0x06, 0x03, 0x1F, 0x00, 0x01, 
+            0xED, 0x0E, 0x02, 0x20, 0x00, 0x03, 0x07, 0x01, 0x04, 0x87, 0x13, 0x10, 
+            0x70, 0xCE, 0x02, 0x02, 0x97, 0x01, 0x40, 0x6D, 0x61, 0x70, 0x7C, 0x25, 
+            0x26, 0x00, 0x99, 0x14, 0x80, 0x69, 0x36, 0x34, 0x7C, 0x66, 0x36, 0x34, 
+            0x7C, 0x15, 0x01, 0x10, 0x7C, 0x75, 0x10, 0x07, 0x90, 0x00, 0x00, 0xC6, 
+            0x02, 0x01, 0xA9, 0x16, 0x03, 0x83, 0x01, 0x11, 0x3A, 0x44, 0x00, 0x03, 
+            0xFA, 0x1D, 0x04, 0x4B, 0x23, 0x00, 0x02, 0x00, 0x00, 0x29, 0x00, 0x07, 
+            0x66, 0x01, 0x00, 0x48, 0x02, 0x0E, 0xE4, 0x15, 0x04, 0x45, 0x00, 0x00, 
+            0x0C, 0x01, 0x04, 0x36, 0x02, 0x00, 0x02, 0x00, 0x10, 0x69, 0x8E, 0x17, 
+            0x04, 0xA1, 0x01, 0x41, 0x20, 0x21, 0x3D, 0x20, 0x3A, 0x11, 0x07, 0x87, 
+            0x00, 0x00, 0x02, 0x00, 0x03, 0xCE, 0x06, 0x01, 0x8B, 0x03, 0x08, 0x02, 
+            0x00, 0x91, 0x22, 0x74, 0x72, 0x61, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x71, 
+            0x1A, 0x3F, 0x65, 0x6E, 0x74, 0xD4, 0x06, 0x01, 0x0D, 0x36, 0x00, 0x08, 
+            0x9F, 0x00, 0x09, 0x1D, 0x00, 0x07, 0xFA, 0x02, 0x03, 0x3F, 0x01, 0x00, 
+            0x02, 0x00, 0x03, 0x5C, 0x01, 0x01, 0x0B, 0x01, 0x09, 0x5C, 0x01, 0x00, 
+            0xEE, 0x02, 0x09, 0x14, 0x01, 0x00, 0xF5, 0x02, 0x0F, 0x5E, 0x01, 0x19, 
+            0x0F, 0x35, 0x01, 0x1E, 0x05, 0xAE, 0x00, 0x0A, 0x36, 0x01, 0x1F, 0x3D, 
+            0x36, 0x01, 0x0A, 0x15, 0x22, 0x0E, 0x0A, 0x12, 0x61, 0xBD, 0x17, 0x01, 
+            0xCA, 0x00, 0xB0, 0x2C, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x65, 
+            0x6E, 0x64, 0xC6, 0x24, 0x01, 0xDD, 0x04, 0x1F, 0x22, 0x01, 0x01, 0x03, 
+            0x0E, 0x6D, 0x00, 0x01, 0x70, 0x12, 0x0B, 0xA4, 0x01, 0x03, 0x27, 0x01, 
+            0x00, 0x45, 0x02, 0x02, 0x26, 0x01, 0x00, 0x02, 0x00, 0x07, 0x47, 0x01, 
+            0x0E, 0x46, 0x00, 0x01, 0x11, 0x12, 0x0F, 0x46, 0x00, 0x03, 0x0C, 0xE8, 
+            0x02, 0x0F, 0xF9, 0x00, 0x08, 0x02, 0xB1, 0x11, 0x0F, 0x47, 0x00, 0x03, 
+            0x07, 0x10, 0x03, 0x00, 0x02, 0x00, 0x0F, 0x48, 0x00, 0x0A, 0x05, 0xFE, 
+            0x0F, 0x00, 0x55, 0x11, 0x0F, 0x4F, 0x00, 0x03, 0x01, 0x9E, 0x03, 0x02, 
+            0xF2, 0x01, 0x58, 0x61, 0x72, 0x72, 0x61, 0x79, 0xC8, 0x02, 0x0F, 0x5C, 
+            0x00, 0x13, 0x0F, 0xA9, 0x00, 0x05, 0x07, 0x5A, 0x00, 0x02, 0x5A, 0x26, 
+            0x0F, 0x5B, 0x00, 0x16, 0x03, 0xDA, 0x06, 0x0F, 0xB1, 0x00, 0x0E, 0x03, 
+            0x23, 0x09, 0x08, 0xFC, 0x02, 0x04, 0x7F, 0x19, 0x0F, 0xAF, 0x01, 0x14, 
+            0x03, 0x9C, 0x09, 0x0F, 0x6A, 0x00, 0x0E, 0x00, 0x46, 0x06, 0x2F, 0x6E, 
+            0x67, 0x6A, 0x00, 0x29, 0x02, 0x36, 0x10, 0x0B, 0x69, 0x00, 0x01, 0x66, 
+            0x04, 0x00, 0x3E, 0x04, 0x01, 0xCB, 0x05, 0x11, 0x2C, 0xAF, 0x08, 0x19, 
+            0x5F, 0x65, 0x00, 0x01, 0x1D, 0x00, 0x03, 0x53, 0x1A, 0x0F, 0x6F, 0x04, 
+            0x05, 0x00, 0x02, 0x00, 0x03, 0xFB, 0x08, 0x01, 0x48, 0x00, 0x00, 0xE6, 
+            0x05, 0x0F, 0x44, 0x01, 0x04, 0x00, 0x02, 0x00, 0x03, 0xD5, 0x02, 0x07, 
+            0x9F, 0x01, 0x03, 0x48, 0x01, 0x01, 0x6C, 0x00, 0x0F, 0x7E, 0x00, 0x07, 
+            0x3C, 0x2A, 0x20, 0x2D, 0xD0, 0x0B, 0x05, 0xE8, 0x2D, 0x01, 0x3B, 0x00, 
+            0x00, 0x8F, 0x06, 0x01, 0x7C, 0x00, 0x00, 0x28, 0x16, 0x0B, 0xEA, 0x00, 
+            0x00, 0x02, 0x00, 0x03, 0xF2, 0x04, 0x08, 0xBC, 0x03, 0x02, 0x7A, 0x00, 
+            0x60, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x87, 0x09, 0x0F, 0xC2, 0x03, 
+            0x0D, 0x00, 0x02, 0x00, 0x0F, 0x7C, 0x0C, 0x06, 0x0F, 0x60, 0x00, 0x10, 
+            0x08, 0x0E, 0x04, 0x00, 0x02, 0x00, 0x06, 0x6E, 0x06, 0x07, 0xEC, 0x02, 
+            0x00, 0x96, 0x01, 0x03, 0xC0, 0x05, 0x01, 0x5E, 0x0D, 0x02, 0x21, 0x08, 
+            0x01, 0x4E, 0x04, 0x6F, 0x3A, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x08, 0x02, 
+            0x0C, 0x04, 0x88, 0x00, 0x07, 0xB4, 0x0E, 0x01, 0x4F, 0x00, 0x59, 0x20, 
+            0x27, 0x7B, 0x7D, 0x27, 0x3B, 0x29, 0x01, 0xFD, 0x1B, 0x01, 0xBB, 0x04, 
+            0x22, 0x22, 0x2C, 0x24, 0x00, 0x01, 0x73, 0x00, 0x03, 0xB3, 0x04, 0x03, 
+            0x93, 0x00, 0x06, 0x93, 0x05, 0x03, 0xA1, 0x03, 0x00, 0x93, 0x05, 0x0A, 
+            0x2A, 0x2C, 0x00, 0xB2, 0x00, 0x00, 0x12, 0x00, 0x30, 0x3D, 0x20, 0x24, 
+            0x66, 0x21, 0x08, 0xC9, 0x06, 0x02, 0xEB, 0x0B, 0x11, 0x21, 0xEE, 0x01, 
+            0x02, 0x3C, 0x08, 0x07, 0x6B, 0x13, 0x00, 0x17, 0x04, 0x0F, 0x3B, 0x16, 
+            0x01, 0x01, 0x93, 0x00, 0x03, 0xF9, 0x00, 0x0C, 0x23, 0x07, 0x00, 0x37, 
+            0x01, 0x04, 0x02, 0x00, 0x00, 0x64, 0x2D, 0x53, 0x61, 0x70, 0x70, 0x65, 
+            0x6E, 0x67, 0x20, 0x08, 0x79, 0x00, 0x00, 0x02, 0x00, 0x03, 0x2D, 0x08, 
+            0x12, 0x3A, 0x59, 0x08, 0x03, 0x96, 0x12, 0x0C, 0x71, 0x00, 0x00, 0x02, 
+            0x00, 0x03, 0x29, 0x00, 0x10, 0x2E, 0x68, 0x03, 0x15, 0x63, 0x12, 0x19, 
+            0x04, 0x38, 0x00, 0x0F, 0xB1, 0x00, 0x0B, 0x04, 0x02, 0x00, 0x04, 0x77, 
+            0x01, 0x08, 0x8A, 0x1A, 0x37, 0x61, 0x2C, 0x20, 0x4F, 0x07, 0x40, 0x6D, 
+            0x6D, 0x61, 0x73, 0xF8, 0x27, 0x01, 0x48, 0x01, 0x0F, 0x99, 0x1A, 0x1D, 
+            0x00, 0x02, 0x00, 0x06, 0x2F, 0x02, 0x04, 0x02, 0x00, 0x0F, 0x98, 0x0C, 
+            0x12, 0x0F, 0x04, 0x0C, 0x07, 0x00, 0xB6, 0x2B, 0x01, 0x9B, 0x01, 0x03, 
+            0x22, 0x01, 0x0F, 0xEA, 0x00, 0x0B, 0x04, 0xE2, 0x00, 0x05, 0xFD, 0x06, 
+            0x33, 0x27, 0x5D, 0x27, 0x3C, 0x03, 0x01, 0xD3, 0x00, 0x08, 0xDE, 0x02, 
+            0x03, 0x3D, 0x02, 0x00, 0x02, 0x00, 0x03, 0xF1, 0x03, 0x32, 0x76, 0x65, 
+            0x63, 0xBE, 0x01, 0x03, 0x1B, 0x00, 0x06, 0x58, 0x02, 0x04, 0x9F, 0x05, 
+            0x00, 0x59, 0x02, 0x0A, 0x14, 0x32, 0x00, 0x59, 0x02, 0x00, 0x12, 0x00, 
+            0x00, 0x95, 0x2C, 0x11, 0x61, 0x86, 0x24, 0x05, 0xB6, 0x06, 0x0F, 0x59, 
+            0x02, 0x0A, 0x19, 0x45, 0x69, 0x22, 0x00, 0x02, 0x00, 0x00, 0x4A, 0x00, 
+            0x00, 0x77, 0x31, 0x02, 0x26, 0x0B, 0x0F, 0x55, 0x02, 0x09, 0x00, 0x14, 
+            0x01, 0x00, 0xF0, 0x26, 0x00, 0x58, 0x12, 0x3F, 0x6B, 0x65, 0x79, 0x2F, 
+            0x02, 0x01, 0x03, 0x09, 0x01, 0x05, 0x8C, 0x00, 0x08, 0x02, 0x00, 0x0D, 
+            0xE5, 0x31, 0x09, 0x72, 0x03, 0x00, 0x61, 0x02, 0x40, 0x6E, 0x67, 0x3A, 
+            0x20, 0xAC, 0x04, 0x00, 0x2F, 0x12, 0x07, 0x74, 0x21, 0x1F, 0x20, 0x57, 
+            0x09, 0x00, 0x00, 0x02, 0x00, 0x02, 0x89, 0x21, 0x00, 0x8A, 0x00, 0x06, 
+            0xB2, 0x2C, 0x08, 0x02, 0x00, 0x03, 0x9B, 0x21, 0x00, 0x21, 0x00, 0x0D, 
+            0x91, 0x00, 0x03, 0xCA, 0x03, 0x04, 0x02, 0x00, 0x03, 0x7A, 0x01, 0x04, 
+            0x02, 0x00, 0x00, 0xEA, 0x00, 0x08, 0xFE, 0x01, 0x02, 0x12, 0x15, 0x0F, 
+            0xF1, 0x00, 0x08, 0x06, 0x3B, 0x05, 0x24, 0x27, 0x3A, 0xFA, 0x01, 0x29, 
+            0x6B, 0x65, 0xF8, 0x01, 0x00, 0x02, 0x00, 0x0B, 0x67, 0x00, 0x00, 0x7B, 
+            0x01, 0x0F, 0xD2, 0x03, 0x15, 0xA2, 0x6D, 0x61, 0x70, 0x5B, 0x6B, 0x65, 
+            0x79, 0x5D, 0x20, 0x3D, 0x33, 0x00, 0x07, 0xF1, 0x01, 0x00, 0x02, 0x00, 
+            0x03, 0xA8, 0x03, 0x04, 0x99, 0x03, 0x0F, 0xD1, 0x03, 0x2F, 0x0E, 0x29, 
+            0x02, 0x04, 0x02, 0x00, 0x03, 0xE4, 0x01, 0x05, 0xCF, 0x01, 0x01, 0xBF, 
+            0x03, 0x0F, 0xCF, 0x03, 0x02, 0x02, 0xBF, 0x02, 0x0F, 0xD0, 0x03, 0x8C, 
+            0x0E, 0xE9, 0x00, 0x04, 0xE1, 0x00, 0x06, 0xCE, 0x03, 0x14, 0x7D, 0xD4, 
+            0x01, 0x02, 0xD2, 0x00, 0x08, 0xD7, 0x01, 0x07, 0xD3, 0x01, 0x03, 0xCF, 
+            0x03, 0x3F, 0x6D, 0x61, 0x70, 0xCF, 0x03, 0x04, 0x02, 0x55, 0x07, 0x08, 
+            0xA5, 0x06, 0x01, 0x86, 0x21, 0x04, 0x9B, 0x22, 0x01, 0x0D, 0x00, 0x01, 
+            0xEC, 0x03, 0x03, 0x2A, 0x0D, 0x07, 0xAB, 0x07, 0x00, 0x2B, 0x02, 0x72, 
+            0x6C, 0x69, 0x74, 0x65, 0x72, 0x61, 0x6C, 0x12, 0x24, 0x14, 0x72, 0x7F, 
+            0x14, 0x00, 0x8F, 0x14, 0x0F, 0xFD, 0x06, 0x07, 0x08, 0xF9, 0x05, 0x60, 
+            0x69, 0x66, 0x20, 0x22, 0x2E, 0x22, 0x68, 0x05, 0x04, 0x4A, 0x00, 0x59, 
+            0x7C, 0x7C, 0x20, 0x22, 0x65, 0x12, 0x00, 0x0A, 0x39, 0x14, 0x00, 0x76, 
+            0x00, 0x02, 0xEF, 0x0E, 0x01, 0xC8, 0x36, 0x73, 0x79, 0x20, 0x24, 0x66, 
+            0x36, 0x34, 0x28, 0x3E, 0x00, 0x0B, 0x43, 0x03, 0x0F, 0x3B, 0x24, 0x0A, 
+            0x04, 0x02, 0x00, 0x04, 0x5B, 0x01, 0x04, 0x0B, 0x06, 0x02, 0x12, 0x01, 
+            0xC1, 0x3A, 0x20, 0x75, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x6F, 
+            0x20, 0xF2, 0x0A, 0x01, 0x91, 0x07, 0xAF, 0x20, 0x61, 0x73, 0x20, 0x66, 
+            0x36, 0x34, 0x22, 0x2C, 0x20, 0x71, 0x00, 0x03, 0x07, 0x7A, 0x01, 0x00, 
+            0x02, 0x00, 0x03, 0x7E, 0x01, 0x02, 0xAF, 0x00, 0x02, 0x81, 0x01, 0x00, 
+            0x02, 0x00, 0x07, 0x26, 0x00, 0x0E, 0xCE, 0x00, 0x00, 0xBA, 0x2B, 0x0E, 
+            0x5D, 0x00, 0x0F, 0xCA, 0x00, 0x0E, 0x0F, 0xC6, 0x00, 0x1D, 0x1F, 0x69, 
+            0xC6, 0x00, 0x04, 0x07, 0x9C, 0x00, 0x0F, 0xBE, 0x00, 0x00, 0x03, 0x1E, 
+            0x00, 0x06, 0x0E, 0x06, 0x03, 0xF1, 0x18, 0x07, 0x09, 0x0A, 0x01, 0x32, 
+            0x02, 0x0E, 0x3F, 0x02, 0x06, 0x4C, 0x26, 0x00, 0x02, 0x00, 0x00, 0xF7, 
+            0x00, 0x01, 0x02, 0x17, 0x00, 0x38, 0x08, 0x06, 0xEA, 0x14, 0x06, 0x23, 
+            0x01, 0x00, 0x21, 0x00, 0x00, 0x9A, 0x0D, 0x09, 0x1F, 0x00, 0x23, 0x20, 
+            0x2B, 0xB2, 0x0B, 0x0A, 0x28, 0x00, 0x0F, 0x7A, 0x26, 0x00, 0x00, 0x02, 
+            0x00, 0x02, 0x74, 0x06, 0x02, 0x66, 0x00, 0x11, 0x3C, 0xE7, 0x0D, 0x0A, 
+            0x49, 0x02, 0x03, 0x9F, 0x04, 0x02, 0x1D, 0x24, 0x03, 0xA5, 0x04, 0x52, 
+            0x60, 0x5C, 0x22, 0x60, 0x2C, 0x20, 0x18, 0x0F, 0x5A, 0x05, 0x01, 0x08, 
+            0x0F, 0x2F, 0x1B, 0x60, 0x6C, 0x02, 0x00, 0x02, 0x00, 0x02, 0x6D, 0x00, 
+            0x36, 0x2B, 0x3D, 0x32, 0xA1, 0x00, 0x04, 0x02, 0x00, 0x0F, 0xFC, 0x07, 
+            0x12, 0x0F, 0x93, 0x00, 0x03, 0x1F, 0x5C, 0x93, 0x00, 0x14, 0x1F, 0x5C, 
+            0x93, 0x00, 0x57, 0x1F, 0x2F, 0x93, 0x00, 0x14, 0x1F, 0x2F, 0x93, 0x00, 
+            0x57, 0x1F, 0x62, 0x93, 0x00, 0x13, 0x38, 0x22, 0x5C, 0x62, 0x2B, 0x05, 
+            0x04, 0x02, 0x00, 0x0F, 0xBA, 0x01, 0x43, 0x1F, 0x66, 0x94, 0x00, 0x15, 
+            0x3F, 0x78, 0x30, 0x43, 0x96, 0x00, 0x57, 0x1F, 0x6E, 0x96, 0x00, 0x15, 
+            0x05, 0x4A, 0x36, 0x08, 0x02, 0x00, 0x0F, 0x2A, 0x01, 0x43, 0x1F, 0x72, 
+            0x94, 0x00, 0x15, 0x1F, 0x72, 0x28, 0x01, 0x57, 0x1F, 0x74, 0x94, 0x00, 
+            0x15, 0x1F, 0x74, 0x94, 0x00, 0x57, 0x1F, 0x75, 0x94, 0x00, 0x09, 0x21, 
+            0x69, 0x66, 0xE7, 0x04, 0x12, 0x2D, 0xC1, 0x04, 0x47, 0x20, 0x3C, 0x20, 
+            0x36, 0xAE, 0x07, 0x08, 0x02, 0x00, 0x0C, 0x2D, 0x06, 0xD0, 0x75, 0x6E, 
+            0x69, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x65, 0x73, 0x63, 0x61, 0x70, 0x93, 
+            0x28, 0x31, 0x71, 0x75, 0x65, 0x93, 0x38, 0xFF, 0x06, 0x72, 0x65, 0x71, 
+            0x75, 0x69, 0x72, 0x65, 0x73, 0x20, 0x34, 0x20, 0x68, 0x65, 0x78, 0x20, 
+            0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0xEE, 0x00, 0x01, 0x03, 0x99, 0x3E, 
+            0x08, 0x02, 0x00, 0x00, 0xC3, 0x05, 0x42, 0x68, 0x65, 0x78, 0x5F, 0x35, 
+            0x00, 0x0F, 0x22, 0x08, 0x06, 0x03, 0x50, 0x02, 0x20, 0x20, 0x32, 0x0E, 
+            0x25, 0x08, 0x1B, 0x08, 0x04, 0x02, 0x00, 0x00, 0xF9, 0x0A, 0x06, 0x48, 
+            0x00, 0xEF, 0x3A, 0x69, 0x73, 0x5F, 0x61, 0x73, 0x63, 0x69, 0x69, 0x5F, 
+            0x68, 0x65, 0x78, 0x28, 0xA5, 0x05, 0x01, 0x00, 0x02, 0x00, 0x0F, 0xE1, 
+            0x00, 0x16, 0x41, 0x6D, 0x75, 0x73, 0x74, 0x3C, 0x15, 0x39, 0x61, 0x69, 
+            0x6E, 0xE5, 0x00, 0x00, 0xF0, 0x0B, 0x20, 0x22, 0x2C, 0xF6, 0x00, 0x03, 
+            0xC1, 0x00, 0x0F, 0xEF, 0x05, 0x00, 0x0F, 0xF5, 0x00, 0x04, 0x23, 0x69, 
+            0x6E, 0x8C, 0x37, 0x00, 0xF4, 0x00, 0x00, 0xCF, 0x07, 0x6F, 0x22, 0x30, 
+            0x78, 0x22, 0x20, 0x2B, 0x4C, 0x00, 0x0B, 0x06, 0x5B, 0x06, 0x02, 0x1F, 
+            0x1F, 0x05, 0x45, 0x00, 0x0F, 0x14, 0x01, 0x03, 0x02, 0x0F, 0x07, 0x3F, 
+            0x3D, 0x20, 0x36, 0x6A, 0x06, 0x24, 0x05, 0x6F, 0x00, 0x01, 0xC0, 0x1F, 
+            0x08, 0xB8, 0x09, 0x00, 0x66, 0x1A, 0x02, 0x95, 0x01, 0x00, 0x7A, 0x00, 
+            0x00, 0x4D, 0x01, 0x04, 0x02, 0x00, 0x01, 0x15, 0x00, 0x00, 0x75, 0x00, 
+            0x07, 0xDA, 0x11, 0x07, 0x03, 0x01, 0x03, 0x2F, 0x08, 0x00, 0x5A, 0x00, 
+            0x20, 0x74, 0x6F, 0x0A, 0x21, 0x04, 0xC3, 0x13, 0x02, 0x55, 0x1A, 0x04, 
+            0x89, 0x17, 0x0A, 0x5D, 0x39, 0x61, 0x3A, 0x20, 0x62, 0x75, 0x66, 0x7C, 
+            0xEC, 0x2C, 0x00, 0x4B, 0x08, 0x04, 0x47, 0x1A, 0x04, 0x7C, 0x3E, 0x01, 
+            0x7A, 0x0A, 0x0F, 0x52, 0x16, 0x11, 0x00, 0x25, 0x02, 0x04, 0x08, 0x0E, 
+            0x00, 0x18, 0x2B, 0x10, 0x29, 0x8D, 0x20, 0x01, 0x12, 0x00, 0x00, 0x91, 
+            0x2E, 0x02, 0x12, 0x00, 0x06, 0xFF, 0x07, 0x04, 0x1F, 0x02, 0x06, 0x8C, 
+            0x00, 0x10, 0x29, 0x89, 0x3B, 0x02, 0xF0, 0x3F, 0x42, 0x61, 0x72, 0x67, 
+            0x75, 0x96, 0x2A, 0x05, 0x6D, 0x0B, 0x04, 0x0B, 0x0E, 0x21, 0x20, 0x6F, 
+            0x6E, 0x08, 0x10, 0x66, 0x1F, 0x0A, 0x02, 0x3E, 0x16, 0x01, 0x25, 0x02, 
+            0x02, 0xF5, 0x0D, 0x01, 0x65, 0x00, 0x03, 0x26, 0x02, 0x03, 0x17, 0x01, 
+            0x21, 0x69, 0x66, 0x93, 0x2D, 0x04, 0x56, 0x2C, 0x00, 0xF0, 0x12, 0x08, 
+            0xF3, 0x41, 0x0F, 0x87, 0x00, 0x15, 0x42, 0x6D, 0x70, 0x74, 0x79, 0xBC, 
+            0x2C, 0x1A, 0x22, 0x60, 0x00, 0x00, 0x63, 0x03, 0x02, 0x5D, 0x0A, 0x03, 
+            0x0C, 0x0B, 0x02, 0xB4, 0x1B, 0x01, 0xB7, 0x3A, 0x10, 0x2C, 0xA9, 0x1B, 
+            0x42, 0x69, 0x63, 0x74, 0x29, 0x3F, 0x0F, 0x04, 0x8D, 0x01, 0x0F, 0x49, 
+            0x0A, 0x0A, 0x0F, 0x91, 0x00, 0x02, 0x01, 0xE3, 0x00, 0x02, 0x66, 0x00, 
+            0x0A, 0x7E, 0x00, 0x03, 0xF1, 0x01, 0x02, 0x1B, 0x00, 0x02, 0x54, 0x3A, 
+            0x0E, 0x4A, 0x2F, 0x02, 0x44, 0x2F, 0xB0, 0x50, 0x72, 0x65, 0x74, 0x74, 
+            0x79, 0x20, 0x50, 0x72, 0x69, 0x6E, 0xBD, 0x13, 0x01, 0x15, 0x00, 0x00, 
+            0x2C, 0x2F, 0x08, 0x02, 0x00, 0x01, 0x38, 0x2F, 0x00, 0x5A, 0x0A, 0x03, 
+            0xCF, 0x3A, 0x00, 0x12, 0x35, 0x00, 0x4D, 0x02, 0x00, 0x22, 0x02, 0x0F, 
+            0x6F, 0x43, 0xF0, 0x0F, 0x1E, 0x43, 0x11, 0x04, 0x1F, 0x02, 0x00, 0x02, 
+            0x00, 0x06, 0x7F, 0x12, 0x00, 0x45, 0x01, 0x02, 0xC5, 0x39, 0x0B, 0xD3, 
+            0x07, 0x06, 0x19, 0x00, 0x01, 0x4F, 0x30, 0x13, 0x73, 0xDF, 0x01, 0x00, 
+            0x02, 0x00, 0x06, 0x1B, 0x00, 0x07, 0xB2, 0x10, 0x0F, 0x20, 0x00, 0x02, 
+            0x0B, 0x8F, 0x42, 0x03, 0xBD, 0x01, 0x01, 0x10, 0x10, 0x0F, 0x8C, 0x3C, 
+            0x10, 0x0F, 0x81, 0x42, 0x1E, 0x06, 0x99, 0x00, 0x07, 0xCD, 0x00, 0x07, 
+            0x15, 0x00, 0x0F, 0x65, 0x42, 0x07, 0x07, 0x25, 0x00, 0x09, 0x5F, 0x42, 
+            0x04, 0xB2, 0x00, 0x20, 0x65, 0x63, 0xB0, 0x00, 0x01, 0x91, 0x04, 0x06, 
+            0x4A, 0x42, 0x02, 0x0D, 0x0C, 0x0F, 0xDE, 0x45, 0x14, 0x00, 0xE2, 0x14, 
+            0x01, 0xA6, 0x21, 0x0E, 0xEB, 0x03, 0x07, 0x7D, 0x00, 0x0F, 0x46, 0x42, 
+            0x72, 0x40, 0x69, 0x74, 0x65, 0x6D, 0x76, 0x0F, 0x00, 0x09, 0x16, 0x06, 
+            0x18, 0x05, 0x00, 0x46, 0x05, 0x05, 0xFF, 0x43, 0x06, 0x17, 0x00, 0x00, 
+            0x02, 0x00, 0x07, 0xC1, 0x00, 0x0F, 0x67, 0x02, 0x38, 0x04, 0x7C, 0x01, 
+            0x01, 0x4D, 0x3B, 0x01, 0x79, 0x01, 0x00, 0x99, 0x00, 0x04, 0x75, 0x01, 
+            0x0C, 0x44, 0x36, 0x0F, 0x2D, 0x02, 0x63, 0x09, 0xDB, 0x41, 0x0C, 0xB1, 
+            0x00, 0x04, 0x2F, 0x02, 0x00, 0xC1, 0x00, 0x0E, 0x4A, 0x35, 0x0C, 0xC1, 
+            0x00, 0x01, 0x1C, 0x0F, 0x04, 0x89, 0x06, 0x03, 0x8A, 0x05, 0x00, 0xE7, 
+            0x04, 0x01, 0x2E, 0x03, 0x04, 0x18, 0x00, 0x00, 0x02, 0x00, 0x03, 0x67, 
+            0x00, 0x00, 0x1C, 0x00, 0x01, 0x16, 0x01, 0x01, 0x21, 0x00, 0x0F, 0x17, 
+            0x01, 0x05, 0x03, 0x97, 0x03, 0x03, 0xEB, 0x18, 0x03, 0x57, 0x00, 0x00, 
+            0xDB, 0x17, 0x01, 0x36, 0x00, 0x0F, 0x57, 0x00, 0x00, 0x00, 0x1C, 0x00, 
+            0x0F, 0x57, 0x00, 0x1D, 0x06, 0x0E, 0x02, 0x06, 0x0A, 0x02, 0x03, 0x1B, 
+            0x04, 0x02, 0x67, 0x00, 0x04, 0x86, 0x00, 0x09, 0x68, 0x36, 0x02, 0xC8, 
+            0x00, 0x01, 0x90, 0x06, 0x01, 0x09, 0x34, 0x04, 0xC3, 0x00, 0x01, 0x09, 
+            0x01, 0x41, 0x20, 0x3D, 0x20, 0x32, 0xE1, 0x07, 0x06, 0x1C, 0x10, 0x00, 
+            0xD1, 0x06, 0x0F, 0xCF, 0x0F, 0x00, 0x00, 0x17, 0x00, 0x01, 0x66, 0x00, 
+            0x03, 0xE7, 0x06, 0x06, 0xB8, 0x07, 0x01, 0x75, 0x07, 0x02, 0xA7, 0x08, 
+            0x03, 0xF9, 0x00, 0x0F, 0xA1, 0x41, 0x09, 0x13, 0x22, 0x90, 0x00, 0x25, 
+            0x29, 0x3A, 0xE6, 0x07, 0x20, 0x20, 0x5B, 0x43, 0x00, 0x41, 0x5D, 0x20, 
+            0x69, 0x73, 0x78, 0x32, 0x02, 0x03, 0x08, 0x00, 0x6B, 0x19, 0x03, 0xF9, 
+            0x06, 0x01, 0x77, 0x00, 0x05, 0xDC, 0x00, 0x01, 0xB4, 0x15, 0x00, 0x8E, 
+            0x00, 0x05, 0xC7, 0x21, 0x00, 0x82, 0x12, 0x02, 0x56, 0x00, 0x08, 0xC6, 
+            0x02, 0x01, 0x36, 0x00, 0x04, 0xED, 0x00, 0x06, 0xFA, 0x30, 0x07, 0xA3, 
+            0x00, 0x02, 0x41, 0x00, 0x08, 0x9D, 0x01, 0x05, 0x7D, 0x07, 0x01, 0xCE, 
+            0x41, 0x0F, 0xCA, 0x36, 0x1C, 0x50, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 
+        },
+        5675,
+        19208,
+    },
+    {
+        "std/test/data.txt",
+        (const uint8_t[]){
+            0xC0, 0x66, 0x6F, 0x6F, 0x20, 0x62, 0x61, 0x72, 0x20, 0x62, 0x61, 0x7A, 
+            0x0A, 
+        },
+        13,
+        12,
+    },
+    {
+        "std/test/testdir/self.pyro",
+        (const uint8_t[]){
+            0xF1, 0x0F, 0x70, 0x75, 0x62, 0x20, 0x76, 0x61, 0x72, 0x20, 0x70, 0x61, 
+            0x74, 0x68, 0x20, 0x3D, 0x20, 0x22, 0x65, 0x6D, 0x62, 0x65, 0x64, 0x2F, 
+            0x73, 0x74, 0x64, 0x2F, 0x74, 0x65, 0x73, 0x74, 0x05, 0x00, 0xF0, 0x1A, 
+            0x64, 0x69, 0x72, 0x2F, 0x73, 0x65, 0x6C, 0x66, 0x2E, 0x70, 0x79, 0x72, 
+            0x6F, 0x22, 0x3B, 0x0A, 0x0A, 0x64, 0x65, 0x66, 0x20, 0x24, 0x6D, 0x61, 
+            0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 
+            0x63, 0x68, 0x6F, 0x20, 0x22, 0x44, 0x00, 0x40, 0x3A, 0x20, 0x24, 0x7B, 
+            0x08, 0x00, 0x37, 0x7D, 0x22, 0x3B, 0x1A, 0x00, 0x40, 0x61, 0x72, 0x67, 
+            0x73, 0x1A, 0x00, 0xB0, 0x24, 0x61, 0x72, 0x67, 0x73, 0x7D, 0x22, 0x3B, 
+            0x0A, 0x7D, 0x0A, 
+        },
+        111,
+        121,
+    },
+    {
+        "std/test/testdir/testmod.pyro",
+        (const uint8_t[]){
+            0xF1, 0x0F, 0x70, 0x75, 0x62, 0x20, 0x76, 0x61, 0x72, 0x20, 0x70, 0x61, 
+            0x74, 0x68, 0x20, 0x3D, 0x20, 0x22, 0x65, 0x6D, 0x62, 0x65, 0x64, 0x2F, 
+            0x73, 0x74, 0x64, 0x2F, 0x74, 0x65, 0x73, 0x74, 0x05, 0x00, 0x31, 0x64, 
+            0x69, 0x72, 0x08, 0x00, 0xF0, 0x15, 0x6D, 0x6F, 0x64, 0x2E, 0x70, 0x79, 
+            0x72, 0x6F, 0x22, 0x3B, 0x0A, 0x0A, 0x64, 0x65, 0x66, 0x20, 0x24, 0x6D, 
+            0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+            0x65, 0x63, 0x68, 0x6F, 0x20, 0x22, 0x47, 0x00, 0x40, 0x3A, 0x20, 0x24, 
+            0x7B, 0x08, 0x00, 0x37, 0x7D, 0x22, 0x3B, 0x1A, 0x00, 0x40, 0x61, 0x72, 
+            0x67, 0x73, 0x1A, 0x00, 0xB0, 0x24, 0x61, 0x72, 0x67, 0x73, 0x7D, 0x22, 
+            0x3B, 0x0A, 0x7D, 0x0A, 
+        },
+        112,
+        124,
+    },
+    {
+        "std/test/testmod.pyro",
+        (const uint8_t[]){
+            0xF1, 0x0F, 0x70, 0x75, 0x62, 0x20, 0x76, 0x61, 0x72, 0x20, 0x70, 0x61, 
+            0x74, 0x68, 0x20, 0x3D, 0x20, 0x22, 0x65, 0x6D, 0x62, 0x65, 0x64, 0x2F, 
+            0x73, 0x74, 0x64, 0x2F, 0x74, 0x65, 0x73, 0x74, 0x05, 0x00, 0xF0, 0x15, 
+            0x6D, 0x6F, 0x64, 0x2E, 0x70, 0x79, 0x72, 0x6F, 0x22, 0x3B, 0x0A, 0x0A, 
+            0x64, 0x65, 0x66, 0x20, 0x24, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 
+            0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x63, 0x68, 0x6F, 0x20, 0x22, 
+            0x3F, 0x00, 0x40, 0x3A, 0x20, 0x24, 0x7B, 0x08, 0x00, 0x37, 0x7D, 0x22, 
+            0x3B, 0x1A, 0x00, 0x40, 0x61, 0x72, 0x67, 0x73, 0x1A, 0x00, 0xB0, 0x24, 
+            0x61, 0x72, 0x67, 0x73, 0x7D, 0x22, 0x3B, 0x0A, 0x7D, 0x0A, 
+        },
+        106,
+        116,
+    },
+    {
+        "std/cmd.pyro",
+        (const uint8_t[]){
+            0xF2, 0x1D, 0x70, 0x75, 0x62, 0x20, 0x64, 0x65, 0x66, 0x20, 0x6D, 0x6B, 
+            0x64, 0x69, 0x72, 0x28, 0x70, 0x61, 0x74, 0x68, 0x3A, 0x20, 0x73, 0x74, 
+            0x72, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x73, 
+            0x65, 0x72, 0x74, 0x20, 0x24, 0x69, 0x73, 0x5F, 0x73, 0x74, 0x20, 0x00, 
+            0x42, 0x29, 0x2C, 0x20, 0x22, 0x2E, 0x00, 0xF0, 0x10, 0x29, 0x3A, 0x20, 
+            0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x61, 0x72, 0x67, 0x75, 
+            0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 
+            0x65, 0x64, 0x20, 0x61, 0x48, 0x00, 0xF1, 0x03, 0x69, 0x6E, 0x67, 0x2C, 
+            0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x24, 0x7B, 0x24, 0x74, 0x79, 
+            0x70, 0x65, 0x64, 0x00, 0x51, 0x29, 0x7D, 0x22, 0x3B, 0x0A, 0x61, 0x00, 
+            0xF2, 0x07, 0x6C, 0x65, 0x74, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 
+            0x20, 0x3D, 0x20, 0x74, 0x72, 0x79, 0x20, 0x24, 0x72, 0x75, 0x6E, 0x28, 
+            0x61, 0x00, 0xA0, 0x22, 0x2C, 0x20, 0x28, 0x22, 0x2D, 0x70, 0x22, 0x2C, 
+            0x20, 0x98, 0x00, 0x31, 0x29, 0x29, 0x3B, 0x32, 0x00, 0x21, 0x69, 0x66, 
+            0x8F, 0x00, 0x42, 0x65, 0x72, 0x72, 0x28, 0x39, 0x00, 0x04, 0xAC, 0x00, 
+            0x00, 0x02, 0x00, 0x63, 0x24, 0x70, 0x61, 0x6E, 0x69, 0x63, 0x40, 0x00, 
+            0x62, 0x28, 0x29, 0x3A, 0x20, 0x24, 0x7B, 0x25, 0x00, 0x23, 0x7D, 0x22, 
+            0x3F, 0x00, 0x16, 0x7D, 0x78, 0x00, 0xF0, 0x09, 0x28, 0x65, 0x78, 0x69, 
+            0x74, 0x5F, 0x63, 0x6F, 0x64, 0x65, 0x2C, 0x20, 0x6F, 0x75, 0x74, 0x5F, 
+            0x62, 0x75, 0x66, 0x2C, 0x20, 0x65, 0x72, 0x72, 0x09, 0x00, 0x33, 0x29, 
+            0x20, 0x3D, 0x98, 0x00, 0x05, 0x76, 0x00, 0x05, 0x2E, 0x00, 0x53, 0x20, 
+            0x21, 0x3D, 0x20, 0x30, 0x21, 0x01, 0x00, 0x02, 0x00, 0x0F, 0x75, 0x00, 
+            0x00, 0x03, 0x46, 0x00, 0x31, 0x3A, 0x74, 0x6F, 0x38, 0x01, 0x97, 0x29, 
+            0x3A, 0x73, 0x74, 0x72, 0x69, 0x70, 0x28, 0x29, 0x87, 0x00, 0x44, 0x7D, 
+            0x0A, 0x0A, 0x0A, 0x7E, 0x01, 0x21, 0x72, 0x6D, 0x17, 0x01, 0x0F, 0x7B, 
+            0x01, 0x11, 0x20, 0x72, 0x6D, 0xD7, 0x00, 0x0F, 0x78, 0x01, 0x45, 0x22, 
+            0x72, 0x6D, 0x75, 0x01, 0x2F, 0x72, 0x66, 0x76, 0x01, 0x21, 0x02, 0x9C, 
+            0x00, 0x0F, 0x73, 0x01, 0x59, 0x04, 0x72, 0x00, 0x03, 0xB6, 0x01, 0x0F, 
+            0x70, 0x01, 0x15, 0x61, 0x6D, 0x76, 0x28, 0x73, 0x72, 0x63, 0x6F, 0x01, 
+            0x51, 0x2C, 0x20, 0x64, 0x73, 0x74, 0x0A, 0x00, 0x04, 0x48, 0x02, 0x0B, 
+            0xF4, 0x02, 0x31, 0x73, 0x72, 0x63, 0xF3, 0x02, 0x1F, 0x76, 0x78, 0x01, 
+            0x01, 0x6F, 0x20, 0x5B, 0x73, 0x72, 0x63, 0x5D, 0xF6, 0x02, 0x10, 0x00, 
+            0x46, 0x00, 0x00, 0xF5, 0x02, 0x00, 0x30, 0x02, 0x0B, 0x61, 0x00, 0x3F, 
+            0x64, 0x73, 0x74, 0x61, 0x00, 0x09, 0x3F, 0x64, 0x73, 0x74, 0x61, 0x00, 
+            0x11, 0x00, 0x46, 0x00, 0x00, 0x61, 0x00, 0x01, 0x24, 0x03, 0x0F, 0x56, 
+            0x03, 0x05, 0x12, 0x76, 0xDE, 0x01, 0x00, 0xDD, 0x01, 0x31, 0x73, 0x72, 
+            0x63, 0xFB, 0x00, 0x0F, 0x57, 0x03, 0x1B, 0x01, 0x05, 0x01, 0x0F, 0xE1, 
+            0x01, 0x59, 0x04, 0x72, 0x00, 0x0F, 0xE1, 0x01, 0x1C, 0x2F, 0x63, 0x70, 
+            0xE1, 0x01, 0x1E, 0x2F, 0x63, 0x70, 0xE1, 0x01, 0x4C, 0x0F, 0x61, 0x00, 
+            0x05, 0x0F, 0xE1, 0x01, 0x38, 0x10, 0x63, 0x2D, 0x05, 0x04, 0xBF, 0x03, 
+            0x0F, 0xE2, 0x01, 0x22, 0x02, 0xA5, 0x00, 0x0F, 0xE2, 0x01, 0x59, 0x04, 
+            0x72, 0x00, 0x0F, 0xE2, 0x01, 0x1C, 0x93, 0x67, 0x69, 0x74, 0x28, 0x2A, 
+            0x61, 0x72, 0x67, 0x73, 0xBC, 0x03, 0x20, 0x2D, 0x3E, 0x70, 0x06, 0x03, 
+            0x96, 0x05, 0x0F, 0x00, 0x03, 0x04, 0x50, 0x67, 0x69, 0x74, 0x22, 0x2C, 
+            0xAC, 0x06, 0x13, 0x73, 0x0D, 0x06, 0x0F, 0x4C, 0x06, 0x12, 0x00, 0x6A, 
+            0x00, 0x0F, 0x4A, 0x06, 0x5C, 0x05, 0x73, 0x00, 0x0F, 0x15, 0x01, 0x10, 
+            0x01, 0xF1, 0x03, 0x64, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0xC6, 0x06, 
+            0x05, 0x07, 0x05, 0x19, 0x3B, 0x66, 0x06, 0x4F, 0x6D, 0x61, 0x6B, 0x65, 
+            0x34, 0x01, 0x1E, 0x00, 0x35, 0x00, 0x0F, 0x35, 0x01, 0x20, 0x00, 0x37, 
+            0x00, 0x00, 0x50, 0x03, 0x0F, 0x4A, 0x02, 0x59, 0x06, 0x74, 0x00, 0x0F, 
+            0x37, 0x01, 0x2B, 0x50, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 
+        },
+        609,
+        2329,
+    },
+    {
+        "std/cli/test.pyro",
+        (const uint8_t[]){
+            0xF1, 0x15, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x73, 0x74, 0x64, 
+            0x3A, 0x3A, 0x66, 0x73, 0x3B, 0x0A, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x69, 
+            0x6E, 0x69, 0x74, 0x5F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x3D, 
+            0x20, 0x22, 0x14, 0x00, 0xF4, 0x09, 0x24, 0x66, 0x69, 0x6C, 0x65, 0x70, 
+            0x61, 0x74, 0x68, 0x3B, 0x0A, 0x0A, 0x70, 0x75, 0x62, 0x20, 0x64, 0x65, 
+            0x66, 0x20, 0x73, 0x65, 0x74, 0x5F, 0x17, 0x00, 0x14, 0x28, 0x09, 0x00, 
+            0x76, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x31, 0x00, 0x34, 0x20, 
+            0x3D, 0x20, 0x1C, 0x00, 0x80, 0x3B, 0x0A, 0x7D, 0x0A, 0x22, 0x3B, 0x0A, 
+            0x0A, 0x3D, 0x00, 0xF3, 0x05, 0x72, 0x65, 0x64, 0x28, 0x61, 0x72, 0x67, 
+            0x3A, 0x20, 0x61, 0x6E, 0x79, 0x29, 0x20, 0x2D, 0x3E, 0x20, 0x73, 0x74, 
+            0x72, 0x3B, 0x00, 0xB3, 0x69, 0x66, 0x20, 0x4E, 0x4F, 0x5F, 0x43, 0x4F, 
+            0x4C, 0x4F, 0x52, 0x12, 0x00, 0x00, 0x02, 0x00, 0xB0, 0x72, 0x65, 0x74, 
+            0x75, 0x72, 0x6E, 0x20, 0x24, 0x73, 0x74, 0x72, 0x39, 0x00, 0x21, 0x29, 
+            0x3B, 0x67, 0x00, 0x11, 0x7D, 0x06, 0x00, 0x03, 0x1C, 0x00, 0xF1, 0x02, 
+            0x22, 0x5C, 0x78, 0x31, 0x42, 0x5B, 0x31, 0x3B, 0x33, 0x31, 0x6D, 0x24, 
+            0x7B, 0x61, 0x72, 0x67, 0x7D, 0x10, 0x00, 0x30, 0x30, 0x6D, 0x22, 0x79, 
+            0x00, 0x01, 0x76, 0x00, 0x50, 0x67, 0x72, 0x65, 0x65, 0x6E, 0x3F, 0x00, 
+            0x0F, 0x78, 0x00, 0x43, 0x1F, 0x32, 0x78, 0x00, 0x08, 0x1F, 0x79, 0x77, 
+            0x00, 0x46, 0x2F, 0x39, 0x30, 0x77, 0x00, 0x05, 0x6F, 0x72, 0x65, 0x64, 
+            0x5F, 0x62, 0x67, 0x79, 0x00, 0x46, 0x4F, 0x34, 0x31, 0x3B, 0x33, 0x7C, 
+            0x00, 0x06, 0x01, 0x6B, 0x01, 0x0F, 0x7E, 0x00, 0x4A, 0x1F, 0x32, 0x7E, 
+            0x00, 0x08, 0xBD, 0x6D, 0x61, 0x6B, 0x65, 0x5F, 0x6D, 0x6F, 0x64, 0x75, 
+            0x6C, 0x65, 0x9B, 0x02, 0x00, 0xE4, 0x02, 0x02, 0x1B, 0x00, 0x97, 0x20, 
+            0x3D, 0x20, 0x24, 0x65, 0x78, 0x65, 0x63, 0x28, 0xF3, 0x02, 0x03, 0x59, 
+            0x02, 0x02, 0x21, 0x00, 0x2F, 0x3A, 0x3A, 0xE5, 0x02, 0x03, 0x02, 0x7D, 
+            0x02, 0x03, 0x77, 0x02, 0x02, 0x2B, 0x00, 0x05, 0x64, 0x02, 0x42, 0x61, 
+            0x64, 0x64, 0x5F, 0x58, 0x03, 0xC0, 0x5F, 0x72, 0x6F, 0x6F, 0x74, 0x73, 
+            0x5F, 0x66, 0x72, 0x6F, 0x6D, 0x5F, 0x3C, 0x03, 0x0D, 0x8A, 0x00, 0x20, 
+            0x6C, 0x65, 0x7C, 0x03, 0x52, 0x61, 0x73, 0x68, 0x65, 0x64, 0x2C, 0x00, 
+            0x00, 0x91, 0x00, 0x01, 0x35, 0x00, 0x91, 0x3A, 0x63, 0x6F, 0x70, 0x79, 
+            0x28, 0x29, 0x3B, 0x0A, 0xE0, 0x02, 0x00, 0x28, 0x00, 0x41, 0x72, 0x65, 
+            0x61, 0x6C, 0x46, 0x00, 0xB0, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x79, 0x20, 
+            0x66, 0x73, 0x3A, 0x3A, 0x14, 0x00, 0x0A, 0x59, 0x00, 0x02, 0x99, 0x00, 
+            0xB0, 0x69, 0x66, 0x20, 0x24, 0x69, 0x73, 0x5F, 0x65, 0x72, 0x72, 0x28, 
+            0x23, 0x00, 0x01, 0x37, 0x00, 0x04, 0x99, 0x03, 0x00, 0x02, 0x00, 0xF0, 
+            0x11, 0x24, 0x65, 0x78, 0x69, 0x74, 0x28, 0x22, 0x65, 0x72, 0x72, 0x6F, 
+            0x72, 0x3A, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 
+            0x20, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x20, 0x54, 0x00, 0x44, 
+            0x20, 0x27, 0x24, 0x7B, 0xB9, 0x03, 0x65, 0x7D, 0x27, 0x3A, 0x20, 0x24, 
+            0x7B, 0x4B, 0x00, 0x23, 0x7D, 0x22, 0x25, 0x01, 0x16, 0x7D, 0x9F, 0x00, 
+            0x61, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x6A, 0x00, 0x00, 0xF2, 0x03, 
+            0xA7, 0x73, 0x3A, 0x3A, 0x64, 0x69, 0x72, 0x6E, 0x61, 0x6D, 0x65, 0x82, 
+            0x00, 0x02, 0x9D, 0x00, 0x03, 0xE1, 0x00, 0x77, 0x61, 0x70, 0x70, 0x65, 
+            0x6E, 0x64, 0x28, 0x38, 0x00, 0x08, 0xEE, 0x00, 0x02, 0x54, 0x01, 0x18, 
+            0x73, 0x50, 0x00, 0x48, 0x6A, 0x6F, 0x69, 0x6E, 0x2F, 0x00, 0x33, 0x2C, 
+            0x20, 0x22, 0x26, 0x00, 0x04, 0x8F, 0x00, 0x0A, 0x5A, 0x00, 0x03, 0x1D, 
+            0x00, 0x01, 0x43, 0x00, 0x04, 0x5B, 0x00, 0x03, 0xB2, 0x01, 0x09, 0x74, 
+            0x01, 0x05, 0xB9, 0x01, 0x84, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 
+            0x5F, 0x1E, 0x00, 0x08, 0xC5, 0x01, 0x14, 0x28, 0x15, 0x00, 0x01, 0xBD, 
+            0x00, 0x04, 0x4C, 0x01, 0x03, 0x71, 0x00, 0x55, 0x63, 0x6C, 0x65, 0x61, 
+            0x72, 0xAD, 0x01, 0x40, 0x66, 0x6F, 0x72, 0x20, 0x26, 0x00, 0x2B, 0x20, 
+            0x69, 0x69, 0x00, 0x07, 0xCD, 0x04, 0x03, 0x39, 0x00, 0x03, 0x04, 0x01, 
+            0x00, 0x2E, 0x00, 0x05, 0x52, 0x01, 0x03, 0xAA, 0x04, 0xF0, 0x03, 0x72, 
+            0x75, 0x6E, 0x5F, 0x74, 0x65, 0x73, 0x74, 0x73, 0x5F, 0x69, 0x6E, 0x5F, 
+            0x64, 0x65, 0x62, 0x75, 0x67, 0xCF, 0x02, 0x24, 0x65, 0x28, 0x7B, 0x00, 
+            0x00, 0x66, 0x00, 0x04, 0x9F, 0x01, 0x00, 0x6A, 0x00, 0x48, 0x24, 0x61, 
+            0x72, 0x67, 0x62, 0x00, 0x40, 0x69, 0x66, 0x20, 0x21, 0x23, 0x02, 0x21, 
+            0x69, 0x73, 0xA4, 0x05, 0x0D, 0x7B, 0x02, 0x04, 0x02, 0x00, 0x0A, 0x0B, 
+            0x02, 0x7F, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x01, 0x02, 0x00, 
+            0x04, 0x64, 0x01, 0x00, 0x02, 0x00, 0x03, 0xF7, 0x01, 0x00, 0x02, 0x00, 
+            0x00, 0x4C, 0x03, 0x43, 0x63, 0x6F, 0x64, 0x65, 0x95, 0x02, 0x5B, 0x24, 
+            0x72, 0x65, 0x61, 0x64, 0x71, 0x00, 0x02, 0xF6, 0x01, 0x00, 0x02, 0x00, 
+            0x07, 0x97, 0x02, 0x00, 0x34, 0x00, 0x04, 0xCB, 0x00, 0x04, 0x02, 0x00, 
+            0x0A, 0x8B, 0x00, 0x08, 0x96, 0x02, 0x21, 0x61, 0x64, 0x44, 0x06, 0x0E, 
+            0x93, 0x02, 0x00, 0x47, 0x00, 0x05, 0x8E, 0x02, 0x00, 0x02, 0x00, 0x0B, 
+            0x9B, 0x00, 0x09, 0xB6, 0x01, 0x2F, 0x20, 0x3D, 0x9C, 0x03, 0x12, 0x03, 
+            0x74, 0x03, 0x00, 0x02, 0x00, 0x00, 0xDE, 0x00, 0x02, 0x47, 0x02, 0x2F, 
+            0x20, 0x3D, 0x53, 0x04, 0x03, 0x06, 0xDD, 0x00, 0x02, 0x49, 0x04, 0x00, 
+            0x91, 0x00, 0x11, 0x2C, 0xAD, 0x00, 0x00, 0x44, 0x03, 0x13, 0x2C, 0x3E, 
+            0x00, 0x04, 0x7F, 0x02, 0x00, 0x02, 0x00, 0x00, 0xB9, 0x01, 0x00, 0x18, 
+            0x03, 0x00, 0xB5, 0x01, 0x02, 0x1E, 0x00, 0xC5, 0x3A, 0x61, 0x6C, 0x6C, 
+            0x5F, 0x6D, 0x65, 0x6D, 0x62, 0x65, 0x72, 0x73, 0xE0, 0x01, 0x04, 0x02, 
+            0x00, 0x21, 0x69, 0x66, 0x2E, 0x00, 0xF0, 0x00, 0x3A, 0x73, 0x74, 0x61, 
+            0x72, 0x74, 0x73, 0x5F, 0x77, 0x69, 0x74, 0x68, 0x28, 0x22, 0x24, 0x1A, 
+            0x02, 0x61, 0x5F, 0x22, 0x29, 0x20, 0x26, 0x26, 0xE9, 0x03, 0x53, 0x66, 
+            0x75, 0x6E, 0x63, 0x28, 0x4D, 0x00, 0x02, 0x49, 0x00, 0x10, 0x28, 0x35, 
+            0x00, 0x1C, 0x29, 0x62, 0x01, 0x00, 0x02, 0x00, 0x0F, 0x27, 0x00, 0x00, 
+            0x00, 0xBB, 0x02, 0x00, 0x1B, 0x00, 0x04, 0x02, 0x00, 0x02, 0x55, 0x07, 
+            0x00, 0x02, 0x00, 0x07, 0x4F, 0x01, 0x0F, 0x1E, 0x03, 0x18, 0x02, 0x4E, 
+            0x00, 0x0E, 0xCB, 0x02, 0x05, 0xDD, 0x00, 0x00, 0x58, 0x01, 0x01, 0xD1, 
+            0x00, 0x40, 0x5F, 0x74, 0x69, 0x6D, 0x3C, 0x02, 0x64, 0x24, 0x63, 0x6C, 
+            0x6F, 0x63, 0x6B, 0x88, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xD3, 0x00, 0x00, 
+            0xFF, 0x03, 0x82, 0x73, 0x73, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x30, 0x54, 
+            0x00, 0x06, 0x1A, 0x00, 0x03, 0x1F, 0x02, 0x0A, 0x1A, 0x00, 0x12, 0x69, 
+            0x33, 0x04, 0x0F, 0x34, 0x00, 0x00, 0x01, 0x1A, 0x00, 0x08, 0x34, 0x00, 
+            0x01, 0x58, 0x05, 0x00, 0x8C, 0x01, 0x0F, 0x45, 0x03, 0xFF, 0x0C, 0xF2, 
+            0x01, 0x24, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x28, 0x22, 0x7B, 0x7D, 0x20, 
+            0x20, 0x7B, 0x7D, 0x22, 0x2C, 0xCA, 0x08, 0x62, 0x22, 0x5B, 0x20, 0x20, 
+            0xC2, 0xB7, 0x02, 0x00, 0x61, 0x20, 0x20, 0x5D, 0x22, 0x29, 0x2C, 0x62, 
+            0x01, 0x00, 0xF3, 0x02, 0x03, 0xC8, 0x04, 0x00, 0x02, 0x00, 0xD0, 0x24, 
+            0x73, 0x74, 0x64, 0x6F, 0x75, 0x74, 0x3A, 0x66, 0x6C, 0x75, 0x73, 0x68, 
+            0xDC, 0x01, 0x01, 0x74, 0x01, 0x00, 0x02, 0x00, 0x00, 0xC7, 0x01, 0x0F, 
+            0x9B, 0x03, 0x23, 0x00, 0x3E, 0x00, 0x00, 0x02, 0x00, 0x00, 0x42, 0x00, 
+            0x02, 0xCA, 0x02, 0x0F, 0x9A, 0x03, 0x07, 0x09, 0x6F, 0x00, 0x50, 0x72, 
+            0x65, 0x73, 0x75, 0x6C, 0xD0, 0x0A, 0x00, 0x3C, 0x07, 0x0F, 0xAC, 0x03, 
+            0x0C, 0x00, 0x61, 0x00, 0x00, 0x02, 0x00, 0x07, 0xB0, 0x04, 0x02, 0x3F, 
+            0x00, 0x0C, 0x50, 0x03, 0x04, 0x1E, 0x01, 0x22, 0x5C, 0x72, 0x20, 0x01, 
+            0x00, 0x24, 0x01, 0x26, 0x5C, 0x6E, 0x26, 0x01, 0x00, 0x19, 0x01, 0x00, 
+            0xE9, 0x0A, 0x50, 0x22, 0x46, 0x41, 0x49, 0x4C, 0x0D, 0x00, 0x02, 0x3E, 
+            0x01, 0x37, 0x5D, 0x22, 0x29, 0x27, 0x01, 0x00, 0x02, 0x00, 0xA7, 0x69, 
+            0x66, 0x20, 0x56, 0x45, 0x52, 0x42, 0x4F, 0x53, 0x45, 0xC3, 0x05, 0x04, 
+            0x02, 0x00, 0x03, 0x66, 0x00, 0x02, 0x3C, 0x00, 0x04, 0x15, 0x00, 0x00, 
+            0x02, 0x00, 0x00, 0x93, 0x07, 0x00, 0xD6, 0x00, 0xC6, 0x5B, 0x22, 0x73, 
+            0x6F, 0x75, 0x72, 0x63, 0x65, 0x22, 0x5D, 0x7D, 0x3A, 0x14, 0x00, 0x31, 
+            0x6C, 0x69, 0x6E, 0x12, 0x00, 0x01, 0xBA, 0x07, 0x00, 0x27, 0x00, 0x3D, 
+            0x7D, 0x5C, 0x6E, 0x79, 0x00, 0x06, 0xEB, 0x03, 0x00, 0x02, 0x00, 0x00, 
+            0x0C, 0x03, 0x05, 0x27, 0x03, 0x46, 0x2B, 0x3D, 0x20, 0x31, 0x0C, 0x01, 
+            0x00, 0x02, 0x00, 0x0F, 0x03, 0x04, 0x1E, 0x04, 0x02, 0x00, 0x86, 0x63, 
+            0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65, 0x4F, 0x00, 0x07, 0x59, 0x04, 
+            0x00, 0xCB, 0x01, 0x10, 0x68, 0x36, 0x06, 0x01, 0x87, 0x08, 0x01, 0xF5, 
+            0x06, 0x10, 0x5F, 0xFE, 0x03, 0x00, 0x47, 0x08, 0x47, 0x61, 0x6C, 0x73, 
+            0x65, 0xC9, 0x01, 0x00, 0xB0, 0x03, 0x00, 0xD9, 0x04, 0x0F, 0x3C, 0x05, 
+            0x65, 0x00, 0xAB, 0x00, 0x02, 0x4C, 0x01, 0x03, 0xF0, 0x06, 0x02, 0x83, 
+            0x02, 0x09, 0x74, 0x05, 0x00, 0xE9, 0x02, 0x04, 0xF8, 0x00, 0x04, 0x02, 
+            0x00, 0x0F, 0x49, 0x02, 0x0E, 0x04, 0x02, 0x00, 0x00, 0xB6, 0x07, 0x0F, 
+            0x0C, 0x01, 0x02, 0x02, 0x55, 0x0D, 0x0F, 0x02, 0x00, 0x01, 0x03, 0x1E, 
+            0x02, 0x0F, 0x84, 0x02, 0x2F, 0x04, 0x02, 0x00, 0x0A, 0x13, 0x02, 0x04, 
+            0x02, 0x00, 0x0F, 0x96, 0x00, 0x02, 0x00, 0x4E, 0x03, 0x08, 0xD6, 0x01, 
+            0x08, 0x02, 0x00, 0x00, 0xC3, 0x01, 0x0F, 0x4C, 0x02, 0x08, 0x04, 0x02, 
+            0x00, 0x04, 0xBF, 0x00, 0x04, 0x10, 0x00, 0x00, 0x02, 0x00, 0x03, 0x45, 
+            0x03, 0x01, 0x3A, 0x03, 0x50, 0xC3, 0x97, 0x20, 0x24, 0x7B, 0xF4, 0x01, 
+            0x3D, 0x7D, 0x28, 0x29, 0xBE, 0x02, 0x04, 0x02, 0x00, 0x0F, 0x3F, 0x03, 
+            0x0A, 0x04, 0x02, 0x00, 0x03, 0x6A, 0x00, 0x0E, 0x47, 0x03, 0x0F, 0x49, 
+            0x03, 0x32, 0x04, 0x02, 0x00, 0x0E, 0x3E, 0x01, 0x6F, 0x7D, 0x20, 0x65, 
+            0x6C, 0x73, 0x65, 0xD8, 0x03, 0x00, 0x00, 0x02, 0x00, 0x02, 0x26, 0x01, 
+            0x03, 0xB3, 0x06, 0x0E, 0x72, 0x03, 0x00, 0x02, 0x00, 0x0A, 0x52, 0x00, 
+            0x06, 0x0E, 0x00, 0x07, 0x43, 0x03, 0x2F, 0x69, 0x66, 0xA0, 0x01, 0x03, 
+            0x0A, 0x36, 0x02, 0x0F, 0xDE, 0x03, 0x08, 0x0F, 0xA4, 0x00, 0x02, 0x02, 
+            0x30, 0x00, 0x0F, 0x9C, 0x00, 0x06, 0x03, 0x50, 0x01, 0x0F, 0x79, 0x02, 
+            0x0A, 0x01, 0x05, 0x0E, 0x6F, 0x28, 0x22, 0x50, 0x41, 0x53, 0x53, 0xFF, 
+            0x04, 0x05, 0x07, 0xC7, 0x00, 0x0F, 0x60, 0x04, 0x1E, 0x03, 0x3C, 0x00, 
+            0x01, 0x97, 0x03, 0x2B, 0x75, 0x6E, 0x4C, 0x08, 0x27, 0x20, 0x2D, 0x64, 
+            0x08, 0x03, 0x45, 0x04, 0x21, 0x69, 0x66, 0xA9, 0x06, 0x05, 0x98, 0x02, 
+            0x37, 0x3E, 0x20, 0x30, 0x99, 0x01, 0x05, 0xD2, 0x00, 0x10, 0x6E, 0x84, 
+            0x02, 0x22, 0x20, 0x20, 0x84, 0x02, 0x00, 0xC4, 0x0E, 0x20, 0x22, 0x20, 
+            0xC2, 0x05, 0x15, 0x20, 0x81, 0x02, 0x0D, 0x30, 0x01, 0x0F, 0x3B, 0x00, 
+            0x00, 0x01, 0xFC, 0x00, 0x02, 0x3D, 0x00, 0x00, 0x00, 0x01, 0x07, 0x3D, 
+            0x00, 0x02, 0x36, 0x0D, 0x04, 0x33, 0x00, 0x30, 0x20, 0x20, 0x46, 0x9E, 
+            0x08, 0x51, 0x3A, 0x20, 0x7B, 0x7D, 0x2F, 0x63, 0x07, 0x08, 0x78, 0x01, 
+            0x0A, 0x0E, 0x00, 0x29, 0x20, 0x2B, 0xBF, 0x00, 0x03, 0x45, 0x06, 0x05, 
+            0x49, 0x00, 0x78, 0xC2, 0xB7, 0x20, 0x46, 0x75, 0x6E, 0x63, 0x4B, 0x00, 
+            0x00, 0x0F, 0x00, 0x03, 0xC3, 0x01, 0x0A, 0x0E, 0x00, 0x00, 0x4B, 0x00, 
+            0x01, 0x1D, 0x00, 0x02, 0x15, 0x09, 0x0F, 0x4B, 0x00, 0x00, 0x40, 0x54, 
+            0x69, 0x6D, 0x65, 0x4A, 0x00, 0x51, 0x20, 0x73, 0x65, 0x63, 0x73, 0xD6, 
+            0x06, 0x03, 0x64, 0x01, 0x04, 0xCE, 0x0A, 0x0F, 0x4D, 0x01, 0x0C, 0x01, 
+            0x64, 0x0E, 0x13, 0x31, 0x59, 0x00, 0x01, 0x0D, 0x0A, 0x83, 0x69, 0x66, 
+            0x20, 0x44, 0x45, 0x42, 0x55, 0x47, 0x73, 0x01, 0x0F, 0xE3, 0x0C, 0x06, 
+            0x29, 0x3B, 0x0A, 0x60, 0x01, 0x05, 0x28, 0x00, 0x60, 0x28, 0x29, 0x3B, 
+            0x0A, 0x7D, 0x0A, 
+        },
+        1779,
+        4788,
+    },
+    {
+        "std/cli/time.pyro",
+        (const uint8_t[]){
+            0xF1, 0x15, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x73, 0x74, 0x64, 
+            0x3A, 0x3A, 0x66, 0x73, 0x3B, 0x0A, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x69, 
+            0x6E, 0x69, 0x74, 0x5F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x3D, 
+            0x20, 0x22, 0x14, 0x00, 0xF4, 0x09, 0x24, 0x66, 0x69, 0x6C, 0x65, 0x70, 
+            0x61, 0x74, 0x68, 0x3B, 0x0A, 0x0A, 0x70, 0x75, 0x62, 0x20, 0x64, 0x65, 
+            0x66, 0x20, 0x73, 0x65, 0x74, 0x5F, 0x17, 0x00, 0x14, 0x28, 0x09, 0x00, 
+            0x76, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x31, 0x00, 0x34, 0x20, 
+            0x3D, 0x20, 0x1C, 0x00, 0x80, 0x3B, 0x0A, 0x7D, 0x0A, 0x22, 0x3B, 0x0A, 
+            0x0A, 0x3D, 0x00, 0xBD, 0x6D, 0x61, 0x6B, 0x65, 0x5F, 0x6D, 0x6F, 0x64, 
+            0x75, 0x6C, 0x65, 0x3C, 0x00, 0x00, 0x85, 0x00, 0x02, 0x1B, 0x00, 0x97, 
+            0x20, 0x3D, 0x20, 0x24, 0x65, 0x78, 0x65, 0x63, 0x28, 0x94, 0x00, 0x21, 
+            0x29, 0x3B, 0x61, 0x00, 0x02, 0x21, 0x00, 0x2F, 0x3A, 0x3A, 0x86, 0x00, 
+            0x03, 0x02, 0x24, 0x00, 0x63, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x2B, 
+            0x00, 0x00, 0x7E, 0x00, 0x01, 0x7B, 0x00, 0x42, 0x61, 0x64, 0x64, 0x5F, 
+            0xF9, 0x00, 0xC0, 0x5F, 0x72, 0x6F, 0x6F, 0x74, 0x73, 0x5F, 0x66, 0x72, 
+            0x6F, 0x6D, 0x5F, 0xDD, 0x00, 0x0F, 0x8A, 0x00, 0x02, 0x72, 0x73, 0x74, 
+            0x61, 0x73, 0x68, 0x65, 0x64, 0x2C, 0x00, 0x00, 0x91, 0x00, 0x01, 0x35, 
+            0x00, 0x91, 0x3A, 0x63, 0x6F, 0x70, 0x79, 0x28, 0x29, 0x3B, 0x0A, 0x8D, 
+            0x00, 0x00, 0xB2, 0x00, 0x41, 0x72, 0x65, 0x61, 0x6C, 0x46, 0x00, 0xB0, 
+            0x20, 0x3D, 0x20, 0x74, 0x72, 0x79, 0x20, 0x66, 0x73, 0x3A, 0x3A, 0x14, 
+            0x00, 0x0A, 0x59, 0x00, 0x02, 0x99, 0x00, 0xB0, 0x69, 0x66, 0x20, 0x24, 
+            0x69, 0x73, 0x5F, 0x65, 0x72, 0x72, 0x28, 0x23, 0x00, 0x01, 0x37, 0x00, 
+            0x04, 0x3A, 0x01, 0x00, 0x02, 0x00, 0xF0, 0x11, 0x24, 0x65, 0x78, 0x69, 
+            0x74, 0x28, 0x22, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x3A, 0x20, 0x66, 0x61, 
+            0x69, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x73, 0x6F, 
+            0x6C, 0x76, 0x65, 0x20, 0x54, 0x00, 0x44, 0x20, 0x27, 0x24, 0x7B, 0x5A, 
+            0x01, 0x65, 0x7D, 0x27, 0x3A, 0x20, 0x24, 0x7B, 0x4B, 0x00, 0x23, 0x7D, 
+            0x22, 0x25, 0x01, 0x16, 0x7D, 0x9F, 0x00, 0x61, 0x70, 0x61, 0x72, 0x65, 
+            0x6E, 0x74, 0x6A, 0x00, 0x00, 0x93, 0x01, 0xA7, 0x73, 0x3A, 0x3A, 0x64, 
+            0x69, 0x72, 0x6E, 0x61, 0x6D, 0x65, 0x82, 0x00, 0x02, 0x9D, 0x00, 0x00, 
+            0xCD, 0x00, 0x02, 0x33, 0x01, 0x18, 0x73, 0x2F, 0x00, 0x57, 0x6A, 0x6F, 
+            0x69, 0x6E, 0x28, 0x46, 0x00, 0x33, 0x2C, 0x20, 0x22, 0x26, 0x00, 0x00, 
+            0x6E, 0x00, 0x01, 0x07, 0x01, 0x03, 0x1B, 0x01, 0x68, 0x61, 0x70, 0x70, 
+            0x65, 0x6E, 0x64, 0x2C, 0x00, 0x03, 0x8F, 0x00, 0x0A, 0x20, 0x00, 0x03, 
+            0x3E, 0x00, 0x01, 0x64, 0x00, 0x04, 0x49, 0x01, 0x03, 0xB2, 0x01, 0x09, 
+            0x74, 0x01, 0x05, 0xB9, 0x01, 0x84, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 
+            0x65, 0x5F, 0x1E, 0x00, 0x08, 0xC5, 0x01, 0x14, 0x28, 0x15, 0x00, 0x01, 
+            0x83, 0x00, 0x04, 0x4C, 0x01, 0x03, 0x71, 0x00, 0x55, 0x63, 0x6C, 0x65, 
+            0x61, 0x72, 0xAD, 0x01, 0x40, 0x66, 0x6F, 0x72, 0x20, 0x26, 0x00, 0x2B, 
+            0x20, 0x69, 0x69, 0x00, 0x03, 0xBB, 0x02, 0x00, 0x02, 0x00, 0x03, 0x39, 
+            0x00, 0x03, 0xCA, 0x00, 0x00, 0x2E, 0x00, 0x03, 0xC3, 0x00, 0x14, 0x7D, 
+            0x46, 0x02, 0xD1, 0x74, 0x69, 0x6D, 0x65, 0x5F, 0x66, 0x75, 0x6E, 0x63, 
+            0x74, 0x69, 0x6F, 0x6E, 0x39, 0x02, 0x10, 0x5F, 0x4E, 0x01, 0x20, 0x2C, 
+            0x20, 0x14, 0x00, 0x07, 0x0B, 0x00, 0xA4, 0x2C, 0x20, 0x69, 0x73, 0x5F, 
+            0x66, 0x69, 0x72, 0x73, 0x74, 0x95, 0x00, 0x44, 0x69, 0x66, 0x20, 0x21, 
+            0x14, 0x00, 0x07, 0x73, 0x00, 0x42, 0x65, 0x63, 0x68, 0x6F, 0x81, 0x01, 
+            0x03, 0xB6, 0x01, 0x00, 0x11, 0x00, 0x01, 0x3C, 0x03, 0x03, 0x4E, 0x00, 
+            0x47, 0x22, 0x3A, 0x3A, 0x22, 0x5F, 0x00, 0x02, 0x2C, 0x00, 0x00, 0xAD, 
+            0x01, 0x00, 0x8B, 0x00, 0x63, 0x73, 0x20, 0x3D, 0x20, 0x5B, 0x5D, 0x88, 
+            0x01, 0x00, 0xE2, 0x00, 0x10, 0x69, 0xDF, 0x00, 0xF4, 0x00, 0x24, 0x72, 
+            0x61, 0x6E, 0x67, 0x65, 0x28, 0x4E, 0x55, 0x4D, 0x5F, 0x52, 0x55, 0x4E, 
+            0x53, 0x82, 0x00, 0x00, 0x02, 0x00, 0x00, 0x39, 0x00, 0x60, 0x73, 0x74, 
+            0x61, 0x72, 0x74, 0x5F, 0x3F, 0x00, 0x00, 0xD8, 0x02, 0x50, 0x63, 0x6C, 
+            0x6F, 0x63, 0x6B, 0x26, 0x01, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x00, 0x00, 
+            0x23, 0x00, 0x50, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x08, 0x04, 0x01, 0xD3, 
+            0x02, 0x3C, 0x75, 0x6E, 0x63, 0x21, 0x00, 0x3E, 0x65, 0x6E, 0x64, 0x42, 
+            0x00, 0x01, 0x0E, 0x02, 0x00, 0x02, 0x00, 0x09, 0xE9, 0x02, 0x00, 0x4A, 
+            0x00, 0x08, 0x83, 0x00, 0x00, 0x02, 0x00, 0x03, 0xEA, 0x02, 0x00, 0x0B, 
+            0x00, 0x03, 0xEE, 0x02, 0x00, 0xC8, 0x02, 0x00, 0x2A, 0x00, 0x05, 0xC5, 
+            0x02, 0x00, 0x02, 0x00, 0x03, 0x13, 0x01, 0x00, 0x02, 0x00, 0x00, 0xAF, 
+            0x00, 0x05, 0x9A, 0x01, 0x05, 0x7E, 0x00, 0x17, 0x2D, 0xCD, 0x00, 0x05, 
+            0xAB, 0x01, 0x01, 0x87, 0x00, 0x00, 0xC6, 0x00, 0x41, 0x6D, 0x65, 0x61, 
+            0x6E, 0xA6, 0x00, 0x10, 0x5F, 0x28, 0x01, 0x02, 0x42, 0x00, 0xE3, 0x69, 
+            0x74, 0x65, 0x72, 0x28, 0x29, 0x3A, 0x73, 0x75, 0x6D, 0x28, 0x29, 0x20, 
+            0x2F, 0x15, 0x00, 0x50, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0xE3, 0x00, 0x01, 
+            0x3B, 0x00, 0x29, 0x69, 0x66, 0x3A, 0x00, 0x6B, 0x3E, 0x3D, 0x20, 0x31, 
+            0x2E, 0x30, 0xB3, 0x01, 0x20, 0x20, 0x22, 0x95, 0x00, 0x00, 0x27, 0x00, 
+            0x00, 0xBB, 0x00, 0x00, 0x08, 0x00, 0x03, 0x69, 0x00, 0x86, 0x3B, 0x2E, 
+            0x33, 0x66, 0x7D, 0x20, 0x73, 0x22, 0x50, 0x01, 0x02, 0xDD, 0x02, 0x02, 
+            0x10, 0x00, 0x03, 0x9D, 0x00, 0x0E, 0x62, 0x00, 0x57, 0x30, 0x2E, 0x30, 
+            0x30, 0x31, 0x64, 0x00, 0x37, 0x6C, 0x65, 0x74, 0x85, 0x00, 0x10, 0x6D, 
+            0xC0, 0x00, 0x07, 0x65, 0x00, 0x82, 0x20, 0x2A, 0x20, 0x31, 0x5F, 0x30, 
+            0x30, 0x30, 0x55, 0x00, 0x00, 0x02, 0x00, 0x01, 0x36, 0x02, 0x0F, 0x94, 
+            0x00, 0x04, 0x13, 0x6D, 0x95, 0x00, 0x1F, 0x6D, 0x96, 0x00, 0x22, 0x2F, 
+            0x30, 0x5F, 0x9A, 0x00, 0x09, 0x1F, 0x75, 0x9A, 0x00, 0x04, 0x0F, 0x9E, 
+            0x00, 0x17, 0x13, 0x75, 0x9E, 0x00, 0x1F, 0x75, 0x9E, 0x00, 0x0C, 0x0A, 
+            0x12, 0x01, 0x1F, 0x6E, 0x78, 0x00, 0x08, 0x06, 0x7C, 0x00, 0x0F, 0x16, 
+            0x01, 0x09, 0x90, 0x6E, 0x73, 0x3B, 0x2E, 0x30, 0x66, 0x7D, 0x20, 0x6E, 
+            0x78, 0x00, 0x64, 0x7D, 0x0A, 0x0A, 0x69, 0x66, 0x20, 0x31, 0x03, 0x34, 
+            0x20, 0x3C, 0x20, 0x8C, 0x01, 0x03, 0xA9, 0x02, 0x03, 0xA5, 0x02, 0xD1, 
+            0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x6C, 0x75, 
+            0x65, 0x70, 0x03, 0xF1, 0x04, 0x2D, 0x2D, 0x6E, 0x75, 0x6D, 0x2D, 0x72, 
+            0x75, 0x6E, 0x73, 0x2C, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 
+            0x31, 0x02, 0x00, 0x1D, 0x05, 0x13, 0x7D, 0x59, 0x07, 0x03, 0x09, 0x04, 
+            0x01, 0x21, 0x06, 0x50, 0x75, 0x65, 0x3B, 0x0A, 0x0A, 0x39, 0x00, 0x04, 
+            0xC4, 0x05, 0x01, 0xB0, 0x03, 0x43, 0x61, 0x72, 0x67, 0x73, 0xFD, 0x01, 
+            0x00, 0x27, 0x04, 0x00, 0x44, 0x06, 0x01, 0x2B, 0x04, 0x0F, 0x26, 0x07, 
+            0x00, 0x00, 0x02, 0x00, 0x0F, 0x95, 0x00, 0x03, 0x0E, 0x1E, 0x06, 0x00, 
+            0x85, 0x00, 0x00, 0x30, 0x00, 0x03, 0x76, 0x02, 0x00, 0x13, 0x03, 0x41, 
+            0x63, 0x6F, 0x64, 0x65, 0x89, 0x00, 0x71, 0x79, 0x20, 0x24, 0x72, 0x65, 
+            0x61, 0x64, 0xCB, 0x07, 0x01, 0xC8, 0x04, 0x00, 0x3F, 0x00, 0x03, 0x43, 
+            0x03, 0x07, 0xBF, 0x03, 0x00, 0x30, 0x00, 0x08, 0xBD, 0x03, 0x0A, 0x7B, 
+            0x00, 0x08, 0xA3, 0x06, 0x21, 0x61, 0x64, 0xB6, 0x04, 0x0E, 0xA0, 0x06, 
+            0x00, 0x43, 0x00, 0x05, 0xD6, 0x03, 0x07, 0x8B, 0x00, 0x09, 0xBB, 0x05, 
+            0x2F, 0x20, 0x3D, 0xA1, 0x07, 0x12, 0x03, 0xA2, 0x03, 0x00, 0xCA, 0x00, 
+            0x02, 0x48, 0x06, 0x2F, 0x20, 0x3D, 0x54, 0x08, 0x03, 0x02, 0xF9, 0x00, 
+            0x00, 0x28, 0x00, 0x02, 0x57, 0x04, 0x04, 0xF4, 0x00, 0x01, 0x57, 0x08, 
+            0x00, 0x92, 0x00, 0x11, 0x2C, 0xAE, 0x00, 0x00, 0xF5, 0x00, 0x13, 0x2C, 
+            0x2A, 0x08, 0x0E, 0xFD, 0x00, 0x02, 0x3B, 0x00, 0x0F, 0xFF, 0x00, 0x11, 
+            0x00, 0x57, 0x00, 0x31, 0x75, 0x74, 0x65, 0x54, 0x00, 0x0E, 0x02, 0x01, 
+            0x02, 0x48, 0x00, 0x0C, 0x04, 0x01, 0x00, 0x06, 0x02, 0x00, 0x3C, 0x06, 
+            0x00, 0x02, 0x02, 0x02, 0xCD, 0x00, 0xD8, 0x3A, 0x61, 0x6C, 0x6C, 0x5F, 
+            0x6D, 0x65, 0x6D, 0x62, 0x65, 0x72, 0x73, 0x28, 0x77, 0x00, 0x21, 0x69, 
+            0x66, 0x2A, 0x00, 0x11, 0x3A, 0xED, 0x04, 0x90, 0x73, 0x5F, 0x77, 0x69, 
+            0x74, 0x68, 0x28, 0x22, 0x24, 0xBC, 0x04, 0x61, 0x5F, 0x22, 0x29, 0x20, 
+            0x26, 0x26, 0x57, 0x08, 0x00, 0x82, 0x06, 0x13, 0x28, 0x49, 0x00, 0x02, 
+            0x45, 0x00, 0x10, 0x28, 0x35, 0x00, 0x18, 0x29, 0x49, 0x00, 0x00, 0x02, 
+            0x00, 0x01, 0x37, 0x00, 0x00, 0x2D, 0x00, 0x05, 0xC3, 0x06, 0x02, 0x06, 
+            0x01, 0x00, 0x2D, 0x00, 0x04, 0x0C, 0x01, 0x09, 0x41, 0x00, 0x07, 0xCC, 
+            0x06, 0x02, 0x57, 0x01, 0x04, 0x02, 0x00, 0x01, 0xA4, 0x02, 0x02, 0xDA, 
+            0x02, 0x56, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x1E, 0x00, 0x11, 0x7D, 0x49, 
+            0x05, 0x03, 0xED, 0x01, 0x0F, 0xC1, 0x07, 0x17, 0x50, 0x29, 0x3B, 0x0A, 
+            0x7D, 0x0A, 
+        },
+        1346,
+        2718,
+    },
+    {
+        "std/cli/bake.pyro",
+        (const uint8_t[]){
+            0xF8, 0x01, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x73, 0x74, 0x64, 
+            0x3A, 0x3A, 0x66, 0x73, 0x3B, 0x0A, 0x10, 0x00, 0x3A, 0x63, 0x6D, 0x64, 
+            0x11, 0x00, 0xF2, 0x24, 0x6C, 0x6F, 0x67, 0x3B, 0x0A, 0x0A, 0x69, 0x66, 
+            0x20, 0x21, 0x66, 0x73, 0x3A, 0x3A, 0x69, 0x73, 0x5F, 0x66, 0x69, 0x6C, 
+            0x65, 0x28, 0x53, 0x43, 0x52, 0x49, 0x50, 0x54, 0x29, 0x20, 0x7B, 0x0A, 
+            0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x67, 0x3A, 0x3A, 0x66, 0x61, 0x74, 
+            0x61, 0x6C, 0x28, 0x22, 0x27, 0x24, 0x7B, 0x1D, 0x00, 0xC0, 0x7D, 0x27, 
+            0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x34, 0x00, 
+            0xF0, 0x0A, 0x22, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x6C, 0x65, 0x74, 
+            0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x5F, 0x70, 0x61, 0x74, 0x68, 
+            0x20, 0x3D, 0x20, 0x58, 0x00, 0x30, 0x61, 0x62, 0x73, 0x0E, 0x00, 0x04, 
+            0x58, 0x00, 0x11, 0x3B, 0x27, 0x00, 0x78, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 
+            0x65, 0x73, 0x28, 0x00, 0x50, 0x6A, 0x6F, 0x69, 0x6E, 0x28, 0x31, 0x00, 
+            0x87, 0x64, 0x69, 0x72, 0x6E, 0x61, 0x6D, 0x65, 0x28, 0x4B, 0x00, 0x43, 
+            0x29, 0x2C, 0x20, 0x22, 0x33, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x69, 0x00, 
+            0x54, 0x65, 0x6D, 0x62, 0x65, 0x64, 0x40, 0x00, 0xF0, 0x01, 0x69, 0x66, 
+            0x20, 0x45, 0x4D, 0x42, 0x45, 0x44, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x22, 
+            0x20, 0x7B, 0x05, 0x00, 0x89, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 
+            0x7B, 0x85, 0x00, 0x01, 0x26, 0x00, 0x42, 0x29, 0x20, 0x7D, 0x3B, 0xAE, 
+            0x00, 0x55, 0x6F, 0x75, 0x74, 0x70, 0x75, 0xAE, 0x00, 0x94, 0x69, 0x66, 
+            0x20, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x47, 0x00, 0x01, 0x02, 0x01, 
+            0x00, 0x93, 0x00, 0x04, 0xC4, 0x00, 0x00, 0x0C, 0x00, 0x4D, 0x62, 0x61, 
+            0x73, 0x65, 0xA0, 0x00, 0xF4, 0x09, 0x3A, 0x73, 0x74, 0x72, 0x69, 0x70, 
+            0x5F, 0x73, 0x75, 0x66, 0x66, 0x69, 0x78, 0x28, 0x22, 0x2E, 0x70, 0x79, 
+            0x72, 0x6F, 0x22, 0x29, 0x29, 0x0A, 0x85, 0x00, 0x0D, 0x4A, 0x00, 0x02, 
+            0x69, 0x00, 0x21, 0x29, 0x0A, 0x8A, 0x00, 0x00, 0x64, 0x01, 0xF7, 0x08, 
+            0x69, 0x6E, 0x66, 0x6F, 0x28, 0x22, 0x62, 0x61, 0x6B, 0x69, 0x6E, 0x67, 
+            0x20, 0x62, 0x69, 0x6E, 0x61, 0x72, 0x79, 0x3A, 0x20, 0x24, 0x7B, 0xA2, 
+            0x00, 0x10, 0x7D, 0xFB, 0x00, 0x01, 0x3E, 0x01, 0x74, 0x68, 0x6F, 0x6D, 
+            0x65, 0x64, 0x69, 0x72, 0xFE, 0x00, 0xA0, 0x24, 0x65, 0x6E, 0x76, 0x28, 
+            0x22, 0x48, 0x4F, 0x4D, 0x45, 0x22, 0x00, 0xB8, 0x69, 0x66, 0x20, 0x24, 
+            0x69, 0x73, 0x5F, 0x65, 0x72, 0x72, 0x28, 0x28, 0x00, 0x0F, 0xD1, 0x01, 
+            0x01, 0xF0, 0x04, 0x66, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 
+            0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x46, 0x00, 
+            0xF9, 0x04, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 
+            0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0xE4, 0x01, 0x47, 
+            0x72, 0x65, 0x70, 0x6F, 0x7F, 0x00, 0x00, 0x15, 0x01, 0x01, 0xBD, 0x01, 
+            0x08, 0x6F, 0x00, 0xD1, 0x2C, 0x20, 0x22, 0x2E, 0x63, 0x61, 0x63, 0x68, 
+            0x65, 0x22, 0x2C, 0x20, 0x22, 0x0E, 0x01, 0x30, 0x2C, 0x20, 0x22, 0x39, 
+            0x00, 0x00, 0xA3, 0x00, 0x00, 0xC0, 0x01, 0x4F, 0x77, 0x6F, 0x72, 0x6B, 
+            0x45, 0x00, 0x22, 0x00, 0x39, 0x00, 0x00, 0x45, 0x00, 0x00, 0xB9, 0x02, 
+            0x83, 0x4E, 0x4F, 0x5F, 0x43, 0x41, 0x43, 0x48, 0x45, 0x61, 0x01, 0x30, 
+            0x69, 0x66, 0x20, 0x5B, 0x00, 0xF0, 0x06, 0x72, 0x65, 0x73, 0x75, 0x6C, 
+            0x74, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x79, 0x20, 0x63, 0x6D, 0x64, 0x3A, 
+            0x3A, 0x72, 0x6D, 0x28, 0x7C, 0x00, 0x04, 0x70, 0x00, 0x25, 0x29, 0x3B, 
+            0x23, 0x01, 0x02, 0x2C, 0x00, 0x04, 0x1D, 0x01, 0x00, 0x02, 0x00, 0x08, 
+            0xF2, 0x02, 0x06, 0x21, 0x01, 0xA8, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 
+            0x20, 0x27, 0x24, 0x7B, 0x49, 0x00, 0x20, 0x7D, 0x27, 0xA4, 0x01, 0x02, 
+            0x44, 0x00, 0x01, 0x9F, 0x01, 0x00, 0x41, 0x00, 0x39, 0x7D, 0x0A, 0x7D, 
+            0x56, 0x03, 0x20, 0x64, 0x69, 0x67, 0x00, 0x07, 0x7E, 0x00, 0x03, 0xAE, 
+            0x00, 0x01, 0x69, 0x00, 0x02, 0xF7, 0x01, 0x40, 0x63, 0x6C, 0x6F, 0x6E, 
+            0xF8, 0x01, 0x00, 0x27, 0x00, 0x42, 0x73, 0x69, 0x74, 0x6F, 0xFC, 0x01, 
+            0x95, 0x50, 0x59, 0x52, 0x4F, 0x5F, 0x52, 0x45, 0x50, 0x4F, 0x5B, 0x00, 
+            0x0F, 0xE1, 0x00, 0x06, 0x32, 0x67, 0x69, 0x74, 0x46, 0x00, 0x00, 0x70, 
+            0x01, 0x05, 0x38, 0x00, 0x11, 0x2C, 0x51, 0x00, 0x0F, 0xF6, 0x00, 0x28, 
+            0x00, 0x98, 0x00, 0x11, 0x65, 0x45, 0x00, 0x06, 0x96, 0x00, 0x0F, 0xEE, 
+            0x00, 0x04, 0x0D, 0x79, 0x01, 0x00, 0x17, 0x02, 0x2D, 0x63, 0x68, 0xFD, 
+            0x00, 0x0F, 0x7B, 0x01, 0x05, 0x01, 0x0E, 0x01, 0x03, 0x69, 0x04, 0x06, 
+            0x77, 0x01, 0x70, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0xF4, 0x01, 
+            0x00, 0x20, 0x01, 0x50, 0x64, 0x69, 0x72, 0x65, 0x63, 0x1F, 0x01, 0x32, 
+            0x20, 0x74, 0x6F, 0x7A, 0x01, 0x06, 0xDF, 0x00, 0x12, 0x7D, 0x11, 0x00, 
+            0x00, 0xFB, 0x01, 0x01, 0x30, 0x01, 0x00, 0x91, 0x04, 0x06, 0x59, 0x03, 
+            0x50, 0x75, 0x70, 0x64, 0x61, 0x74, 0x43, 0x00, 0x00, 0x33, 0x00, 0x06, 
+            0xCD, 0x00, 0x05, 0x2B, 0x01, 0x01, 0x33, 0x00, 0x0F, 0x5F, 0x01, 0x0C, 
+            0x80, 0x68, 0x65, 0x63, 0x6B, 0x6F, 0x75, 0x74, 0x22, 0x8D, 0x04, 0x6F, 
+            0x61, 0x73, 0x74, 0x65, 0x72, 0x22, 0x49, 0x02, 0x06, 0x0F, 0xCE, 0x00, 
+            0x05, 0x02, 0x42, 0x00, 0x92, 0x20, 0x62, 0x72, 0x61, 0x6E, 0x63, 0x68, 
+            0x20, 0x27, 0x47, 0x00, 0x0C, 0x45, 0x02, 0x10, 0x7D, 0xDB, 0x02, 0x0D, 
+            0x50, 0x01, 0x01, 0xC9, 0x02, 0x01, 0xE8, 0x01, 0x4F, 0x70, 0x75, 0x6C, 
+            0x6C, 0x7B, 0x00, 0x1D, 0x90, 0x72, 0x75, 0x6E, 0x20, 0x27, 0x67, 0x69, 
+            0x74, 0x20, 0x3D, 0x00, 0x4F, 0x27, 0x20, 0x6F, 0x6E, 0x84, 0x00, 0x0E, 
+            0x08, 0x3E, 0x01, 0x01, 0xB9, 0x00, 0x00, 0x3E, 0x01, 0xB0, 0x6F, 0x75, 
+            0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x6F, 0x01, 0x01, 
+            0x3F, 0x01, 0x7F, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4F, 0x4E, 0x42, 0x01, 
+            0x1B, 0x08, 0x3A, 0x00, 0x0F, 0x46, 0x01, 0x25, 0x1B, 0x27, 0x81, 0x00, 
+            0x0E, 0x48, 0x01, 0x0F, 0x49, 0x01, 0x07, 0x30, 0x72, 0x6D, 0x28, 0x55, 
+            0x02, 0x0F, 0x1C, 0x03, 0x0E, 0x0F, 0xC9, 0x01, 0x03, 0x06, 0x0E, 0x04, 
+            0x08, 0x45, 0x00, 0x0D, 0x0E, 0x04, 0x0F, 0x81, 0x00, 0x09, 0x29, 0x63, 
+            0x70, 0x93, 0x04, 0x11, 0x2C, 0xE4, 0x02, 0x0F, 0x8F, 0x00, 0x24, 0x4E, 
+            0x63, 0x6F, 0x70, 0x79, 0x9B, 0x04, 0x30, 0x20, 0x74, 0x6F, 0x15, 0x00, 
+            0x0F, 0xA2, 0x00, 0x21, 0x06, 0xBC, 0x03, 0x08, 0x3E, 0x00, 0x0F, 0xA8, 
+            0x01, 0x1E, 0x0F, 0xBC, 0x03, 0x0A, 0x08, 0x5A, 0x00, 0x0F, 0xBC, 0x03, 
+            0x0B, 0x00, 0xDF, 0x00, 0x00, 0x7D, 0x02, 0x02, 0x11, 0x08, 0x00, 0x78, 
+            0x02, 0x02, 0x0A, 0x00, 0x01, 0x00, 0x07, 0x0F, 0x77, 0x02, 0x0B, 0x28, 
+            0x63, 0x70, 0x47, 0x08, 0x11, 0x2C, 0x0C, 0x08, 0x01, 0x69, 0x08, 0x08, 
+            0x7E, 0x00, 0x31, 0x2C, 0x20, 0x22, 0x4E, 0x08, 0x02, 0xD9, 0x03, 0x24, 
+            0x69, 0x6E, 0xBE, 0x07, 0x0F, 0xAB, 0x04, 0x1C, 0x00, 0x85, 0x01, 0x02, 
+            0x99, 0x00, 0x00, 0xA3, 0x00, 0x0A, 0x8A, 0x04, 0x21, 0x69, 0x66, 0x7B, 
+            0x00, 0x03, 0x0E, 0x06, 0x03, 0xCB, 0x08, 0x01, 0xC0, 0x00, 0x04, 0x7B, 
+            0x06, 0x01, 0x69, 0x02, 0x03, 0x0E, 0x06, 0x03, 0xF0, 0x00, 0x03, 0x27, 
+            0x00, 0x00, 0x4E, 0x00, 0x03, 0x0B, 0x00, 0x01, 0x32, 0x00, 0x01, 0xF2, 
+            0x00, 0x00, 0x69, 0x06, 0x0F, 0xAF, 0x04, 0x06, 0x38, 0x63, 0x70, 0x28, 
+            0x31, 0x00, 0x7F, 0x20, 0x2B, 0x20, 0x22, 0x2F, 0x2E, 0x22, 0xFE, 0x00, 
+            0x0D, 0x0F, 0xF1, 0x00, 0x07, 0x00, 0x02, 0x00, 0x01, 0xA0, 0x00, 0x0E, 
+            0xA0, 0x05, 0x00, 0xF5, 0x00, 0x03, 0x6C, 0x00, 0x00, 0xA8, 0x00, 0x07, 
+            0xF6, 0x00, 0x00, 0x35, 0x00, 0x04, 0x0B, 0x07, 0x01, 0x5F, 0x01, 0x01, 
+            0xBD, 0x00, 0x22, 0x20, 0x21, 0xA2, 0x09, 0x01, 0x11, 0x09, 0x01, 0x54, 
+            0x00, 0x0A, 0xF4, 0x00, 0x00, 0x4F, 0x0A, 0x01, 0x4A, 0x00, 0x06, 0x33, 
+            0x00, 0x01, 0xF0, 0x00, 0x01, 0x30, 0x00, 0x07, 0xAB, 0x0A, 0x00, 0x58, 
+            0x06, 0x06, 0x23, 0x00, 0x04, 0x45, 0x01, 0x00, 0x02, 0x00, 0x01, 0x55, 
+            0x00, 0x03, 0xA9, 0x00, 0x80, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 
+            0x20, 0x81, 0x0A, 0xC6, 0x2C, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 
+            0x65, 0x64, 0x20, 0x61, 0x49, 0x06, 0x0F, 0x6B, 0x00, 0x00, 0x00, 0x45, 
+            0x00, 0x15, 0x7D, 0x71, 0x00, 0x0F, 0x88, 0x05, 0x03, 0x27, 0x63, 0x70, 
+            0x7E, 0x00, 0x0F, 0x60, 0x01, 0x4D, 0x01, 0x6A, 0x00, 0x31, 0x64, 0x65, 
+            0x64, 0x6C, 0x0B, 0x01, 0x1D, 0x01, 0x0F, 0x67, 0x01, 0x01, 0x01, 0xF8, 
+            0x00, 0x04, 0x4D, 0x01, 0x40, 0x6D, 0x70, 0x69, 0x6C, 0x33, 0x03, 0x02, 
+            0x49, 0x0A, 0x00, 0x2F, 0x09, 0x0F, 0x2D, 0x02, 0x06, 0x9F, 0x6D, 0x61, 
+            0x6B, 0x65, 0x28, 0x22, 0x61, 0x70, 0x70, 0x53, 0x06, 0x1D, 0x02, 0x66, 
+            0x00, 0x17, 0x65, 0xAD, 0x0A, 0x07, 0x97, 0x00, 0x0A, 0x40, 0x06, 0x36, 
+            0x6D, 0x6F, 0x76, 0x8E, 0x00, 0x03, 0xBC, 0x07, 0x0C, 0xDA, 0x0A, 0x00, 
+            0x69, 0x01, 0x03, 0x14, 0x00, 0x30, 0x64, 0x69, 0x72, 0xB2, 0x01, 0x03, 
+            0x41, 0x0C, 0x04, 0x10, 0x0C, 0x03, 0x1D, 0x00, 0x00, 0x1A, 0x00, 0x03, 
+            0xFF, 0x09, 0x04, 0xB8, 0x0C, 0x00, 0x0D, 0x02, 0x03, 0x1E, 0x00, 0x03, 
+            0x3B, 0x00, 0x04, 0x11, 0x02, 0x0F, 0xF6, 0x00, 0x07, 0x1F, 0x6B, 0x35, 
+            0x00, 0x00, 0x0F, 0xF1, 0x03, 0x05, 0x00, 0x02, 0x00, 0x01, 0x5F, 0x01, 
+            0x03, 0x57, 0x02, 0x07, 0xA0, 0x08, 0x56, 0x72, 0x65, 0x61, 0x74, 0x65, 
+            0x4F, 0x02, 0x00, 0x71, 0x05, 0x0A, 0x8A, 0x00, 0x0D, 0x15, 0x06, 0x00, 
+            0x4D, 0x00, 0x04, 0x18, 0x03, 0x00, 0xF4, 0x00, 0x02, 0x35, 0x01, 0x08, 
+            0xAE, 0x0A, 0x21, 0x6D, 0x76, 0x08, 0x0D, 0x0F, 0xA8, 0x04, 0x01, 0x52, 
+            0x62, 0x75, 0x69, 0x6C, 0x64, 0x4B, 0x0B, 0x40, 0x6C, 0x65, 0x61, 0x73, 
+            0xEE, 0x09, 0x02, 0xBB, 0x01, 0x23, 0x2C, 0x20, 0x77, 0x00, 0x02, 0x1F, 
+            0x01, 0x0F, 0xE0, 0x0A, 0x04, 0x0F, 0xC5, 0x00, 0x03, 0x3F, 0x6D, 0x6F, 
+            0x76, 0xC6, 0x01, 0x01, 0x50, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 
+        },
+        1486,
+        3665,
+    },
+    {
+        "std/cli/get.pyro",
+        (const uint8_t[]){
+            0xC1, 0x65, 0x63, 0x68, 0x6F, 0x20, 0x22, 0x67, 0x65, 0x74, 0x22, 0x3B, 
+            0x0A, 0x0C, 0x00, 0x70, 0x24, 0x61, 0x72, 0x67, 0x73, 0x3B, 0x0A, 
+        },
+        23,
+        24,
+    },
+    {
+        "std/sendmail.pyro",
+        (const uint8_t[]){
+            0xF5, 0x20, 0x70, 0x75, 0x62, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 
+            0x45, 0x6D, 0x61, 0x69, 0x6C, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+            0x76, 0x61, 0x72, 0x20, 0x74, 0x6F, 0x5F, 0x61, 0x64, 0x64, 0x72, 0x65, 
+            0x73, 0x73, 0x3A, 0x20, 0x73, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x22, 0x22, 
+            0x3B, 0x1E, 0x00, 0x4F, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x00, 0x09, 0x7F, 
+            0x73, 0x75, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x3B, 0x00, 0x01, 0xF6, 0x02, 
+            0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x20, 0x76, 0x65, 0x63, 
+            0x5B, 0x73, 0x74, 0x72, 0x5D, 0x56, 0x00, 0xB1, 0x62, 0x6F, 0x64, 0x79, 
+            0x3A, 0x20, 0x62, 0x75, 0x66, 0x3B, 0x0A, 0x6A, 0x00, 0xB3, 0x64, 0x65, 
+            0x66, 0x20, 0x24, 0x69, 0x6E, 0x69, 0x74, 0x28, 0x29, 0x9A, 0x00, 0x00, 
+            0x02, 0x00, 0x53, 0x73, 0x65, 0x6C, 0x66, 0x2E, 0x46, 0x00, 0x92, 0x20, 
+            0x3D, 0x20, 0x24, 0x76, 0x65, 0x63, 0x28, 0x29, 0x45, 0x00, 0x00, 0x02, 
+            0x00, 0x01, 0x1F, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x1C, 0x00, 0x34, 0x62, 
+            0x75, 0x66, 0x1C, 0x00, 0x17, 0x7D, 0x54, 0x00, 0x39, 0x73, 0x74, 0x72, 
+            0x53, 0x00, 0x00, 0xF1, 0x00, 0x51, 0x6D, 0x73, 0x67, 0x20, 0x3D, 0x3E, 
+            0x00, 0xD4, 0x3A, 0x6D, 0x61, 0x6B, 0x65, 0x5F, 0x6D, 0x65, 0x73, 0x73, 
+            0x61, 0x67, 0x65, 0x3F, 0x00, 0x00, 0x02, 0x00, 0x10, 0x69, 0x8F, 0x00, 
+            0x98, 0x73, 0x5F, 0x65, 0x72, 0x72, 0x28, 0x6D, 0x73, 0x67, 0x94, 0x00, 
+            0x00, 0x02, 0x00, 0xF2, 0x07, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+            0x24, 0x66, 0x6D, 0x74, 0x28, 0x22, 0x3C, 0x69, 0x6E, 0x73, 0x74, 0x61, 
+            0x6E, 0x63, 0x65, 0x59, 0x01, 0x80, 0x3A, 0x20, 0x7B, 0x7D, 0x3E, 0x22, 
+            0x2C, 0x20, 0x37, 0x00, 0x06, 0xAB, 0x00, 0x11, 0x7D, 0xE6, 0x00, 0x00, 
+            0x02, 0x00, 0x03, 0x3C, 0x00, 0x71, 0x6D, 0x73, 0x67, 0x3A, 0x74, 0x6F, 
+            0x5F, 0x9F, 0x00, 0x02, 0x27, 0x00, 0x03, 0xB6, 0x00, 0x00, 0xA8, 0x01, 
+            0x00, 0x0E, 0x01, 0x38, 0x74, 0x6F, 0x28, 0x96, 0x01, 0x42, 0x29, 0x20, 
+            0x2D, 0x3E, 0x61, 0x00, 0x07, 0x20, 0x01, 0x40, 0x69, 0x66, 0x20, 0x21, 
+            0xA7, 0x00, 0x00, 0x46, 0x00, 0x03, 0x2D, 0x00, 0x0C, 0xAB, 0x00, 0xF0, 
+            0x1B, 0x24, 0x70, 0x61, 0x6E, 0x69, 0x63, 0x28, 0x22, 0x74, 0x6F, 0x28, 
+            0x29, 0x3A, 0x20, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x61, 
+            0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x65, 0x78, 0x70, 
+            0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x61, 0xFC, 0x01, 0xD3, 0x69, 0x6E, 
+            0x67, 0x2C, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x24, 0x7B, 0x52, 
+            0x00, 0x57, 0x3B, 0x3F, 0x3F, 0x7D, 0x22, 0x76, 0x01, 0x06, 0xCB, 0x00, 
+            0x00, 0x42, 0x01, 0x16, 0x2E, 0x3E, 0x02, 0x34, 0x20, 0x3D, 0x20, 0x33, 
+            0x00, 0x0C, 0xEE, 0x00, 0x00, 0x2A, 0x00, 0x0F, 0xE6, 0x00, 0x02, 0x00, 
+            0x5E, 0x02, 0x0F, 0xE8, 0x00, 0x3A, 0x01, 0x51, 0x00, 0x0F, 0xEA, 0x00, 
+            0x43, 0x00, 0x5B, 0x00, 0x04, 0x0A, 0x03, 0x0F, 0xEC, 0x00, 0x21, 0x03, 
+            0x2A, 0x03, 0x61, 0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x30, 0x03, 0x0F, 
+            0xD5, 0x01, 0x0E, 0x01, 0x2B, 0x00, 0x0F, 0xD3, 0x01, 0x05, 0x04, 0x50, 
+            0x00, 0x0F, 0xEE, 0x00, 0x1D, 0x01, 0x55, 0x00, 0x0F, 0xD6, 0x01, 0x0C, 
+            0x03, 0x5C, 0x00, 0x32, 0x20, 0x3D, 0x20, 0x2E, 0x00, 0x0F, 0xD1, 0x01, 
+            0x16, 0x42, 0x61, 0x64, 0x64, 0x5F, 0xB2, 0x03, 0x12, 0x28, 0x07, 0x00, 
+            0x0F, 0xE9, 0x00, 0x13, 0x02, 0x2C, 0x00, 0x0F, 0xEA, 0x00, 0x05, 0x07, 
+            0x55, 0x00, 0x0F, 0xED, 0x00, 0x1D, 0x02, 0x59, 0x00, 0x0F, 0xEE, 0x00, 
+            0x0C, 0x02, 0x25, 0x00, 0x83, 0x73, 0x3A, 0x61, 0x70, 0x70, 0x65, 0x6E, 
+            0x64, 0xB9, 0x00, 0x07, 0xF3, 0x02, 0x03, 0xB4, 0x03, 0x0F, 0xC6, 0x02, 
+            0x06, 0xFF, 0x01, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x2A, 0x61, 0x72, 
+            0x67, 0x73, 0x3A, 0x20, 0x61, 0x6E, 0x79, 0xD8, 0x01, 0x02, 0x00, 0x3E, 
+            0x00, 0x01, 0xAE, 0x04, 0x17, 0x3A, 0x2F, 0x00, 0x0F, 0x65, 0x00, 0x18, 
+            0x10, 0x73, 0x9B, 0x00, 0x08, 0x22, 0x01, 0x0F, 0xCB, 0x04, 0x32, 0x04, 
+            0x20, 0x04, 0x02, 0x5E, 0x00, 0x7B, 0x3A, 0x20, 0x24, 0x7B, 0x6D, 0x73, 
+            0x67, 0xF0, 0x03, 0x05, 0xFD, 0x01, 0x00, 0x72, 0x00, 0xF2, 0x02, 0x72, 
+            0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x79, 0x20, 
+            0x24, 0x72, 0x75, 0x6E, 0x3C, 0x00, 0x00, 0x54, 0x06, 0xFC, 0x00, 0x22, 
+            0x2C, 0x20, 0x5B, 0x22, 0x2D, 0x69, 0x22, 0x2C, 0x20, 0x22, 0x2D, 0x74, 
+            0x22, 0x5D, 0x04, 0x05, 0x07, 0x54, 0x05, 0x02, 0x45, 0x00, 0x08, 0xCD, 
+            0x00, 0x00, 0x02, 0x00, 0x0E, 0x8C, 0x00, 0x02, 0x28, 0x00, 0x0F, 0x8F, 
+            0x00, 0x09, 0xF2, 0x0B, 0x28, 0x65, 0x78, 0x69, 0x74, 0x5F, 0x63, 0x6F, 
+            0x64, 0x65, 0x2C, 0x20, 0x5F, 0x2C, 0x20, 0x65, 0x72, 0x72, 0x5F, 0x62, 
+            0x75, 0x66, 0x29, 0x20, 0x3D, 0x20, 0x3C, 0x00, 0x02, 0x76, 0x04, 0x00, 
+            0x02, 0x00, 0x35, 0x69, 0x66, 0x20, 0x2C, 0x00, 0x57, 0x20, 0x21, 0x3D, 
+            0x20, 0x30, 0x49, 0x05, 0x00, 0x02, 0x00, 0x0E, 0x7E, 0x00, 0x03, 0x4D, 
+            0x00, 0x05, 0xA8, 0x05, 0x8B, 0x3A, 0x73, 0x74, 0x72, 0x69, 0x70, 0x28, 
+            0x29, 0x90, 0x00, 0x00, 0x3D, 0x00, 0x03, 0x25, 0x01, 0x00, 0xB9, 0x05, 
+            0x0A, 0x53, 0x06, 0x00, 0xB7, 0x05, 0x77, 0x62, 0x75, 0x66, 0x7C, 0x65, 
+            0x72, 0x72, 0x70, 0x00, 0x10, 0x69, 0xCF, 0x01, 0x0B, 0x3D, 0x05, 0x00, 
+            0x77, 0x07, 0x07, 0x23, 0x00, 0x00, 0x02, 0x00, 0x03, 0x78, 0x02, 0x10, 
+            0x24, 0x87, 0x06, 0x14, 0x22, 0xBC, 0x05, 0x10, 0x65, 0x6B, 0x01, 0xE4, 
+            0x3A, 0x20, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x27, 0x74, 
+            0x6F, 0x27, 0x78, 0x05, 0x0A, 0xA7, 0x05, 0x05, 0xB7, 0x01, 0x04, 0x6E, 
+            0x00, 0x0A, 0xC1, 0x04, 0x0F, 0x70, 0x00, 0x25, 0x00, 0x46, 0x00, 0x0F, 
+            0x72, 0x00, 0x15, 0x05, 0x47, 0x04, 0x0F, 0x6D, 0x00, 0x25, 0x03, 0x41, 
+            0x00, 0x7F, 0x27, 0x20, 0x66, 0x69, 0x65, 0x6C, 0x64, 0xE0, 0x00, 0x04, 
+            0x00, 0x97, 0x02, 0x02, 0xD4, 0x07, 0x04, 0x06, 0x08, 0x05, 0xFB, 0x00, 
+            0x00, 0x67, 0x07, 0x02, 0x6F, 0x03, 0x30, 0x22, 0x54, 0x6F, 0x9B, 0x07, 
+            0x61, 0x5C, 0x72, 0x5C, 0x6E, 0x22, 0x2C, 0xFD, 0x07, 0x07, 0xBB, 0x06, 
+            0x04, 0xDA, 0x01, 0xC0, 0x3A, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 
+            0x28, 0x22, 0x5C, 0x72, 0xC7, 0x02, 0x48, 0x5C, 0x5C, 0x72, 0x22, 0x15, 
+            0x00, 0x00, 0x3B, 0x00, 0x67, 0x22, 0x5C, 0x5C, 0x6E, 0x22, 0x29, 0xB9, 
+            0x03, 0x07, 0x64, 0x00, 0x4C, 0x46, 0x72, 0x6F, 0x6D, 0x66, 0x00, 0x00, 
+            0x30, 0x01, 0x04, 0x37, 0x06, 0x0F, 0x68, 0x00, 0x35, 0x14, 0x53, 0x75, 
+            0x09, 0x0A, 0xD1, 0x00, 0x03, 0x2E, 0x01, 0x0F, 0x66, 0x00, 0x22, 0x05, 
+            0x33, 0x01, 0x24, 0x66, 0x6F, 0xBA, 0x09, 0x22, 0x20, 0x69, 0xF4, 0x04, 
+            0x05, 0x83, 0x09, 0x02, 0x34, 0x0A, 0x04, 0x02, 0x00, 0x32, 0x69, 0x66, 
+            0x20, 0x39, 0x05, 0x00, 0x4E, 0x03, 0x0D, 0xBC, 0x02, 0x00, 0x02, 0x00, 
+            0x07, 0x1A, 0x01, 0x05, 0xA9, 0x00, 0x02, 0x33, 0x00, 0x0F, 0xA3, 0x00, 
+            0x22, 0x00, 0x53, 0x00, 0x04, 0x02, 0x00, 0x02, 0x77, 0x03, 0x00, 0x02, 
+            0x00, 0x07, 0xE9, 0x02, 0x07, 0x70, 0x00, 0x01, 0xE8, 0x01, 0x0F, 0xA5, 
+            0x01, 0x02, 0x10, 0x24, 0x2E, 0x09, 0x01, 0x7E, 0x03, 0x00, 0x8D, 0x05, 
+            0x14, 0x29, 0x8A, 0x00, 0x08, 0x03, 0x01, 0x03, 0x78, 0x03, 0xD0, 0x6D, 
+            0x73, 0x67, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x7D, 0x0A, 
+        },
+        1092,
+        2880,
+    },
+    {
+        "std/pretty.pyro",
+        (const uint8_t[]){
+            0xF4, 0x0E, 0x64, 0x65, 0x66, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x5F, 
+            0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x28, 0x62, 0x75, 0x66, 
+            0x3A, 0x20, 0x62, 0x75, 0x66, 0x2C, 0x20, 0x13, 0x00, 0x15, 0x3A, 0x0A, 
+            0x00, 0x00, 0x14, 0x00, 0xF1, 0x01, 0x64, 0x65, 0x6E, 0x74, 0x3A, 0x20, 
+            0x69, 0x36, 0x34, 0x2C, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x3C, 0x00, 
+            0x05, 0x15, 0x00, 0xF4, 0x04, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 
+            0x20, 0x69, 0x66, 0x20, 0x24, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x28, 
+            0x47, 0x00, 0xE3, 0x29, 0x3A, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x28, 0x29, 
+            0x20, 0x3D, 0x3D, 0x20, 0x30, 0x28, 0x00, 0x00, 0x02, 0x00, 0x00, 0x72, 
+            0x00, 0xC6, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x24, 0x64, 0x65, 0x62, 
+            0x75, 0x67, 0x32, 0x00, 0x21, 0x29, 0x3B, 0x4D, 0x00, 0x00, 0x02, 0x00, 
+            0x62, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x10, 0x00, 0x21, 0x7D, 0x0A, 
+            0x17, 0x00, 0x32, 0x69, 0x66, 0x20, 0x7A, 0x00, 0x0F, 0x51, 0x00, 0x08, 
+            0x4F, 0x74, 0x79, 0x70, 0x65, 0x50, 0x00, 0x02, 0x06, 0x75, 0x00, 0x47, 
+            0x22, 0x20, 0x7B, 0x22, 0x69, 0x00, 0xF2, 0x05, 0x76, 0x61, 0x72, 0x20, 
+            0x69, 0x73, 0x5F, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x3D, 0x20, 0x74, 
+            0x72, 0x75, 0x65, 0x3B, 0x70, 0x00, 0x00, 0x02, 0x00, 0x41, 0x66, 0x6F, 
+            0x72, 0x20, 0xD8, 0x00, 0x8E, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x69, 
+            0x6E, 0xE7, 0x00, 0x07, 0xDA, 0x00, 0x00, 0x02, 0x00, 0x45, 0x69, 0x66, 
+            0x20, 0x21, 0x50, 0x00, 0x02, 0x1D, 0x01, 0x08, 0x02, 0x00, 0x07, 0x88, 
+            0x00, 0x28, 0x2C, 0x20, 0x88, 0x00, 0x00, 0x02, 0x00, 0x11, 0x7D, 0xE8, 
+            0x00, 0x04, 0x02, 0x00, 0x06, 0x2B, 0x00, 0x06, 0x82, 0x00, 0x07, 0xB9, 
+            0x00, 0x00, 0x02, 0x00, 0x06, 0x23, 0x00, 0x2D, 0x22, 0x3A, 0x4E, 0x00, 
+            0x02, 0xE9, 0x01, 0x41, 0x76, 0x61, 0x6C, 0x75, 0xE6, 0x01, 0x13, 0x2C, 
+            0xBB, 0x00, 0x05, 0x1F, 0x01, 0x17, 0x2C, 0xDA, 0x00, 0x7B, 0x29, 0x2C, 
+            0x20, 0x30, 0x2C, 0x20, 0x30, 0x5F, 0x00, 0x05, 0xC8, 0x00, 0x72, 0x3D, 
+            0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x8F, 0x01, 0x00, 0x02, 0x00, 0x03, 
+            0x93, 0x01, 0x00, 0x02, 0x00, 0x07, 0x84, 0x00, 0x18, 0x7D, 0xD1, 0x00, 
+            0x0F, 0xC2, 0x01, 0x00, 0x00, 0x6C, 0x01, 0xFA, 0x01, 0x73, 0x70, 0x61, 
+            0x63, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x22, 0x20, 0x22, 0x20, 0x2A, 0x20, 
+            0x28, 0x55, 0x02, 0x23, 0x20, 0x2B, 0xE4, 0x01, 0x03, 0x8A, 0x00, 0x06, 
+            0x5D, 0x00, 0x0F, 0xDB, 0x01, 0x03, 0x06, 0x20, 0x00, 0x03, 0xD7, 0x01, 
+            0x01, 0x42, 0x01, 0x0F, 0xB6, 0x01, 0x1B, 0x07, 0x44, 0x00, 0x28, 0x5C, 
+            0x6E, 0xC2, 0x00, 0x06, 0x19, 0x00, 0x02, 0xB5, 0x00, 0x03, 0x94, 0x00, 
+            0x00, 0x02, 0x00, 0x06, 0x1B, 0x00, 0x0F, 0x9C, 0x01, 0x02, 0x06, 0x1F, 
+            0x00, 0x0B, 0x98, 0x01, 0x0F, 0x94, 0x01, 0x1C, 0x02, 0xF0, 0x02, 0x0C, 
+            0x7A, 0x03, 0x0C, 0x25, 0x01, 0x03, 0x8D, 0x01, 0x07, 0x75, 0x00, 0x06, 
+            0xC8, 0x00, 0x07, 0x15, 0x00, 0x01, 0x70, 0x01, 0x0A, 0x6F, 0x01, 0x03, 
+            0xD2, 0x00, 0x07, 0x25, 0x00, 0x01, 0xC3, 0x01, 0x46, 0x7D, 0x0A, 0x0A, 
+            0x0A, 0x2B, 0x04, 0x37, 0x6D, 0x61, 0x70, 0x26, 0x04, 0x84, 0x6D, 0x61, 
+            0x70, 0x3A, 0x20, 0x6D, 0x61, 0x70, 0x9D, 0x00, 0x0F, 0x1C, 0x04, 0x12, 
+            0x00, 0x35, 0x00, 0x0F, 0x0E, 0x04, 0x0E, 0x21, 0x22, 0x7B, 0x7D, 0x00, 
+            0x00, 0x5F, 0x01, 0x00, 0x02, 0x00, 0x0F, 0x40, 0x02, 0x00, 0x0F, 0x02, 
+            0x04, 0x10, 0x1F, 0x22, 0xDD, 0x03, 0x1C, 0x61, 0x28, 0x6B, 0x65, 0x79, 
+            0x2C, 0x20, 0x25, 0x03, 0x10, 0x29, 0xDF, 0x03, 0x3F, 0x6D, 0x61, 0x70, 
+            0xD1, 0x03, 0x50, 0x03, 0xF9, 0x04, 0x43, 0x6B, 0x65, 0x79, 0x29, 0x83, 
+            0x01, 0x04, 0x02, 0x00, 0x07, 0x8B, 0x01, 0x2F, 0x20, 0x3D, 0xD3, 0x03, 
+            0x0F, 0x01, 0xB9, 0x00, 0x0F, 0xBC, 0x03, 0x8E, 0x02, 0x95, 0x01, 0x05, 
+            0x9B, 0x03, 0x0F, 0x74, 0x01, 0x0B, 0x07, 0x02, 0x01, 0x06, 0xC7, 0x02, 
+            0x00, 0x02, 0x00, 0x06, 0x19, 0x00, 0x0F, 0x8F, 0x03, 0x08, 0x0F, 0x5A, 
+            0x01, 0x03, 0x06, 0x3B, 0x00, 0x0C, 0x56, 0x01, 0x0D, 0x91, 0x03, 0x03, 
+            0x52, 0x01, 0x0F, 0x7A, 0x03, 0x13, 0x00, 0x02, 0x00, 0x07, 0x5C, 0x00, 
+            0x14, 0x2C, 0x3E, 0x04, 0x0F, 0x92, 0x03, 0x4C, 0x97, 0x63, 0x6F, 0x6E, 
+            0x74, 0x61, 0x69, 0x6E, 0x65, 0x72, 0x98, 0x03, 0x05, 0x14, 0x00, 0xF4, 
+            0x0A, 0x3A, 0x20, 0x76, 0x65, 0x63, 0x7C, 0x74, 0x75, 0x70, 0x7C, 0x73, 
+            0x74, 0x61, 0x63, 0x6B, 0x7C, 0x71, 0x75, 0x65, 0x75, 0x65, 0x7C, 0x73, 
+            0x65, 0x74, 0xD5, 0x00, 0x0F, 0xB2, 0x03, 0x07, 0x51, 0x2C, 0x20, 0x6F, 
+            0x70, 0x65, 0x43, 0x00, 0x93, 0x73, 0x74, 0x72, 0x2C, 0x20, 0x63, 0x6C, 
+            0x6F, 0x73, 0x0D, 0x00, 0x07, 0xE8, 0x07, 0x06, 0x69, 0x00, 0x0F, 0xD2, 
+            0x03, 0x0E, 0x02, 0x4E, 0x00, 0x07, 0xE2, 0x02, 0x06, 0x2C, 0x01, 0x02, 
+            0x5C, 0x00, 0x07, 0x1B, 0x00, 0x0F, 0xEF, 0x03, 0x23, 0x0D, 0x62, 0x00, 
+            0x00, 0x63, 0x06, 0x07, 0xB7, 0x06, 0x0F, 0xCF, 0x07, 0x00, 0x40, 0x69, 
+            0x74, 0x65, 0x6D, 0xEA, 0x03, 0x05, 0xC8, 0x00, 0x0F, 0xF0, 0x03, 0x46, 
+            0x0D, 0x5C, 0x02, 0x00, 0x7B, 0x00, 0x0F, 0xAD, 0x03, 0x31, 0x0F, 0x3D, 
+            0x01, 0x11, 0x00, 0x09, 0x01, 0x02, 0x28, 0x03, 0x00, 0xF2, 0x02, 0x01, 
+            0xFC, 0x05, 0x0F, 0x6C, 0x07, 0x16, 0x05, 0x56, 0x01, 0x05, 0xB3, 0x03, 
+            0x00, 0xBA, 0x00, 0x0F, 0x35, 0x01, 0x05, 0x06, 0xD5, 0x01, 0x0F, 0xB1, 
+            0x03, 0x17, 0x0F, 0x1B, 0x01, 0x04, 0x0F, 0x76, 0x03, 0x76, 0x05, 0x62, 
+            0x01, 0x0A, 0x0B, 0x07, 0x01, 0x1D, 0x04, 0x07, 0x75, 0x03, 0x01, 0x10, 
+            0x00, 0x54, 0x3A, 0x20, 0x61, 0x6E, 0x79, 0xBC, 0x00, 0x0F, 0x5D, 0x03, 
+            0x07, 0x07, 0x43, 0x03, 0x81, 0x24, 0x69, 0x73, 0x5F, 0x76, 0x65, 0x63, 
+            0x28, 0x3F, 0x00, 0x41, 0x29, 0x20, 0x7C, 0x7C, 0x12, 0x00, 0x01, 0xAF, 
+            0x03, 0x0B, 0x14, 0x00, 0x01, 0xBD, 0x03, 0x04, 0x14, 0x00, 0x06, 0x4E, 
+            0x0A, 0x02, 0x3F, 0x01, 0x05, 0xC2, 0x02, 0x00, 0x92, 0x00, 0x03, 0x8D, 
+            0x00, 0x04, 0x88, 0x00, 0x0C, 0x34, 0x08, 0x95, 0x2C, 0x20, 0x22, 0x5B, 
+            0x22, 0x2C, 0x20, 0x22, 0x5D, 0xA3, 0x04, 0x51, 0x20, 0x65, 0x6C, 0x73, 
+            0x65, 0xB9, 0x0B, 0x6F, 0x69, 0x73, 0x5F, 0x74, 0x75, 0x70, 0x66, 0x00, 
+            0x34, 0x02, 0xD8, 0x0A, 0x0F, 0x66, 0x00, 0x03, 0x3F, 0x73, 0x65, 0x74, 
+            0x66, 0x00, 0x34, 0x10, 0x7B, 0xCC, 0x00, 0x1F, 0x7D, 0x66, 0x00, 0x03, 
+            0x00, 0xB0, 0x08, 0x03, 0x5A, 0x01, 0x0C, 0x32, 0x01, 0x00, 0x1B, 0x00, 
+            0x01, 0xEC, 0x0C, 0x01, 0x20, 0x00, 0x0F, 0x2C, 0x01, 0x05, 0x03, 0x96, 
+            0x04, 0x0A, 0x22, 0x01, 0x04, 0xD7, 0x0C, 0x0F, 0xC1, 0x00, 0x05, 0x05, 
+            0x20, 0x00, 0x0F, 0x60, 0x00, 0x1D, 0x06, 0xA4, 0x00, 0x06, 0x49, 0x03, 
+            0x03, 0xC6, 0x06, 0x01, 0xA6, 0x00, 0x04, 0x22, 0x08, 0x11, 0x7D, 0x8C, 
+            0x02, 0x45, 0x70, 0x75, 0x62, 0x20, 0x9B, 0x09, 0x4E, 0x28, 0x61, 0x72, 
+            0x67, 0x7E, 0x02, 0xB4, 0x20, 0x3D, 0x20, 0x34, 0x29, 0x20, 0x2D, 0x3E, 
+            0x20, 0x73, 0x74, 0xDC, 0x04, 0x06, 0x39, 0x09, 0x19, 0x3C, 0x8B, 0x0D, 
+            0x02, 0x70, 0x03, 0x42, 0x20, 0x3D, 0x20, 0x30, 0x78, 0x09, 0x03, 0xB8, 
+            0x06, 0x00, 0x3C, 0x04, 0xB3, 0x62, 0x75, 0x66, 0x20, 0x3D, 0x20, 0x24, 
+            0x62, 0x75, 0x66, 0x28, 0x10, 0x01, 0x02, 0x75, 0x02, 0x01, 0x94, 0x00, 
+            0x02, 0x71, 0x02, 0x36, 0x61, 0x72, 0x67, 0x43, 0x01, 0x00, 0x3C, 0x0C, 
+            0x01, 0x2F, 0x04, 0x02, 0xC9, 0x05, 0x00, 0x53, 0x0E, 0xD0, 0x3A, 0x74, 
+            0x6F, 0x5F, 0x73, 0x74, 0x72, 0x28, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 
+        },
+        1115,
+        3707,
+    },
+    {
+        "std/curl.pyro",
+        (const uint8_t[]){
+            0xF8, 0x02, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x73, 0x74, 0x64, 
+            0x3A, 0x3A, 0x75, 0x72, 0x6C, 0x3B, 0x0A, 0x11, 0x00, 0xF0, 0x30, 0x6A, 
+            0x73, 0x6F, 0x6E, 0x3B, 0x0A, 0x0A, 0x0A, 0x64, 0x65, 0x66, 0x20, 0x74, 
+            0x65, 0x72, 0x6D, 0x5F, 0x77, 0x69, 0x64, 0x74, 0x68, 0x28, 0x29, 0x20, 
+            0x2D, 0x3E, 0x20, 0x69, 0x36, 0x34, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 
+            0x20, 0x76, 0x61, 0x72, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 
+            0x3D, 0x20, 0x24, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x3A, 0x67, 0x65, 
+            0x74, 0x5F, 0x33, 0x00, 0xC1, 0x69, 0x6E, 0x61, 0x6C, 0x5F, 0x73, 0x69, 
+            0x7A, 0x65, 0x28, 0x29, 0x3B, 0x2E, 0x00, 0xB2, 0x69, 0x66, 0x20, 0x24, 
+            0x69, 0x73, 0x5F, 0x65, 0x72, 0x72, 0x28, 0x35, 0x00, 0x13, 0x29, 0x47, 
+            0x00, 0x00, 0x02, 0x00, 0x92, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+            0x38, 0x30, 0x2C, 0x00, 0x21, 0x7D, 0x0A, 0x33, 0x00, 0x03, 0x16, 0x00, 
+            0x02, 0x2F, 0x00, 0x63, 0x5B, 0x30, 0x5D, 0x3B, 0x0A, 0x7D, 0x95, 0x00, 
+            0xF3, 0x0E, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x5F, 0x72, 0x65, 
+            0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x75, 
+            0x73, 0x5F, 0x63, 0x6F, 0x64, 0x65, 0x28, 0x0C, 0x00, 0x94, 0x6C, 0x69, 
+            0x6E, 0x65, 0x3A, 0x20, 0x73, 0x74, 0x72, 0xB7, 0x00, 0x43, 0x7C, 0x65, 
+            0x72, 0x72, 0x74, 0x00, 0x48, 0x69, 0x66, 0x20, 0x21, 0x27, 0x00, 0xFF, 
+            0x03, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x5F, 0x77, 0x69, 0x74, 0x68, 
+            0x28, 0x22, 0x48, 0x54, 0x54, 0x50, 0x22, 0x9E, 0x00, 0x00, 0x10, 0x24, 
+            0xBC, 0x00, 0x80, 0x22, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0xFA, 
+            0x00, 0x01, 0x7B, 0x00, 0x13, 0x22, 0xE0, 0x00, 0x03, 0xB4, 0x00, 0x00, 
+            0x15, 0x01, 0x99, 0x74, 0x6F, 0x6B, 0x65, 0x6E, 0x73, 0x20, 0x3D, 0x20, 
+            0x63, 0x00, 0x53, 0x70, 0x6C, 0x69, 0x74, 0x28, 0x2D, 0x00, 0x23, 0x69, 
+            0x66, 0x25, 0x00, 0xC3, 0x3A, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x28, 0x29, 
+            0x20, 0x3C, 0x20, 0x32, 0x9C, 0x00, 0x00, 0x02, 0x00, 0x03, 0xFA, 0x00, 
+            0x0F, 0x72, 0x00, 0x16, 0x00, 0xF8, 0x00, 0xC2, 0x20, 0x3D, 0x20, 0x74, 
+            0x72, 0x79, 0x20, 0x24, 0x69, 0x36, 0x34, 0x28, 0x5D, 0x00, 0x36, 0x5B, 
+            0x31, 0x5D, 0x70, 0x00, 0x04, 0x7D, 0x01, 0x00, 0x2B, 0x00, 0x0F, 0xDD, 
+            0x00, 0x25, 0x03, 0x97, 0x00, 0x00, 0x43, 0x00, 0x06, 0x8C, 0x01, 0x45, 
+            0x6D, 0x61, 0x6B, 0x65, 0x89, 0x01, 0xF1, 0x0E, 0x28, 0x68, 0x65, 0x61, 
+            0x64, 0x65, 0x72, 0x73, 0x3A, 0x20, 0x76, 0x65, 0x63, 0x5B, 0x73, 0x74, 
+            0x72, 0x5D, 0x2C, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x3A, 0x20, 0x62, 0x75, 
+            0x66, 0x89, 0x01, 0x13, 0x52, 0x38, 0x01, 0x0A, 0x8E, 0x01, 0x04, 0x37, 
+            0x00, 0x00, 0x22, 0x02, 0x5F, 0x6D, 0x70, 0x74, 0x79, 0x28, 0xA3, 0x00, 
+            0x25, 0x00, 0x80, 0x01, 0x00, 0xA0, 0x00, 0x2F, 0x20, 0x3D, 0x25, 0x02, 
+            0x0B, 0x03, 0x71, 0x00, 0x2F, 0x5B, 0x30, 0x23, 0x01, 0x17, 0x00, 0x57, 
+            0x00, 0x09, 0xA0, 0x02, 0x00, 0x6C, 0x00, 0x04, 0x82, 0x02, 0x25, 0x20, 
+            0x3D, 0xDA, 0x00, 0x04, 0xE5, 0x01, 0x04, 0x1B, 0x00, 0x10, 0x2E, 0x39, 
+            0x00, 0x30, 0x20, 0x3D, 0x20, 0x07, 0x00, 0x02, 0x40, 0x00, 0x05, 0x1A, 
+            0x00, 0x00, 0x1B, 0x01, 0x21, 0x20, 0x3D, 0x22, 0x01, 0x0B, 0x1A, 0x00, 
+            0x43, 0x72, 0x61, 0x77, 0x5F, 0xA4, 0x00, 0x33, 0x20, 0x3D, 0x20, 0x0A, 
+            0x00, 0x90, 0x3A, 0x6A, 0x6F, 0x69, 0x6E, 0x28, 0x22, 0x5C, 0x6E, 0x75, 
+            0x02, 0x01, 0x23, 0x03, 0x33, 0x66, 0x6F, 0x72, 0x1D, 0x00, 0x33, 0x20, 
+            0x69, 0x6E, 0x0A, 0x00, 0xF8, 0x06, 0x73, 0x3A, 0x69, 0x74, 0x65, 0x72, 
+            0x28, 0x29, 0x3A, 0x73, 0x6B, 0x69, 0x70, 0x5F, 0x66, 0x69, 0x72, 0x73, 
+            0x74, 0x28, 0x31, 0x50, 0x01, 0x95, 0x6C, 0x65, 0x74, 0x20, 0x69, 0x6E, 
+            0x64, 0x65, 0x78, 0x5A, 0x00, 0x11, 0x3A, 0x0F, 0x00, 0x73, 0x5F, 0x6F, 
+            0x66, 0x28, 0x22, 0x3A, 0x22, 0x34, 0x02, 0x00, 0x02, 0x00, 0x07, 0xB5, 
+            0x03, 0x01, 0x22, 0x00, 0x08, 0x46, 0x00, 0x00, 0x02, 0x00, 0x03, 0x11, 
+            0x02, 0x0F, 0xA8, 0x02, 0x0B, 0x00, 0x02, 0x00, 0x03, 0x1E, 0x03, 0x00, 
+            0x02, 0x00, 0x00, 0x7E, 0x00, 0x36, 0x6B, 0x65, 0x79, 0x7C, 0x00, 0x82, 
+            0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x30, 0x2C, 0x94, 0x00, 0x07, 0x7E, 
+            0x00, 0x00, 0x2A, 0x00, 0x5C, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2C, 0x00, 
+            0x01, 0x8C, 0x00, 0x44, 0x20, 0x2B, 0x20, 0x31, 0x07, 0x01, 0x00, 0x02, 
+            0x00, 0x05, 0x55, 0x01, 0x03, 0x2D, 0x01, 0xF0, 0x0A, 0x5B, 0x6B, 0x65, 
+            0x79, 0x3A, 0x73, 0x74, 0x72, 0x69, 0x70, 0x28, 0x29, 0x3A, 0x74, 0x6F, 
+            0x5F, 0x61, 0x73, 0x63, 0x69, 0x69, 0x5F, 0x6C, 0x6F, 0x77, 0x1C, 0x01, 
+            0x32, 0x5D, 0x20, 0x3D, 0x5B, 0x00, 0x04, 0x22, 0x00, 0x02, 0x7F, 0x01, 
+            0x03, 0xA7, 0x00, 0x03, 0xD7, 0x00, 0x04, 0x52, 0x00, 0x02, 0xEC, 0x02, 
+            0x95, 0x70, 0x75, 0x62, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0xE9, 0x01, 
+            0x03, 0xB1, 0x03, 0x00, 0x19, 0x00, 0x00, 0x0B, 0x02, 0x00, 0xE0, 0x01, 
+            0x11, 0x3A, 0x20, 0x05, 0x23, 0x3D, 0x20, 0xC9, 0x04, 0x04, 0x1B, 0x00, 
+            0x07, 0xCE, 0x01, 0x01, 0x93, 0x04, 0x52, 0x20, 0x3D, 0x20, 0x22, 0x22, 
+            0x73, 0x00, 0x04, 0x23, 0x00, 0x03, 0xB6, 0x00, 0x50, 0x3A, 0x20, 0x6D, 
+            0x61, 0x70, 0x39, 0x03, 0x10, 0x2C, 0xBB, 0x04, 0x1A, 0x5D, 0x24, 0x00, 
+            0x00, 0x2F, 0x02, 0x01, 0x4A, 0x03, 0x03, 0xF7, 0x00, 0x00, 0xA0, 0x05, 
+            0x30, 0x24, 0x69, 0x6E, 0x58, 0x04, 0x03, 0x8C, 0x00, 0x00, 0x02, 0x00, 
+            0x53, 0x73, 0x65, 0x6C, 0x66, 0x2E, 0x4F, 0x00, 0x52, 0x20, 0x3D, 0x20, 
+            0x7B, 0x7D, 0x45, 0x00, 0x00, 0x02, 0x00, 0x01, 0x1B, 0x00, 0x00, 0x46, 
+            0x00, 0x00, 0xB2, 0x05, 0x3B, 0x62, 0x75, 0x66, 0xF8, 0x00, 0x01, 0x50, 
+            0x00, 0x39, 0x73, 0x74, 0x72, 0x4F, 0x00, 0x00, 0x86, 0x01, 0xB1, 0x6D, 
+            0x61, 0x78, 0x5F, 0x73, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x5F, 0xB1, 0x04, 
+            0x56, 0x20, 0x3D, 0x20, 0x32, 0x34, 0x57, 0x00, 0x00, 0x23, 0x00, 0x0B, 
+            0x1F, 0x00, 0x05, 0x6A, 0x00, 0x07, 0xE2, 0x04, 0x0D, 0x46, 0x00, 0x2F, 
+            0x3A, 0x3F, 0x28, 0x00, 0x00, 0x2D, 0x3A, 0x7C, 0x29, 0x00, 0x03, 0xEF, 
+            0x00, 0x00, 0x02, 0x00, 0x06, 0x6B, 0x00, 0x00, 0x60, 0x05, 0x00, 0xEA, 
+            0x00, 0x00, 0xCF, 0x00, 0x06, 0x44, 0x02, 0x08, 0x87, 0x00, 0x01, 0xF7, 
+            0x01, 0x01, 0xCF, 0x00, 0x0A, 0xAB, 0x00, 0x71, 0x65, 0x6C, 0x6C, 0x69, 
+            0x70, 0x73, 0x69, 0xA2, 0x05, 0x08, 0xD5, 0x00, 0x17, 0x3C, 0x51, 0x00, 
+            0x01, 0xE7, 0x00, 0xE1, 0x28, 0x29, 0x20, 0x3A, 0x3F, 0x20, 0x22, 0x2E, 
+            0x2E, 0x2E, 0x22, 0x20, 0x3A, 0x7C, 0xB3, 0x01, 0x01, 0x76, 0x03, 0x00, 
+            0x02, 0x00, 0x03, 0x24, 0x02, 0xA2, 0x22, 0x3C, 0x69, 0x6E, 0x73, 0x74, 
+            0x61, 0x6E, 0x63, 0x65, 0x4C, 0x07, 0x64, 0x63, 0x75, 0x72, 0x6C, 0x3A, 
+            0x3A, 0x0B, 0x04, 0x31, 0x20, 0x24, 0x7B, 0xE1, 0x00, 0x00, 0x1B, 0x02, 
+            0x10, 0x7D, 0x0D, 0x00, 0x01, 0x6F, 0x00, 0x54, 0x3B, 0x3F, 0x7D, 0x24, 
+            0x7B, 0x85, 0x00, 0x23, 0x7D, 0x3E, 0x09, 0x02, 0x03, 0x7C, 0x02, 0x00, 
+            0x10, 0x02, 0x00, 0x88, 0x01, 0x33, 0x68, 0x61, 0x73, 0x01, 0x04, 0x10, 
+            0x28, 0xC9, 0x02, 0x00, 0x0E, 0x02, 0x01, 0x40, 0x05, 0x47, 0x62, 0x6F, 
+            0x6F, 0x6C, 0xED, 0x01, 0x03, 0x87, 0x00, 0x00, 0x23, 0x00, 0x0C, 0xE4, 
+            0x02, 0x00, 0x12, 0x04, 0x01, 0x7E, 0x00, 0x03, 0x0C, 0x02, 0x02, 0x05, 
+            0x01, 0x0C, 0x67, 0x00, 0x01, 0xB0, 0x05, 0x0A, 0x63, 0x00, 0x37, 0x73, 
+            0x74, 0x72, 0x9E, 0x05, 0x00, 0x02, 0x00, 0x03, 0x66, 0x00, 0x08, 0x4E, 
+            0x00, 0x01, 0x5F, 0x03, 0x0C, 0x73, 0x00, 0x03, 0xB0, 0x02, 0x0B, 0x64, 
+            0x00, 0x50, 0x66, 0x72, 0x6F, 0x6D, 0x5F, 0x54, 0x08, 0x02, 0x42, 0x08, 
+            0x80, 0x6D, 0x61, 0x70, 0x7C, 0x76, 0x65, 0x63, 0x7C, 0x67, 0x00, 0x80, 
+            0x69, 0x36, 0x34, 0x7C, 0x66, 0x36, 0x34, 0x7C, 0xD6, 0x00, 0x5F, 0x7C, 
+            0x6E, 0x75, 0x6C, 0x6C, 0x79, 0x00, 0x03, 0x00, 0x3D, 0x00, 0x26, 0x3A, 
+            0x3A, 0x48, 0x00, 0x01, 0x89, 0x00, 0x01, 0xF9, 0x01, 0x04, 0xE2, 0x01, 
+            0x03, 0x37, 0x04, 0x11, 0x7D, 0x23, 0x08, 0x00, 0x44, 0x01, 0x04, 0xAB, 
+            0x03, 0x53, 0x71, 0x75, 0x65, 0x73, 0x74, 0x31, 0x01, 0x00, 0xA6, 0x03, 
+            0x00, 0xA0, 0x01, 0x00, 0x4D, 0x01, 0x07, 0x83, 0x03, 0x00, 0x17, 0x00, 
+            0x01, 0x4D, 0x00, 0x00, 0x18, 0x00, 0x4B, 0x7C, 0x62, 0x75, 0x66, 0x1C, 
+            0x00, 0x62, 0x64, 0x65, 0x62, 0x75, 0x67, 0x3A, 0x7A, 0x01, 0x50, 0x3D, 
+            0x20, 0x66, 0x61, 0x6C, 0x13, 0x04, 0x00, 0x17, 0x01, 0x00, 0x39, 0x00, 
+            0xF2, 0x00, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x5F, 0x73, 0x65, 
+            0x63, 0x73, 0x3A, 0x20, 0x66, 0xFE, 0x03, 0x13, 0x2E, 0x00, 0x04, 0x00, 
+            0x21, 0x00, 0x58, 0x70, 0x61, 0x72, 0x61, 0x6D, 0xD8, 0x03, 0x04, 0x1A, 
+            0x07, 0x03, 0x2D, 0x01, 0x00, 0x24, 0x00, 0x03, 0xA2, 0x01, 0x06, 0x36, 
+            0x07, 0x06, 0x60, 0x00, 0xA7, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x5F, 
+            0x61, 0x72, 0x67, 0x55, 0x07, 0x03, 0x88, 0x02, 0x00, 0x28, 0x02, 0x0F, 
+            0x00, 0x04, 0x04, 0x02, 0x76, 0x00, 0x0F, 0xFF, 0x03, 0x01, 0x03, 0x6C, 
+            0x00, 0x43, 0x20, 0x3D, 0x20, 0x5B, 0x82, 0x00, 0x00, 0x02, 0x00, 0x01, 
+            0x52, 0x01, 0x07, 0x6C, 0x00, 0x07, 0x1F, 0x00, 0x0B, 0xCE, 0x01, 0x61, 
+            0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x91, 0x00, 0x22, 0x28, 0x2A, 0x97, 
+            0x00, 0x04, 0x65, 0x09, 0x0A, 0x6E, 0x01, 0x00, 0x02, 0x00, 0x0C, 0x57, 
+            0x00, 0x13, 0x3A, 0x3E, 0x00, 0x01, 0x7C, 0x05, 0x20, 0x73, 0x28, 0x3F, 
+            0x00, 0x03, 0xBA, 0x01, 0x00, 0x02, 0x00, 0x07, 0x67, 0x02, 0x02, 0x01, 
+            0x01, 0x0B, 0x7B, 0x00, 0xF2, 0x02, 0x68, 0x74, 0x74, 0x70, 0x5F, 0x61, 
+            0x75, 0x74, 0x68, 0x28, 0x75, 0x73, 0x65, 0x72, 0x6E, 0x61, 0x6D, 0xE1, 
+            0x09, 0xA1, 0x2C, 0x20, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 
+            0xC2, 0x01, 0x08, 0xA5, 0x06, 0x0F, 0x80, 0x00, 0x04, 0x40, 0x28, 0x22, 
+            0x2D, 0x2D, 0x43, 0x00, 0x60, 0x22, 0x2C, 0x20, 0x22, 0x24, 0x7B, 0x0A, 
+            0x00, 0x84, 0x6E, 0x61, 0x6D, 0x65, 0x7D, 0x3A, 0x24, 0x7B, 0x4A, 0x00, 
+            0x18, 0x7D, 0x07, 0x07, 0x0F, 0x98, 0x00, 0x0D, 0x41, 0x75, 0x72, 0x6C, 
+            0x28, 0xD2, 0x00, 0x03, 0x80, 0x00, 0x0F, 0x0B, 0x01, 0x02, 0x61, 0x61, 
+            0x73, 0x73, 0x65, 0x72, 0x74, 0x05, 0x0B, 0x00, 0xB2, 0x02, 0x01, 0x30, 
+            0x00, 0x40, 0x29, 0x2C, 0x20, 0x22, 0x3D, 0x00, 0x34, 0x29, 0x3A, 0x20, 
+            0x58, 0x0A, 0xF0, 0x05, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 
+            0x2C, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x61, 
+            0x56, 0x00, 0x33, 0x69, 0x6E, 0x67, 0x29, 0x04, 0x00, 0x02, 0x00, 0x01, 
+            0xD8, 0x00, 0x20, 0x75, 0x72, 0x90, 0x02, 0x01, 0x49, 0x00, 0x02, 0x2F, 
+            0x01, 0x00, 0x02, 0x00, 0x0F, 0xAC, 0x00, 0x0D, 0x01, 0x19, 0x02, 0x02, 
+            0xF0, 0x03, 0x43, 0x61, 0x6E, 0x79, 0x2C, 0x06, 0x07, 0x4F, 0x20, 0x61, 
+            0x6E, 0x79, 0xB8, 0x00, 0x04, 0x02, 0xAC, 0x07, 0x10, 0x24, 0xB4, 0x00, 
+            0x37, 0x6B, 0x65, 0x79, 0xAE, 0x01, 0x01, 0x79, 0x00, 0x04, 0x1B, 0x00, 
+            0x01, 0x0D, 0x00, 0x08, 0x8F, 0x07, 0x21, 0x69, 0x66, 0x3A, 0x00, 0x13, 
+            0x69, 0x36, 0x04, 0x01, 0x77, 0x00, 0x13, 0x73, 0x88, 0x03, 0x04, 0x02, 
+            0x00, 0x01, 0xC6, 0x00, 0x02, 0x1A, 0x00, 0x00, 0x4F, 0x04, 0x13, 0x5D, 
+            0x1E, 0x02, 0x02, 0x4C, 0x01, 0x07, 0x6A, 0x00, 0x45, 0x7D, 0x20, 0x65, 
+            0x6C, 0x6F, 0x07, 0x04, 0x02, 0x00, 0x0C, 0x3D, 0x00, 0x00, 0xB2, 0x02, 
+            0x01, 0x86, 0x00, 0x07, 0xD6, 0x02, 0x03, 0x40, 0x02, 0x00, 0x02, 0x00, 
+            0x0F, 0x18, 0x01, 0x0D, 0x02, 0x17, 0x03, 0x02, 0x7B, 0x00, 0x0F, 0xC7, 
+            0x01, 0x21, 0x03, 0x40, 0x00, 0x0F, 0xCA, 0x01, 0x23, 0x02, 0x3D, 0x00, 
+            0x1F, 0x73, 0x00, 0x01, 0x05, 0x0F, 0xBC, 0x00, 0x0D, 0x00, 0xBD, 0x04, 
+            0x07, 0xBA, 0x00, 0x00, 0xC3, 0x04, 0x0F, 0xCD, 0x01, 0x04, 0x0F, 0x85, 
+            0x02, 0x02, 0x31, 0x20, 0x7C, 0x7C, 0x97, 0x02, 0x00, 0x11, 0x08, 0x01, 
+            0x42, 0x01, 0x00, 0x97, 0x02, 0x01, 0x54, 0x00, 0x0F, 0xCE, 0x00, 0x13, 
+            0x30, 0x20, 0x6F, 0x72, 0xDF, 0x0B, 0x3C, 0x66, 0x65, 0x72, 0xA2, 0x02, 
+            0x00, 0x45, 0x00, 0x04, 0x6A, 0x09, 0x0F, 0xA3, 0x02, 0x17, 0x01, 0x70, 
+            0x05, 0x02, 0x2C, 0x06, 0x0F, 0x52, 0x04, 0x04, 0x01, 0x22, 0x00, 0x01, 
+            0xF1, 0x0C, 0x0F, 0x58, 0x00, 0x19, 0x03, 0xAB, 0x05, 0x72, 0x28, 0x73, 
+            0x65, 0x63, 0x6F, 0x6E, 0x64, 0xAE, 0x05, 0x0F, 0x28, 0x01, 0x0F, 0x34, 
+            0x66, 0x36, 0x34, 0x32, 0x00, 0x00, 0x18, 0x01, 0x04, 0x45, 0x00, 0x0F, 
+            0x1B, 0x01, 0x0C, 0x10, 0x6E, 0x0B, 0x06, 0x0C, 0x0F, 0x01, 0x03, 0x3C, 
+            0x00, 0x01, 0x2C, 0x06, 0x01, 0xBF, 0x08, 0x01, 0x88, 0x00, 0x0F, 0x19, 
+            0x01, 0x17, 0x44, 0x48, 0x45, 0x41, 0x44, 0x18, 0x01, 0x02, 0x7E, 0x0E, 
+            0x0F, 0x2F, 0x07, 0x03, 0x00, 0x1B, 0x03, 0x11, 0x3A, 0x98, 0x0D, 0x00, 
+            0x59, 0x02, 0x22, 0x5F, 0x72, 0x05, 0x07, 0x20, 0x28, 0x22, 0x40, 0x00, 
+            0x04, 0xD8, 0x04, 0x03, 0x1B, 0x03, 0x00, 0x2B, 0x07, 0x00, 0x47, 0x06, 
+            0x3F, 0x47, 0x45, 0x54, 0x5A, 0x00, 0x1B, 0x03, 0x55, 0x00, 0x01, 0x34, 
+            0x0F, 0x00, 0x00, 0x07, 0x00, 0xEB, 0x01, 0x5F, 0x28, 0x22, 0x47, 0x45, 
+            0x54, 0x61, 0x00, 0x04, 0x7F, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x53, 
+            0x65, 0x00, 0x31, 0x03, 0x4B, 0x00, 0x0F, 0x69, 0x00, 0x04, 0x3F, 0x50, 
+            0x4F, 0x53, 0xCB, 0x00, 0x28, 0x03, 0xC8, 0x00, 0x00, 0x45, 0x00, 0x0F, 
+            0x60, 0x00, 0x05, 0x1F, 0x55, 0x5F, 0x00, 0x30, 0x1F, 0x55, 0x27, 0x01, 
+            0x05, 0x5F, 0x50, 0x41, 0x54, 0x43, 0x48, 0x25, 0x01, 0x27, 0x04, 0xBF, 
+            0x00, 0x00, 0x46, 0x00, 0x0F, 0xC0, 0x00, 0x04, 0x6F, 0x44, 0x45, 0x4C, 
+            0x45, 0x54, 0x45, 0x63, 0x00, 0x2E, 0x02, 0x47, 0x00, 0x0B, 0x64, 0x00, 
+            0x00, 0x4A, 0x02, 0x0E, 0x78, 0x02, 0x54, 0x6D, 0x65, 0x74, 0x68, 0x6F, 
+            0x9C, 0x07, 0x01, 0x1C, 0x07, 0x0F, 0xBD, 0x02, 0x02, 0x22, 0x69, 0x66, 
+            0x80, 0x0B, 0x00, 0xA2, 0x09, 0x0F, 0x08, 0x10, 0x02, 0x00, 0x02, 0x00, 
+            0x03, 0x0B, 0x05, 0x02, 0x72, 0x0E, 0x22, 0x24, 0x7B, 0x5B, 0x00, 0xF4, 
+            0x01, 0x7D, 0x28, 0x29, 0x3A, 0x20, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6E, 
+            0x67, 0x20, 0x75, 0x72, 0x6C, 0x96, 0x00, 0x00, 0x02, 0x00, 0x03, 0xE8, 
+            0x02, 0x00, 0x02, 0x00, 0x00, 0x6A, 0x09, 0x00, 0x72, 0x08, 0x00, 0x2A, 
+            0x06, 0xA0, 0x22, 0x2D, 0x2D, 0x76, 0x65, 0x72, 0x62, 0x6F, 0x73, 0x65, 
+            0x04, 0x08, 0x82, 0x2D, 0x2D, 0x73, 0x69, 0x6C, 0x65, 0x6E, 0x74, 0x0C, 
+            0x00, 0x00, 0x35, 0x03, 0x14, 0x22, 0x64, 0x09, 0x00, 0x02, 0x00, 0x04, 
+            0x9A, 0x00, 0x09, 0xC0, 0x03, 0x10, 0x3E, 0xE7, 0x09, 0x0B, 0xD1, 0x06, 
+            0x00, 0x5E, 0x00, 0x04, 0xC5, 0x05, 0x70, 0x22, 0x2D, 0x2D, 0x6D, 0x61, 
+            0x78, 0x2D, 0x34, 0x00, 0x08, 0x90, 0x00, 0x00, 0x02, 0x00, 0x08, 0x27, 
+            0x00, 0x01, 0x59, 0x07, 0x00, 0xB1, 0x03, 0x10, 0x2E, 0x2A, 0x00, 0x00, 
+            0x4A, 0x03, 0x00, 0x4A, 0x0A, 0x18, 0x29, 0xFE, 0x06, 0x02, 0x0E, 0x13, 
+            0x00, 0x02, 0x00, 0x0A, 0xEF, 0x0F, 0x01, 0x36, 0x00, 0x00, 0xAD, 0x00, 
+            0x2C, 0x65, 0x72, 0x5A, 0x07, 0x08, 0x62, 0x00, 0x03, 0xD2, 0x00, 0x2F, 
+            0x65, 0x72, 0x87, 0x00, 0x09, 0x02, 0x47, 0x00, 0x0F, 0x76, 0x00, 0x03, 
+            0x00, 0x4D, 0x00, 0x23, 0x20, 0x2B, 0xD4, 0x0D, 0x07, 0x24, 0x0A, 0x07, 
+            0x22, 0x01, 0x00, 0x23, 0x00, 0x04, 0xF9, 0x00, 0x05, 0x23, 0x0D, 0x00, 
+            0x02, 0x00, 0x04, 0x3B, 0x01, 0x02, 0xE6, 0x07, 0x05, 0x0D, 0x0E, 0x2C, 
+            0x3E, 0x20, 0x3B, 0x01, 0x00, 0x02, 0x00, 0x13, 0x22, 0x2F, 0x0D, 0x52, 
+            0x75, 0x72, 0x6C, 0x7D, 0x3F, 0x0C, 0x00, 0x02, 0xC7, 0x04, 0x50, 0x71, 
+            0x75, 0x65, 0x72, 0x79, 0xE9, 0x0B, 0x79, 0x69, 0x6E, 0x67, 0x28, 0x29, 
+            0x7D, 0x22, 0x63, 0x00, 0x0F, 0x1E, 0x08, 0x02, 0x00, 0x02, 0x00, 0x01, 
+            0x20, 0x01, 0x3A, 0x75, 0x72, 0x6C, 0x2E, 0x00, 0x05, 0x0E, 0x00, 0x0B, 
+            0xAE, 0x08, 0x01, 0x2E, 0x00, 0x02, 0x59, 0x06, 0x02, 0xE0, 0x14, 0x04, 
+            0x02, 0x00, 0xF9, 0x00, 0x24, 0x65, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x6C, 
+            0x6E, 0x28, 0x22, 0x2D, 0x22, 0x20, 0x2A, 0x12, 0x15, 0x07, 0x31, 0x01, 
+            0x00, 0x02, 0x00, 0x07, 0x2B, 0x00, 0x80, 0x41, 0x52, 0x47, 0x53, 0x3A, 
+            0x20, 0x24, 0x7B, 0x1A, 0x01, 0x09, 0x4D, 0x0A, 0x00, 0x02, 0x00, 0x07, 
+            0x28, 0x00, 0x0F, 0x53, 0x00, 0x09, 0x0B, 0xBC, 0x02, 0x02, 0x09, 0x15, 
+            0x01, 0xF7, 0x06, 0x80, 0x79, 0x20, 0x24, 0x72, 0x75, 0x6E, 0x28, 0x22, 
+            0x6F, 0x0E, 0x30, 0x22, 0x2C, 0x20, 0x65, 0x00, 0x07, 0x8B, 0x00, 0x07, 
+            0xB7, 0x11, 0x02, 0x34, 0x00, 0x08, 0x13, 0x0B, 0x00, 0x02, 0x00, 0x0F, 
+            0x46, 0x03, 0x07, 0x22, 0x24, 0x7B, 0x32, 0x00, 0x09, 0xB3, 0x00, 0x0B, 
+            0x88, 0x00, 0x51, 0x28, 0x65, 0x78, 0x69, 0x74, 0x6C, 0x15, 0x20, 0x2C, 
+            0x20, 0xB1, 0x02, 0x91, 0x62, 0x75, 0x66, 0x2C, 0x20, 0x65, 0x72, 0x72, 
+            0x5F, 0x78, 0x08, 0x10, 0x3D, 0x1B, 0x15, 0x37, 0x75, 0x6C, 0x74, 0x1E, 
+            0x02, 0x10, 0x69, 0xB2, 0x15, 0x03, 0x33, 0x00, 0x3D, 0x20, 0x21, 0x3D, 
+            0xFC, 0x01, 0x00, 0xD5, 0x0F, 0x00, 0x40, 0x00, 0x30, 0x6D, 0x73, 0x67, 
+            0xB8, 0x13, 0x02, 0x4A, 0x00, 0x05, 0xA8, 0x01, 0x04, 0x02, 0x00, 0x00, 
+            0xC5, 0x11, 0x00, 0x86, 0x0A, 0x1E, 0x29, 0x1A, 0x00, 0x70, 0x72, 0x65, 
+            0x70, 0x6C, 0x61, 0x63, 0x65, 0x1B, 0x13, 0x51, 0x2A, 0x20, 0x43, 0x6C, 
+            0x6F, 0x09, 0x04, 0xA0, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 
+            0x6F, 0x6E, 0xD7, 0x03, 0x1F, 0x22, 0x37, 0x00, 0x0D, 0x00, 0x25, 0x00, 
+            0x2F, 0x3A, 0x20, 0x27, 0x00, 0x0A, 0x02, 0x25, 0x00, 0x0F, 0x23, 0x00, 
+            0x01, 0x03, 0x68, 0x12, 0x19, 0x3B, 0x9B, 0x00, 0x0F, 0x66, 0x01, 0x09, 
+            0x03, 0xEF, 0x00, 0x0F, 0x67, 0x01, 0x09, 0x02, 0x93, 0x03, 0x00, 0xA6, 
+            0x10, 0x03, 0x65, 0x01, 0x09, 0x5D, 0x00, 0x0F, 0x0E, 0x01, 0x03, 0x10, 
+            0x3A, 0xF6, 0x16, 0x2A, 0x73, 0x28, 0xEC, 0x00, 0x90, 0x3A, 0x6D, 0x61, 
+            0x70, 0x28, 0x64, 0x65, 0x66, 0x28, 0x1D, 0x00, 0x34, 0x29, 0x20, 0x7B, 
+            0x99, 0x00, 0x00, 0x0F, 0x00, 0x05, 0x00, 0x13, 0x2B, 0x20, 0x7D, 0x35, 
+            0x00, 0x30, 0x66, 0x69, 0x6C, 0x47, 0x14, 0x0F, 0x38, 0x00, 0x00, 0x11, 
+            0x21, 0x39, 0x00, 0x06, 0xA3, 0x05, 0x0E, 0x3C, 0x00, 0x60, 0x74, 0x6F, 
+            0x5F, 0x76, 0x65, 0x63, 0x10, 0x01, 0x05, 0xB4, 0x00, 0x03, 0x74, 0x00, 
+            0x01, 0x1E, 0x06, 0x13, 0x72, 0x04, 0x16, 0x04, 0x2E, 0x16, 0x05, 0x47, 
+            0x02, 0x03, 0xC4, 0x02, 0x03, 0x70, 0x02, 0x05, 0x4E, 0x06, 0x0F, 0x6C, 
+            0x08, 0x02, 0x02, 0xFB, 0x05, 0x08, 0xAB, 0x0B, 0x0F, 0x56, 0x06, 0x8B, 
+            0x03, 0xC5, 0x00, 0x32, 0x22, 0x2C, 0x20, 0xBA, 0x00, 0x0F, 0x61, 0x06, 
+            0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x04, 0x98, 0x09, 0x0F, 0xF1, 0x08, 0x0B, 
+            0x00, 0xA6, 0x06, 0x52, 0x62, 0x75, 0x66, 0x3A, 0x61, 0xB4, 0x12, 0x14, 
+            0x29, 0x2E, 0x06, 0x03, 0xA8, 0x05, 0x04, 0x02, 0x00, 0x0F, 0xCF, 0x08, 
+            0x23, 0x06, 0xE0, 0x06, 0x03, 0x67, 0x00, 0x05, 0x2C, 0x06, 0x00, 0x02, 
+            0x00, 0x0F, 0xE0, 0x06, 0x19, 0x0F, 0xAB, 0x06, 0x07, 0x01, 0xAA, 0x06, 
+            0x09, 0xDE, 0x1D, 0x3F, 0x3C, 0x20, 0x22, 0xED, 0x06, 0x00, 0x0F, 0x22, 
+            0x07, 0x0A, 0x01, 0xA0, 0x1A, 0x15, 0x32, 0xFD, 0x00, 0x0E, 0xEF, 0x06, 
+            0x0F, 0x80, 0x00, 0x07, 0x0F, 0x2B, 0x07, 0x6A, 0x02, 0x0D, 0x0E, 0x02, 
+            0x6E, 0x06, 0x0F, 0x28, 0x07, 0xA7, 0x01, 0x9F, 0x0D, 0xB0, 0x64, 0x61, 
+            0x74, 0x61, 0x2D, 0x62, 0x69, 0x6E, 0x61, 0x72, 0x79, 0xA8, 0x09, 0x2F, 
+            0x40, 0x2D, 0xA0, 0x0D, 0xF9, 0x00, 0xD8, 0x0E, 0x00, 0xB7, 0x10, 0x01, 
+            0x53, 0x12, 0x03, 0x76, 0x13, 0x06, 0x8A, 0x0A, 0x04, 0xEA, 0x03, 0x0F, 
+            0x82, 0x0D, 0x0E, 0x07, 0x43, 0x00, 0x0F, 0x76, 0x0D, 0x01, 0x06, 0x52, 
+            0x00, 0x00, 0x02, 0x00, 0x00, 0x72, 0x0C, 0x04, 0xF1, 0x0D, 0x0F, 0x61, 
+            0x0E, 0x12, 0xC0, 0x22, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 
+            0x54, 0x79, 0x70, 0x70, 0x16, 0x60, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 
+            0x9E, 0x0B, 0xF0, 0x02, 0x2F, 0x78, 0x2D, 0x77, 0x77, 0x77, 0x2D, 0x66, 
+            0x6F, 0x72, 0x6D, 0x2D, 0x75, 0x72, 0x6C, 0x65, 0x6E, 0x2E, 0x1B, 0x18, 
+            0x64, 0xAD, 0x0E, 0x03, 0x10, 0x0A, 0x00, 0x02, 0x00, 0x00, 0x78, 0x00, 
+            0x0F, 0x8C, 0x0E, 0x03, 0x00, 0x1E, 0x00, 0x00, 0x02, 0x00, 0x00, 0x22, 
+            0x00, 0x04, 0x9A, 0x00, 0x01, 0x0F, 0x01, 0x3F, 0x75, 0x72, 0x6C, 0xEB, 
+            0x0D, 0x8F, 0x00, 0x02, 0x00, 0x07, 0x47, 0x05, 0x40, 0x42, 0x4F, 0x44, 
+            0x59, 0x8D, 0x0D, 0x00, 0x94, 0x01, 0x09, 0x24, 0x0C, 0x00, 0x02, 0x00, 
+            0x07, 0x28, 0x00, 0x0F, 0x3E, 0x0E, 0x36, 0x02, 0xA7, 0x21, 0x07, 0xD8, 
+            0x05, 0x0F, 0x44, 0x0E, 0xFF, 0xB0, 0x04, 0xF9, 0x03, 0x0F, 0xE3, 0x07, 
+            0xFF, 0xBE, 0x0A, 0x0D, 0x13, 0x00, 0x94, 0x27, 0x24, 0x73, 0x74, 0xD9, 
+            0x26, 0x00, 0x02, 0x00, 0x00, 0x0F, 0x06, 0x30, 0x6C, 0x69, 0x73, 0x96, 
+            0x27, 0x00, 0xE2, 0x1D, 0x05, 0x56, 0x09, 0x00, 0x3D, 0x14, 0x34, 0x28, 
+            0x6B, 0x65, 0xF4, 0x1B, 0x16, 0x73, 0x21, 0x20, 0x02, 0x1B, 0x06, 0x0B, 
+            0x91, 0x13, 0x00, 0x47, 0x00, 0x03, 0x8C, 0x05, 0x10, 0x5F, 0xCA, 0x1B, 
+            0x10, 0x3D, 0x5A, 0x15, 0x01, 0x2D, 0x28, 0x12, 0x5F, 0x17, 0x00, 0x00, 
+            0x4C, 0x00, 0x07, 0x31, 0x04, 0x00, 0x02, 0x00, 0x00, 0x63, 0x00, 0x01, 
+            0x42, 0x1A, 0x00, 0x5B, 0x00, 0x01, 0x09, 0x00, 0x0C, 0x99, 0x14, 0x00, 
+            0x02, 0x00, 0x08, 0x5A, 0x00, 0x01, 0x25, 0x00, 0x0F, 0x5C, 0x00, 0x00, 
+            0x01, 0x18, 0x00, 0x0B, 0x5E, 0x00, 0x00, 0x02, 0x00, 0x00, 0xD9, 0x00, 
+            0x04, 0xDE, 0x05, 0x32, 0x22, 0x24, 0x7B, 0x8A, 0x00, 0x01, 0xA1, 0x00, 
+            0x26, 0x7D, 0x3D, 0x0F, 0x00, 0x01, 0x3E, 0x00, 0x0D, 0x38, 0x05, 0x15, 
+            0x7D, 0x0B, 0x01, 0x07, 0x51, 0x06, 0x03, 0x98, 0x10, 0x01, 0x58, 0x00, 
+            0x02, 0x5F, 0x25, 0x14, 0x26, 0x7B, 0x06, 0x06, 0x4D, 0x20, 0x00, 0x8A, 
+            0x10, 0x00, 0x3D, 0x19, 0x10, 0x28, 0x9C, 0x16, 0x00, 0x8E, 0x1D, 0x0F, 
+            0xC8, 0x16, 0x05, 0x03, 0x4E, 0x00, 0x03, 0xB7, 0x1A, 0x07, 0x88, 0x11, 
+            0x00, 0x65, 0x29, 0x00, 0x3E, 0x00, 0x06, 0x65, 0x11, 0x11, 0x3A, 0x51, 
+            0x00, 0x16, 0x29, 0x5D, 0x24, 0x00, 0x65, 0x00, 0x00, 0x87, 0x19, 0x0F, 
+            0x64, 0x00, 0x39, 0x00, 0x50, 0x00, 0x0B, 0x63, 0x00, 0x03, 0x3E, 0x19, 
+            0x00, 0x8D, 0x00, 0x0F, 0x15, 0x0A, 0x0A, 0x0F, 0xCB, 0x00, 0x19, 0x04, 
+            0x54, 0x00, 0x0B, 0x6B, 0x00, 0x00, 0x46, 0x19, 0x05, 0x68, 0x00, 0x02, 
+            0x62, 0x06, 0x01, 0x73, 0x00, 0x07, 0xA1, 0x1C, 0x0D, 0xB4, 0x11, 0x0F, 
+            0x77, 0x00, 0x19, 0x00, 0x1E, 0x07, 0x10, 0x28, 0x05, 0x00, 0x07, 0x56, 
+            0x01, 0x01, 0x74, 0x00, 0x0C, 0x88, 0x00, 0x16, 0x55, 0x56, 0x01, 0x0F, 
+            0x87, 0x00, 0x55, 0x00, 0x26, 0x1A, 0x0A, 0xDC, 0x01, 0x02, 0xDB, 0x19, 
+            0x04, 0xDE, 0x01, 0x0F, 0x88, 0x00, 0x55, 0x02, 0x50, 0x1A, 0x0A, 0x8A, 
+            0x00, 0x02, 0xBC, 0x19, 0x0F, 0x9A, 0x01, 0x05, 0x01, 0xFE, 0x22, 0x0F, 
+            0xE1, 0x02, 0x31, 0x00, 0x9A, 0x01, 0x0C, 0x9F, 0x01, 0x03, 0x7B, 0x00, 
+            0x50, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 
+        },
+        3390,
+        11396,
+    },
+    {
+        "std/cgi.pyro",
+        (const uint8_t[]){
+            0xF8, 0x03, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x73, 0x74, 0x64, 
+            0x3A, 0x3A, 0x6A, 0x73, 0x6F, 0x6E, 0x3B, 0x0A, 0x12, 0x00, 0xF0, 0x27, 
+            0x75, 0x72, 0x6C, 0x3B, 0x0A, 0x0A, 0x70, 0x75, 0x62, 0x20, 0x63, 0x6C, 
+            0x61, 0x73, 0x73, 0x20, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x20, 
+            0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x70, 0x61, 
+            0x72, 0x61, 0x6D, 0x73, 0x3A, 0x20, 0x6D, 0x61, 0x70, 0x5B, 0x73, 0x74, 
+            0x72, 0x2C, 0x20, 0x76, 0x65, 0x63, 0x09, 0x00, 0x35, 0x5D, 0x5D, 0x3B, 
+            0x24, 0x00, 0xB1, 0x62, 0x6F, 0x64, 0x79, 0x3A, 0x20, 0x73, 0x74, 0x72, 
+            0x3B, 0x0A, 0x14, 0x00, 0xB3, 0x64, 0x65, 0x66, 0x20, 0x24, 0x69, 0x6E, 
+            0x69, 0x74, 0x28, 0x29, 0x4A, 0x00, 0x00, 0x02, 0x00, 0x52, 0x73, 0x65, 
+            0x6C, 0x66, 0x2E, 0x4F, 0x00, 0x92, 0x20, 0x3D, 0x20, 0x24, 0x6D, 0x61, 
+            0x70, 0x28, 0x29, 0x44, 0x00, 0x00, 0x02, 0x00, 0x01, 0x1E, 0x00, 0x00, 
+            0x49, 0x00, 0x00, 0x1C, 0x00, 0xF0, 0x02, 0x73, 0x74, 0x64, 0x69, 0x6E, 
+            0x3A, 0x72, 0x65, 0x61, 0x64, 0x5F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 
+            0x2A, 0x00, 0x01, 0x5B, 0x00, 0x00, 0x02, 0x00, 0xF2, 0x1A, 0x69, 0x66, 
+            0x20, 0x24, 0x65, 0x6E, 0x76, 0x28, 0x22, 0x52, 0x45, 0x51, 0x55, 0x45, 
+            0x53, 0x54, 0x5F, 0x4D, 0x45, 0x54, 0x48, 0x4F, 0x44, 0x22, 0x29, 0x20, 
+            0x69, 0x6E, 0x20, 0x28, 0x22, 0x50, 0x4F, 0x53, 0x54, 0x22, 0x2C, 0x20, 
+            0x22, 0x50, 0x55, 0x07, 0x00, 0x40, 0x41, 0x54, 0x43, 0x48, 0x10, 0x00, 
+            0x78, 0x44, 0x45, 0x4C, 0x45, 0x54, 0x45, 0x22, 0x93, 0x00, 0x00, 0x02, 
+            0x00, 0x05, 0x4E, 0x00, 0xB0, 0x43, 0x4F, 0x4E, 0x54, 0x45, 0x4E, 0x54, 
+            0x5F, 0x54, 0x59, 0x50, 0x26, 0x00, 0xF7, 0x17, 0x3D, 0x3D, 0x20, 0x22, 
+            0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 
+            0x78, 0x2D, 0x77, 0x77, 0x77, 0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x75, 
+            0x72, 0x6C, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x64, 0x22, 0xE0, 0x00, 
+            0x04, 0x02, 0x00, 0x00, 0xCA, 0x00, 0xC3, 0x3A, 0x75, 0x6E, 0x70, 0x61, 
+            0x63, 0x6B, 0x5F, 0x75, 0x72, 0x6C, 0x5F, 0x2B, 0x00, 0x04, 0xCA, 0x00, 
+            0x00, 0x1F, 0x00, 0x01, 0xE9, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x02, 0x00, 
+            0x15, 0x7D, 0xE0, 0x00, 0x12, 0x7D, 0x46, 0x01, 0x00, 0x02, 0x00, 0x00, 
+            0x82, 0x01, 0x53, 0x71, 0x75, 0x65, 0x72, 0x79, 0x3E, 0x00, 0x00, 0x1D, 
+            0x01, 0x01, 0xFB, 0x00, 0xD7, 0x51, 0x55, 0x45, 0x52, 0x59, 0x5F, 0x53, 
+            0x54, 0x52, 0x49, 0x4E, 0x47, 0x22, 0x4A, 0x00, 0x00, 0xCE, 0x00, 0x20, 
+            0x69, 0x73, 0x2E, 0x00, 0x18, 0x28, 0x38, 0x00, 0x0C, 0xF5, 0x00, 0x00, 
+            0x85, 0x00, 0x0F, 0xA4, 0x00, 0x08, 0x09, 0x3B, 0x00, 0x06, 0xA4, 0x01, 
+            0x02, 0xA3, 0x00, 0x03, 0x9F, 0x00, 0x00, 0x35, 0x02, 0x00, 0xE9, 0x01, 
+            0x00, 0xCB, 0x00, 0x50, 0x28, 0x29, 0x20, 0x2D, 0x3E, 0x01, 0x02, 0x07, 
+            0x0F, 0x01, 0x61, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x6A, 0x00, 0x01, 
+            0xEF, 0x00, 0x02, 0x47, 0x00, 0x0B, 0x3D, 0x00, 0x82, 0x66, 0x6F, 0x75, 
+            0x6E, 0x64, 0x28, 0x6B, 0x65, 0x3F, 0x02, 0x01, 0x46, 0x00, 0x4E, 0x62, 
+            0x6F, 0x6F, 0x6C, 0x47, 0x00, 0x30, 0x6B, 0x65, 0x79, 0xDE, 0x01, 0x01, 
+            0x4E, 0x00, 0x02, 0x44, 0x02, 0x0F, 0x50, 0x00, 0x02, 0x5A, 0x76, 0x61, 
+            0x6C, 0x75, 0x65, 0x50, 0x00, 0x77, 0x73, 0x74, 0x72, 0x7C, 0x65, 0x72, 
+            0x72, 0x53, 0x00, 0x00, 0x55, 0x01, 0x01, 0x29, 0x00, 0x32, 0x73, 0x20, 
+            0x3D, 0xA0, 0x00, 0x02, 0x52, 0x00, 0x43, 0x5B, 0x6B, 0x65, 0x79, 0xD6, 
+            0x02, 0x00, 0x02, 0x00, 0x03, 0x4B, 0x01, 0x42, 0x65, 0x72, 0x72, 0x28, 
+            0x2E, 0x00, 0x0C, 0x45, 0x01, 0x03, 0xE2, 0x00, 0x10, 0x24, 0x22, 0x00, 
+            0x10, 0x22, 0xA1, 0x00, 0xC2, 0x27, 0x24, 0x7B, 0x6B, 0x65, 0x79, 0x7D, 
+            0x27, 0x20, 0x6E, 0x6F, 0x74, 0xDB, 0x00, 0x00, 0xB4, 0x00, 0x13, 0x72, 
+            0x54, 0x03, 0x01, 0x65, 0x00, 0x58, 0x65, 0x74, 0x65, 0x72, 0x73, 0xB1, 
+            0x01, 0x03, 0x11, 0x01, 0x00, 0x02, 0x00, 0x03, 0x50, 0x00, 0x42, 0x74, 
+            0x72, 0x79, 0x20, 0x71, 0x00, 0x50, 0x3A, 0x6C, 0x61, 0x73, 0x74, 0xFB, 
+            0x02, 0x00, 0x1E, 0x00, 0x03, 0x29, 0x00, 0x04, 0x77, 0x01, 0x02, 0x22, 
+            0x00, 0x0A, 0xEB, 0x00, 0x04, 0x9B, 0x03, 0x07, 0xEC, 0x00, 0x03, 0x54, 
+            0x00, 0x07, 0x38, 0x01, 0x01, 0xE6, 0x00, 0x53, 0x20, 0x21, 0x21, 0x20, 
+            0x5B, 0xEC, 0x00, 0x0B, 0x59, 0x00, 0x01, 0xA7, 0x00, 0x12, 0x73, 0xD2, 
+            0x01, 0x0E, 0xF5, 0x03, 0x0F, 0x5B, 0x00, 0x0A, 0x0F, 0xA9, 0x00, 0x02, 
+            0x50, 0x66, 0x72, 0x6F, 0x6D, 0x5F, 0x7A, 0x04, 0x05, 0x53, 0x00, 0x50, 
+            0x7C, 0x76, 0x65, 0x63, 0x7C, 0x97, 0x01, 0x80, 0x69, 0x36, 0x34, 0x7C, 
+            0x66, 0x36, 0x34, 0x7C, 0xF3, 0x01, 0x5F, 0x7C, 0x6E, 0x75, 0x6C, 0x6C, 
+            0xA9, 0x01, 0x00, 0x81, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x3D, 
+            0x17, 0x01, 0x00, 0x47, 0x00, 0x26, 0x3A, 0x3A, 0x52, 0x00, 0x01, 0xD7, 
+            0x00, 0x00, 0x81, 0x02, 0x0E, 0x02, 0x03, 0x00, 0x95, 0x01, 0x02, 0x3C, 
+            0x00, 0x0F, 0xB7, 0x01, 0x0A, 0x04, 0x9D, 0x01, 0x00, 0x45, 0x00, 0x31, 
+            0x20, 0x69, 0x73, 0xBA, 0x01, 0x52, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x6C, 
+            0x00, 0x32, 0x20, 0x24, 0x7B, 0x45, 0x00, 0x1F, 0x7D, 0xB4, 0x01, 0x0B, 
+            0x02, 0x25, 0x00, 0x09, 0x00, 0x01, 0x00, 0x1C, 0x03, 0x0F, 0x06, 0x04, 
+            0x07, 0x51, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x34, 0x05, 0x08, 0x9F, 0x00, 
+            0xB0, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 
+            0x3A, 0x02, 0x02, 0x25, 0x00, 0x8F, 0x73, 0x70, 0x6C, 0x69, 0x74, 0x28, 
+            0x22, 0x26, 0xBA, 0x04, 0x01, 0x03, 0x2D, 0x00, 0xCD, 0x3A, 0x63, 0x6F, 
+            0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x28, 0x22, 0x3D, 0x27, 0x00, 0x00, 
+            0x02, 0x00, 0x00, 0xF3, 0x02, 0x40, 0x70, 0x61, 0x72, 0x74, 0xF2, 0x02, 
+            0x04, 0x34, 0x00, 0x03, 0x58, 0x00, 0x10, 0x3D, 0xDA, 0x00, 0x10, 0x0A, 
+            0x25, 0x00, 0x08, 0x02, 0x00, 0x00, 0x31, 0x00, 0x00, 0xD3, 0x02, 0x51, 
+            0x3D, 0x20, 0x75, 0x72, 0x6C, 0x28, 0x06, 0x30, 0x5F, 0x64, 0x65, 0xF3, 
+            0x04, 0x11, 0x28, 0x47, 0x00, 0x37, 0x5B, 0x30, 0x5D, 0x73, 0x01, 0x04, 
+            0x02, 0x00, 0x07, 0x32, 0x03, 0x47, 0x6B, 0x65, 0x79, 0x29, 0x2C, 0x02, 
+            0x08, 0x02, 0x00, 0x00, 0xAC, 0x00, 0x42, 0x69, 0x6E, 0x75, 0x65, 0x2E, 
+            0x01, 0x08, 0x02, 0x00, 0x03, 0x8A, 0x02, 0x08, 0x02, 0x00, 0x00, 0x88, 
+            0x00, 0x01, 0xEB, 0x02, 0x0F, 0x8A, 0x00, 0x06, 0x1F, 0x31, 0x8A, 0x00, 
+            0x0C, 0x01, 0x3E, 0x00, 0x0F, 0x8C, 0x00, 0x3B, 0x00, 0x46, 0x01, 0x01, 
+            0x7B, 0x02, 0x02, 0x2C, 0x03, 0x01, 0x52, 0x03, 0x0E, 0xCE, 0x00, 0x07, 
+            0x0E, 0x01, 0x01, 0x84, 0x00, 0x1F, 0x73, 0x85, 0x00, 0x05, 0x0C, 0x4B, 
+            0x00, 0x41, 0x20, 0x3D, 0x20, 0x5B, 0x32, 0x00, 0x03, 0xA1, 0x03, 0x08, 
+            0x02, 0x00, 0x6F, 0x7D, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x5A, 0x01, 0x04, 
+            0x01, 0x35, 0x00, 0x82, 0x73, 0x3A, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 
+            0xB5, 0x04, 0x0F, 0xA6, 0x01, 0x00, 0x19, 0x7D, 0xED, 0x01, 0x06, 0x0E, 
+            0x00, 0x02, 0x0A, 0x00, 0x3A, 0x7D, 0x0A, 0x7D, 0x11, 0x08, 0x45, 0x73, 
+            0x70, 0x6F, 0x6E, 0x72, 0x00, 0x00, 0x8F, 0x01, 0x85, 0x68, 0x65, 0x61, 
+            0x64, 0x65, 0x72, 0x73, 0x3A, 0x0A, 0x08, 0x02, 0xFB, 0x00, 0x00, 0x1B, 
+            0x00, 0x00, 0x46, 0x03, 0x53, 0x3A, 0x20, 0x62, 0x75, 0x66, 0x52, 0x02, 
+            0x00, 0x04, 0x03, 0x0F, 0x09, 0x08, 0x04, 0x03, 0x46, 0x00, 0x00, 0xD1, 
+            0x06, 0x34, 0x76, 0x65, 0x63, 0xE5, 0x04, 0x00, 0x02, 0x00, 0x01, 0x0F, 
+            0x01, 0x00, 0x4A, 0x00, 0x00, 0x1C, 0x00, 0x34, 0x62, 0x75, 0x66, 0x1C, 
+            0x00, 0x03, 0x1E, 0x02, 0x04, 0x01, 0x05, 0x42, 0x61, 0x64, 0x64, 0x5F, 
+            0x45, 0x00, 0x12, 0x28, 0x07, 0x00, 0x03, 0x4E, 0x03, 0x2C, 0x2D, 0x3E, 
+            0xB5, 0x00, 0x00, 0x02, 0x00, 0x01, 0x55, 0x00, 0x02, 0x28, 0x00, 0x05, 
+            0x21, 0x01, 0x02, 0x0F, 0x00, 0x07, 0x22, 0x01, 0x07, 0x2D, 0x05, 0x02, 
+            0xD4, 0x00, 0x0B, 0x73, 0x00, 0xF0, 0x03, 0x6D, 0x61, 0x6B, 0x65, 0x5F, 
+            0x33, 0x30, 0x31, 0x5F, 0x72, 0x65, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 
+            0x28, 0x1D, 0x03, 0x00, 0xF8, 0x06, 0x0F, 0x77, 0x00, 0x09, 0x17, 0x3A, 
+            0xAA, 0x00, 0xF0, 0x0F, 0x22, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3A, 
+            0x20, 0x33, 0x30, 0x31, 0x20, 0x4D, 0x6F, 0x76, 0x65, 0x64, 0x20, 0x50, 
+            0x65, 0x72, 0x6D, 0x61, 0x6E, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x8A, 0x03, 
+            0x00, 0xAD, 0x00, 0x00, 0x02, 0x00, 0x00, 0xB1, 0x00, 0x09, 0x3A, 0x00, 
+            0x22, 0x4C, 0x6F, 0x89, 0x08, 0x50, 0x3A, 0x20, 0x22, 0x20, 0x2B, 0x96, 
+            0x03, 0x0F, 0xB9, 0x00, 0x1F, 0x1F, 0x32, 0xB9, 0x00, 0x32, 0x30, 0x32, 
+            0x20, 0x46, 0xB6, 0x07, 0x0F, 0xAD, 0x00, 0x4D, 0x1F, 0x33, 0xAD, 0x00, 
+            0x32, 0xBF, 0x33, 0x20, 0x53, 0x65, 0x65, 0x20, 0x4F, 0x74, 0x68, 0x65, 
+            0x72, 0xB1, 0x00, 0x4D, 0x1F, 0x37, 0xB1, 0x00, 0x32, 0x40, 0x37, 0x20, 
+            0x54, 0x65, 0xB3, 0x0B, 0x53, 0x61, 0x72, 0x79, 0x20, 0x52, 0x67, 0x02, 
+            0x0F, 0xBA, 0x00, 0x46, 0xBF, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x2A, 
+            0x61, 0x72, 0x67, 0x73, 0xC2, 0x02, 0x09, 0x01, 0xC0, 0x09, 0x18, 0x3A, 
+            0x2D, 0x00, 0x06, 0xA8, 0x02, 0x0F, 0x34, 0x03, 0x0D, 0x10, 0x73, 0x8B, 
+            0x04, 0x08, 0xFA, 0x04, 0x00, 0xE4, 0x06, 0x02, 0x7A, 0x03, 0x00, 0xE3, 
+            0x06, 0x00, 0xE7, 0x02, 0x12, 0x2E, 0x0F, 0x00, 0x1B, 0x73, 0xD6, 0x04, 
+            0xB2, 0x6C, 0x65, 0x74, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x3D, 0x20, 
+            0x21, 0x00, 0x10, 0x3A, 0x0C, 0x0C, 0xF0, 0x00, 0x70, 0x28, 0x29, 0x3A, 
+            0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x22, 0x5C, 0x72, 0xD9, 
+            0x0B, 0x48, 0x5C, 0x5C, 0x72, 0x22, 0x15, 0x00, 0x12, 0x6E, 0x15, 0x00, 
+            0x18, 0x6E, 0x37, 0x01, 0x00, 0x02, 0x00, 0xC1, 0x24, 0x70, 0x72, 0x69, 
+            0x6E, 0x74, 0x28, 0x22, 0x7B, 0x7D, 0x5C, 0x72, 0x25, 0x00, 0x00, 0x5E, 
+            0x00, 0x07, 0x46, 0x03, 0x03, 0xEE, 0x03, 0x00, 0x02, 0x00, 0x04, 0x2B, 
+            0x00, 0x01, 0x29, 0x00, 0x07, 0x23, 0x00, 0x03, 0x18, 0x00, 0x01, 0xB6, 
+            0x00, 0x00, 0xA3, 0x04, 0xB0, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+            0x7D, 0x0A, 0x7D, 0x0A, 
+        },
+        1504,
+        3433,
+    },
+    {
+        "std/html.pyro",
+        (const uint8_t[]){
+            0xF0, 0x45, 0x23, 0x20, 0x45, 0x73, 0x63, 0x61, 0x70, 0x65, 0x73, 0x20, 
+            0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x6F, 0x20, 
+            0x69, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x73, 0x61, 
+            0x66, 0x65, 0x6C, 0x79, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6E, 
+            0x73, 0x69, 0x64, 0x65, 0x20, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x74, 0x61, 
+            0x67, 0x73, 0x2E, 0x0A, 0x70, 0x75, 0x62, 0x20, 0x64, 0x65, 0x66, 0x20, 
+            0x65, 0x73, 0x63, 0x5F, 0x68, 0x74, 0x6D, 0x6C, 0x28, 0x74, 0x65, 0x78, 
+            0x74, 0x3A, 0x49, 0x00, 0x40, 0x29, 0x20, 0x2D, 0x3E, 0x08, 0x00, 0xF1, 
+            0x03, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 
+            0x72, 0x6E, 0x20, 0x74, 0x65, 0x78, 0x74, 0x10, 0x00, 0x00, 0x02, 0x00, 
+            0xFF, 0x07, 0x3A, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x22, 
+            0x26, 0x22, 0x2C, 0x20, 0x22, 0x26, 0x61, 0x6D, 0x70, 0x3B, 0x22, 0x29, 
+            0x1F, 0x00, 0x00, 0x11, 0x3C, 0x1F, 0x00, 0x2F, 0x6C, 0x74, 0x1E, 0x00, 
+            0x03, 0x11, 0x3E, 0x1E, 0x00, 0x10, 0x67, 0x1E, 0x00, 0x5F, 0x3B, 0x0A, 
+            0x7D, 0x0A, 0x0A, 0xD2, 0x00, 0x20, 0x12, 0x61, 0xD4, 0x00, 0x9A, 0x61, 
+            0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0xD9, 0x00, 0x00, 0x17, 
+            0x00, 0x0F, 0xD9, 0x00, 0x6C, 0x0E, 0x15, 0x01, 0x30, 0x60, 0x22, 0x60, 
+            0x34, 0x01, 0x30, 0x71, 0x75, 0x6F, 0xF9, 0x00, 0x0F, 0x20, 0x00, 0x00, 
+            0x11, 0x27, 0x20, 0x00, 0xB0, 0x61, 0x70, 0x6F, 0x73, 0x3B, 0x22, 0x29, 
+            0x3B, 0x0A, 0x7D, 0x0A, 
+        },
+        232,
+        490,
+    },
+    {
+        "std/url.pyro",
+        (const uint8_t[]){
+            0xF0, 0x26, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x73, 0x74, 0x64, 
+            0x3A, 0x3A, 0x70, 0x72, 0x65, 0x74, 0x74, 0x79, 0x3B, 0x0A, 0x0A, 0x23, 
+            0x20, 0x52, 0x65, 0x66, 0x3A, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 
+            0x2F, 0x2F, 0x65, 0x6E, 0x2E, 0x77, 0x69, 0x6B, 0x69, 0x70, 0x65, 0x64, 
+            0x69, 0x61, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x0E, 0x00, 0xFE, 0x31, 0x2F, 
+            0x55, 0x52, 0x4C, 0x5F, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x69, 0x6E, 0x67, 
+            0x0A, 0x6C, 0x65, 0x74, 0x20, 0x75, 0x72, 0x6C, 0x5F, 0x72, 0x65, 0x73, 
+            0x65, 0x72, 0x76, 0x65, 0x64, 0x5F, 0x63, 0x68, 0x61, 0x72, 0x73, 0x20, 
+            0x3D, 0x20, 0x22, 0x20, 0x21, 0x5C, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 
+            0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2F, 0x3A, 0x3B, 0x3D, 0x3F, 0x40, 0x5B, 
+            0x5D, 0x22, 0x3B, 0x33, 0x00, 0x40, 0x62, 0x79, 0x74, 0x65, 0x33, 0x00, 
+            0x0E, 0x48, 0x00, 0x11, 0x3A, 0x1B, 0x00, 0xB1, 0x28, 0x29, 0x3A, 0x74, 
+            0x6F, 0x5F, 0x73, 0x65, 0x74, 0x28, 0x29, 0xA4, 0x00, 0x61, 0x56, 0x61, 
+            0x6C, 0x69, 0x64, 0x20, 0x1B, 0x00, 0xF1, 0x11, 0x20, 0x69, 0x6E, 0x20, 
+            0x74, 0x68, 0x65, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6D, 0x65, 0x20, 0x65, 
+            0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 
+            0x55, 0x52, 0x4C, 0x2E, 0x6D, 0x00, 0x10, 0x76, 0x30, 0x00, 0x12, 0x5F, 
+            0x23, 0x00, 0x12, 0x5F, 0x37, 0x00, 0xF1, 0x37, 0x3D, 0x20, 0x22, 0x61, 
+            0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 
+            0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 
+            0x7A, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 
+            0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 
+            0x58, 0x59, 0x5A, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 
+            0x39, 0x2B, 0x2D, 0x2E, 0x22, 0x3A, 0x4C, 0x00, 0x0F, 0x9E, 0x00, 0x10, 
+            0x4F, 0x68, 0x6F, 0x73, 0x74, 0x9C, 0x00, 0x0A, 0x00, 0x21, 0x00, 0x0F, 
+            0x9A, 0x00, 0x35, 0x0F, 0x99, 0x00, 0x04, 0xF0, 0x0B, 0x0A, 0x64, 0x65, 
+            0x66, 0x20, 0x24, 0x6D, 0x61, 0x69, 0x6E, 0x28, 0x29, 0x20, 0x7B, 0x0A, 
+            0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x72, 0x67, 0x44, 
+            0x01, 0xA1, 0x24, 0x61, 0x72, 0x67, 0x73, 0x3A, 0x76, 0x61, 0x6C, 0x75, 
+            0xD1, 0x00, 0xC4, 0x73, 0x6B, 0x69, 0x70, 0x5F, 0x66, 0x69, 0x72, 0x73, 
+            0x74, 0x28, 0x31, 0x2E, 0x00, 0x00, 0x02, 0x00, 0x52, 0x65, 0x63, 0x68, 
+            0x6F, 0x20, 0x2E, 0x02, 0x00, 0x36, 0x02, 0xF1, 0x05, 0x69, 0x6E, 0x74, 
+            0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x5F, 0x75, 0x72, 0x6C, 0x28, 0x61, 
+            0x72, 0x67, 0x29, 0x29, 0x3B, 0x5A, 0x00, 0xF0, 0x00, 0x7D, 0x0A, 0x7D, 
+            0x0A, 0x0A, 0x0A, 0x70, 0x75, 0x62, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 
+            0x8B, 0x01, 0x03, 0x74, 0x00, 0x00, 0x14, 0x00, 0x33, 0x76, 0x61, 0x72, 
+            0xB1, 0x01, 0x62, 0x3A, 0x20, 0x73, 0x74, 0x72, 0x3F, 0x34, 0x00, 0x04, 
+            0x1A, 0x00, 0x6F, 0x75, 0x73, 0x65, 0x72, 0x6E, 0x61, 0x1C, 0x00, 0x03, 
+            0x8F, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x38, 0x00, 0x01, 
+            0x00, 0x44, 0x01, 0x0F, 0x18, 0x00, 0x01, 0x00, 0xE7, 0x02, 0x0F, 0x18, 
+            0x00, 0x02, 0x3F, 0x61, 0x74, 0x68, 0x18, 0x00, 0x01, 0x5F, 0x71, 0x75, 
+            0x65, 0x72, 0x79, 0x19, 0x00, 0x01, 0x40, 0x66, 0x72, 0x61, 0x67, 0x5E, 
+            0x02, 0x04, 0x1C, 0x00, 0x01, 0xEA, 0x00, 0x00, 0xB6, 0x00, 0x00, 0x5A, 
+            0x01, 0x00, 0x66, 0x00, 0xF3, 0x01, 0x5F, 0x6E, 0x75, 0x6D, 0x62, 0x65, 
+            0x72, 0x28, 0x29, 0x20, 0x2D, 0x3E, 0x20, 0x69, 0x36, 0x34, 0xF3, 0x00, 
+            0x00, 0x02, 0x00, 0xF0, 0x02, 0x69, 0x66, 0x20, 0x24, 0x69, 0x73, 0x5F, 
+            0x6E, 0x75, 0x6C, 0x6C, 0x28, 0x73, 0x65, 0x6C, 0x66, 0x2E, 0x30, 0x00, 
+            0x08, 0x5A, 0x01, 0x00, 0x02, 0x00, 0x80, 0x24, 0x70, 0x61, 0x6E, 0x69, 
+            0x63, 0x28, 0x22, 0x1C, 0x00, 0x40, 0x20, 0x69, 0x73, 0x20, 0x2E, 0x00, 
+            0x13, 0x22, 0x52, 0x01, 0x00, 0x02, 0x00, 0x12, 0x7D, 0x73, 0x00, 0x00, 
+            0x02, 0x00, 0x35, 0x69, 0x66, 0x20, 0x47, 0x00, 0x95, 0x3A, 0x69, 0x73, 
+            0x5F, 0x65, 0x6D, 0x70, 0x74, 0x79, 0xD9, 0x01, 0x04, 0x02, 0x00, 0x0C, 
+            0x51, 0x00, 0x01, 0x26, 0x00, 0x0F, 0x52, 0x00, 0x04, 0xB7, 0x72, 0x65, 
+            0x74, 0x75, 0x72, 0x6E, 0x20, 0x24, 0x69, 0x36, 0x34, 0xA2, 0x00, 0x02, 
+            0x9B, 0x01, 0x03, 0x79, 0x00, 0x00, 0xE8, 0x00, 0xF3, 0x02, 0x24, 0x6F, 
+            0x70, 0x5F, 0x62, 0x69, 0x6E, 0x61, 0x72, 0x79, 0x5F, 0x65, 0x71, 0x75, 
+            0x61, 0x6C, 0x73, 0x07, 0x00, 0xB1, 0x28, 0x6F, 0x74, 0x68, 0x65, 0x72, 
+            0x3A, 0x20, 0x61, 0x6E, 0x79, 0xFF, 0x00, 0x4A, 0x62, 0x6F, 0x6F, 0x6C, 
+            0x00, 0x01, 0x10, 0x21, 0x01, 0x01, 0xC1, 0x69, 0x6E, 0x73, 0x74, 0x61, 
+            0x6E, 0x63, 0x65, 0x5F, 0x6F, 0x66, 0x5F, 0x1B, 0x02, 0x02, 0x38, 0x00, 
+            0x10, 0x2C, 0x22, 0x02, 0x0C, 0x0F, 0x01, 0x03, 0x92, 0x00, 0x52, 0x66, 
+            0x61, 0x6C, 0x73, 0x65, 0x88, 0x00, 0x00, 0x02, 0x00, 0x03, 0x8C, 0x00, 
+            0x00, 0x02, 0x00, 0x02, 0x21, 0x00, 0x05, 0x14, 0x01, 0x00, 0x02, 0x00, 
+            0x01, 0x15, 0x01, 0x02, 0xEA, 0x03, 0x41, 0x20, 0x3D, 0x3D, 0x20, 0x95, 
+            0x00, 0x04, 0x10, 0x00, 0x2E, 0x26, 0x26, 0x2B, 0x00, 0x04, 0x6D, 0x02, 
+            0x06, 0x2D, 0x00, 0x05, 0x12, 0x00, 0x0F, 0x2F, 0x00, 0x01, 0x04, 0x80, 
+            0x02, 0x06, 0x2F, 0x00, 0x05, 0x12, 0x00, 0x0F, 0x2F, 0x00, 0x01, 0x00, 
+            0x93, 0x02, 0x06, 0x2B, 0x00, 0x01, 0x0E, 0x00, 0x0F, 0x27, 0x00, 0x01, 
+            0x01, 0xF0, 0x01, 0x05, 0xAE, 0x00, 0x01, 0x0E, 0x00, 0x0F, 0x27, 0x00, 
+            0x02, 0x36, 0x61, 0x74, 0x68, 0x4E, 0x00, 0x01, 0x0E, 0x00, 0x0F, 0x27, 
+            0x00, 0x01, 0x01, 0xC0, 0x02, 0x06, 0x28, 0x00, 0x02, 0x0F, 0x00, 0x0F, 
+            0x29, 0x00, 0x01, 0x04, 0xD0, 0x02, 0x06, 0x2C, 0x00, 0x04, 0x12, 0x00, 
+            0x02, 0x6E, 0x01, 0x06, 0xC5, 0x03, 0x00, 0xF9, 0x01, 0x00, 0x9D, 0x05, 
+            0x01, 0xF6, 0x05, 0x62, 0x65, 0x28, 0x69, 0x6E, 0x70, 0x75, 0x06, 0x03, 
+            0x01, 0xEB, 0x01, 0x33, 0x73, 0x74, 0x72, 0xEA, 0x01, 0x04, 0xE6, 0x01, 
+            0x32, 0x73, 0x74, 0x72, 0x25, 0x00, 0x08, 0xD3, 0x01, 0x04, 0x8D, 0x02, 
+            0x07, 0x49, 0x00, 0x51, 0x29, 0x3A, 0x20, 0x69, 0x6E, 0x9E, 0x05, 0x00, 
+            0x88, 0x04, 0x10, 0x75, 0x5D, 0x03, 0xF0, 0x02, 0x20, 0x74, 0x79, 0x70, 
+            0x65, 0x2C, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 
+            0x61, 0xEA, 0x03, 0xC0, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x67, 0x6F, 0x74, 
+            0x20, 0x24, 0x7B, 0x24, 0x20, 0x00, 0x03, 0x5D, 0x00, 0x14, 0x7D, 0xCB, 
+            0x02, 0x03, 0x14, 0x02, 0x00, 0x58, 0x04, 0xA1, 0x62, 0x75, 0x66, 0x20, 
+            0x3D, 0x20, 0x24, 0x62, 0x75, 0x66, 0x2D, 0x06, 0x00, 0x14, 0x02, 0x00, 
+            0xE7, 0x04, 0x40, 0x62, 0x79, 0x74, 0x65, 0xE8, 0x04, 0x02, 0xBB, 0x00, 
+            0x00, 0x0E, 0x00, 0x19, 0x73, 0x2E, 0x03, 0x21, 0x69, 0x66, 0x50, 0x06, 
+            0x82, 0x20, 0x3C, 0x20, 0x33, 0x32, 0x20, 0x7C, 0x7C, 0x0D, 0x00, 0x53, 
+            0x3E, 0x20, 0x31, 0x32, 0x36, 0xDB, 0x00, 0x04, 0x02, 0x00, 0xF1, 0x05, 
+            0x62, 0x75, 0x66, 0x3A, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x22, 0x25, 
+            0x7B, 0x3A, 0x30, 0x32, 0x58, 0x7D, 0x22, 0x2C, 0x2E, 0x00, 0x08, 0xA8, 
+            0x03, 0x55, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x54, 0x00, 0x2A, 0x69, 0x6E, 
+            0x22, 0x07, 0x01, 0x7E, 0x00, 0x0F, 0x57, 0x00, 0x27, 0x02, 0xBC, 0x05, 
+            0x04, 0x02, 0x00, 0x05, 0x90, 0x00, 0x01, 0x3F, 0x06, 0x10, 0x28, 0x5C, 
+            0x00, 0x08, 0x8A, 0x00, 0x01, 0xF2, 0x02, 0x03, 0x1F, 0x01, 0x02, 0x2F, 
+            0x03, 0x01, 0x32, 0x00, 0x00, 0x4F, 0x07, 0x20, 0x74, 0x72, 0x22, 0x01, 
+            0x04, 0xA8, 0x05, 0x04, 0xE3, 0x01, 0x2F, 0x64, 0x65, 0xE3, 0x01, 0x04, 
+            0x3F, 0x7C, 0x65, 0x72, 0xE7, 0x01, 0x1E, 0x03, 0x4D, 0x00, 0x0F, 0xE7, 
+            0x01, 0x40, 0x92, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x3D, 0x20, 0x30, 
+            0xAB, 0x02, 0x00, 0xFA, 0x01, 0x30, 0x63, 0x6F, 0x75, 0xCC, 0x02, 0x03, 
+            0xE3, 0x01, 0x01, 0x0E, 0x00, 0x00, 0xE1, 0x00, 0x00, 0x29, 0x01, 0x00, 
+            0x1F, 0x00, 0x0F, 0x19, 0x02, 0x00, 0x40, 0x77, 0x68, 0x69, 0x6C, 0x9F, 
+            0x01, 0x00, 0x4B, 0x00, 0x21, 0x3C, 0x20, 0x32, 0x00, 0x07, 0x97, 0x01, 
+            0x00, 0x35, 0x00, 0x00, 0xCD, 0x08, 0x04, 0x53, 0x00, 0x11, 0x5B, 0x29, 
+            0x00, 0x13, 0x5D, 0xF8, 0x05, 0x00, 0x02, 0x00, 0x23, 0x69, 0x66, 0x21, 
+            0x00, 0x57, 0x3D, 0x20, 0x22, 0x2B, 0x22, 0x3B, 0x00, 0x00, 0x02, 0x00, 
+            0x00, 0x67, 0x01, 0x03, 0x29, 0x02, 0x27, 0x20, 0x22, 0x93, 0x01, 0x00, 
+            0x02, 0x00, 0x01, 0x4A, 0x00, 0x52, 0x20, 0x2B, 0x3D, 0x20, 0x31, 0xA0, 
+            0x00, 0x04, 0x02, 0x00, 0x7F, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 
+            0xEE, 0x04, 0x03, 0x08, 0x6E, 0x00, 0x1C, 0x25, 0x6E, 0x00, 0x00, 0x1D, 
+            0x00, 0x01, 0x00, 0x01, 0x13, 0x2D, 0x5D, 0x00, 0x3B, 0x3C, 0x20, 0x33, 
+            0x91, 0x00, 0x00, 0x02, 0x00, 0x03, 0x03, 0x02, 0x31, 0x24, 0x65, 0x72, 
+            0xFD, 0x01, 0x00, 0x13, 0x00, 0x04, 0x02, 0x00, 0x03, 0x25, 0x02, 0x04, 
+            0x02, 0x00, 0x00, 0xFE, 0x00, 0x01, 0x0F, 0x08, 0x62, 0x20, 0x3D, 0x20, 
+            0x74, 0x72, 0x79, 0x18, 0x06, 0x63, 0x22, 0x30, 0x78, 0x22, 0x20, 0x2B, 
+            0x62, 0x01, 0x40, 0x73, 0x6C, 0x69, 0x63, 0x0C, 0x04, 0x01, 0xCB, 0x00, 
+            0x54, 0x20, 0x31, 0x2C, 0x20, 0x32, 0xFE, 0x07, 0x04, 0x02, 0x00, 0x03, 
+            0xF5, 0x06, 0x00, 0x6D, 0x00, 0x01, 0x4B, 0x00, 0x08, 0x0E, 0x04, 0x04, 
+            0x02, 0x00, 0x0F, 0x92, 0x00, 0x17, 0x05, 0x51, 0x01, 0x02, 0xEA, 0x02, 
+            0x02, 0x52, 0x00, 0x0A, 0xC4, 0x00, 0x03, 0x8D, 0x00, 0x3A, 0x3D, 0x20, 
+            0x33, 0x18, 0x00, 0x0F, 0x58, 0x01, 0x12, 0x0C, 0xA7, 0x03, 0x00, 0xDB, 
+            0x01, 0x1B, 0x73, 0x44, 0x01, 0x08, 0xAE, 0x00, 0x01, 0xC9, 0x04, 0x0E, 
+            0xE2, 0x02, 0x00, 0x37, 0x00, 0xC1, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 
+            0x27, 0x7B, 0x7D, 0x27, 0x22, 0x2C, 0x23, 0x02, 0x07, 0x00, 0x02, 0x07, 
+            0x68, 0x01, 0x05, 0xD2, 0x00, 0x10, 0x28, 0x35, 0x00, 0x07, 0x24, 0x00, 
+            0x05, 0xC8, 0x00, 0x03, 0x20, 0x02, 0x03, 0x34, 0x00, 0x03, 0x7E, 0x00, 
+            0x00, 0x37, 0x00, 0x0F, 0xC1, 0x03, 0x03, 0x02, 0x8C, 0x09, 0x01, 0xF2, 
+            0x05, 0x02, 0x23, 0x05, 0x06, 0xA5, 0x05, 0xF0, 0x01, 0x65, 0x72, 0x72, 
+            0x7C, 0x6D, 0x61, 0x70, 0x5B, 0x73, 0x74, 0x72, 0x2C, 0x20, 0x76, 0x65, 
+            0x63, 0x09, 0x00, 0x23, 0x5D, 0x5D, 0xDF, 0x00, 0x0F, 0xB8, 0x05, 0x12, 
+            0x08, 0x5D, 0x00, 0x0F, 0xD2, 0x03, 0x40, 0x01, 0xB6, 0x00, 0x04, 0x6C, 
+            0x03, 0x10, 0x3A, 0xB2, 0x01, 0xC4, 0x61, 0x69, 0x6E, 0x73, 0x28, 0x22, 
+            0x3F, 0x22, 0x29, 0x20, 0x3A, 0x3F, 0x74, 0x02, 0x41, 0x70, 0x6C, 0x69, 
+            0x74, 0x14, 0x00, 0x62, 0x5B, 0x31, 0x5D, 0x20, 0x3A, 0x7C, 0x17, 0x00, 
+            0x02, 0xED, 0x01, 0x00, 0xB2, 0x02, 0x40, 0x64, 0x61, 0x74, 0x61, 0xFF, 
+            0x05, 0x30, 0x6D, 0x61, 0x70, 0xFC, 0x03, 0x01, 0xFE, 0x04, 0x00, 0xFF, 
+            0x05, 0x04, 0x18, 0x0C, 0x22, 0x69, 0x6E, 0x68, 0x00, 0x04, 0x49, 0x00, 
+            0x28, 0x26, 0x22, 0x94, 0x02, 0x24, 0x69, 0x66, 0xA5, 0x0B, 0x07, 0x80, 
+            0x00, 0x19, 0x3D, 0x23, 0x00, 0x00, 0x02, 0x00, 0x00, 0x69, 0x00, 0x40, 
+            0x70, 0x61, 0x72, 0x74, 0x46, 0x0C, 0x03, 0x59, 0x00, 0x04, 0x50, 0x00, 
+            0x20, 0x3D, 0x22, 0xA2, 0x0C, 0x00, 0x25, 0x00, 0x04, 0x02, 0x00, 0x00, 
+            0x2D, 0x00, 0x33, 0x6B, 0x65, 0x79, 0xDE, 0x0C, 0x03, 0x2F, 0x02, 0x01, 
+            0x3E, 0x00, 0x37, 0x5B, 0x30, 0x5D, 0xF3, 0x01, 0x00, 0x02, 0x00, 0x03, 
+            0x25, 0x0A, 0x83, 0x65, 0x72, 0x72, 0x28, 0x6B, 0x65, 0x79, 0x29, 0x9D, 
+            0x01, 0x08, 0x02, 0x00, 0x03, 0x02, 0x02, 0x01, 0xC0, 0x03, 0x0F, 0x91, 
+            0x01, 0x05, 0x00, 0x6E, 0x00, 0x03, 0x7B, 0x02, 0x00, 0x46, 0x00, 0x02, 
+            0x1D, 0x01, 0x04, 0x02, 0x00, 0x03, 0x4A, 0x02, 0x04, 0x02, 0x00, 0x00, 
+            0x9E, 0x00, 0x01, 0x49, 0x03, 0x0F, 0xA0, 0x00, 0x01, 0x1F, 0x31, 0xA0, 
+            0x00, 0x08, 0x01, 0x35, 0x00, 0x0F, 0xA2, 0x00, 0x25, 0x01, 0x3D, 0x00, 
+            0x04, 0x1F, 0x03, 0x01, 0x0D, 0x00, 0x0B, 0x09, 0x01, 0x0F, 0xA6, 0x00, 
+            0x05, 0x00, 0x72, 0x01, 0x00, 0xE3, 0x01, 0x5A, 0x5B, 0x6B, 0x65, 0x79, 
+            0x5D, 0xD9, 0x00, 0x07, 0x3C, 0x01, 0x01, 0x52, 0x00, 0x1F, 0x73, 0x9D, 
+            0x00, 0x01, 0x05, 0x3C, 0x00, 0x41, 0x20, 0x3D, 0x20, 0x5B, 0x27, 0x00, 
+            0x0B, 0x46, 0x00, 0x03, 0xBA, 0x07, 0x11, 0x7B, 0x39, 0x02, 0x08, 0x02, 
+            0x00, 0x01, 0x2D, 0x00, 0x91, 0x73, 0x3A, 0x61, 0x70, 0x70, 0x65, 0x6E, 
+            0x64, 0x28, 0x0E, 0x00, 0x0D, 0xB4, 0x00, 0x04, 0x30, 0x00, 0x02, 0x0A, 
+            0x00, 0x03, 0xC4, 0x00, 0x03, 0xB2, 0x01, 0x00, 0x7A, 0x00, 0x02, 0x6D, 
+            0x07, 0x0B, 0x63, 0x0F, 0xE1, 0x77, 0x77, 0x77, 0x2E, 0x72, 0x66, 0x63, 
+            0x2D, 0x65, 0x64, 0x69, 0x74, 0x6F, 0x72, 0x65, 0x0F, 0xF1, 0x00, 0x72, 
+            0x66, 0x63, 0x2F, 0x72, 0x66, 0x63, 0x33, 0x39, 0x38, 0x36, 0x2E, 0x74, 
+            0x78, 0x74, 0x47, 0x0D, 0x06, 0xDE, 0x03, 0x00, 0x6A, 0x0D, 0x02, 0xE3, 
+            0x06, 0x00, 0x1A, 0x09, 0x01, 0x81, 0x09, 0x3F, 0x55, 0x52, 0x4C, 0x9E, 
+            0x07, 0x1D, 0x02, 0x3C, 0x02, 0x00, 0x4C, 0x00, 0x0F, 0xCB, 0x03, 0x3C, 
+            0x22, 0x69, 0x66, 0x94, 0x03, 0x0F, 0x95, 0x0C, 0x03, 0x03, 0x0E, 0x01, 
+            0x02, 0xC0, 0x02, 0x04, 0xFB, 0x09, 0x30, 0x75, 0x72, 0x6C, 0x08, 0x0A, 
+            0x21, 0x70, 0x75, 0xF5, 0x0C, 0x22, 0x61, 0x6E, 0xA7, 0x0C, 0x00, 0xDE, 
+            0x00, 0x30, 0x69, 0x6E, 0x67, 0x51, 0x03, 0x00, 0x59, 0x01, 0x03, 0x4F, 
+            0x01, 0x00, 0xB1, 0x02, 0x50, 0x75, 0x72, 0x6C, 0x20, 0x3D, 0x31, 0x0C, 
+            0x05, 0xE3, 0x03, 0x05, 0x75, 0x00, 0x20, 0x73, 0x74, 0x98, 0x03, 0x89, 
+            0x5F, 0x77, 0x69, 0x74, 0x68, 0x28, 0x22, 0x2F, 0xBA, 0x03, 0x03, 0x7B, 
+            0x00, 0x02, 0xF9, 0x00, 0x00, 0x3D, 0x0B, 0x11, 0x5F, 0x0A, 0x04, 0x14, 
+            0x5F, 0xF4, 0x0A, 0x52, 0x28, 0x75, 0x72, 0x6C, 0x2C, 0xBC, 0x00, 0x33, 
+            0x2C, 0x20, 0x30, 0xDD, 0x01, 0x03, 0x76, 0x00, 0x09, 0x3C, 0x00, 0x72, 
+            0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x3E, 0x01, 0x06, 0x35, 0x00, 
+            0x12, 0x29, 0xDF, 0x01, 0x06, 0xA9, 0x01, 0x0C, 0x28, 0x00, 0x10, 0x3A, 
+            0xB3, 0x00, 0x03, 0x62, 0x00, 0x06, 0x98, 0x05, 0x00, 0xBC, 0x01, 0x16, 
+            0x20, 0x5B, 0x09, 0x40, 0x61, 0x73, 0x73, 0x65, 0xFD, 0x0D, 0x01, 0x62, 
+            0x0B, 0x01, 0x92, 0x08, 0x40, 0x28, 0x29, 0x20, 0x3E, 0xE7, 0x08, 0x01, 
+            0x93, 0x02, 0x00, 0x6E, 0x11, 0x01, 0x16, 0x00, 0x07, 0x29, 0x05, 0x01, 
+            0x24, 0x00, 0x02, 0x25, 0x01, 0x00, 0x1E, 0x01, 0x52, 0x6E, 0x65, 0x78, 
+            0x74, 0x5F, 0x41, 0x06, 0x09, 0x1F, 0x09, 0xC0, 0x68, 0x61, 0x73, 0x5F, 
+            0x61, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x74, 0x8F, 0x04, 0x03, 0x57, 
+            0x0D, 0x01, 0x57, 0x00, 0x30, 0x23, 0x20, 0x50, 0xC6, 0x0F, 0x07, 0x4A, 
+            0x11, 0x11, 0x2E, 0x18, 0x00, 0x47, 0x6C, 0x6F, 0x6F, 0x70, 0x86, 0x04, 
+            0x05, 0x5F, 0x00, 0x00, 0x66, 0x0A, 0x05, 0x82, 0x00, 0x00, 0x0D, 0x00, 
+            0x16, 0x28, 0x76, 0x00, 0x08, 0x01, 0x05, 0x31, 0x69, 0x66, 0x20, 0x19, 
+            0x00, 0x00, 0x23, 0x00, 0x77, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x3A, 0x27, 
+            0x4F, 0x00, 0x00, 0x02, 0x00, 0x04, 0x22, 0x00, 0x03, 0xB1, 0x00, 0x3B, 
+            0x3D, 0x20, 0x30, 0x21, 0x00, 0x00, 0x02, 0x00, 0x03, 0x7F, 0x01, 0x0F, 
+            0x36, 0x02, 0x00, 0x03, 0xDA, 0x0D, 0x0F, 0xDB, 0x0E, 0x01, 0x00, 0x02, 
+            0x00, 0x1A, 0x7D, 0x8C, 0x05, 0x34, 0x75, 0x72, 0x6C, 0x0C, 0x0E, 0x13, 
+            0x3D, 0x63, 0x01, 0x02, 0xC5, 0x08, 0x22, 0x30, 0x2C, 0xA8, 0x00, 0x01, 
+            0x86, 0x00, 0x03, 0xFB, 0x01, 0x04, 0x02, 0x00, 0x01, 0xC1, 0x00, 0x01, 
+            0x19, 0x00, 0x00, 0x59, 0x08, 0x03, 0x91, 0x07, 0x04, 0x02, 0x00, 0x52, 
+            0x62, 0x72, 0x65, 0x61, 0x6B, 0x7C, 0x01, 0x00, 0x02, 0x00, 0x07, 0x70, 
+            0x00, 0x00, 0x53, 0x07, 0x01, 0xDA, 0x0C, 0x09, 0x78, 0x12, 0x06, 0x58, 
+            0x06, 0x01, 0x57, 0x00, 0x00, 0x18, 0x01, 0x0C, 0xA8, 0x04, 0x0F, 0xED, 
+            0x00, 0x0E, 0x04, 0x1B, 0x07, 0x05, 0x3B, 0x0D, 0x00, 0x3D, 0x08, 0x01, 
+            0x72, 0x08, 0xB3, 0x3A, 0x20, 0x24, 0x7B, 0x64, 0x65, 0x73, 0x63, 0x72, 
+            0x69, 0x62, 0x25, 0x09, 0x06, 0x66, 0x00, 0x05, 0x2C, 0x0D, 0x00, 0x02, 
+            0x00, 0x07, 0xA8, 0x00, 0x01, 0x22, 0x00, 0x08, 0xDF, 0x00, 0x01, 0xF9, 
+            0x01, 0x00, 0x02, 0x00, 0x0D, 0x9B, 0x01, 0x01, 0x6B, 0x02, 0x0B, 0x9F, 
+            0x01, 0x0F, 0xAE, 0x00, 0x07, 0x92, 0x66, 0x61, 0x69, 0x6C, 0x65, 0x64, 
+            0x20, 0x74, 0x6F, 0x73, 0x03, 0x03, 0xF1, 0x11, 0x45, 0x2C, 0x20, 0x75, 
+            0x6E, 0xDC, 0x0D, 0x30, 0x65, 0x6E, 0x64, 0xAA, 0x13, 0x01, 0xFB, 0x03, 
+            0x04, 0xE8, 0x03, 0x00, 0x02, 0x00, 0x09, 0x41, 0x05, 0x08, 0x9C, 0x02, 
+            0x05, 0xC0, 0x02, 0x40, 0x2C, 0x20, 0x69, 0x66, 0x88, 0x12, 0x42, 0x73, 
+            0x65, 0x6E, 0x74, 0xAB, 0x02, 0x05, 0x03, 0x04, 0x40, 0x6D, 0x61, 0x74, 
+            0x63, 0xFD, 0x03, 0x29, 0x2F, 0x22, 0xD5, 0x01, 0x07, 0xB8, 0x00, 0x0C, 
+            0x0A, 0x03, 0x28, 0x74, 0x72, 0x72, 0x0B, 0x0A, 0x11, 0x01, 0x17, 0x32, 
+            0x11, 0x01, 0x51, 0x23, 0x20, 0x54, 0x68, 0x65, 0x29, 0x02, 0x70, 0x20, 
+            0x73, 0x6C, 0x61, 0x73, 0x68, 0x2C, 0x4C, 0x08, 0xD1, 0x73, 0x74, 0x69, 
+            0x6F, 0x6E, 0x2D, 0x6D, 0x61, 0x72, 0x6B, 0x2C, 0x20, 0x6F, 0x66, 0x03, 
+            0xF0, 0x01, 0x68, 0x2D, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 
+            0x65, 0x72, 0x6D, 0x69, 0x6E, 0x61, 0xDC, 0x14, 0x00, 0xA3, 0x14, 0x05, 
+            0xBD, 0x00, 0x02, 0xB1, 0x00, 0x00, 0x02, 0x00, 0x00, 0x51, 0x03, 0x30, 
+            0x65, 0x6E, 0x64, 0x0D, 0x11, 0x05, 0x1E, 0x00, 0x05, 0xBC, 0x03, 0x01, 
+            0x6F, 0x01, 0x07, 0x7F, 0x00, 0x21, 0x69, 0x66, 0xFF, 0x03, 0x45, 0x68, 
+            0x61, 0x73, 0x68, 0x24, 0x00, 0x01, 0x3B, 0x01, 0x11, 0x3A, 0xBF, 0x01, 
+            0x6A, 0x5F, 0x6F, 0x66, 0x28, 0x22, 0x23, 0xF5, 0x00, 0x12, 0x3B, 0x75, 
+            0x11, 0x00, 0x51, 0x08, 0x06, 0x37, 0x00, 0x0C, 0x71, 0x02, 0x0F, 0x81, 
+            0x00, 0x06, 0x06, 0x33, 0x00, 0x0F, 0xE2, 0x02, 0x05, 0x01, 0x90, 0x00, 
+            0x3F, 0x6F, 0x6F, 0x6B, 0x90, 0x00, 0x06, 0x1F, 0x3F, 0x90, 0x00, 0x07, 
+            0x05, 0x37, 0x00, 0x48, 0x29, 0x20, 0x26, 0x26, 0x46, 0x00, 0x1F, 0x3C, 
+            0x92, 0x00, 0x05, 0x0A, 0x96, 0x07, 0x0F, 0x25, 0x00, 0x04, 0x17, 0x3D, 
+            0x4B, 0x00, 0x0F, 0xB7, 0x00, 0x09, 0x01, 0xC2, 0x01, 0x0F, 0xB8, 0x00, 
+            0x06, 0x0B, 0x3D, 0x02, 0x07, 0x48, 0x01, 0x07, 0x38, 0x00, 0x01, 0xB9, 
+            0x00, 0x07, 0x10, 0x00, 0x0F, 0xBA, 0x00, 0x2E, 0x07, 0x4C, 0x00, 0x0F, 
+            0xBB, 0x00, 0x02, 0x08, 0x0B, 0x03, 0x00, 0xA7, 0x12, 0x4E, 0x69, 0x6E, 
+            0x66, 0x6F, 0x0A, 0x03, 0x00, 0x02, 0x00, 0x03, 0x2C, 0x02, 0x14, 0x61, 
+            0xDB, 0x03, 0x0E, 0x2A, 0x02, 0x1F, 0x40, 0x9A, 0x01, 0x06, 0x04, 0x35, 
+            0x00, 0x01, 0xDF, 0x00, 0x04, 0x0D, 0x00, 0x0F, 0xDC, 0x00, 0x15, 0x03, 
+            0x79, 0x00, 0x5F, 0x63, 0x6F, 0x6C, 0x6F, 0x6E, 0x5E, 0x01, 0x06, 0x1F, 
+            0x3A, 0x7C, 0x00, 0x06, 0x07, 0x38, 0x00, 0x01, 0x7F, 0x00, 0x07, 0x10, 
+            0x00, 0x26, 0x20, 0x3C, 0x8D, 0x00, 0x0A, 0x0A, 0x02, 0x00, 0x02, 0x00, 
+            0x00, 0xDB, 0x05, 0x00, 0x13, 0x01, 0x02, 0xCC, 0x13, 0x09, 0xDD, 0x05, 
+            0x06, 0xD1, 0x03, 0x19, 0x2C, 0x50, 0x00, 0x11, 0x2D, 0xCB, 0x03, 0x02, 
+            0xA5, 0x00, 0x0B, 0xF4, 0x05, 0x00, 0x02, 0x00, 0x00, 0x52, 0x00, 0x05, 
+            0xDD, 0x13, 0x04, 0x40, 0x01, 0x02, 0x2F, 0x06, 0x08, 0x46, 0x00, 0x01, 
+            0xFA, 0x0E, 0x05, 0x99, 0x00, 0x2C, 0x2D, 0x20, 0x1D, 0x00, 0x0C, 0x14, 
+            0x0F, 0x0F, 0x62, 0x0A, 0x06, 0x00, 0x70, 0x00, 0x0F, 0xC2, 0x00, 0x10, 
+            0x07, 0x6B, 0x00, 0x06, 0xD9, 0x00, 0x0B, 0xBF, 0x00, 0x15, 0x7D, 0xC4, 
+            0x05, 0x00, 0x02, 0x00, 0x06, 0x27, 0x00, 0x26, 0x20, 0x3D, 0x43, 0x01, 
+            0x18, 0x2B, 0x7C, 0x10, 0x07, 0x10, 0x06, 0x08, 0x64, 0x02, 0x33, 0x68, 
+            0x6F, 0x73, 0x5E, 0x05, 0x00, 0x02, 0x00, 0x00, 0xAD, 0x04, 0x00, 0x3B, 
+            0x05, 0x01, 0xA0, 0x14, 0x05, 0x40, 0x08, 0x00, 0x1A, 0x00, 0x00, 0x02, 
+            0x00, 0x00, 0x1E, 0x00, 0x01, 0x7E, 0x09, 0x02, 0x51, 0x01, 0x27, 0x20, 
+            0x3D, 0x5E, 0x01, 0x0A, 0xC5, 0x04, 0x02, 0xB4, 0x04, 0x03, 0xA7, 0x05, 
+            0x1A, 0x5B, 0x0B, 0x02, 0x07, 0xA6, 0x05, 0x00, 0x02, 0x00, 0x04, 0x8D, 
+            0x00, 0xF0, 0x00, 0x61, 0x6E, 0x20, 0x49, 0x50, 0x76, 0x36, 0x20, 0x61, 
+            0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0xC9, 0x13, 0xF6, 0x00, 0x73, 0x71, 
+            0x75, 0x61, 0x72, 0x65, 0x20, 0x62, 0x72, 0x61, 0x63, 0x6B, 0x65, 0x74, 
+            0x73, 0x54, 0x05, 0x00, 0x02, 0x00, 0x00, 0x98, 0x04, 0x03, 0x1A, 0x00, 
+            0x05, 0x8F, 0x00, 0x02, 0x77, 0x00, 0x06, 0x2B, 0x05, 0x10, 0x5D, 0x72, 
+            0x06, 0x09, 0x29, 0x01, 0x07, 0x43, 0x0C, 0x09, 0x3D, 0x00, 0x11, 0x29, 
+            0x11, 0x14, 0x02, 0x69, 0x00, 0x03, 0x4F, 0x00, 0x2F, 0x3E, 0x3D, 0xA5, 
+            0x04, 0x13, 0x00, 0x02, 0x00, 0x0F, 0x23, 0x07, 0x17, 0x00, 0x70, 0x01, 
+            0xA1, 0x3A, 0x20, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0xA1, 
+            0x00, 0x00, 0x41, 0x00, 0x04, 0x02, 0x00, 0x07, 0xA6, 0x01, 0x00, 0x02, 
+            0x00, 0x00, 0x31, 0x02, 0x00, 0x32, 0x00, 0x0B, 0xEF, 0x02, 0x08, 0x85, 
+            0x01, 0x01, 0x9D, 0x02, 0x09, 0xCC, 0x00, 0x38, 0x20, 0x2D, 0x20, 0x21, 
+            0x00, 0x3B, 0x2D, 0x20, 0x31, 0x3C, 0x02, 0x09, 0x2E, 0x02, 0x0A, 0x3B, 
+            0x00, 0x01, 0x33, 0x02, 0x0C, 0x32, 0x01, 0x02, 0x57, 0x01, 0x03, 0xCE, 
+            0x01, 0x0B, 0xD9, 0x03, 0x0B, 0xCE, 0x01, 0x00, 0x02, 0x00, 0x07, 0x41, 
+            0x02, 0x0A, 0x77, 0x07, 0x00, 0x02, 0x00, 0x06, 0xB8, 0x02, 0x0F, 0x26, 
+            0x03, 0x02, 0x0A, 0x0E, 0x02, 0x15, 0x34, 0x0E, 0x02, 0x00, 0xC6, 0x1A, 
+            0x10, 0x20, 0x0A, 0x01, 0x24, 0x6E, 0x61, 0xB9, 0x0A, 0x04, 0x02, 0x00, 
+            0x0B, 0xC1, 0x0A, 0x04, 0x02, 0x00, 0x0D, 0xDB, 0x08, 0x0F, 0x4D, 0x06, 
+            0x04, 0x0E, 0x68, 0x04, 0x00, 0x02, 0x00, 0x0F, 0x79, 0x01, 0x0F, 0x08, 
+            0x7A, 0x08, 0x0A, 0x72, 0x01, 0x0B, 0x6E, 0x01, 0x04, 0x02, 0x00, 0x0B, 
+            0x48, 0x0A, 0x04, 0x02, 0x00, 0x0B, 0xF2, 0x01, 0x00, 0x02, 0x00, 0x00, 
+            0x68, 0x03, 0x01, 0xA4, 0x01, 0x00, 0x3C, 0x0A, 0x05, 0xFB, 0x01, 0x00, 
+            0x0D, 0x00, 0x0F, 0x84, 0x0B, 0x04, 0x04, 0x02, 0x00, 0x04, 0xF4, 0x00, 
+            0x00, 0x2B, 0x00, 0x00, 0x69, 0x0B, 0x0E, 0x8C, 0x0B, 0x04, 0x02, 0x00, 
+            0x0F, 0xA4, 0x01, 0x0A, 0x04, 0x02, 0x00, 0x0F, 0x05, 0x01, 0x6A, 0x06, 
+            0x5D, 0x0B, 0x00, 0xF7, 0x01, 0x01, 0xEB, 0x0A, 0x0F, 0x5B, 0x0B, 0x11, 
+            0x04, 0x02, 0x00, 0x0F, 0x92, 0x03, 0x07, 0x00, 0x4F, 0x00, 0x0F, 0x61, 
+            0x0B, 0x31, 0x04, 0x02, 0x00, 0x0F, 0xC1, 0x01, 0x00, 0x01, 0xBD, 0x01, 
+            0x01, 0x87, 0x04, 0x0F, 0x50, 0x0C, 0x00, 0x07, 0x02, 0x03, 0x06, 0x6A, 
+            0x03, 0x04, 0xF8, 0x02, 0x00, 0x45, 0x0A, 0x01, 0x7D, 0x05, 0x02, 0x67, 
+            0x1C, 0x0F, 0xFA, 0x07, 0x06, 0x05, 0xC0, 0x01, 0x0A, 0xBF, 0x02, 0x0F, 
+            0x79, 0x00, 0x0A, 0x08, 0x15, 0x04, 0x0F, 0xBB, 0x05, 0x04, 0x00, 0x02, 
+            0x00, 0x02, 0x32, 0x17, 0x07, 0x4A, 0x00, 0x0E, 0x37, 0x17, 0x04, 0x02, 
+            0x00, 0x00, 0x84, 0x05, 0x01, 0x29, 0x00, 0x02, 0x71, 0x02, 0x03, 0x93, 
+            0x07, 0x00, 0x0D, 0x00, 0x0F, 0xA9, 0x02, 0x19, 0x50, 0x3C, 0x20, 0x27, 
+            0x30, 0x27, 0x80, 0x05, 0x06, 0x4B, 0x00, 0x4C, 0x3E, 0x20, 0x27, 0x39, 
+            0x47, 0x0E, 0x04, 0x02, 0x00, 0x0F, 0x48, 0x03, 0x17, 0x01, 0x50, 0x00, 
+            0x0F, 0x87, 0x01, 0x07, 0x05, 0x7D, 0x01, 0x00, 0x02, 0x00, 0x00, 0xEC, 
+            0x02, 0x01, 0x79, 0x01, 0x04, 0x46, 0x06, 0x02, 0x07, 0x08, 0x07, 0x34, 
+            0x01, 0x0F, 0xF1, 0x03, 0x0A, 0x09, 0x4C, 0x00, 0x11, 0x69, 0x4A, 0x1B, 
+            0x01, 0xFF, 0x1D, 0x0F, 0x23, 0x11, 0x03, 0x04, 0x02, 0x00, 0x0F, 0xA5, 
+            0x02, 0x07, 0x02, 0x1F, 0x11, 0x00, 0x91, 0x00, 0x00, 0xC3, 0x06, 0x04, 
+            0x30, 0x00, 0x00, 0x02, 0x00, 0x08, 0x3F, 0x02, 0x02, 0x10, 0x00, 0x01, 
+            0x7C, 0x00, 0x04, 0xFB, 0x03, 0x02, 0xEF, 0x00, 0x13, 0x3D, 0x5B, 0x0C, 
+            0x07, 0x9E, 0x05, 0x01, 0xE1, 0x00, 0x00, 0x50, 0x1C, 0x46, 0x3D, 0x20, 
+            0x22, 0x22, 0x53, 0x00, 0x03, 0x83, 0x00, 0x32, 0x75, 0x72, 0x6C, 0x14, 
+            0x00, 0x03, 0x4F, 0x00, 0x85, 0x23, 0x20, 0x49, 0x66, 0x20, 0x61, 0x6E, 
+            0x20, 0xB3, 0x0C, 0x70, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x79, 
+            0x21, 0xB1, 0x69, 0x73, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 
+            0x2C, 0x4E, 0x10, 0x00, 0x69, 0x11, 0x07, 0x1F, 0x00, 0x20, 0x6D, 0x75, 
+            0x09, 0x21, 0x10, 0x69, 0x2B, 0x1E, 0x33, 0x20, 0x62, 0x65, 0xE9, 0x11, 
+            0x90, 0x6F, 0x72, 0x20, 0x62, 0x65, 0x67, 0x69, 0x6E, 0x20, 0xB7, 0x11, 
+            0x22, 0x20, 0x61, 0x5D, 0x0D, 0x02, 0xD1, 0x07, 0x03, 0xCE, 0x02, 0x06, 
+            0x6A, 0x00, 0x06, 0xD3, 0x02, 0x0F, 0x60, 0x02, 0x1E, 0x04, 0x06, 0x01, 
+            0x01, 0x0B, 0x1C, 0x60, 0x21, 0x3D, 0x20, 0x27, 0x2F, 0x27, 0x7A, 0x0C, 
+            0x01, 0x09, 0x02, 0x05, 0x14, 0x00, 0x1F, 0x3F, 0x14, 0x00, 0x00, 0x1C, 
+            0x23, 0x6E, 0x02, 0x03, 0x18, 0x01, 0x0F, 0x90, 0x10, 0x00, 0x0F, 0xEF, 
+            0x00, 0x01, 0x0F, 0xE8, 0x00, 0x04, 0x6F, 0x2F, 0x20, 0x77, 0x68, 0x65, 
+            0x6E, 0x48, 0x01, 0x08, 0x98, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 
+            0x65, 0x64, 0xE6, 0x01, 0x09, 0xD8, 0x01, 0x03, 0x88, 0x00, 0x01, 0x60, 
+            0x0F, 0x10, 0x5F, 0x7B, 0x00, 0x0F, 0xD3, 0x12, 0x09, 0x01, 0xE8, 0x00, 
+            0x01, 0x02, 0x02, 0x0D, 0xAA, 0x12, 0x0F, 0x3B, 0x00, 0x04, 0x0D, 0xB1, 
+            0x12, 0x18, 0x2C, 0x3C, 0x08, 0x10, 0x3A, 0xE2, 0x20, 0x05, 0x7F, 0x14, 
+            0x0E, 0xC3, 0x12, 0x07, 0x1E, 0x03, 0x24, 0x20, 0x3C, 0x39, 0x03, 0x01, 
+            0xD4, 0x0E, 0x00, 0xAE, 0x12, 0x01, 0x98, 0x02, 0x00, 0xC3, 0x01, 0x02, 
+            0x85, 0x13, 0x01, 0x98, 0x00, 0x05, 0x25, 0x04, 0x01, 0x0E, 0x00, 0x01, 
+            0xD0, 0x0E, 0x00, 0x40, 0x0E, 0x07, 0x49, 0x00, 0x03, 0x3E, 0x07, 0x00, 
+            0x38, 0x00, 0x04, 0xB7, 0x13, 0x03, 0x91, 0x09, 0x04, 0x61, 0x00, 0x06, 
+            0x3B, 0x00, 0x00, 0x0B, 0x0F, 0x0A, 0x3B, 0x00, 0x01, 0x74, 0x00, 0x11, 
+            0x23, 0xF8, 0x21, 0x11, 0x3F, 0x77, 0x00, 0x14, 0x23, 0x45, 0x00, 0x01, 
+            0x1A, 0x00, 0x00, 0x55, 0x06, 0x00, 0xA3, 0x20, 0x00, 0x2E, 0x0F, 0x01, 
+            0x1F, 0x00, 0x02, 0x5B, 0x00, 0x01, 0x88, 0x0C, 0x05, 0x47, 0x0F, 0x04, 
+            0x32, 0x00, 0x04, 0x1C, 0x00, 0x06, 0x90, 0x02, 0x3A, 0x69, 0x66, 0x20, 
+            0x1D, 0x00, 0x37, 0x20, 0x3C, 0x20, 0x47, 0x00, 0x07, 0x6E, 0x03, 0x00, 
+            0x02, 0x00, 0x03, 0xBB, 0x01, 0x0F, 0x43, 0x02, 0x00, 0x04, 0x45, 0x00, 
+            0xF0, 0x06, 0x2D, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x6F, 0x72, 
+            0x20, 0x28, 0x23, 0x29, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0xF4, 
+            0x10, 0x42, 0x63, 0x65, 0x64, 0x65, 0x5A, 0x00, 0x08, 0x23, 0x00, 0x2E, 
+            0x3F, 0x29, 0x27, 0x02, 0x00, 0x02, 0x00, 0x07, 0xDB, 0x03, 0x02, 0xAB, 
+            0x09, 0x0F, 0xBC, 0x04, 0x00, 0x08, 0xA7, 0x00, 0x09, 0x20, 0x0A, 0x03, 
+            0x70, 0x01, 0x00, 0x02, 0x00, 0x00, 0x48, 0x00, 0x01, 0x28, 0x00, 0x05, 
+            0xA6, 0x01, 0x02, 0x49, 0x00, 0x01, 0x14, 0x00, 0x02, 0x0E, 0x01, 0x02, 
+            0x06, 0x1C, 0x04, 0xC0, 0x00, 0x03, 0x14, 0x00, 0x2C, 0x2D, 0x20, 0x23, 
+            0x00, 0x08, 0x12, 0x0D, 0x00, 0x56, 0x00, 0x04, 0x31, 0x00, 0x0B, 0x59, 
+            0x00, 0x04, 0x17, 0x00, 0x03, 0x48, 0x00, 0x19, 0x2B, 0xAA, 0x0A, 0x03, 
+            0x3F, 0x01, 0x0E, 0x9A, 0x04, 0x00, 0xCB, 0x02, 0x02, 0xDD, 0x01, 0x0F, 
+            0xD4, 0x01, 0x0B, 0x06, 0xB8, 0x01, 0x00, 0x83, 0x00, 0x00, 0x36, 0x00, 
+            0x0B, 0x7F, 0x00, 0x07, 0x3B, 0x02, 0x0F, 0x21, 0x01, 0x3A, 0x07, 0x53, 
+            0x01, 0x0F, 0xC5, 0x00, 0x0A, 0x0F, 0x9C, 0x02, 0x07, 0x0A, 0x19, 0x01, 
+            0x0F, 0xCB, 0x00, 0x1D, 0x0A, 0x3E, 0x00, 0x0F, 0x9D, 0x0A, 0x06, 0x00, 
+            0x16, 0x01, 0x04, 0x2B, 0x00, 0x0B, 0x1A, 0x01, 0x04, 0x17, 0x00, 0x0F, 
+            0x99, 0x01, 0x1F, 0x01, 0x93, 0x01, 0x00, 0x5A, 0x00, 0x0F, 0x70, 0x01, 
+            0x0B, 0x03, 0x23, 0x01, 0x08, 0x1F, 0x01, 0x00, 0xA6, 0x20, 0x00, 0x5A, 
+            0x17, 0x0A, 0xDE, 0x14, 0x00, 0xB6, 0x05, 0x11, 0x5F, 0x8C, 0x19, 0x06, 
+            0x8D, 0x04, 0x09, 0x8D, 0x22, 0x06, 0x21, 0x00, 0x09, 0xD9, 0x21, 0x02, 
+            0x34, 0x00, 0x01, 0xDF, 0x21, 0x17, 0x37, 0x98, 0x03, 0x03, 0x71, 0x00, 
+            0x10, 0x22, 0x36, 0x00, 0x11, 0x20, 0x57, 0x00, 0x50, 0x20, 0x30, 0x78, 
+            0x24, 0x7B, 0x0F, 0x00, 0x02, 0x32, 0x00, 0x11, 0x3B, 0xEF, 0x21, 0x09, 
+            0x0C, 0x07, 0x03, 0xE4, 0x21, 0x02, 0x20, 0x00, 0x01, 0x57, 0x0B, 0x18, 
+            0x20, 0x2E, 0x06, 0x04, 0x53, 0x00, 0x53, 0x73, 0x70, 0x61, 0x63, 0x65, 
+            0x5A, 0x07, 0x03, 0x46, 0x07, 0x0E, 0x3A, 0x00, 0x2F, 0x5C, 0x27, 0x3B, 
+            0x00, 0x02, 0xAF, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x2D, 0x71, 0x75, 0x6F, 
+            0x74, 0x42, 0x00, 0x0E, 0x1F, 0x22, 0x41, 0x00, 0x01, 0x4F, 0x64, 0x6F, 
+            0x75, 0x62, 0x41, 0x00, 0x03, 0x03, 0x9E, 0x00, 0x10, 0x24, 0xAF, 0x23, 
+            0x48, 0x24, 0x72, 0x75, 0x6E, 0x52, 0x01, 0x60, 0x29, 0x29, 0x3B, 0x0A, 
+            0x7D, 0x0A, 
+        },
+        4238,
+        10789,
+    },
+};
+
+static const size_t entry_count = sizeof(entries) / sizeof(Entry);
+
+bool pyro_find_embedded_file(const char* path, const uint8_t** compressed_data, size_t* compressed_bytecount, size_t* uncompressed_bytecount) {
+    for (size_t i = 0; i < entry_count; i++) {
+        Entry entry = entries[i];
+        if (strcmp(path, entry.path) == 0) {
+            *compressed_data = entry.compressed_data;
+            *compressed_bytecount = entry.compressed_bytecount;
+            *uncompressed_bytecount = entry.uncompressed_bytecount;
+            return true;
+        }
+    }
+
+    return false;
+}
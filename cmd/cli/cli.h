@@ -20,6 +20,7 @@ void pyro_cli_set_max_memory(PyroVM* vm, ArgParser* parser);
 void pyro_cli_add_import_roots_from_command_line(PyroVM* vm, ArgParser* parser);
 void pyro_cli_add_import_roots_from_path(PyroVM* vm, const char* path);
 void pyro_cli_add_import_roots_from_environment(PyroVM* vm);
+void pyro_cli_set_bytecode_cache_flag_from_environment(PyroVM* vm);
 char* pyro_cli_sprintf(const char* format_string, ...);
 
 #endif
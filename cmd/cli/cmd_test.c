@@ -14,6 +14,7 @@ int pyro_cli_cmd_test(char* cmd_name, ArgParser* cmd_parser) {
 
     pyro_cli_add_import_roots_from_command_line(vm, cmd_parser);
     pyro_cli_add_import_roots_from_environment(vm);
+    pyro_cli_set_bytecode_cache_flag_from_environment(vm);
 
     bool set_debug = ap_found(cmd_parser, "debug");
     if (!pyro_define_superglobal(vm, "DEBUG", pyro_bool(set_debug))) {
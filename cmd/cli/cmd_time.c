@@ -14,6 +14,7 @@ int pyro_cli_cmd_time(char* cmd_name, ArgParser* cmd_parser) {
 
     pyro_cli_add_import_roots_from_command_line(vm, cmd_parser);
     pyro_cli_add_import_roots_from_environment(vm);
+    pyro_cli_set_bytecode_cache_flag_from_environment(vm);
 
     int num_runs = ap_get_int_value(cmd_parser, "num-runs");
     if (!pyro_define_superglobal(vm, "NUM_RUNS", pyro_i64(num_runs))) {
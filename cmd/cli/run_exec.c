@@ -12,6 +12,7 @@ int pyro_cli_run_exec(ArgParser* parser) {
 
     pyro_cli_add_import_roots_from_command_line(vm, parser);
     pyro_cli_add_import_roots_from_environment(vm);
+    pyro_cli_set_bytecode_cache_flag_from_environment(vm);
 
     const char* code = ap_get_str_value(parser, "exec");
     size_t code_length = strlen(code);
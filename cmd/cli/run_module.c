@@ -14,6 +14,7 @@ int pyro_cli_run_module(ArgParser* parser) {
     // Add import roots.
     pyro_cli_add_import_roots_from_command_line(vm, parser);
     pyro_cli_add_import_roots_from_environment(vm);
+    pyro_cli_set_bytecode_cache_flag_from_environment(vm);
 
     // Add the command line arguments to the superglobal $args vector.
     char** args = ap_get_str_values(parser, "module");
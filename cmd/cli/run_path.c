@@ -18,6 +18,7 @@ int pyro_cli_run_path(ArgParser* parser) {
 
     pyro_cli_add_import_roots_from_command_line(vm, parser);
     pyro_cli_add_import_roots_from_environment(vm);
+    pyro_cli_set_bytecode_cache_flag_from_environment(vm);
     pyro_cli_add_import_roots_from_path(vm, path);
 
     char** args = ap_get_args(parser);
@@ -72,6 +72,14 @@ void pyro_cli_add_import_roots_from_environment(PyroVM* vm) {
 }
 
 
+// The bytecode cache is disabled unless the PYRO_BYTECODE_CACHE environment variable is set to a
+// non-empty value.
+void pyro_cli_set_bytecode_cache_flag_from_environment(PyroVM* vm) {
+    char* env_var = getenv("PYRO_BYTECODE_CACHE");
+    pyro_set_bytecode_cache_flag(vm, env_var != NULL && env_var[0] != '\0');
+}
+
+
 static int64_t parse_memory_size(const char* arg) {
     const size_t buf_len = 24;
     char buf[24];
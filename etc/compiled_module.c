@@ -45,8 +45,8 @@ static PyroValue fn_add_i64s(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    int64_t arg1 = args[0].as.i64;
-    int64_t arg2 = args[1].as.i64;
+    int64_t arg1 = PYRO_AS_I64(args[0]);
+    int64_t arg2 = PYRO_AS_I64(args[1]);
 
     return pyro_i64(arg1 + arg2);
 }
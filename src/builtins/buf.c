@@ -13,7 +13,11 @@ static PyroValue fn_buf(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
     if (arg_count == 1) {
         if (PYRO_IS_STR(args[0])) {
-            PyroBuf* buf = PyroBuf_new_from_string(PYRO_AS_STR(args[0]), vm);
+            PyroStr* string = PYRO_AS_STR(args[0]);
+            if (!PyroStr_view(string, vm)) {
+                return pyro_null();
+            }
+            PyroBuf* buf = PyroBuf_new_from_string(string, vm);
             if (!buf) {
                 pyro_panic(vm, "$buf(): out of memory");
                 return pyro_null();
@@ -25,17 +29,17 @@ static PyroValue fn_buf(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     if (arg_count == 2) {
-        if (!PYRO_IS_I64(args[0]) || args[0].as.i64 < 0) {
+        if (!PYRO_IS_I64(args[0]) || PYRO_AS_I64(args[0]) < 0) {
             pyro_panic(vm, "$buf(): invalid argument [size], expected a positive integer");
             return pyro_null();
         }
-        size_t size = args[0].as.i64;
+        size_t size = PYRO_AS_I64(args[0]);
 
         uint8_t fill_value;
-        if (PYRO_IS_I64(args[1]) && args[1].as.i64 >= 0 && args[1].as.i64 <= 255) {
-            fill_value = (uint8_t)args[1].as.i64;
-        } else if (PYRO_IS_RUNE(args[1]) && args[1].as.u32 <= 255) {
-            fill_value = (uint8_t)args[1].as.u32;
+        if (PYRO_IS_I64(args[1]) && PYRO_AS_I64(args[1]) >= 0 && PYRO_AS_I64(args[1]) <= 255) {
+            fill_value = (uint8_t)PYRO_AS_I64(args[1]);
+        } else if (PYRO_IS_RUNE(args[1]) && PYRO_AS_RUNE(args[1]) <= 255) {
+            fill_value = (uint8_t)PYRO_AS_RUNE(args[1]);
         } else {
             pyro_panic(vm, "$buf(): invalid argument [fill_value], expected an integer in the range [0,255]");
             return pyro_null();
@@ -76,17 +80,17 @@ static PyroValue buf_write_byte(PyroVM* vm, size_t arg_count, PyroValue* args) {
     uint8_t byte_value;
 
     if (PYRO_IS_I64(args[0])) {
-        if (args[0].as.i64 >= 0 && args[0].as.i64 <= 255) {
-            byte_value = (uint8_t)args[0].as.i64;
+        if (PYRO_AS_I64(args[0]) >= 0 && PYRO_AS_I64(args[0]) <= 255) {
+            byte_value = (uint8_t)PYRO_AS_I64(args[0]);
         } else {
-            pyro_panic(vm, "write_byte(): invalid argument [byte], integer (%d) is out of range", args[0].as.i64);
+            pyro_panic(vm, "write_byte(): invalid argument [byte], integer (%d) is out of range", PYRO_AS_I64(args[0]));
             return pyro_null();
         }
     } else if (PYRO_IS_RUNE(args[0])) {
-        if (args[0].as.u32 <= 255) {
-            byte_value = (uint8_t)args[0].as.u32;
+        if (PYRO_AS_RUNE(args[0]) <= 255) {
+            byte_value = (uint8_t)PYRO_AS_RUNE(args[0]);
         } else {
-            pyro_panic(vm, "write_byte(): invalid argument [byte], rune (%d) is out of range", args[0].as.u32);
+            pyro_panic(vm, "write_byte(): invalid argument [byte], rune (%d) is out of range", PYRO_AS_RUNE(args[0]));
             return pyro_null();
         }
     } else {
@@ -139,7 +143,7 @@ static PyroValue buf_get(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    int64_t index = args[0].as.i64;
+    int64_t index = PYRO_AS_I64(args[0]);
     if (index < 0) {
         index += buf->count;
     }
@@ -164,7 +168,7 @@ static PyroValue buf_set(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    int64_t index = args[0].as.i64;
+    int64_t index = PYRO_AS_I64(args[0]);
     if (index < 0) {
         index += buf->count;
     }
@@ -176,17 +180,17 @@ static PyroValue buf_set(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
     uint8_t byte_value;
     if (PYRO_IS_I64(args[1])) {
-        if (args[1].as.i64 >= 0 && args[1].as.i64 <= 255) {
-            byte_value = (uint8_t)args[1].as.i64;
+        if (PYRO_AS_I64(args[1]) >= 0 && PYRO_AS_I64(args[1]) <= 255) {
+            byte_value = (uint8_t)PYRO_AS_I64(args[1]);
         } else {
-            pyro_panic(vm, "set(): invalid argument [value], integer (%d) is out of range", args[1].as.i64);
+            pyro_panic(vm, "set(): invalid argument [value], integer (%d) is out of range", PYRO_AS_I64(args[1]));
             return pyro_null();
         }
     } else if (PYRO_IS_RUNE(args[1])) {
-        if (args[1].as.u32 <= 255) {
-            byte_value = (uint8_t)args[1].as.u32;
+        if (PYRO_AS_RUNE(args[1]) <= 255) {
+            byte_value = (uint8_t)PYRO_AS_RUNE(args[1]);
         } else {
-            pyro_panic(vm, "set(): invalid argument [value], rune (%d) is out of range", args[1].as.u32);
+            pyro_panic(vm, "set(): invalid argument [value], rune (%d) is out of range", PYRO_AS_RUNE(args[1]));
             return pyro_null();
         }
     } else {
@@ -278,14 +282,14 @@ static PyroValue buf_resize(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    int64_t new_size = args[0].as.i64;
+    int64_t new_size = PYRO_AS_I64(args[0]);
     uint8_t fill_value = 0;
 
     if (arg_count == 2) {
-        if (PYRO_IS_I64(args[1]) && args[1].as.i64 >= 0 && args[1].as.i64 <= 255) {
-            fill_value = (uint8_t)args[1].as.i64;
-        } else if (PYRO_IS_RUNE(args[1]) && args[1].as.u32 <= 255) {
-            fill_value = (uint8_t)args[1].as.u32;
+        if (PYRO_IS_I64(args[1]) && PYRO_AS_I64(args[1]) >= 0 && PYRO_AS_I64(args[1]) <= 255) {
+            fill_value = (uint8_t)PYRO_AS_I64(args[1]);
+        } else if (PYRO_IS_RUNE(args[1]) && PYRO_AS_RUNE(args[1]) <= 255) {
+            fill_value = (uint8_t)PYRO_AS_RUNE(args[1]);
         } else {
             pyro_panic(vm, "resize(): invalid argument [fill_value], expected an integer in the range [0,255]");
             return pyro_null();
@@ -341,18 +345,22 @@ static PyroValue buf_match(PyroVM* vm, size_t arg_count, PyroValue* args) {
         target = PYRO_AS_BUF(args[0])->bytes;
         target_count = PYRO_AS_BUF(args[0])->count;
     } else if (PYRO_IS_STR(args[0])) {
-        target = PYRO_AS_STR(args[0])->bytes;
-        target_count = PYRO_AS_STR(args[0])->count;
+        PyroStr* string = PYRO_AS_STR(args[0]);
+        if (!PyroStr_view(string, vm)) {
+            return pyro_null();
+        }
+        target = string->bytes;
+        target_count = string->count;
     } else {
         pyro_panic(vm, "match(): invalid argument [target], expected a string or buffer");
         return pyro_null();
     }
 
-    if (!PYRO_IS_I64(args[1]) || args[1].as.i64 < 0) {
+    if (!PYRO_IS_I64(args[1]) || PYRO_AS_I64(args[1]) < 0) {
         pyro_panic(vm, "match(): invalid argument [index], expected a positive integer");
         return pyro_null();
     }
-    size_t index = (size_t)args[1].as.i64;
+    size_t index = (size_t)PYRO_AS_I64(args[1]);
 
     if (index + target_count > buf->count) {
         return pyro_bool(false);
@@ -381,10 +389,10 @@ static PyroValue buf_slice(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     size_t start_index;
-    if (args[0].as.i64 >= 0 && (size_t)args[0].as.i64 <= buf->count) {
-        start_index = (size_t)args[0].as.i64;
-    } else if (args[0].as.i64 < 0 && (size_t)(args[0].as.i64 * -1) <= buf->count) {
-        start_index = (size_t)((int64_t)buf->count + args[0].as.i64);
+    if (PYRO_AS_I64(args[0]) >= 0 && (size_t)PYRO_AS_I64(args[0]) <= buf->count) {
+        start_index = (size_t)PYRO_AS_I64(args[0]);
+    } else if (PYRO_AS_I64(args[0]) < 0 && (size_t)(PYRO_AS_I64(args[0]) * -1) <= buf->count) {
+        start_index = (size_t)((int64_t)buf->count + PYRO_AS_I64(args[0]));
     } else {
         pyro_panic(vm, "slice(): invalid argument [start_index], out of range");
         return pyro_null();
@@ -396,15 +404,15 @@ static PyroValue buf_slice(PyroVM* vm, size_t arg_count, PyroValue* args) {
             pyro_panic(vm, "slice(): invalid argument [length], expected an integer");
             return pyro_null();
         }
-        if (args[1].as.i64 < 0) {
+        if (PYRO_AS_I64(args[1]) < 0) {
             pyro_panic(vm, "slice(): invalid argument [length], expected a positive integer");
             return pyro_null();
         }
-        if (start_index + (size_t)args[1].as.i64 > buf->count) {
+        if (start_index + (size_t)PYRO_AS_I64(args[1]) > buf->count) {
             pyro_panic(vm, "slice(): invalid argument [length], out of range");
             return pyro_null();
         }
-        length = (size_t)args[1].as.i64;
+        length = (size_t)PYRO_AS_I64(args[1]);
     }
 
     PyroBuf* new_buf = PyroBuf_new_with_capacity(length, vm);
@@ -461,8 +469,12 @@ static PyroValue buf_contains(PyroVM* vm, size_t arg_count, PyroValue* args) {
         target = PYRO_AS_BUF(args[0])->bytes;
         target_count = PYRO_AS_BUF(args[0])->count;
     } else if (PYRO_IS_STR(args[0])) {
-        target = PYRO_AS_STR(args[0])->bytes;
-        target_count = PYRO_AS_STR(args[0])->count;
+        PyroStr* string = PYRO_AS_STR(args[0]);
+        if (!PyroStr_view(string, vm)) {
+            return pyro_null();
+        }
+        target = string->bytes;
+        target_count = string->count;
     } else {
         pyro_panic(vm,
             "contains(): invalid argument [target], expected a string or buffer, found %s",
@@ -17,6 +17,7 @@ static PyroValue fn_err(PyroVM* vm, size_t arg_count, PyroValue* args) {
         if (vm->halt_flag) {
             return pyro_null();
         }
+        pyro_write_barrier(vm, (PyroObject*)err, pyro_obj(string));
         err->message = string;
         return pyro_obj(err);
     }
@@ -31,6 +32,7 @@ static PyroValue fn_err(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
+    pyro_write_barrier(vm, (PyroObject*)err, pyro_obj(string));
     err->message = string;
     return pyro_obj(err);
 }
@@ -8,9 +8,14 @@ static PyroValue fn_file(PyroVM* vm, size_t arg_count, PyroValue* args) {
             return pyro_null();
         }
 
-        FILE* stream = fopen(PYRO_AS_STR(args[0])->bytes, "r");
+        PyroStr* path = PYRO_AS_STR(args[0]);
+        if (!PyroStr_flatten(path, vm)) {
+            return pyro_null();
+        }
+
+        FILE* stream = fopen(path->bytes, "r");
         if (!stream) {
-            pyro_panic(vm, "$file(): unable to open file '%s'", PYRO_AS_STR(args[0])->bytes);
+            pyro_panic(vm, "$file(): unable to open file '%s'", path->bytes);
             return pyro_null();
         }
 
@@ -20,7 +25,7 @@ static PyroValue fn_file(PyroVM* vm, size_t arg_count, PyroValue* args) {
             return pyro_null();
         }
 
-        file->path = PYRO_AS_STR(args[0]);
+        file->path = path;
         return pyro_obj(file);
     }
 
@@ -35,9 +40,15 @@ static PyroValue fn_file(PyroVM* vm, size_t arg_count, PyroValue* args) {
             return pyro_null();
         }
 
-        FILE* stream = fopen(PYRO_AS_STR(args[0])->bytes, PYRO_AS_STR(args[1])->bytes);
+        PyroStr* path = PYRO_AS_STR(args[0]);
+        PyroStr* mode = PYRO_AS_STR(args[1]);
+        if (!PyroStr_flatten(path, vm) || !PyroStr_flatten(mode, vm)) {
+            return pyro_null();
+        }
+
+        FILE* stream = fopen(path->bytes, mode->bytes);
         if (!stream) {
-            pyro_panic(vm, "$file(): unable to open file '%s'", PYRO_AS_STR(args[0])->bytes);
+            pyro_panic(vm, "$file(): unable to open file '%s'", path->bytes);
             return pyro_null();
         }
 
@@ -47,7 +58,7 @@ static PyroValue fn_file(PyroVM* vm, size_t arg_count, PyroValue* args) {
             return pyro_null();
         }
 
-        file->path = PYRO_AS_STR(args[0]);
+        file->path = path;
         return pyro_obj(file);
     }
 
@@ -154,11 +165,11 @@ static PyroValue file_read_bytes(PyroVM* vm, size_t arg_count, PyroValue* args)
         return pyro_null();
     }
 
-    if (!PYRO_IS_I64(args[0]) || args[0].as.i64 < 0) {
+    if (!PYRO_IS_I64(args[0]) || PYRO_AS_I64(args[0]) < 0) {
         pyro_panic(vm, "read_bytes(): invalid argument [n], expected a non-negative integer");
         return pyro_null();
     }
-    size_t num_bytes_to_read = args[0].as.i64;
+    size_t num_bytes_to_read = PYRO_AS_I64(args[0]);
 
     PyroBuf* buf = PyroBuf_new_with_capacity(num_bytes_to_read + 1, vm);
     if (!buf) {
@@ -307,17 +318,17 @@ static PyroValue file_write_byte(PyroVM* vm, size_t arg_count, PyroValue* args)
     uint8_t byte;
 
     if (PYRO_IS_I64(args[0])) {
-        if (args[0].as.i64 < 0 || args[0].as.i64 > 255) {
-            pyro_panic(vm, "write_byte(): invalid argument [byte], integer (%d) is out of range", args[0].as.i64);
+        if (PYRO_AS_I64(args[0]) < 0 || PYRO_AS_I64(args[0]) > 255) {
+            pyro_panic(vm, "write_byte(): invalid argument [byte], integer (%d) is out of range", PYRO_AS_I64(args[0]));
             return pyro_null();
         }
-        byte = (uint8_t)args[0].as.i64;
+        byte = (uint8_t)PYRO_AS_I64(args[0]);
     } else if (PYRO_IS_RUNE(args[0])) {
-        if (args[0].as.u32 > 255) {
-            pyro_panic(vm, "write_byte(): invalid argument [byte], char (%d) is out of range", args[0].as.u32);
+        if (PYRO_AS_RUNE(args[0]) > 255) {
+            pyro_panic(vm, "write_byte(): invalid argument [byte], char (%d) is out of range", PYRO_AS_RUNE(args[0]));
             return pyro_null();
         }
-        byte = (uint8_t)args[0].as.u32;
+        byte = (uint8_t)PYRO_AS_RUNE(args[0]);
     } else {
         pyro_panic(vm, "write_byte(): invalid argument [byte], expected an integer");
         return pyro_null();
@@ -356,9 +367,9 @@ static PyroValue file_seek_from_start(PyroVM* vm, size_t arg_count, PyroValue* a
         return pyro_null();
     }
 
-    int result = fseek(file->stream, args[0].as.i64, SEEK_SET);
+    int result = fseek(file->stream, PYRO_AS_I64(args[0]), SEEK_SET);
     if (result == -1) {
-        pyro_panic(vm, "seek_from_start(): file is not seekable to offset %" PRId64, args[0].as.i64);
+        pyro_panic(vm, "seek_from_start(): file is not seekable to offset %" PRId64, PYRO_AS_I64(args[0]));
         return pyro_null();
     }
 
@@ -378,9 +389,9 @@ static PyroValue file_seek_from_end(PyroVM* vm, size_t arg_count, PyroValue* arg
         return pyro_null();
     }
 
-    int result = fseek(file->stream, args[0].as.i64, SEEK_END);
+    int result = fseek(file->stream, PYRO_AS_I64(args[0]), SEEK_END);
     if (result == -1) {
-        pyro_panic(vm, "seek_from_end(): file is not seekable to offset %" PRId64, args[0].as.i64);
+        pyro_panic(vm, "seek_from_end(): file is not seekable to offset %" PRId64, PYRO_AS_I64(args[0]));
         return pyro_null();
     }
 
@@ -400,9 +411,9 @@ static PyroValue file_seek_from_current(PyroVM* vm, size_t arg_count, PyroValue*
         return pyro_null();
     }
 
-    int result = fseek(file->stream, args[0].as.i64, SEEK_CUR);
+    int result = fseek(file->stream, PYRO_AS_I64(args[0]), SEEK_CUR);
     if (result == -1) {
-        pyro_panic(vm, "seek_from_current(): file is not seekable to offset %" PRId64, args[0].as.i64);
+        pyro_panic(vm, "seek_from_current(): file is not seekable to offset %" PRId64, PYRO_AS_I64(args[0]));
         return pyro_null();
     }
 
@@ -157,6 +157,9 @@ static PyroValue iter_join(PyroVM* vm, size_t arg_count, PyroValue* args) {
             return pyro_null();
         }
         PyroStr* sep = PYRO_AS_STR(args[0]);
+        if (!PyroStr_flatten(sep, vm)) {
+            return pyro_null();
+        }
         PyroStr* result = PyroIter_join(iter, sep->bytes, sep->count, vm);
         return vm->halt_flag ? pyro_null() : pyro_obj(result);
     }
@@ -208,7 +211,7 @@ static PyroValue iter_enumerate(PyroVM* vm, size_t arg_count, PyroValue* args) {
         new_iter->next_enum = 0;
     } else if (arg_count == 1) {
         if (PYRO_IS_I64(args[0])) {
-            new_iter->next_enum = args[0].as.i64;
+            new_iter->next_enum = PYRO_AS_I64(args[0]);
         } else {
             pyro_panic(vm, "enumerate(): invalid argument [start_index], expected an integer");
             return pyro_null();
@@ -231,7 +234,7 @@ static PyroValue fn_range(PyroVM* vm, size_t arg_count, PyroValue* args) {
             return pyro_null();
         }
         start = 0;
-        stop = args[0].as.i64;
+        stop = PYRO_AS_I64(args[0]);
         step = 1;
     } else if (arg_count == 2) {
         if (!PYRO_IS_I64(args[0])) {
@@ -242,8 +245,8 @@ static PyroValue fn_range(PyroVM* vm, size_t arg_count, PyroValue* args) {
             pyro_panic(vm, "$range(): invalid argument [stop], expected an integer");
             return pyro_null();
         }
-        start = args[0].as.i64;
-        stop = args[1].as.i64;
+        start = PYRO_AS_I64(args[0]);
+        stop = PYRO_AS_I64(args[1]);
         step = 1;
     } else if (arg_count == 3) {
         if (!PYRO_IS_I64(args[0])) {
@@ -258,9 +261,9 @@ static PyroValue fn_range(PyroVM* vm, size_t arg_count, PyroValue* args) {
             pyro_panic(vm, "$range(): invalid argument [step], expected an integer");
             return pyro_null();
         }
-        start = args[0].as.i64;
-        stop = args[1].as.i64;
-        step = args[2].as.i64;
+        start = PYRO_AS_I64(args[0]);
+        stop = PYRO_AS_I64(args[1]);
+        step = PYRO_AS_I64(args[2]);
     } else {
         pyro_panic(vm, "$range(): expected 1, 2, or 3 arguments, found %zu", arg_count);
         return pyro_null();
@@ -288,7 +291,7 @@ static PyroValue iter_skip_first(PyroVM* vm, size_t arg_count, PyroValue* args)
         return pyro_null();
     }
 
-    int64_t num_to_skip = args[0].as.i64;
+    int64_t num_to_skip = PYRO_AS_I64(args[0]);
     if (num_to_skip == 0) {
         return pyro_obj(iter);
     } else if (num_to_skip < 0) {
@@ -327,7 +330,7 @@ static PyroValue iter_skip_last(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    int64_t num_to_skip = args[0].as.i64;
+    int64_t num_to_skip = PYRO_AS_I64(args[0]);
     if (num_to_skip == 0) {
         return pyro_obj(iter);
     } else if (num_to_skip < 0) {
@@ -9,7 +9,7 @@ static PyroValue mod_member(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_obj(vm->empty_error);
     }
 
-    return mod->members->values[member_index.as.i64];
+    return mod->members->values[PYRO_AS_I64(member_index)];
 }
 
 
@@ -67,7 +67,7 @@ static PyroValue mod_globals(PyroVM* vm, size_t arg_count, PyroValue* args) {
         }
         PyroValue member_name = entry->key;
         PyroValue member_index = entry->value;
-        PyroValue member_value = mod->members->values[member_index.as.i64];
+        PyroValue member_value = mod->members->values[PYRO_AS_I64(member_index)];
         if (!PyroMap_set(new_map, member_name, member_value, vm)) {
             pyro_panic(vm, "globals(): out of memory");
             return pyro_null();
@@ -3,7 +3,7 @@
 
 static PyroValue fn_rune(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0])) {
-        int64_t arg = args[0].as.i64;
+        int64_t arg = PYRO_AS_I64(args[0]);
         if (arg >= 0 && arg <= UINT32_MAX) {
             return pyro_rune((uint32_t)arg);
         } else {
@@ -27,54 +27,54 @@ static PyroValue fn_is_rune(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 
 static PyroValue rune_is_ascii(PyroVM* vm, size_t arg_count, PyroValue* args) {
-    return pyro_bool(args[-1].as.u32 < 128);
+    return pyro_bool(PYRO_AS_RUNE(args[-1]) < 128);
 }
 
 
 static PyroValue rune_is_ascii_ws(PyroVM* vm, size_t arg_count, PyroValue* args) {
     return pyro_bool(
-        args[-1].as.u32 < 128 && pyro_is_ascii_ws((char)args[-1].as.u32)
+        PYRO_AS_RUNE(args[-1]) < 128 && pyro_is_ascii_ws((char)PYRO_AS_RUNE(args[-1]))
     );
 }
 
 
 static PyroValue rune_is_ascii_decimal(PyroVM* vm, size_t arg_count, PyroValue* args) {
     return pyro_bool(
-        args[-1].as.u32 < 128 && pyro_is_ascii_decimal_digit((char)args[-1].as.u32)
+        PYRO_AS_RUNE(args[-1]) < 128 && pyro_is_ascii_decimal_digit((char)PYRO_AS_RUNE(args[-1]))
     );
 }
 
 
 static PyroValue rune_is_ascii_octal(PyroVM* vm, size_t arg_count, PyroValue* args) {
     return pyro_bool(
-        args[-1].as.u32 < 128 && pyro_is_ascii_octal_digit((char)args[-1].as.u32)
+        PYRO_AS_RUNE(args[-1]) < 128 && pyro_is_ascii_octal_digit((char)PYRO_AS_RUNE(args[-1]))
     );
 }
 
 
 static PyroValue rune_is_ascii_hex(PyroVM* vm, size_t arg_count, PyroValue* args) {
     return pyro_bool(
-        args[-1].as.u32 < 128 && pyro_is_ascii_hex_digit((char)args[-1].as.u32)
+        PYRO_AS_RUNE(args[-1]) < 128 && pyro_is_ascii_hex_digit((char)PYRO_AS_RUNE(args[-1]))
     );
 }
 
 
 static PyroValue rune_is_ascii_alpha(PyroVM* vm, size_t arg_count, PyroValue* args) {
     return pyro_bool(
-        args[-1].as.u32 < 128 && pyro_is_ascii_alpha((char)args[-1].as.u32)
+        PYRO_AS_RUNE(args[-1]) < 128 && pyro_is_ascii_alpha((char)PYRO_AS_RUNE(args[-1]))
     );
 }
 
 
 static PyroValue rune_is_ascii_printable(PyroVM* vm, size_t arg_count, PyroValue* args) {
     return pyro_bool(
-        args[-1].as.u32 < 128 && pyro_is_ascii_printable((char)args[-1].as.u32)
+        PYRO_AS_RUNE(args[-1]) < 128 && pyro_is_ascii_printable((char)PYRO_AS_RUNE(args[-1]))
     );
 }
 
 
 static PyroValue rune_is_unicode_ws(PyroVM* vm, size_t arg_count, PyroValue* args) {
-    return pyro_bool(pyro_is_unicode_whitespace(args[-1].as.u32));
+    return pyro_bool(pyro_is_unicode_whitespace(PYRO_AS_RUNE(args[-1])));
 }
 
 
@@ -23,6 +23,9 @@ static PyroValue str_is_empty(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue str_iter(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
     PyroIter* iter = PyroIter_new((PyroObject*)str, PYRO_ITER_STR, vm);
     if (!iter) {
         pyro_panic(vm, "iter(): out of memory");
@@ -40,6 +43,9 @@ static PyroValue str_byte_count(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue str_byte(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     if (!PYRO_IS_I64(args[0])) {
         pyro_panic(vm,
@@ -49,7 +55,7 @@ static PyroValue str_byte(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    int64_t index = args[0].as.i64;
+    int64_t index = PYRO_AS_I64(args[0]);
     if (index < 0) {
         index += str->count;
     }
@@ -65,6 +71,9 @@ static PyroValue str_byte(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue str_bytes(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
     PyroIter* iter = PyroIter_new((PyroObject*)str, PYRO_ITER_STR_BYTES, vm);
     if (!iter) {
         pyro_panic(vm, "bytes(): out of memory");
@@ -76,6 +85,9 @@ static PyroValue str_bytes(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue str_lines(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
     PyroIter* iter = PyroIter_new((PyroObject*)str, PYRO_ITER_STR_LINES, vm);
     if (!iter) {
         pyro_panic(vm, "lines(): out of memory");
@@ -87,24 +99,22 @@ static PyroValue str_lines(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue str_is_ascii(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
     if (str->count == 0) {
         return pyro_bool(false);
     }
 
-    for (size_t i = 0; i < str->count; i++) {
-        // If char is signed, this checks if [value < 0].
-        // If char is unsigned, this checks if [value > 127].
-        if (str->bytes[i] & 0x80) {
-            return pyro_bool(false);
-        }
-    }
-
-    return pyro_bool(true);
+    return pyro_bool(pyro_count_ascii_prefix(str->bytes, str->count) == str->count);
 }
 
 
 static PyroValue str_is_ascii_ws(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
     if (str->count == 0) {
         return pyro_bool(false);
     }
@@ -129,6 +139,9 @@ static PyroValue str_is_ascii_ws(PyroVM* vm, size_t arg_count, PyroValue* args)
 
 static PyroValue str_is_utf8_ws(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
     if (str->count == 0) {
         return pyro_bool(false);
     }
@@ -156,6 +169,9 @@ static PyroValue str_is_utf8_ws(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue str_runes(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
     PyroIter* iter = PyroIter_new((PyroObject*)str, PYRO_ITER_STR_RUNES, vm);
     if (!iter) {
         pyro_panic(vm, "runes(): out of memory");
@@ -167,6 +183,9 @@ static PyroValue str_runes(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue str_rune(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     if (!PYRO_IS_I64(args[0])) {
         pyro_panic(vm,
@@ -176,7 +195,7 @@ static PyroValue str_rune(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    int64_t target_index = args[0].as.i64;
+    int64_t target_index = PYRO_AS_I64(args[0]);
     if (target_index < 0 || str->count == 0) {
         pyro_panic(vm, "rune(): index %" PRId64 " is out of range", target_index);
         return pyro_null();
@@ -187,6 +206,13 @@ static PyroValue str_rune(PyroVM* vm, size_t arg_count, PyroValue* args) {
     Utf8CodePoint cp;
 
     while (rune_count < (size_t)target_index + 1) {
+        size_t ascii_count = pyro_count_ascii_prefix(&str->bytes[byte_index], str->count - byte_index);
+        if (rune_count + ascii_count > (size_t)target_index) {
+            return pyro_rune((uint8_t)str->bytes[byte_index + ((size_t)target_index - rune_count)]);
+        }
+        byte_index += ascii_count;
+        rune_count += ascii_count;
+
         if (byte_index == str->count) {
             pyro_panic(vm, "rune(): index %" PRId64 " is out of range", target_index);
             return pyro_null();
@@ -210,54 +236,38 @@ static PyroValue str_rune(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue str_rune_count(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
-    size_t byte_index = 0;
-    size_t rune_count = 0;
-    Utf8CodePoint cp;
-
-    while (byte_index < str->count) {
-        uint8_t* src = (uint8_t*)&str->bytes[byte_index];
-        size_t src_len = str->count - byte_index;
-
-        if (pyro_read_utf8_codepoint(src, src_len, &cp)) {
-            rune_count++;
-            byte_index += cp.length;
-        } else {
-            pyro_panic(vm, "rune_count(): string contains invalid utf-8 at byte index %zu", byte_index);
-            return pyro_null();
-        }
+    size_t rune_count;
+    if (!pyro_count_utf8_codepoints(str->bytes, str->count, &rune_count)) {
+        pyro_panic(vm, "rune_count(): string contains invalid utf-8 at byte index %zu", rune_count);
+        return pyro_null();
     }
 
-    return pyro_i64(rune_count);
+    return pyro_i64((int64_t)rune_count);
 }
 
 
 static PyroValue str_is_utf8(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
     if (str->count == 0) {
         return pyro_bool(false);
     }
 
-    size_t byte_index = 0;
-    Utf8CodePoint cp;
-
-    while (byte_index < str->count) {
-        uint8_t* src = (uint8_t*)&str->bytes[byte_index];
-        size_t src_len = str->count - byte_index;
-
-        if (pyro_read_utf8_codepoint(src, src_len, &cp)) {
-            byte_index += cp.length;
-        } else {
-            return pyro_bool(false);
-        }
-    }
-
-    return pyro_bool(true);
+    return pyro_bool(pyro_is_valid_utf8(str->bytes, str->count));
 }
 
 
 static PyroValue str_to_ascii_upper(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_flatten(str, vm)) {
+        return pyro_null();
+    }
     if (str->count == 0) {
         return pyro_obj(str);
     }
@@ -277,7 +287,7 @@ static PyroValue str_to_ascii_upper(PyroVM* vm, size_t arg_count, PyroValue* arg
         }
     }
 
-    PyroStr* new_string = PyroStr_take(array, str->count, str->capacity, vm);
+    PyroStr* new_string = PyroStr_take_lazy(array, str->count, str->capacity, vm);
     if (!new_string) {
         PYRO_FREE_ARRAY(vm, char, array, str->capacity);
         pyro_panic(vm, "to_ascii_uper(): out of memory");
@@ -290,6 +300,9 @@ static PyroValue str_to_ascii_upper(PyroVM* vm, size_t arg_count, PyroValue* arg
 
 static PyroValue str_to_ascii_lower(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_flatten(str, vm)) {
+        return pyro_null();
+    }
     if (str->count == 0) {
         return pyro_obj(str);
     }
@@ -309,7 +322,7 @@ static PyroValue str_to_ascii_lower(PyroVM* vm, size_t arg_count, PyroValue* arg
         }
     }
 
-    PyroStr* new_string = PyroStr_take(array, str->count, str->capacity, vm);
+    PyroStr* new_string = PyroStr_take_lazy(array, str->count, str->capacity, vm);
     if (!new_string) {
         PYRO_FREE_ARRAY(vm, char, array, str->capacity);
         pyro_panic(vm, "to_ascii_lower(): out of memory");
@@ -322,6 +335,9 @@ static PyroValue str_to_ascii_lower(PyroVM* vm, size_t arg_count, PyroValue* arg
 
 static PyroValue str_starts_with(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     if (!PYRO_IS_STR(args[0])) {
         pyro_panic(vm, "starts_with(): invalid argument [prefix], expected a string");
@@ -329,6 +345,9 @@ static PyroValue str_starts_with(PyroVM* vm, size_t arg_count, PyroValue* args)
     }
 
     PyroStr* target = PYRO_AS_STR(args[0]);
+    if (!PyroStr_view(target, vm)) {
+        return pyro_null();
+    }
 
     if (str->count < target->count) {
         return pyro_bool(false);
@@ -344,6 +363,9 @@ static PyroValue str_starts_with(PyroVM* vm, size_t arg_count, PyroValue* args)
 
 static PyroValue str_ends_with(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     if (!PYRO_IS_STR(args[0])) {
         pyro_panic(vm, "ends_with(): invalid argument [suffix], expected a string");
@@ -351,6 +373,9 @@ static PyroValue str_ends_with(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     PyroStr* target = PYRO_AS_STR(args[0]);
+    if (!PyroStr_view(target, vm)) {
+        return pyro_null();
+    }
 
     if (str->count < target->count) {
         return pyro_bool(false);
@@ -366,6 +391,9 @@ static PyroValue str_ends_with(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue str_strip_prefix(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     if (!PYRO_IS_STR(args[0])) {
         pyro_panic(vm, "strip_prefix(): invalid argument [prefix], expected a string");
@@ -373,13 +401,16 @@ static PyroValue str_strip_prefix(PyroVM* vm, size_t arg_count, PyroValue* args)
     }
 
     PyroStr* target = PYRO_AS_STR(args[0]);
+    if (!PyroStr_view(target, vm)) {
+        return pyro_null();
+    }
 
     if (str->count < target->count) {
         return pyro_obj(str);
     }
 
     if (memcmp(str->bytes, target->bytes, target->count) == 0) {
-        PyroStr* new_str = PyroStr_copy(&str->bytes[target->count], str->count - target->count, false, vm);
+        PyroStr* new_str = PyroStr_slice(str, target->count, str->count - target->count, vm);
         if (!new_str) {
             pyro_panic(vm, "strip_prefix(): out of memory");
             return pyro_null();
@@ -393,6 +424,9 @@ static PyroValue str_strip_prefix(PyroVM* vm, size_t arg_count, PyroValue* args)
 
 static PyroValue str_strip_suffix(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     if (!PYRO_IS_STR(args[0])) {
         pyro_panic(vm, "strip_suffix(): invalid argument [suffix], expected a string");
@@ -400,13 +434,16 @@ static PyroValue str_strip_suffix(PyroVM* vm, size_t arg_count, PyroValue* args)
     }
 
     PyroStr* target = PYRO_AS_STR(args[0]);
+    if (!PyroStr_view(target, vm)) {
+        return pyro_null();
+    }
 
     if (str->count < target->count) {
         return pyro_obj(str);
     }
 
     if (memcmp(&str->bytes[str->count - target->count], target->bytes, target->count) == 0) {
-        PyroStr* new_str = PyroStr_copy(str->bytes, str->count - target->count, false, vm);
+        PyroStr* new_str = PyroStr_slice(str, 0, str->count - target->count, vm);
         if (!new_str) {
             pyro_panic(vm, "strip_suffix(): out of memory");
             return pyro_null();
@@ -420,6 +457,9 @@ static PyroValue str_strip_suffix(PyroVM* vm, size_t arg_count, PyroValue* args)
 
 static PyroValue str_strip_prefix_bytes(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     if (!PYRO_IS_STR(args[0])) {
         pyro_panic(vm, "strip_prefix_bytes(), invalid argument [bytes], expected a string");
@@ -427,6 +467,9 @@ static PyroValue str_strip_prefix_bytes(PyroVM* vm, size_t arg_count, PyroValue*
     }
 
     PyroStr* prefix = PYRO_AS_STR(args[0]);
+    if (!PyroStr_view(prefix, vm)) {
+        return pyro_null();
+    }
 
     if (prefix->count == 0 || str->count == 0) {
         return pyro_obj(str);
@@ -443,7 +486,7 @@ static PyroValue str_strip_prefix_bytes(PyroVM* vm, size_t arg_count, PyroValue*
         start++;
     }
 
-    PyroStr* new_str = PyroStr_copy(start, end - start, false, vm);
+    PyroStr* new_str = PyroStr_slice(str, start - str->bytes, end - start, vm);
     if (!new_str) {
         pyro_panic(vm, "strip_prefix_bytes(): out of memory");
         return pyro_null();
@@ -455,6 +498,9 @@ static PyroValue str_strip_prefix_bytes(PyroVM* vm, size_t arg_count, PyroValue*
 
 static PyroValue str_strip_suffix_bytes(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     if (!PYRO_IS_STR(args[0])) {
         pyro_panic(vm, "strip_suffix_bytes(): invalid argument [bytes], expected a string");
@@ -462,6 +508,9 @@ static PyroValue str_strip_suffix_bytes(PyroVM* vm, size_t arg_count, PyroValue*
     }
 
     PyroStr* suffix = PYRO_AS_STR(args[0]);
+    if (!PyroStr_view(suffix, vm)) {
+        return pyro_null();
+    }
 
     if (suffix->count == 0 || str->count == 0) {
         return pyro_obj(str);
@@ -478,7 +527,7 @@ static PyroValue str_strip_suffix_bytes(PyroVM* vm, size_t arg_count, PyroValue*
         end--;
     }
 
-    PyroStr* new_str = PyroStr_copy(start, end - start, false, vm);
+    PyroStr* new_str = PyroStr_slice(str, start - str->bytes, end - start, vm);
     if (!new_str) {
         pyro_panic(vm, "strip_suffix_bytes(): out of memory");
         return pyro_null();
@@ -490,6 +539,9 @@ static PyroValue str_strip_suffix_bytes(PyroVM* vm, size_t arg_count, PyroValue*
 
 static PyroValue str_strip_bytes(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     if (!PYRO_IS_STR(args[0])) {
         pyro_panic(vm, "strip_bytes(): invalid argument [bytes], expected a string");
@@ -497,6 +549,9 @@ static PyroValue str_strip_bytes(PyroVM* vm, size_t arg_count, PyroValue* args)
     }
 
     PyroStr* target = PYRO_AS_STR(args[0]);
+    if (!PyroStr_view(target, vm)) {
+        return pyro_null();
+    }
 
     if (target->count == 0 || str->count == 0) {
         return pyro_obj(str);
@@ -521,7 +576,7 @@ static PyroValue str_strip_bytes(PyroVM* vm, size_t arg_count, PyroValue* args)
         end--;
     }
 
-    PyroStr* new_str = PyroStr_copy(start, end - start, false, vm);
+    PyroStr* new_str = PyroStr_slice(str, start - str->bytes, end - start, vm);
     if (!new_str) {
         pyro_panic(vm, "strip_bytes(): out of memory");
         return pyro_null();
@@ -533,6 +588,9 @@ static PyroValue str_strip_bytes(PyroVM* vm, size_t arg_count, PyroValue* args)
 
 static PyroValue str_strip_ascii_ws(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
     if (str->count == 0) {
         return pyro_obj(str);
     }
@@ -558,7 +616,7 @@ static PyroValue str_strip_ascii_ws(PyroVM* vm, size_t arg_count, PyroValue* arg
         end--;
     }
 
-    PyroStr* new_str = PyroStr_copy(start, end - start, false, vm);
+    PyroStr* new_str = PyroStr_slice(str, start - str->bytes, end - start, vm);
     if (!new_str) {
         pyro_panic(vm, "strip_ascii_ws(): out of memory");
         return pyro_null();
@@ -570,6 +628,9 @@ static PyroValue str_strip_ascii_ws(PyroVM* vm, size_t arg_count, PyroValue* arg
 
 static PyroValue str_strip_utf8_ws(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
     if (str->count == 0) {
         return pyro_obj(str);
     }
@@ -599,7 +660,7 @@ static PyroValue str_strip_utf8_ws(PyroVM* vm, size_t arg_count, PyroValue* args
         end -= cp.length;
     }
 
-    PyroStr* new_str = PyroStr_copy(start, end - start, false, vm);
+    PyroStr* new_str = PyroStr_slice(str, start - str->bytes, end - start, vm);
     if (!new_str) {
         pyro_panic(vm, "strip_utf8_ws(): out of memory");
         return pyro_null();
@@ -611,6 +672,9 @@ static PyroValue str_strip_utf8_ws(PyroVM* vm, size_t arg_count, PyroValue* args
 
 static PyroValue str_strip_runes(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     if (!PYRO_IS_STR(args[0])) {
         pyro_panic(vm, "strip_runes(): invalid argument [runes], expected a string");
@@ -618,6 +682,9 @@ static PyroValue str_strip_runes(PyroVM* vm, size_t arg_count, PyroValue* args)
     }
 
     PyroStr* target = PYRO_AS_STR(args[0]);
+    if (!PyroStr_view(target, vm)) {
+        return pyro_null();
+    }
 
     if (!pyro_is_valid_utf8(target->bytes, target->count)) {
         pyro_panic(vm, "strip_runes(): invalid argument [runes], not valid UTF-8");
@@ -653,7 +720,7 @@ static PyroValue str_strip_runes(PyroVM* vm, size_t arg_count, PyroValue* args)
         end -= cp.length;
     }
 
-    PyroStr* new_str = PyroStr_copy(start, end - start, false, vm);
+    PyroStr* new_str = PyroStr_slice(str, start - str->bytes, end - start, vm);
     if (!new_str) {
         pyro_panic(vm, "strip_runes(): out of memory");
         return pyro_null();
@@ -665,6 +732,9 @@ static PyroValue str_strip_runes(PyroVM* vm, size_t arg_count, PyroValue* args)
 
 static PyroValue str_strip_suffix_runes(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     if (!PYRO_IS_STR(args[0])) {
         pyro_panic(vm, "strip_suffix_runes(): invalid argument [runes], expected a string");
@@ -672,6 +742,9 @@ static PyroValue str_strip_suffix_runes(PyroVM* vm, size_t arg_count, PyroValue*
     }
 
     PyroStr* target = PYRO_AS_STR(args[0]);
+    if (!PyroStr_view(target, vm)) {
+        return pyro_null();
+    }
 
     if (!pyro_is_valid_utf8(target->bytes, target->count)) {
         pyro_panic(vm, "strip_suffix_runes(): invalid argument [runes], not valid UTF-8");
@@ -697,7 +770,7 @@ static PyroValue str_strip_suffix_runes(PyroVM* vm, size_t arg_count, PyroValue*
         end -= cp.length;
     }
 
-    PyroStr* new_str = PyroStr_copy(start, end - start, false, vm);
+    PyroStr* new_str = PyroStr_slice(str, start - str->bytes, end - start, vm);
     if (!new_str) {
         pyro_panic(vm, "strip_suffix_runes(): out of memory");
         return pyro_null();
@@ -709,6 +782,9 @@ static PyroValue str_strip_suffix_runes(PyroVM* vm, size_t arg_count, PyroValue*
 
 static PyroValue str_strip_prefix_runes(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     if (!PYRO_IS_STR(args[0])) {
         pyro_panic(vm, "strip_prefix_runes(): invalid argument [runes], expected a string");
@@ -716,6 +792,9 @@ static PyroValue str_strip_prefix_runes(PyroVM* vm, size_t arg_count, PyroValue*
     }
 
     PyroStr* target = PYRO_AS_STR(args[0]);
+    if (!PyroStr_view(target, vm)) {
+        return pyro_null();
+    }
 
     if (!pyro_is_valid_utf8(target->bytes, target->count)) {
         pyro_panic(vm, "strip_prefix_runes(): invalid argument [runes], not valid UTF-8");
@@ -741,7 +820,7 @@ static PyroValue str_strip_prefix_runes(PyroVM* vm, size_t arg_count, PyroValue*
         start += cp.length;
     }
 
-    PyroStr* new_str = PyroStr_copy(start, end - start, false, vm);
+    PyroStr* new_str = PyroStr_slice(str, start - str->bytes, end - start, vm);
     if (!new_str) {
         pyro_panic(vm, "strip_prefix_runes(): out of memory");
         return pyro_null();
@@ -771,18 +850,24 @@ static PyroValue str_strip(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue str_match(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     if (!PYRO_IS_STR(args[0])) {
         pyro_panic(vm, "match(): invalid argument [target], expected a string");
         return pyro_null();
     }
     PyroStr* target = PYRO_AS_STR(args[0]);
+    if (!PyroStr_view(target, vm)) {
+        return pyro_null();
+    }
 
-    if (!PYRO_IS_I64(args[1]) || args[1].as.i64 < 0) {
+    if (!PYRO_IS_I64(args[1]) || PYRO_AS_I64(args[1]) < 0) {
         pyro_panic(vm, "match(): invalid argument [index], expected a positive integer");
         return pyro_null();
     }
-    size_t index = (size_t)args[1].as.i64;
+    size_t index = (size_t)PYRO_AS_I64(args[1]);
 
     if (index + target->count > str->count) {
         return pyro_bool(false);
@@ -799,18 +884,27 @@ static PyroValue str_match(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue str_replace(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     if (!PYRO_IS_STR(args[0])) {
         pyro_panic(vm, "replace(): invalid argument [old], expected a string");
         return pyro_null();
     }
     PyroStr* old = PYRO_AS_STR(args[0]);
+    if (!PyroStr_view(old, vm)) {
+        return pyro_null();
+    }
 
     if (!PYRO_IS_STR(args[1])) {
         pyro_panic(vm, "replace(): invalid argument [new], expected a string");
         return pyro_null();
     }
     PyroStr* new = PYRO_AS_STR(args[1]);
+    if (!PyroStr_view(new, vm)) {
+        return pyro_null();
+    }
 
     if (old->count == 0 || old->count > str->count) {
         return pyro_obj(str);
@@ -823,22 +917,25 @@ static PyroValue str_replace(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     size_t index = 0;
-    size_t last_possible_match_index = str->count - old->count;
 
-    while (index <= last_possible_match_index) {
-        if (memcmp(&str->bytes[index], old->bytes, old->count) == 0) {
-            if (!PyroBuf_append_bytes(buf, new->count, (uint8_t*)new->bytes, vm)) {
-                pyro_panic(vm, "replace(): out of memory");
-                return pyro_null();
-            }
-            index += old->count;
-        } else {
-            if (!PyroBuf_append_byte(buf, str->bytes[index], vm)) {
-                pyro_panic(vm, "replace(): out of memory");
-                return pyro_null();
-            }
-            index++;
+    while (index < str->count) {
+        const char* match = pyro_find_bytes(&str->bytes[index], str->count - index, old->bytes, old->count);
+        if (!match) {
+            break;
+        }
+
+        size_t match_index = (size_t)(match - str->bytes);
+        if (!PyroBuf_append_bytes(buf, match_index - index, (uint8_t*)&str->bytes[index], vm)) {
+            pyro_panic(vm, "replace(): out of memory");
+            return pyro_null();
         }
+
+        if (!PyroBuf_append_bytes(buf, new->count, (uint8_t*)new->bytes, vm)) {
+            pyro_panic(vm, "replace(): out of memory");
+            return pyro_null();
+        }
+
+        index = match_index + old->count;
     }
 
     if (index < str->count) {
@@ -860,6 +957,9 @@ static PyroValue str_replace(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue str_index_of(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     if (arg_count == 0 || arg_count > 2) {
         pyro_panic(vm, "index_of(): expected 1 or 2 arguments, found %zu", arg_count);
@@ -871,6 +971,9 @@ static PyroValue str_index_of(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
     PyroStr* target = PYRO_AS_STR(args[0]);
+    if (!PyroStr_view(target, vm)) {
+        return pyro_null();
+    }
 
     size_t index = 0;
     if (arg_count == 2) {
@@ -878,24 +981,20 @@ static PyroValue str_index_of(PyroVM* vm, size_t arg_count, PyroValue* args) {
             pyro_panic(vm, "index_of(): invalid argument [start_index], expected an integer");
             return pyro_null();
         }
-        if (args[1].as.i64 < 0 || (size_t)args[1].as.i64 > str->count) {
+        if (PYRO_AS_I64(args[1]) < 0 || (size_t)PYRO_AS_I64(args[1]) > str->count) {
             pyro_panic(vm, "index_of(): invalid argument [start_index], integer is out of range");
             return pyro_null();
         }
-        index = (size_t)args[1].as.i64;
+        index = (size_t)PYRO_AS_I64(args[1]);
     }
 
     if (index + target->count > str->count) {
         return pyro_obj(vm->empty_error);
     }
 
-    size_t last_possible_match_index = str->count - target->count;
-
-    while (index <= last_possible_match_index) {
-        if (memcmp(&str->bytes[index], target->bytes, target->count) == 0) {
-            return pyro_i64((int64_t)index);
-        }
-        index++;
+    const char* match = pyro_find_bytes(&str->bytes[index], str->count - index, target->bytes, target->count);
+    if (match) {
+        return pyro_i64((int64_t)(match - str->bytes));
     }
 
     return pyro_obj(vm->empty_error);
@@ -904,17 +1003,24 @@ static PyroValue str_index_of(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue str_contains(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     char* target;
     size_t target_length;
     uint8_t codepoint_buffer[4];
 
     if (PYRO_IS_STR(args[0])) {
-        target = PYRO_AS_STR(args[0])->bytes;
-        target_length = PYRO_AS_STR(args[0])->count;
+        PyroStr* target_str = PYRO_AS_STR(args[0]);
+        if (!PyroStr_view(target_str, vm)) {
+            return pyro_null();
+        }
+        target = target_str->bytes;
+        target_length = target_str->count;
     } else if (PYRO_IS_RUNE(args[0])) {
         target = (char*)codepoint_buffer;
-        target_length = pyro_write_utf8_codepoint(args[0].as.u32, codepoint_buffer);
+        target_length = pyro_write_utf8_codepoint(PYRO_AS_RUNE(args[0]), codepoint_buffer);
     } else {
         pyro_panic(vm, "contains(): invalid argument [target], expected a string or char");
         return pyro_null();
@@ -924,22 +1030,15 @@ static PyroValue str_contains(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_bool(false);
     }
 
-    size_t index = 0;
-    size_t last_possible_match_index = str->count - target_length;
-
-    while (index <= last_possible_match_index) {
-        if (memcmp(&str->bytes[index], target, target_length) == 0) {
-            return pyro_bool(true);
-        }
-        index++;
-    }
-
-    return pyro_bool(false);
+    return pyro_bool(pyro_find_bytes(str->bytes, str->count, target, target_length) != NULL);
 }
 
 
 static PyroValue str_split_on_ascii_ws(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     PyroVec* vec = PyroVec_new(vm);
     if (!vec) {
@@ -971,8 +1070,9 @@ static PyroValue str_split_on_ascii_ws(PyroVM* vm, size_t arg_count, PyroValue*
     char* current = start;
 
     while (current < end) {
-        if (memchr(whitespace, *current, 6) != NULL) {
-            PyroStr* new_string = PyroStr_copy(start, current - start, false, vm);
+        current = (char*)pyro_find_ascii_ws(current, end);
+        if (current < end) {
+            PyroStr* new_string = PyroStr_slice(str, start - str->bytes, current - start, vm);
             if (!new_string) {
                 pyro_panic(vm, "split_on_ascii_ws(): out of memory");
                 return pyro_null();
@@ -985,12 +1085,10 @@ static PyroValue str_split_on_ascii_ws(PyroVM* vm, size_t arg_count, PyroValue*
                 current++;
             }
             start = current;
-        } else {
-            current++;
         }
     }
 
-    PyroStr* new_string = PyroStr_copy(start, current - start, false, vm);
+    PyroStr* new_string = PyroStr_slice(str, start - str->bytes, current - start, vm);
     if (!new_string) {
         pyro_panic(vm, "split_on_ascii_ws(): out of memory");
         return pyro_null();
@@ -1016,12 +1114,18 @@ static PyroValue str_split(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     if (!PYRO_IS_STR(args[0])) {
         pyro_panic(vm, "split(): invalid argument [sep], expected a string");
         return pyro_null();
     }
     PyroStr* sep = PYRO_AS_STR(args[0]);
+    if (!PyroStr_view(sep, vm)) {
+        return pyro_null();
+    }
 
     PyroVec* vec = PyroVec_new(vm);
     if (!vec) {
@@ -1038,28 +1142,28 @@ static PyroValue str_split(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     size_t start = 0;
-    size_t current = 0;
-    size_t last_possible_match_index = str->count - sep->count;
 
-    while (current <= last_possible_match_index) {
-        if (memcmp(&str->bytes[current], sep->bytes, sep->count) == 0) {
-            PyroStr* new_string = PyroStr_copy(&str->bytes[start], current - start, false, vm);
-            if (!new_string) {
-                pyro_panic(vm, "split(): out of memory");
-                return pyro_null();
-            }
-            if (!PyroVec_append(vec, pyro_obj(new_string), vm)) {
-                pyro_panic(vm, "split(): out of memory");
-                return pyro_null();
-            }
-            current += sep->count;
-            start = current;
-        } else {
-            current++;
+    while (start < str->count) {
+        const char* match = pyro_find_bytes(&str->bytes[start], str->count - start, sep->bytes, sep->count);
+        if (!match) {
+            break;
         }
+
+        size_t match_index = (size_t)(match - str->bytes);
+        PyroStr* new_string = PyroStr_slice(str, start, match_index - start, vm);
+        if (!new_string) {
+            pyro_panic(vm, "split(): out of memory");
+            return pyro_null();
+        }
+        if (!PyroVec_append(vec, pyro_obj(new_string), vm)) {
+            pyro_panic(vm, "split(): out of memory");
+            return pyro_null();
+        }
+
+        start = match_index + sep->count;
     }
 
-    PyroStr* new_string = PyroStr_copy(&str->bytes[start], str->count - start, false, vm);
+    PyroStr* new_string = PyroStr_slice(str, start, str->count - start, vm);
     if (!new_string) {
         pyro_panic(vm, "split(): out of memory");
         return pyro_null();
@@ -1076,6 +1180,9 @@ static PyroValue str_split(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue str_to_hex(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
     if (str->count == 0) {
         return pyro_obj(str);
     }
@@ -1105,6 +1212,9 @@ static PyroValue str_to_hex(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue str_slice(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
 
     if (!(arg_count == 1 || arg_count == 2)) {
         pyro_panic(vm, "slice(): expected 1 or 2 arguments, found %zu", arg_count);
@@ -1117,10 +1227,10 @@ static PyroValue str_slice(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     size_t start_index;
-    if (args[0].as.i64 >= 0 && (size_t)args[0].as.i64 <= str->count) {
-        start_index = (size_t)args[0].as.i64;
-    } else if (args[0].as.i64 < 0 && (size_t)(args[0].as.i64 * -1) <= str->count) {
-        start_index = (size_t)((int64_t)str->count + args[0].as.i64);
+    if (PYRO_AS_I64(args[0]) >= 0 && (size_t)PYRO_AS_I64(args[0]) <= str->count) {
+        start_index = (size_t)PYRO_AS_I64(args[0]);
+    } else if (PYRO_AS_I64(args[0]) < 0 && (size_t)(PYRO_AS_I64(args[0]) * -1) <= str->count) {
+        start_index = (size_t)((int64_t)str->count + PYRO_AS_I64(args[0]));
     } else {
         pyro_panic(vm, "slice(): invalid argument [start_index], out of range");
         return pyro_null();
@@ -1132,22 +1242,22 @@ static PyroValue str_slice(PyroVM* vm, size_t arg_count, PyroValue* args) {
             pyro_panic(vm, "slice(): invalid argument [length], expected an integer");
             return pyro_null();
         }
-        if (args[1].as.i64 < 0) {
+        if (PYRO_AS_I64(args[1]) < 0) {
             pyro_panic(vm, "slice(): invalid argument [length], expected a positive integer");
             return pyro_null();
         }
-        if (start_index + (size_t)args[1].as.i64 > str->count) {
+        if (start_index + (size_t)PYRO_AS_I64(args[1]) > str->count) {
             pyro_panic(vm, "slice(): invalid argument [length], out of range");
             return pyro_null();
         }
-        length = (size_t)args[1].as.i64;
+        length = (size_t)PYRO_AS_I64(args[1]);
     }
 
     if (length == 0) {
         return pyro_obj(vm->empty_string);
     }
 
-    PyroStr* new_str = PyroStr_copy(&str->bytes[start_index], length, false, vm);
+    PyroStr* new_str = PyroStr_slice(str, start_index, length, vm);
     if (!new_str) {
         pyro_panic(vm, "slice(): out of memory");
         return pyro_null();
@@ -1159,6 +1269,9 @@ static PyroValue str_slice(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue str_join(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_flatten(str, vm)) {
+        return pyro_null();
+    }
 
     // Does the argument have an :$iter() method?
     PyroValue iter_method = pyro_get_method(vm, args[0], vm->str_dollar_iter);
@@ -1239,6 +1352,9 @@ static PyroValue str_join(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue str_is_ascii_decimal(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
     if (str->count == 0) {
         return pyro_bool(false);
     }
@@ -1256,6 +1372,9 @@ static PyroValue str_is_ascii_decimal(PyroVM* vm, size_t arg_count, PyroValue* a
 
 static PyroValue str_is_ascii_octal(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
     if (str->count == 0) {
         return pyro_bool(false);
     }
@@ -1273,6 +1392,9 @@ static PyroValue str_is_ascii_octal(PyroVM* vm, size_t arg_count, PyroValue* arg
 
 static PyroValue str_is_ascii_hex(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
     if (str->count == 0) {
         return pyro_bool(false);
     }
@@ -1290,6 +1412,9 @@ static PyroValue str_is_ascii_hex(PyroVM* vm, size_t arg_count, PyroValue* args)
 
 static PyroValue str_is_ascii_alpha(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
     if (str->count == 0) {
         return pyro_bool(false);
     }
@@ -1307,6 +1432,9 @@ static PyroValue str_is_ascii_alpha(PyroVM* vm, size_t arg_count, PyroValue* arg
 
 static PyroValue str_is_ascii_printable(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroStr* str = PYRO_AS_STR(args[-1]);
+    if (!PyroStr_view(str, vm)) {
+        return pyro_null();
+    }
     if (str->count == 0) {
         return pyro_bool(false);
     }
@@ -211,7 +211,7 @@ static PyroValue fn_exit(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0])) {
         vm->halt_flag = true;
         vm->exit_flag = true;
-        vm->exit_code = args[0].as.i64;
+        vm->exit_code = PYRO_AS_I64(args[0]);
         return pyro_null();
     }
 
@@ -298,29 +298,32 @@ static PyroValue fn_clock(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 
 static PyroValue fn_is_nan(PyroVM* vm, size_t arg_count, PyroValue* args) {
-    return pyro_bool(PYRO_IS_F64(args[0]) && isnan(args[0].as.f64));
+    return pyro_bool(PYRO_IS_F64(args[0]) && isnan(PYRO_AS_F64(args[0])));
 }
 
 
 static PyroValue fn_is_inf(PyroVM* vm, size_t arg_count, PyroValue* args) {
-    return pyro_bool(PYRO_IS_F64(args[0]) && isinf(args[0].as.f64));
+    return pyro_bool(PYRO_IS_F64(args[0]) && isinf(PYRO_AS_F64(args[0])));
 }
 
 
 static PyroValue fn_f64(PyroVM* vm, size_t arg_count, PyroValue* args) {
-    switch (args[0].type) {
+    switch (PYRO_TYPE_OF(args[0])) {
         case PYRO_VALUE_I64:
-            return pyro_f64((double)args[0].as.i64);
+            return pyro_f64((double)PYRO_AS_I64(args[0]));
 
         case PYRO_VALUE_F64:
             return args[0];
 
         case PYRO_VALUE_RUNE:
-            return pyro_f64((double)args[0].as.u32);
+            return pyro_f64((double)PYRO_AS_RUNE(args[0]));
 
         case PYRO_VALUE_OBJ: {
             if (PYRO_IS_STR(args[0])) {
                 PyroStr* string = PYRO_AS_STR(args[0]);
+                if (!PyroStr_view(string, vm)) {
+                    return pyro_null();
+                }
                 double value;
                 if (pyro_parse_string_as_float(string->bytes, string->count, &value)) {
                     return pyro_f64(value);
@@ -345,18 +348,18 @@ static PyroValue fn_is_f64(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 
 static PyroValue fn_i64(PyroVM* vm, size_t arg_count, PyroValue* args) {
-    switch (args[0].type) {
+    switch (PYRO_TYPE_OF(args[0])) {
         case PYRO_VALUE_I64:
             return args[0];
 
         case PYRO_VALUE_RUNE:
-            return pyro_i64((int64_t)args[0].as.u32);
+            return pyro_i64((int64_t)PYRO_AS_RUNE(args[0]));
 
         case PYRO_VALUE_F64: {
-            if (args[0].as.f64 >= -9223372036854775808.0    // -2^63 == I64_MIN
-                && args[0].as.f64 < 9223372036854775808.0   // 2^63 == I64_MAX + 1
+            if (PYRO_AS_F64(args[0]) >= (double)PYRO_I64_MIN            // -2^63 == I64_MIN
+                && PYRO_AS_F64(args[0]) < (double)PYRO_I64_MAX + 1.0    // 2^63 == I64_MAX + 1
             ) {
-                return pyro_i64((int64_t)args[0].as.f64);
+                return pyro_i64((int64_t)PYRO_AS_F64(args[0]));
             }
             pyro_panic(vm, "$i64(): invalid argument, floating-point value is out-of-range");
             return pyro_null();
@@ -365,6 +368,9 @@ static PyroValue fn_i64(PyroVM* vm, size_t arg_count, PyroValue* args) {
         case PYRO_VALUE_OBJ: {
             if (PYRO_IS_STR(args[0])) {
                 PyroStr* string = PYRO_AS_STR(args[0]);
+                if (!PyroStr_view(string, vm)) {
+                    return pyro_null();
+                }
                 int64_t value;
                 if (pyro_parse_string_as_int(string->bytes, string->count, &value)) {
                     return pyro_i64(value);
@@ -470,7 +476,12 @@ static PyroValue fn_shell_shortcut(PyroVM* vm, size_t arg_count, PyroValue* args
     PyroBuf* stderr_output;
     int exit_code;
 
-    char* command = PYRO_AS_STR(args[0])->bytes;
+    PyroStr* command_str = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(command_str, vm)) {
+        return pyro_null();
+    }
+
+    char* command = command_str->bytes;
     char* argv[] = {"/bin/sh", "-c", command, (char*)NULL};
 
     if (!pyro_run_executable(vm, "/bin/sh", argv, NULL, 0, &stdout_output, &stderr_output, &exit_code)) {
@@ -513,14 +524,23 @@ static PyroValue fn_shell(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    char* command = PYRO_AS_STR(args[0])->bytes;
+    PyroStr* command_str = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(command_str, vm)) {
+        return pyro_null();
+    }
+
+    char* command = command_str->bytes;
     uint8_t* stdin_input = NULL;
     size_t stdin_input_length = 0;
 
     if (arg_count == 2) {
         if (PYRO_IS_STR(args[1])) {
-            stdin_input = (uint8_t*)PYRO_AS_STR(args[1])->bytes;
-            stdin_input_length = PYRO_AS_STR(args[1])->count;
+            PyroStr* input = PYRO_AS_STR(args[1]);
+            if (!PyroStr_view(input, vm)) {
+                return pyro_null();
+            }
+            stdin_input = (uint8_t*)input->bytes;
+            stdin_input_length = input->count;
         } else if (PYRO_IS_BUF(args[1])) {
             stdin_input = PYRO_AS_BUF(args[1])->bytes;
             stdin_input_length = PYRO_AS_BUF(args[1])->count;
@@ -572,7 +592,12 @@ static PyroValue fn_run(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    char* path = PYRO_AS_STR(args[0])->bytes;
+    PyroStr* path_str = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(path_str, vm)) {
+        return pyro_null();
+    }
+
+    char* path = path_str->bytes;
     char** argv = NULL;
 
     // Setup [argv].
@@ -619,7 +644,12 @@ static PyroValue fn_run(PyroVM* vm, size_t arg_count, PyroValue* args) {
                 );
                 return pyro_null();
             }
-            argv[i+1] = PYRO_AS_STR(value)->bytes;
+            PyroStr* arg = PYRO_AS_STR(value);
+            if (!PyroStr_flatten(arg, vm)) {
+                free(argv);
+                return pyro_null();
+            }
+            argv[i+1] = arg->bytes;
         }
 
         argv[0] = path;
@@ -632,8 +662,13 @@ static PyroValue fn_run(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
     if (arg_count == 3) {
         if (PYRO_IS_STR(args[2])) {
-            stdin_input = (uint8_t*)PYRO_AS_STR(args[2])->bytes;
-            stdin_input_length = PYRO_AS_STR(args[2])->count;
+            PyroStr* input = PYRO_AS_STR(args[2]);
+            if (!PyroStr_view(input, vm)) {
+                free(argv);
+                return pyro_null();
+            }
+            stdin_input = (uint8_t*)input->bytes;
+            stdin_input_length = input->count;
         } else if (PYRO_IS_BUF(args[2])) {
             stdin_input = PYRO_AS_BUF(args[2])->bytes;
             stdin_input_length = PYRO_AS_BUF(args[2])->count;
@@ -715,7 +750,12 @@ static PyroValue fn_read_file(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    PyroBuf* buf = pyro_read_file_into_buf(vm, PYRO_AS_STR(args[0])->bytes, "$read_file()");
+    PyroStr* path = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(path, vm)) {
+        return pyro_null();
+    }
+
+    PyroBuf* buf = pyro_read_file_into_buf(vm, path->bytes, "$read_file()");
     if (vm->halt_flag) {
         return pyro_null();
     }
@@ -741,9 +781,14 @@ static PyroValue fn_write_file(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    FILE* stream = fopen(PYRO_AS_STR(args[0])->bytes, "w");
+    PyroStr* path = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(path, vm)) {
+        return pyro_null();
+    }
+
+    FILE* stream = fopen(path->bytes, "w");
     if (!stream) {
-        pyro_panic(vm, "$write_file(): unable to open file '%s'", PYRO_AS_STR(args[0])->bytes);
+        pyro_panic(vm, "$write_file(): unable to open file '%s'", path->bytes);
         return pyro_null();
     }
 
@@ -760,6 +805,10 @@ static PyroValue fn_write_file(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     PyroStr* string = PYRO_AS_STR(args[1]);
+    if (!PyroStr_view(string, vm)) {
+        fclose(stream);
+        return pyro_null();
+    }
     size_t n = fwrite(string->bytes, sizeof(char), string->count, stream);
     if (n < string->count) {
         pyro_panic(vm, "$write_file(): I/O write error");
@@ -779,10 +828,10 @@ static PyroValue fn_hash(PyroVM* vm, size_t arg_count, PyroValue* args) {
 static PyroValue fn_sleep(PyroVM* vm, size_t arg_count, PyroValue* args) {
     double time_in_seconds;
 
-    if (PYRO_IS_I64(args[0]) && args[0].as.i64 >= 0) {
-        time_in_seconds = (double)args[0].as.i64;
-    } else if (PYRO_IS_F64(args[0]) && args[0].as.f64 >= 0) {
-        time_in_seconds = args[0].as.f64;
+    if (PYRO_IS_I64(args[0]) && PYRO_AS_I64(args[0]) >= 0) {
+        time_in_seconds = (double)PYRO_AS_I64(args[0]);
+    } else if (PYRO_IS_F64(args[0]) && PYRO_AS_F64(args[0]) >= 0) {
+        time_in_seconds = PYRO_AS_F64(args[0]);
     } else {
         pyro_panic(vm, "$sleep(): invalid argument [time_in_seconds], expected a positive number");
         return pyro_null();
@@ -855,6 +904,9 @@ static PyroValue fn_env(PyroVM* vm, size_t arg_count, PyroValue* args) {
         }
 
         PyroStr* name = PYRO_AS_STR(args[0]);
+        if (!PyroStr_flatten(name, vm)) {
+            return pyro_null();
+        }
         char* value = getenv(name->bytes);
         if (!value) {
             return pyro_obj(vm->empty_error);
@@ -876,6 +928,9 @@ static PyroValue fn_env(PyroVM* vm, size_t arg_count, PyroValue* args) {
             return pyro_null();
         }
         PyroStr* name = PYRO_AS_STR(args[0]);
+        if (!PyroStr_flatten(name, vm)) {
+            return pyro_null();
+        }
 
         PyroStr* value = pyro_stringify_value(vm, args[1]);
         if (vm->halt_flag) {
@@ -907,6 +962,9 @@ static PyroValue fn_input(PyroVM* vm, size_t arg_count, PyroValue* args) {
             return pyro_null();
         }
         PyroStr* prompt = PYRO_AS_STR(args[0]);
+        if (!PyroStr_flatten(prompt, vm)) {
+            return pyro_null();
+        }
         pyro_stdout_write_s(vm, prompt);
         pyro_stdout_flush(vm);
     }
@@ -932,6 +990,9 @@ static PyroValue fn_exec(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
     PyroStr* code = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(code, vm)) {
+        return pyro_null();
+    }
 
     PyroMod* module;
     if (arg_count > 2) {
@@ -954,7 +1015,11 @@ static PyroValue fn_exec(PyroVM* vm, size_t arg_count, PyroValue* args) {
             pyro_panic(vm, "$exec(): invalid argument [source_id], expected a string");
             return pyro_null();
         }
-        source_id = PYRO_AS_STR(args[1])->bytes;
+        PyroStr* source_id_str = PYRO_AS_STR(args[1]);
+        if (!PyroStr_flatten(source_id_str, vm)) {
+            return pyro_null();
+        }
+        source_id = source_id_str->bytes;
     } else {
         source_id = "<exec>";
     }
@@ -982,6 +1047,9 @@ static PyroValue fn_method(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
     PyroStr* method_name = PYRO_AS_STR(args[1]);
+    if (!PyroStr_flatten(method_name, vm)) {
+        return pyro_null();
+    }
 
     PyroValue method = pyro_get_method(vm, obj, method_name);
     if (PYRO_IS_NULL(method)) {
@@ -1030,7 +1098,7 @@ static PyroValue fn_field(PyroVM* vm, size_t arg_count, PyroValue* args) {
         PyroMap* field_index_map = PYRO_AS_INSTANCE(args[0])->obj.class->all_field_indexes;
         PyroValue field_index;
         if (PyroMap_get(field_index_map, field_name, &field_index, vm)) {
-            return PYRO_AS_INSTANCE(args[0])->fields[field_index.as.i64];
+            return PYRO_AS_INSTANCE(args[0])->fields[PYRO_AS_I64(field_index)];
         }
     }
 
@@ -1079,6 +1147,9 @@ static PyroValue fn_import(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     PyroStr* import_path = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(import_path, vm)) {
+        return pyro_null();
+    }
 
     PyroMod* module = PyroMod_new(vm);
     if (!module) {
@@ -1097,7 +1168,7 @@ static PyroValue fn_import(PyroVM* vm, size_t arg_count, PyroValue* args) {
 static PyroValue fn_add(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0]) && PYRO_IS_I64(args[1])) {
         int64_t result;
-        if (pyro_ckd_add(&result, args[0].as.i64, args[1].as.i64)) {
+        if (pyro_ckd_add(&result, PYRO_AS_I64(args[0]), PYRO_AS_I64(args[1]))) {
             pyro_panic(vm, "$add(): signed integer overflow");
             return pyro_null();
         }
@@ -1111,7 +1182,7 @@ static PyroValue fn_add(PyroVM* vm, size_t arg_count, PyroValue* args) {
 static PyroValue fn_sub(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0]) && PYRO_IS_I64(args[1])) {
         int64_t result;
-        if (pyro_ckd_sub(&result, args[0].as.i64, args[1].as.i64)) {
+        if (pyro_ckd_sub(&result, PYRO_AS_I64(args[0]), PYRO_AS_I64(args[1]))) {
             pyro_panic(vm, "$sub(): signed integer overflow");
             return pyro_null();
         }
@@ -1125,7 +1196,7 @@ static PyroValue fn_sub(PyroVM* vm, size_t arg_count, PyroValue* args) {
 static PyroValue fn_mul(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0]) && PYRO_IS_I64(args[1])) {
         int64_t result;
-        if (pyro_ckd_mul(&result, args[0].as.i64, args[1].as.i64)) {
+        if (pyro_ckd_mul(&result, PYRO_AS_I64(args[0]), PYRO_AS_I64(args[1]))) {
             pyro_panic(vm, "$mul(): signed integer overflow");
             return pyro_null();
         }
@@ -1143,6 +1214,9 @@ static PyroValue fn_eval(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     PyroStr* code = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(code, vm)) {
+        return pyro_null();
+    }
     if (code->count == 0) {
         pyro_panic(vm, "$eval(): invalid argument [expr], empty string");
         return pyro_null();
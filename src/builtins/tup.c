@@ -34,7 +34,7 @@ static PyroValue tup_get(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    int64_t index = args[0].as.i64;
+    int64_t index = PYRO_AS_I64(args[0]);
     if (index < 0) {
         index += tup->count;
     }
@@ -72,12 +72,12 @@ static PyroValue tup_slice(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     size_t start_index;
-    if (args[0].as.i64 >= 0 && (size_t)args[0].as.i64 <= tup->count) {
-        start_index = (size_t)args[0].as.i64;
-    } else if (args[0].as.i64 < 0 && (size_t)(args[0].as.i64 * -1) <= tup->count) {
-        start_index = (size_t)((int64_t)tup->count + args[0].as.i64);
+    if (PYRO_AS_I64(args[0]) >= 0 && (size_t)PYRO_AS_I64(args[0]) <= tup->count) {
+        start_index = (size_t)PYRO_AS_I64(args[0]);
+    } else if (PYRO_AS_I64(args[0]) < 0 && (size_t)(PYRO_AS_I64(args[0]) * -1) <= tup->count) {
+        start_index = (size_t)((int64_t)tup->count + PYRO_AS_I64(args[0]));
     } else {
-        pyro_panic(vm, "slice(): invalid argument [start_index], integer (%d) is out of range", args[0].as.i64);
+        pyro_panic(vm, "slice(): invalid argument [start_index], integer (%d) is out of range", PYRO_AS_I64(args[0]));
         return pyro_null();
     }
 
@@ -87,15 +87,15 @@ static PyroValue tup_slice(PyroVM* vm, size_t arg_count, PyroValue* args) {
             pyro_panic(vm, "slice(): invalid argument [length], expected an integer");
             return pyro_null();
         }
-        if (args[1].as.i64 < 0) {
+        if (PYRO_AS_I64(args[1]) < 0) {
             pyro_panic(vm, "slice(): invalid argument [length], expected a positive integer");
             return pyro_null();
         }
-        if (start_index + (size_t)args[1].as.i64 > tup->count) {
-            pyro_panic(vm, "slice(): invalid argument [length], integer (%d) is out of range", args[1].as.i64);
+        if (start_index + (size_t)PYRO_AS_I64(args[1]) > tup->count) {
+            pyro_panic(vm, "slice(): invalid argument [length], integer (%d) is out of range", PYRO_AS_I64(args[1]));
             return pyro_null();
         }
-        length = (size_t)args[1].as.i64;
+        length = (size_t)PYRO_AS_I64(args[1]);
     }
 
     PyroTup* new_tup = PyroTup_new(length, vm);
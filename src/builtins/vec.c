@@ -62,8 +62,8 @@ static PyroValue fn_vec(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     if (arg_count == 2) {
-        if (PYRO_IS_I64(args[0]) && args[0].as.i64 >= 0) {
-            size_t size = args[0].as.i64;
+        if (PYRO_IS_I64(args[0]) && PYRO_AS_I64(args[0]) >= 0) {
+            size_t size = PYRO_AS_I64(args[0]);
             PyroVec* vec = PyroVec_new_with_capacity(size, vm);
             if (!vec) {
                 pyro_panic(vm, "out of memory");
@@ -191,7 +191,7 @@ static PyroValue vec_get(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    int64_t index = args[0].as.i64;
+    int64_t index = PYRO_AS_I64(args[0]);
     if (index < 0) {
         index += vec->count;
     }
@@ -216,7 +216,7 @@ static PyroValue vec_set(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    int64_t index = args[0].as.i64;
+    int64_t index = PYRO_AS_I64(args[0]);
     if (index < 0) {
         index += vec->count;
     }
@@ -227,6 +227,7 @@ static PyroValue vec_set(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     vec->version++;
+    pyro_write_barrier(vm, (PyroObject*)vec, args[1]);
     vec->values[index] = args[1];
     return args[1];
 }
@@ -385,6 +386,7 @@ static PyroValue vec_map(PyroVM* vm, size_t arg_count, PyroValue* args) {
         if (vm->halt_flag) {
             return pyro_null();
         }
+        pyro_write_barrier(vm, (PyroObject*)new_vec, result);
         new_vec->values[i] = result;
         new_vec->count++;
     }
@@ -461,12 +463,12 @@ static PyroValue vec_remove_at_index(PyroVM* vm, size_t arg_count, PyroValue* ar
         return pyro_null();
     }
 
-    if (args[0].as.i64 < 0) {
+    if (PYRO_AS_I64(args[0]) < 0) {
         pyro_panic(vm, "remove_at_index(): invalid argument [index], out of range");
         return pyro_null();
     }
 
-    return PyroVec_remove_at_index(vec, args[0].as.i64, vm);
+    return PyroVec_remove_at_index(vec, PYRO_AS_I64(args[0]), vm);
 }
 
 
@@ -505,12 +507,12 @@ static PyroValue vec_insert_at_index(PyroVM* vm, size_t arg_count, PyroValue* ar
         return pyro_null();
     }
 
-    if (args[0].as.i64 < 0 || (size_t)args[0].as.i64 > vec->count) {
+    if (PYRO_AS_I64(args[0]) < 0 || (size_t)PYRO_AS_I64(args[0]) > vec->count) {
         pyro_panic(vm, "insert_at_index(): invalid argument [index], out of range");
         return pyro_null();
     }
 
-    PyroVec_insert_at_index(vec, args[0].as.i64, args[1], vm);
+    PyroVec_insert_at_index(vec, PYRO_AS_I64(args[0]), args[1], vm);
     return pyro_null();
 }
 
@@ -592,12 +594,12 @@ static PyroValue vec_slice(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     size_t start_index;
-    if (args[0].as.i64 >= 0 && (size_t)args[0].as.i64 <= vec->count) {
-        start_index = (size_t)args[0].as.i64;
-    } else if (args[0].as.i64 < 0 && (size_t)(args[0].as.i64 * -1) <= vec->count) {
-        start_index = (size_t)((int64_t)vec->count + args[0].as.i64);
+    if (PYRO_AS_I64(args[0]) >= 0 && (size_t)PYRO_AS_I64(args[0]) <= vec->count) {
+        start_index = (size_t)PYRO_AS_I64(args[0]);
+    } else if (PYRO_AS_I64(args[0]) < 0 && (size_t)(PYRO_AS_I64(args[0]) * -1) <= vec->count) {
+        start_index = (size_t)((int64_t)vec->count + PYRO_AS_I64(args[0]));
     } else {
-        pyro_panic(vm, "slice(): invalid argument [start_index], integer (%d) is out of range", args[0].as.i64);
+        pyro_panic(vm, "slice(): invalid argument [start_index], integer (%d) is out of range", PYRO_AS_I64(args[0]));
         return pyro_null();
     }
 
@@ -607,15 +609,15 @@ static PyroValue vec_slice(PyroVM* vm, size_t arg_count, PyroValue* args) {
             pyro_panic(vm, "slice(): invalid argument [length], expected an integer");
             return pyro_null();
         }
-        if (args[1].as.i64 < 0) {
+        if (PYRO_AS_I64(args[1]) < 0) {
             pyro_panic(vm, "slice(): invalid argument [length], expected a positive integer");
             return pyro_null();
         }
-        if (start_index + (size_t)args[1].as.i64 > vec->count) {
-            pyro_panic(vm, "slice(): invalid argument [length], integer (%d) is out of range", args[1].as.i64);
+        if (start_index + (size_t)PYRO_AS_I64(args[1]) > vec->count) {
+            pyro_panic(vm, "slice(): invalid argument [length], integer (%d) is out of range", PYRO_AS_I64(args[1]));
             return pyro_null();
         }
-        length = (size_t)args[1].as.i64;
+        length = (size_t)PYRO_AS_I64(args[1]);
     }
 
     PyroVec* new_vec = PyroVec_new(vm);
@@ -681,6 +683,9 @@ static PyroValue vec_join(PyroVM* vm, size_t arg_count, PyroValue* args) {
             return pyro_null();
         }
         PyroStr* sep = PYRO_AS_STR(args[0]);
+        if (!PyroStr_flatten(sep, vm)) {
+            return pyro_null();
+        }
         if (!pyro_push(vm, pyro_obj(iter))) return pyro_null();
         PyroStr* result = PyroIter_join(iter, sep->bytes, sep->count, vm);
         pyro_pop(vm);
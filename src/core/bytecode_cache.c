@@ -0,0 +1,761 @@
+#include "../includes/pyro.h"
+
+
+// Identifies a bytecode cache file.
+static const uint8_t MAGIC[8] = {'P', 'Y', 'R', 'O', 'C', 0, 0, 0};
+
+// Increment this whenever the layout of the cache file changes.
+#define FORMAT_VERSION 2
+
+// The number of opcodes.
+#define OPCODE_COUNT (PYRO_OPCODE_UNPACK + 1)
+
+// Bytecode compiled with NaN-boxing enabled can't use the full range of 64-bit integers.
+#define BUILD_FLAGS (PYRO_USE_NAN_BOXING ? 1 : 0)
+
+// The header is followed by the serialized module-level function. Nested functions are
+// serialized inline in their parent function's constant table.
+// - magic: 8 bytes
+// - format version, VM major, minor, and patch versions, opcode count, build flags: 6 x u32
+// - instruction set hash, source length, source hash, payload length, payload hash: 5 x u64
+#define HEADER_SIZE (8 + 6 * 4 + 5 * 8)
+#define PAYLOAD_LENGTH_OFFSET (8 + 6 * 4 + 3 * 8)
+#define PAYLOAD_HASH_OFFSET (8 + 6 * 4 + 4 * 8)
+
+// Opcodes are numbered by their position in the PyroOpcode enum. Each entry is stored at its
+// opcode's index so reordering the enum changes the instruction set hash below.
+static const char* OPCODE_NAMES[] = {
+    [PYRO_OPCODE_ASSERT_FAILED] = "ASSERT_FAILED",
+    [PYRO_OPCODE_BINARY_AMP] = "BINARY_AMP",
+    [PYRO_OPCODE_BINARY_BANG_EQUAL] = "BINARY_BANG_EQUAL",
+    [PYRO_OPCODE_BINARY_BAR] = "BINARY_BAR",
+    [PYRO_OPCODE_BINARY_CARET] = "BINARY_CARET",
+    [PYRO_OPCODE_BINARY_EQUAL_EQUAL] = "BINARY_EQUAL_EQUAL",
+    [PYRO_OPCODE_BINARY_GREATER] = "BINARY_GREATER",
+    [PYRO_OPCODE_BINARY_GREATER_EQUAL] = "BINARY_GREATER_EQUAL",
+    [PYRO_OPCODE_BINARY_GREATER_GREATER] = "BINARY_GREATER_GREATER",
+    [PYRO_OPCODE_BINARY_IN] = "BINARY_IN",
+    [PYRO_OPCODE_BINARY_LESS] = "BINARY_LESS",
+    [PYRO_OPCODE_BINARY_LESS_EQUAL] = "BINARY_LESS_EQUAL",
+    [PYRO_OPCODE_BINARY_LESS_LESS] = "BINARY_LESS_LESS",
+    [PYRO_OPCODE_BINARY_MINUS] = "BINARY_MINUS",
+    [PYRO_OPCODE_BINARY_PERCENT] = "BINARY_PERCENT",
+    [PYRO_OPCODE_BINARY_PLUS] = "BINARY_PLUS",
+    [PYRO_OPCODE_BINARY_SLASH] = "BINARY_SLASH",
+    [PYRO_OPCODE_BINARY_SLASH_SLASH] = "BINARY_SLASH_SLASH",
+    [PYRO_OPCODE_BINARY_STAR] = "BINARY_STAR",
+    [PYRO_OPCODE_BINARY_STAR_STAR] = "BINARY_STAR_STAR",
+    [PYRO_OPCODE_BINARY_MOD] = "BINARY_MOD",
+    [PYRO_OPCODE_BINARY_REM] = "BINARY_REM",
+    [PYRO_OPCODE_BINARY_PLUS_I64] = "BINARY_PLUS_I64",
+    [PYRO_OPCODE_BINARY_PLUS_F64] = "BINARY_PLUS_F64",
+    [PYRO_OPCODE_BINARY_MINUS_I64] = "BINARY_MINUS_I64",
+    [PYRO_OPCODE_BINARY_MINUS_F64] = "BINARY_MINUS_F64",
+    [PYRO_OPCODE_BINARY_STAR_I64] = "BINARY_STAR_I64",
+    [PYRO_OPCODE_BINARY_STAR_F64] = "BINARY_STAR_F64",
+    [PYRO_OPCODE_BINARY_LESS_I64] = "BINARY_LESS_I64",
+    [PYRO_OPCODE_BINARY_LESS_F64] = "BINARY_LESS_F64",
+    [PYRO_OPCODE_BINARY_LESS_EQUAL_I64] = "BINARY_LESS_EQUAL_I64",
+    [PYRO_OPCODE_BINARY_LESS_EQUAL_F64] = "BINARY_LESS_EQUAL_F64",
+    [PYRO_OPCODE_BINARY_GREATER_I64] = "BINARY_GREATER_I64",
+    [PYRO_OPCODE_BINARY_GREATER_F64] = "BINARY_GREATER_F64",
+    [PYRO_OPCODE_BINARY_GREATER_EQUAL_I64] = "BINARY_GREATER_EQUAL_I64",
+    [PYRO_OPCODE_BINARY_GREATER_EQUAL_F64] = "BINARY_GREATER_EQUAL_F64",
+    [PYRO_OPCODE_BREAK] = "BREAK",
+    [PYRO_OPCODE_CALL_COUNT] = "CALL_COUNT",
+    [PYRO_OPCODE_CALL_METHOD] = "CALL_METHOD",
+    [PYRO_OPCODE_CALL_METHOD_WITH_UNPACK] = "CALL_METHOD_WITH_UNPACK",
+    [PYRO_OPCODE_CALL_PUB_METHOD] = "CALL_PUB_METHOD",
+    [PYRO_OPCODE_CALL_PUB_METHOD_WITH_UNPACK] = "CALL_PUB_METHOD_WITH_UNPACK",
+    [PYRO_OPCODE_CALL_SUPER_METHOD] = "CALL_SUPER_METHOD",
+    [PYRO_OPCODE_CALL_SUPER_METHOD_WITH_UNPACK] = "CALL_SUPER_METHOD_WITH_UNPACK",
+    [PYRO_OPCODE_CALL_VALUE] = "CALL_VALUE",
+    [PYRO_OPCODE_CALL_VALUE_0] = "CALL_VALUE_0",
+    [PYRO_OPCODE_CALL_VALUE_1] = "CALL_VALUE_1",
+    [PYRO_OPCODE_CALL_VALUE_2] = "CALL_VALUE_2",
+    [PYRO_OPCODE_CALL_VALUE_3] = "CALL_VALUE_3",
+    [PYRO_OPCODE_CALL_VALUE_4] = "CALL_VALUE_4",
+    [PYRO_OPCODE_CALL_VALUE_5] = "CALL_VALUE_5",
+    [PYRO_OPCODE_CALL_VALUE_6] = "CALL_VALUE_6",
+    [PYRO_OPCODE_CALL_VALUE_7] = "CALL_VALUE_7",
+    [PYRO_OPCODE_CALL_VALUE_8] = "CALL_VALUE_8",
+    [PYRO_OPCODE_CALL_VALUE_9] = "CALL_VALUE_9",
+    [PYRO_OPCODE_CALL_VALUE_WITH_UNPACK] = "CALL_VALUE_WITH_UNPACK",
+    [PYRO_OPCODE_CONCAT_STRINGS] = "CONCAT_STRINGS",
+    [PYRO_OPCODE_CLOSE_UPVALUE] = "CLOSE_UPVALUE",
+    [PYRO_OPCODE_DEFINE_PRI_FIELD] = "DEFINE_PRI_FIELD",
+    [PYRO_OPCODE_DEFINE_PRI_GLOBAL] = "DEFINE_PRI_GLOBAL",
+    [PYRO_OPCODE_DEFINE_PRI_GLOBALS] = "DEFINE_PRI_GLOBALS",
+    [PYRO_OPCODE_DEFINE_PRI_METHOD] = "DEFINE_PRI_METHOD",
+    [PYRO_OPCODE_DEFINE_PUB_FIELD] = "DEFINE_PUB_FIELD",
+    [PYRO_OPCODE_DEFINE_PUB_GLOBAL] = "DEFINE_PUB_GLOBAL",
+    [PYRO_OPCODE_DEFINE_PUB_GLOBALS] = "DEFINE_PUB_GLOBALS",
+    [PYRO_OPCODE_DEFINE_PUB_METHOD] = "DEFINE_PUB_METHOD",
+    [PYRO_OPCODE_DEFINE_STATIC_FIELD] = "DEFINE_STATIC_FIELD",
+    [PYRO_OPCODE_DEFINE_STATIC_METHOD] = "DEFINE_STATIC_METHOD",
+    [PYRO_OPCODE_DUP] = "DUP",
+    [PYRO_OPCODE_DUP_2] = "DUP_2",
+    [PYRO_OPCODE_ECHO] = "ECHO",
+    [PYRO_OPCODE_END_WITH] = "END_WITH",
+    [PYRO_OPCODE_FORMAT] = "FORMAT",
+    [PYRO_OPCODE_GET_FIELD] = "GET_FIELD",
+    [PYRO_OPCODE_GET_GLOBAL] = "GET_GLOBAL",
+    [PYRO_OPCODE_GET_INDEX] = "GET_INDEX",
+    [PYRO_OPCODE_GET_ITERATOR] = "GET_ITERATOR",
+    [PYRO_OPCODE_GET_LOCAL] = "GET_LOCAL",
+    [PYRO_OPCODE_GET_LOCAL_0] = "GET_LOCAL_0",
+    [PYRO_OPCODE_GET_LOCAL_1] = "GET_LOCAL_1",
+    [PYRO_OPCODE_GET_LOCAL_2] = "GET_LOCAL_2",
+    [PYRO_OPCODE_GET_LOCAL_3] = "GET_LOCAL_3",
+    [PYRO_OPCODE_GET_LOCAL_4] = "GET_LOCAL_4",
+    [PYRO_OPCODE_GET_LOCAL_5] = "GET_LOCAL_5",
+    [PYRO_OPCODE_GET_LOCAL_6] = "GET_LOCAL_6",
+    [PYRO_OPCODE_GET_LOCAL_7] = "GET_LOCAL_7",
+    [PYRO_OPCODE_GET_LOCAL_8] = "GET_LOCAL_8",
+    [PYRO_OPCODE_GET_LOCAL_9] = "GET_LOCAL_9",
+    [PYRO_OPCODE_GET_LOCAL_FIELD] = "GET_LOCAL_FIELD",
+    [PYRO_OPCODE_GET_LOCAL_PLUS_CONSTANT] = "GET_LOCAL_PLUS_CONSTANT",
+    [PYRO_OPCODE_GET_LOCAL_PUB_FIELD] = "GET_LOCAL_PUB_FIELD",
+    [PYRO_OPCODE_GET_MEMBER] = "GET_MEMBER",
+    [PYRO_OPCODE_GET_METHOD] = "GET_METHOD",
+    [PYRO_OPCODE_GET_NEXT_FROM_ITERATOR] = "GET_NEXT_FROM_ITERATOR",
+    [PYRO_OPCODE_GET_PUB_FIELD] = "GET_PUB_FIELD",
+    [PYRO_OPCODE_GET_PUB_METHOD] = "GET_PUB_METHOD",
+    [PYRO_OPCODE_GET_SUPER_METHOD] = "GET_SUPER_METHOD",
+    [PYRO_OPCODE_GET_UPVALUE] = "GET_UPVALUE",
+    [PYRO_OPCODE_I64_ADD] = "I64_ADD",
+    [PYRO_OPCODE_IS_ERR] = "IS_ERR",
+    [PYRO_OPCODE_IS_STR] = "IS_STR",
+    [PYRO_OPCODE_IS_I64] = "IS_I64",
+    [PYRO_OPCODE_IS_F64] = "IS_F64",
+    [PYRO_OPCODE_IS_RUNE] = "IS_RUNE",
+    [PYRO_OPCODE_IMPORT_MODULE] = "IMPORT_MODULE",
+    [PYRO_OPCODE_IMPORT_NAMED_MEMBERS] = "IMPORT_NAMED_MEMBERS",
+    [PYRO_OPCODE_INHERIT] = "INHERIT",
+    [PYRO_OPCODE_JUMP] = "JUMP",
+    [PYRO_OPCODE_JUMP_BACK] = "JUMP_BACK",
+    [PYRO_OPCODE_JUMP_IF_EQUAL] = "JUMP_IF_EQUAL",
+    [PYRO_OPCODE_JUMP_IF_ERR] = "JUMP_IF_ERR",
+    [PYRO_OPCODE_JUMP_IF_FALSE] = "JUMP_IF_FALSE",
+    [PYRO_OPCODE_JUMP_IF_NOT_EQUAL] = "JUMP_IF_NOT_EQUAL",
+    [PYRO_OPCODE_JUMP_IF_NOT_ERR] = "JUMP_IF_NOT_ERR",
+    [PYRO_OPCODE_JUMP_IF_NOT_GREATER] = "JUMP_IF_NOT_GREATER",
+    [PYRO_OPCODE_JUMP_IF_NOT_GREATER_EQUAL] = "JUMP_IF_NOT_GREATER_EQUAL",
+    [PYRO_OPCODE_JUMP_IF_NOT_LESS] = "JUMP_IF_NOT_LESS",
+    [PYRO_OPCODE_JUMP_IF_NOT_LESS_EQUAL] = "JUMP_IF_NOT_LESS_EQUAL",
+    [PYRO_OPCODE_JUMP_IF_NOT_NULL] = "JUMP_IF_NOT_NULL",
+    [PYRO_OPCODE_JUMP_IF_TRUE] = "JUMP_IF_TRUE",
+    [PYRO_OPCODE_LOAD_CONSTANT] = "LOAD_CONSTANT",
+    [PYRO_OPCODE_LOAD_CONSTANT_0] = "LOAD_CONSTANT_0",
+    [PYRO_OPCODE_LOAD_CONSTANT_1] = "LOAD_CONSTANT_1",
+    [PYRO_OPCODE_LOAD_CONSTANT_2] = "LOAD_CONSTANT_2",
+    [PYRO_OPCODE_LOAD_CONSTANT_3] = "LOAD_CONSTANT_3",
+    [PYRO_OPCODE_LOAD_CONSTANT_4] = "LOAD_CONSTANT_4",
+    [PYRO_OPCODE_LOAD_CONSTANT_5] = "LOAD_CONSTANT_5",
+    [PYRO_OPCODE_LOAD_CONSTANT_6] = "LOAD_CONSTANT_6",
+    [PYRO_OPCODE_LOAD_CONSTANT_7] = "LOAD_CONSTANT_7",
+    [PYRO_OPCODE_LOAD_CONSTANT_8] = "LOAD_CONSTANT_8",
+    [PYRO_OPCODE_LOAD_CONSTANT_9] = "LOAD_CONSTANT_9",
+    [PYRO_OPCODE_LOAD_FALSE] = "LOAD_FALSE",
+    [PYRO_OPCODE_LOAD_I64_0] = "LOAD_I64_0",
+    [PYRO_OPCODE_LOAD_I64_1] = "LOAD_I64_1",
+    [PYRO_OPCODE_LOAD_I64_2] = "LOAD_I64_2",
+    [PYRO_OPCODE_LOAD_I64_3] = "LOAD_I64_3",
+    [PYRO_OPCODE_LOAD_I64_4] = "LOAD_I64_4",
+    [PYRO_OPCODE_LOAD_I64_5] = "LOAD_I64_5",
+    [PYRO_OPCODE_LOAD_I64_6] = "LOAD_I64_6",
+    [PYRO_OPCODE_LOAD_I64_7] = "LOAD_I64_7",
+    [PYRO_OPCODE_LOAD_I64_8] = "LOAD_I64_8",
+    [PYRO_OPCODE_LOAD_I64_9] = "LOAD_I64_9",
+    [PYRO_OPCODE_LOAD_NULL] = "LOAD_NULL",
+    [PYRO_OPCODE_LOAD_TRUE] = "LOAD_TRUE",
+    [PYRO_OPCODE_MAKE_CLASS] = "MAKE_CLASS",
+    [PYRO_OPCODE_MAKE_CLOSURE] = "MAKE_CLOSURE",
+    [PYRO_OPCODE_MAKE_CLOSURE_WITH_DEFAULT_ARGS] = "MAKE_CLOSURE_WITH_DEFAULT_ARGS",
+    [PYRO_OPCODE_MAKE_ENUM] = "MAKE_ENUM",
+    [PYRO_OPCODE_MAKE_OBJECT] = "MAKE_OBJECT",
+    [PYRO_OPCODE_MAKE_MAP] = "MAKE_MAP",
+    [PYRO_OPCODE_MAKE_SET] = "MAKE_SET",
+    [PYRO_OPCODE_MAKE_STR] = "MAKE_STR",
+    [PYRO_OPCODE_MAKE_TUP] = "MAKE_TUP",
+    [PYRO_OPCODE_MAKE_VEC] = "MAKE_VEC",
+    [PYRO_OPCODE_POP] = "POP",
+    [PYRO_OPCODE_POP_ECHO_IN_REPL] = "POP_ECHO_IN_REPL",
+    [PYRO_OPCODE_POP_JUMP_IF_FALSE] = "POP_JUMP_IF_FALSE",
+    [PYRO_OPCODE_POP_SET_LOCAL] = "POP_SET_LOCAL",
+    [PYRO_OPCODE_RETURN] = "RETURN",
+    [PYRO_OPCODE_RETURN_TUPLE] = "RETURN_TUPLE",
+    [PYRO_OPCODE_SET_FIELD] = "SET_FIELD",
+    [PYRO_OPCODE_SET_GLOBAL] = "SET_GLOBAL",
+    [PYRO_OPCODE_SET_INDEX] = "SET_INDEX",
+    [PYRO_OPCODE_SET_LOCAL] = "SET_LOCAL",
+    [PYRO_OPCODE_SET_LOCAL_0] = "SET_LOCAL_0",
+    [PYRO_OPCODE_SET_LOCAL_1] = "SET_LOCAL_1",
+    [PYRO_OPCODE_SET_LOCAL_2] = "SET_LOCAL_2",
+    [PYRO_OPCODE_SET_LOCAL_3] = "SET_LOCAL_3",
+    [PYRO_OPCODE_SET_LOCAL_4] = "SET_LOCAL_4",
+    [PYRO_OPCODE_SET_LOCAL_5] = "SET_LOCAL_5",
+    [PYRO_OPCODE_SET_LOCAL_6] = "SET_LOCAL_6",
+    [PYRO_OPCODE_SET_LOCAL_7] = "SET_LOCAL_7",
+    [PYRO_OPCODE_SET_LOCAL_8] = "SET_LOCAL_8",
+    [PYRO_OPCODE_SET_LOCAL_9] = "SET_LOCAL_9",
+    [PYRO_OPCODE_SET_PUB_FIELD] = "SET_PUB_FIELD",
+    [PYRO_OPCODE_SET_UPVALUE] = "SET_UPVALUE",
+    [PYRO_OPCODE_START_WITH] = "START_WITH",
+    [PYRO_OPCODE_STRINGIFY] = "STRINGIFY",
+    [PYRO_OPCODE_TRY] = "TRY",
+    [PYRO_OPCODE_UNARY_BANG] = "UNARY_BANG",
+    [PYRO_OPCODE_UNARY_MINUS] = "UNARY_MINUS",
+    [PYRO_OPCODE_UNARY_PLUS] = "UNARY_PLUS",
+    [PYRO_OPCODE_UNARY_TILDE] = "UNARY_TILDE",
+    [PYRO_OPCODE_UNPACK] = "UNPACK",
+};
+
+_Static_assert(
+    sizeof(OPCODE_NAMES) / sizeof(OPCODE_NAMES[0]) == OPCODE_COUNT,
+    "every opcode needs an entry in OPCODE_NAMES"
+);
+
+
+// Returns a hash of the instruction set, i.e. of each opcode's name, number, and operand length.
+// Bytecode compiled by a build with a different instruction set can't be loaded, even if the
+// builds have the same version number.
+static uint64_t hash_instruction_set(void) {
+    // Variable-length instructions get the length of their operands with no upvalues or globals.
+    PyroFn empty_fn = {.upvalue_count = 0};
+    PyroValue constants[1] = {pyro_obj(&empty_fn)};
+    uint8_t code[4] = {0};
+    PyroFn fn = {
+        .code = code,
+        .code_count = sizeof(code),
+        .constants = constants,
+        .constants_count = 1,
+    };
+
+    uint64_t hash = 0;
+
+    for (size_t opcode = 0; opcode < OPCODE_COUNT; opcode++) {
+        const char* name = OPCODE_NAMES[opcode];
+        assert(name != NULL);
+        code[0] = (uint8_t)opcode;
+
+        uint64_t seed = ((uint64_t)opcode << 32) | PyroFn_opcode_argcount(&fn, 0);
+        hash = pyro_hash_combine(hash, pyro_wyhash_64((const uint8_t*)name, strlen(name), seed));
+    }
+
+    return hash;
+}
+
+
+// Tags for the values in a function's constant table.
+typedef enum {
+    TAG_NULL,
+    TAG_TRUE,
+    TAG_FALSE,
+    TAG_I64,
+    TAG_F64,
+    TAG_RUNE,
+    TAG_STR,
+    TAG_FN,
+} ConstantTag;
+
+
+// Returns the path of the cache file for the source file at [src_path], i.e. [src_path] with a
+// 'c' appended. The caller should free the returned string using free(). Returns NULL if memory
+// can't be allocated.
+static char* make_cache_path(const char* src_path) {
+    size_t src_path_length = strlen(src_path);
+
+    char* cache_path = malloc(src_path_length + 2);
+    if (!cache_path) {
+        return NULL;
+    }
+
+    memcpy(cache_path, src_path, src_path_length);
+    cache_path[src_path_length] = 'c';
+    cache_path[src_path_length + 1] = '\0';
+
+    return cache_path;
+}
+
+
+/* -------- */
+/*  Writer  */
+/* -------- */
+
+
+typedef struct {
+    PyroVM* vm;
+    uint8_t* bytes;
+    size_t count;
+    size_t capacity;
+    bool failed;
+} Writer;
+
+
+static void write_bytes(Writer* writer, const void* bytes, size_t count) {
+    if (writer->failed || count == 0) {
+        return;
+    }
+
+    if (writer->count + count > writer->capacity) {
+        size_t new_capacity = pyro_grow_capacity(writer->capacity);
+        while (new_capacity < writer->count + count) {
+            new_capacity = pyro_grow_capacity(new_capacity);
+        }
+
+        uint8_t* new_array = PYRO_REALLOCATE_ARRAY(writer->vm, uint8_t, writer->bytes, writer->capacity, new_capacity);
+        if (!new_array) {
+            writer->failed = true;
+            return;
+        }
+
+        writer->bytes = new_array;
+        writer->capacity = new_capacity;
+    }
+
+    memcpy(&writer->bytes[writer->count], bytes, count);
+    writer->count += count;
+}
+
+
+static void write_u8(Writer* writer, uint8_t value) {
+    write_bytes(writer, &value, 1);
+}
+
+
+// Integers are written in little-endian byte order.
+static void write_u32(Writer* writer, uint32_t value) {
+    uint8_t bytes[4];
+    for (size_t i = 0; i < 4; i++) {
+        bytes[i] = (uint8_t)(value >> (i * 8));
+    }
+    write_bytes(writer, bytes, 4);
+}
+
+
+static void write_u64(Writer* writer, uint64_t value) {
+    uint8_t bytes[8];
+    for (size_t i = 0; i < 8; i++) {
+        bytes[i] = (uint8_t)(value >> (i * 8));
+    }
+    write_bytes(writer, bytes, 8);
+}
+
+
+static void patch_u64(Writer* writer, size_t offset, uint64_t value) {
+    for (size_t i = 0; i < 8; i++) {
+        writer->bytes[offset + i] = (uint8_t)(value >> (i * 8));
+    }
+}
+
+
+static void write_str(Writer* writer, PyroStr* string) {
+    write_u64(writer, string->count);
+    write_bytes(writer, string->bytes, string->count);
+}
+
+
+static void write_fn(Writer* writer, PyroFn* fn);
+
+
+static void write_constant(Writer* writer, PyroValue value) {
+    if (PYRO_IS_NULL(value)) {
+        write_u8(writer, TAG_NULL);
+    } else if (PYRO_IS_BOOL(value)) {
+        write_u8(writer, PYRO_AS_BOOL(value) ? TAG_TRUE : TAG_FALSE);
+    } else if (PYRO_IS_I64(value)) {
+        write_u8(writer, TAG_I64);
+        write_u64(writer, (uint64_t)PYRO_AS_I64(value));
+    } else if (PYRO_IS_F64(value)) {
+        double f64 = PYRO_AS_F64(value);
+        uint64_t bits;
+        memcpy(&bits, &f64, sizeof(uint64_t));
+        write_u8(writer, TAG_F64);
+        write_u64(writer, bits);
+    } else if (PYRO_IS_RUNE(value)) {
+        write_u8(writer, TAG_RUNE);
+        write_u32(writer, PYRO_AS_RUNE(value));
+    } else if (PYRO_IS_STR(value)) {
+        PyroStr* string = PYRO_AS_STR(value);
+        if (!PyroStr_view(string, writer->vm)) {
+            writer->failed = true;
+            return;
+        }
+        write_u8(writer, TAG_STR);
+        write_str(writer, string);
+    } else if (PYRO_IS_PYRO_FN(value)) {
+        write_u8(writer, TAG_FN);
+        write_fn(writer, PYRO_AS_PYRO_FN(value));
+    } else {
+        // The compiler doesn't put any other types of value in the constant table.
+        writer->failed = true;
+    }
+}
+
+
+// The function's source ID isn't written -- the loader uses the source file's path instead. Its
+// register code, hotness, and deoptimization count are runtime state and aren't written either.
+static void write_fn(Writer* writer, PyroFn* fn) {
+    write_u8(writer, fn->arity);
+    write_u8(writer, fn->is_variadic);
+    write_u8(writer, fn->is_default_value_expression);
+    write_u64(writer, fn->upvalue_count);
+
+    write_u8(writer, fn->name != NULL);
+    if (fn->name) {
+        write_str(writer, fn->name);
+    }
+
+    write_u64(writer, fn->code_count);
+    write_bytes(writer, fn->code, fn->code_count);
+
+    write_u64(writer, fn->first_line_number);
+    write_u64(writer, fn->bpl_capacity);
+    for (size_t i = 0; i < fn->bpl_capacity; i++) {
+        write_u8(writer, (uint8_t)fn->bpl[i]);
+        write_u8(writer, (uint8_t)(fn->bpl[i] >> 8));
+    }
+
+    write_u64(writer, fn->inline_cache_count);
+
+    write_u64(writer, fn->constants_count);
+    for (size_t i = 0; i < fn->constants_count; i++) {
+        write_constant(writer, fn->constants[i]);
+    }
+}
+
+
+void pyro_write_bytecode_cache(PyroVM* vm, const char* src_path, const uint8_t* src_code, size_t src_len, PyroFn* fn) {
+    Writer writer = {
+        .vm = vm,
+        .bytes = NULL,
+        .count = 0,
+        .capacity = 0,
+        .failed = false,
+    };
+
+    write_bytes(&writer, MAGIC, sizeof(MAGIC));
+    write_u32(&writer, FORMAT_VERSION);
+    write_u32(&writer, PYRO_VERSION_MAJOR);
+    write_u32(&writer, PYRO_VERSION_MINOR);
+    write_u32(&writer, PYRO_VERSION_PATCH);
+    write_u32(&writer, OPCODE_COUNT);
+    write_u32(&writer, BUILD_FLAGS);
+    write_u64(&writer, hash_instruction_set());
+    write_u64(&writer, src_len);
+    write_u64(&writer, pyro_wyhash_64(src_code, src_len, 0));
+
+    // Placeholders for the payload length and hash.
+    write_u64(&writer, 0);
+    write_u64(&writer, 0);
+
+    write_fn(&writer, fn);
+
+    if (!writer.failed) {
+        const uint8_t* payload = &writer.bytes[HEADER_SIZE];
+        size_t payload_length = writer.count - HEADER_SIZE;
+        patch_u64(&writer, PAYLOAD_LENGTH_OFFSET, payload_length);
+        patch_u64(&writer, PAYLOAD_HASH_OFFSET, pyro_wyhash_64(payload, payload_length, 0));
+
+        char* cache_path = make_cache_path(src_path);
+        if (cache_path) {
+            pyro_write_file_atomically(cache_path, writer.bytes, writer.count);
+            free(cache_path);
+        }
+    }
+
+    if (writer.bytes) {
+        PYRO_FREE_ARRAY(vm, uint8_t, writer.bytes, writer.capacity);
+    }
+}
+
+
+/* -------- */
+/*  Reader  */
+/* -------- */
+
+
+typedef struct {
+    PyroVM* vm;
+    const uint8_t* bytes;
+    size_t count;
+    size_t offset;
+    bool failed;
+
+    // Every function in the file shares the source file's path as its source ID.
+    PyroStr* source_id;
+} Reader;
+
+
+// Returns true if the next [count] bytes can be read. Sets the failed flag if not.
+static bool can_read(Reader* reader, uint64_t count) {
+    if (reader->failed || count > reader->count - reader->offset) {
+        reader->failed = true;
+        return false;
+    }
+    return true;
+}
+
+
+static uint8_t read_u8(Reader* reader) {
+    if (!can_read(reader, 1)) {
+        return 0;
+    }
+    return reader->bytes[reader->offset++];
+}
+
+
+static uint32_t read_u32(Reader* reader) {
+    if (!can_read(reader, 4)) {
+        return 0;
+    }
+
+    uint32_t value = 0;
+    for (size_t i = 0; i < 4; i++) {
+        value |= (uint32_t)reader->bytes[reader->offset++] << (i * 8);
+    }
+
+    return value;
+}
+
+
+static uint64_t read_u64(Reader* reader) {
+    if (!can_read(reader, 8)) {
+        return 0;
+    }
+
+    uint64_t value = 0;
+    for (size_t i = 0; i < 8; i++) {
+        value |= (uint64_t)reader->bytes[reader->offset++] << (i * 8);
+    }
+
+    return value;
+}
+
+
+static PyroStr* read_str(Reader* reader) {
+    uint64_t count = read_u64(reader);
+    if (!can_read(reader, count)) {
+        return NULL;
+    }
+
+    PyroStr* string = PyroStr_copy((const char*)&reader->bytes[reader->offset], count, false, reader->vm);
+    if (!string) {
+        reader->failed = true;
+        return NULL;
+    }
+
+    reader->offset += count;
+    return string;
+}
+
+
+static PyroFn* read_fn(Reader* reader);
+
+
+static PyroValue read_constant(Reader* reader) {
+    switch (read_u8(reader)) {
+        case TAG_NULL:
+            return pyro_null();
+
+        case TAG_TRUE:
+            return pyro_bool(true);
+
+        case TAG_FALSE:
+            return pyro_bool(false);
+
+        case TAG_I64:
+            return pyro_i64((int64_t)read_u64(reader));
+
+        case TAG_F64: {
+            uint64_t bits = read_u64(reader);
+            double f64;
+            memcpy(&f64, &bits, sizeof(double));
+            return pyro_f64(f64);
+        }
+
+        case TAG_RUNE:
+            return pyro_rune(read_u32(reader));
+
+        case TAG_STR: {
+            PyroStr* string = read_str(reader);
+            return string ? pyro_obj(string) : pyro_null();
+        }
+
+        case TAG_FN: {
+            PyroFn* fn = read_fn(reader);
+            return fn ? pyro_obj(fn) : pyro_null();
+        }
+
+        default:
+            reader->failed = true;
+            return pyro_null();
+    }
+}
+
+
+// The garbage collector only runs at safepoints in the interpreter loop, so the objects created
+// here don't need to be protected while the function tree is being assembled.
+static PyroFn* read_fn(Reader* reader) {
+    PyroVM* vm = reader->vm;
+
+    PyroFn* fn = PyroFn_new(vm);
+    if (!fn) {
+        reader->failed = true;
+        return NULL;
+    }
+
+    fn->source_id = reader->source_id;
+    fn->arity = read_u8(reader);
+    fn->is_variadic = read_u8(reader) != 0;
+    fn->is_default_value_expression = read_u8(reader) != 0;
+    fn->upvalue_count = read_u64(reader);
+
+    if (read_u8(reader)) {
+        fn->name = read_str(reader);
+    }
+
+    uint64_t code_count = read_u64(reader);
+    if (!can_read(reader, code_count)) {
+        return NULL;
+    }
+    if (code_count > 0) {
+        fn->code = PYRO_ALLOCATE_ARRAY(vm, uint8_t, code_count);
+        if (!fn->code) {
+            reader->failed = true;
+            return NULL;
+        }
+        memcpy(fn->code, &reader->bytes[reader->offset], code_count);
+        fn->code_count = code_count;
+        fn->code_capacity = code_count;
+        reader->offset += code_count;
+    }
+
+    fn->first_line_number = read_u64(reader);
+
+    uint64_t bpl_count = read_u64(reader);
+    if (bpl_count > SIZE_MAX / 2 || !can_read(reader, bpl_count * 2)) {
+        reader->failed = true;
+        return NULL;
+    }
+    if (bpl_count > 0) {
+        fn->bpl = PYRO_ALLOCATE_ARRAY(vm, uint16_t, bpl_count);
+        if (!fn->bpl) {
+            reader->failed = true;
+            return NULL;
+        }
+        fn->bpl_capacity = bpl_count;
+        for (size_t i = 0; i < bpl_count; i++) {
+            uint16_t low = read_u8(reader);
+            uint16_t high = read_u8(reader);
+            fn->bpl[i] = (uint16_t)(low | (high << 8));
+        }
+    }
+
+    uint64_t inline_cache_count = read_u64(reader);
+    if (inline_cache_count > (uint64_t)UINT16_MAX + 1) {
+        reader->failed = true;
+        return NULL;
+    }
+    fn->inline_cache_count = inline_cache_count;
+    if (!PyroFn_alloc_inline_caches(fn, vm)) {
+        reader->failed = true;
+        return NULL;
+    }
+
+    // Each constant takes up at least one byte.
+    uint64_t constants_count = read_u64(reader);
+    if (!can_read(reader, constants_count)) {
+        return NULL;
+    }
+    if (constants_count > 0) {
+        fn->constants = PYRO_ALLOCATE_ARRAY(vm, PyroValue, constants_count);
+        if (!fn->constants) {
+            reader->failed = true;
+            return NULL;
+        }
+        fn->constants_capacity = constants_count;
+        for (size_t i = 0; i < constants_count; i++) {
+            PyroValue value = read_constant(reader);
+            if (reader->failed) {
+                return NULL;
+            }
+            fn->constants[fn->constants_count++] = value;
+        }
+    }
+
+    return reader->failed ? NULL : fn;
+}
+
+
+// Checks the cache file's header. Returns true if the cache file is valid for [src_code].
+static bool read_header(Reader* reader, const uint8_t* src_code, size_t src_len) {
+    if (!can_read(reader, HEADER_SIZE)) {
+        return false;
+    }
+
+    if (memcmp(reader->bytes, MAGIC, sizeof(MAGIC)) != 0) {
+        return false;
+    }
+    reader->offset += sizeof(MAGIC);
+
+    if (read_u32(reader) != FORMAT_VERSION) return false;
+    if (read_u32(reader) != PYRO_VERSION_MAJOR) return false;
+    if (read_u32(reader) != PYRO_VERSION_MINOR) return false;
+    if (read_u32(reader) != PYRO_VERSION_PATCH) return false;
+    if (read_u32(reader) != OPCODE_COUNT) return false;
+    if (read_u32(reader) != BUILD_FLAGS) return false;
+    if (read_u64(reader) != hash_instruction_set()) return false;
+
+    if (read_u64(reader) != src_len) return false;
+    if (read_u64(reader) != pyro_wyhash_64(src_code, src_len, 0)) return false;
+
+    // A payload that doesn't match its hash means the file has been truncated or corrupted.
+    uint64_t payload_length = read_u64(reader);
+    uint64_t payload_hash = read_u64(reader);
+    if (payload_length != reader->count - HEADER_SIZE) return false;
+    if (payload_hash != pyro_wyhash_64(&reader->bytes[HEADER_SIZE], payload_length, 0)) return false;
+
+    return true;
+}
+
+
+PyroFn* pyro_load_bytecode_cache(PyroVM* vm, const char* src_path, const uint8_t* src_code, size_t src_len) {
+    char* cache_path = make_cache_path(src_path);
+    if (!cache_path) {
+        return NULL;
+    }
+
+    void* addr;
+    size_t length;
+    bool mapped = pyro_mmap_file(cache_path, &addr, &length);
+    free(cache_path);
+    if (!mapped) {
+        return NULL;
+    }
+
+    Reader reader = {
+        .vm = vm,
+        .bytes = addr,
+        .count = length,
+        .offset = 0,
+        .failed = false,
+        .source_id = NULL,
+    };
+
+    PyroFn* fn = NULL;
+
+    if (read_header(&reader, src_code, src_len)) {
+        reader.source_id = PyroStr_COPY(src_path);
+        if (reader.source_id) {
+            fn = read_fn(&reader);
+            if (reader.failed || reader.offset != reader.count) {
+                fn = NULL;
+            }
+        }
+    }
+
+    pyro_munmap(addr, length);
+    return fn;
+}
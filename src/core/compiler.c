@@ -39,6 +39,8 @@ typedef struct {
     bool is_initialized;    // true after the variable has been defined
     bool is_captured;       // true if the local is captured by a closure
     bool is_constant;       // true if the local is a constant
+    bool has_known_value;   // true if the local is a constant with a compile-time value
+    PyroValue known_value;  // the constant's compile-time value, if [has_known_value] is true
 } Local;
 
 
@@ -95,6 +97,8 @@ typedef struct ClassCompiler {
 typedef struct GlobalConstant GlobalConstant;
 struct GlobalConstant {
     Token name;
+    bool has_known_value;
+    PyroValue known_value;
     GlobalConstant* next;
 };
 
@@ -141,6 +145,7 @@ static void parse_function_definition(Parser* parser, FnType type, Token name);
 static void parse_type(Parser* parser);
 static void log_global_constant(Parser* parser, Token name);
 static void log_global_assignment(Parser* parser, Token name);
+static GlobalConstant* find_global_constant(Parser* parser, Token* name);
 
 
 /* ----------------- */
@@ -230,6 +235,18 @@ static void emit_u8_u16be(Parser* parser, uint8_t u8_arg, uint16_t u16_arg) {
 }
 
 
+// Reserves a new inline cache for the current function and emits its index as an unsigned
+// 16-bit integer in big-endian format.
+static void emit_inline_cache_index(Parser* parser) {
+    int64_t index = PyroFn_add_inline_cache(parser->fn_compiler->fn);
+    if (index < 0) {
+        SYNTAX_ERROR_AT_PREVIOUS_TOKEN("too many field, global variable, and method lookups in function (max: %d)", UINT16_MAX + 1);
+        return;
+    }
+    emit_u16be(parser, (uint16_t)index);
+}
+
+
 // Emits a naked return instruction -- i.e. a return with no value specified. Inside an $init()
 // method this returns the object instance being initialized, otherwise it returns null.
 static void emit_naked_return(Parser* parser) {
@@ -273,8 +290,8 @@ static uint16_t make_string_constant_from_identifier(Parser* parser, Token* name
 // - Uses an optimized instruction set for loading small integer values.
 // - Uses an optimized instruction set for loading constants with small indexes.
 static void emit_load_value_from_constant_table(Parser* parser, PyroValue value) {
-    if (PYRO_IS_I64(value) && value.as.i64 >= 0 && value.as.i64 <= 9) {
-        switch (value.as.i64) {
+    if (PYRO_IS_I64(value) && PYRO_AS_I64(value) >= 0 && PYRO_AS_I64(value) <= 9) {
+        switch (PYRO_AS_I64(value)) {
             case 0: emit_byte(parser, PYRO_OPCODE_LOAD_I64_0); return;
             case 1: emit_byte(parser, PYRO_OPCODE_LOAD_I64_1); return;
             case 2: emit_byte(parser, PYRO_OPCODE_LOAD_I64_2); return;
@@ -422,6 +439,7 @@ static bool init_fn_compiler(Parser* parser, FnCompiler* fn_compiler, FnType typ
     local->is_initialized = true;
     local->is_captured = false;
     local->is_constant = false;
+    local->has_known_value = false;
     if (type == FN_TYPE_METHOD || type == FN_TYPE_INIT_METHOD) {
         local->name.start = "self";
         local->name.length = 4;
@@ -438,6 +456,14 @@ static PyroFn* end_fn_compiler(Parser* parser) {
     emit_naked_return(parser);
     PyroFn* fn = parser->fn_compiler->fn;
 
+    if (!parser->vm->halt_flag) {
+        pyro_optimize_bytecode(parser->vm, fn);
+    }
+
+    if (!PyroFn_alloc_inline_caches(fn, parser->vm)) {
+        pyro_panic(parser->vm, "out of memory");
+    }
+
     if (parser->dump_bytecode) {
         if (!parser->vm->halt_flag) {
             pyro_disassemble_function(parser->vm, fn, parser->src_id);
@@ -536,6 +562,8 @@ static void add_local(Parser* parser, Token name) {
     local->depth = parser->fn_compiler->scope_depth;
     local->is_initialized = false; // the variable has been declared but not yet defined
     local->is_captured = false;
+    local->is_constant = false;
+    local->has_known_value = false;
 }
 
 
@@ -684,6 +712,429 @@ static void patch_jump(Parser* parser, size_t index) {
 }
 
 
+/* ------------------ */
+/*  Constant Folding  */
+/* ------------------ */
+
+
+// Records where an operand's compiled code begins. If the operand is folded away, the code and
+// any constants added to the constant table while compiling it are discarded.
+typedef struct {
+    size_t code_count;
+    size_t constants_count;
+} OperandStart;
+
+
+static OperandStart mark_operand_start(Parser* parser) {
+    return (OperandStart){
+        .code_count = parser->fn_compiler->fn->code_count,
+        .constants_count = parser->fn_compiler->fn->constants_count,
+    };
+}
+
+
+// Returns true if [value] can be an operand or result of a folded operation. Folding is limited
+// to value types whose operators are pure -- i.e. can't call into Pyro code.
+static bool is_foldable_value(PyroValue value) {
+    switch (PYRO_TYPE_OF(value)) {
+        case PYRO_VALUE_NULL:
+        case PYRO_VALUE_BOOL:
+        case PYRO_VALUE_I64:
+        case PYRO_VALUE_F64:
+        case PYRO_VALUE_RUNE:
+            return true;
+        default:
+            return PYRO_IS_STR(value);
+    }
+}
+
+
+static bool is_numeric_value(PyroValue value) {
+    return PYRO_IS_I64(value) || PYRO_IS_F64(value);
+}
+
+
+// Returns true if the bytecode from [start_index] to the end of the current function's bytecode
+// is a single instruction loading a foldable constant value, i.e. if the expression compiled
+// from that index is a constant. If so, [value] is set to the constant's value.
+static bool get_constant_operand(Parser* parser, size_t start_index, PyroValue* value) {
+    PyroFn* fn = parser->fn_compiler->fn;
+    if (parser->vm->halt_flag || start_index >= fn->code_count) {
+        return false;
+    }
+
+    size_t length = fn->code_count - start_index;
+    uint8_t opcode = fn->code[start_index];
+
+    if (opcode == PYRO_OPCODE_LOAD_CONSTANT && length == 3) {
+        uint16_t index = (uint16_t)((fn->code[start_index + 1] << 8) | fn->code[start_index + 2]);
+        *value = fn->constants[index];
+        return is_foldable_value(*value);
+    }
+
+    if (length != 1) {
+        return false;
+    }
+
+    switch (opcode) {
+        case PYRO_OPCODE_LOAD_TRUE: *value = pyro_bool(true); return true;
+        case PYRO_OPCODE_LOAD_FALSE: *value = pyro_bool(false); return true;
+        case PYRO_OPCODE_LOAD_NULL: *value = pyro_null(); return true;
+        case PYRO_OPCODE_LOAD_I64_0: *value = pyro_i64(0); return true;
+        case PYRO_OPCODE_LOAD_I64_1: *value = pyro_i64(1); return true;
+        case PYRO_OPCODE_LOAD_I64_2: *value = pyro_i64(2); return true;
+        case PYRO_OPCODE_LOAD_I64_3: *value = pyro_i64(3); return true;
+        case PYRO_OPCODE_LOAD_I64_4: *value = pyro_i64(4); return true;
+        case PYRO_OPCODE_LOAD_I64_5: *value = pyro_i64(5); return true;
+        case PYRO_OPCODE_LOAD_I64_6: *value = pyro_i64(6); return true;
+        case PYRO_OPCODE_LOAD_I64_7: *value = pyro_i64(7); return true;
+        case PYRO_OPCODE_LOAD_I64_8: *value = pyro_i64(8); return true;
+        case PYRO_OPCODE_LOAD_I64_9: *value = pyro_i64(9); return true;
+        case PYRO_OPCODE_LOAD_CONSTANT_0: *value = fn->constants[0]; break;
+        case PYRO_OPCODE_LOAD_CONSTANT_1: *value = fn->constants[1]; break;
+        case PYRO_OPCODE_LOAD_CONSTANT_2: *value = fn->constants[2]; break;
+        case PYRO_OPCODE_LOAD_CONSTANT_3: *value = fn->constants[3]; break;
+        case PYRO_OPCODE_LOAD_CONSTANT_4: *value = fn->constants[4]; break;
+        case PYRO_OPCODE_LOAD_CONSTANT_5: *value = fn->constants[5]; break;
+        case PYRO_OPCODE_LOAD_CONSTANT_6: *value = fn->constants[6]; break;
+        case PYRO_OPCODE_LOAD_CONSTANT_7: *value = fn->constants[7]; break;
+        case PYRO_OPCODE_LOAD_CONSTANT_8: *value = fn->constants[8]; break;
+        case PYRO_OPCODE_LOAD_CONSTANT_9: *value = fn->constants[9]; break;
+        default: return false;
+    }
+
+    return is_foldable_value(*value);
+}
+
+
+// Returns true if [right] is a valid divisor for [left], i.e. if dividing by it won't panic.
+static bool is_safe_divisor(PyroValue left, PyroValue right) {
+    if (PYRO_IS_I64(right)) {
+        if (PYRO_AS_I64(right) == 0) {
+            return false;
+        }
+        // Guards against both the '//' overflow panic and the trap in C's '%' operator.
+        if (PYRO_IS_I64(left) && PYRO_AS_I64(left) == PYRO_I64_MIN && PYRO_AS_I64(right) == -1) {
+            return false;
+        }
+        return true;
+    }
+    return PYRO_AS_F64(right) != 0.0;
+}
+
+
+// Attempts to evaluate [opcode] on constant operands at compile time, using the same operator
+// functions as the VM so the result is identical. Returns false, leaving the operation to run
+// at runtime, if the operand types aren't supported or if evaluating the operation would panic.
+static bool try_fold_binary_op(Parser* parser, PyroOpcode opcode, PyroValue left, PyroValue right, PyroValue* result) {
+    PyroVM* vm = parser->vm;
+    bool numeric = is_numeric_value(left) && is_numeric_value(right);
+    bool integers = PYRO_IS_I64(left) && PYRO_IS_I64(right);
+    bool strings = PYRO_IS_STR(left) && PYRO_IS_STR(right);
+    bool orderable = strings || (
+        (is_numeric_value(left) || PYRO_IS_RUNE(left)) &&
+        (is_numeric_value(right) || PYRO_IS_RUNE(right))
+    );
+    int64_t unused;
+
+    switch (opcode) {
+        case PYRO_OPCODE_BINARY_PLUS:
+            if (strings) {
+                PyroStr* string = PyroStr_concat(PYRO_AS_STR(left), PYRO_AS_STR(right), vm);
+                if (!string) {
+                    return false;
+                }
+                *result = pyro_obj(string);
+                return true;
+            }
+            if (!numeric || (integers && pyro_ckd_add(&unused, PYRO_AS_I64(left), PYRO_AS_I64(right)))) {
+                return false;
+            }
+            *result = pyro_op_binary_plus(vm, left, right);
+            return true;
+
+        case PYRO_OPCODE_BINARY_MINUS:
+            if (!numeric || (integers && pyro_ckd_sub(&unused, PYRO_AS_I64(left), PYRO_AS_I64(right)))) {
+                return false;
+            }
+            *result = pyro_op_binary_minus(vm, left, right);
+            return true;
+
+        case PYRO_OPCODE_BINARY_STAR:
+            if (!numeric || (integers && pyro_ckd_mul(&unused, PYRO_AS_I64(left), PYRO_AS_I64(right)))) {
+                return false;
+            }
+            *result = pyro_op_binary_star(vm, left, right);
+            return true;
+
+        case PYRO_OPCODE_BINARY_SLASH:
+            if (!numeric || !is_safe_divisor(left, right)) {
+                return false;
+            }
+            *result = pyro_op_binary_slash(vm, left, right);
+            return true;
+
+        case PYRO_OPCODE_BINARY_SLASH_SLASH:
+            if (!numeric || !is_safe_divisor(left, right)) {
+                return false;
+            }
+            *result = pyro_op_binary_slash_slash(vm, left, right);
+            return true;
+
+        case PYRO_OPCODE_BINARY_PERCENT:
+            if (!numeric || !is_safe_divisor(left, right)) {
+                return false;
+            }
+            *result = pyro_op_binary_percent(vm, left, right);
+            return true;
+
+        case PYRO_OPCODE_BINARY_REM:
+            if (!numeric || !is_safe_divisor(left, right)) {
+                return false;
+            }
+            *result = pyro_op_binary_rem(vm, left, right);
+            return true;
+
+        case PYRO_OPCODE_BINARY_MOD:
+            if (!integers || !is_safe_divisor(left, right)) {
+                return false;
+            }
+            *result = pyro_op_binary_mod(vm, left, right);
+            return true;
+
+        case PYRO_OPCODE_BINARY_STAR_STAR:
+            if (!numeric) {
+                return false;
+            }
+            *result = pyro_op_binary_star_star(vm, left, right);
+            return true;
+
+        case PYRO_OPCODE_BINARY_AMP:
+            if (!integers) {
+                return false;
+            }
+            *result = pyro_op_binary_amp(vm, left, right);
+            return true;
+
+        case PYRO_OPCODE_BINARY_BAR:
+            if (!integers) {
+                return false;
+            }
+            *result = pyro_op_binary_bar(vm, left, right);
+            return true;
+
+        case PYRO_OPCODE_BINARY_CARET:
+            if (!integers) {
+                return false;
+            }
+            *result = pyro_op_binary_caret(vm, left, right);
+            return true;
+
+        // Shifts are only folded when they're well-defined in C. Anything else is left to the
+        // VM so the result doesn't depend on the compiler's choices.
+        case PYRO_OPCODE_BINARY_LESS_LESS:
+            if (!integers || PYRO_AS_I64(right) < 0 || PYRO_AS_I64(right) > 62) {
+                return false;
+            }
+            if (PYRO_AS_I64(left) < 0 || PYRO_AS_I64(left) > (PYRO_I64_MAX >> PYRO_AS_I64(right))) {
+                return false;
+            }
+            *result = pyro_op_binary_less_less(vm, left, right);
+            return true;
+
+        case PYRO_OPCODE_BINARY_GREATER_GREATER:
+            if (!integers || PYRO_AS_I64(right) < 0 || PYRO_AS_I64(right) > 63) {
+                return false;
+            }
+            *result = pyro_op_binary_greater_greater(vm, left, right);
+            return true;
+
+        case PYRO_OPCODE_BINARY_EQUAL_EQUAL:
+            *result = pyro_bool(pyro_op_compare_eq(vm, left, right));
+            return true;
+
+        case PYRO_OPCODE_BINARY_BANG_EQUAL:
+            *result = pyro_bool(!pyro_op_compare_eq(vm, left, right));
+            return true;
+
+        case PYRO_OPCODE_BINARY_LESS:
+            if (!orderable) {
+                return false;
+            }
+            *result = pyro_bool(pyro_op_compare_lt(vm, left, right));
+            return true;
+
+        case PYRO_OPCODE_BINARY_LESS_EQUAL:
+            if (!orderable) {
+                return false;
+            }
+            *result = pyro_bool(pyro_op_compare_le(vm, left, right));
+            return true;
+
+        case PYRO_OPCODE_BINARY_GREATER:
+            if (!orderable) {
+                return false;
+            }
+            *result = pyro_bool(pyro_op_compare_gt(vm, left, right));
+            return true;
+
+        case PYRO_OPCODE_BINARY_GREATER_EQUAL:
+            if (!orderable) {
+                return false;
+            }
+            *result = pyro_bool(pyro_op_compare_ge(vm, left, right));
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+
+// Like try_fold_binary_op() but for unary operators.
+static bool try_fold_unary_op(Parser* parser, PyroOpcode opcode, PyroValue operand, PyroValue* result) {
+    switch (opcode) {
+        case PYRO_OPCODE_UNARY_MINUS:
+            // Negating the minimum i64 value overflows.
+            if (!is_numeric_value(operand) || (PYRO_IS_I64(operand) && PYRO_AS_I64(operand) == PYRO_I64_MIN)) {
+                return false;
+            }
+            *result = pyro_op_unary_minus(parser->vm, operand);
+            return true;
+
+        case PYRO_OPCODE_UNARY_PLUS:
+            if (!is_numeric_value(operand)) {
+                return false;
+            }
+            *result = operand;
+            return true;
+
+        case PYRO_OPCODE_UNARY_TILDE:
+            if (!PYRO_IS_I64(operand)) {
+                return false;
+            }
+            *result = pyro_op_unary_tilde(parser->vm, operand);
+            return true;
+
+        case PYRO_OPCODE_UNARY_BANG:
+            *result = pyro_bool(!pyro_is_truthy(operand));
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+
+// Emits bytecode to load a folded value, replacing the operand bytecode from [start]. Constants
+// added while compiling the operands are only referenced by the discarded bytecode so they're
+// removed from the constant table.
+static void emit_folded_value(Parser* parser, OperandStart start, PyroValue value) {
+    PyroFn* fn = parser->fn_compiler->fn;
+    PyroFn_truncate(fn, start.code_count);
+    fn->constants_count = start.constants_count;
+
+    if (PYRO_IS_BOOL(value)) {
+        emit_byte(parser, PYRO_AS_BOOL(value) ? PYRO_OPCODE_LOAD_TRUE : PYRO_OPCODE_LOAD_FALSE);
+    } else if (PYRO_IS_NULL(value)) {
+        emit_byte(parser, PYRO_OPCODE_LOAD_NULL);
+    } else {
+        emit_load_value_from_constant_table(parser, value);
+    }
+}
+
+
+// Emits the instruction for a binary operator. The left operand's bytecode begins at [left],
+// the right operand's at [right]. If both operands are constants the operation is evaluated at
+// compile time and the operand bytecode is replaced by a single instruction loading the result.
+static void emit_binary_op(Parser* parser, PyroOpcode opcode, OperandStart left_start, OperandStart right_start) {
+    PyroFn* fn = parser->fn_compiler->fn;
+    size_t code_count = fn->code_count;
+    PyroValue left, right, result;
+
+    if (get_constant_operand(parser, right_start.code_count, &right)) {
+        // Temporarily hide the right operand so the left operand is checked on its own.
+        fn->code_count = right_start.code_count;
+        bool left_is_constant = get_constant_operand(parser, left_start.code_count, &left);
+        fn->code_count = code_count;
+
+        if (left_is_constant && try_fold_binary_op(parser, opcode, left, right, &result)) {
+            emit_folded_value(parser, left_start, result);
+            return;
+        }
+    }
+
+    emit_byte(parser, opcode);
+}
+
+
+// Emits the instruction for a unary operator whose operand's bytecode begins at [start],
+// folding it if the operand is a constant.
+static void emit_unary_op(Parser* parser, PyroOpcode opcode, OperandStart start) {
+    PyroValue operand, result;
+
+    if (get_constant_operand(parser, start.code_count, &operand) && try_fold_unary_op(parser, opcode, operand, &result)) {
+        emit_folded_value(parser, start, result);
+        return;
+    }
+
+    emit_byte(parser, opcode);
+}
+
+
+// Looks up [name] as a constant declared with 'let' whose value is known at compile time.
+// Returns false if the name resolves to anything else, including a local or global variable
+// that shadows the constant.
+static bool resolve_known_value(Parser* parser, Token* name, PyroValue* value) {
+    if (name->length == 1 && name->start[0] == '_') {
+        return false;
+    }
+
+    for (FnCompiler* fn_compiler = parser->fn_compiler; fn_compiler; fn_compiler = fn_compiler->enclosing) {
+        for (int i = fn_compiler->local_count - 1; i >= 0; i--) {
+            Local* local = &fn_compiler->locals[i];
+            if (lexemes_are_equal(name, &local->name)) {
+                if (local->is_initialized && local->has_known_value) {
+                    *value = local->known_value;
+                    return true;
+                }
+                return false;
+            }
+        }
+    }
+
+    GlobalConstant* global_constant = find_global_constant(parser, name);
+    if (global_constant && global_constant->has_known_value) {
+        *value = global_constant->known_value;
+        return true;
+    }
+
+    return false;
+}
+
+
+// Records the compile-time value of the constant [name], which has just been defined, so later
+// references to the constant can be replaced by its value.
+static void record_known_value(Parser* parser, Token* name, PyroValue value) {
+    if (parser->vm->halt_flag) {
+        return;
+    }
+
+    if (parser->fn_compiler->scope_depth > 0) {
+        Local* local = &parser->fn_compiler->locals[parser->fn_compiler->local_count - 1];
+        local->has_known_value = true;
+        local->known_value = value;
+        return;
+    }
+
+    GlobalConstant* global_constant = find_global_constant(parser, name);
+    if (global_constant) {
+        global_constant->has_known_value = true;
+        global_constant->known_value = value;
+    }
+}
+
+
 /* ------------------ */
 /* Expression Parsers */
 /* ------------------ */
@@ -720,6 +1171,13 @@ static uint8_t parse_argument_list(Parser* parser, bool* unpack_last_argument) {
 static void emit_load_named_variable(Parser* parser, Token name) {
     bool is_constant;
 
+    // Substitute the value of a constant if it's known at compile time.
+    PyroValue known_value;
+    if (resolve_known_value(parser, &name, &known_value)) {
+        emit_folded_value(parser, mark_operand_start(parser), known_value);
+        return;
+    }
+
     // Load a local variable.
     int local_index = 0;
     if (resolve_local(parser, parser->fn_compiler, &name, &local_index, &is_constant)) {
@@ -752,6 +1210,7 @@ static void emit_load_named_variable(Parser* parser, Token name) {
     uint16_t const_index = make_string_constant_from_identifier(parser, &name);
     emit_byte(parser, PYRO_OPCODE_GET_GLOBAL);
     emit_u16be(parser, const_index);
+    emit_inline_cache_index(parser);
 }
 
 
@@ -802,6 +1261,7 @@ static void emit_store_named_variable(Parser* parser, Token name) {
     uint16_t const_index = make_string_constant_from_identifier(parser, &name);
     emit_byte(parser, PYRO_OPCODE_SET_GLOBAL);
     emit_u16be(parser, const_index);
+    emit_inline_cache_index(parser);
     log_global_assignment(parser, name);
 }
 
@@ -828,7 +1288,7 @@ static int64_t parse_hex_literal(Parser* parser) {
     buffer[count] = '\0';
     errno = 0;
     int64_t value = strtoll(buffer, NULL, 16);
-    if (errno != 0) {
+    if (errno != 0 || value > PYRO_I64_MAX || value < PYRO_I64_MIN) {
         SYNTAX_ERROR_AT_PREVIOUS_TOKEN("invalid hex literal (out of range)");
     }
 
@@ -858,7 +1318,7 @@ static int64_t parse_binary_literal(Parser* parser) {
     buffer[count] = '\0';
     errno = 0;
     int64_t value = strtoll(buffer, NULL, 2);
-    if (errno != 0) {
+    if (errno != 0 || value > PYRO_I64_MAX || value < PYRO_I64_MIN) {
         SYNTAX_ERROR_AT_PREVIOUS_TOKEN("invalid binary literal (out of range)");
     }
 
@@ -888,7 +1348,7 @@ static int64_t parse_octal_literal(Parser* parser) {
     buffer[count] = '\0';
     errno = 0;
     int64_t value = strtoll(buffer, NULL, 8);
-    if (errno != 0) {
+    if (errno != 0 || value > PYRO_I64_MAX || value < PYRO_I64_MIN) {
         SYNTAX_ERROR_AT_PREVIOUS_TOKEN("invalid octal literal (out of range)");
     }
 
@@ -914,7 +1374,7 @@ static int64_t parse_int_literal(Parser* parser) {
     buffer[count] = '\0';
     errno = 0;
     int64_t value = strtoll(buffer, NULL, 10);
-    if (errno != 0) {
+    if (errno != 0 || value > PYRO_I64_MAX || value < PYRO_I64_MIN) {
         SYNTAX_ERROR_AT_PREVIOUS_TOKEN("invalid integer literal (out of range)");
     }
 
@@ -1552,20 +2012,26 @@ static void parse_call_expression(Parser* parser, bool can_assign) {
             if (can_assign && match(parser, TOKEN_EQUAL)) {
                 parse_expression(parser, true);
                 emit_u8_u16be(parser, set_opcode, index);
+                emit_inline_cache_index(parser);
             } else if (can_assign && match(parser, TOKEN_PLUS_EQUAL)) {
                 emit_byte(parser, PYRO_OPCODE_DUP);
                 emit_u8_u16be(parser, get_opcode, index);
+                emit_inline_cache_index(parser);
                 parse_expression(parser, true);
                 emit_byte(parser, PYRO_OPCODE_BINARY_PLUS);
                 emit_u8_u16be(parser, set_opcode, index);
+                emit_inline_cache_index(parser);
             } else if (can_assign && match(parser, TOKEN_MINUS_EQUAL)) {
                 emit_byte(parser, PYRO_OPCODE_DUP);
                 emit_u8_u16be(parser, get_opcode, index);
+                emit_inline_cache_index(parser);
                 parse_expression(parser, true);
                 emit_byte(parser, PYRO_OPCODE_BINARY_MINUS);
                 emit_u8_u16be(parser, set_opcode, index);
+                emit_inline_cache_index(parser);
             } else {
                 emit_u8_u16be(parser, get_opcode, index);
+                emit_inline_cache_index(parser);
             }
         }
 
@@ -1595,11 +2061,13 @@ static void parse_call_expression(Parser* parser, bool can_assign) {
                         PyroOpcode opcode = (last_token_type == TOKEN_SELF) ? PYRO_OPCODE_CALL_METHOD : PYRO_OPCODE_CALL_PUB_METHOD;
                         emit_u8_u16be(parser, opcode, index);
                         emit_byte(parser, arg_count);
+                        emit_inline_cache_index(parser);
                     }
                 }
             } else {
                 PyroOpcode opcode = (last_token_type == TOKEN_SELF) ? PYRO_OPCODE_GET_METHOD : PYRO_OPCODE_GET_PUB_METHOD;
                 emit_u8_u16be(parser, opcode, index);
+                emit_inline_cache_index(parser);
             }
         }
 
@@ -1670,10 +2138,12 @@ static void parse_as_expression(Parser* parser, bool can_assign) {
 
 
 static void parse_power_expression(Parser* parser, bool can_assign) {
+    OperandStart left_start = mark_operand_start(parser);
     parse_as_expression(parser, can_assign);
     if (match(parser, TOKEN_STAR_STAR)) {
+        OperandStart right_start = mark_operand_start(parser);
         parse_unary_expression(parser, false);
-        emit_byte(parser, PYRO_OPCODE_BINARY_STAR_STAR);
+        emit_binary_op(parser, PYRO_OPCODE_BINARY_STAR_STAR, left_start, right_start);
     }
 }
 
@@ -1700,20 +2170,24 @@ static void parse_try_expression(Parser* parser) {
 
 static void parse_unary_expression(Parser* parser, bool can_assign) {
     if (match(parser, TOKEN_MINUS)) {
+        OperandStart start = mark_operand_start(parser);
         parse_unary_expression(parser, false);
-        emit_byte(parser, PYRO_OPCODE_UNARY_MINUS);
+        emit_unary_op(parser, PYRO_OPCODE_UNARY_MINUS, start);
     } else if (match(parser, TOKEN_PLUS)) {
+        OperandStart start = mark_operand_start(parser);
         parse_unary_expression(parser, false);
-        emit_byte(parser, PYRO_OPCODE_UNARY_PLUS);
+        emit_unary_op(parser, PYRO_OPCODE_UNARY_PLUS, start);
     } else if (match(parser, TOKEN_BANG)) {
+        OperandStart start = mark_operand_start(parser);
         parse_unary_expression(parser, false);
-        emit_byte(parser, PYRO_OPCODE_UNARY_BANG);
+        emit_unary_op(parser, PYRO_OPCODE_UNARY_BANG, start);
     } else if (match(parser, TOKEN_TRY)) {
         parse_try_expression(parser);
         emit_byte(parser, PYRO_OPCODE_TRY);
     } else if (match(parser, TOKEN_TILDE)) {
+        OperandStart start = mark_operand_start(parser);
         parse_unary_expression(parser, false);
-        emit_byte(parser, PYRO_OPCODE_UNARY_TILDE);
+        emit_unary_op(parser, PYRO_OPCODE_UNARY_TILDE, start);
     } else {
         parse_power_expression(parser, can_assign);
     }
@@ -1721,23 +2195,29 @@ static void parse_unary_expression(Parser* parser, bool can_assign) {
 
 
 static void parse_bitwise_expression(Parser* parser, bool can_assign) {
+    OperandStart left_start = mark_operand_start(parser);
     parse_unary_expression(parser, can_assign);
     while (true) {
         if (match(parser, TOKEN_CARET)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_unary_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_CARET);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_CARET, left_start, right_start);
         } else if (match(parser, TOKEN_AMP)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_unary_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_AMP);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_AMP, left_start, right_start);
         } else if (match(parser, TOKEN_BAR)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_unary_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_BAR);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_BAR, left_start, right_start);
         } else if (match(parser, TOKEN_LESS_LESS)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_unary_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_LESS_LESS);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_LESS_LESS, left_start, right_start);
         } else if (match(parser, TOKEN_GREATER_GREATER)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_unary_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_GREATER_GREATER);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_GREATER_GREATER, left_start, right_start);
         } else {
             break;
         }
@@ -1746,26 +2226,33 @@ static void parse_bitwise_expression(Parser* parser, bool can_assign) {
 
 
 static void parse_multiplicative_expression(Parser* parser, bool can_assign) {
+    OperandStart left_start = mark_operand_start(parser);
     parse_bitwise_expression(parser, can_assign);
     while (true) {
         if (match(parser, TOKEN_STAR)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_bitwise_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_STAR);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_STAR, left_start, right_start);
         } else if (match(parser, TOKEN_SLASH)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_bitwise_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_SLASH);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_SLASH, left_start, right_start);
         } else if (match(parser, TOKEN_SLASH_SLASH)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_bitwise_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_SLASH_SLASH);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_SLASH_SLASH, left_start, right_start);
         } else if (match(parser, TOKEN_PERCENT)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_bitwise_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_PERCENT);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_PERCENT, left_start, right_start);
         } else if (match(parser, TOKEN_MOD)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_bitwise_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_MOD);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_MOD, left_start, right_start);
         } else if (match(parser, TOKEN_REM)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_bitwise_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_REM);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_REM, left_start, right_start);
         } else {
             break;
         }
@@ -1774,14 +2261,17 @@ static void parse_multiplicative_expression(Parser* parser, bool can_assign) {
 
 
 static void parse_additive_expression(Parser* parser, bool can_assign) {
+    OperandStart left_start = mark_operand_start(parser);
     parse_multiplicative_expression(parser, can_assign);
     while (true) {
         if (match(parser, TOKEN_PLUS)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_multiplicative_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_PLUS);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_PLUS, left_start, right_start);
         } else if (match(parser, TOKEN_MINUS)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_multiplicative_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_MINUS);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_MINUS, left_start, right_start);
         } else if (match(parser, TOKEN_I64_ADD)) {
             parse_multiplicative_expression(parser, false);
             emit_byte(parser, PYRO_OPCODE_I64_ADD);
@@ -1793,20 +2283,25 @@ static void parse_additive_expression(Parser* parser, bool can_assign) {
 
 
 static void parse_comparative_expression(Parser* parser, bool can_assign) {
+    OperandStart left_start = mark_operand_start(parser);
     parse_additive_expression(parser, can_assign);
     while (true) {
         if (match(parser, TOKEN_GREATER)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_additive_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_GREATER);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_GREATER, left_start, right_start);
         } else if (match(parser, TOKEN_GREATER_EQUAL)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_additive_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_GREATER_EQUAL);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_GREATER_EQUAL, left_start, right_start);
         } else if (match(parser, TOKEN_LESS)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_additive_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_LESS);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_LESS, left_start, right_start);
         } else if (match(parser, TOKEN_LESS_EQUAL)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_additive_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_LESS_EQUAL);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_LESS_EQUAL, left_start, right_start);
         } else if (match(parser, TOKEN_IN)) {
             parse_additive_expression(parser, false);
             emit_byte(parser, PYRO_OPCODE_BINARY_IN);
@@ -1818,14 +2313,17 @@ static void parse_comparative_expression(Parser* parser, bool can_assign) {
 
 
 static void parse_equality_expression(Parser* parser, bool can_assign) {
+    OperandStart left_start = mark_operand_start(parser);
     parse_comparative_expression(parser, can_assign);
     while (true) {
         if (match(parser, TOKEN_EQUAL_EQUAL)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_comparative_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_EQUAL_EQUAL);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_EQUAL_EQUAL, left_start, right_start);
         } else if (match(parser, TOKEN_BANG_EQUAL)) {
+            OperandStart right_start = mark_operand_start(parser);
             parse_comparative_expression(parser, false);
-            emit_byte(parser, PYRO_OPCODE_BINARY_BANG_EQUAL);
+            emit_binary_op(parser, PYRO_OPCODE_BINARY_BANG_EQUAL, left_start, right_start);
         } else {
             break;
         }
@@ -2067,15 +2565,22 @@ static void parse_variable_declaration(Parser* parser, Access access, bool is_co
             parse_unpacking_declaration(parser, access, is_constant);
         } else {
             uint16_t index = consume_variable_name(parser, "expected variable name", is_constant);
+            Token name = parser->previous_token;
             if (match(parser, TOKEN_COLON)) {
                 parse_type(parser);
             }
+            size_t initializer_start_index = parser->fn_compiler->fn->code_count;
             if (match(parser, TOKEN_EQUAL)) {
                 parse_expression(parser, true);
             } else {
                 emit_byte(parser, PYRO_OPCODE_LOAD_NULL);
             }
+            PyroValue known_value;
+            bool has_known_value = is_constant && get_constant_operand(parser, initializer_start_index, &known_value);
             define_variable(parser, index, access, is_constant);
+            if (has_known_value) {
+                record_known_value(parser, &name, known_value);
+            }
         }
     } while (match(parser, TOKEN_COMMA));
     consume(parser, TOKEN_SEMICOLON, "expected ';' after variable declaration");
@@ -2194,6 +2699,7 @@ static void parse_if_statement(Parser* parser) {
     }
 
     // Parse the condition.
+    size_t condition_start_index = parser->fn_compiler->fn->code_count;
     parse_expression(parser, false);
     if (match_assignment_token(parser)) {
         SYNTAX_ERROR_AT_PREVIOUS_TOKEN(
@@ -2202,6 +2708,45 @@ static void parse_if_statement(Parser* parser) {
         return;
     }
 
+    // If the condition is a constant, only one of the branches can run. We drop the condition
+    // and compile the dead branch as normal -- so it's still checked for syntax errors -- then
+    // discard its bytecode.
+    PyroValue condition;
+    if (get_constant_operand(parser, condition_start_index, &condition)) {
+        PyroFn_truncate(parser->fn_compiler->fn, condition_start_index);
+        bool condition_is_true = pyro_is_truthy(condition);
+
+        if (!consume(parser, TOKEN_LEFT_BRACE, "expected '{' after condition in 'if' statement")) {
+            return;
+        }
+
+        size_t then_start_index = parser->fn_compiler->fn->code_count;
+        begin_scope(parser);
+        parse_block(parser);
+        end_scope(parser);
+        if (!condition_is_true) {
+            PyroFn_truncate(parser->fn_compiler->fn, then_start_index);
+        }
+
+        if (match(parser, TOKEN_ELSE)) {
+            size_t else_start_index = parser->fn_compiler->fn->code_count;
+            if (match(parser, TOKEN_IF)) {
+                parse_if_statement(parser);
+            } else {
+                consume(parser, TOKEN_LEFT_BRACE, "expected '{' after 'else'");
+                begin_scope(parser);
+                parse_block(parser);
+                end_scope(parser);
+            }
+            if (condition_is_true) {
+                PyroFn_truncate(parser->fn_compiler->fn, else_start_index);
+            }
+        }
+
+        end_scope(parser);
+        return;
+    }
+
     // Jump over the 'then' block if the condition is false.
     size_t jump_over_then = emit_jump(parser, PYRO_OPCODE_POP_JUMP_IF_FALSE);
 
@@ -2487,7 +3032,19 @@ static void parse_while_statement(Parser* parser) {
         );
         return;
     }
-    size_t exit_jump_index = emit_jump(parser, PYRO_OPCODE_POP_JUMP_IF_FALSE);
+
+    // If the condition is a constant, we can drop it. A truthy condition gives us an infinite
+    // loop. A falsey condition means the body is dead -- we still compile it to check it for
+    // syntax errors but then discard its bytecode.
+    PyroValue condition;
+    bool condition_is_constant = get_constant_operand(parser, loop.start_bytecode_count, &condition);
+    size_t exit_jump_index = 0;
+
+    if (condition_is_constant) {
+        PyroFn_truncate(parser->fn_compiler->fn, loop.start_bytecode_count);
+    } else {
+        exit_jump_index = emit_jump(parser, PYRO_OPCODE_POP_JUMP_IF_FALSE);
+    }
 
     // Emit the bytecode for the block.
     consume(parser, TOKEN_LEFT_BRACE, "expected '{' before loop body");
@@ -2495,11 +3052,19 @@ static void parse_while_statement(Parser* parser) {
     parse_block(parser);
     end_scope(parser);
 
+    if (condition_is_constant && !pyro_is_truthy(condition)) {
+        PyroFn_truncate(parser->fn_compiler->fn, loop.start_bytecode_count);
+        parser->fn_compiler->loop_compiler = loop.enclosing;
+        return;
+    }
+
     // Jump back to the beginning of the loop.
     emit_loop(parser, loop.start_bytecode_count);
 
     // Backpatch the destination for the exit jump.
-    patch_jump(parser, exit_jump_index);
+    if (!condition_is_constant) {
+        patch_jump(parser, exit_jump_index);
+    }
 
     // If we found any break statements in the loop, backpatch their destinations.
     if (loop.had_break) {
@@ -3057,6 +3622,7 @@ static void log_global_constant(Parser* parser, Token name) {
     }
 
     global_constant->name = name;
+    global_constant->has_known_value = false;
     global_constant->next = NULL;
 
     if (parser->global_constants) {
@@ -3068,6 +3634,21 @@ static void log_global_constant(Parser* parser, Token name) {
 }
 
 
+// Returns the most recently declared global constant named [name], or NULL if there is none.
+static GlobalConstant* find_global_constant(Parser* parser, Token* name) {
+    GlobalConstant* global_constant = parser->global_constants;
+
+    while (global_constant) {
+        if (lexemes_are_equal(name, &global_constant->name)) {
+            return global_constant;
+        }
+        global_constant = global_constant->next;
+    }
+
+    return NULL;
+}
+
+
 static void free_global_constants(Parser* parser) {
     while (parser->global_constants) {
         GlobalConstant* next = parser->global_constants->next;
@@ -18,6 +18,44 @@ static size_t constant_instruction(PyroVM* vm, const char* name, PyroFn* fn, siz
 }
 
 
+// An instruction with a two-byte argument which indexes into the constants table, followed by a
+// two-byte argument which indexes into the function's inline caches.
+static size_t cached_constant_instruction(PyroVM* vm, const char* name, PyroFn* fn, size_t ip) {
+    uint16_t const_index = (fn->code[ip + 1] << 8) | fn->code[ip + 2];
+    uint16_t cache_index = (fn->code[ip + 3] << 8) | fn->code[ip + 4];
+    pyro_stdout_write_f(vm, "%-32s %4d    ", name, const_index);
+    pyro_dump_value(vm, fn->constants[const_index]);
+    pyro_stdout_write_f(vm, "    (cache %d)\n", cache_index);
+    return ip + 5;
+}
+
+
+// An instruction with a one-byte argument which indexes into the local variables, followed by a
+// two-byte argument which indexes into the constants table.
+static size_t local_constant_instruction(PyroVM* vm, const char* name, PyroFn* fn, size_t ip) {
+    uint8_t local_index = fn->code[ip + 1];
+    uint16_t const_index = (fn->code[ip + 2] << 8) | fn->code[ip + 3];
+    pyro_stdout_write_f(vm, "%-32s %4d %4d    ", name, local_index, const_index);
+    pyro_dump_value(vm, fn->constants[const_index]);
+    pyro_stdout_write_f(vm, "\n");
+    return ip + 4;
+}
+
+
+// An instruction with a one-byte argument which indexes into the local variables, followed by a
+// two-byte argument which indexes into the constants table, followed by a two-byte argument
+// which indexes into the function's inline caches.
+static size_t local_cached_constant_instruction(PyroVM* vm, const char* name, PyroFn* fn, size_t ip) {
+    uint8_t local_index = fn->code[ip + 1];
+    uint16_t const_index = (fn->code[ip + 2] << 8) | fn->code[ip + 3];
+    uint16_t cache_index = (fn->code[ip + 4] << 8) | fn->code[ip + 5];
+    pyro_stdout_write_f(vm, "%-32s %4d %4d    ", name, local_index, const_index);
+    pyro_dump_value(vm, fn->constants[const_index]);
+    pyro_stdout_write_f(vm, "    (cache %d)\n", cache_index);
+    return ip + 6;
+}
+
+
 // An instruction with a one-byte argument representing a uint8_t.
 static size_t u8_instruction(PyroVM* vm, const char* name, PyroFn* fn, size_t ip) {
     uint8_t arg = fn->code[ip + 1];
@@ -71,6 +109,19 @@ static size_t invoke_instruction(PyroVM* vm, const char* name, PyroFn* fn, size_
 }
 
 
+// A method-invoking instruction, followed by a two-byte argument which indexes into the function's
+// inline caches.
+static size_t cached_invoke_instruction(PyroVM* vm, const char* name, PyroFn* fn, size_t ip) {
+    uint16_t const_index = (fn->code[ip + 1] << 8) | fn->code[ip + 2];
+    uint8_t arg_count = fn->code[ip + 3];
+    uint16_t cache_index = (fn->code[ip + 4] << 8) | fn->code[ip + 5];
+    pyro_stdout_write_f(vm, "%-32s %4d    ", name, const_index);
+    pyro_dump_value(vm, fn->constants[const_index]);
+    pyro_stdout_write_f(vm, "    (%d args)    (cache %d)\n", arg_count, cache_index);
+    return ip + 6;
+}
+
+
 // Returns the index of the next instruction, if there is one.
 size_t pyro_disassemble_instruction(PyroVM* vm, PyroFn* fn, size_t ip) {
     pyro_stdout_write_f(vm, "%04d ", ip);
@@ -223,13 +274,13 @@ size_t pyro_disassemble_instruction(PyroVM* vm, PyroFn* fn, size_t ip) {
             return atomic_instruction(vm, "BINARY_SLASH", ip);
 
         case PYRO_OPCODE_GET_FIELD:
-            return constant_instruction(vm, "GET_FIELD", fn, ip);
+            return cached_constant_instruction(vm, "GET_FIELD", fn, ip);
 
         case PYRO_OPCODE_GET_PUB_FIELD:
-            return constant_instruction(vm, "GET_PUB_FIELD", fn, ip);
+            return cached_constant_instruction(vm, "GET_PUB_FIELD", fn, ip);
 
         case PYRO_OPCODE_GET_GLOBAL:
-            return constant_instruction(vm, "GET_GLOBAL", fn, ip);
+            return cached_constant_instruction(vm, "GET_GLOBAL", fn, ip);
 
         case PYRO_OPCODE_GET_INDEX:
             return atomic_instruction(vm, "GET_INDEX", ip);
@@ -241,10 +292,10 @@ size_t pyro_disassemble_instruction(PyroVM* vm, PyroFn* fn, size_t ip) {
             return constant_instruction(vm, "GET_MEMBER", fn, ip);
 
         case PYRO_OPCODE_GET_METHOD:
-            return constant_instruction(vm, "GET_METHOD", fn, ip);
+            return cached_constant_instruction(vm, "GET_METHOD", fn, ip);
 
         case PYRO_OPCODE_GET_PUB_METHOD:
-            return constant_instruction(vm, "GET_PUB_METHOD", fn, ip);
+            return cached_constant_instruction(vm, "GET_PUB_METHOD", fn, ip);
 
         case PYRO_OPCODE_GET_SUPER_METHOD:
             return constant_instruction(vm, "GET_SUPER_METHOD", fn, ip);
@@ -268,10 +319,10 @@ size_t pyro_disassemble_instruction(PyroVM* vm, PyroFn* fn, size_t ip) {
             return atomic_instruction(vm, "INHERIT", ip);
 
         case PYRO_OPCODE_CALL_METHOD:
-            return invoke_instruction(vm, "CALL_METHOD", fn, ip);
+            return cached_invoke_instruction(vm, "CALL_METHOD", fn, ip);
 
         case PYRO_OPCODE_CALL_PUB_METHOD:
-            return invoke_instruction(vm, "CALL_PUB_METHOD", fn, ip);
+            return cached_invoke_instruction(vm, "CALL_PUB_METHOD", fn, ip);
 
         case PYRO_OPCODE_CALL_METHOD_WITH_UNPACK:
             return invoke_instruction(vm, "CALL_METHOD_WITH_UNPACK", fn, ip);
@@ -309,6 +360,24 @@ size_t pyro_disassemble_instruction(PyroVM* vm, PyroFn* fn, size_t ip) {
         case PYRO_OPCODE_JUMP_IF_TRUE:
             return jump_instruction(vm, "JUMP_IF_TRUE", 1, fn, ip);
 
+        case PYRO_OPCODE_JUMP_IF_EQUAL:
+            return jump_instruction(vm, "JUMP_IF_EQUAL", 1, fn, ip);
+
+        case PYRO_OPCODE_JUMP_IF_NOT_EQUAL:
+            return jump_instruction(vm, "JUMP_IF_NOT_EQUAL", 1, fn, ip);
+
+        case PYRO_OPCODE_JUMP_IF_NOT_GREATER:
+            return jump_instruction(vm, "JUMP_IF_NOT_GREATER", 1, fn, ip);
+
+        case PYRO_OPCODE_JUMP_IF_NOT_GREATER_EQUAL:
+            return jump_instruction(vm, "JUMP_IF_NOT_GREATER_EQUAL", 1, fn, ip);
+
+        case PYRO_OPCODE_JUMP_IF_NOT_LESS:
+            return jump_instruction(vm, "JUMP_IF_NOT_LESS", 1, fn, ip);
+
+        case PYRO_OPCODE_JUMP_IF_NOT_LESS_EQUAL:
+            return jump_instruction(vm, "JUMP_IF_NOT_LESS_EQUAL", 1, fn, ip);
+
         case PYRO_OPCODE_BINARY_LESS:
             return atomic_instruction(vm, "BINARY_LESS", ip);
 
@@ -381,6 +450,15 @@ size_t pyro_disassemble_instruction(PyroVM* vm, PyroFn* fn, size_t ip) {
         case PYRO_OPCODE_GET_LOCAL_9:
             return atomic_instruction(vm, "GET_LOCAL_9", ip);
 
+        case PYRO_OPCODE_GET_LOCAL_FIELD:
+            return local_cached_constant_instruction(vm, "GET_LOCAL_FIELD", fn, ip);
+
+        case PYRO_OPCODE_GET_LOCAL_PUB_FIELD:
+            return local_cached_constant_instruction(vm, "GET_LOCAL_PUB_FIELD", fn, ip);
+
+        case PYRO_OPCODE_GET_LOCAL_PLUS_CONSTANT:
+            return local_constant_instruction(vm, "GET_LOCAL_PLUS_CONSTANT", fn, ip);
+
         case PYRO_OPCODE_SET_LOCAL_0:
             return atomic_instruction(vm, "SET_LOCAL_0", ip);
 
@@ -411,6 +489,9 @@ size_t pyro_disassemble_instruction(PyroVM* vm, PyroFn* fn, size_t ip) {
         case PYRO_OPCODE_SET_LOCAL_9:
             return atomic_instruction(vm, "SET_LOCAL_9", ip);
 
+        case PYRO_OPCODE_POP_SET_LOCAL:
+            return u8_instruction(vm, "POP_SET_LOCAL", fn, ip);
+
         case PYRO_OPCODE_LOAD_NULL:
             return atomic_instruction(vm, "LOAD_NULL", ip);
 
@@ -477,6 +558,54 @@ size_t pyro_disassemble_instruction(PyroVM* vm, PyroFn* fn, size_t ip) {
         case PYRO_OPCODE_BINARY_STAR_STAR:
             return atomic_instruction(vm, "BINARY_STAR_STAR", ip);
 
+        case PYRO_OPCODE_BINARY_MOD:
+            return atomic_instruction(vm, "BINARY_MOD", ip);
+
+        case PYRO_OPCODE_BINARY_REM:
+            return atomic_instruction(vm, "BINARY_REM", ip);
+
+        case PYRO_OPCODE_BINARY_PLUS_I64:
+            return atomic_instruction(vm, "BINARY_PLUS_I64", ip);
+
+        case PYRO_OPCODE_BINARY_PLUS_F64:
+            return atomic_instruction(vm, "BINARY_PLUS_F64", ip);
+
+        case PYRO_OPCODE_BINARY_MINUS_I64:
+            return atomic_instruction(vm, "BINARY_MINUS_I64", ip);
+
+        case PYRO_OPCODE_BINARY_MINUS_F64:
+            return atomic_instruction(vm, "BINARY_MINUS_F64", ip);
+
+        case PYRO_OPCODE_BINARY_STAR_I64:
+            return atomic_instruction(vm, "BINARY_STAR_I64", ip);
+
+        case PYRO_OPCODE_BINARY_STAR_F64:
+            return atomic_instruction(vm, "BINARY_STAR_F64", ip);
+
+        case PYRO_OPCODE_BINARY_LESS_I64:
+            return atomic_instruction(vm, "BINARY_LESS_I64", ip);
+
+        case PYRO_OPCODE_BINARY_LESS_F64:
+            return atomic_instruction(vm, "BINARY_LESS_F64", ip);
+
+        case PYRO_OPCODE_BINARY_LESS_EQUAL_I64:
+            return atomic_instruction(vm, "BINARY_LESS_EQUAL_I64", ip);
+
+        case PYRO_OPCODE_BINARY_LESS_EQUAL_F64:
+            return atomic_instruction(vm, "BINARY_LESS_EQUAL_F64", ip);
+
+        case PYRO_OPCODE_BINARY_GREATER_I64:
+            return atomic_instruction(vm, "BINARY_GREATER_I64", ip);
+
+        case PYRO_OPCODE_BINARY_GREATER_F64:
+            return atomic_instruction(vm, "BINARY_GREATER_F64", ip);
+
+        case PYRO_OPCODE_BINARY_GREATER_EQUAL_I64:
+            return atomic_instruction(vm, "BINARY_GREATER_EQUAL_I64", ip);
+
+        case PYRO_OPCODE_BINARY_GREATER_EQUAL_F64:
+            return atomic_instruction(vm, "BINARY_GREATER_EQUAL_F64", ip);
+
         case PYRO_OPCODE_RETURN:
             return atomic_instruction(vm, "RETURN", ip);
 
@@ -487,13 +616,13 @@ size_t pyro_disassemble_instruction(PyroVM* vm, PyroFn* fn, size_t ip) {
             return atomic_instruction(vm, "BINARY_GREATER_GREATER", ip);
 
         case PYRO_OPCODE_SET_FIELD:
-            return constant_instruction(vm, "SET_FIELD", fn, ip);
+            return cached_constant_instruction(vm, "SET_FIELD", fn, ip);
 
         case PYRO_OPCODE_SET_PUB_FIELD:
-            return constant_instruction(vm, "SET_PUB_FIELD", fn, ip);
+            return cached_constant_instruction(vm, "SET_PUB_FIELD", fn, ip);
 
         case PYRO_OPCODE_SET_GLOBAL:
-            return constant_instruction(vm, "SET_GLOBAL", fn, ip);
+            return cached_constant_instruction(vm, "SET_GLOBAL", fn, ip);
 
         case PYRO_OPCODE_SET_INDEX:
             return atomic_instruction(vm, "SET_INDEX", ip);
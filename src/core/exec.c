@@ -5,6 +5,20 @@
 static void run(PyroVM* vm);
 
 
+// Counts a call or backward jump towards the function's register tier threshold. The function is
+// translated to register code when it reaches the threshold.
+static inline void count_hotness(PyroVM* vm, PyroFn* fn) {
+    #if PYRO_REGISTER_TIER_THRESHOLD > 0
+        if (!fn->reg_code && ++fn->hotness == PYRO_REGISTER_TIER_THRESHOLD) {
+            pyro_compile_register_code(vm, fn);
+        }
+    #else
+        (void)vm;
+        (void)fn;
+    #endif
+}
+
+
 // Pushes a new call frame onto the call stack.
 // - [frame_pointer] points to the frame's zeroth local variable slot on the value stack.
 // - If [closure] is a function, the zeroth local variable slot will be unused.
@@ -40,6 +54,9 @@ static void push_call_frame(PyroVM* vm, PyroClosure* closure, PyroValue* frame_p
     frame->ip = closure->fn->code;
     frame->fp = frame_pointer;
     frame->with_stack_count_on_entry = vm->with_stack_count;
+
+    count_hotness(vm, closure->fn);
+    frame->reg_ip = closure->fn->reg_code ? closure->fn->reg_code->code : NULL;
 }
 
 
@@ -204,6 +221,7 @@ static void call_value(PyroVM* vm, uint8_t arg_count) {
                         return;
                     }
 
+                    pyro_write_barrier(vm, (PyroObject*)instance, vm->stack_top[-1]);
                     instance->fields[i] = pyro_pop(vm);
                 }
             }
@@ -310,6 +328,7 @@ static PyroUpvalue* capture_upvalue(PyroVM* vm, PyroValue* local) {
 static void close_upvalues(PyroVM* vm, PyroValue* slot) {
     while (vm->open_upvalues != NULL && vm->open_upvalues->location >= slot) {
         PyroUpvalue* upvalue = vm->open_upvalues;
+        pyro_write_barrier(vm, (PyroObject*)upvalue, *upvalue->location);
         upvalue->closed = *upvalue->location;
         upvalue->location = &upvalue->closed;
         vm->open_upvalues = upvalue->next;
@@ -418,47 +437,972 @@ void call_exit_method(PyroVM* vm, PyroValue receiver) {
 }
 
 
+// Looks up a method for a method-call instruction using the instruction's inline cache. Returns
+// [null] if the method doesn't exist. Static methods aren't cached.
+static inline PyroValue get_cached_method(PyroVM* vm, PyroValue receiver, PyroStr* method_name, PyroInlineCache* cache, bool is_pub) {
+    if (PYRO_IS_CLASS(receiver)) {
+        return is_pub ? pyro_get_pub_method(vm, receiver, method_name) : pyro_get_method(vm, receiver, method_name);
+    }
+
+    PyroClass* class = pyro_get_class(vm, receiver);
+    if (!class) {
+        return pyro_null();
+    }
+
+    if (cache->layout_id == class->layout_id) {
+        return cache->as.method;
+    }
+
+    PyroValue method = is_pub ? pyro_get_pub_method(vm, receiver, method_name) : pyro_get_method(vm, receiver, method_name);
+    if (!PYRO_IS_NULL(method)) {
+        cache->layout_id = class->layout_id;
+        cache->as.method = method;
+    }
+
+    return method;
+}
+
+
+// Replaces the receiver on top of the stack with the value of its field [field_name], filling
+// the instruction's inline cache if the receiver is an instance. Panics if the field doesn't
+// exist, or if [is_pub] is true and the field is private.
+static void get_field(PyroVM* vm, PyroStr* field_name, PyroInlineCache* cache, bool is_pub) {
+    PyroValue receiver = vm->stack_top[-1];
+
+    if (PYRO_IS_INSTANCE(receiver)) {
+        PyroInstance* instance = PYRO_AS_INSTANCE(receiver);
+        PyroClass* class = instance->obj.class;
+        PyroMap* field_indexes = is_pub ? class->pub_field_indexes : class->all_field_indexes;
+
+        PyroValue field_index;
+        if (PyroMap_fast_get(field_indexes, field_name, &field_index, vm)) {
+            cache->layout_id = class->layout_id;
+            cache->as.index = (size_t)PYRO_AS_I64(field_index);
+            vm->stack_top[-1] = instance->fields[PYRO_AS_I64(field_index)];
+            return;
+        }
+
+        if (is_pub && PyroMap_fast_get(class->all_field_indexes, field_name, &field_index, vm)) {
+            pyro_panic(vm, "field '%s' is private", field_name->bytes);
+            return;
+        }
+    }
+
+    if (PYRO_IS_CLASS(receiver)) {
+        PyroClass* class = PYRO_AS_CLASS(receiver);
+        PyroValue value;
+        if (PyroMap_fast_get(class->static_fields, field_name, &value, vm)) {
+            // Replace the class with the field value.
+            vm->stack_top[-1] = value;
+        } else {
+            pyro_panic(vm, "%s has no static field '%s'", class->name->bytes, field_name->bytes);
+        }
+        return;
+    }
+
+    pyro_panic(vm, "%s has no field '%s'", pyro_get_type_name(vm, receiver)->bytes, field_name->bytes);
+}
+
+
+// Debug builds always dispatch instructions via the switch statement so every instruction passes
+// through the top of the loop where it can be traced.
+#if PYRO_USE_COMPUTED_GOTOS && !defined(PYRO_DEBUG)
+    #define PYRO_DISPATCH_WITH_COMPUTED_GOTOS
+#endif
+
+// Taking the address of a label and initializing a range of array elements are GNU extensions.
+#ifdef PYRO_DISPATCH_WITH_COMPUTED_GOTOS
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wpedantic"
+    #pragma GCC diagnostic ignored "-Woverride-init"
+#endif
+
+// Runs register code for the call frame on top of the call stack. Calls and returns between
+// frames that have register code switch frames here without going back through the run loop.
+// Returns to the run loop when the top frame has no register code, when the call stack drops
+// below [call_stack_count_on_entry], on a panic, or at a garbage collection safepoint in a loop.
+// Each frame entry reloads the constant registers and clears the registers above the live stack
+// slots as calls can overwrite them.
+static void run_register_code(PyroVM* vm, size_t call_stack_count_on_entry) {
+    size_t frame_index;
+    PyroCallFrame* frame;
+    PyroFn* fn;
+    PyroRegCode* reg_code;
+    PyroValue* fp;
+    PyroRegInstruction* ip;
+
+enter_frame:
+    frame_index = vm->call_stack_count - 1;
+    frame = &vm->call_stack[frame_index];
+    fn = frame->closure->fn;
+    reg_code = fn->reg_code;
+
+    while ((size_t)(vm->stack_max - frame->fp) < reg_code->frame_size) {
+        if (!pyro_reallocate_stack(vm)) {
+            pyro_panic(vm, "out of memory: unable to reallocate the stack");
+            return;
+        }
+    }
+
+    fp = frame->fp;
+    for (PyroValue* slot = vm->stack_top; slot < fp + reg_code->const_base; slot++) {
+        *slot = pyro_null();
+    }
+    for (size_t i = 0; i < reg_code->const_count; i++) {
+        fp[reg_code->const_base + i] = reg_code->constants[i];
+    }
+    vm->stack_top = fp + reg_code->frame_size;
+    ip = frame->reg_ip;
+
+    // Writes the offset of the current instruction's stack bytecode to the frame. Instructions
+    // need to do this before doing anything that can panic or call a function.
+    #define REG_SAVE_IP() (frame->ip = fn->code + ip->ip)
+
+    // Calling into Pyro code can reallocate the call stack and the value stack.
+    #define REG_RELOAD() (frame = &vm->call_stack[frame_index], fp = frame->fp)
+
+    #if defined(PYRO_DISPATCH_WITH_COMPUTED_GOTOS)
+        #define REG_TARGET(opcode) case opcode: REG_TARGET_##opcode
+        #define REG_DISPATCH() \
+            left = fp[ip->b]; \
+            right = fp[ip->c]; \
+            goto *reg_dispatch_table[ip->opcode]
+
+        static void* reg_dispatch_table[256] = {
+            [0 ... 255] = &&REG_TARGET_INVALID_OPCODE,
+            [PYRO_REG_MOVE] = &&REG_TARGET_PYRO_REG_MOVE,
+            [PYRO_REG_ADD] = &&REG_TARGET_PYRO_REG_ADD,
+            [PYRO_REG_SUB] = &&REG_TARGET_PYRO_REG_SUB,
+            [PYRO_REG_MUL] = &&REG_TARGET_PYRO_REG_MUL,
+            [PYRO_REG_DIV] = &&REG_TARGET_PYRO_REG_DIV,
+            [PYRO_REG_FLOOR_DIV] = &&REG_TARGET_PYRO_REG_FLOOR_DIV,
+            [PYRO_REG_PERCENT] = &&REG_TARGET_PYRO_REG_PERCENT,
+            [PYRO_REG_REM] = &&REG_TARGET_PYRO_REG_REM,
+            [PYRO_REG_MOD] = &&REG_TARGET_PYRO_REG_MOD,
+            [PYRO_REG_POW] = &&REG_TARGET_PYRO_REG_POW,
+            [PYRO_REG_BIT_AND] = &&REG_TARGET_PYRO_REG_BIT_AND,
+            [PYRO_REG_BIT_OR] = &&REG_TARGET_PYRO_REG_BIT_OR,
+            [PYRO_REG_BIT_XOR] = &&REG_TARGET_PYRO_REG_BIT_XOR,
+            [PYRO_REG_SHIFT_LEFT] = &&REG_TARGET_PYRO_REG_SHIFT_LEFT,
+            [PYRO_REG_SHIFT_RIGHT] = &&REG_TARGET_PYRO_REG_SHIFT_RIGHT,
+            [PYRO_REG_EQUAL] = &&REG_TARGET_PYRO_REG_EQUAL,
+            [PYRO_REG_NOT_EQUAL] = &&REG_TARGET_PYRO_REG_NOT_EQUAL,
+            [PYRO_REG_LESS] = &&REG_TARGET_PYRO_REG_LESS,
+            [PYRO_REG_LESS_EQUAL] = &&REG_TARGET_PYRO_REG_LESS_EQUAL,
+            [PYRO_REG_GREATER] = &&REG_TARGET_PYRO_REG_GREATER,
+            [PYRO_REG_GREATER_EQUAL] = &&REG_TARGET_PYRO_REG_GREATER_EQUAL,
+            [PYRO_REG_NEGATE] = &&REG_TARGET_PYRO_REG_NEGATE,
+            [PYRO_REG_PLUS] = &&REG_TARGET_PYRO_REG_PLUS,
+            [PYRO_REG_NOT] = &&REG_TARGET_PYRO_REG_NOT,
+            [PYRO_REG_BIT_NOT] = &&REG_TARGET_PYRO_REG_BIT_NOT,
+            [PYRO_REG_GET_INDEX] = &&REG_TARGET_PYRO_REG_GET_INDEX,
+            [PYRO_REG_SET_INDEX] = &&REG_TARGET_PYRO_REG_SET_INDEX,
+            [PYRO_REG_GET_FIELD] = &&REG_TARGET_PYRO_REG_GET_FIELD,
+            [PYRO_REG_GET_PUB_FIELD] = &&REG_TARGET_PYRO_REG_GET_PUB_FIELD,
+            [PYRO_REG_GET_GLOBAL] = &&REG_TARGET_PYRO_REG_GET_GLOBAL,
+            [PYRO_REG_SET_GLOBAL] = &&REG_TARGET_PYRO_REG_SET_GLOBAL,
+            [PYRO_REG_GET_ITERATOR] = &&REG_TARGET_PYRO_REG_GET_ITERATOR,
+            [PYRO_REG_GET_NEXT_FROM_ITERATOR] = &&REG_TARGET_PYRO_REG_GET_NEXT_FROM_ITERATOR,
+            [PYRO_REG_CALL] = &&REG_TARGET_PYRO_REG_CALL,
+            [PYRO_REG_CALL_METHOD] = &&REG_TARGET_PYRO_REG_CALL_METHOD,
+            [PYRO_REG_CALL_PUB_METHOD] = &&REG_TARGET_PYRO_REG_CALL_PUB_METHOD,
+            [PYRO_REG_RETURN] = &&REG_TARGET_PYRO_REG_RETURN,
+            [PYRO_REG_JUMP] = &&REG_TARGET_PYRO_REG_JUMP,
+            [PYRO_REG_LOOP] = &&REG_TARGET_PYRO_REG_LOOP,
+            [PYRO_REG_JUMP_IF_FALSE] = &&REG_TARGET_PYRO_REG_JUMP_IF_FALSE,
+            [PYRO_REG_JUMP_IF_TRUE] = &&REG_TARGET_PYRO_REG_JUMP_IF_TRUE,
+            [PYRO_REG_JUMP_IF_ERR] = &&REG_TARGET_PYRO_REG_JUMP_IF_ERR,
+            [PYRO_REG_JUMP_IF_NOT_ERR] = &&REG_TARGET_PYRO_REG_JUMP_IF_NOT_ERR,
+            [PYRO_REG_JUMP_IF_EQUAL] = &&REG_TARGET_PYRO_REG_JUMP_IF_EQUAL,
+            [PYRO_REG_JUMP_IF_NOT_EQUAL] = &&REG_TARGET_PYRO_REG_JUMP_IF_NOT_EQUAL,
+            [PYRO_REG_JUMP_IF_NOT_LESS] = &&REG_TARGET_PYRO_REG_JUMP_IF_NOT_LESS,
+            [PYRO_REG_JUMP_IF_NOT_LESS_EQUAL] = &&REG_TARGET_PYRO_REG_JUMP_IF_NOT_LESS_EQUAL,
+            [PYRO_REG_JUMP_IF_NOT_GREATER] = &&REG_TARGET_PYRO_REG_JUMP_IF_NOT_GREATER,
+            [PYRO_REG_JUMP_IF_NOT_GREATER_EQUAL] = &&REG_TARGET_PYRO_REG_JUMP_IF_NOT_GREATER_EQUAL,
+        };
+    #else
+        #define REG_TARGET(opcode) case opcode
+        #define REG_DISPATCH() continue
+    #endif
+
+    // Writes a result to register [a] and moves on to the next instruction.
+    #define REG_RESULT(value) fp[ip->a] = (value); ip++; REG_DISPATCH()
+
+    // Finishes a slow-path operation: bails out if it panicked, otherwise writes its result.
+    #define REG_SLOW_RESULT(value) \
+        { \
+            PyroValue slow_result = (value); \
+            REG_RELOAD(); \
+            if (vm->halt_flag) { \
+                return; \
+            } \
+            REG_RESULT(slow_result); \
+        }
+
+    // Jumps to [x] if [condition] is true.
+    #define REG_JUMP_IF(condition) \
+        if (condition) { \
+            ip = reg_code->code + ip->x; \
+        } else { \
+            ip++; \
+        } \
+        REG_DISPATCH()
+
+    // Finishes a slow-path compare-and-jump.
+    #define REG_SLOW_JUMP_IF(condition) \
+        { \
+            bool slow_result = (condition); \
+            REG_RELOAD(); \
+            if (vm->halt_flag) { \
+                return; \
+            } \
+            REG_JUMP_IF(slow_result); \
+        }
+
+    // Switches to the frame on top of the call stack after a call or return. Calls and returns
+    // are garbage collection safepoints.
+    #define REG_SWITCH_FRAME() \
+        if (vm->bytes_allocated > vm->next_gc_threshold) { \
+            pyro_collect_garbage(vm); \
+        } \
+        if (vm->halt_flag || vm->call_stack_count < call_stack_count_on_entry) { \
+            return; \
+        } \
+        if (!vm->call_stack[vm->call_stack_count - 1].reg_ip) { \
+            return; \
+        } \
+        goto enter_frame
+
+    PyroValue left;
+    PyroValue right;
+
+    for (;;) {
+        left = fp[ip->b];
+        right = fp[ip->c];
+
+        switch (ip->opcode) {
+            REG_TARGET(PYRO_REG_MOVE):
+                REG_RESULT(left);
+
+            REG_TARGET(PYRO_REG_ADD):
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    int64_t result;
+                    if (!pyro_ckd_add(&result, PYRO_AS_I64(left), PYRO_AS_I64(right))) {
+                        REG_RESULT(pyro_i64(result));
+                    }
+                } else if (PYRO_IS_F64(left) && PYRO_IS_F64(right)) {
+                    REG_RESULT(pyro_f64(PYRO_AS_F64(left) + PYRO_AS_F64(right)));
+                }
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_binary_plus(vm, left, right));
+
+            REG_TARGET(PYRO_REG_SUB):
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    int64_t result;
+                    if (!pyro_ckd_sub(&result, PYRO_AS_I64(left), PYRO_AS_I64(right))) {
+                        REG_RESULT(pyro_i64(result));
+                    }
+                } else if (PYRO_IS_F64(left) && PYRO_IS_F64(right)) {
+                    REG_RESULT(pyro_f64(PYRO_AS_F64(left) - PYRO_AS_F64(right)));
+                }
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_binary_minus(vm, left, right));
+
+            REG_TARGET(PYRO_REG_MUL):
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    int64_t result;
+                    if (!pyro_ckd_mul(&result, PYRO_AS_I64(left), PYRO_AS_I64(right))) {
+                        REG_RESULT(pyro_i64(result));
+                    }
+                } else if (PYRO_IS_F64(left) && PYRO_IS_F64(right)) {
+                    REG_RESULT(pyro_f64(PYRO_AS_F64(left) * PYRO_AS_F64(right)));
+                }
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_binary_star(vm, left, right));
+
+            REG_TARGET(PYRO_REG_DIV):
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_binary_slash(vm, left, right));
+
+            REG_TARGET(PYRO_REG_FLOOR_DIV):
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_binary_slash_slash(vm, left, right));
+
+            REG_TARGET(PYRO_REG_PERCENT):
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right) && PYRO_AS_I64(right) > 0) {
+                    REG_RESULT(pyro_i64(PYRO_AS_I64(left) % PYRO_AS_I64(right)));
+                }
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_binary_percent(vm, left, right));
+
+            REG_TARGET(PYRO_REG_REM):
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_binary_rem(vm, left, right));
+
+            REG_TARGET(PYRO_REG_MOD):
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_binary_mod(vm, left, right));
+
+            REG_TARGET(PYRO_REG_POW):
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_binary_star_star(vm, left, right));
+
+            REG_TARGET(PYRO_REG_BIT_AND):
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_binary_amp(vm, left, right));
+
+            REG_TARGET(PYRO_REG_BIT_OR):
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_binary_bar(vm, left, right));
+
+            REG_TARGET(PYRO_REG_BIT_XOR):
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_binary_caret(vm, left, right));
+
+            REG_TARGET(PYRO_REG_SHIFT_LEFT):
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_binary_less_less(vm, left, right));
+
+            REG_TARGET(PYRO_REG_SHIFT_RIGHT):
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_binary_greater_greater(vm, left, right));
+
+            REG_TARGET(PYRO_REG_EQUAL):
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    REG_RESULT(pyro_bool(PYRO_AS_I64(left) == PYRO_AS_I64(right)));
+                }
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_bool(pyro_op_compare_eq(vm, left, right)));
+
+            REG_TARGET(PYRO_REG_NOT_EQUAL):
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    REG_RESULT(pyro_bool(PYRO_AS_I64(left) != PYRO_AS_I64(right)));
+                }
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_bool(!pyro_op_compare_eq(vm, left, right)));
+
+            REG_TARGET(PYRO_REG_LESS):
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    REG_RESULT(pyro_bool(PYRO_AS_I64(left) < PYRO_AS_I64(right)));
+                }
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_bool(pyro_op_compare_lt(vm, left, right)));
+
+            REG_TARGET(PYRO_REG_LESS_EQUAL):
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    REG_RESULT(pyro_bool(PYRO_AS_I64(left) <= PYRO_AS_I64(right)));
+                }
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_bool(pyro_op_compare_le(vm, left, right)));
+
+            REG_TARGET(PYRO_REG_GREATER):
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    REG_RESULT(pyro_bool(PYRO_AS_I64(left) > PYRO_AS_I64(right)));
+                }
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_bool(pyro_op_compare_gt(vm, left, right)));
+
+            REG_TARGET(PYRO_REG_GREATER_EQUAL):
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    REG_RESULT(pyro_bool(PYRO_AS_I64(left) >= PYRO_AS_I64(right)));
+                }
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_bool(pyro_op_compare_ge(vm, left, right)));
+
+            REG_TARGET(PYRO_REG_NEGATE):
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_unary_minus(vm, left));
+
+            REG_TARGET(PYRO_REG_PLUS):
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_unary_plus(vm, left));
+
+            REG_TARGET(PYRO_REG_NOT):
+                REG_RESULT(pyro_bool(!pyro_is_truthy(left)));
+
+            REG_TARGET(PYRO_REG_BIT_NOT):
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_unary_tilde(vm, left));
+
+            REG_TARGET(PYRO_REG_GET_INDEX):
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_get_index(vm, left, right));
+
+            REG_TARGET(PYRO_REG_SET_INDEX):
+                REG_SAVE_IP();
+                REG_SLOW_RESULT(pyro_op_set_index(vm, left, right, fp[ip->x]));
+
+            REG_TARGET(PYRO_REG_GET_FIELD):
+            REG_TARGET(PYRO_REG_GET_PUB_FIELD): {
+                PyroInlineCache* cache = &fn->inline_caches[ip->x];
+                if (PYRO_IS_INSTANCE(left)) {
+                    PyroInstance* instance = PYRO_AS_INSTANCE(left);
+                    if (cache->layout_id == instance->obj.class->layout_id) {
+                        REG_RESULT(instance->fields[cache->as.index]);
+                    }
+                }
+
+                REG_SAVE_IP();
+                if (!pyro_push(vm, left)) {
+                    return;
+                }
+                get_field(vm, PYRO_AS_STR(fn->constants[ip->c]), cache, ip->opcode == PYRO_REG_GET_PUB_FIELD);
+                REG_SLOW_RESULT(pyro_pop(vm));
+            }
+
+            REG_TARGET(PYRO_REG_GET_GLOBAL): {
+                PyroInlineCache* cache = &fn->inline_caches[ip->x];
+                PyroMod* module = frame->closure->module;
+
+                if (cache->layout_id == module->layout_id) {
+                    REG_RESULT(module->members->values[cache->as.index]);
+                }
+
+                PyroStr* name = PYRO_AS_STR(fn->constants[ip->c]);
+
+                PyroValue member_index;
+                if (PyroMap_fast_get(module->all_member_indexes, name, &member_index, vm)) {
+                    cache->layout_id = module->layout_id;
+                    cache->as.index = (size_t)PYRO_AS_I64(member_index);
+                    REG_RESULT(module->members->values[PYRO_AS_I64(member_index)]);
+                }
+
+                PyroValue value;
+                if (PyroMap_fast_get(vm->superglobals, name, &value, vm)) {
+                    REG_RESULT(value);
+                }
+
+                REG_SAVE_IP();
+                pyro_panic(vm, "undefined variable '%s'", name->bytes);
+                return;
+            }
+
+            REG_TARGET(PYRO_REG_SET_GLOBAL): {
+                PyroInlineCache* cache = &fn->inline_caches[ip->x];
+                PyroMod* module = frame->closure->module;
+
+                if (cache->layout_id == module->layout_id) {
+                    pyro_write_barrier(vm, (PyroObject*)module->members, left);
+                    module->members->values[cache->as.index] = left;
+                    ip++;
+                    REG_DISPATCH();
+                }
+
+                PyroStr* name = PYRO_AS_STR(fn->constants[ip->c]);
+                REG_SAVE_IP();
+
+                PyroValue member_index;
+                if (PyroMap_fast_get(module->all_member_indexes, name, &member_index, vm)) {
+                    cache->layout_id = module->layout_id;
+                    cache->as.index = (size_t)PYRO_AS_I64(member_index);
+                    pyro_write_barrier(vm, (PyroObject*)module->members, left);
+                    module->members->values[PYRO_AS_I64(member_index)] = left;
+                    ip++;
+                    REG_DISPATCH();
+                }
+
+                if (PyroMap_contains(vm->superglobals, pyro_obj(name), vm)) {
+                    pyro_panic(vm, "invalid assignment to superglobal '%s', superglobals cannot be reassigned", name->bytes);
+                    return;
+                }
+
+                pyro_panic(vm, "invalid assignment to undefined variable '%s'", name->bytes);
+                return;
+            }
+
+            REG_TARGET(PYRO_REG_GET_ITERATOR): {
+                PyroValue receiver = fp[ip->a];
+                REG_SAVE_IP();
+                frame->reg_ip = ip + 1;
+
+                PyroValue iter_method = pyro_get_method(vm, receiver, vm->str_dollar_iter);
+                vm->stack_top = fp + ip->a + 1;
+
+                if (PYRO_IS_NATIVE_FN(iter_method)) {
+                    call_native_fn(vm, PYRO_AS_NATIVE_FN(iter_method), 0);
+                    REG_SWITCH_FRAME();
+                }
+
+                if (PYRO_IS_CLOSURE(iter_method)) {
+                    call_closure(vm, PYRO_AS_CLOSURE(iter_method), 0);
+                    REG_SWITCH_FRAME();
+                }
+
+                pyro_panic(vm,
+                    "type '%s' is not iterable",
+                    pyro_get_type_name(vm, receiver)->bytes
+                );
+                return;
+            }
+
+            REG_TARGET(PYRO_REG_GET_NEXT_FROM_ITERATOR): {
+                REG_SAVE_IP();
+
+                if (PYRO_IS_ITER(left)) {
+                    REG_SLOW_RESULT(PyroIter_next(PYRO_AS_ITER(left), vm));
+                }
+
+                frame->reg_ip = ip + 1;
+                PyroValue next_method = pyro_get_method(vm, left, vm->str_dollar_next);
+                fp[ip->a] = left;
+                vm->stack_top = fp + ip->a + 1;
+
+                if (PYRO_IS_NATIVE_FN(next_method)) {
+                    call_native_fn(vm, PYRO_AS_NATIVE_FN(next_method), 0);
+                    REG_SWITCH_FRAME();
+                }
+
+                if (PYRO_IS_CLOSURE(next_method)) {
+                    call_closure(vm, PYRO_AS_CLOSURE(next_method), 0);
+                    REG_SWITCH_FRAME();
+                }
+
+                pyro_panic(vm, "invalid iterator: no :$next() method");
+                return;
+            }
+
+            REG_TARGET(PYRO_REG_CALL):
+                REG_SAVE_IP();
+                frame->reg_ip = ip + 1;
+                vm->stack_top = fp + ip->a + ip->b + 1;
+                call_value(vm, (uint8_t)ip->b);
+                REG_SWITCH_FRAME();
+
+            REG_TARGET(PYRO_REG_CALL_METHOD):
+            REG_TARGET(PYRO_REG_CALL_PUB_METHOD): {
+                PyroValue receiver = fp[ip->a];
+                PyroStr* method_name = PYRO_AS_STR(fn->constants[ip->c]);
+                PyroInlineCache* cache = &fn->inline_caches[ip->x];
+                bool is_pub = ip->opcode == PYRO_REG_CALL_PUB_METHOD;
+                PyroValue method = get_cached_method(vm, receiver, method_name, cache, is_pub);
+
+                REG_SAVE_IP();
+                frame->reg_ip = ip + 1;
+                vm->stack_top = fp + ip->a + ip->b + 1;
+
+                if (PYRO_IS_NATIVE_FN(method)) {
+                    call_native_fn(vm, PYRO_AS_NATIVE_FN(method), (uint8_t)ip->b);
+                    REG_SWITCH_FRAME();
+                }
+
+                if (PYRO_IS_CLOSURE(method)) {
+                    call_closure(vm, PYRO_AS_CLOSURE(method), (uint8_t)ip->b);
+                    REG_SWITCH_FRAME();
+                }
+
+                if (is_pub && !PYRO_IS_NULL(pyro_get_method(vm, receiver, method_name))) {
+                    pyro_panic(vm, "method '%s' is private", method_name->bytes);
+                    return;
+                }
+
+                pyro_panic(vm,
+                    "receiver of type %s has no method '%s'",
+                    pyro_get_type_name(vm, receiver)->bytes,
+                    method_name->bytes
+                );
+                return;
+            }
+
+            REG_TARGET(PYRO_REG_RETURN):
+                REG_SAVE_IP();
+                close_upvalues(vm, fp);
+                vm->stack_top = fp + 1;
+                fp[0] = left;
+                vm->call_stack_count--;
+                REG_SWITCH_FRAME();
+
+            REG_TARGET(PYRO_REG_JUMP):
+                ip = reg_code->code + ip->x;
+                REG_DISPATCH();
+
+            // Backward jumps are safepoints where we check if the garbage collector needs to
+            // run -- every loop passes through one.
+            REG_TARGET(PYRO_REG_LOOP):
+                if (vm->bytes_allocated > vm->next_gc_threshold) {
+                    REG_SAVE_IP();
+                    frame->reg_ip = reg_code->code + ip->x;
+                    pyro_collect_garbage(vm);
+                    return;
+                }
+                ip = reg_code->code + ip->x;
+                REG_DISPATCH();
+
+            REG_TARGET(PYRO_REG_JUMP_IF_FALSE):
+                REG_JUMP_IF(!pyro_is_truthy(left));
+
+            REG_TARGET(PYRO_REG_JUMP_IF_TRUE):
+                REG_JUMP_IF(pyro_is_truthy(left));
+
+            REG_TARGET(PYRO_REG_JUMP_IF_ERR):
+                REG_JUMP_IF(PYRO_IS_ERR(left));
+
+            REG_TARGET(PYRO_REG_JUMP_IF_NOT_ERR):
+                REG_JUMP_IF(!PYRO_IS_ERR(left));
+
+            REG_TARGET(PYRO_REG_JUMP_IF_EQUAL):
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    REG_JUMP_IF(PYRO_AS_I64(left) == PYRO_AS_I64(right));
+                }
+                REG_SAVE_IP();
+                REG_SLOW_JUMP_IF(pyro_op_compare_eq(vm, left, right));
+
+            REG_TARGET(PYRO_REG_JUMP_IF_NOT_EQUAL):
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    REG_JUMP_IF(PYRO_AS_I64(left) != PYRO_AS_I64(right));
+                }
+                REG_SAVE_IP();
+                REG_SLOW_JUMP_IF(!pyro_op_compare_eq(vm, left, right));
+
+            REG_TARGET(PYRO_REG_JUMP_IF_NOT_LESS):
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    REG_JUMP_IF(!(PYRO_AS_I64(left) < PYRO_AS_I64(right)));
+                }
+                REG_SAVE_IP();
+                REG_SLOW_JUMP_IF(!pyro_op_compare_lt(vm, left, right));
+
+            REG_TARGET(PYRO_REG_JUMP_IF_NOT_LESS_EQUAL):
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    REG_JUMP_IF(!(PYRO_AS_I64(left) <= PYRO_AS_I64(right)));
+                }
+                REG_SAVE_IP();
+                REG_SLOW_JUMP_IF(!pyro_op_compare_le(vm, left, right));
+
+            REG_TARGET(PYRO_REG_JUMP_IF_NOT_GREATER):
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    REG_JUMP_IF(!(PYRO_AS_I64(left) > PYRO_AS_I64(right)));
+                }
+                REG_SAVE_IP();
+                REG_SLOW_JUMP_IF(!pyro_op_compare_gt(vm, left, right));
+
+            REG_TARGET(PYRO_REG_JUMP_IF_NOT_GREATER_EQUAL):
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    REG_JUMP_IF(!(PYRO_AS_I64(left) >= PYRO_AS_I64(right)));
+                }
+                REG_SAVE_IP();
+                REG_SLOW_JUMP_IF(!pyro_op_compare_ge(vm, left, right));
+
+            default:
+            #if defined(PYRO_DISPATCH_WITH_COMPUTED_GOTOS)
+            REG_TARGET_INVALID_OPCODE:
+            #endif
+                REG_SAVE_IP();
+                pyro_panic(vm, "invalid register opcode");
+                return;
+        }
+    }
+
+    #undef REG_SAVE_IP
+    #undef REG_RELOAD
+    #undef REG_RESULT
+    #undef REG_SLOW_RESULT
+    #undef REG_JUMP_IF
+    #undef REG_SLOW_JUMP_IF
+    #undef REG_SWITCH_FRAME
+    #undef REG_TARGET
+    #undef REG_DISPATCH
+}
+
+
 static void run(PyroVM* vm) {
     size_t with_stack_count_on_entry = vm->with_stack_count;
     size_t call_stack_count_on_entry = vm->call_stack_count;
     assert(call_stack_count_on_entry >= 1);
 
+    // We cache the current call frame, its instruction pointer, and its constant table in local
+    // variables. The cached values are reloaded at the top of the loop below so any instruction
+    // that can push or pop a call frame, reallocate the call stack, or panic needs to 'break'
+    // out of the switch statement. Simple instructions can use DISPATCH() to jump directly to
+    // the next instruction.
+    PyroCallFrame* frame;
+    uint8_t* ip;
+    PyroValue* constants;
+
     // Reads the next byte from the bytecode as a uint8_t value.
-    #define READ_BYTE() (*frame->ip++)
+    #define READ_BYTE() (*ip++)
 
     // Reads the next two bytes from the bytecode as a big-endian uint16_t value.
-    #define READ_BE_U16() (frame->ip += 2, (uint16_t)((frame->ip[-2] << 8) | frame->ip[-1]))
+    #define READ_BE_U16() (ip += 2, (uint16_t)((ip[-2] << 8) | ip[-1]))
 
     // Reads the next two bytes from the bytecode as an index into the function's constant
     // table. Returns the constant as a [PyroValue].
-    #define READ_CONSTANT() (frame->closure->fn->constants[READ_BE_U16()])
+    #define READ_CONSTANT() (constants[READ_BE_U16()])
 
     // Reads the next two bytes from the bytecode as an index into the function's constant
     // table referencing a string value. Returns the value as a [PyroStr*].
     #define READ_STRING() PYRO_AS_STR(READ_CONSTANT())
 
+    // Reads the next two bytes from the bytecode as an index into the function's array of inline
+    // caches. Returns a [PyroInlineCache*] pointer.
+    #define READ_INLINE_CACHE() (&frame->closure->fn->inline_caches[READ_BE_U16()])
+
+    // Writes the cached instruction pointer back to the call frame. Instructions need to do
+    // this after reading their operands and before doing anything that can panic or call a
+    // function -- the saved pointer is used to look up line numbers for error messages and is
+    // the return address for function calls.
+    #define SAVE_IP() (frame->ip = ip)
+
+    // Pushes a value onto the stack from an instruction that uses DISPATCH(). Pushing can only
+    // panic if the stack needs to grow.
+    #define PUSH(value) \
+        if (vm->stack_top == vm->stack_max) { \
+            SAVE_IP(); \
+        } \
+        if (!pyro_push(vm, value)) { \
+            break; \
+        }
+
+    // Instructions that push or pop call frames are safepoints where we check if the garbage
+    // collector needs to run.
+    #define SAFEPOINT() \
+        if (vm->bytes_allocated > vm->next_gc_threshold) { \
+            pyro_collect_garbage(vm); \
+        } \
+        break
+
+    // Generic arithmetic and comparison instructions quicken themselves: if both operands are
+    // integers or both are floats, the instruction's opcode is rewritten in place to a variant
+    // specialised for that type. The specialised variant guards on its operand types and
+    // rewrites itself back to the generic form (deoptimizes) if the guard fails. A function stops
+    // quickening instructions after PYRO_MAX_DEOPTIMIZATIONS deoptimizations so instructions
+    // that see mixed types don't flip back and forth.
+    #define QUICKEN_NUMERIC_OPERANDS(i64_opcode, f64_opcode) \
+        if (frame->closure->fn->deopt_count < PYRO_MAX_DEOPTIMIZATIONS) { \
+            if (PYRO_IS_I64(vm->stack_top[-2]) && PYRO_IS_I64(vm->stack_top[-1])) { \
+                ip[-1] = (i64_opcode); \
+            } else if (PYRO_IS_F64(vm->stack_top[-2]) && PYRO_IS_F64(vm->stack_top[-1])) { \
+                ip[-1] = (f64_opcode); \
+            } \
+        }
+
+    // Rewrites a quickened instruction back to its generic form.
+    #define DEOPTIMIZE(generic_opcode) \
+        ip[-1] = (generic_opcode); \
+        frame->closure->fn->deopt_count++
+
+    #if defined(PYRO_DISPATCH_WITH_COMPUTED_GOTOS)
+        // Labels each instruction's handler so we can jump directly from one handler to the next
+        // without going back through the switch statement.
+        #define TARGET(opcode) case opcode: TARGET_##opcode
+        #define DISPATCH() goto *dispatch_table[READ_BYTE()]
+
+        static void* dispatch_table[256] = {
+            [0 ... 255] = &&TARGET_INVALID_OPCODE,
+            [PYRO_OPCODE_BINARY_PLUS] = &&TARGET_PYRO_OPCODE_BINARY_PLUS,
+            [PYRO_OPCODE_BINARY_MINUS] = &&TARGET_PYRO_OPCODE_BINARY_MINUS,
+            [PYRO_OPCODE_BINARY_STAR] = &&TARGET_PYRO_OPCODE_BINARY_STAR,
+            [PYRO_OPCODE_BINARY_STAR_STAR] = &&TARGET_PYRO_OPCODE_BINARY_STAR_STAR,
+            [PYRO_OPCODE_BINARY_SLASH] = &&TARGET_PYRO_OPCODE_BINARY_SLASH,
+            [PYRO_OPCODE_BINARY_SLASH_SLASH] = &&TARGET_PYRO_OPCODE_BINARY_SLASH_SLASH,
+            [PYRO_OPCODE_BINARY_PERCENT] = &&TARGET_PYRO_OPCODE_BINARY_PERCENT,
+            [PYRO_OPCODE_BINARY_REM] = &&TARGET_PYRO_OPCODE_BINARY_REM,
+            [PYRO_OPCODE_BINARY_MOD] = &&TARGET_PYRO_OPCODE_BINARY_MOD,
+            [PYRO_OPCODE_BINARY_PLUS_I64] = &&TARGET_PYRO_OPCODE_BINARY_PLUS_I64,
+            [PYRO_OPCODE_BINARY_PLUS_F64] = &&TARGET_PYRO_OPCODE_BINARY_PLUS_F64,
+            [PYRO_OPCODE_BINARY_MINUS_I64] = &&TARGET_PYRO_OPCODE_BINARY_MINUS_I64,
+            [PYRO_OPCODE_BINARY_MINUS_F64] = &&TARGET_PYRO_OPCODE_BINARY_MINUS_F64,
+            [PYRO_OPCODE_BINARY_STAR_I64] = &&TARGET_PYRO_OPCODE_BINARY_STAR_I64,
+            [PYRO_OPCODE_BINARY_STAR_F64] = &&TARGET_PYRO_OPCODE_BINARY_STAR_F64,
+            [PYRO_OPCODE_BINARY_LESS_I64] = &&TARGET_PYRO_OPCODE_BINARY_LESS_I64,
+            [PYRO_OPCODE_BINARY_LESS_F64] = &&TARGET_PYRO_OPCODE_BINARY_LESS_F64,
+            [PYRO_OPCODE_BINARY_LESS_EQUAL_I64] = &&TARGET_PYRO_OPCODE_BINARY_LESS_EQUAL_I64,
+            [PYRO_OPCODE_BINARY_LESS_EQUAL_F64] = &&TARGET_PYRO_OPCODE_BINARY_LESS_EQUAL_F64,
+            [PYRO_OPCODE_BINARY_GREATER_I64] = &&TARGET_PYRO_OPCODE_BINARY_GREATER_I64,
+            [PYRO_OPCODE_BINARY_GREATER_F64] = &&TARGET_PYRO_OPCODE_BINARY_GREATER_F64,
+            [PYRO_OPCODE_BINARY_GREATER_EQUAL_I64] = &&TARGET_PYRO_OPCODE_BINARY_GREATER_EQUAL_I64,
+            [PYRO_OPCODE_BINARY_GREATER_EQUAL_F64] = &&TARGET_PYRO_OPCODE_BINARY_GREATER_EQUAL_F64,
+            [PYRO_OPCODE_BINARY_AMP] = &&TARGET_PYRO_OPCODE_BINARY_AMP,
+            [PYRO_OPCODE_BINARY_BAR] = &&TARGET_PYRO_OPCODE_BINARY_BAR,
+            [PYRO_OPCODE_BINARY_CARET] = &&TARGET_PYRO_OPCODE_BINARY_CARET,
+            [PYRO_OPCODE_BINARY_LESS_LESS] = &&TARGET_PYRO_OPCODE_BINARY_LESS_LESS,
+            [PYRO_OPCODE_BINARY_GREATER_GREATER] = &&TARGET_PYRO_OPCODE_BINARY_GREATER_GREATER,
+            [PYRO_OPCODE_BINARY_EQUAL_EQUAL] = &&TARGET_PYRO_OPCODE_BINARY_EQUAL_EQUAL,
+            [PYRO_OPCODE_BINARY_BANG_EQUAL] = &&TARGET_PYRO_OPCODE_BINARY_BANG_EQUAL,
+            [PYRO_OPCODE_BINARY_GREATER] = &&TARGET_PYRO_OPCODE_BINARY_GREATER,
+            [PYRO_OPCODE_BINARY_GREATER_EQUAL] = &&TARGET_PYRO_OPCODE_BINARY_GREATER_EQUAL,
+            [PYRO_OPCODE_BINARY_LESS] = &&TARGET_PYRO_OPCODE_BINARY_LESS,
+            [PYRO_OPCODE_BINARY_LESS_EQUAL] = &&TARGET_PYRO_OPCODE_BINARY_LESS_EQUAL,
+            [PYRO_OPCODE_BINARY_IN] = &&TARGET_PYRO_OPCODE_BINARY_IN,
+            [PYRO_OPCODE_UNARY_TILDE] = &&TARGET_PYRO_OPCODE_UNARY_TILDE,
+            [PYRO_OPCODE_UNARY_MINUS] = &&TARGET_PYRO_OPCODE_UNARY_MINUS,
+            [PYRO_OPCODE_UNARY_PLUS] = &&TARGET_PYRO_OPCODE_UNARY_PLUS,
+            [PYRO_OPCODE_UNARY_BANG] = &&TARGET_PYRO_OPCODE_UNARY_BANG,
+            [PYRO_OPCODE_DUP] = &&TARGET_PYRO_OPCODE_DUP,
+            [PYRO_OPCODE_DUP_2] = &&TARGET_PYRO_OPCODE_DUP_2,
+            [PYRO_OPCODE_ASSERT_FAILED] = &&TARGET_PYRO_OPCODE_ASSERT_FAILED,
+            [PYRO_OPCODE_CALL_VALUE] = &&TARGET_PYRO_OPCODE_CALL_VALUE,
+            [PYRO_OPCODE_CALL_VALUE_0] = &&TARGET_PYRO_OPCODE_CALL_VALUE_0,
+            [PYRO_OPCODE_CALL_VALUE_1] = &&TARGET_PYRO_OPCODE_CALL_VALUE_1,
+            [PYRO_OPCODE_CALL_VALUE_2] = &&TARGET_PYRO_OPCODE_CALL_VALUE_2,
+            [PYRO_OPCODE_CALL_VALUE_3] = &&TARGET_PYRO_OPCODE_CALL_VALUE_3,
+            [PYRO_OPCODE_CALL_VALUE_4] = &&TARGET_PYRO_OPCODE_CALL_VALUE_4,
+            [PYRO_OPCODE_CALL_VALUE_5] = &&TARGET_PYRO_OPCODE_CALL_VALUE_5,
+            [PYRO_OPCODE_CALL_VALUE_6] = &&TARGET_PYRO_OPCODE_CALL_VALUE_6,
+            [PYRO_OPCODE_CALL_VALUE_7] = &&TARGET_PYRO_OPCODE_CALL_VALUE_7,
+            [PYRO_OPCODE_CALL_VALUE_8] = &&TARGET_PYRO_OPCODE_CALL_VALUE_8,
+            [PYRO_OPCODE_CALL_VALUE_9] = &&TARGET_PYRO_OPCODE_CALL_VALUE_9,
+            [PYRO_OPCODE_CALL_VALUE_WITH_UNPACK] = &&TARGET_PYRO_OPCODE_CALL_VALUE_WITH_UNPACK,
+            [PYRO_OPCODE_MAKE_CLASS] = &&TARGET_PYRO_OPCODE_MAKE_CLASS,
+            [PYRO_OPCODE_INHERIT] = &&TARGET_PYRO_OPCODE_INHERIT,
+            [PYRO_OPCODE_GET_FIELD] = &&TARGET_PYRO_OPCODE_GET_FIELD,
+            [PYRO_OPCODE_GET_PUB_FIELD] = &&TARGET_PYRO_OPCODE_GET_PUB_FIELD,
+            [PYRO_OPCODE_SET_FIELD] = &&TARGET_PYRO_OPCODE_SET_FIELD,
+            [PYRO_OPCODE_SET_PUB_FIELD] = &&TARGET_PYRO_OPCODE_SET_PUB_FIELD,
+            [PYRO_OPCODE_GET_INDEX] = &&TARGET_PYRO_OPCODE_GET_INDEX,
+            [PYRO_OPCODE_SET_INDEX] = &&TARGET_PYRO_OPCODE_SET_INDEX,
+            [PYRO_OPCODE_GET_LOCAL] = &&TARGET_PYRO_OPCODE_GET_LOCAL,
+            [PYRO_OPCODE_GET_LOCAL_0] = &&TARGET_PYRO_OPCODE_GET_LOCAL_0,
+            [PYRO_OPCODE_GET_LOCAL_1] = &&TARGET_PYRO_OPCODE_GET_LOCAL_1,
+            [PYRO_OPCODE_GET_LOCAL_2] = &&TARGET_PYRO_OPCODE_GET_LOCAL_2,
+            [PYRO_OPCODE_GET_LOCAL_3] = &&TARGET_PYRO_OPCODE_GET_LOCAL_3,
+            [PYRO_OPCODE_GET_LOCAL_4] = &&TARGET_PYRO_OPCODE_GET_LOCAL_4,
+            [PYRO_OPCODE_GET_LOCAL_5] = &&TARGET_PYRO_OPCODE_GET_LOCAL_5,
+            [PYRO_OPCODE_GET_LOCAL_6] = &&TARGET_PYRO_OPCODE_GET_LOCAL_6,
+            [PYRO_OPCODE_GET_LOCAL_7] = &&TARGET_PYRO_OPCODE_GET_LOCAL_7,
+            [PYRO_OPCODE_GET_LOCAL_8] = &&TARGET_PYRO_OPCODE_GET_LOCAL_8,
+            [PYRO_OPCODE_GET_LOCAL_9] = &&TARGET_PYRO_OPCODE_GET_LOCAL_9,
+            [PYRO_OPCODE_GET_LOCAL_FIELD] = &&TARGET_PYRO_OPCODE_GET_LOCAL_FIELD,
+            [PYRO_OPCODE_GET_LOCAL_PUB_FIELD] = &&TARGET_PYRO_OPCODE_GET_LOCAL_PUB_FIELD,
+            [PYRO_OPCODE_GET_LOCAL_PLUS_CONSTANT] = &&TARGET_PYRO_OPCODE_GET_LOCAL_PLUS_CONSTANT,
+            [PYRO_OPCODE_GET_GLOBAL] = &&TARGET_PYRO_OPCODE_GET_GLOBAL,
+            [PYRO_OPCODE_SET_GLOBAL] = &&TARGET_PYRO_OPCODE_SET_GLOBAL,
+            [PYRO_OPCODE_LOAD_NULL] = &&TARGET_PYRO_OPCODE_LOAD_NULL,
+            [PYRO_OPCODE_LOAD_TRUE] = &&TARGET_PYRO_OPCODE_LOAD_TRUE,
+            [PYRO_OPCODE_LOAD_FALSE] = &&TARGET_PYRO_OPCODE_LOAD_FALSE,
+            [PYRO_OPCODE_LOAD_CONSTANT] = &&TARGET_PYRO_OPCODE_LOAD_CONSTANT,
+            [PYRO_OPCODE_LOAD_CONSTANT_0] = &&TARGET_PYRO_OPCODE_LOAD_CONSTANT_0,
+            [PYRO_OPCODE_LOAD_CONSTANT_1] = &&TARGET_PYRO_OPCODE_LOAD_CONSTANT_1,
+            [PYRO_OPCODE_LOAD_CONSTANT_2] = &&TARGET_PYRO_OPCODE_LOAD_CONSTANT_2,
+            [PYRO_OPCODE_LOAD_CONSTANT_3] = &&TARGET_PYRO_OPCODE_LOAD_CONSTANT_3,
+            [PYRO_OPCODE_LOAD_CONSTANT_4] = &&TARGET_PYRO_OPCODE_LOAD_CONSTANT_4,
+            [PYRO_OPCODE_LOAD_CONSTANT_5] = &&TARGET_PYRO_OPCODE_LOAD_CONSTANT_5,
+            [PYRO_OPCODE_LOAD_CONSTANT_6] = &&TARGET_PYRO_OPCODE_LOAD_CONSTANT_6,
+            [PYRO_OPCODE_LOAD_CONSTANT_7] = &&TARGET_PYRO_OPCODE_LOAD_CONSTANT_7,
+            [PYRO_OPCODE_LOAD_CONSTANT_8] = &&TARGET_PYRO_OPCODE_LOAD_CONSTANT_8,
+            [PYRO_OPCODE_LOAD_CONSTANT_9] = &&TARGET_PYRO_OPCODE_LOAD_CONSTANT_9,
+            [PYRO_OPCODE_LOAD_I64_0] = &&TARGET_PYRO_OPCODE_LOAD_I64_0,
+            [PYRO_OPCODE_LOAD_I64_1] = &&TARGET_PYRO_OPCODE_LOAD_I64_1,
+            [PYRO_OPCODE_LOAD_I64_2] = &&TARGET_PYRO_OPCODE_LOAD_I64_2,
+            [PYRO_OPCODE_LOAD_I64_3] = &&TARGET_PYRO_OPCODE_LOAD_I64_3,
+            [PYRO_OPCODE_LOAD_I64_4] = &&TARGET_PYRO_OPCODE_LOAD_I64_4,
+            [PYRO_OPCODE_LOAD_I64_5] = &&TARGET_PYRO_OPCODE_LOAD_I64_5,
+            [PYRO_OPCODE_LOAD_I64_6] = &&TARGET_PYRO_OPCODE_LOAD_I64_6,
+            [PYRO_OPCODE_LOAD_I64_7] = &&TARGET_PYRO_OPCODE_LOAD_I64_7,
+            [PYRO_OPCODE_LOAD_I64_8] = &&TARGET_PYRO_OPCODE_LOAD_I64_8,
+            [PYRO_OPCODE_LOAD_I64_9] = &&TARGET_PYRO_OPCODE_LOAD_I64_9,
+            [PYRO_OPCODE_STRINGIFY] = &&TARGET_PYRO_OPCODE_STRINGIFY,
+            [PYRO_OPCODE_FORMAT] = &&TARGET_PYRO_OPCODE_FORMAT,
+            [PYRO_OPCODE_CONCAT_STRINGS] = &&TARGET_PYRO_OPCODE_CONCAT_STRINGS,
+            [PYRO_OPCODE_POP] = &&TARGET_PYRO_OPCODE_POP,
+            [PYRO_OPCODE_GET_MEMBER] = &&TARGET_PYRO_OPCODE_GET_MEMBER,
+            [PYRO_OPCODE_GET_METHOD] = &&TARGET_PYRO_OPCODE_GET_METHOD,
+            [PYRO_OPCODE_GET_PUB_METHOD] = &&TARGET_PYRO_OPCODE_GET_PUB_METHOD,
+            [PYRO_OPCODE_GET_SUPER_METHOD] = &&TARGET_PYRO_OPCODE_GET_SUPER_METHOD,
+            [PYRO_OPCODE_GET_ITERATOR] = &&TARGET_PYRO_OPCODE_GET_ITERATOR,
+            [PYRO_OPCODE_GET_NEXT_FROM_ITERATOR] = &&TARGET_PYRO_OPCODE_GET_NEXT_FROM_ITERATOR,
+            [PYRO_OPCODE_CALL_METHOD] = &&TARGET_PYRO_OPCODE_CALL_METHOD,
+            [PYRO_OPCODE_CALL_PUB_METHOD] = &&TARGET_PYRO_OPCODE_CALL_PUB_METHOD,
+            [PYRO_OPCODE_CALL_SUPER_METHOD] = &&TARGET_PYRO_OPCODE_CALL_SUPER_METHOD,
+            [PYRO_OPCODE_CALL_METHOD_WITH_UNPACK] = &&TARGET_PYRO_OPCODE_CALL_METHOD_WITH_UNPACK,
+            [PYRO_OPCODE_CALL_PUB_METHOD_WITH_UNPACK] = &&TARGET_PYRO_OPCODE_CALL_PUB_METHOD_WITH_UNPACK,
+            [PYRO_OPCODE_CALL_SUPER_METHOD_WITH_UNPACK] = &&TARGET_PYRO_OPCODE_CALL_SUPER_METHOD_WITH_UNPACK,
+            [PYRO_OPCODE_JUMP] = &&TARGET_PYRO_OPCODE_JUMP,
+            [PYRO_OPCODE_JUMP_BACK] = &&TARGET_PYRO_OPCODE_JUMP_BACK,
+            [PYRO_OPCODE_JUMP_IF_TRUE] = &&TARGET_PYRO_OPCODE_JUMP_IF_TRUE,
+            [PYRO_OPCODE_JUMP_IF_FALSE] = &&TARGET_PYRO_OPCODE_JUMP_IF_FALSE,
+            [PYRO_OPCODE_POP_JUMP_IF_FALSE] = &&TARGET_PYRO_OPCODE_POP_JUMP_IF_FALSE,
+            [PYRO_OPCODE_POP_SET_LOCAL] = &&TARGET_PYRO_OPCODE_POP_SET_LOCAL,
+            [PYRO_OPCODE_JUMP_IF_EQUAL] = &&TARGET_PYRO_OPCODE_JUMP_IF_EQUAL,
+            [PYRO_OPCODE_JUMP_IF_NOT_EQUAL] = &&TARGET_PYRO_OPCODE_JUMP_IF_NOT_EQUAL,
+            [PYRO_OPCODE_JUMP_IF_NOT_GREATER] = &&TARGET_PYRO_OPCODE_JUMP_IF_NOT_GREATER,
+            [PYRO_OPCODE_JUMP_IF_NOT_GREATER_EQUAL] = &&TARGET_PYRO_OPCODE_JUMP_IF_NOT_GREATER_EQUAL,
+            [PYRO_OPCODE_JUMP_IF_NOT_LESS] = &&TARGET_PYRO_OPCODE_JUMP_IF_NOT_LESS,
+            [PYRO_OPCODE_JUMP_IF_NOT_LESS_EQUAL] = &&TARGET_PYRO_OPCODE_JUMP_IF_NOT_LESS_EQUAL,
+            [PYRO_OPCODE_JUMP_IF_ERR] = &&TARGET_PYRO_OPCODE_JUMP_IF_ERR,
+            [PYRO_OPCODE_JUMP_IF_NOT_ERR] = &&TARGET_PYRO_OPCODE_JUMP_IF_NOT_ERR,
+            [PYRO_OPCODE_JUMP_IF_NOT_NULL] = &&TARGET_PYRO_OPCODE_JUMP_IF_NOT_NULL,
+            [PYRO_OPCODE_SET_LOCAL] = &&TARGET_PYRO_OPCODE_SET_LOCAL,
+            [PYRO_OPCODE_SET_LOCAL_0] = &&TARGET_PYRO_OPCODE_SET_LOCAL_0,
+            [PYRO_OPCODE_SET_LOCAL_1] = &&TARGET_PYRO_OPCODE_SET_LOCAL_1,
+            [PYRO_OPCODE_SET_LOCAL_2] = &&TARGET_PYRO_OPCODE_SET_LOCAL_2,
+            [PYRO_OPCODE_SET_LOCAL_3] = &&TARGET_PYRO_OPCODE_SET_LOCAL_3,
+            [PYRO_OPCODE_SET_LOCAL_4] = &&TARGET_PYRO_OPCODE_SET_LOCAL_4,
+            [PYRO_OPCODE_SET_LOCAL_5] = &&TARGET_PYRO_OPCODE_SET_LOCAL_5,
+            [PYRO_OPCODE_SET_LOCAL_6] = &&TARGET_PYRO_OPCODE_SET_LOCAL_6,
+            [PYRO_OPCODE_SET_LOCAL_7] = &&TARGET_PYRO_OPCODE_SET_LOCAL_7,
+            [PYRO_OPCODE_SET_LOCAL_8] = &&TARGET_PYRO_OPCODE_SET_LOCAL_8,
+            [PYRO_OPCODE_SET_LOCAL_9] = &&TARGET_PYRO_OPCODE_SET_LOCAL_9,
+            [PYRO_OPCODE_MAKE_MAP] = &&TARGET_PYRO_OPCODE_MAKE_MAP,
+            [PYRO_OPCODE_MAKE_SET] = &&TARGET_PYRO_OPCODE_MAKE_SET,
+            [PYRO_OPCODE_MAKE_TUP] = &&TARGET_PYRO_OPCODE_MAKE_TUP,
+            [PYRO_OPCODE_MAKE_VEC] = &&TARGET_PYRO_OPCODE_MAKE_VEC,
+            [PYRO_OPCODE_RETURN] = &&TARGET_PYRO_OPCODE_RETURN,
+            [PYRO_OPCODE_RETURN_TUPLE] = &&TARGET_PYRO_OPCODE_RETURN_TUPLE,
+            [PYRO_OPCODE_DEFINE_PRI_METHOD] = &&TARGET_PYRO_OPCODE_DEFINE_PRI_METHOD,
+            [PYRO_OPCODE_DEFINE_PUB_METHOD] = &&TARGET_PYRO_OPCODE_DEFINE_PUB_METHOD,
+            [PYRO_OPCODE_DEFINE_STATIC_METHOD] = &&TARGET_PYRO_OPCODE_DEFINE_STATIC_METHOD,
+            [PYRO_OPCODE_DEFINE_PRI_FIELD] = &&TARGET_PYRO_OPCODE_DEFINE_PRI_FIELD,
+            [PYRO_OPCODE_DEFINE_PUB_FIELD] = &&TARGET_PYRO_OPCODE_DEFINE_PUB_FIELD,
+            [PYRO_OPCODE_DEFINE_STATIC_FIELD] = &&TARGET_PYRO_OPCODE_DEFINE_STATIC_FIELD,
+            [PYRO_OPCODE_DEFINE_PRI_GLOBAL] = &&TARGET_PYRO_OPCODE_DEFINE_PRI_GLOBAL,
+            [PYRO_OPCODE_DEFINE_PUB_GLOBAL] = &&TARGET_PYRO_OPCODE_DEFINE_PUB_GLOBAL,
+            [PYRO_OPCODE_DEFINE_PRI_GLOBALS] = &&TARGET_PYRO_OPCODE_DEFINE_PRI_GLOBALS,
+            [PYRO_OPCODE_DEFINE_PUB_GLOBALS] = &&TARGET_PYRO_OPCODE_DEFINE_PUB_GLOBALS,
+            [PYRO_OPCODE_ECHO] = &&TARGET_PYRO_OPCODE_ECHO,
+            [PYRO_OPCODE_POP_ECHO_IN_REPL] = &&TARGET_PYRO_OPCODE_POP_ECHO_IN_REPL,
+            [PYRO_OPCODE_UNPACK] = &&TARGET_PYRO_OPCODE_UNPACK,
+            [PYRO_OPCODE_IMPORT_MODULE] = &&TARGET_PYRO_OPCODE_IMPORT_MODULE,
+            [PYRO_OPCODE_IMPORT_NAMED_MEMBERS] = &&TARGET_PYRO_OPCODE_IMPORT_NAMED_MEMBERS,
+            [PYRO_OPCODE_TRY] = &&TARGET_PYRO_OPCODE_TRY,
+            [PYRO_OPCODE_MAKE_CLOSURE] = &&TARGET_PYRO_OPCODE_MAKE_CLOSURE,
+            [PYRO_OPCODE_MAKE_CLOSURE_WITH_DEFAULT_ARGS] = &&TARGET_PYRO_OPCODE_MAKE_CLOSURE_WITH_DEFAULT_ARGS,
+            [PYRO_OPCODE_CLOSE_UPVALUE] = &&TARGET_PYRO_OPCODE_CLOSE_UPVALUE,
+            [PYRO_OPCODE_GET_UPVALUE] = &&TARGET_PYRO_OPCODE_GET_UPVALUE,
+            [PYRO_OPCODE_SET_UPVALUE] = &&TARGET_PYRO_OPCODE_SET_UPVALUE,
+            [PYRO_OPCODE_START_WITH] = &&TARGET_PYRO_OPCODE_START_WITH,
+            [PYRO_OPCODE_END_WITH] = &&TARGET_PYRO_OPCODE_END_WITH,
+            [PYRO_OPCODE_I64_ADD] = &&TARGET_PYRO_OPCODE_I64_ADD,
+            [PYRO_OPCODE_MAKE_ENUM] = &&TARGET_PYRO_OPCODE_MAKE_ENUM,
+            [PYRO_OPCODE_IS_ERR] = &&TARGET_PYRO_OPCODE_IS_ERR,
+            [PYRO_OPCODE_IS_STR] = &&TARGET_PYRO_OPCODE_IS_STR,
+            [PYRO_OPCODE_IS_RUNE] = &&TARGET_PYRO_OPCODE_IS_RUNE,
+            [PYRO_OPCODE_IS_I64] = &&TARGET_PYRO_OPCODE_IS_I64,
+            [PYRO_OPCODE_IS_F64] = &&TARGET_PYRO_OPCODE_IS_F64,
+            [PYRO_OPCODE_MAKE_STR] = &&TARGET_PYRO_OPCODE_MAKE_STR,
+            [PYRO_OPCODE_CALL_COUNT] = &&TARGET_PYRO_OPCODE_CALL_COUNT,
+            [PYRO_OPCODE_MAKE_OBJECT] = &&TARGET_PYRO_OPCODE_MAKE_OBJECT,
+        };
+    #elif defined(PYRO_DEBUG)
+        #define TARGET(opcode) case opcode
+        #define DISPATCH() SAVE_IP(); break
+    #else
+        #define TARGET(opcode) case opcode
+        #define DISPATCH() goto dispatch
+    #endif
+
     for (;;) {
         if (vm->halt_flag || vm->call_stack_count < call_stack_count_on_entry) {
             break;
         }
 
         // The last instruction may have changed the frame count or (this can lead to nasty
-        // bugs) forced a reallocation of the frame stack so reset the frame pointer for
-        // every iteration.
-        PyroCallFrame* frame = &vm->call_stack[vm->call_stack_count - 1];
+        // bugs) forced a reallocation of the frame stack so reload the frame pointer.
+        frame = &vm->call_stack[vm->call_stack_count - 1];
+
+        // Frames running register code hand control back to us for calls, returns, and
+        // garbage collection.
+        if (frame->reg_ip) {
+            run_register_code(vm, call_stack_count_on_entry);
+            continue;
+        }
+
+        ip = frame->ip;
+        constants = frame->closure->fn->constants;
 
         #ifdef PYRO_DEBUG_STRESS_GARBAGE_COLLECTION
             pyro_collect_garbage(vm);
             if (vm->halt_flag) {
                 break;
             }
-        #else
-            if (vm->bytes_allocated > vm->next_gc_threshold) {
-                pyro_collect_garbage(vm);
-                if (vm->halt_flag) {
-                    break;
-                }
-            }
         #endif
 
         #ifdef PYRO_DEBUG
@@ -479,11 +1423,16 @@ static void run(PyroVM* vm) {
             }
         #endif
 
+        #if !defined(PYRO_DISPATCH_WITH_COMPUTED_GOTOS) && !defined(PYRO_DEBUG)
+            dispatch:
+        #endif
         switch (READ_BYTE()) {
             // Implements the expression: [left_operand + right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_PLUS: {
+            TARGET(PYRO_OPCODE_BINARY_PLUS): {
+                QUICKEN_NUMERIC_OPERANDS(PYRO_OPCODE_BINARY_PLUS_I64, PYRO_OPCODE_BINARY_PLUS_F64);
+                SAVE_IP();
                 PyroValue result = pyro_op_binary_plus(
                     vm,
                     vm->stack_top[-2],
@@ -497,7 +1446,9 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand - right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_MINUS: {
+            TARGET(PYRO_OPCODE_BINARY_MINUS): {
+                QUICKEN_NUMERIC_OPERANDS(PYRO_OPCODE_BINARY_MINUS_I64, PYRO_OPCODE_BINARY_MINUS_F64);
+                SAVE_IP();
                 PyroValue result = pyro_op_binary_minus(
                     vm,
                     vm->stack_top[-2],
@@ -511,7 +1462,9 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand * right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_STAR: {
+            TARGET(PYRO_OPCODE_BINARY_STAR): {
+                QUICKEN_NUMERIC_OPERANDS(PYRO_OPCODE_BINARY_STAR_I64, PYRO_OPCODE_BINARY_STAR_F64);
+                SAVE_IP();
                 PyroValue result = pyro_op_binary_star(
                     vm,
                     vm->stack_top[-2],
@@ -525,7 +1478,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand ** right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_STAR_STAR: {
+            TARGET(PYRO_OPCODE_BINARY_STAR_STAR): {
+                SAVE_IP();
                 PyroValue result = pyro_op_binary_star_star(
                     vm,
                     vm->stack_top[-2],
@@ -539,7 +1493,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand / right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_SLASH: {
+            TARGET(PYRO_OPCODE_BINARY_SLASH): {
+                SAVE_IP();
                 PyroValue result = pyro_op_binary_slash(
                     vm,
                     vm->stack_top[-2],
@@ -553,7 +1508,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand // right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_SLASH_SLASH: {
+            TARGET(PYRO_OPCODE_BINARY_SLASH_SLASH): {
+                SAVE_IP();
                 PyroValue result = pyro_op_binary_slash_slash(
                     vm,
                     vm->stack_top[-2],
@@ -567,7 +1523,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand % right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_PERCENT: {
+            TARGET(PYRO_OPCODE_BINARY_PERCENT): {
+                SAVE_IP();
                 PyroValue result = pyro_op_binary_percent(
                     vm,
                     vm->stack_top[-2],
@@ -581,7 +1538,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand rem right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_REM: {
+            TARGET(PYRO_OPCODE_BINARY_REM): {
+                SAVE_IP();
                 PyroValue result = pyro_op_binary_rem(
                     vm,
                     vm->stack_top[-2],
@@ -595,7 +1553,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand mod right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_MOD: {
+            TARGET(PYRO_OPCODE_BINARY_MOD): {
+                SAVE_IP();
                 PyroValue result = pyro_op_binary_mod(
                     vm,
                     vm->stack_top[-2],
@@ -609,7 +1568,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand & right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_AMP: {
+            TARGET(PYRO_OPCODE_BINARY_AMP): {
+                SAVE_IP();
                 PyroValue result = pyro_op_binary_amp(
                     vm,
                     vm->stack_top[-2],
@@ -623,7 +1583,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand | right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_BAR: {
+            TARGET(PYRO_OPCODE_BINARY_BAR): {
+                SAVE_IP();
                 PyroValue result = pyro_op_binary_bar(
                     vm,
                     vm->stack_top[-2],
@@ -637,7 +1598,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand ^ right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_CARET: {
+            TARGET(PYRO_OPCODE_BINARY_CARET): {
+                SAVE_IP();
                 PyroValue result = pyro_op_binary_caret(
                     vm,
                     vm->stack_top[-2],
@@ -651,7 +1613,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand << right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_LESS_LESS: {
+            TARGET(PYRO_OPCODE_BINARY_LESS_LESS): {
+                SAVE_IP();
                 PyroValue result = pyro_op_binary_less_less(
                     vm,
                     vm->stack_top[-2],
@@ -666,7 +1629,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand >> right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_GREATER_GREATER: {
+            TARGET(PYRO_OPCODE_BINARY_GREATER_GREATER): {
+                SAVE_IP();
                 PyroValue result = pyro_op_binary_greater_greater(
                     vm,
                     vm->stack_top[-2],
@@ -680,7 +1644,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand == right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_EQUAL_EQUAL: {
+            TARGET(PYRO_OPCODE_BINARY_EQUAL_EQUAL): {
+                SAVE_IP();
                 PyroValue result = pyro_bool(
                     pyro_op_compare_eq(
                         vm,
@@ -696,7 +1661,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand != right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_BANG_EQUAL: {
+            TARGET(PYRO_OPCODE_BINARY_BANG_EQUAL): {
+                SAVE_IP();
                 PyroValue result = pyro_bool(
                     !pyro_op_compare_eq(
                         vm,
@@ -712,7 +1678,9 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand > right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_GREATER: {
+            TARGET(PYRO_OPCODE_BINARY_GREATER): {
+                QUICKEN_NUMERIC_OPERANDS(PYRO_OPCODE_BINARY_GREATER_I64, PYRO_OPCODE_BINARY_GREATER_F64);
+                SAVE_IP();
                 PyroValue result = pyro_bool(
                     pyro_op_compare_gt(
                         vm,
@@ -728,7 +1696,9 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand >= right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_GREATER_EQUAL: {
+            TARGET(PYRO_OPCODE_BINARY_GREATER_EQUAL): {
+                QUICKEN_NUMERIC_OPERANDS(PYRO_OPCODE_BINARY_GREATER_EQUAL_I64, PYRO_OPCODE_BINARY_GREATER_EQUAL_F64);
+                SAVE_IP();
                 PyroValue result = pyro_bool(
                     pyro_op_compare_ge(
                         vm,
@@ -744,7 +1714,9 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand < right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_LESS: {
+            TARGET(PYRO_OPCODE_BINARY_LESS): {
+                QUICKEN_NUMERIC_OPERANDS(PYRO_OPCODE_BINARY_LESS_I64, PYRO_OPCODE_BINARY_LESS_F64);
+                SAVE_IP();
                 PyroValue result = pyro_bool(
                     pyro_op_compare_lt(
                         vm,
@@ -760,7 +1732,9 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand <= right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_LESS_EQUAL: {
+            TARGET(PYRO_OPCODE_BINARY_LESS_EQUAL): {
+                QUICKEN_NUMERIC_OPERANDS(PYRO_OPCODE_BINARY_LESS_EQUAL_I64, PYRO_OPCODE_BINARY_LESS_EQUAL_F64);
+                SAVE_IP();
                 PyroValue result = pyro_bool(
                     pyro_op_compare_le(
                         vm,
@@ -773,10 +1747,317 @@ static void run(PyroVM* vm) {
                 break;
             }
 
+            // Quickened form of BINARY_PLUS for integer operands.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ][ result ]
+            TARGET(PYRO_OPCODE_BINARY_PLUS_I64): {
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    int64_t result;
+                    if (!pyro_ckd_add(&result, PYRO_AS_I64(left), PYRO_AS_I64(right))) {
+                        vm->stack_top[-2] = pyro_i64(result);
+                        vm->stack_top--;
+                        DISPATCH();
+                    }
+                } else {
+                    DEOPTIMIZE(PYRO_OPCODE_BINARY_PLUS);
+                }
+
+                SAVE_IP();
+                PyroValue result = pyro_op_binary_plus(vm, left, right);
+                vm->stack_top[-2] = result;
+                vm->stack_top--;
+                break;
+            }
+
+            // Quickened form of BINARY_PLUS for float operands.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ][ result ]
+            TARGET(PYRO_OPCODE_BINARY_PLUS_F64): {
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_F64(left) && PYRO_IS_F64(right)) {
+                    vm->stack_top[-2] = pyro_f64(PYRO_AS_F64(left) + PYRO_AS_F64(right));
+                    vm->stack_top--;
+                    DISPATCH();
+                }
+
+                DEOPTIMIZE(PYRO_OPCODE_BINARY_PLUS);
+                SAVE_IP();
+                PyroValue result = pyro_op_binary_plus(vm, left, right);
+                vm->stack_top[-2] = result;
+                vm->stack_top--;
+                break;
+            }
+
+            // Quickened form of BINARY_MINUS for integer operands.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ][ result ]
+            TARGET(PYRO_OPCODE_BINARY_MINUS_I64): {
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    int64_t result;
+                    if (!pyro_ckd_sub(&result, PYRO_AS_I64(left), PYRO_AS_I64(right))) {
+                        vm->stack_top[-2] = pyro_i64(result);
+                        vm->stack_top--;
+                        DISPATCH();
+                    }
+                } else {
+                    DEOPTIMIZE(PYRO_OPCODE_BINARY_MINUS);
+                }
+
+                SAVE_IP();
+                PyroValue result = pyro_op_binary_minus(vm, left, right);
+                vm->stack_top[-2] = result;
+                vm->stack_top--;
+                break;
+            }
+
+            // Quickened form of BINARY_MINUS for float operands.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ][ result ]
+            TARGET(PYRO_OPCODE_BINARY_MINUS_F64): {
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_F64(left) && PYRO_IS_F64(right)) {
+                    vm->stack_top[-2] = pyro_f64(PYRO_AS_F64(left) - PYRO_AS_F64(right));
+                    vm->stack_top--;
+                    DISPATCH();
+                }
+
+                DEOPTIMIZE(PYRO_OPCODE_BINARY_MINUS);
+                SAVE_IP();
+                PyroValue result = pyro_op_binary_minus(vm, left, right);
+                vm->stack_top[-2] = result;
+                vm->stack_top--;
+                break;
+            }
+
+            // Quickened form of BINARY_STAR for integer operands.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ][ result ]
+            TARGET(PYRO_OPCODE_BINARY_STAR_I64): {
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    int64_t result;
+                    if (!pyro_ckd_mul(&result, PYRO_AS_I64(left), PYRO_AS_I64(right))) {
+                        vm->stack_top[-2] = pyro_i64(result);
+                        vm->stack_top--;
+                        DISPATCH();
+                    }
+                } else {
+                    DEOPTIMIZE(PYRO_OPCODE_BINARY_STAR);
+                }
+
+                SAVE_IP();
+                PyroValue result = pyro_op_binary_star(vm, left, right);
+                vm->stack_top[-2] = result;
+                vm->stack_top--;
+                break;
+            }
+
+            // Quickened form of BINARY_STAR for float operands.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ][ result ]
+            TARGET(PYRO_OPCODE_BINARY_STAR_F64): {
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_F64(left) && PYRO_IS_F64(right)) {
+                    vm->stack_top[-2] = pyro_f64(PYRO_AS_F64(left) * PYRO_AS_F64(right));
+                    vm->stack_top--;
+                    DISPATCH();
+                }
+
+                DEOPTIMIZE(PYRO_OPCODE_BINARY_STAR);
+                SAVE_IP();
+                PyroValue result = pyro_op_binary_star(vm, left, right);
+                vm->stack_top[-2] = result;
+                vm->stack_top--;
+                break;
+            }
+
+            // Quickened form of BINARY_LESS for integer operands.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ][ result ]
+            TARGET(PYRO_OPCODE_BINARY_LESS_I64): {
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    vm->stack_top[-2] = pyro_bool(PYRO_AS_I64(left) < PYRO_AS_I64(right));
+                    vm->stack_top--;
+                    DISPATCH();
+                }
+
+                DEOPTIMIZE(PYRO_OPCODE_BINARY_LESS);
+                SAVE_IP();
+                PyroValue result = pyro_bool(pyro_op_compare_lt(vm, left, right));
+                vm->stack_top[-2] = result;
+                vm->stack_top--;
+                break;
+            }
+
+            // Quickened form of BINARY_LESS for float operands.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ][ result ]
+            TARGET(PYRO_OPCODE_BINARY_LESS_F64): {
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_F64(left) && PYRO_IS_F64(right)) {
+                    vm->stack_top[-2] = pyro_bool(PYRO_AS_F64(left) < PYRO_AS_F64(right));
+                    vm->stack_top--;
+                    DISPATCH();
+                }
+
+                DEOPTIMIZE(PYRO_OPCODE_BINARY_LESS);
+                SAVE_IP();
+                PyroValue result = pyro_bool(pyro_op_compare_lt(vm, left, right));
+                vm->stack_top[-2] = result;
+                vm->stack_top--;
+                break;
+            }
+
+            // Quickened form of BINARY_LESS_EQUAL for integer operands.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ][ result ]
+            TARGET(PYRO_OPCODE_BINARY_LESS_EQUAL_I64): {
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    vm->stack_top[-2] = pyro_bool(PYRO_AS_I64(left) <= PYRO_AS_I64(right));
+                    vm->stack_top--;
+                    DISPATCH();
+                }
+
+                DEOPTIMIZE(PYRO_OPCODE_BINARY_LESS_EQUAL);
+                SAVE_IP();
+                PyroValue result = pyro_bool(pyro_op_compare_le(vm, left, right));
+                vm->stack_top[-2] = result;
+                vm->stack_top--;
+                break;
+            }
+
+            // Quickened form of BINARY_LESS_EQUAL for float operands.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ][ result ]
+            TARGET(PYRO_OPCODE_BINARY_LESS_EQUAL_F64): {
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_F64(left) && PYRO_IS_F64(right)) {
+                    vm->stack_top[-2] = pyro_bool(PYRO_AS_F64(left) <= PYRO_AS_F64(right));
+                    vm->stack_top--;
+                    DISPATCH();
+                }
+
+                DEOPTIMIZE(PYRO_OPCODE_BINARY_LESS_EQUAL);
+                SAVE_IP();
+                PyroValue result = pyro_bool(pyro_op_compare_le(vm, left, right));
+                vm->stack_top[-2] = result;
+                vm->stack_top--;
+                break;
+            }
+
+            // Quickened form of BINARY_GREATER for integer operands.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ][ result ]
+            TARGET(PYRO_OPCODE_BINARY_GREATER_I64): {
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    vm->stack_top[-2] = pyro_bool(PYRO_AS_I64(left) > PYRO_AS_I64(right));
+                    vm->stack_top--;
+                    DISPATCH();
+                }
+
+                DEOPTIMIZE(PYRO_OPCODE_BINARY_GREATER);
+                SAVE_IP();
+                PyroValue result = pyro_bool(pyro_op_compare_gt(vm, left, right));
+                vm->stack_top[-2] = result;
+                vm->stack_top--;
+                break;
+            }
+
+            // Quickened form of BINARY_GREATER for float operands.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ][ result ]
+            TARGET(PYRO_OPCODE_BINARY_GREATER_F64): {
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_F64(left) && PYRO_IS_F64(right)) {
+                    vm->stack_top[-2] = pyro_bool(PYRO_AS_F64(left) > PYRO_AS_F64(right));
+                    vm->stack_top--;
+                    DISPATCH();
+                }
+
+                DEOPTIMIZE(PYRO_OPCODE_BINARY_GREATER);
+                SAVE_IP();
+                PyroValue result = pyro_bool(pyro_op_compare_gt(vm, left, right));
+                vm->stack_top[-2] = result;
+                vm->stack_top--;
+                break;
+            }
+
+            // Quickened form of BINARY_GREATER_EQUAL for integer operands.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ][ result ]
+            TARGET(PYRO_OPCODE_BINARY_GREATER_EQUAL_I64): {
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    vm->stack_top[-2] = pyro_bool(PYRO_AS_I64(left) >= PYRO_AS_I64(right));
+                    vm->stack_top--;
+                    DISPATCH();
+                }
+
+                DEOPTIMIZE(PYRO_OPCODE_BINARY_GREATER_EQUAL);
+                SAVE_IP();
+                PyroValue result = pyro_bool(pyro_op_compare_ge(vm, left, right));
+                vm->stack_top[-2] = result;
+                vm->stack_top--;
+                break;
+            }
+
+            // Quickened form of BINARY_GREATER_EQUAL for float operands.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ][ result ]
+            TARGET(PYRO_OPCODE_BINARY_GREATER_EQUAL_F64): {
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_F64(left) && PYRO_IS_F64(right)) {
+                    vm->stack_top[-2] = pyro_bool(PYRO_AS_F64(left) >= PYRO_AS_F64(right));
+                    vm->stack_top--;
+                    DISPATCH();
+                }
+
+                DEOPTIMIZE(PYRO_OPCODE_BINARY_GREATER_EQUAL);
+                SAVE_IP();
+                PyroValue result = pyro_bool(pyro_op_compare_ge(vm, left, right));
+                vm->stack_top[-2] = result;
+                vm->stack_top--;
+                break;
+            }
+
             // Implements the expression: [needle in haystack].
             // Before: [ ... ][ needle ][ haystack ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_BINARY_IN: {
+            TARGET(PYRO_OPCODE_BINARY_IN): {
+                SAVE_IP();
                 PyroValue method = pyro_get_method(vm, vm->stack_top[-1], vm->str_dollar_contains);
                 if (PYRO_IS_NULL(method)) {
                     pyro_panic(vm,
@@ -804,7 +2085,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [~operand].
             // Before: [ ... ][ operand ]
             // After:  [ ... ][ ~operand ]
-            case PYRO_OPCODE_UNARY_TILDE: {
+            TARGET(PYRO_OPCODE_UNARY_TILDE): {
+                SAVE_IP();
                 PyroValue result = pyro_op_unary_tilde(vm, vm->stack_top[-1]);
                 vm->stack_top[-1] = result;
                 break;
@@ -813,7 +2095,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [-operand].
             // Before: [ ... ][ operand ]
             // After:  [ ... ][ -operand ]
-            case PYRO_OPCODE_UNARY_MINUS: {
+            TARGET(PYRO_OPCODE_UNARY_MINUS): {
+                SAVE_IP();
                 PyroValue result = pyro_op_unary_minus(vm, vm->stack_top[-1]);
                 vm->stack_top[-1] = result;
                 break;
@@ -822,7 +2105,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [+operand].
             // Before: [ ... ][ operand ]
             // After:  [ ... ][ +operand ]
-            case PYRO_OPCODE_UNARY_PLUS: {
+            TARGET(PYRO_OPCODE_UNARY_PLUS): {
+                SAVE_IP();
                 PyroValue result = pyro_op_unary_plus(vm, vm->stack_top[-1]);
                 vm->stack_top[-1] = result;
                 break;
@@ -831,33 +2115,34 @@ static void run(PyroVM* vm) {
             // Implements the expression: [!operand].
             // Before: [ ... ][ operand ]
             // After:  [ ... ][ !operand ]
-            case PYRO_OPCODE_UNARY_BANG: {
+            TARGET(PYRO_OPCODE_UNARY_BANG): {
                 PyroValue result = pyro_bool(!pyro_is_truthy(vm->stack_top[-1]));
                 vm->stack_top[-1] = result;
-                break;
+                DISPATCH();
             }
 
             // Duplicates the top item on the stack.
             // Before: [ ... ][ value ]
             // After:  [ ... ][ value ][ value ]
-            case PYRO_OPCODE_DUP: {
-                pyro_push(vm, vm->stack_top[-1]);
-                break;
+            TARGET(PYRO_OPCODE_DUP): {
+                PUSH(vm->stack_top[-1]);
+                DISPATCH();
             }
 
             // Duplicates the top 2 items on the stack.
             // Before: [ ... ][ value1 ][ value2 ]
             // After:  [ ... ][ value1 ][ value2 ][ value1 ][ value2 ]
-            case PYRO_OPCODE_DUP_2: {
-                pyro_push(vm, vm->stack_top[-2]);
-                pyro_push(vm, vm->stack_top[-2]);
-                break;
+            TARGET(PYRO_OPCODE_DUP_2): {
+                PUSH(vm->stack_top[-2]);
+                PUSH(vm->stack_top[-2]);
+                DISPATCH();
             }
 
             // Implements the failure branch for the statement: [assert <expression>, <error-message>].
             // Before: [ ... ][ test-expression-value ][ error-message-expression-value ]
             // After:  [ ... ][ test-expression-value ][ error-message-expression-value ]
-            case PYRO_OPCODE_ASSERT_FAILED: {
+            TARGET(PYRO_OPCODE_ASSERT_FAILED): {
+                SAVE_IP();
                 if (PYRO_IS_NULL(vm->stack_top[-1])) {
                     pyro_panic(vm, "assertion failed");
                     break;
@@ -875,70 +2160,82 @@ static void run(PyroVM* vm) {
             // Implements the expression: [callee(arg1, arg2, arg3, ...)].
             // Before: [ ... ][ callee ][ arg1 ][ arg2 ][ arg3 ]
             // After:  [ ... ][ return_value ]
-            case PYRO_OPCODE_CALL_VALUE: {
+            TARGET(PYRO_OPCODE_CALL_VALUE): {
                 uint8_t arg_count = READ_BYTE();
+                SAVE_IP();
                 call_value(vm, arg_count);
-                break;
+                SAFEPOINT();
             }
 
-            case PYRO_OPCODE_CALL_VALUE_0: {
+            TARGET(PYRO_OPCODE_CALL_VALUE_0): {
+                SAVE_IP();
                 call_value(vm, 0);
-                break;
+                SAFEPOINT();
             }
 
-            case PYRO_OPCODE_CALL_VALUE_1: {
+            TARGET(PYRO_OPCODE_CALL_VALUE_1): {
+                SAVE_IP();
                 call_value(vm, 1);
-                break;
+                SAFEPOINT();
             }
 
-            case PYRO_OPCODE_CALL_VALUE_2: {
+            TARGET(PYRO_OPCODE_CALL_VALUE_2): {
+                SAVE_IP();
                 call_value(vm, 2);
-                break;
+                SAFEPOINT();
             }
 
-            case PYRO_OPCODE_CALL_VALUE_3: {
+            TARGET(PYRO_OPCODE_CALL_VALUE_3): {
+                SAVE_IP();
                 call_value(vm, 3);
-                break;
+                SAFEPOINT();
             }
 
-            case PYRO_OPCODE_CALL_VALUE_4: {
+            TARGET(PYRO_OPCODE_CALL_VALUE_4): {
+                SAVE_IP();
                 call_value(vm, 4);
-                break;
+                SAFEPOINT();
             }
 
-            case PYRO_OPCODE_CALL_VALUE_5: {
+            TARGET(PYRO_OPCODE_CALL_VALUE_5): {
+                SAVE_IP();
                 call_value(vm, 5);
-                break;
+                SAFEPOINT();
             }
 
-            case PYRO_OPCODE_CALL_VALUE_6: {
+            TARGET(PYRO_OPCODE_CALL_VALUE_6): {
+                SAVE_IP();
                 call_value(vm, 6);
-                break;
+                SAFEPOINT();
             }
 
-            case PYRO_OPCODE_CALL_VALUE_7: {
+            TARGET(PYRO_OPCODE_CALL_VALUE_7): {
+                SAVE_IP();
                 call_value(vm, 7);
-                break;
+                SAFEPOINT();
             }
 
-            case PYRO_OPCODE_CALL_VALUE_8: {
+            TARGET(PYRO_OPCODE_CALL_VALUE_8): {
+                SAVE_IP();
                 call_value(vm, 8);
-                break;
+                SAFEPOINT();
             }
 
-            case PYRO_OPCODE_CALL_VALUE_9: {
+            TARGET(PYRO_OPCODE_CALL_VALUE_9): {
+                SAVE_IP();
                 call_value(vm, 9);
-                break;
+                SAFEPOINT();
             }
 
             // Implements the expression: [callee(arg1, arg2, ..., *args)], where [args] is a
             // vector or tuple to be unpacked.
             // Before: [ ... ][ callee ][ arg1 ][ arg2 ][ args ]
             // After:  [ ... ][ return_value ]
-            case PYRO_OPCODE_CALL_VALUE_WITH_UNPACK: {
+            TARGET(PYRO_OPCODE_CALL_VALUE_WITH_UNPACK): {
                 uint8_t arg_count = READ_BYTE();
                 PyroValue last_arg = pyro_pop(vm);
                 arg_count--;
+                SAVE_IP();
 
                 PyroValue* values;
                 size_t value_count;
@@ -967,20 +2264,23 @@ static void run(PyroVM* vm) {
                 }
 
                 call_value(vm, total_args);
-                break;
+                SAFEPOINT();
             }
 
             // Pushes a new class object onto the stack.
             // Before: [ ... ]
             // After:  [ ... ][ class_object ]
-            case PYRO_OPCODE_MAKE_CLASS: {
+            TARGET(PYRO_OPCODE_MAKE_CLASS): {
+                PyroStr* name = READ_STRING();
+                SAVE_IP();
+
                 PyroClass* class = PyroClass_new(vm);
                 if (!class) {
                     pyro_panic(vm, "out of memory");
                     break;
                 }
 
-                class->name = READ_STRING();
+                class->name = name;
                 pyro_push(vm, pyro_obj(class));
                 break;
             }
@@ -989,7 +2289,8 @@ static void run(PyroVM* vm) {
             // behind on the stack as the target for the [super] variable.
             // Before: [ ... ][ superclass_object ][ subclass_object ]
             // After:  [ ... ][ superclass_object ]
-            case PYRO_OPCODE_INHERIT: {
+            TARGET(PYRO_OPCODE_INHERIT): {
+                SAVE_IP();
                 if (!PYRO_IS_CLASS(vm->stack_top[-2])) {
                     pyro_panic(vm, "invalid superclass value (not a class)");
                     break;
@@ -1035,8 +2336,11 @@ static void run(PyroVM* vm) {
                     break;
                 }
 
+                pyro_write_barrier(vm, (PyroObject*)subclass, superclass->init_method);
+                pyro_write_barrier(vm, (PyroObject*)subclass, pyro_obj(superclass));
                 subclass->init_method = superclass->init_method;
                 subclass->superclass = superclass;
+                subclass->layout_id = pyro_new_layout_id(vm);
 
                 pyro_pop(vm);
                 break;
@@ -1045,93 +2349,82 @@ static void run(PyroVM* vm) {
             // Implements the expression: [receiver.field_name].
             // Before: [ ... ][ receiver ]
             // After:  [ ... ][ field_value ]
-            case PYRO_OPCODE_GET_FIELD: {
+            TARGET(PYRO_OPCODE_GET_FIELD): {
                 PyroStr* field_name = READ_STRING();
+                PyroInlineCache* cache = READ_INLINE_CACHE();
                 PyroValue receiver = vm->stack_top[-1];
 
                 if (PYRO_IS_INSTANCE(receiver)) {
                     PyroInstance* instance = PYRO_AS_INSTANCE(receiver);
-                    PyroValue field_index;
-                    if (PyroMap_fast_get(instance->obj.class->all_field_indexes, field_name, &field_index, vm)) {
+                    if (cache->layout_id == instance->obj.class->layout_id) {
                         // Replace the instance with the field value.
-                        vm->stack_top[-1] = instance->fields[field_index.as.i64];
-                        break;
-                    }
-                }
-
-                if (PYRO_IS_CLASS(receiver)) {
-                    PyroClass* class = PYRO_AS_CLASS(receiver);
-                    PyroValue value;
-                    if (PyroMap_fast_get(class->static_fields, field_name, &value, vm)) {
-                        // Replace the class with the field value.
-                        vm->stack_top[-1] = value;
-                        break;
-                    } else {
-                        pyro_panic(vm, "%s has no static field '%s'", class->name->bytes, field_name->bytes);
-                        break;
+                        vm->stack_top[-1] = instance->fields[cache->as.index];
+                        DISPATCH();
                     }
                 }
 
-                pyro_panic(vm, "%s has no field '%s'", pyro_get_type_name(vm, receiver)->bytes, field_name->bytes);
+                SAVE_IP();
+                get_field(vm, field_name, cache, false);
                 break;
             }
 
             // Implements the expression: [receiver.field_name].
             // Before: [ ... ][ receiver ]
             // After:  [ ... ][ field_value ]
-            case PYRO_OPCODE_GET_PUB_FIELD: {
+            TARGET(PYRO_OPCODE_GET_PUB_FIELD): {
                 PyroStr* field_name = READ_STRING();
+                PyroInlineCache* cache = READ_INLINE_CACHE();
                 PyroValue receiver = vm->stack_top[-1];
 
                 if (PYRO_IS_INSTANCE(receiver)) {
                     PyroInstance* instance = PYRO_AS_INSTANCE(receiver);
-                    PyroValue field_index;
-                    if (PyroMap_fast_get(instance->obj.class->pub_field_indexes, field_name, &field_index, vm)) {
+                    if (cache->layout_id == instance->obj.class->layout_id) {
                         // Replace the instance with the field value.
-                        vm->stack_top[-1] = instance->fields[field_index.as.i64];
-                        break;
-                    } else if (PyroMap_fast_get(instance->obj.class->all_field_indexes, field_name, &field_index, vm)) {
-                        pyro_panic(vm, "field '%s' is private", field_name->bytes);
-                        break;
-                    }
-                }
-
-                if (PYRO_IS_CLASS(receiver)) {
-                    PyroClass* class = PYRO_AS_CLASS(receiver);
-                    PyroValue value;
-                    if (PyroMap_fast_get(class->static_fields, field_name, &value, vm)) {
-                        // Replace the class with the field value.
-                        vm->stack_top[-1] = value;
-                        break;
-                    } else {
-                        pyro_panic(vm, "%s has no static field '%s'", class->name->bytes, field_name->bytes);
-                        break;
+                        vm->stack_top[-1] = instance->fields[cache->as.index];
+                        DISPATCH();
                     }
                 }
 
-                pyro_panic(vm, "%s has no field '%s'", pyro_get_type_name(vm, receiver)->bytes, field_name->bytes);
+                SAVE_IP();
+                get_field(vm, field_name, cache, true);
                 break;
             }
 
             // Implements the expression: [receiver.field_name = value].
             // Before: [ ... ][ receiver ][ value ]
             // After:  [ ... ][ value ]
-            case PYRO_OPCODE_SET_FIELD: {
+            TARGET(PYRO_OPCODE_SET_FIELD): {
                 PyroStr* field_name = READ_STRING();
+                PyroInlineCache* cache = READ_INLINE_CACHE();
                 PyroValue receiver = vm->stack_top[-2];
                 PyroValue value = vm->stack_top[-1];
 
                 if (PYRO_IS_INSTANCE(receiver)) {
                     PyroInstance* instance = PYRO_AS_INSTANCE(receiver);
+                    PyroClass* class = instance->obj.class;
+
+                    if (cache->layout_id == class->layout_id) {
+                        pyro_write_barrier(vm, (PyroObject*)instance, value);
+                        instance->fields[cache->as.index] = value;
+                        vm->stack_top[-2] = value;
+                        vm->stack_top--;
+                        DISPATCH();
+                    }
+
                     PyroValue field_index;
-                    if (PyroMap_fast_get(instance->obj.class->all_field_indexes, field_name, &field_index, vm)) {
-                        instance->fields[field_index.as.i64] = value;
+                    if (PyroMap_fast_get(class->all_field_indexes, field_name, &field_index, vm)) {
+                        cache->layout_id = class->layout_id;
+                        cache->as.index = (size_t)PYRO_AS_I64(field_index);
+                        pyro_write_barrier(vm, (PyroObject*)instance, value);
+                        instance->fields[PYRO_AS_I64(field_index)] = value;
                         vm->stack_top[-2] = value;
                         vm->stack_top--;
-                        break;
+                        DISPATCH();
                     }
                 }
 
+                SAVE_IP();
+
                 if (PYRO_IS_CLASS(receiver)) {
                     PyroClass* class = PYRO_AS_CLASS(receiver);
                     if (PyroMap_contains(class->static_fields, pyro_obj(field_name), vm)) {
@@ -1152,25 +2445,44 @@ static void run(PyroVM* vm) {
             // Implements the expression: [receiver.field_name = value].
             // Before: [ ... ][ receiver ][ value ]
             // After:  [ ... ][ value ]
-            case PYRO_OPCODE_SET_PUB_FIELD: {
+            TARGET(PYRO_OPCODE_SET_PUB_FIELD): {
                 PyroStr* field_name = READ_STRING();
+                PyroInlineCache* cache = READ_INLINE_CACHE();
                 PyroValue receiver = vm->stack_top[-2];
                 PyroValue value = vm->stack_top[-1];
 
                 if (PYRO_IS_INSTANCE(receiver)) {
                     PyroInstance* instance = PYRO_AS_INSTANCE(receiver);
+                    PyroClass* class = instance->obj.class;
+
+                    if (cache->layout_id == class->layout_id) {
+                        pyro_write_barrier(vm, (PyroObject*)instance, value);
+                        instance->fields[cache->as.index] = value;
+                        vm->stack_top[-2] = value;
+                        vm->stack_top--;
+                        DISPATCH();
+                    }
+
                     PyroValue field_index;
-                    if (PyroMap_fast_get(instance->obj.class->pub_field_indexes, field_name, &field_index, vm)) {
-                        instance->fields[field_index.as.i64] = value;
+                    if (PyroMap_fast_get(class->pub_field_indexes, field_name, &field_index, vm)) {
+                        cache->layout_id = class->layout_id;
+                        cache->as.index = (size_t)PYRO_AS_I64(field_index);
+                        pyro_write_barrier(vm, (PyroObject*)instance, value);
+                        instance->fields[PYRO_AS_I64(field_index)] = value;
                         vm->stack_top[-2] = value;
                         vm->stack_top--;
-                        break;
-                    } else if (PyroMap_fast_get(instance->obj.class->all_field_indexes, field_name, &field_index, vm)) {
+                        DISPATCH();
+                    }
+
+                    SAVE_IP();
+                    if (PyroMap_fast_get(class->all_field_indexes, field_name, &field_index, vm)) {
                         pyro_panic(vm, "field '%s' is private", field_name->bytes);
                         break;
                     }
                 }
 
+                SAVE_IP();
+
                 if (PYRO_IS_CLASS(receiver)) {
                     PyroClass* class = PYRO_AS_CLASS(receiver);
                     if (PyroMap_contains(class->static_fields, pyro_obj(field_name), vm)) {
@@ -1191,7 +2503,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [receiver[key]].
             // Before: [ ... ][ receiver ][ key ]
             // After:  [ ... ][ value ]
-            case PYRO_OPCODE_GET_INDEX: {
+            TARGET(PYRO_OPCODE_GET_INDEX): {
+                SAVE_IP();
                 PyroValue result = pyro_op_get_index(
                     vm,
                     vm->stack_top[-2],
@@ -1205,7 +2518,8 @@ static void run(PyroVM* vm) {
             // Implements the expression: [receiver[key] = value].
             // Before: [ ... ][ receiver ][ key ][ value ]
             // After:  [ ... ][ value ]
-            case PYRO_OPCODE_SET_INDEX: {
+            TARGET(PYRO_OPCODE_SET_INDEX): {
+                SAVE_IP();
                 PyroValue result = pyro_op_set_index(
                     vm,
                     vm->stack_top[-3],
@@ -1220,71 +2534,150 @@ static void run(PyroVM* vm) {
             // Loads the local variable at the specified index onto the stack.
             // Before: [ ... ]
             // After:  [ ... ][ value ]
-            case PYRO_OPCODE_GET_LOCAL: {
+            TARGET(PYRO_OPCODE_GET_LOCAL): {
                 uint8_t index = READ_BYTE();
-                pyro_push(vm, frame->fp[index]);
-                break;
+                PUSH(frame->fp[index]);
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_GET_LOCAL_0: {
-                pyro_push(vm, frame->fp[0]);
-                break;
+            TARGET(PYRO_OPCODE_GET_LOCAL_0): {
+                PUSH(frame->fp[0]);
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_GET_LOCAL_1: {
-                pyro_push(vm, frame->fp[1]);
-                break;
+            TARGET(PYRO_OPCODE_GET_LOCAL_1): {
+                PUSH(frame->fp[1]);
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_GET_LOCAL_2: {
-                pyro_push(vm, frame->fp[2]);
-                break;
+            TARGET(PYRO_OPCODE_GET_LOCAL_2): {
+                PUSH(frame->fp[2]);
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_GET_LOCAL_3: {
-                pyro_push(vm, frame->fp[3]);
-                break;
+            TARGET(PYRO_OPCODE_GET_LOCAL_3): {
+                PUSH(frame->fp[3]);
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_GET_LOCAL_4: {
-                pyro_push(vm, frame->fp[4]);
-                break;
+            TARGET(PYRO_OPCODE_GET_LOCAL_4): {
+                PUSH(frame->fp[4]);
+                DISPATCH();
+            }
+
+            TARGET(PYRO_OPCODE_GET_LOCAL_5): {
+                PUSH(frame->fp[5]);
+                DISPATCH();
+            }
+
+            TARGET(PYRO_OPCODE_GET_LOCAL_6): {
+                PUSH(frame->fp[6]);
+                DISPATCH();
+            }
+
+            TARGET(PYRO_OPCODE_GET_LOCAL_7): {
+                PUSH(frame->fp[7]);
+                DISPATCH();
+            }
+
+            TARGET(PYRO_OPCODE_GET_LOCAL_8): {
+                PUSH(frame->fp[8]);
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_GET_LOCAL_5: {
-                pyro_push(vm, frame->fp[5]);
+            TARGET(PYRO_OPCODE_GET_LOCAL_9): {
+                PUSH(frame->fp[9]);
+                DISPATCH();
+            }
+
+            // Superinstruction for GET_LOCAL followed by GET_FIELD.
+            // Before: [ ... ]
+            // After:  [ ... ][ field_value ]
+            TARGET(PYRO_OPCODE_GET_LOCAL_FIELD): {
+                PyroValue receiver = frame->fp[READ_BYTE()];
+                PyroStr* field_name = READ_STRING();
+                PyroInlineCache* cache = READ_INLINE_CACHE();
+
+                if (PYRO_IS_INSTANCE(receiver)) {
+                    PyroInstance* instance = PYRO_AS_INSTANCE(receiver);
+                    if (cache->layout_id == instance->obj.class->layout_id) {
+                        PUSH(instance->fields[cache->as.index]);
+                        DISPATCH();
+                    }
+                }
+
+                PUSH(receiver);
+                SAVE_IP();
+                get_field(vm, field_name, cache, false);
                 break;
             }
 
-            case PYRO_OPCODE_GET_LOCAL_6: {
-                pyro_push(vm, frame->fp[6]);
-                break;
-            }
+            // Superinstruction for GET_LOCAL followed by GET_PUB_FIELD.
+            // Before: [ ... ]
+            // After:  [ ... ][ field_value ]
+            TARGET(PYRO_OPCODE_GET_LOCAL_PUB_FIELD): {
+                PyroValue receiver = frame->fp[READ_BYTE()];
+                PyroStr* field_name = READ_STRING();
+                PyroInlineCache* cache = READ_INLINE_CACHE();
 
-            case PYRO_OPCODE_GET_LOCAL_7: {
-                pyro_push(vm, frame->fp[7]);
-                break;
-            }
+                if (PYRO_IS_INSTANCE(receiver)) {
+                    PyroInstance* instance = PYRO_AS_INSTANCE(receiver);
+                    if (cache->layout_id == instance->obj.class->layout_id) {
+                        PUSH(instance->fields[cache->as.index]);
+                        DISPATCH();
+                    }
+                }
 
-            case PYRO_OPCODE_GET_LOCAL_8: {
-                pyro_push(vm, frame->fp[8]);
+                PUSH(receiver);
+                SAVE_IP();
+                get_field(vm, field_name, cache, true);
                 break;
             }
 
-            case PYRO_OPCODE_GET_LOCAL_9: {
-                pyro_push(vm, frame->fp[9]);
+            // Superinstruction for GET_LOCAL, LOAD_CONSTANT, BINARY_PLUS.
+            // Before: [ ... ]
+            // After:  [ ... ][ local + constant ]
+            TARGET(PYRO_OPCODE_GET_LOCAL_PLUS_CONSTANT): {
+                PyroValue left = frame->fp[READ_BYTE()];
+                PyroValue right = READ_CONSTANT();
+
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    int64_t result;
+                    if (!pyro_ckd_add(&result, PYRO_AS_I64(left), PYRO_AS_I64(right))) {
+                        PUSH(pyro_i64(result));
+                        DISPATCH();
+                    }
+                }
+
+                // Push the local first so the result has a stack slot to go in -- the operator
+                // can call into Pyro code and reallocate the call stack.
+                PUSH(left);
+                SAVE_IP();
+                PyroValue result = pyro_op_binary_plus(vm, left, right);
+                vm->stack_top[-1] = result;
                 break;
             }
 
             // Loads a global variable onto the stack.
             // Before: [ ... ]
             // After:  [ ... ][ value ]
-            case PYRO_OPCODE_GET_GLOBAL: {
+            TARGET(PYRO_OPCODE_GET_GLOBAL): {
                 PyroStr* name = READ_STRING();
+                PyroInlineCache* cache = READ_INLINE_CACHE();
+                PyroMod* module = frame->closure->module;
+
+                if (cache->layout_id == module->layout_id) {
+                    PUSH(module->members->values[cache->as.index]);
+                    DISPATCH();
+                }
+
+                SAVE_IP();
 
                 PyroValue member_index;
-                if (PyroMap_fast_get(frame->closure->module->all_member_indexes, name, &member_index, vm)) {
-                    PyroValue value = frame->closure->module->members->values[member_index.as.i64];
+                if (PyroMap_fast_get(module->all_member_indexes, name, &member_index, vm)) {
+                    cache->layout_id = module->layout_id;
+                    cache->as.index = (size_t)PYRO_AS_I64(member_index);
+                    PyroValue value = module->members->values[PYRO_AS_I64(member_index)];
                     pyro_push(vm, value);
                     break;
                 }
@@ -1302,13 +2695,26 @@ static void run(PyroVM* vm) {
             // Assigns to a global variable.
             // Before: [ ... ][ value ]
             // After:  [ ... ][ value ]
-            case PYRO_OPCODE_SET_GLOBAL: {
+            TARGET(PYRO_OPCODE_SET_GLOBAL): {
                 PyroStr* name = READ_STRING();
+                PyroInlineCache* cache = READ_INLINE_CACHE();
                 PyroValue value = vm->stack_top[-1];
+                PyroMod* module = frame->closure->module;
+
+                if (cache->layout_id == module->layout_id) {
+                    pyro_write_barrier(vm, (PyroObject*)module->members, value);
+                    module->members->values[cache->as.index] = value;
+                    DISPATCH();
+                }
+
+                SAVE_IP();
 
                 PyroValue member_index;
-                if (PyroMap_fast_get(frame->closure->module->all_member_indexes, name, &member_index, vm)) {
-                    frame->closure->module->members->values[member_index.as.i64] = value;
+                if (PyroMap_fast_get(module->all_member_indexes, name, &member_index, vm)) {
+                    cache->layout_id = module->layout_id;
+                    cache->as.index = (size_t)PYRO_AS_I64(member_index);
+                    pyro_write_barrier(vm, (PyroObject*)module->members, value);
+                    module->members->values[PYRO_AS_I64(member_index)] = value;
                     break;
                 }
 
@@ -1324,127 +2730,128 @@ static void run(PyroVM* vm) {
             // Pushes the value [null] onto the stack.
             // Before: [ ... ]
             // After:  [ ... ][ null ]
-            case PYRO_OPCODE_LOAD_NULL:
-                pyro_push(vm, pyro_null());
-                break;
+            TARGET(PYRO_OPCODE_LOAD_NULL):
+                PUSH(pyro_null());
+                DISPATCH();
 
             // Pushes the value [true] onto the stack.
             // Before: [ ... ]
             // After:  [ ... ][ true ]
-            case PYRO_OPCODE_LOAD_TRUE:
-                pyro_push(vm, pyro_bool(true));
-                break;
+            TARGET(PYRO_OPCODE_LOAD_TRUE):
+                PUSH(pyro_bool(true));
+                DISPATCH();
 
             // Pushes the value [false] onto the stack.
             // Before: [ ... ]
             // After:  [ ... ][ false ]
-            case PYRO_OPCODE_LOAD_FALSE:
-                pyro_push(vm, pyro_bool(false));
-                break;
+            TARGET(PYRO_OPCODE_LOAD_FALSE):
+                PUSH(pyro_bool(false));
+                DISPATCH();
 
             // Pushes a value from the function's constant table onto the stack.
             // Before: [ ... ]
             // After:  [ ... ][ value ]
-            case PYRO_OPCODE_LOAD_CONSTANT: {
+            TARGET(PYRO_OPCODE_LOAD_CONSTANT): {
                 PyroValue constant = READ_CONSTANT();
-                pyro_push(vm, constant);
-                break;
+                PUSH(constant);
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_LOAD_CONSTANT_0: {
-                pyro_push(vm, frame->closure->fn->constants[0]);
-                break;
+            TARGET(PYRO_OPCODE_LOAD_CONSTANT_0): {
+                PUSH(constants[0]);
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_LOAD_CONSTANT_1: {
-                pyro_push(vm, frame->closure->fn->constants[1]);
-                break;
+            TARGET(PYRO_OPCODE_LOAD_CONSTANT_1): {
+                PUSH(constants[1]);
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_LOAD_CONSTANT_2: {
-                pyro_push(vm, frame->closure->fn->constants[2]);
-                break;
+            TARGET(PYRO_OPCODE_LOAD_CONSTANT_2): {
+                PUSH(constants[2]);
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_LOAD_CONSTANT_3: {
-                pyro_push(vm, frame->closure->fn->constants[3]);
-                break;
+            TARGET(PYRO_OPCODE_LOAD_CONSTANT_3): {
+                PUSH(constants[3]);
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_LOAD_CONSTANT_4: {
-                pyro_push(vm, frame->closure->fn->constants[4]);
-                break;
+            TARGET(PYRO_OPCODE_LOAD_CONSTANT_4): {
+                PUSH(constants[4]);
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_LOAD_CONSTANT_5: {
-                pyro_push(vm, frame->closure->fn->constants[5]);
-                break;
+            TARGET(PYRO_OPCODE_LOAD_CONSTANT_5): {
+                PUSH(constants[5]);
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_LOAD_CONSTANT_6: {
-                pyro_push(vm, frame->closure->fn->constants[6]);
-                break;
+            TARGET(PYRO_OPCODE_LOAD_CONSTANT_6): {
+                PUSH(constants[6]);
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_LOAD_CONSTANT_7: {
-                pyro_push(vm, frame->closure->fn->constants[7]);
-                break;
+            TARGET(PYRO_OPCODE_LOAD_CONSTANT_7): {
+                PUSH(constants[7]);
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_LOAD_CONSTANT_8: {
-                pyro_push(vm, frame->closure->fn->constants[8]);
-                break;
+            TARGET(PYRO_OPCODE_LOAD_CONSTANT_8): {
+                PUSH(constants[8]);
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_LOAD_CONSTANT_9: {
-                pyro_push(vm, frame->closure->fn->constants[9]);
-                break;
+            TARGET(PYRO_OPCODE_LOAD_CONSTANT_9): {
+                PUSH(constants[9]);
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_LOAD_I64_0:
-                pyro_push(vm, pyro_i64(0));
-                break;
+            TARGET(PYRO_OPCODE_LOAD_I64_0):
+                PUSH(pyro_i64(0));
+                DISPATCH();
 
-            case PYRO_OPCODE_LOAD_I64_1:
-                pyro_push(vm, pyro_i64(1));
-                break;
+            TARGET(PYRO_OPCODE_LOAD_I64_1):
+                PUSH(pyro_i64(1));
+                DISPATCH();
 
-            case PYRO_OPCODE_LOAD_I64_2:
-                pyro_push(vm, pyro_i64(2));
-                break;
+            TARGET(PYRO_OPCODE_LOAD_I64_2):
+                PUSH(pyro_i64(2));
+                DISPATCH();
 
-            case PYRO_OPCODE_LOAD_I64_3:
-                pyro_push(vm, pyro_i64(3));
-                break;
+            TARGET(PYRO_OPCODE_LOAD_I64_3):
+                PUSH(pyro_i64(3));
+                DISPATCH();
 
-            case PYRO_OPCODE_LOAD_I64_4:
-                pyro_push(vm, pyro_i64(4));
-                break;
+            TARGET(PYRO_OPCODE_LOAD_I64_4):
+                PUSH(pyro_i64(4));
+                DISPATCH();
 
-            case PYRO_OPCODE_LOAD_I64_5:
-                pyro_push(vm, pyro_i64(5));
-                break;
+            TARGET(PYRO_OPCODE_LOAD_I64_5):
+                PUSH(pyro_i64(5));
+                DISPATCH();
 
-            case PYRO_OPCODE_LOAD_I64_6:
-                pyro_push(vm, pyro_i64(6));
-                break;
+            TARGET(PYRO_OPCODE_LOAD_I64_6):
+                PUSH(pyro_i64(6));
+                DISPATCH();
 
-            case PYRO_OPCODE_LOAD_I64_7:
-                pyro_push(vm, pyro_i64(7));
-                break;
+            TARGET(PYRO_OPCODE_LOAD_I64_7):
+                PUSH(pyro_i64(7));
+                DISPATCH();
 
-            case PYRO_OPCODE_LOAD_I64_8:
-                pyro_push(vm, pyro_i64(8));
-                break;
+            TARGET(PYRO_OPCODE_LOAD_I64_8):
+                PUSH(pyro_i64(8));
+                DISPATCH();
 
-            case PYRO_OPCODE_LOAD_I64_9:
-                pyro_push(vm, pyro_i64(9));
-                break;
+            TARGET(PYRO_OPCODE_LOAD_I64_9):
+                PUSH(pyro_i64(9));
+                DISPATCH();
 
             // Stringifies the value on top of the stack.
             // Before: [ ... ][ value ]
             // After:  [ ... ][ string ]
-            case PYRO_OPCODE_STRINGIFY: {
+            TARGET(PYRO_OPCODE_STRINGIFY): {
+                SAVE_IP();
                 PyroValue result = pyro_obj(
                     pyro_stringify_value(vm, vm->stack_top[-1])
                 );
@@ -1455,7 +2862,8 @@ static void run(PyroVM* vm) {
             // Formats a value using a format string and pushes the result onto the stack.
             // Before: [ ... ][ value ][ format_string ]
             // After:  [ ... ][ string ]
-            case PYRO_OPCODE_FORMAT: {
+            TARGET(PYRO_OPCODE_FORMAT): {
+                SAVE_IP();
                 PyroValue result = pyro_obj(
                     pyro_format_value(
                         vm,
@@ -1472,8 +2880,9 @@ static void run(PyroVM* vm) {
             // Concatenates [arg_count] strings, where [arg_count >= 2].
             // Before: [ ... ][ string1 ][ string2 ][ string3 ]
             // After:  [ ... ][ string ]
-            case PYRO_OPCODE_CONCAT_STRINGS: {
+            TARGET(PYRO_OPCODE_CONCAT_STRINGS): {
                 int arg_count = (int)READ_BE_U16();
+                SAVE_IP();
 
                 size_t required_capacity = 0;
                 for (int i = 0; i < arg_count; i++) {
@@ -1495,7 +2904,7 @@ static void run(PyroVM* vm) {
                 }
                 array[byte_count] = '\0';
 
-                PyroStr* result = PyroStr_take(array, byte_count, required_capacity, vm);
+                PyroStr* result = PyroStr_take_lazy(array, byte_count, required_capacity, vm);
                 if (!result) {
                     pyro_panic(vm, "out of memory");
                     PYRO_FREE_ARRAY(vm, char, array, required_capacity);
@@ -1510,23 +2919,24 @@ static void run(PyroVM* vm) {
             // Pops and discards the value on top of the stack.
             // Before: [ ... ][ value ]
             // After:  [ ... ]
-            case PYRO_OPCODE_POP:
+            TARGET(PYRO_OPCODE_POP):
                 vm->stack_top--;
-                break;
+                DISPATCH();
 
             // Pushes the value of a module member onto the stack.
             // Before: [ ... ][ module ]
             // After:  [ ... ][ value ]
-            case PYRO_OPCODE_GET_MEMBER: {
+            TARGET(PYRO_OPCODE_GET_MEMBER): {
                 PyroStr* member_name = READ_STRING();
                 PyroValue receiver = vm->stack_top[-1];
+                SAVE_IP();
 
                 if (PYRO_IS_MOD(receiver)) {
                     PyroMod* module = PYRO_AS_MOD(receiver);
                     PyroValue member_index;
 
                     if (PyroMap_fast_get(module->pub_member_indexes, member_name, &member_index, vm)) {
-                        vm->stack_top[-1] = module->members->values[member_index.as.i64];
+                        vm->stack_top[-1] = module->members->values[PYRO_AS_I64(member_index)];
                         break;
                     }
 
@@ -1584,11 +2994,13 @@ static void run(PyroVM* vm) {
             // Loads a bound method onto the stack.
             // Before: [ ... ][ receiver ]
             // After:  [ ... ][ bound_method ]
-            case PYRO_OPCODE_GET_METHOD: {
+            TARGET(PYRO_OPCODE_GET_METHOD): {
                 PyroStr* method_name = READ_STRING();
+                PyroInlineCache* cache = READ_INLINE_CACHE();
                 PyroValue receiver = vm->stack_top[-1];
+                SAVE_IP();
 
-                PyroValue method = pyro_get_method(vm, receiver, method_name);
+                PyroValue method = get_cached_method(vm, receiver, method_name, cache, false);
                 if (PYRO_IS_NULL(method)) {
                     pyro_panic(vm,
                         "receiver of type %s has no method '%s'",
@@ -1611,11 +3023,13 @@ static void run(PyroVM* vm) {
             // Loads a bound method onto the stack.
             // Before: [ ... ][ receiver ]
             // After:  [ ... ][ bound_method ]
-            case PYRO_OPCODE_GET_PUB_METHOD: {
+            TARGET(PYRO_OPCODE_GET_PUB_METHOD): {
                 PyroStr* method_name = READ_STRING();
+                PyroInlineCache* cache = READ_INLINE_CACHE();
                 PyroValue receiver = vm->stack_top[-1];
+                SAVE_IP();
 
-                PyroValue method = pyro_get_pub_method(vm, receiver, method_name);
+                PyroValue method = get_cached_method(vm, receiver, method_name, cache, true);
                 if (PYRO_IS_NULL(method)) {
                     if (!PYRO_IS_NULL(pyro_get_method(vm, receiver, method_name))) {
                         pyro_panic(vm, "method '%s' is private", method_name->bytes);
@@ -1642,10 +3056,11 @@ static void run(PyroVM* vm) {
             // Loads a bound superclass-method onto the stack.
             // Before: [ ... ][ receiver ][ superclass ]
             // After:  [ ... ][ bound_method ]
-            case PYRO_OPCODE_GET_SUPER_METHOD: {
+            TARGET(PYRO_OPCODE_GET_SUPER_METHOD): {
                 PyroStr* method_name = READ_STRING();
                 PyroValue receiver = vm->stack_top[-2];
                 PyroClass* superclass = PYRO_AS_CLASS(vm->stack_top[-1]);
+                SAVE_IP();
 
                 PyroValue method;
                 if (!PyroMap_fast_get(superclass->all_instance_methods, method_name, &method, vm)) {
@@ -1667,18 +3082,19 @@ static void run(PyroVM* vm) {
             // Replaces the iterable value on top of the stack with an iterator.
             // Before: [ ... ][ iterable ]
             // After:  [ ... ][ iterator ]
-            case PYRO_OPCODE_GET_ITERATOR: {
+            TARGET(PYRO_OPCODE_GET_ITERATOR): {
+                SAVE_IP();
                 PyroValue receiver = vm->stack_top[-1];
                 PyroValue iter_method = pyro_get_method(vm, receiver, vm->str_dollar_iter);
 
                 if (PYRO_IS_NATIVE_FN(iter_method)) {
                     call_native_fn(vm, PYRO_AS_NATIVE_FN(iter_method), 0);
-                    break;
+                    SAFEPOINT();
                 }
 
                 if (PYRO_IS_CLOSURE(iter_method)) {
                     call_closure(vm, PYRO_AS_CLOSURE(iter_method), 0);
-                    break;
+                    SAFEPOINT();
                 }
 
                 pyro_panic(vm,
@@ -1691,7 +3107,8 @@ static void run(PyroVM* vm) {
             // Pushes the next value from an iterator onto the stack.
             // Before: [ ... ][ iterator ]
             // After:  [ ... ][ iterator ][ value ]
-            case PYRO_OPCODE_GET_NEXT_FROM_ITERATOR: {
+            TARGET(PYRO_OPCODE_GET_NEXT_FROM_ITERATOR): {
+                SAVE_IP();
                 PyroValue receiver = vm->stack_top[-1];
 
                 if (PYRO_IS_ITER(receiver)) {
@@ -1705,13 +3122,13 @@ static void run(PyroVM* vm) {
                 if (PYRO_IS_NATIVE_FN(next_method)) {
                     if (!pyro_push(vm, receiver)) break;
                     call_native_fn(vm, PYRO_AS_NATIVE_FN(next_method), 0);
-                    break;
+                    SAFEPOINT();
                 }
 
                 if (PYRO_IS_CLOSURE(next_method)) {
                     if (!pyro_push(vm, receiver)) break;
                     call_closure(vm, PYRO_AS_CLOSURE(next_method), 0);
-                    break;
+                    SAFEPOINT();
                 }
 
                 pyro_panic(vm, "invalid iterator: no :$next() method");
@@ -1721,20 +3138,22 @@ static void run(PyroVM* vm) {
             // Calls a public or private method and pushes its return value onto the stack.
             // Before: [ ... ][ receiver ][ arg1 ][ arg2 ][ arg3 ]
             // After:  [ ... ][ return_value ]
-            case PYRO_OPCODE_CALL_METHOD: {
+            TARGET(PYRO_OPCODE_CALL_METHOD): {
                 PyroStr* method_name = READ_STRING();
                 uint8_t arg_count = READ_BYTE();
+                PyroInlineCache* cache = READ_INLINE_CACHE();
                 PyroValue receiver = vm->stack_top[-(int)arg_count - 1];
-                PyroValue method = pyro_get_method(vm, receiver, method_name);
+                PyroValue method = get_cached_method(vm, receiver, method_name, cache, false);
+                SAVE_IP();
 
                 if (PYRO_IS_NATIVE_FN(method)) {
                     call_native_fn(vm, PYRO_AS_NATIVE_FN(method), arg_count);
-                    break;
+                    SAFEPOINT();
                 }
 
                 if (PYRO_IS_CLOSURE(method)) {
                     call_closure(vm, PYRO_AS_CLOSURE(method), arg_count);
-                    break;
+                    SAFEPOINT();
                 }
 
                 pyro_panic(vm,
@@ -1748,20 +3167,22 @@ static void run(PyroVM* vm) {
             // Calls a public method and pushes its return value onto the stack.
             // Before: [ ... ][ receiver ][ arg1 ][ arg2 ][ arg3 ]
             // After:  [ ... ][ return_value ]
-            case PYRO_OPCODE_CALL_PUB_METHOD: {
+            TARGET(PYRO_OPCODE_CALL_PUB_METHOD): {
                 PyroStr* method_name = READ_STRING();
                 uint8_t arg_count = READ_BYTE();
+                PyroInlineCache* cache = READ_INLINE_CACHE();
                 PyroValue receiver = vm->stack_top[-(int)arg_count - 1];
-                PyroValue method = pyro_get_pub_method(vm, receiver, method_name);
+                PyroValue method = get_cached_method(vm, receiver, method_name, cache, true);
+                SAVE_IP();
 
                 if (PYRO_IS_NATIVE_FN(method)) {
                     call_native_fn(vm, PYRO_AS_NATIVE_FN(method), arg_count);
-                    break;
+                    SAFEPOINT();
                 }
 
                 if (PYRO_IS_CLOSURE(method)) {
                     call_closure(vm, PYRO_AS_CLOSURE(method), arg_count);
-                    break;
+                    SAFEPOINT();
                 }
 
                 if (!PYRO_IS_NULL(pyro_get_method(vm, receiver, method_name))) {
@@ -1780,10 +3201,11 @@ static void run(PyroVM* vm) {
             // Implements: [super:method(arg1, arg2, arg3)].
             // Before: [ ... ][ receiver ][ arg1 ][ arg2 ][ arg3 ][ superclass_object ]
             // After:  [ ... ][ return_value ]
-            case PYRO_OPCODE_CALL_SUPER_METHOD: {
+            TARGET(PYRO_OPCODE_CALL_SUPER_METHOD): {
                 PyroClass* superclass = PYRO_AS_CLASS(pyro_pop(vm));
                 PyroStr* method_name = READ_STRING();
                 uint8_t arg_count = READ_BYTE();
+                SAVE_IP();
 
                 PyroValue method;
                 if (!PyroMap_fast_get(superclass->all_instance_methods, method_name, &method, vm)) {
@@ -1797,22 +3219,23 @@ static void run(PyroVM* vm) {
 
                 if (PYRO_IS_NATIVE_FN(method)) {
                     call_native_fn(vm, PYRO_AS_NATIVE_FN(method), arg_count);
-                    break;
+                    SAFEPOINT();
                 }
 
                 call_closure(vm, PYRO_AS_CLOSURE(method), arg_count);
-                break;
+                SAFEPOINT();
             }
 
             // Calls a public or private method and pushes its return value onto the stack.
             // Before: [ ... ][ receiver ][ arg1 ][ arg2 ][ arg_to_unpack ]
             // After:  [ ... ][ return_value ]
-            case PYRO_OPCODE_CALL_METHOD_WITH_UNPACK: {
+            TARGET(PYRO_OPCODE_CALL_METHOD_WITH_UNPACK): {
                 PyroStr* method_name = READ_STRING();
                 uint8_t arg_count = READ_BYTE();
                 PyroValue receiver = vm->stack_top[-(int)arg_count - 1];
                 PyroValue last_arg = pyro_pop(vm);
                 arg_count--;
+                SAVE_IP();
 
                 PyroValue* values;
                 size_t value_count;
@@ -1843,11 +3266,11 @@ static void run(PyroVM* vm) {
                 PyroValue method = pyro_get_method(vm, receiver, method_name);
                 if (PYRO_IS_NATIVE_FN(method)) {
                     call_native_fn(vm, PYRO_AS_NATIVE_FN(method), total_args);
-                    break;
+                    SAFEPOINT();
                 }
                 if (PYRO_IS_CLOSURE(method)) {
                     call_closure(vm, PYRO_AS_CLOSURE(method), total_args);
-                    break;
+                    SAFEPOINT();
                 }
 
                 pyro_panic(vm,
@@ -1861,12 +3284,13 @@ static void run(PyroVM* vm) {
             // Calls a public method and pushes its return value onto the stack.
             // Before: [ ... ][ receiver ][ arg1 ][ arg2 ][ arg_to_unpack ]
             // After:  [ ... ][ return_value ]
-            case PYRO_OPCODE_CALL_PUB_METHOD_WITH_UNPACK: {
+            TARGET(PYRO_OPCODE_CALL_PUB_METHOD_WITH_UNPACK): {
                 PyroStr* method_name = READ_STRING();
                 uint8_t arg_count = READ_BYTE();
                 PyroValue receiver = vm->stack_top[-(int)arg_count - 1];
                 PyroValue last_arg = pyro_pop(vm);
                 arg_count--;
+                SAVE_IP();
 
                 PyroValue* values;
                 size_t value_count;
@@ -1897,11 +3321,11 @@ static void run(PyroVM* vm) {
                 PyroValue method = pyro_get_pub_method(vm, receiver, method_name);
                 if (PYRO_IS_NATIVE_FN(method)) {
                     call_native_fn(vm, PYRO_AS_NATIVE_FN(method), total_args);
-                    break;
+                    SAFEPOINT();
                 }
                 if (PYRO_IS_CLOSURE(method)) {
                     call_closure(vm, PYRO_AS_CLOSURE(method), total_args);
-                    break;
+                    SAFEPOINT();
                 }
 
                 pyro_panic(vm,
@@ -1915,12 +3339,13 @@ static void run(PyroVM* vm) {
             // Implements: [super:method(arg1, arg2, arg_to_unpack)].
             // Before: [ ... ][ receiver ][ arg1 ][ arg2 ][ arg_to_unpack ][ superclass_object ]
             // After:  [ ... ][ return_value ]
-            case PYRO_OPCODE_CALL_SUPER_METHOD_WITH_UNPACK: {
+            TARGET(PYRO_OPCODE_CALL_SUPER_METHOD_WITH_UNPACK): {
                 PyroClass* superclass = PYRO_AS_CLASS(pyro_pop(vm));
                 PyroStr* method_name = READ_STRING();
                 uint8_t arg_count = READ_BYTE();
                 PyroValue last_arg = pyro_pop(vm);
                 arg_count--;
+                SAVE_IP();
 
                 PyroValue* values;
                 size_t value_count;
@@ -1960,143 +3385,355 @@ static void run(PyroVM* vm) {
 
                 if (PYRO_IS_NATIVE_FN(method)) {
                     call_native_fn(vm, PYRO_AS_NATIVE_FN(method), total_args);
-                    break;
+                    SAFEPOINT();
                 }
 
                 call_closure(vm, PYRO_AS_CLOSURE(method), total_args);
-                break;
+                SAFEPOINT();
             }
 
             // Jumps the instruction pointer to the specified offset in the bytecode.
-            case PYRO_OPCODE_JUMP: {
+            TARGET(PYRO_OPCODE_JUMP): {
                 uint16_t offset = READ_BE_U16();
-                frame->ip += offset;
-                break;
+                ip += offset;
+                DISPATCH();
             }
 
             // Jumps the instruction pointer to the specified offset in the bytecode.
-            case PYRO_OPCODE_JUMP_BACK: {
+            TARGET(PYRO_OPCODE_JUMP_BACK): {
                 uint16_t offset = READ_BE_U16();
-                frame->ip -= offset;
-                break;
+                ip -= offset;
+
+                // Hot loops switch over to the function's register code at the loop header.
+                PyroFn* fn = frame->closure->fn;
+                count_hotness(vm, fn);
+                if (fn->reg_code) {
+                    PyroRegEntry* entry = pyro_find_register_entry(fn->reg_code, (size_t)(ip - fn->code));
+                    if (entry && entry->depth == (size_t)(vm->stack_top - frame->fp)) {
+                        SAVE_IP();
+                        frame->reg_ip = fn->reg_code->code + entry->reg_ip;
+                        break;
+                    }
+                }
+
+                // Backward jumps are safepoints where we check if the garbage collector needs
+                // to run -- every loop passes through one.
+                if (vm->bytes_allocated > vm->next_gc_threshold) {
+                    SAVE_IP();
+                    pyro_collect_garbage(vm);
+                    break;
+                }
+
+                DISPATCH();
             }
 
             // Jumps the instruction pointer to the specified offset in the bytecode.
-            case PYRO_OPCODE_JUMP_IF_TRUE: {
+            TARGET(PYRO_OPCODE_JUMP_IF_TRUE): {
                 uint16_t offset = READ_BE_U16();
                 if (pyro_is_truthy(vm->stack_top[-1])) {
-                    frame->ip += offset;
+                    ip += offset;
                 }
-                break;
+                DISPATCH();
             }
 
             // Jumps the instruction pointer to the specified offset in the bytecode.
-            case PYRO_OPCODE_JUMP_IF_FALSE: {
+            TARGET(PYRO_OPCODE_JUMP_IF_FALSE): {
                 uint16_t offset = READ_BE_U16();
                 if (!pyro_is_truthy(vm->stack_top[-1])) {
-                    frame->ip += offset;
+                    ip += offset;
                 }
-                break;
+                DISPATCH();
             }
 
             // Jumps the instruction pointer to the specified offset in the bytecode.
-            case PYRO_OPCODE_POP_JUMP_IF_FALSE: {
+            TARGET(PYRO_OPCODE_POP_JUMP_IF_FALSE): {
                 uint16_t offset = READ_BE_U16();
                 if (!pyro_is_truthy(pyro_pop(vm))) {
-                    frame->ip += offset;
+                    ip += offset;
+                }
+                DISPATCH();
+            }
+
+            // Superinstruction for BINARY_BANG_EQUAL followed by POP_JUMP_IF_FALSE.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ]
+            TARGET(PYRO_OPCODE_JUMP_IF_EQUAL): {
+                uint16_t offset = READ_BE_U16();
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    vm->stack_top -= 2;
+                    if (PYRO_AS_I64(left) == PYRO_AS_I64(right)) {
+                        ip += offset;
+                    }
+                    DISPATCH();
+                }
+
+                // The comparison can call into Pyro code, which can reallocate the call stack, so
+                // the jump is applied to the reloaded frame.
+                SAVE_IP();
+                bool result = !pyro_op_compare_eq(vm, left, right);
+                vm->stack_top -= 2;
+                if (vm->halt_flag) {
+                    break;
+                }
+                if (!result) {
+                    vm->call_stack[vm->call_stack_count - 1].ip += offset;
+                }
+                break;
+            }
+
+            // Superinstruction for BINARY_EQUAL_EQUAL followed by POP_JUMP_IF_FALSE.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ]
+            TARGET(PYRO_OPCODE_JUMP_IF_NOT_EQUAL): {
+                uint16_t offset = READ_BE_U16();
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    vm->stack_top -= 2;
+                    if (PYRO_AS_I64(left) != PYRO_AS_I64(right)) {
+                        ip += offset;
+                    }
+                    DISPATCH();
+                }
+
+                // The comparison can call into Pyro code, which can reallocate the call stack, so
+                // the jump is applied to the reloaded frame.
+                SAVE_IP();
+                bool result = pyro_op_compare_eq(vm, left, right);
+                vm->stack_top -= 2;
+                if (vm->halt_flag) {
+                    break;
+                }
+                if (!result) {
+                    vm->call_stack[vm->call_stack_count - 1].ip += offset;
+                }
+                break;
+            }
+
+            // Superinstruction for BINARY_GREATER followed by POP_JUMP_IF_FALSE.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ]
+            TARGET(PYRO_OPCODE_JUMP_IF_NOT_GREATER): {
+                uint16_t offset = READ_BE_U16();
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    vm->stack_top -= 2;
+                    if (!(PYRO_AS_I64(left) > PYRO_AS_I64(right))) {
+                        ip += offset;
+                    }
+                    DISPATCH();
+                }
+
+                // The comparison can call into Pyro code, which can reallocate the call stack, so
+                // the jump is applied to the reloaded frame.
+                SAVE_IP();
+                bool result = pyro_op_compare_gt(vm, left, right);
+                vm->stack_top -= 2;
+                if (vm->halt_flag) {
+                    break;
+                }
+                if (!result) {
+                    vm->call_stack[vm->call_stack_count - 1].ip += offset;
+                }
+                break;
+            }
+
+            // Superinstruction for BINARY_GREATER_EQUAL followed by POP_JUMP_IF_FALSE.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ]
+            TARGET(PYRO_OPCODE_JUMP_IF_NOT_GREATER_EQUAL): {
+                uint16_t offset = READ_BE_U16();
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    vm->stack_top -= 2;
+                    if (!(PYRO_AS_I64(left) >= PYRO_AS_I64(right))) {
+                        ip += offset;
+                    }
+                    DISPATCH();
+                }
+
+                // The comparison can call into Pyro code, which can reallocate the call stack, so
+                // the jump is applied to the reloaded frame.
+                SAVE_IP();
+                bool result = pyro_op_compare_ge(vm, left, right);
+                vm->stack_top -= 2;
+                if (vm->halt_flag) {
+                    break;
+                }
+                if (!result) {
+                    vm->call_stack[vm->call_stack_count - 1].ip += offset;
+                }
+                break;
+            }
+
+            // Superinstruction for BINARY_LESS followed by POP_JUMP_IF_FALSE.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ]
+            TARGET(PYRO_OPCODE_JUMP_IF_NOT_LESS): {
+                uint16_t offset = READ_BE_U16();
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    vm->stack_top -= 2;
+                    if (!(PYRO_AS_I64(left) < PYRO_AS_I64(right))) {
+                        ip += offset;
+                    }
+                    DISPATCH();
+                }
+
+                // The comparison can call into Pyro code, which can reallocate the call stack, so
+                // the jump is applied to the reloaded frame.
+                SAVE_IP();
+                bool result = pyro_op_compare_lt(vm, left, right);
+                vm->stack_top -= 2;
+                if (vm->halt_flag) {
+                    break;
+                }
+                if (!result) {
+                    vm->call_stack[vm->call_stack_count - 1].ip += offset;
+                }
+                break;
+            }
+
+            // Superinstruction for BINARY_LESS_EQUAL followed by POP_JUMP_IF_FALSE.
+            // Before: [ ... ][ left_operand ][ right_operand ]
+            // After:  [ ... ]
+            TARGET(PYRO_OPCODE_JUMP_IF_NOT_LESS_EQUAL): {
+                uint16_t offset = READ_BE_U16();
+                PyroValue left = vm->stack_top[-2];
+                PyroValue right = vm->stack_top[-1];
+
+                if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
+                    vm->stack_top -= 2;
+                    if (!(PYRO_AS_I64(left) <= PYRO_AS_I64(right))) {
+                        ip += offset;
+                    }
+                    DISPATCH();
+                }
+
+                // The comparison can call into Pyro code, which can reallocate the call stack, so
+                // the jump is applied to the reloaded frame.
+                SAVE_IP();
+                bool result = pyro_op_compare_le(vm, left, right);
+                vm->stack_top -= 2;
+                if (vm->halt_flag) {
+                    break;
+                }
+                if (!result) {
+                    vm->call_stack[vm->call_stack_count - 1].ip += offset;
                 }
                 break;
             }
 
             // Jumps the instruction pointer to the specified offset in the bytecode.
-            case PYRO_OPCODE_JUMP_IF_ERR: {
+            TARGET(PYRO_OPCODE_JUMP_IF_ERR): {
                 uint16_t offset = READ_BE_U16();
                 if (PYRO_IS_ERR(vm->stack_top[-1])) {
-                    frame->ip += offset;
+                    ip += offset;
                 }
-                break;
+                DISPATCH();
             }
 
             // Jumps the instruction pointer to the specified offset in the bytecode.
-            case PYRO_OPCODE_JUMP_IF_NOT_ERR: {
+            TARGET(PYRO_OPCODE_JUMP_IF_NOT_ERR): {
                 uint16_t offset = READ_BE_U16();
                 if (!PYRO_IS_ERR(vm->stack_top[-1])) {
-                    frame->ip += offset;
+                    ip += offset;
                 }
-                break;
+                DISPATCH();
             }
 
             // Jumps the instruction pointer to the specified offset in the bytecode.
-            case PYRO_OPCODE_JUMP_IF_NOT_NULL: {
+            TARGET(PYRO_OPCODE_JUMP_IF_NOT_NULL): {
                 uint16_t offset = READ_BE_U16();
                 if (!PYRO_IS_NULL(vm->stack_top[-1])) {
-                    frame->ip += offset;
+                    ip += offset;
                 }
-                break;
+                DISPATCH();
             }
 
             // Sets the local variable at [index] to the value on top of the stack.
-            case PYRO_OPCODE_SET_LOCAL: {
+            TARGET(PYRO_OPCODE_SET_LOCAL): {
                 uint8_t index = READ_BYTE();
                 frame->fp[index] = vm->stack_top[-1];
-                break;
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_SET_LOCAL_0: {
+            TARGET(PYRO_OPCODE_SET_LOCAL_0): {
                 frame->fp[0] = vm->stack_top[-1];
-                break;
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_SET_LOCAL_1: {
+            TARGET(PYRO_OPCODE_SET_LOCAL_1): {
                 frame->fp[1] = vm->stack_top[-1];
-                break;
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_SET_LOCAL_2: {
+            TARGET(PYRO_OPCODE_SET_LOCAL_2): {
                 frame->fp[2] = vm->stack_top[-1];
-                break;
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_SET_LOCAL_3: {
+            TARGET(PYRO_OPCODE_SET_LOCAL_3): {
                 frame->fp[3] = vm->stack_top[-1];
-                break;
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_SET_LOCAL_4: {
+            TARGET(PYRO_OPCODE_SET_LOCAL_4): {
                 frame->fp[4] = vm->stack_top[-1];
-                break;
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_SET_LOCAL_5: {
+            TARGET(PYRO_OPCODE_SET_LOCAL_5): {
                 frame->fp[5] = vm->stack_top[-1];
-                break;
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_SET_LOCAL_6: {
+            TARGET(PYRO_OPCODE_SET_LOCAL_6): {
                 frame->fp[6] = vm->stack_top[-1];
-                break;
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_SET_LOCAL_7: {
+            TARGET(PYRO_OPCODE_SET_LOCAL_7): {
                 frame->fp[7] = vm->stack_top[-1];
-                break;
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_SET_LOCAL_8: {
+            TARGET(PYRO_OPCODE_SET_LOCAL_8): {
                 frame->fp[8] = vm->stack_top[-1];
-                break;
+                DISPATCH();
             }
 
-            case PYRO_OPCODE_SET_LOCAL_9: {
+            TARGET(PYRO_OPCODE_SET_LOCAL_9): {
                 frame->fp[9] = vm->stack_top[-1];
-                break;
+                DISPATCH();
+            }
+
+            // Superinstruction for SET_LOCAL followed by POP.
+            // Before: [ ... ][ value ]
+            // After:  [ ... ]
+            TARGET(PYRO_OPCODE_POP_SET_LOCAL): {
+                uint8_t index = READ_BYTE();
+                vm->stack_top--;
+                frame->fp[index] = *vm->stack_top;
+                DISPATCH();
             }
 
             // Pushes a new map object onto the stack.
             // Before: [ ... ][ key1 ][ value1 ][ key2 ][ value2 ]
             // After:  [ ... ][ map ]
-            case PYRO_OPCODE_MAKE_MAP: {
+            TARGET(PYRO_OPCODE_MAKE_MAP): {
                 uint16_t entry_count = READ_BE_U16();
+                SAVE_IP();
 
                 PyroMap* map = PyroMap_new(vm);
                 if (!map) {
@@ -2126,8 +3763,9 @@ static void run(PyroVM* vm) {
             // Pushes a new set object onto the stack.
             // Before: [ ... ][ value1 ][ value2 ][ value3 ]
             // After:  [ ... ][ set ]
-            case PYRO_OPCODE_MAKE_SET: {
+            TARGET(PYRO_OPCODE_MAKE_SET): {
                 uint16_t entry_count = READ_BE_U16();
+                SAVE_IP();
 
                 PyroMap* map = PyroMap_new_as_set(vm);
                 if (!map) {
@@ -2156,8 +3794,9 @@ static void run(PyroVM* vm) {
             // Pushes a new tup object onto the stack.
             // Before: [ ... ][ value1 ][ value2 ][ value3 ]
             // After:  [ ... ][ tup ]
-            case PYRO_OPCODE_MAKE_TUP: {
+            TARGET(PYRO_OPCODE_MAKE_TUP): {
                 uint16_t item_count = READ_BE_U16();
+                SAVE_IP();
 
                 if (item_count == 0) {
                     pyro_push(vm, pyro_obj(vm->empty_tuple));
@@ -2179,8 +3818,9 @@ static void run(PyroVM* vm) {
             // Pushes a new vec object onto the stack.
             // Before: [ ... ][ value1 ][ value2 ][ value3 ]
             // After:  [ ... ][ vec ]
-            case PYRO_OPCODE_MAKE_VEC: {
+            TARGET(PYRO_OPCODE_MAKE_VEC): {
                 uint16_t item_count = READ_BE_U16();
+                SAVE_IP();
 
                 PyroVec* vec = PyroVec_new_with_capacity(item_count, vm);
                 if (!vec) {
@@ -2204,7 +3844,8 @@ static void run(PyroVM* vm) {
             // Implements the statement: [return value].
             // Before: [ ... ][ local0 = closure/receiver ][ local1 ][ local2 ][ return_value ]
             // After:  [ ... ][ return_value ]
-            case PYRO_OPCODE_RETURN: {
+            TARGET(PYRO_OPCODE_RETURN): {
+                SAVE_IP();
                 PyroValue return_value = vm->stack_top[-1];
 
                 while (vm->with_stack_count > frame->with_stack_count_on_entry) {
@@ -2219,14 +3860,15 @@ static void run(PyroVM* vm) {
                 vm->stack_top[-1] = return_value;
 
                 vm->call_stack_count--;
-                break;
+                SAFEPOINT();
             }
 
             // Implements the statement: [return value1, value2], i.e. [count >= 2].
             // Before: [ ... ][ local0 = closure/receiver ][ loc1 ][ loc2 ][ ret1 ][ ret2 ]
             // After:  [ ... ][ return_value = tuple ]
-            case PYRO_OPCODE_RETURN_TUPLE: {
+            TARGET(PYRO_OPCODE_RETURN_TUPLE): {
                 uint8_t count = READ_BYTE();
+                SAVE_IP();
 
                 PyroTup* tup = PyroTup_new(count, vm);
                 if (!tup) {
@@ -2251,28 +3893,33 @@ static void run(PyroVM* vm) {
                 vm->stack_top[-1] = return_value;
 
                 vm->call_stack_count--;
-                break;
+                SAFEPOINT();
             }
 
             // Defines a private method on a class.
             // Before: [ ... ][ class_object ][ method_closure ]
             // After:  [ ... ][ class_object ]
-            case PYRO_OPCODE_DEFINE_PRI_METHOD: {
+            TARGET(PYRO_OPCODE_DEFINE_PRI_METHOD): {
                 PyroValue method = vm->stack_top[-1];
                 PyroClass* class = PYRO_AS_CLASS(vm->stack_top[-2]);
 
                 PyroStr* name = READ_STRING();
+                SAVE_IP();
+
                 if (PyroMap_contains(class->pub_instance_methods, pyro_obj(name), vm)) {
                     pyro_panic(vm, "cannot override public method '%s' as private", name->bytes);
                     break;
                 }
 
+                class->layout_id = pyro_new_layout_id(vm);
+
                 if (!PyroMap_set(class->all_instance_methods, pyro_obj(name), method, vm)) {
                     pyro_panic(vm, "out of memory");
                     break;
                 }
 
                 if (name == vm->str_dollar_init) {
+                    pyro_write_barrier(vm, (PyroObject*)class, method);
                     class->init_method = method;
                 }
 
@@ -2283,11 +3930,13 @@ static void run(PyroVM* vm) {
             // Defines a public method on a class.
             // Before: [ ... ][ class_object ][ method_closure ]
             // After:  [ ... ][ class_object ]
-            case PYRO_OPCODE_DEFINE_PUB_METHOD: {
+            TARGET(PYRO_OPCODE_DEFINE_PUB_METHOD): {
                 PyroValue method = vm->stack_top[-1];
                 PyroClass* class = PYRO_AS_CLASS(vm->stack_top[-2]);
 
                 PyroStr* name = READ_STRING();
+                SAVE_IP();
+
                 if (PyroMap_contains(class->all_instance_methods, pyro_obj(name), vm)) {
                     if (!PyroMap_contains(class->pub_instance_methods, pyro_obj(name), vm)) {
                         pyro_panic(vm, "cannot override private method '%s' as public", name->bytes);
@@ -2299,6 +3948,8 @@ static void run(PyroVM* vm) {
                     break;
                 }
 
+                class->layout_id = pyro_new_layout_id(vm);
+
                 if (!PyroMap_set(class->all_instance_methods, pyro_obj(name), method, vm)) {
                     pyro_panic(vm, "out of memory");
                     break;
@@ -2317,11 +3968,13 @@ static void run(PyroVM* vm) {
             // Defines a static method on a class.
             // Before: [ ... ][ class_object ][ method_closure ]
             // After:  [ ... ][ class_object ]
-            case PYRO_OPCODE_DEFINE_STATIC_METHOD: {
+            TARGET(PYRO_OPCODE_DEFINE_STATIC_METHOD): {
                 PyroValue method = vm->stack_top[-1];
                 PyroClass* class = PYRO_AS_CLASS(vm->stack_top[-2]);
 
                 PyroStr* name = READ_STRING();
+                SAVE_IP();
+
                 if (PyroMap_set(class->static_methods, pyro_obj(name), method, vm) == 0) {
                     pyro_panic(vm, "out of memory");
                     break;
@@ -2334,11 +3987,13 @@ static void run(PyroVM* vm) {
             // Defines a private field on a class.
             // Before: [ ... ][ class_object ][ default_value ]
             // After:  [ ... ][ class_object ]
-            case PYRO_OPCODE_DEFINE_PRI_FIELD: {
+            TARGET(PYRO_OPCODE_DEFINE_PRI_FIELD): {
                 PyroValue default_value = vm->stack_top[-1];
                 PyroClass* class = PYRO_AS_CLASS(vm->stack_top[-2]);
 
                 PyroStr* field_name = READ_STRING();
+                SAVE_IP();
+
                 if (PyroMap_contains(class->all_field_indexes, pyro_obj(field_name), vm)) {
                     pyro_panic(vm, "the field '%s' already exists", field_name->bytes);
                     break;
@@ -2356,6 +4011,7 @@ static void run(PyroVM* vm) {
                     break;
                 }
 
+                class->layout_id = pyro_new_layout_id(vm);
                 pyro_pop(vm);
                 break;
             }
@@ -2363,11 +4019,13 @@ static void run(PyroVM* vm) {
             // Defines a public field on a class.
             // Before: [ ... ][ class_object ][ default_value ]
             // After:  [ ... ][ class_object ]
-            case PYRO_OPCODE_DEFINE_PUB_FIELD: {
+            TARGET(PYRO_OPCODE_DEFINE_PUB_FIELD): {
                 PyroValue default_value = vm->stack_top[-1];
                 PyroClass* class = PYRO_AS_CLASS(vm->stack_top[-2]);
 
                 PyroStr* field_name = READ_STRING();
+                SAVE_IP();
+
                 if (PyroMap_contains(class->all_field_indexes, pyro_obj(field_name), vm)) {
                     pyro_panic(vm, "the field '%s' already exists", field_name->bytes);
                     break;
@@ -2392,6 +4050,7 @@ static void run(PyroVM* vm) {
                     break;
                 }
 
+                class->layout_id = pyro_new_layout_id(vm);
                 pyro_pop(vm);
                 break;
             }
@@ -2399,11 +4058,13 @@ static void run(PyroVM* vm) {
             // Defines a static field on a class.
             // Before: [ ... ][ class_object ][ default_value ]
             // After:  [ ... ][ class_object ]
-            case PYRO_OPCODE_DEFINE_STATIC_FIELD: {
+            TARGET(PYRO_OPCODE_DEFINE_STATIC_FIELD): {
                 PyroValue default_value = vm->stack_top[-1];
                 PyroClass* class = PYRO_AS_CLASS(vm->stack_top[-2]);
 
                 PyroStr* field_name = READ_STRING();
+                SAVE_IP();
+
                 if (PyroMap_contains(class->static_fields, pyro_obj(field_name), vm)) {
                     pyro_panic(vm, "the static field '%s' already exists", field_name->bytes);
                     break;
@@ -2421,9 +4082,10 @@ static void run(PyroVM* vm) {
             // Defines a private global variable.
             // Before: [ ... ][ value ]
             // After:  [ ... ]
-            case PYRO_OPCODE_DEFINE_PRI_GLOBAL: {
+            TARGET(PYRO_OPCODE_DEFINE_PRI_GLOBAL): {
                 PyroMod* module = frame->closure->module;
                 PyroValue name = READ_CONSTANT();
+                SAVE_IP();
 
                 if (strcmp(PYRO_AS_STR(name)->bytes, "_") == 0) {
                     pyro_pop(vm);
@@ -2447,6 +4109,7 @@ static void run(PyroVM* vm) {
                     break;
                 }
 
+                module->layout_id = pyro_new_layout_id(vm);
                 pyro_pop(vm);
                 break;
             }
@@ -2454,9 +4117,10 @@ static void run(PyroVM* vm) {
             // Defines a public global variable.
             // Before: [ ... ][ value ]
             // After:  [ ... ]
-            case PYRO_OPCODE_DEFINE_PUB_GLOBAL: {
+            TARGET(PYRO_OPCODE_DEFINE_PUB_GLOBAL): {
                 PyroMod* module = frame->closure->module;
                 PyroValue name = READ_CONSTANT();
+                SAVE_IP();
 
                 if (strcmp(PYRO_AS_STR(name)->bytes, "_") == 0) {
                     pyro_pop(vm);
@@ -2487,6 +4151,7 @@ static void run(PyroVM* vm) {
                     break;
                 }
 
+                module->layout_id = pyro_new_layout_id(vm);
                 pyro_pop(vm);
                 break;
             }
@@ -2494,9 +4159,10 @@ static void run(PyroVM* vm) {
             // Defines multiple private global variables.
             // Before: [ ... ][ value1 ][ value2 ][ value3 ]
             // After:  [ ... ]
-            case PYRO_OPCODE_DEFINE_PRI_GLOBALS: {
+            TARGET(PYRO_OPCODE_DEFINE_PRI_GLOBALS): {
                 PyroMod* module = frame->closure->module;
                 uint8_t count = READ_BYTE();
+                SAVE_IP();
 
                 for (uint8_t i = 0; i < count; i++) {
                     PyroValue name = READ_CONSTANT();
@@ -2524,6 +4190,8 @@ static void run(PyroVM* vm) {
                     }
                 }
 
+                module->layout_id = pyro_new_layout_id(vm);
+                SAVE_IP();
                 vm->stack_top -= count;
                 break;
             }
@@ -2531,9 +4199,10 @@ static void run(PyroVM* vm) {
             // Defines multiple public global variables.
             // Before: [ ... ][ value1 ][ value2 ][ value3 ]
             // After:  [ ... ]
-            case PYRO_OPCODE_DEFINE_PUB_GLOBALS: {
+            TARGET(PYRO_OPCODE_DEFINE_PUB_GLOBALS): {
                 PyroMod* module = frame->closure->module;
                 uint8_t count = READ_BYTE();
+                SAVE_IP();
 
                 for (uint8_t i = 0; i < count; i++) {
                     PyroValue name = READ_CONSTANT();
@@ -2568,6 +4237,8 @@ static void run(PyroVM* vm) {
                     }
                 }
 
+                module->layout_id = pyro_new_layout_id(vm);
+                SAVE_IP();
                 vm->stack_top -= count;
                 break;
             }
@@ -2575,8 +4246,9 @@ static void run(PyroVM* vm) {
             // Implements [echo value1, value2, value3].
             // Before: [ ... ][ value1 ][ value2 ][ value3 ]
             // After:  [ ... ]
-            case PYRO_OPCODE_ECHO: {
+            TARGET(PYRO_OPCODE_ECHO): {
                 int arg_count = (int)READ_BYTE();
+                SAVE_IP();
 
                 for (int i = 0; i < arg_count; i++) {
                     PyroValue value = vm->stack_top[-arg_count + i];
@@ -2608,7 +4280,8 @@ static void run(PyroVM* vm) {
             // Special opcode for printing the value of expression statements in the REPL.
             // Before: [ ... ][ value ]
             // After:  [ ... ]
-            case PYRO_OPCODE_POP_ECHO_IN_REPL: {
+            TARGET(PYRO_OPCODE_POP_ECHO_IN_REPL): {
+                SAVE_IP();
                 PyroValue value = vm->stack_top[-1];
 
                 if (vm->in_repl && !PYRO_IS_NULL(value)) {
@@ -2626,9 +4299,10 @@ static void run(PyroVM* vm) {
             // Unpack a container, i.e. push [count] values from the container onto the stack.
             // Before: [ ... ][ container ]
             // After:  [ ... ][ value1 ][ value2 ][ value3 ]
-            case PYRO_OPCODE_UNPACK: {
+            TARGET(PYRO_OPCODE_UNPACK): {
                 PyroValue container = pyro_pop(vm);
                 uint8_t count = READ_BYTE();
+                SAVE_IP();
 
                 if (PYRO_IS_TUP(container)) {
                     PyroTup* tup = PYRO_AS_TUP(container);
@@ -2671,9 +4345,10 @@ static void run(PyroVM* vm) {
             // The import path is stored on the stack as an array of [arg_count] strings.
             // Before: [ ... ][ name1 ][ name2 ][ name3 ]
             // After:  [ ... ][ module ]
-            case PYRO_OPCODE_IMPORT_MODULE: {
+            TARGET(PYRO_OPCODE_IMPORT_MODULE): {
                 uint8_t arg_count = READ_BYTE();
                 PyroValue* args = vm->stack_top - arg_count;
+                SAVE_IP();
 
                 PyroMod* module = load_module(vm, args, arg_count);
                 if (vm->halt_flag) {
@@ -2689,10 +4364,11 @@ static void run(PyroVM* vm) {
             // The import path is stored on the stack as an array of [module_count] strings.
             // Before: [ ... ][ module_name1 ][ module_name2 ][ member_name1 ][ member_name2 ]
             // After:  [ ... ][ member_value1 ][ member_value2 ]
-            case PYRO_OPCODE_IMPORT_NAMED_MEMBERS: {
+            TARGET(PYRO_OPCODE_IMPORT_NAMED_MEMBERS): {
                 uint8_t module_count = READ_BYTE();
                 uint8_t member_count = READ_BYTE();
                 PyroValue* args = vm->stack_top - module_count - member_count;
+                SAVE_IP();
 
                 PyroMod* module = load_module(vm, args, module_count);
                 if (vm->halt_flag) {
@@ -2709,7 +4385,7 @@ static void run(PyroVM* vm) {
                         pyro_panic(vm, "module has no member '%s'", PYRO_AS_STR(member_name)->bytes);
                         break;
                     }
-                    args[i] = module->members->values[member_index.as.i64];
+                    args[i] = module->members->values[PYRO_AS_I64(member_index)];
                 }
 
                 vm->stack_top -= module_count;
@@ -2719,7 +4395,8 @@ static void run(PyroVM* vm) {
             // Implements: [try <expression>].
             // Before: [ ... ][ closure_object ]
             // After:  [ ... ][ return_value ]
-            case PYRO_OPCODE_TRY: {
+            TARGET(PYRO_OPCODE_TRY): {
+                SAVE_IP();
                 size_t stashed_stack_count = vm->stack_top - vm->stack;
                 size_t stashed_call_stack_count = vm->call_stack_count;
 
@@ -2777,9 +4454,10 @@ static void run(PyroVM* vm) {
             // Wraps a PyroFn function in a PyroClosure object and pushes it onto the stack.
             // Before: [ ... ]
             // After:  [ ... ][ closure_object ]
-            case PYRO_OPCODE_MAKE_CLOSURE: {
+            TARGET(PYRO_OPCODE_MAKE_CLOSURE): {
                 PyroFn* fn = PYRO_AS_PYRO_FN(READ_CONSTANT());
                 PyroMod* module = frame->closure->module;
+                SAVE_IP();
 
                 PyroClosure* closure = PyroClosure_new(vm, fn, module);
                 if (!closure) {
@@ -2797,6 +4475,7 @@ static void run(PyroVM* vm) {
                     }
                 }
 
+                SAVE_IP();
                 pyro_push(vm, pyro_obj(closure));
                 break;
             }
@@ -2804,9 +4483,10 @@ static void run(PyroVM* vm) {
             // Wraps a PyroFn function in a PyroClosure object and pushes it onto the stack.
             // Before: [ ... ][ default_value1 ][ default_value2 ][ default_value3 ]
             // After:  [ ... ][ closure_object ]
-            case PYRO_OPCODE_MAKE_CLOSURE_WITH_DEFAULT_ARGS: {
+            TARGET(PYRO_OPCODE_MAKE_CLOSURE_WITH_DEFAULT_ARGS): {
                 PyroFn* fn = PYRO_AS_PYRO_FN(READ_CONSTANT());
                 PyroMod* module = frame->closure->module;
+                SAVE_IP();
 
                 PyroClosure* closure = PyroClosure_new(vm, fn, module);
                 if (!closure) {
@@ -2834,6 +4514,7 @@ static void run(PyroVM* vm) {
                     }
                 }
 
+                SAVE_IP();
                 pyro_push(vm, pyro_obj(closure));
                 break;
             }
@@ -2841,35 +4522,37 @@ static void run(PyroVM* vm) {
             // Pops a local variable that has been captured by an upvalue.
             // Before: [ ... ][ local_variable ]
             // After:  [ ... ]
-            case PYRO_OPCODE_CLOSE_UPVALUE: {
+            TARGET(PYRO_OPCODE_CLOSE_UPVALUE): {
                 close_upvalues(vm, vm->stack_top - 1);
                 pyro_pop(vm);
-                break;
+                DISPATCH();
             }
 
             // Pushes the value of an upvalue onto the stack.
             // Before: [ ... ]
             // After:  [ ... ][ value ]
-            case PYRO_OPCODE_GET_UPVALUE: {
+            TARGET(PYRO_OPCODE_GET_UPVALUE): {
                 uint8_t index = READ_BYTE();
                 PyroValue value = *frame->closure->upvalues[index]->location;
-                pyro_push(vm, value);
-                break;
+                PUSH(value);
+                DISPATCH();
             }
 
             // Sets the value of an upvalue.
             // Before: [ ... ][ value ]
             // After:  [ ... ][ value ]
-            case PYRO_OPCODE_SET_UPVALUE: {
+            TARGET(PYRO_OPCODE_SET_UPVALUE): {
                 uint8_t index = READ_BYTE();
+                pyro_write_barrier(vm, (PyroObject*)frame->closure->upvalues[index], vm->stack_top[-1]);
                 *frame->closure->upvalues[index]->location = vm->stack_top[-1];
-                break;
+                DISPATCH();
             }
 
             // Pushes the value on top of the stack onto the with_stack.
             // Before: [ ... ][ receiver ]
             // After:  [ ... ][ receiver ]
-            case PYRO_OPCODE_START_WITH: {
+            TARGET(PYRO_OPCODE_START_WITH): {
+                SAVE_IP();
                 PyroValue receiver = vm->stack_top[-1];
 
                 PyroValue enter_method = pyro_get_method(vm, receiver, vm->str_dollar_enter);
@@ -2903,7 +4586,8 @@ static void run(PyroVM* vm) {
             // not by panicking or returning early.
             // Before: [ ... ]
             // After:  [ ... ]
-            case PYRO_OPCODE_END_WITH: {
+            TARGET(PYRO_OPCODE_END_WITH): {
+                SAVE_IP();
                 PyroValue receiver = vm->with_stack[vm->with_stack_count - 1];
                 call_exit_method(vm, receiver);
                 vm->with_stack_count--;
@@ -2913,18 +4597,19 @@ static void run(PyroVM* vm) {
             // Implements the expression: [left_operand i64_add right_operand].
             // Before: [ ... ][ left_operand ][ right_operand ]
             // After:  [ ... ][ result ]
-            case PYRO_OPCODE_I64_ADD: {
-                vm->stack_top[-2] = pyro_i64(vm->stack_top[-2].as.i64 + vm->stack_top[-1].as.i64);
+            TARGET(PYRO_OPCODE_I64_ADD): {
+                vm->stack_top[-2] = pyro_i64(PYRO_AS_I64(vm->stack_top[-2]) + PYRO_AS_I64(vm->stack_top[-1]));
                 vm->stack_top--;
-                break;
+                DISPATCH();
             }
 
             // Pushes a new enum object onto the stack.
             // Before: [ ... ][ name1 ][ value1 ][ name2 ][ value2 ]
             // After:  [ ... ][ enum ]
-            case PYRO_OPCODE_MAKE_ENUM: {
+            TARGET(PYRO_OPCODE_MAKE_ENUM): {
                 uint16_t value_count = READ_BE_U16();
                 PyroStr* enum_type_name = READ_STRING();
+                SAVE_IP();
 
                 PyroEnumType* enum_type = PyroEnumType_new(enum_type_name, vm);
                 if (!enum_type) {
@@ -2964,52 +4649,53 @@ static void run(PyroVM* vm) {
             // Checks if the value on top of the stack is an error.
             // Before: [ ... ][ value ]
             // After:  [ ... ][ bool ]
-            case PYRO_OPCODE_IS_ERR: {
+            TARGET(PYRO_OPCODE_IS_ERR): {
                 PyroValue result = pyro_bool(PYRO_IS_ERR(vm->stack_top[-1]));
                 vm->stack_top[-1] = result;
-                break;
+                DISPATCH();
             }
 
             // Checks if the value on top of the stack is a string.
             // Before: [ ... ][ value ]
             // After:  [ ... ][ bool ]
-            case PYRO_OPCODE_IS_STR: {
+            TARGET(PYRO_OPCODE_IS_STR): {
                 PyroValue result = pyro_bool(PYRO_IS_STR(vm->stack_top[-1]));
                 vm->stack_top[-1] = result;
-                break;
+                DISPATCH();
             }
 
             // Checks if the value on top of the stack is a rune.
             // Before: [ ... ][ value ]
             // After:  [ ... ][ bool ]
-            case PYRO_OPCODE_IS_RUNE: {
+            TARGET(PYRO_OPCODE_IS_RUNE): {
                 PyroValue result = pyro_bool(PYRO_IS_RUNE(vm->stack_top[-1]));
                 vm->stack_top[-1] = result;
-                break;
+                DISPATCH();
             }
 
             // Checks if the value on top of the stack is an i64.
             // Before: [ ... ][ value ]
             // After:  [ ... ][ bool ]
-            case PYRO_OPCODE_IS_I64: {
+            TARGET(PYRO_OPCODE_IS_I64): {
                 PyroValue result = pyro_bool(PYRO_IS_I64(vm->stack_top[-1]));
                 vm->stack_top[-1] = result;
-                break;
+                DISPATCH();
             }
 
             // Checks if the value on top of the stack is an f64.
             // Before: [ ... ][ value ]
             // After:  [ ... ][ bool ]
-            case PYRO_OPCODE_IS_F64: {
+            TARGET(PYRO_OPCODE_IS_F64): {
                 PyroValue result = pyro_bool(PYRO_IS_F64(vm->stack_top[-1]));
                 vm->stack_top[-1] = result;
-                break;
+                DISPATCH();
             }
 
             // Converts the value on top of the stack into a string.
             // Before: [ ... ][ value ]
             // After:  [ ... ][ str ]
-            case PYRO_OPCODE_MAKE_STR: {
+            TARGET(PYRO_OPCODE_MAKE_STR): {
+                SAVE_IP();
                 PyroStr* string = pyro_stringify_value(vm, vm->stack_top[-1]);
                 if (vm->halt_flag) {
                     break;
@@ -3021,45 +4707,46 @@ static void run(PyroVM* vm) {
             // This is an optimized opcode for calling the receiver's count() method.
             // Before: [ ... ][ receiver ]
             // After:  [ ... ][ return_value ]
-            case PYRO_OPCODE_CALL_COUNT: {
+            TARGET(PYRO_OPCODE_CALL_COUNT): {
+                SAVE_IP();
                 PyroValue receiver = vm->stack_top[-1];
 
                 if (PYRO_IS_OBJ(receiver)) {
-                    switch (receiver.as.obj->type) {
+                    switch (PYRO_AS_OBJ(receiver)->type) {
                         case PYRO_OBJECT_STR: {
-                            PyroStr* str = (PyroStr*)receiver.as.obj;
+                            PyroStr* str = (PyroStr*)PYRO_AS_OBJ(receiver);
                             vm->stack_top[-1] = pyro_i64(str->count);
                             break;
                         }
 
                         case PYRO_OBJECT_BUF: {
-                            PyroBuf* buf = (PyroBuf*)receiver.as.obj;
+                            PyroBuf* buf = (PyroBuf*)PYRO_AS_OBJ(receiver);
                             vm->stack_top[-1] = pyro_i64(buf->count);
                             break;
                         }
 
                         case PYRO_OBJECT_TUP: {
-                            PyroTup* tup = (PyroTup*)receiver.as.obj;
+                            PyroTup* tup = (PyroTup*)PYRO_AS_OBJ(receiver);
                             vm->stack_top[-1] = pyro_i64(tup->count);
                             break;
                         }
 
                         case PYRO_OBJECT_VEC:
                         case PYRO_OBJECT_VEC_AS_STACK: {
-                            PyroVec* vec = (PyroVec*)receiver.as.obj;
+                            PyroVec* vec = (PyroVec*)PYRO_AS_OBJ(receiver);
                             vm->stack_top[-1] = pyro_i64(vec->count);
                             break;
                         }
 
                         case PYRO_OBJECT_MAP:
                         case PYRO_OBJECT_MAP_AS_SET: {
-                            PyroMap* map = (PyroMap*)receiver.as.obj;
+                            PyroMap* map = (PyroMap*)PYRO_AS_OBJ(receiver);
                             vm->stack_top[-1] = pyro_i64(map->live_entry_count);
                             break;
                         }
 
                         case PYRO_OBJECT_QUEUE: {
-                            PyroQueue* queue = (PyroQueue*)receiver.as.obj;
+                            PyroQueue* queue = (PyroQueue*)PYRO_AS_OBJ(receiver);
                             vm->stack_top[-1] = pyro_i64(queue->count);
                             break;
                         }
@@ -3094,7 +4781,7 @@ static void run(PyroVM* vm) {
                             break;
                         }
                     }
-                    break;
+                    SAFEPOINT();
                 }
 
                 pyro_panic(vm,
@@ -3107,9 +4794,10 @@ static void run(PyroVM* vm) {
             // Initializes an instance from an object literal.
             // Before: [ ... ][ class ][ name1 ][ value1 ][ name2 ][ value2 ]
             // After:  [ ... ][ instance ]
-            case PYRO_OPCODE_MAKE_OBJECT: {
+            TARGET(PYRO_OPCODE_MAKE_OBJECT): {
                 uint16_t count = READ_BE_U16();
                 PyroValue class_value = vm->stack_top[(int)count * -2 - 1];
+                SAVE_IP();
 
                 if (!PYRO_IS_CLASS(class_value)) {
                     pyro_panic(vm,
@@ -3134,7 +4822,8 @@ static void run(PyroVM* vm) {
                     PyroValue field_index;
 
                     if (PyroMap_fast_get(instance->obj.class->pub_field_indexes, PYRO_AS_STR(field_name), &field_index, vm)) {
-                        instance->fields[field_index.as.i64] = field_value;
+                        pyro_write_barrier(vm, (PyroObject*)instance, field_value);
+                        instance->fields[PYRO_AS_I64(field_index)] = field_value;
                     } else if (PyroMap_fast_get(instance->obj.class->all_field_indexes, PYRO_AS_STR(field_name), &field_index, vm)) {
                         pyro_panic(vm,
                             "in object literal: field '%s' in class %s is private",
@@ -3158,6 +4847,9 @@ static void run(PyroVM* vm) {
             }
 
             default:
+            #ifdef PYRO_DISPATCH_WITH_COMPUTED_GOTOS
+                TARGET_INVALID_OPCODE:
+            #endif
                 pyro_panic(vm, "invalid opcode");
                 break;
         }
@@ -3184,12 +4876,22 @@ static void run(PyroVM* vm) {
         vm->with_stack_count--;
     }
 
+    #undef DISPATCH
+    #undef TARGET
+    #undef SAFEPOINT
+    #undef PUSH
+    #undef SAVE_IP
+    #undef READ_INLINE_CACHE
     #undef READ_BE_U16
     #undef READ_STRING
     #undef READ_CONSTANT
     #undef READ_BYTE
 }
 
+#ifdef PYRO_DISPATCH_WITH_COMPUTED_GOTOS
+    #pragma GCC diagnostic pop
+#endif
+
 
 void pyro_reset_vm(PyroVM* vm) {
     vm->memory_allocation_failed = false;
@@ -3214,16 +4916,8 @@ void pyro_try_compile_file(PyroVM* vm, const char* path, bool dump_bytecode) {
 }
 
 
-void pyro_exec_code(PyroVM* vm, const char* code, size_t code_length, const char* source_id, PyroMod* module) {
-    if (!module) {
-        module = vm->main_module;
-    }
-
-    PyroFn* fn = pyro_compile(vm, code, code_length, source_id, false);
-    if (vm->halt_flag) {
-        return;
-    }
-
+// Executes the compiled module-level function [fn] in the context of [module].
+static void exec_fn(PyroVM* vm, PyroFn* fn, PyroMod* module) {
     PyroClosure* closure = PyroClosure_new(vm, fn, module);
     if (!closure) {
         pyro_panic(vm, "out of memory");
@@ -3248,7 +4942,21 @@ void pyro_exec_code(PyroVM* vm, const char* code, size_t code_length, const char
 }
 
 
-void pyro_exec_file(PyroVM* vm, const char* path, PyroMod* module) {
+void pyro_exec_code(PyroVM* vm, const char* code, size_t code_length, const char* source_id, PyroMod* module) {
+    if (!module) {
+        module = vm->main_module;
+    }
+
+    PyroFn* fn = pyro_compile(vm, code, code_length, source_id, false);
+    if (vm->halt_flag) {
+        return;
+    }
+
+    exec_fn(vm, fn, module);
+}
+
+
+static void exec_file(PyroVM* vm, const char* path, PyroMod* module, bool use_bytecode_cache) {
     if (!module) {
         module = vm->main_module;
     }
@@ -3269,9 +4977,33 @@ void pyro_exec_file(PyroVM* vm, const char* path, PyroMod* module) {
         return;
     }
 
-    if (!pyro_push(vm, pyro_obj(buf))) return;
-    pyro_exec_code(vm, (char*)buf->bytes, buf->count, path, module);
-    pyro_pop(vm);
+    if (!use_bytecode_cache) {
+        if (!pyro_push(vm, pyro_obj(buf))) return;
+        pyro_exec_code(vm, (char*)buf->bytes, buf->count, path, module);
+        pyro_pop(vm);
+        return;
+    }
+
+    PyroFn* fn = pyro_load_bytecode_cache(vm, path, buf->bytes, buf->count);
+    if (!fn) {
+        fn = pyro_compile(vm, (char*)buf->bytes, buf->count, path, false);
+        if (vm->halt_flag) {
+            return;
+        }
+        pyro_write_bytecode_cache(vm, path, buf->bytes, buf->count, fn);
+    }
+
+    exec_fn(vm, fn, module);
+}
+
+
+void pyro_exec_file(PyroVM* vm, const char* path, PyroMod* module) {
+    exec_file(vm, path, module, false);
+}
+
+
+void pyro_exec_module_file(PyroVM* vm, const char* path, PyroMod* module) {
+    exec_file(vm, path, module, vm->use_bytecode_cache);
 }
 
 
@@ -3324,7 +5056,7 @@ void pyro_run_main_func(PyroVM* vm) {
         return;
     }
 
-    PyroValue main_value = vm->main_module->members->values[main_index.as.i64];
+    PyroValue main_value = vm->main_module->members->values[PYRO_AS_I64(main_index)];
     if (!PYRO_IS_CLOSURE(main_value)) {
         pyro_panic(vm,
             "invalid type for $main, '%s', expected a function",
@@ -3413,12 +5145,12 @@ bool pyro_reallocate_stack(PyroVM* vm) {
 #ifdef PYRO_DEBUG_STRESS_STACK_REALLOCATION
     bool pyro_move_stack(PyroVM* vm) {
         size_t stack_capacity = vm->stack_max - vm->stack;
-        size_t stack_capacity_bytes = stack_capacity * sizeof(PyroValue);
 
         size_t stack_count = vm->stack_top - vm->stack;
         size_t stack_count_bytes = stack_count * sizeof(PyroValue);
 
-        PyroValue* new_stack = malloc(stack_capacity_bytes);
+        // The stack is allocated by pyro_realloc() so it may belong to a pool.
+        PyroValue* new_stack = PYRO_ALLOCATE_ARRAY(vm, PyroValue, stack_capacity);
         if (!new_stack) {
             return false;
         }
@@ -3441,7 +5173,7 @@ bool pyro_reallocate_stack(PyroVM* vm) {
             upvalue->location = new_stack + location_offset;
         }
 
-        free(old_stack);
+        PYRO_FREE_ARRAY(vm, PyroValue, old_stack, stack_capacity);
         return true;
     }
 #endif
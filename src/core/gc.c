@@ -1,11 +1,138 @@
 #include "../includes/pyro.h"
+#include <pthread.h>
 
 
-// Marks an object as reachable. This sets the object's [is_marked] flag and pushes it onto the
-// grey stack. This function will set the panic flag BUT NOT call pyro_panic() if an attempt to
+// A worker's stack of grey objects waiting to be blackened during a parallel mark. The owner
+// pushes and pops objects on its private [stack] without locking. When the private stack grows
+// large, the owner moves part of it to the [shared] stack where other workers can steal it.
+// - The [shared] stack is guarded by [lock]. [shared_count] is also read without the lock to
+//   check for work.
+// - These stacks are allocated with malloc() as the VM's allocator isn't thread-safe.
+typedef struct {
+    struct PyroMarkPool* pool;
+    size_t index;
+    pthread_t thread;
+
+    PyroObject** stack;
+    size_t stack_count;
+    size_t stack_capacity;
+
+    pthread_mutex_t lock;
+    PyroObject** shared;
+    size_t shared_count;
+    size_t shared_capacity;
+} MarkWorker;
+
+
+// The pool of threads used to mark the heap in parallel. Worker 0 is the VM's own thread; the
+// other workers each have a thread which sleeps between collections.
+typedef struct PyroMarkPool {
+    PyroVM* vm;
+    MarkWorker* workers;
+    size_t worker_count;
+
+    // Guards the fields below, apart from [idle_count] and [failed] which are also read
+    // atomically without the lock.
+    pthread_mutex_t lock;
+
+    // Signalled when a new mark phase starts or the pool is shutting down.
+    pthread_cond_t start_cond;
+
+    // Signalled when work is shared with idle workers or the mark phase is complete.
+    pthread_cond_t idle_cond;
+
+    // Signalled when a worker thread finishes its part of a mark phase.
+    pthread_cond_t finished_cond;
+
+    size_t phase;
+    size_t idle_count;
+    size_t finished_count;
+    bool is_done;
+    bool is_shutting_down;
+
+    // Set if a worker fails to grow its stack. The collection is abandoned.
+    bool failed;
+} PyroMarkPool;
+
+
+// The worker running on the current thread during a parallel mark.
+static _Thread_local MarkWorker* current_worker = NULL;
+
+
+// A worker only shares objects when its private stack holds more than this many.
+#define MARK_SHARE_THRESHOLD 64
+
+
+static bool grow_object_array(PyroObject*** array, size_t* capacity, size_t min_capacity) {
+    size_t new_capacity = *capacity;
+    while (new_capacity < min_capacity) {
+        new_capacity = pyro_grow_capacity(new_capacity);
+    }
+
+    PyroObject** new_array = realloc(*array, sizeof(PyroObject*) * new_capacity);
+    if (!new_array) {
+        return false;
+    }
+
+    *array = new_array;
+    *capacity = new_capacity;
+    return true;
+}
+
+
+// The parallel version of mark_object(). The mark bit is set atomically so exactly one worker
+// pushes each object.
+static void mark_object_in_parallel(PyroVM* vm, PyroObject* object) {
+    uint64_t bit;
+    PyroHeapBitmap* bitmap = pyro_get_bitmap(object, &bit);
+
+    if (__atomic_load_n(&bitmap->marked, __ATOMIC_RELAXED) & bit) {
+        return;
+    }
+
+    if (vm->gc_is_minor && (bitmap->old & bit)) {
+        return;
+    }
+
+    if (__atomic_fetch_or(&bitmap->marked, bit, __ATOMIC_RELAXED) & bit) {
+        return;
+    }
+
+    MarkWorker* worker = current_worker;
+    if (worker->stack_count == worker->stack_capacity) {
+        if (!grow_object_array(&worker->stack, &worker->stack_capacity, worker->stack_count + 1)) {
+            __atomic_store_n(&worker->pool->failed, true, __ATOMIC_RELAXED);
+            return;
+        }
+    }
+
+    worker->stack[worker->stack_count++] = object;
+}
+
+
+// Marks an object as reachable. This sets the object's mark bit and pushes it onto the grey
+// stack. This function will set the panic flag BUT NOT call pyro_panic() if an attempt to
 // allocate memory for the grey stack fails.
+// - During a minor collection, old objects are skipped. Any references they hold to young objects
+//   are found via the remembered set.
 static void mark_object(PyroVM* vm, PyroObject* object) {
-    if (object == NULL || object->is_marked || vm->panic_flag) {
+    if (object == NULL || vm->panic_flag) {
+        return;
+    }
+
+    if (vm->gc_is_parallel) {
+        mark_object_in_parallel(vm, object);
+        return;
+    }
+
+    uint64_t bit;
+    PyroHeapBitmap* bitmap = pyro_get_bitmap(object, &bit);
+
+    if (bitmap->marked & bit) {
+        return;
+    }
+
+    if (vm->gc_is_minor && (bitmap->old & bit)) {
         return;
     }
 
@@ -20,7 +147,7 @@ static void mark_object(PyroVM* vm, PyroObject* object) {
         vm->grey_stack = new_array;
     }
 
-    object->is_marked = true;
+    bitmap->marked |= bit;
     vm->grey_stack[vm->grey_stack_count++] = object;
 }
 
@@ -295,8 +422,16 @@ static void blacken_object(PyroVM* vm, PyroObject* object) {
             break;
         }
 
-        case PYRO_OBJECT_STR:
+        case PYRO_OBJECT_STR: {
+            PyroStr* string = (PyroStr*)object;
+            if (string->is_rope) {
+                mark_object(vm, (PyroObject*)string->rope_left);
+                mark_object(vm, (PyroObject*)string->rope_right);
+            } else if (string->is_slice) {
+                mark_object(vm, (PyroObject*)string->slice_parent);
+            }
             break;
+        }
 
         case PYRO_OBJECT_TUP: {
             PyroTup* tup = (PyroTup*)object;
@@ -360,53 +495,480 @@ static void trace_references(PyroVM* vm) {
 }
 
 
-static void sweep(PyroVM* vm) {
-    PyroObject* previous = NULL;
-    PyroObject* object = vm->objects;
+// Moves the older half of the worker's private stack to its shared stack, where idle workers can
+// steal it, and wakes any idle workers.
+static void share_work(MarkWorker* worker) {
+    PyroMarkPool* pool = worker->pool;
+    size_t count = worker->stack_count / 2;
+
+    pthread_mutex_lock(&worker->lock);
+    if (worker->shared_count + count > worker->shared_capacity) {
+        if (!grow_object_array(&worker->shared, &worker->shared_capacity, worker->shared_count + count)) {
+            pthread_mutex_unlock(&worker->lock);
+            return;
+        }
+    }
+    memcpy(&worker->shared[worker->shared_count], worker->stack, sizeof(PyroObject*) * count);
+    __atomic_store_n(&worker->shared_count, worker->shared_count + count, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&worker->lock);
+
+    worker->stack_count -= count;
+    memmove(worker->stack, &worker->stack[count], sizeof(PyroObject*) * worker->stack_count);
+
+    // An idle worker increments [idle_count] before checking for shared work, so either it sees
+    // the new work or we see that it's idle.
+    if (__atomic_load_n(&pool->idle_count, __ATOMIC_SEQ_CST) > 0) {
+        pthread_mutex_lock(&pool->lock);
+        pthread_cond_broadcast(&pool->idle_cond);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+
+// Moves shared objects to the worker's private stack, taking back its own shared objects first,
+// then stealing half the shared objects of another worker. Returns false if there's nothing to
+// take.
+static bool steal_work(MarkWorker* worker) {
+    PyroMarkPool* pool = worker->pool;
+
+    for (size_t i = 0; i < pool->worker_count; i++) {
+        MarkWorker* victim = &pool->workers[(worker->index + i) % pool->worker_count];
+        if (__atomic_load_n(&victim->shared_count, __ATOMIC_SEQ_CST) == 0) {
+            continue;
+        }
+
+        pthread_mutex_lock(&victim->lock);
+
+        size_t count = victim == worker ? victim->shared_count : (victim->shared_count + 1) / 2;
+        if (count == 0) {
+            pthread_mutex_unlock(&victim->lock);
+            continue;
+        }
 
-    while (object != NULL) {
-        if (object->is_marked) {
-            object->is_marked = false;
-            previous = object;
-            object = object->next;
-        } else {
-            PyroObject* not_marked = object;
-            object = object->next;
-            if (previous == NULL) {
-                vm->objects = object;
-            } else {
-                previous->next = object;
+        if (worker->stack_count + count > worker->stack_capacity) {
+            if (!grow_object_array(&worker->stack, &worker->stack_capacity, worker->stack_count + count)) {
+                pthread_mutex_unlock(&victim->lock);
+                __atomic_store_n(&pool->failed, true, __ATOMIC_RELAXED);
+                return false;
             }
-            pyro_free_object(vm, not_marked);
         }
+
+        size_t remaining = victim->shared_count - count;
+        memcpy(&worker->stack[worker->stack_count], &victim->shared[remaining], sizeof(PyroObject*) * count);
+        worker->stack_count += count;
+        __atomic_store_n(&victim->shared_count, remaining, __ATOMIC_SEQ_CST);
+
+        pthread_mutex_unlock(&victim->lock);
+        return true;
     }
+
+    return false;
 }
 
 
-static void undo_mark_objects(PyroVM* vm) {
-    PyroObject* obj = vm->objects;
-    while (obj != NULL) {
-        obj->is_marked = false;
-        obj = obj->next;
+static bool has_shared_work(PyroMarkPool* pool) {
+    for (size_t i = 0; i < pool->worker_count; i++) {
+        if (__atomic_load_n(&pool->workers[i].shared_count, __ATOMIC_SEQ_CST) > 0) {
+            return true;
+        }
     }
+    return false;
 }
 
 
-void pyro_collect_garbage(PyroVM* vm) {
-    assert(vm->grey_stack_count == 0);
+// Waits until another worker shares some objects. Returns false if the mark phase is complete --
+// i.e. every worker is idle with no shared objects left -- or has failed.
+static bool wait_for_work(MarkWorker* worker) {
+    PyroMarkPool* pool = worker->pool;
 
-    if (vm->gc_disallows > 0 || vm->panic_flag) {
+    pthread_mutex_lock(&pool->lock);
+    __atomic_add_fetch(&pool->idle_count, 1, __ATOMIC_SEQ_CST);
+
+    while (true) {
+        if (pool->is_done) {
+            pthread_mutex_unlock(&pool->lock);
+            return false;
+        }
+
+        bool failed = __atomic_load_n(&pool->failed, __ATOMIC_RELAXED);
+
+        if (!failed && has_shared_work(pool)) {
+            __atomic_sub_fetch(&pool->idle_count, 1, __ATOMIC_SEQ_CST);
+            pthread_mutex_unlock(&pool->lock);
+            return true;
+        }
+
+        if (failed || pool->idle_count == pool->worker_count) {
+            pool->is_done = true;
+            pthread_cond_broadcast(&pool->idle_cond);
+            pthread_mutex_unlock(&pool->lock);
+            return false;
+        }
+
+        pthread_cond_wait(&pool->idle_cond, &pool->lock);
+    }
+}
+
+
+// Runs a worker's part of a parallel mark phase.
+static void run_mark_worker(MarkWorker* worker) {
+    PyroMarkPool* pool = worker->pool;
+    current_worker = worker;
+
+    while (true) {
+        while (worker->stack_count > 0) {
+            if (__atomic_load_n(&pool->failed, __ATOMIC_RELAXED)) {
+                break;
+            }
+
+            PyroObject* object = worker->stack[--worker->stack_count];
+            blacken_object(pool->vm, object);
+
+            if (worker->stack_count > MARK_SHARE_THRESHOLD && __atomic_load_n(&worker->shared_count, __ATOMIC_RELAXED) == 0) {
+                share_work(worker);
+            }
+        }
+
+        if (__atomic_load_n(&pool->failed, __ATOMIC_RELAXED) || !steal_work(worker)) {
+            if (!wait_for_work(worker)) {
+                break;
+            }
+        }
+    }
+
+    current_worker = NULL;
+}
+
+
+static void* run_mark_thread(void* arg) {
+    MarkWorker* worker = arg;
+    PyroMarkPool* pool = worker->pool;
+    size_t phase = 0;
+
+    pthread_mutex_lock(&pool->lock);
+
+    while (true) {
+        while (pool->phase == phase && !pool->is_shutting_down) {
+            pthread_cond_wait(&pool->start_cond, &pool->lock);
+        }
+
+        if (pool->is_shutting_down) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+
+        phase = pool->phase;
+        pthread_mutex_unlock(&pool->lock);
+
+        run_mark_worker(worker);
+
+        pthread_mutex_lock(&pool->lock);
+        pool->finished_count++;
+        pthread_cond_signal(&pool->finished_cond);
+    }
+}
+
+
+// Stops the first [thread_count] worker threads and frees the pool.
+static void free_mark_pool(PyroMarkPool* pool, size_t thread_count) {
+    pthread_mutex_lock(&pool->lock);
+    pool->is_shutting_down = true;
+    pthread_cond_broadcast(&pool->start_cond);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (size_t i = 1; i <= thread_count; i++) {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+
+    for (size_t i = 0; i < pool->worker_count; i++) {
+        pthread_mutex_destroy(&pool->workers[i].lock);
+        free(pool->workers[i].stack);
+        free(pool->workers[i].shared);
+    }
+
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->start_cond);
+    pthread_cond_destroy(&pool->idle_cond);
+    pthread_cond_destroy(&pool->finished_cond);
+    free(pool->workers);
+    free(pool);
+}
+
+
+void pyro_free_gc_mark_pool(PyroVM* vm) {
+    if (vm->gc_mark_pool) {
+        free_mark_pool(vm->gc_mark_pool, vm->gc_mark_pool->worker_count - 1);
+        vm->gc_mark_pool = NULL;
+    }
+}
+
+
+// Returns the VM's pool of marking threads, creating it if it doesn't exist or if the number of
+// threads has changed. Returns NULL if the pool can't be created.
+static PyroMarkPool* get_mark_pool(PyroVM* vm) {
+    if (vm->gc_mark_pool && vm->gc_mark_pool->worker_count == vm->gc_mark_threads) {
+        return vm->gc_mark_pool;
+    }
+
+    pyro_free_gc_mark_pool(vm);
+
+    PyroMarkPool* pool = malloc(sizeof(PyroMarkPool));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->workers = calloc(vm->gc_mark_threads, sizeof(MarkWorker));
+    if (!pool->workers) {
+        free(pool);
+        return NULL;
+    }
+
+    pool->vm = vm;
+    pool->worker_count = vm->gc_mark_threads;
+    pool->phase = 0;
+    pool->idle_count = 0;
+    pool->finished_count = 0;
+    pool->is_done = false;
+    pool->is_shutting_down = false;
+    pool->failed = false;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start_cond, NULL);
+    pthread_cond_init(&pool->idle_cond, NULL);
+    pthread_cond_init(&pool->finished_cond, NULL);
+
+    for (size_t i = 0; i < pool->worker_count; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+        pthread_mutex_init(&pool->workers[i].lock, NULL);
+    }
+
+    for (size_t i = 1; i < pool->worker_count; i++) {
+        if (pthread_create(&pool->workers[i].thread, NULL, run_mark_thread, &pool->workers[i]) != 0) {
+            free_mark_pool(pool, i - 1);
+            return NULL;
+        }
+    }
+
+    vm->gc_mark_pool = pool;
+    return pool;
+}
+
+
+// Returns true if a full collection should mark the heap in parallel.
+static bool use_parallel_mark(PyroVM* vm) {
+    #if PYRO_GC_PARALLEL_MARK_THRESHOLD > 0
+        return vm->gc_mark_threads > 1 && vm->bytes_allocated >= PYRO_GC_PARALLEL_MARK_THRESHOLD;
+    #else
+        return vm->gc_mark_threads > 1;
+    #endif
+}
+
+
+// Like trace_references() but blackens objects in parallel using the VM's pool of marking
+// threads. The grey objects are dealt out to the workers' shared stacks to start. Falls back to
+// trace_references() if the pool can't be created. Sets the panic flag if a worker fails to grow
+// its stack.
+static void trace_references_in_parallel(PyroVM* vm) {
+    PyroMarkPool* pool = get_mark_pool(vm);
+    if (!pool) {
+        trace_references(vm);
         return;
     }
 
+    for (size_t i = 0; i < vm->grey_stack_count; i++) {
+        MarkWorker* worker = &pool->workers[i % pool->worker_count];
+        if (worker->shared_count == worker->shared_capacity) {
+            if (!grow_object_array(&worker->shared, &worker->shared_capacity, worker->shared_count + 1)) {
+                pool->failed = true;
+                break;
+            }
+        }
+        worker->shared[worker->shared_count++] = vm->grey_stack[i];
+    }
+    vm->grey_stack_count = 0;
+
+    vm->gc_is_parallel = true;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->phase++;
+    pool->idle_count = 0;
+    pool->finished_count = 0;
+    pool->is_done = false;
+    pthread_cond_broadcast(&pool->start_cond);
+    pthread_mutex_unlock(&pool->lock);
+
+    run_mark_worker(&pool->workers[0]);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->finished_count < pool->worker_count - 1) {
+        pthread_cond_wait(&pool->finished_cond, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    vm->gc_is_parallel = false;
+
+    if (pool->failed) {
+        for (size_t i = 0; i < pool->worker_count; i++) {
+            pool->workers[i].stack_count = 0;
+            pool->workers[i].shared_count = 0;
+        }
+        pool->failed = false;
+        vm->panic_flag = true;
+    }
+}
+
+
+// Like trace_references() but stops once [budget] objects have been blackened or newly marked.
+// (An object is always blackened in one go, so a single large vector or map can exceed the
+// budget.)
+static void trace_some_references(PyroVM* vm, size_t budget) {
+    size_t work = 0;
+
+    while (vm->grey_stack_count > 0 && work < budget) {
+        PyroObject* object = vm->grey_stack[--vm->grey_stack_count];
+        size_t grey_stack_count = vm->grey_stack_count;
+        blacken_object(vm, object);
+        if (vm->panic_flag) {
+            return;
+        }
+        work += 1 + (vm->grey_stack_count - grey_stack_count);
+    }
+}
+
+
+// Marks every young object referenced by an object in the remembered set.
+static void mark_remembered_set(PyroVM* vm) {
+    for (size_t i = 0; i < vm->remembered_set_count; i++) {
+        blacken_object(vm, vm->remembered_set[i]);
+        if (vm->panic_flag) {
+            return;
+        }
+    }
+}
+
+
+static void clear_remembered_set(PyroVM* vm) {
+    for (size_t i = 0; i < vm->remembered_set_count; i++) {
+        vm->remembered_set[i]->is_remembered = false;
+    }
+    vm->remembered_set_count = 0;
+    vm->write_barrier_overflow = false;
+}
+
+
+void pyro_remember_object(PyroVM* vm, PyroObject* object) {
+    if (vm->remembered_set_count == vm->remembered_set_capacity) {
+        size_t new_capacity = pyro_grow_capacity(vm->remembered_set_capacity);
+        PyroObject** new_array = PYRO_REALLOCATE_ARRAY(vm, PyroObject*, vm->remembered_set, vm->remembered_set_capacity, new_capacity);
+        if (!new_array) {
+            // The next collection will be a full, non-incremental collection so we can safely
+            // drop the object.
+            vm->write_barrier_overflow = true;
+            return;
+        }
+        vm->remembered_set_capacity = new_capacity;
+        vm->remembered_set = new_array;
+    }
+
+    object->is_remembered = true;
+    vm->remembered_set[vm->remembered_set_count++] = object;
+}
+
+
+void pyro_mark_grey(PyroVM* vm, PyroObject* object) {
+    if (vm->grey_stack_count == vm->grey_stack_capacity) {
+        size_t new_capacity = pyro_grow_capacity(vm->grey_stack_capacity);
+        PyroObject** new_array = PYRO_REALLOCATE_ARRAY(vm, PyroObject*, vm->grey_stack, vm->grey_stack_capacity, new_capacity);
+        if (!new_array) {
+            // The incremental cycle will redo its marking in a single pause.
+            vm->write_barrier_overflow = true;
+            return;
+        }
+        vm->grey_stack_capacity = new_capacity;
+        vm->grey_stack = new_array;
+    }
+
+    pyro_set_marked(object);
+    vm->grey_stack[vm->grey_stack_count++] = object;
+}
+
+
+#ifdef PYRO_DEBUG
+    // Checks the generational invariant before a minor sweep: an old object that isn't in the
+    // remembered set can't reference a young object, so every young object referenced by an
+    // old object must already be marked.
+    static void verify_old_object(PyroVM* vm, PyroObject* object) {
+        assert(object->is_old == pyro_is_old(object));
+        if (object->is_old && !object->is_remembered) {
+            vm->gc_is_minor = false;
+            size_t grey_stack_count = vm->grey_stack_count;
+            blacken_object(vm, object);
+            for (size_t i = grey_stack_count; i < vm->grey_stack_count; i++) {
+                assert(pyro_is_old(vm->grey_stack[i]));
+                uint64_t bit;
+                pyro_get_bitmap(vm->grey_stack[i], &bit)->marked &= ~bit;
+            }
+            vm->grey_stack_count = grey_stack_count;
+            vm->gc_is_minor = true;
+        }
+    }
+
+    // Checks the tri-colour invariant at the end of an incremental marking phase: a marked
+    // object can't reference an unmarked object.
+    static void verify_marked_object(PyroVM* vm, PyroObject* object) {
+        if (pyro_is_marked(object)) {
+            blacken_object(vm, object);
+            assert(vm->grey_stack_count == 0);
+        }
+    }
+#endif
+
+
+static void undo_mark_objects(PyroVM* vm) {
+    PyroObjectHeap_clear_marks(&vm->object_heap);
+}
+
+
+static void update_thresholds(PyroVM* vm, bool is_minor) {
+    if (!is_minor) {
+        vm->next_full_gc_threshold = vm->bytes_allocated * PYRO_GC_HEAP_GROW_FACTOR;
+    }
+
+    #if PYRO_USE_GENERATIONAL_GC
+        if (vm->next_full_gc_threshold < PYRO_INIT_GC_THRESHOLD) {
+            vm->next_full_gc_threshold = PYRO_INIT_GC_THRESHOLD;
+        }
+        vm->next_gc_threshold = vm->bytes_allocated + PYRO_GC_NURSERY_SIZE;
+        if (vm->next_gc_threshold > vm->next_full_gc_threshold) {
+            vm->next_gc_threshold = vm->next_full_gc_threshold;
+        }
+    #else
+        vm->next_gc_threshold = vm->next_full_gc_threshold;
+    #endif
+}
+
+
+// Runs a complete collection in a single pause.
+static void collect(PyroVM* vm, bool is_minor) {
+    assert(vm->grey_stack_count == 0);
+    assert(vm->gc_phase == PYRO_GC_IDLE);
+
+    vm->gc_is_minor = is_minor;
+    vm->gc_count++;
+
     // If we make it to here, we're not in a panic state.
-    // - Attempt to mark every root object as reachable -- i.e. set the object's [is_marked] flag
-    //   and push it onto the grey stack.
+    // - Attempt to mark every root object as reachable -- i.e. set the object's mark bit and push
+    //   it onto the grey stack. In a minor collection, the objects in the remembered set are also
+    //   treated as roots.
     // - This call can only fail (and set the panic flag) if an attempt to allocate memory for the
     //   grey stack fails.
     mark_roots(vm);
+    if (is_minor) {
+        mark_remembered_set(vm);
+    }
     if (vm->panic_flag) {
         vm->grey_stack_count = 0;
+        vm->gc_is_minor = false;
         undo_mark_objects(vm);
         pyro_panic(vm, "out of memory: failed to allocate memory for the garbage collector");
         return;
@@ -414,23 +976,185 @@ void pyro_collect_garbage(PyroVM* vm) {
 
     // If we make it to here, we're not in a panic state.
     // - Attempt to mark every object reachable from the root objects as reachable -- i.e. set the
-    //   object's [is_marked] flag.
+    //   object's mark bit. Full collections of large heaps can be marked in parallel.
     // - This call can only fail (and set the panic flag) if an attempt to allocate memory for the
     //   grey stack fails.
-    trace_references(vm);
+    if (!is_minor && use_parallel_mark(vm)) {
+        trace_references_in_parallel(vm);
+    } else {
+        trace_references(vm);
+    }
     if (vm->panic_flag) {
         vm->grey_stack_count = 0;
+        vm->gc_is_minor = false;
         undo_mark_objects(vm);
         pyro_panic(vm, "out of memory: failed to allocate memory for the garbage collector");
         return;
     }
 
-    // If we make it to here, we've marked every reachable object as [is_marked] without panicking.
+    // If we make it to here, we've marked every reachable object without panicking.
+    assert(vm->grey_stack_count == 0);
+
+    #ifdef PYRO_DEBUG
+        if (is_minor) {
+            PyroObjectHeap_for_each_object(vm, verify_old_object);
+        }
+    #endif
+
+    // Every survivor will be old so the remembered set can be cleared. (This needs to happen
+    // before the sweep as a full collection can free remembered objects.)
+    clear_remembered_set(vm);
+
+    // Free every non-reachable object, i.e. every object without a mark bit. A minor collection
+    // only sweeps young objects.
+    PyroObjectHeap_sweep(vm, is_minor);
+    vm->gc_is_minor = false;
+
+    // Return any slabs drained by the sweep to the OS in one batch.
+    PyroPoolAllocator_release_empty_slabs(&vm->pool_allocator);
+
+    update_thresholds(vm, is_minor);
+}
+
+
+// Abandons an incremental cycle if the grey stack can't be grown. The next collection will be
+// a full, non-incremental collection.
+static void abort_cycle(PyroVM* vm) {
+    vm->grey_stack_count = 0;
+    vm->gc_phase = PYRO_GC_IDLE;
+    undo_mark_objects(vm);
+    clear_remembered_set(vm);
+    vm->write_barrier_overflow = true;
+    pyro_panic(vm, "out of memory: failed to allocate memory for the garbage collector");
+}
+
+
+// Starts an incremental cycle by marking the root objects. From here until the end of the marking
+// phase, the write barrier marks any unmarked object stored in a marked object.
+static void start_cycle(PyroVM* vm) {
+    assert(vm->grey_stack_count == 0);
+    assert(vm->gc_phase == PYRO_GC_IDLE);
+
+    vm->gc_count++;
+
+    mark_roots(vm);
+    if (vm->panic_flag) {
+        abort_cycle(vm);
+        return;
+    }
+
+    vm->gc_phase = PYRO_GC_MARKING;
+}
+
+
+// Ends the marking phase of an incremental cycle in a single pause. The roots are marked again as
+// writes to the stack don't go through the write barrier.
+static void finish_marking(PyroVM* vm) {
     assert(vm->grey_stack_count == 0);
 
-    // Free every non-reachable object, i.e. every objeect with [is_marked == false].
-    sweep(vm);
+    // If the write barrier failed to mark an object we start again from scratch.
+    if (vm->write_barrier_overflow) {
+        undo_mark_objects(vm);
+    }
+
+    mark_roots(vm);
+    trace_references(vm);
+    if (vm->panic_flag) {
+        abort_cycle(vm);
+        return;
+    }
+
+    #ifdef PYRO_DEBUG
+        PyroObjectHeap_for_each_object(vm, verify_marked_object);
+    #endif
+
+    // Every marked object will be promoted to the old generation when it's swept, so the
+    // remembered set can be cleared. From here until the end of the cycle, the write barrier
+    // remembers old objects and marked objects that haven't been swept yet.
+    clear_remembered_set(vm);
+
+    // From here until the end of the cycle, new objects are only allocated in pages which have
+    // already been swept.
+    PyroObjectHeap_start_sweep(&vm->object_heap);
+    vm->gc_phase = PYRO_GC_SWEEPING;
+}
+
+
+// Runs the next slice of an incremental cycle.
+static void run_slice(PyroVM* vm, size_t budget) {
+    if (vm->gc_phase == PYRO_GC_MARKING) {
+        trace_some_references(vm, budget);
+        if (vm->panic_flag) {
+            abort_cycle(vm);
+            return;
+        }
+        if (vm->grey_stack_count == 0) {
+            finish_marking(vm);
+        }
+    } else if (vm->gc_phase == PYRO_GC_SWEEPING) {
+        if (PyroObjectHeap_sweep_some(vm, budget)) {
+            vm->gc_phase = PYRO_GC_IDLE;
+            PyroPoolAllocator_release_empty_slabs(&vm->pool_allocator);
+            update_thresholds(vm, false);
+            return;
+        }
+    }
+
+    if (vm->gc_phase != PYRO_GC_IDLE) {
+        vm->next_gc_threshold = vm->bytes_allocated + PYRO_GC_SLICE_INTERVAL;
+    }
+}
+
+
+void pyro_collect_garbage(PyroVM* vm) {
+    if (vm->gc_disallows > 0 || vm->panic_flag) {
+        return;
+    }
+
+    if (vm->gc_phase != PYRO_GC_IDLE) {
+        run_slice(vm, PYRO_GC_SLICE_BUDGET);
+        return;
+    }
+
+    bool is_minor = false;
+
+    #if PYRO_USE_GENERATIONAL_GC
+        is_minor = vm->bytes_allocated <= vm->next_full_gc_threshold && !vm->write_barrier_overflow;
+
+        // In stress-testing mode, every 16th collection is a full collection.
+        #ifdef PYRO_DEBUG_STRESS_GARBAGE_COLLECTION
+            if (vm->gc_count % 16 == 15) {
+                is_minor = false;
+            }
+        #endif
+    #endif
+
+    // A full collection marked in parallel runs in a single pause.
+    #if PYRO_USE_INCREMENTAL_GC
+        if (!is_minor && !vm->write_barrier_overflow && !use_parallel_mark(vm)) {
+            start_cycle(vm);
+            if (vm->gc_phase != PYRO_GC_IDLE) {
+                run_slice(vm, PYRO_GC_SLICE_BUDGET);
+            }
+            return;
+        }
+    #endif
+
+    collect(vm, is_minor);
+}
+
+
+void pyro_collect_all_garbage(PyroVM* vm) {
+    if (vm->gc_disallows > 0 || vm->panic_flag) {
+        return;
+    }
+
+    while (vm->gc_phase != PYRO_GC_IDLE) {
+        run_slice(vm, SIZE_MAX);
+        if (vm->panic_flag) {
+            return;
+        }
+    }
 
-    // Update the GC threshold.
-    vm->next_gc_threshold = vm->bytes_allocated * PYRO_GC_HEAP_GROW_FACTOR;
+    collect(vm, false);
 }
@@ -2,8 +2,14 @@
 
 
 void* pyro_realloc(PyroVM* vm, void* pointer, size_t old_size, size_t new_size) {
+    bool old_is_pooled = pointer && pyro_is_pool_size(old_size);
+
     if (new_size == 0) {
-        free(pointer);
+        if (old_is_pooled) {
+            PyroPoolAllocator_free(&vm->pool_allocator, pointer, old_size);
+        } else {
+            free(pointer);
+        }
         vm->bytes_allocated -= old_size;
         return NULL;
     }
@@ -14,6 +20,38 @@ void* pyro_realloc(PyroVM* vm, void* pointer, size_t old_size, size_t new_size)
         return NULL;
     }
 
+    // If either the old block or the new block belongs to a pool, we can't use realloc().
+    if (old_is_pooled || pyro_is_pool_size(new_size)) {
+        if (old_is_pooled && pyro_is_same_size_class(old_size, new_size)) {
+            vm->bytes_allocated = new_total_allocation;
+            return pointer;
+        }
+
+        void* result;
+        if (pyro_is_pool_size(new_size)) {
+            result = PyroPoolAllocator_alloc(&vm->pool_allocator, new_size);
+        } else {
+            result = malloc(new_size);
+        }
+
+        if (!result) {
+            vm->memory_allocation_failed = true;
+            return NULL;
+        }
+
+        if (pointer) {
+            memcpy(result, pointer, old_size < new_size ? old_size : new_size);
+            if (old_is_pooled) {
+                PyroPoolAllocator_free(&vm->pool_allocator, pointer, old_size);
+            } else {
+                free(pointer);
+            }
+        }
+
+        vm->bytes_allocated = new_total_allocation;
+        return result;
+    }
+
     void* result = realloc(pointer, new_size);
     if (result) {
         vm->bytes_allocated = new_total_allocation;
@@ -26,31 +64,16 @@ void* pyro_realloc(PyroVM* vm, void* pointer, size_t old_size, size_t new_size)
 
 
 void pyro_free_object(PyroVM* vm, PyroObject* object) {
-    #define FREE_OBJECT(vm, type, pointer) \
-        pyro_realloc(vm, pointer, sizeof(type), 0)
-
     switch(object->type) {
-        case PYRO_OBJECT_BOUND_METHOD: {
-            FREE_OBJECT(vm, PyroBoundMethod, object);
-            break;
-        }
-
         case PYRO_OBJECT_BUF: {
             PyroBuf* buf = (PyroBuf*)object;
             PYRO_FREE_ARRAY(vm, uint8_t, buf->bytes, buf->capacity);
-            FREE_OBJECT(vm, PyroBuf, object);
-            break;
-        }
-
-        case PYRO_OBJECT_CLASS: {
-            FREE_OBJECT(vm, PyroClass, object);
             break;
         }
 
         case PYRO_OBJECT_CLOSURE: {
             PyroClosure* closure = (PyroClosure*)object;
             PYRO_FREE_ARRAY(vm, PyroUpvalue*, closure->upvalues, closure->upvalue_count);
-            FREE_OBJECT(vm, PyroClosure, object);
             break;
         }
 
@@ -65,7 +88,10 @@ void pyro_free_object(PyroVM* vm, PyroObject* object) {
                     fclose(file->stream);
                 }
             }
-            FREE_OBJECT(vm, PyroFile, object);
+            if (file->line_buffer) {
+                free(file->line_buffer);
+                vm->bytes_allocated -= file->line_buffer_capacity;
+            }
             break;
         }
 
@@ -74,19 +100,10 @@ void pyro_free_object(PyroVM* vm, PyroObject* object) {
             PYRO_FREE_ARRAY(vm, uint8_t, fn->code, fn->code_capacity);
             PYRO_FREE_ARRAY(vm, PyroValue, fn->constants, fn->constants_capacity);
             PYRO_FREE_ARRAY(vm, uint16_t, fn->bpl, fn->bpl_capacity);
-            FREE_OBJECT(vm, PyroFn, object);
-            break;
-        }
-
-        case PYRO_OBJECT_INSTANCE: {
-            PyroInstance* instance = (PyroInstance*)object;
-            int num_fields = instance->obj.class->default_field_values->count;
-            pyro_realloc(vm, instance, sizeof(PyroInstance) + num_fields * sizeof(PyroValue), 0);
-            break;
-        }
-
-        case PYRO_OBJECT_ITER: {
-            FREE_OBJECT(vm, PyroIter, object);
+            PYRO_FREE_ARRAY(vm, PyroInlineCache, fn->inline_caches, fn->inline_cache_count);
+            if (fn->reg_code) {
+                pyro_free_register_code(vm, fn->reg_code);
+            }
             break;
         }
 
@@ -94,18 +111,7 @@ void pyro_free_object(PyroVM* vm, PyroObject* object) {
         case PYRO_OBJECT_MAP: {
             PyroMap* map = (PyroMap*)object;
             PYRO_FREE_ARRAY(vm, PyroMapEntry, map->entry_array, map->entry_array_capacity);
-            PYRO_FREE_ARRAY(vm, int64_t, map->index_array, map->index_array_capacity);
-            FREE_OBJECT(vm, PyroMap, object);
-            break;
-        }
-
-        case PYRO_OBJECT_MODULE: {
-            FREE_OBJECT(vm, PyroMod, object);
-            break;
-        }
-
-        case PYRO_OBJECT_NATIVE_FN: {
-            FREE_OBJECT(vm, PyroNativeFn, object);
+            PYRO_FREE_ARRAY(vm, uint8_t, map->control_bytes, PyroMap_index_size(map));
             break;
         }
 
@@ -117,7 +123,6 @@ void pyro_free_object(PyroVM* vm, PyroObject* object) {
                 next_item = current_item->next;
                 pyro_realloc(vm, current_item, sizeof(PyroQueueItem), 0);
             }
-            FREE_OBJECT(vm, PyroQueue, object);
             break;
         }
 
@@ -126,28 +131,17 @@ void pyro_free_object(PyroVM* vm, PyroObject* object) {
             if (resource->callback) {
                 resource->callback(vm, resource->pointer);
             }
-            FREE_OBJECT(vm, PyroResourcePointer, object);
             break;
         }
 
         case PYRO_OBJECT_STR: {
             PyroStr* string = (PyroStr*)object;
-            if (string->bytes) {
-                PyroStrPool_remove(&vm->string_pool, string);
+            if (!string->is_rope && !string->is_slice && string->bytes) {
+                if (string->is_interned) {
+                    PyroStrPool_remove(&vm->string_pool, string);
+                }
                 PYRO_FREE_ARRAY(vm, char, string->bytes, string->capacity);
             }
-            FREE_OBJECT(vm, PyroStr, object);
-            break;
-        }
-
-        case PYRO_OBJECT_TUP: {
-            PyroTup* tup = (PyroTup*)object;
-            pyro_realloc(vm, tup, sizeof(PyroTup) + tup->count * sizeof(PyroValue), 0);
-            break;
-        }
-
-        case PYRO_OBJECT_UPVALUE: {
-            FREE_OBJECT(vm, PyroUpvalue, object);
             break;
         }
 
@@ -155,25 +149,21 @@ void pyro_free_object(PyroVM* vm, PyroObject* object) {
         case PYRO_OBJECT_VEC: {
             PyroVec* vec = (PyroVec*)object;
             PYRO_FREE_ARRAY(vm, PyroValue, vec->values, vec->capacity);
-            FREE_OBJECT(vm, PyroVec, object);
-            break;
-        }
-
-        case PYRO_OBJECT_ERR: {
-            FREE_OBJECT(vm, PyroErr, object);
-            break;
-        }
-
-        case PYRO_OBJECT_ENUM_TYPE: {
-            FREE_OBJECT(vm, PyroEnumType, object);
             break;
         }
 
-        case PYRO_OBJECT_ENUM_MEMBER: {
-            FREE_OBJECT(vm, PyroEnumMember, object);
+        // These objects don't own any memory apart from their own blocks.
+        case PYRO_OBJECT_BOUND_METHOD:
+        case PYRO_OBJECT_CLASS:
+        case PYRO_OBJECT_INSTANCE:
+        case PYRO_OBJECT_ITER:
+        case PYRO_OBJECT_MODULE:
+        case PYRO_OBJECT_NATIVE_FN:
+        case PYRO_OBJECT_TUP:
+        case PYRO_OBJECT_UPVALUE:
+        case PYRO_OBJECT_ERR:
+        case PYRO_OBJECT_ENUM_TYPE:
+        case PYRO_OBJECT_ENUM_MEMBER:
             break;
-        }
     }
-
-    #undef FREE_OBJECT
 }
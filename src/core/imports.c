@@ -64,6 +64,14 @@ static bool try_load_builtin_module(PyroVM* vm, uint8_t arg_count, PyroValue* ar
         return true;
     }
 
+    if (strcmp(name->bytes, "json") == 0) {
+        pyro_load_stdlib_module_json(vm, module);
+        if (vm->memory_allocation_failed) {
+            pyro_panic(vm, "out of memory");
+        }
+        return true;
+    }
+
     return false;
 }
 
@@ -138,6 +146,9 @@ static bool try_load_embedded_module(PyroVM* vm, uint8_t arg_count, PyroValue* a
 static bool try_load_filesystem_module(PyroVM* vm, uint8_t arg_count, PyroValue* args, PyroMod* module) {
     for (size_t i = 0; i < vm->import_roots->count; i++) {
         PyroStr* root = PYRO_AS_STR(vm->import_roots->values[i]);
+        if (!PyroStr_view(root, vm)) {
+            return true;
+        }
         if (root->count == 0) {
             root = PyroStr_COPY(".");
             if (!root) {
@@ -192,7 +203,7 @@ static bool try_load_filesystem_module(PyroVM* vm, uint8_t arg_count, PyroValue*
         // 2. Try file: ROOT/foo/bar/baz.pyro
         memcpy(path + path_count - 1, ".pyro", strlen(".pyro") + 1);
         if (pyro_is_file(path)) {
-            pyro_exec_file(vm, path, module);
+            pyro_exec_module_file(vm, path, module);
             PYRO_FREE_ARRAY(vm, char, path, path_capacity);
             return true;
         }
@@ -209,7 +220,7 @@ static bool try_load_filesystem_module(PyroVM* vm, uint8_t arg_count, PyroValue*
         // 4. Try file: ROOT/foo/bar/baz/self.pyro
         memcpy(path + path_count - 1, "/self.pyro", strlen("/self.pyro") + 1);
         if (pyro_is_file(path)) {
-            pyro_exec_file(vm, path, module);
+            pyro_exec_module_file(vm, path, module);
             PYRO_FREE_ARRAY(vm, char, path, path_capacity);
             return true;
         }
@@ -282,7 +293,7 @@ void pyro_import_module(PyroVM* vm, uint8_t arg_count, PyroValue* args, PyroMod*
 
 void pyro_import_module_from_path(PyroVM* vm, const char* path, PyroMod* module) {
     if (strlen(path) > 5 && memcmp(path + strlen(path) - 5, ".pyro", 5) == 0) {
-        pyro_exec_file(vm, path, module);
+        pyro_exec_module_file(vm, path, module);
         return;
     }
 
@@ -0,0 +1,419 @@
+#include "../includes/pyro.h"
+
+#if PYRO_HAS_ASAN
+    #include <sanitizer/asan_interface.h>
+    #define POISON(block, size) ASAN_POISON_MEMORY_REGION(block, size)
+    #define UNPOISON(block, size) ASAN_UNPOISON_MEMORY_REGION(block, size)
+#else
+    #define POISON(block, size) ((void)(block), (void)(size))
+    #define UNPOISON(block, size) ((void)(block), (void)(size))
+#endif
+
+
+
+static inline size_t get_size_class(size_t size) {
+    if (size <= 256) {
+        return (size - 1) / 16;
+    }
+    if (size <= PYRO_HEAP_MAX_BLOCK_SIZE) {
+        return 16 + (size - 257) / 64;
+    }
+    return PYRO_HEAP_LARGE_OBJECTS;
+}
+
+
+static inline size_t get_block_size(size_t size_class) {
+    if (size_class < 16) {
+        return (size_class + 1) * 16;
+    }
+    return 256 + (size_class - 15) * 64;
+}
+
+
+static void push_available(PyroObjectHeap* heap, PyroHeapPage* page) {
+    PyroHeapPage** list = &heap->available[page->size_class];
+    page->prev_available = NULL;
+    page->next_available = *list;
+    if (*list) {
+        (*list)->prev_available = page;
+    }
+    *list = page;
+    page->is_available = true;
+}
+
+
+static void remove_available(PyroObjectHeap* heap, PyroHeapPage* page) {
+    if (page->prev_available) {
+        page->prev_available->next_available = page->next_available;
+    } else {
+        heap->available[page->size_class] = page->next_available;
+    }
+
+    if (page->next_available) {
+        page->next_available->prev_available = page->prev_available;
+    }
+
+    page->is_available = false;
+}
+
+
+// Allocates a new page and adds it to the heap. A page in the large-objects list holds a single
+// block of [block_size] bytes.
+static PyroHeapPage* new_page(PyroObjectHeap* heap, size_t size_class, size_t block_size) {
+    size_t bitmap_count = 1;
+    if (size_class != PYRO_HEAP_LARGE_OBJECTS) {
+        bitmap_count = (PYRO_HEAP_PAGE_SIZE / block_size + 63) / 64;
+    }
+
+    size_t header_size = sizeof(PyroHeapPage) + bitmap_count * sizeof(PyroHeapBitmap);
+    header_size = (header_size + 15) & ~(size_t)15;
+
+    size_t page_size = PYRO_HEAP_PAGE_SIZE;
+    if (size_class == PYRO_HEAP_LARGE_OBJECTS) {
+        page_size = header_size + block_size;
+    }
+
+    void* memory;
+    if (size_class != PYRO_HEAP_LARGE_OBJECTS && heap->free_pages) {
+        memory = heap->free_pages;
+        heap->free_pages = heap->free_pages->next;
+        heap->free_page_count--;
+    } else if (posix_memalign(&memory, PYRO_HEAP_PAGE_SIZE, page_size) != 0) {
+        return NULL;
+    }
+
+    PyroHeapPage* page = memory;
+    page->next = heap->pages[size_class];
+    page->next_available = NULL;
+    page->prev_available = NULL;
+    page->is_available = false;
+    page->blocks = (char*)memory + header_size;
+    page->block_size = block_size;
+    page->block_count = (page_size - header_size) / block_size;
+    page->size_class = size_class;
+    page->reciprocal = 0;
+    page->live_count = 0;
+    page->young_count = 0;
+    page->free_word = 0;
+    page->swept_epoch = heap->sweep_epoch;
+    page->bitmap_count = bitmap_count;
+    memset(page->bitmaps, 0, bitmap_count * sizeof(PyroHeapBitmap));
+
+    if (size_class != PYRO_HEAP_LARGE_OBJECTS) {
+        page->reciprocal = (((uint64_t)1 << 32) + block_size - 1) / block_size;
+        push_available(heap, page);
+    }
+
+    POISON(page->blocks, page->block_count * block_size);
+    heap->pages[size_class] = page;
+    return page;
+}
+
+
+// Frees a page which has already been unlinked from its size class's list of pages.
+static void free_page(PyroObjectHeap* heap, PyroHeapPage* page) {
+    if (page->is_available) {
+        remove_available(heap, page);
+    }
+    UNPOISON(page->blocks, page->block_count * page->block_size);
+    free(page);
+}
+
+
+// Releases an empty page which has already been unlinked from its size class's list of pages.
+// The page is kept for reuse unless the heap already has enough free pages.
+static void release_page(PyroObjectHeap* heap, PyroHeapPage* page) {
+    if (page->size_class == PYRO_HEAP_LARGE_OBJECTS || heap->free_page_count >= PYRO_HEAP_MAX_FREE_PAGES) {
+        free_page(heap, page);
+        return;
+    }
+
+    if (page->is_available) {
+        remove_available(heap, page);
+    }
+    UNPOISON(page->blocks, page->block_count * page->block_size);
+    page->next = heap->free_pages;
+    heap->free_pages = page;
+    heap->free_page_count++;
+}
+
+
+// Returns the index of the first free block in a page with at least one free block.
+static size_t find_free_block(PyroHeapPage* page) {
+    for (size_t i = page->free_word; i < page->bitmap_count; i++) {
+        uint64_t free_bits = ~page->bitmaps[i].allocated;
+        if (free_bits) {
+            page->free_word = i;
+            return i * 64 + pyro_count_trailing_zeros(free_bits);
+        }
+    }
+
+    assert(false);
+    return 0;
+}
+
+
+static size_t sweep_page(PyroVM* vm, PyroHeapPage* page, bool is_minor);
+
+
+void PyroObjectHeap_init(PyroObjectHeap* heap) {
+    for (size_t i = 0; i <= PYRO_HEAP_LARGE_OBJECTS; i++) {
+        heap->pages[i] = NULL;
+    }
+    for (size_t i = 0; i < PYRO_HEAP_SIZE_CLASS_COUNT; i++) {
+        heap->available[i] = NULL;
+    }
+    heap->free_pages = NULL;
+    heap->free_page_count = 0;
+    heap->sweep_epoch = 0;
+    heap->sweep_class = 0;
+    heap->sweep_link = NULL;
+}
+
+
+PyroObject* PyroObjectHeap_alloc(PyroVM* vm, size_t size) {
+    PyroObjectHeap* heap = &vm->object_heap;
+
+    size_t size_class = get_size_class(size);
+    size_t block_size = size;
+    if (size_class != PYRO_HEAP_LARGE_OBJECTS) {
+        block_size = get_block_size(size_class);
+    }
+
+    if (vm->bytes_allocated + block_size > vm->max_bytes) {
+        vm->memory_allocation_failed = true;
+        return NULL;
+    }
+
+    PyroHeapPage* page;
+    size_t index = 0;
+
+    if (size_class == PYRO_HEAP_LARGE_OBJECTS) {
+        page = new_page(heap, size_class, block_size);
+        if (!page) {
+            vm->memory_allocation_failed = true;
+            return NULL;
+        }
+    } else {
+        page = heap->available[size_class];
+
+        // During an incremental sweep, a page is swept before it's used for new objects. New
+        // objects are never marked so they're always young.
+        if (page && vm->gc_phase == PYRO_GC_SWEEPING && page->swept_epoch != heap->sweep_epoch) {
+            sweep_page(vm, page, false);
+        }
+
+        if (!page) {
+            page = new_page(heap, size_class, block_size);
+            if (!page) {
+                vm->memory_allocation_failed = true;
+                return NULL;
+            }
+        }
+        index = find_free_block(page);
+        assert(index < page->block_count);
+    }
+
+    page->bitmaps[index / 64].allocated |= (uint64_t)1 << (index % 64);
+    page->live_count++;
+    page->young_count++;
+    if (page->live_count == page->block_count && page->is_available) {
+        remove_available(heap, page);
+    }
+
+    vm->bytes_allocated += block_size;
+
+    char* block = page->blocks + index * page->block_size;
+    UNPOISON(block, page->block_size);
+    return (PyroObject*)block;
+}
+
+
+// Frees every unmarked object in a page and promotes every marked object. If [is_minor] is true,
+// only young objects are swept. Returns the number of objects freed.
+static size_t sweep_page(PyroVM* vm, PyroHeapPage* page, bool is_minor) {
+    size_t freed_count = 0;
+
+    for (size_t i = 0; i < page->bitmap_count; i++) {
+        PyroHeapBitmap* bitmap = &page->bitmaps[i];
+        if (bitmap->allocated == 0) {
+            continue;
+        }
+
+        uint64_t swept = is_minor ? bitmap->allocated & ~bitmap->old : bitmap->allocated;
+        uint64_t survivors = swept & bitmap->marked;
+        uint64_t freed = swept & ~bitmap->marked;
+
+        uint64_t promoted = survivors & ~bitmap->old;
+        while (promoted) {
+            size_t index = i * 64 + pyro_count_trailing_zeros(promoted);
+            ((PyroObject*)(page->blocks + index * page->block_size))->is_old = true;
+            promoted &= promoted - 1;
+        }
+
+        uint64_t dead = freed;
+
+        while (dead) {
+            size_t index = i * 64 + pyro_count_trailing_zeros(dead);
+            char* block = page->blocks + index * page->block_size;
+            pyro_free_object(vm, (PyroObject*)block);
+            vm->bytes_allocated -= page->block_size;
+            #if defined(PYRO_DEBUG) && !PYRO_HAS_ASAN
+                memset(block, 0xDD, page->block_size);
+            #endif
+            POISON(block, page->block_size);
+            dead &= dead - 1;
+            freed_count++;
+        }
+
+        bitmap->allocated &= ~freed;
+        bitmap->old = (bitmap->old | survivors) & ~freed;
+        bitmap->marked = 0;
+    }
+
+    page->live_count -= freed_count;
+    page->young_count = 0;
+    page->swept_epoch = vm->object_heap.sweep_epoch;
+
+    if (freed_count > 0) {
+        page->free_word = 0;
+        if (!page->is_available && page->size_class != PYRO_HEAP_LARGE_OBJECTS) {
+            push_available(&vm->object_heap, page);
+        }
+    }
+
+    return freed_count;
+}
+
+
+void PyroObjectHeap_sweep(PyroVM* vm, bool is_minor) {
+    PyroObjectHeap* heap = &vm->object_heap;
+
+    for (size_t i = 0; i <= PYRO_HEAP_LARGE_OBJECTS; i++) {
+        PyroHeapPage** link = &heap->pages[i];
+        while (*link) {
+            PyroHeapPage* page = *link;
+            if (is_minor && page->young_count == 0) {
+                link = &page->next;
+                continue;
+            }
+
+            sweep_page(vm, page, is_minor);
+
+            if (page->live_count == 0) {
+                *link = page->next;
+                release_page(heap, page);
+            } else {
+                link = &page->next;
+            }
+        }
+    }
+}
+
+
+void PyroObjectHeap_start_sweep(PyroObjectHeap* heap) {
+    heap->sweep_epoch++;
+    heap->sweep_class = 0;
+    heap->sweep_link = &heap->pages[0];
+}
+
+
+bool PyroObjectHeap_sweep_some(PyroVM* vm, size_t budget) {
+    PyroObjectHeap* heap = &vm->object_heap;
+    size_t visited_count = 0;
+
+    while (heap->sweep_class <= PYRO_HEAP_LARGE_OBJECTS) {
+        PyroHeapPage* page = *heap->sweep_link;
+
+        if (!page) {
+            heap->sweep_class++;
+            if (heap->sweep_class <= PYRO_HEAP_LARGE_OBJECTS) {
+                heap->sweep_link = &heap->pages[heap->sweep_class];
+            }
+            continue;
+        }
+
+        if (visited_count >= budget) {
+            return false;
+        }
+
+        // Pages allocated since the sweep started are skipped.
+        if (page->swept_epoch == heap->sweep_epoch) {
+            heap->sweep_link = &page->next;
+            continue;
+        }
+
+        visited_count += page->live_count + 1;
+        sweep_page(vm, page, false);
+
+        if (page->live_count == 0) {
+            *heap->sweep_link = page->next;
+            release_page(heap, page);
+        } else {
+            heap->sweep_link = &page->next;
+        }
+    }
+
+    heap->sweep_link = NULL;
+    return true;
+}
+
+
+void PyroObjectHeap_clear_marks(PyroObjectHeap* heap) {
+    for (size_t i = 0; i <= PYRO_HEAP_LARGE_OBJECTS; i++) {
+        for (PyroHeapPage* page = heap->pages[i]; page != NULL; page = page->next) {
+            for (size_t j = 0; j < page->bitmap_count; j++) {
+                page->bitmaps[j].marked = 0;
+            }
+        }
+    }
+}
+
+
+void PyroObjectHeap_for_each_object(PyroVM* vm, void (*callback)(PyroVM* vm, PyroObject* object)) {
+    PyroObjectHeap* heap = &vm->object_heap;
+
+    for (size_t i = 0; i <= PYRO_HEAP_LARGE_OBJECTS; i++) {
+        for (PyroHeapPage* page = heap->pages[i]; page != NULL; page = page->next) {
+            for (size_t j = 0; j < page->bitmap_count; j++) {
+                uint64_t allocated = page->bitmaps[j].allocated;
+                while (allocated) {
+                    size_t index = j * 64 + pyro_count_trailing_zeros(allocated);
+                    callback(vm, (PyroObject*)(page->blocks + index * page->block_size));
+                    allocated &= allocated - 1;
+                }
+            }
+        }
+    }
+}
+
+
+void PyroObjectHeap_free_all(PyroVM* vm) {
+    PyroObjectHeap* heap = &vm->object_heap;
+
+    for (size_t i = 0; i <= PYRO_HEAP_LARGE_OBJECTS; i++) {
+        PyroHeapPage* page = heap->pages[i];
+        while (page) {
+            for (size_t j = 0; j < page->bitmap_count; j++) {
+                uint64_t allocated = page->bitmaps[j].allocated;
+                while (allocated) {
+                    size_t index = j * 64 + pyro_count_trailing_zeros(allocated);
+                    pyro_free_object(vm, (PyroObject*)(page->blocks + index * page->block_size));
+                    vm->bytes_allocated -= page->block_size;
+                    allocated &= allocated - 1;
+                }
+            }
+            PyroHeapPage* next = page->next;
+            free_page(heap, page);
+            page = next;
+        }
+        heap->pages[i] = NULL;
+    }
+
+    while (heap->free_pages) {
+        PyroHeapPage* next = heap->free_pages->next;
+        free(heap->free_pages);
+        heap->free_pages = next;
+    }
+    heap->free_page_count = 0;
+}
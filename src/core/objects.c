@@ -1,5 +1,9 @@
 #include "../includes/pyro.h"
 
+#if PYRO_USE_SSE2
+    #include <emmintrin.h>
+#endif
+
 
 // Allocates memory for a fixed-size object.
 #define ALLOCATE_OBJECT(vm, type, type_enum) \
@@ -11,21 +15,19 @@
     (type*)allocate_object(vm, sizeof(type) + value_count * sizeof(value_type), type_enum)
 
 
-// Allocates memory for a new object. Automatically adds the new object to the VM's linked list of
-// all heap-allocated objects. Returns NULL if memory cannot be allocated.
+// Allocates memory for a new object in the VM's object heap. Returns NULL if memory cannot be
+// allocated.
 static PyroObject* allocate_object(PyroVM* vm, size_t size, PyroObjectType type) {
-    PyroObject* object = pyro_realloc(vm, NULL, 0, size);
+    PyroObject* object = PyroObjectHeap_alloc(vm, size);
     if (object == NULL) {
         return NULL;
     }
 
     object->type = type;
-    object->is_marked = false;
+    object->is_old = false;
+    object->is_remembered = false;
     object->class = NULL;
 
-    object->next = vm->objects;
-    vm->objects = object;
-
     return object;
 }
 
@@ -164,6 +166,7 @@ PyroClass* PyroClass_new(PyroVM* vm) {
     class->static_methods = NULL;
     class->static_fields = NULL;
     class->init_method = pyro_null();
+    class->layout_id = pyro_new_layout_id(vm);
 
     class->all_instance_methods = PyroMap_new(vm);
     class->pub_instance_methods = PyroMap_new(vm);
@@ -209,137 +212,256 @@ PyroInstance* PyroInstance_new(PyroVM* vm, PyroClass* class) {
 /* ------ */
 
 
-// Sentinel value: indicates that a slot in [index_array] is empty.
-#define PYRO_MAP_EMPTY -1
+// Control byte: indicates that a slot in the index is empty.
+#define MAP_EMPTY 0x80
 
-// Sentinel value: indicates that a slot in [index_array] is a tombstone.
-#define PYRO_MAP_TOMBSTONE -2
+// Control byte: indicates that a slot in the index is a tombstone.
+#define MAP_DELETED 0xFE
 
+// The index is probed in aligned groups of this many slots.
+#define MAP_GROUP_SIZE 16
 
-// This function returns a pointer to a slot in [index_array]. This slot can (1) be empty,
-// (2) contain a tombstone, or (3) contain the index of an entry in [entry_array].
-//
-// - If the slot is empty or contains a tombstone, the map does not contain an entry matching
-//   [key]. If a new entry with [key] is appended to [entry_array], its index should be
-//   inserted into the slot returned by this function.
-//
-// - If the slot contains a non-negative index value, the map contains an entry matching
-//   [key]. This entry can be found in [entry_array] at the specified index.
-//
-// Note that [index_array] must have a non-zero length before this function is called.
-//
-// This function can call into Pyro code and can set the panic and/or exit flags.
-static int64_t* find_entry_slot(
-    PyroVM* vm,
-    PyroMapEntry* entry_array,
-    int64_t* index_array,
-    size_t index_array_capacity,
-    PyroValue key
-) {
-    // Verify that capacity is a power of two.
-    assert(index_array_capacity > 0);
-    assert((index_array_capacity & (index_array_capacity - 1)) == 0);
-
-    // Capacity is always a power of 2 so we can use bitwise-AND as a fast modulo operator,
-    // i.e. this is equivalent to: i = key_hash % index_array_capacity.
-    size_t i = (size_t)pyro_hash_value(vm, key) & (index_array_capacity - 1);
-
-    int64_t* first_tombstone = NULL;
 
-    for (;;) {
-        int64_t* slot = &index_array[i];
+// The slot's control byte stores 7 bits of the hash. These are taken from the top of a
+// multiplicative hash so they're independent of the bits used to select the start group. The
+// high bit of a control byte is only set for the empty and deleted sentinels.
+static inline uint8_t get_control_hash(uint64_t hash) {
+    return (uint8_t)((hash * 0x9E3779B97F4A7C15ull) >> 57);
+}
 
-        if (*slot == PYRO_MAP_EMPTY) {
-            return first_tombstone == NULL ? slot : first_tombstone;
-        } else if (*slot == PYRO_MAP_TOMBSTONE) {
-            if (first_tombstone == NULL) first_tombstone = slot;
-        } else {
-            bool result = pyro_op_compare_eq(vm, key, entry_array[*slot].key);
-            if (vm->halt_flag) {
-                return NULL;
+
+// Returns the index of the first group to probe for [hash], i.e. the group containing slot
+// [hash % index_capacity].
+static inline size_t get_start_group(uint64_t hash, size_t group_mask) {
+    return (size_t)(hash / MAP_GROUP_SIZE) & group_mask;
+}
+
+
+// Returns a bitmask with bit i set if the i-th control byte in [group] is equal to [byte].
+static inline uint32_t match_control_byte(const uint8_t* group, uint8_t byte) {
+    #if PYRO_USE_SSE2
+        __m128i control_bytes = _mm_loadu_si128((const __m128i*)group);
+        __m128i matches = _mm_cmpeq_epi8(control_bytes, _mm_set1_epi8((char)byte));
+        return (uint32_t)_mm_movemask_epi8(matches);
+    #else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < MAP_GROUP_SIZE; i++) {
+            if (group[i] == byte) {
+                mask |= (uint32_t)1 << i;
             }
-            if (result) {
-                return slot;
+        }
+        return mask;
+    #endif
+}
+
+
+// Returns a bitmask with bit i set if the i-th slot in [group] is empty or deleted.
+static inline uint32_t match_free_slots(const uint8_t* group) {
+    #if PYRO_USE_SSE2
+        __m128i control_bytes = _mm_loadu_si128((const __m128i*)group);
+        return (uint32_t)_mm_movemask_epi8(control_bytes);
+    #else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < MAP_GROUP_SIZE; i++) {
+            if (group[i] & 0x80) {
+                mask |= (uint32_t)1 << i;
             }
         }
+        return mask;
+    #endif
+}
 
-        i = (i + 1) & (index_array_capacity - 1);
+
+static inline size_t get_entry_index(PyroMap* map, size_t slot) {
+    if (map->has_wide_indexes) {
+        return (size_t)((uint64_t*)map->index_array)[slot];
     }
+    return (size_t)((uint32_t*)map->index_array)[slot];
 }
 
 
-// This function doubles the capacity of the index array, then rebuilds the index. (Rebuilding
-// the index has the side-effect of eliminating any tombstone slots. This function also takes
-// the opportunity to eliminate any tombstones from the entry array so when this function
-// returns the map contains no tombstone entries.)
-static bool resize_index_array(PyroMap* map, PyroVM* vm) {
-    size_t new_index_array_capacity = 8;
-    if (map->index_array_capacity > 0) {
-        new_index_array_capacity = map->index_array_capacity * 2;
+static inline void set_slot(PyroMap* map, size_t slot, uint64_t hash, size_t entry_index) {
+    map->control_bytes[slot] = get_control_hash(hash);
+    if (map->has_wide_indexes) {
+        ((uint64_t*)map->index_array)[slot] = (uint64_t)entry_index;
+    } else {
+        ((uint32_t*)map->index_array)[slot] = (uint32_t)entry_index;
     }
+}
 
-    int64_t* new_index_array = PYRO_ALLOCATE_ARRAY(vm, int64_t, new_index_array_capacity);
-    if (!new_index_array) {
-        return false;
+
+// Returns the index of the slot pointing to the entry matching [key], or -1 if the map does
+// not contain a matching entry. The map's index must have a non-zero capacity.
+//
+// Slots are probed a group at a time. Within a group, candidate slots are selected by their
+// control bytes, then by the full cached hash, and only then by calling pyro_op_compare_eq().
+// The search stops at the first group containing an empty slot.
+//
+// This function can call into Pyro code and can set the panic and/or exit flags.
+static int64_t find_slot(PyroVM* vm, PyroMap* map, PyroValue key, uint64_t hash) {
+    size_t group_mask = map->index_capacity / MAP_GROUP_SIZE - 1;
+    size_t group = get_start_group(hash, group_mask);
+    uint8_t control_hash = get_control_hash(hash);
+
+    for (size_t probe = 1; ; probe++) {
+        const uint8_t* group_bytes = &map->control_bytes[group * MAP_GROUP_SIZE];
+        uint32_t matches = match_control_byte(group_bytes, control_hash);
+
+        while (matches) {
+            size_t slot = group * MAP_GROUP_SIZE + pyro_count_trailing_zeros(matches);
+            PyroMapEntry* entry = &map->entry_array[get_entry_index(map, slot)];
+            if (entry->hash == hash) {
+                bool result = pyro_op_compare_eq(vm, key, entry->key);
+                if (vm->halt_flag) {
+                    return -1;
+                }
+                if (result) {
+                    return (int64_t)slot;
+                }
+            }
+            matches &= matches - 1;
+        }
+
+        if (match_control_byte(group_bytes, MAP_EMPTY)) {
+            return -1;
+        }
+
+        // Triangular probing -- visits every group when the group count is a power of 2.
+        group = (group + probe) & group_mask;
     }
+}
+
+
+// Returns the index of the first empty or deleted slot in [hash]'s probe sequence. The index's
+// load limit guarantees that this slot exists.
+static size_t find_free_slot(PyroMap* map, uint64_t hash) {
+    size_t group_mask = map->index_capacity / MAP_GROUP_SIZE - 1;
+    size_t group = get_start_group(hash, group_mask);
 
-    for (size_t i = 0; i < new_index_array_capacity; i++) {
-        new_index_array[i] = PYRO_MAP_EMPTY;
+    for (size_t probe = 1; ; probe++) {
+        uint32_t free_slots = match_free_slots(&map->control_bytes[group * MAP_GROUP_SIZE]);
+        if (free_slots) {
+            return group * MAP_GROUP_SIZE + pyro_count_trailing_zeros(free_slots);
+        }
+        group = (group + probe) & group_mask;
     }
+}
 
-    PyroMapEntry* new_entry_array = map->entry_array;
 
-    // If the entry array contains tombstones, compact it by removing them.
+// If the slot's group already contains an empty slot, no probe sequence can continue past this
+// group so the slot can be marked as empty rather than deleted.
+static void erase_slot(PyroMap* map, size_t slot) {
+    const uint8_t* group_bytes = &map->control_bytes[slot & ~(size_t)(MAP_GROUP_SIZE - 1)];
+    if (match_control_byte(group_bytes, MAP_EMPTY)) {
+        map->control_bytes[slot] = MAP_EMPTY;
+        map->index_count--;
+    } else {
+        map->control_bytes[slot] = MAP_DELETED;
+    }
+}
+
+
+// This function rebuilds the index with the specified capacity. Rebuilding the index has the
+// side-effect of eliminating any deleted slots. This function also takes the opportunity to
+// eliminate any tombstones from the entry array so when this function returns the map contains
+// no tombstone entries. Entries are reinserted using their cached hashes so this function never
+// calls into Pyro code. Returns false if memory can't be allocated -- in this case the map is
+// unchanged.
+static bool rebuild_index(PyroMap* map, size_t new_capacity, PyroVM* vm) {
+    assert(new_capacity >= MAP_GROUP_SIZE);
+    assert((new_capacity & (new_capacity - 1)) == 0);
+
+    // Entry indexes are stored as 32-bit integers unless the entry array is too big.
+    bool has_wide_indexes = map->entry_array_capacity > UINT32_MAX;
+    size_t index_size = has_wide_indexes ? sizeof(uint64_t) : sizeof(uint32_t);
+
+    uint8_t* new_control_bytes = PYRO_ALLOCATE_ARRAY(vm, uint8_t, new_capacity * (1 + index_size));
+    if (!new_control_bytes) {
+        return false;
+    }
+
+    // If the entry array contains tombstones, compact it in place by removing them.
     if (map->entry_array_count > map->live_entry_count) {
-        new_entry_array = PYRO_ALLOCATE_ARRAY(vm, PyroMapEntry, map->entry_array_capacity);
-        if (!new_entry_array) {
-            PYRO_FREE_ARRAY(vm, int64_t, new_index_array, new_index_array_capacity);
-            return false;
-        }
         size_t dst_index = 0;
         for (size_t src_index = 0; src_index < map->entry_array_count; src_index++) {
             if (PYRO_IS_TOMBSTONE(map->entry_array[src_index].key)) {
                 continue;
             }
-            new_entry_array[dst_index] = map->entry_array[src_index];
+            map->entry_array[dst_index] = map->entry_array[src_index];
             dst_index++;
         }
         assert(dst_index == map->live_entry_count);
+        map->entry_array_count = map->live_entry_count;
     }
 
-    // Rebuild the index.
-    for (size_t entry_index = 0; entry_index < map->live_entry_count; entry_index++) {
-        int64_t* slot = find_entry_slot(
-            vm,
-            new_entry_array,
-            new_index_array,
-            new_index_array_capacity,
-            new_entry_array[entry_index].key
-        );
+    PYRO_FREE_ARRAY(vm, uint8_t, map->control_bytes, PyroMap_index_size(map));
 
-        if (vm->halt_flag) {
-            PYRO_FREE_ARRAY(vm, int64_t, new_index_array, new_index_array_capacity);
-            if (new_entry_array != map->entry_array) {
-                PYRO_FREE_ARRAY(vm, PyroMapEntry, new_entry_array, map->entry_array_capacity);
+    map->control_bytes = new_control_bytes;
+    map->index_array = new_control_bytes + new_capacity;
+    map->index_capacity = new_capacity;
+    map->index_count = map->live_entry_count;
+    map->has_wide_indexes = has_wide_indexes;
+    map->max_load_threshold = new_capacity * PYRO_MAP_MAX_LOAD;
+
+    memset(map->control_bytes, MAP_EMPTY, new_capacity);
+
+    for (size_t entry_index = 0; entry_index < map->entry_array_count; entry_index++) {
+        uint64_t hash = map->entry_array[entry_index].hash;
+        set_slot(map, find_free_slot(map, hash), hash, entry_index);
+    }
+
+    return true;
+}
+
+
+// Makes sure that a new entry can be appended to the entry array and indexed without exceeding
+// the index's load limit. Returns false if memory can't be allocated -- in this case the map is
+// unchanged.
+static bool make_room_for_entry(PyroMap* map, PyroVM* vm) {
+    if (map->index_count >= map->max_load_threshold) {
+        size_t new_capacity = MAP_GROUP_SIZE;
+        if (map->index_capacity > 0) {
+            // If at least half the used slots are deleted, rebuilding at the current capacity
+            // is enough to reclaim them.
+            new_capacity = map->index_capacity;
+            if (map->live_entry_count * 2 > map->index_count) {
+                new_capacity *= 2;
             }
+        }
+        if (!rebuild_index(map, new_capacity, vm)) {
             return false;
         }
-
-        *slot = (int64_t)entry_index;
     }
 
-    PYRO_FREE_ARRAY(vm, int64_t, map->index_array, map->index_array_capacity);
-    map->index_array = new_index_array;
-    map->index_array_capacity = new_index_array_capacity;
-    map->index_array_count = map->live_entry_count;
-
-    if (new_entry_array != map->entry_array) {
-        PYRO_FREE_ARRAY(vm, PyroMapEntry, map->entry_array, map->entry_array_capacity);
-        map->entry_array = new_entry_array;
-        map->entry_array_count = map->live_entry_count;
+    if (map->entry_array_count == map->entry_array_capacity) {
+        if (map->entry_array_count > 0 && map->live_entry_count * 2 <= map->entry_array_count) {
+            // At least half the entry array is tombstones -- compact it instead of growing it.
+            if (!rebuild_index(map, map->index_capacity, vm)) {
+                return false;
+            }
+        } else {
+            size_t new_entry_array_capacity = pyro_grow_capacity(map->entry_array_capacity);
+            PyroMapEntry* new_entry_array = PYRO_REALLOCATE_ARRAY(
+                vm,
+                PyroMapEntry,
+                map->entry_array,
+                map->entry_array_capacity,
+                new_entry_array_capacity
+            );
+            if (!new_entry_array) {
+                return false;
+            }
+            map->entry_array = new_entry_array;
+            map->entry_array_capacity = new_entry_array_capacity;
+        }
     }
 
-    map->max_load_threshold = new_index_array_capacity * PYRO_MAX_HASHMAP_LOAD;
+    // The new entry's index won't fit in 32 bits.
+    if (!map->has_wide_indexes && map->entry_array_count >= UINT32_MAX) {
+        if (!rebuild_index(map, map->index_capacity, vm)) {
+            return false;
+        }
+    }
 
     return true;
 }
@@ -356,9 +478,11 @@ PyroMap* PyroMap_new(PyroVM* vm) {
     map->entry_array_count = 0;
     map->entry_array_capacity = 0;
     map->live_entry_count = 0;
+    map->control_bytes = NULL;
     map->index_array = NULL;
-    map->index_array_count = 0;
-    map->index_array_capacity = 0;
+    map->index_count = 0;
+    map->index_capacity = 0;
+    map->has_wide_indexes = false;
     map->max_load_threshold = 0;
     map->obj.class = vm->class_map;
     return map;
@@ -367,14 +491,16 @@ PyroMap* PyroMap_new(PyroVM* vm) {
 
 void PyroMap_clear(PyroMap* map, PyroVM* vm) {
     PYRO_FREE_ARRAY(vm, PyroMapEntry, map->entry_array, map->entry_array_capacity);
-    PYRO_FREE_ARRAY(vm, int64_t, map->index_array, map->index_array_capacity);
+    PYRO_FREE_ARRAY(vm, uint8_t, map->control_bytes, PyroMap_index_size(map));
     map->entry_array = NULL;
     map->entry_array_count = 0;
     map->entry_array_capacity = 0;
     map->live_entry_count = 0;
+    map->control_bytes = NULL;
     map->index_array = NULL;
-    map->index_array_count = 0;
-    map->index_array_capacity = 0;
+    map->index_count = 0;
+    map->index_capacity = 0;
+    map->has_wide_indexes = false;
     map->max_load_threshold = 0;
 }
 
@@ -396,18 +522,22 @@ PyroMap* PyroMap_copy(PyroMap* src, PyroVM* vm) {
         return NULL;
     }
 
+    if (src->entry_array_capacity == 0) {
+        return dst;
+    }
+
     PyroMapEntry* entry_array = PYRO_ALLOCATE_ARRAY(vm, PyroMapEntry, src->entry_array_capacity);
     if (!entry_array) {
         return NULL;
     }
     memcpy(entry_array, src->entry_array, sizeof(PyroMapEntry) * src->entry_array_count);
 
-    int64_t* index_array = PYRO_ALLOCATE_ARRAY(vm, int64_t, src->index_array_capacity);
-    if (!index_array) {
+    uint8_t* control_bytes = PYRO_ALLOCATE_ARRAY(vm, uint8_t, PyroMap_index_size(src));
+    if (!control_bytes) {
         PYRO_FREE_ARRAY(vm, PyroMapEntry, entry_array, src->entry_array_capacity);
         return NULL;
     }
-    memcpy(index_array, src->index_array, sizeof(int64_t) * src->index_array_capacity);
+    memcpy(control_bytes, src->control_bytes, PyroMap_index_size(src));
 
     dst->live_entry_count = src->live_entry_count;
     dst->max_load_threshold = src->max_load_threshold;
@@ -416,90 +546,82 @@ PyroMap* PyroMap_copy(PyroMap* src, PyroVM* vm) {
     dst->entry_array_capacity = src->entry_array_capacity;
     dst->entry_array_count = src->entry_array_count;
 
-    dst->index_array = index_array;
-    dst->index_array_capacity = src->index_array_capacity;
-    dst->index_array_count = src->index_array_count;
+    dst->control_bytes = control_bytes;
+    dst->index_array = control_bytes + src->index_capacity;
+    dst->index_capacity = src->index_capacity;
+    dst->index_count = src->index_count;
+    dst->has_wide_indexes = src->has_wide_indexes;
 
     return dst;
 }
 
 
-// This function appends a new entry to the map's entry array. It returns -1 if memory could
-// not be allocated for the new entry -- in this case the map is unchanged. Otherwise it
-// returns the index of the new entry.
-static int64_t append_entry(PyroMap* map, PyroValue key, PyroValue value, PyroVM* vm) {
-    if (map->entry_array_count == map->entry_array_capacity) {
-        size_t new_entry_array_capacity = pyro_grow_capacity(map->entry_array_capacity);
-        PyroMapEntry* new_entry_array = PYRO_REALLOCATE_ARRAY(
-            vm,
-            PyroMapEntry,
-            map->entry_array,
-            map->entry_array_capacity,
-            new_entry_array_capacity
-        );
-        if (!new_entry_array) {
-            return -1;
-        }
-        map->entry_array = new_entry_array;
-        map->entry_array_capacity = new_entry_array_capacity;
+// Appends a new entry to the entry array and points [slot] at it. The caller must have called
+// make_room_for_entry() first.
+static void append_entry(PyroMap* map, size_t slot, PyroValue key, PyroValue value, uint64_t hash, PyroVM* vm) {
+    size_t entry_index = map->entry_array_count;
+    pyro_write_barrier(vm, (PyroObject*)map, key);
+    pyro_write_barrier(vm, (PyroObject*)map, value);
+    map->entry_array[entry_index].key = key;
+    map->entry_array[entry_index].value = value;
+    map->entry_array[entry_index].hash = hash;
+    map->entry_array_count++;
+
+    if (map->control_bytes[slot] == MAP_EMPTY) {
+        map->index_count++;
     }
+    set_slot(map, slot, hash, entry_index);
+    map->live_entry_count++;
+}
 
-    int64_t index = (int64_t)map->entry_array_count;
-    map->entry_array[index].key = key;
-    map->entry_array[index].value = value;
-    map->entry_array_count++;
-    return index;
+
+// Map keys are always interned so they can be found by PyroMap_fast_get(). Returns false if
+// memory can't be allocated to grow the string pool.
+static bool intern_key(PyroValue* key, PyroVM* vm) {
+    if (PYRO_IS_STR(*key) && !PYRO_AS_STR(*key)->is_interned) {
+        PyroStr* interned_key = PyroStr_intern(PYRO_AS_STR(*key), vm);
+        if (!interned_key) {
+            return false;
+        }
+        *key = pyro_obj(interned_key);
+    }
+    return true;
 }
 
 
 int PyroMap_set(PyroMap* map, PyroValue key, PyroValue value, PyroVM* vm) {
-    if (map->index_array_capacity == 0) {
-        if (!resize_index_array(map, vm)) {
-            return 0;
-        }
+    if (!intern_key(&key, vm)) {
+        return 0;
     }
 
-    int64_t* slot = find_entry_slot(vm, map->entry_array, map->index_array, map->index_array_capacity, key);
+    uint64_t hash = pyro_hash_value(vm, key);
     if (vm->halt_flag) {
         return 0;
     }
 
-    // 1. The slot is empty.
-    if (*slot == PYRO_MAP_EMPTY) {
-        if (map->index_array_count == map->max_load_threshold) {
-            if (!resize_index_array(map, vm)) {
-                return 0;
-            }
-            slot = find_entry_slot(vm, map->entry_array, map->index_array, map->index_array_capacity, key);
-            if (vm->halt_flag) {
-                return 0;
-            }
-        }
-        int64_t entry_index = append_entry(map, key, value, vm);
-        if (entry_index < 0) {
+    if (map->live_entry_count > 0) {
+        int64_t slot = find_slot(vm, map, key, hash);
+        if (vm->halt_flag) {
             return 0;
         }
-        *slot = entry_index;
-        map->live_entry_count++;
-        map->index_array_count++;
-        return 1;
-    }
 
-    // 2. The slot contains a tombstone.
-    if (*slot == PYRO_MAP_TOMBSTONE) {
-        int64_t entry_index = append_entry(map, key, value, vm);
-        if (entry_index < 0) {
-            return 0;
+        // The map contains an existing entry for [key].
+        if (slot >= 0) {
+            PyroMapEntry* entry = &map->entry_array[get_entry_index(map, (size_t)slot)];
+            pyro_write_barrier(vm, (PyroObject*)map, key);
+            pyro_write_barrier(vm, (PyroObject*)map, value);
+            entry->key = key;
+            entry->value = value;
+            return 2;
         }
-        *slot = entry_index;
-        map->live_entry_count++;
-        return 1;
     }
 
-    // 3. The slot contains the index of an existing entry.
-    map->entry_array[*slot].key = key;
-    map->entry_array[*slot].value = value;
-    return 2;
+    if (!make_room_for_entry(map, vm)) {
+        return 0;
+    }
+
+    append_entry(map, find_free_slot(map, hash), key, value, hash, vm);
+    return 1;
 }
 
 
@@ -508,13 +630,25 @@ bool PyroMap_update_entry(PyroMap* map, PyroValue key, PyroValue value, PyroVM*
         return false;
     }
 
-    int64_t* slot = find_entry_slot(vm, map->entry_array, map->index_array, map->index_array_capacity, key);
-    if (vm->halt_flag || *slot == PYRO_MAP_EMPTY || *slot == PYRO_MAP_TOMBSTONE) {
+    if (!intern_key(&key, vm)) {
+        return false;
+    }
+
+    uint64_t hash = pyro_hash_value(vm, key);
+    if (vm->halt_flag) {
         return false;
     }
 
-    map->entry_array[*slot].key = key;
-    map->entry_array[*slot].value = value;
+    int64_t slot = find_slot(vm, map, key, hash);
+    if (vm->halt_flag || slot < 0) {
+        return false;
+    }
+
+    PyroMapEntry* entry = &map->entry_array[get_entry_index(map, (size_t)slot)];
+    pyro_write_barrier(vm, (PyroObject*)map, key);
+    pyro_write_barrier(vm, (PyroObject*)map, value);
+    entry->key = key;
+    entry->value = value;
     return true;
 }
 
@@ -524,12 +658,17 @@ bool PyroMap_get(PyroMap* map, PyroValue key, PyroValue* value, PyroVM* vm) {
         return false;
     }
 
-    int64_t* slot = find_entry_slot(vm, map->entry_array, map->index_array, map->index_array_capacity, key);
-    if (vm->halt_flag || *slot == PYRO_MAP_EMPTY || *slot == PYRO_MAP_TOMBSTONE) {
+    uint64_t hash = pyro_hash_value(vm, key);
+    if (vm->halt_flag) {
         return false;
     }
 
-    *value = map->entry_array[*slot].value;
+    int64_t slot = find_slot(vm, map, key, hash);
+    if (vm->halt_flag || slot < 0) {
+        return false;
+    }
+
+    *value = map->entry_array[get_entry_index(map, (size_t)slot)].value;
     return true;
 }
 
@@ -539,8 +678,13 @@ bool PyroMap_contains(PyroMap* map, PyroValue key, PyroVM* vm) {
         return false;
     }
 
-    int64_t* slot = find_entry_slot(vm, map->entry_array, map->index_array, map->index_array_capacity, key);
-    if (vm->halt_flag || *slot == PYRO_MAP_EMPTY || *slot == PYRO_MAP_TOMBSTONE) {
+    uint64_t hash = pyro_hash_value(vm, key);
+    if (vm->halt_flag) {
+        return false;
+    }
+
+    int64_t slot = find_slot(vm, map, key, hash);
+    if (vm->halt_flag || slot < 0) {
         return false;
     }
 
@@ -553,41 +697,78 @@ bool PyroMap_remove(PyroMap* map, PyroValue key, PyroVM* vm) {
         return false;
     }
 
-    int64_t* slot = find_entry_slot(vm, map->entry_array, map->index_array, map->index_array_capacity, key);
-    if (vm->halt_flag || *slot == PYRO_MAP_EMPTY || *slot == PYRO_MAP_TOMBSTONE) {
+    uint64_t hash = pyro_hash_value(vm, key);
+    if (vm->halt_flag) {
         return false;
     }
 
-    map->entry_array[*slot].key = pyro_tombstone();
-    *slot = PYRO_MAP_TOMBSTONE;
+    int64_t slot = find_slot(vm, map, key, hash);
+    if (vm->halt_flag || slot < 0) {
+        return false;
+    }
+
+    map->entry_array[get_entry_index(map, (size_t)slot)].key = pyro_tombstone();
+    erase_slot(map, (size_t)slot);
     map->live_entry_count--;
     return true;
 }
 
 
+// Returns the index of the slot pointing to the entry whose key is the interned string [key],
+// or -1 if the map does not contain a matching entry. As keys are always interned, matching
+// entries can be identified by pointer comparison without calling into Pyro code.
+static int64_t fast_find_slot(PyroMap* map, PyroStr* key) {
+    uint64_t hash = key->hash;
+    size_t group_mask = map->index_capacity / MAP_GROUP_SIZE - 1;
+    size_t group = get_start_group(hash, group_mask);
+    uint8_t control_hash = get_control_hash(hash);
+
+    for (size_t probe = 1; ; probe++) {
+        const uint8_t* group_bytes = &map->control_bytes[group * MAP_GROUP_SIZE];
+        uint32_t matches = match_control_byte(group_bytes, control_hash);
+
+        while (matches) {
+            size_t slot = group * MAP_GROUP_SIZE + pyro_count_trailing_zeros(matches);
+            PyroValue entry_key = map->entry_array[get_entry_index(map, slot)].key;
+            if (PYRO_IS_OBJ(entry_key) && PYRO_AS_OBJ(entry_key) == (PyroObject*)key) {
+                return (int64_t)slot;
+            }
+            matches &= matches - 1;
+        }
+
+        if (match_control_byte(group_bytes, MAP_EMPTY)) {
+            return -1;
+        }
+
+        group = (group + probe) & group_mask;
+    }
+}
+
+
 bool PyroMap_fast_remove(PyroMap* map, PyroStr* key, PyroVM* vm) {
     if (map->live_entry_count == 0) {
         return false;
     }
 
-    size_t i = (size_t)key->hash & (map->index_array_capacity - 1);
-
-    for (;;) {
-        int64_t* slot = &map->index_array[i];
-
-        if (*slot == PYRO_MAP_EMPTY) {
+    if (!key->is_interned) {
+        if (!PyroStr_view(key, vm)) {
             return false;
-        } else if (*slot == PYRO_MAP_TOMBSTONE) {
-            // Skip over the tombstone and keep looking for a matching entry.
-        } else if (PYRO_AS_STR(map->entry_array[*slot].key) == key) {
-            map->entry_array[*slot].key = pyro_tombstone();
-            *slot = PYRO_MAP_TOMBSTONE;
-            map->live_entry_count--;
-            return true;
         }
+        key = PyroStrPool_contains(&vm->string_pool, key->bytes, key->count, PyroStr_get_hash(key, vm));
+        if (!key) {
+            return false;
+        }
+    }
 
-        i = (i + 1) & (map->index_array_capacity - 1);
+    int64_t slot = fast_find_slot(map, key);
+    if (slot < 0) {
+        return false;
     }
+
+    map->entry_array[get_entry_index(map, (size_t)slot)].key = pyro_tombstone();
+    erase_slot(map, (size_t)slot);
+    map->live_entry_count--;
+    return true;
 }
 
 
@@ -596,22 +777,23 @@ bool PyroMap_fast_get(PyroMap* map, PyroStr* key, PyroValue* value, PyroVM* vm)
         return false;
     }
 
-    size_t i = (size_t)key->hash & (map->index_array_capacity - 1);
-
-    for (;;) {
-        int64_t* slot = &map->index_array[i];
-
-        if (*slot == PYRO_MAP_EMPTY) {
+    if (!key->is_interned) {
+        if (!PyroStr_view(key, vm)) {
+            return false;
+        }
+        key = PyroStrPool_contains(&vm->string_pool, key->bytes, key->count, PyroStr_get_hash(key, vm));
+        if (!key) {
             return false;
-        } else if (*slot == PYRO_MAP_TOMBSTONE) {
-            // Skip over the tombstone and keep looking for a matching entry.
-        } else if (PYRO_AS_STR(map->entry_array[*slot].key) == key) {
-            *value = map->entry_array[*slot].value;
-            return true;
         }
+    }
 
-        i = (i + 1) & (map->index_array_capacity - 1);
+    int64_t slot = fast_find_slot(map, key);
+    if (slot < 0) {
+        return false;
     }
+
+    *value = map->entry_array[get_entry_index(map, (size_t)slot)].value;
+    return true;
 }
 
 
@@ -672,12 +854,18 @@ static PyroStr* create_new_string(PyroVM* vm, char* bytes, size_t count, size_t
     string->count = count;
     string->capacity = capacity;
     string->hash = hash;
+    string->is_hashed = true;
+    string->is_interned = true;
+    string->is_rope = false;
+    string->is_slice = false;
+    string->slice_parent = NULL;
     string->bytes = bytes;
 
     if (!PyroStrPool_add(&vm->string_pool, string, vm)) {
         string->count = 0;
         string->capacity = 0;
         string->hash = 0;
+        string->is_interned = false;
         string->bytes = NULL;
         return NULL;
     }
@@ -686,6 +874,112 @@ static PyroStr* create_new_string(PyroVM* vm, char* bytes, size_t count, size_t
 }
 
 
+// Creates a new string object taking ownership of the heap-allocated array [bytes] without
+// interning it.
+// - Returns NULL if memory cannot be allocated for the new string object.
+// - If the return value is NULL, ownership of [bytes] is returned to the caller.
+static PyroStr* create_new_lazy_string(PyroVM* vm, char* bytes, size_t count, size_t capacity) {
+    PyroStr* string = ALLOCATE_OBJECT(vm, PyroStr, PYRO_OBJECT_STR);
+    if (!string) {
+        return NULL;
+    }
+
+    string->obj.class = vm->class_str;
+    string->count = count;
+    string->capacity = capacity;
+    string->hash = 0;
+    string->is_hashed = false;
+    string->is_interned = false;
+    string->is_rope = false;
+    string->is_slice = false;
+    string->slice_parent = NULL;
+    string->bytes = bytes;
+    return string;
+}
+
+
+uint64_t PyroStr_compute_hash(PyroStr* string, PyroVM* vm) {
+    assert(!string->is_rope);
+    string->hash = PYRO_STRING_HASH_FUNC((uint8_t*)string->bytes, string->count, vm->string_hash_seed);
+    string->is_hashed = true;
+    return string->hash;
+}
+
+
+PyroStr* PyroStr_intern(PyroStr* string, PyroVM* vm) {
+    if (string->is_interned) {
+        return string;
+    }
+
+    if (!PyroStr_flatten(string, vm)) {
+        return NULL;
+    }
+
+    uint64_t hash = PyroStr_get_hash(string, vm);
+
+    PyroStr* interned_string = PyroStrPool_contains(&vm->string_pool, string->bytes, string->count, hash);
+    if (interned_string) {
+        pyro_revive_string(vm, interned_string);
+        return interned_string;
+    }
+
+    if (!PyroStrPool_add(&vm->string_pool, string, vm)) {
+        return NULL;
+    }
+
+    string->is_interned = true;
+    return string;
+}
+
+
+PyroStr* PyroStr_take_lazy(char* bytes, size_t count, size_t capacity, PyroVM* vm) {
+    #if PYRO_USE_LAZY_STRING_INTERNING
+        assert(bytes != NULL);
+        assert(capacity >= count + 1);
+        assert(bytes[count] == '\0');
+
+        if (count == 0 && vm->empty_string) {
+            PYRO_FREE_ARRAY(vm, char, bytes, capacity);
+            return vm->empty_string;
+        }
+
+        return create_new_lazy_string(vm, bytes, count, capacity);
+    #else
+        return PyroStr_take(bytes, count, capacity, vm);
+    #endif
+}
+
+
+PyroStr* PyroStr_copy_lazy(const char* src, size_t count, PyroVM* vm) {
+    #if PYRO_USE_LAZY_STRING_INTERNING
+        assert(src != NULL);
+
+        if (count == 0 && vm->empty_string) {
+            return vm->empty_string;
+        }
+
+        size_t dst_capacity = count + 1;
+        char* dst = PYRO_ALLOCATE_ARRAY(vm, char, dst_capacity);
+        if (!dst) {
+            return NULL;
+        }
+
+        memcpy(dst, src, count);
+        dst[count] = '\0';
+
+        PyroStr* string = create_new_lazy_string(vm, dst, count, dst_capacity);
+        if (!string) {
+            PYRO_FREE_ARRAY(vm, char, dst, dst_capacity);
+            return NULL;
+        }
+
+        return string;
+    #else
+        return PyroStr_copy(src, count, false, vm);
+    #endif
+}
+
+
 PyroStr* PyroStr_take(char* bytes, size_t count, size_t capacity, PyroVM* vm) {
     assert(bytes != NULL);
     assert(capacity >= count + 1);
@@ -696,11 +990,12 @@ PyroStr* PyroStr_take(char* bytes, size_t count, size_t capacity, PyroVM* vm) {
         return vm->empty_string;
     }
 
-    uint64_t hash = PYRO_STRING_HASH_FUNC((uint8_t*)bytes, count);
+    uint64_t hash = PYRO_STRING_HASH_FUNC((uint8_t*)bytes, count, vm->string_hash_seed);
 
     PyroStr* interned_string = PyroStrPool_contains(&vm->string_pool, bytes, count, hash);
     if (interned_string) {
         PYRO_FREE_ARRAY(vm, char, bytes, capacity);
+        pyro_revive_string(vm, interned_string);
         return interned_string;
     }
 
@@ -734,10 +1029,11 @@ PyroStr* PyroStr_copy(const char* src, size_t count, bool process_backslashed_es
         return string;
     }
 
-    uint64_t hash = PYRO_STRING_HASH_FUNC((const uint8_t*)src, count);
+    uint64_t hash = PYRO_STRING_HASH_FUNC((const uint8_t*)src, count, vm->string_hash_seed);
 
     PyroStr* interned_string = PyroStrPool_contains(&vm->string_pool, src, count, hash);
     if (interned_string) {
+        pyro_revive_string(vm, interned_string);
         return interned_string;
     }
 
@@ -776,7 +1072,7 @@ PyroStr* PyroStr_concat_n_copies(PyroStr* str, size_t n, PyroVM* vm) {
     }
     dst[total_length] = '\0';
 
-    PyroStr* string = PyroStr_take(dst, total_length, total_length + 1, vm);
+    PyroStr* string = PyroStr_take_lazy(dst, total_length, total_length + 1, vm);
     if (!string) {
         PYRO_FREE_ARRAY(vm, char, dst, total_length + 1);
         return NULL;
@@ -805,7 +1101,7 @@ PyroStr* PyroStr_concat_n_codepoints_as_utf8(uint32_t codepoint, size_t n, PyroV
     }
     dst[total_length] = '\0';
 
-    PyroStr* string = PyroStr_take(dst, total_length, total_length + 1, vm);
+    PyroStr* string = PyroStr_take_lazy(dst, total_length, total_length + 1, vm);
     if (!string) {
         PYRO_FREE_ARRAY(vm, char, dst, total_length + 1);
         return NULL;
@@ -829,7 +1125,7 @@ PyroStr* PyroStr_concat(PyroStr* src1, PyroStr* src2, PyroVM* vm) {
     memcpy(dst + src1->count, src2->bytes, src2->count);
     dst[length] = '\0';
 
-    PyroStr* string = PyroStr_take(dst, length, length + 1, vm);
+    PyroStr* string = PyroStr_take_lazy(dst, length, length + 1, vm);
     if (!string) {
         PYRO_FREE_ARRAY(vm, char, dst, length + 1);
         return NULL;
@@ -839,6 +1135,174 @@ PyroStr* PyroStr_concat(PyroStr* src1, PyroStr* src2, PyroVM* vm) {
 }
 
 
+PyroStr* PyroStr_concat_as_rope(PyroStr* src1, PyroStr* src2, PyroVM* vm) {
+    if (src1->count == 0) return src2;
+    if (src2->count == 0) return src1;
+
+    // Ropes are always at least PYRO_MIN_ROPE_LENGTH bytes long so if the result is shorter,
+    // both arguments are flat.
+    size_t length = src1->count + src2->count;
+    if (!PYRO_USE_ROPES || length < PYRO_MIN_ROPE_LENGTH) {
+        return PyroStr_concat(src1, src2, vm);
+    }
+
+    PyroStr* rope = ALLOCATE_OBJECT(vm, PyroStr, PYRO_OBJECT_STR);
+    if (!rope) {
+        return NULL;
+    }
+
+    rope->obj.class = vm->class_str;
+    rope->count = length;
+    rope->capacity = 0;
+    rope->is_hashed = false;
+    rope->is_interned = false;
+    rope->is_rope = true;
+    rope->is_slice = false;
+    rope->slice_parent = NULL;
+    rope->rope_left = src1;
+    rope->rope_right = src2;
+
+    pyro_write_barrier(vm, (PyroObject*)rope, pyro_obj(src1));
+    pyro_write_barrier(vm, (PyroObject*)rope, pyro_obj(src2));
+
+    return rope;
+}
+
+
+// A subrope still to be copied into the flattened buffer at [offset].
+typedef struct {
+    PyroStr* rope;
+    size_t offset;
+} PendingRope;
+
+
+bool PyroStr_flatten_rope(PyroStr* string, PyroVM* vm) {
+    size_t capacity = string->count + 1;
+    char* bytes = PYRO_ALLOCATE_ARRAY(vm, char, capacity);
+    if (!bytes) {
+        pyro_panic(vm, "out of memory");
+        return false;
+    }
+
+    PendingRope* stack = NULL;
+    size_t stack_count = 0;
+    size_t stack_capacity = 0;
+
+    PyroStr* node = string;
+    size_t offset = 0;
+
+    for (;;) {
+        // Ropes built in a loop are deep on one side -- left for appends, right for prepends --
+        // so walk down the deep side, copying flat leaves as we go. Only nodes with two rope
+        // children need to be pushed onto the stack.
+        while (node->is_rope) {
+            PyroStr* left = node->rope_left;
+            PyroStr* right = node->rope_right;
+
+            if (!right->is_rope) {
+                memcpy(bytes + offset + left->count, right->bytes, right->count);
+                node = left;
+            } else if (!left->is_rope) {
+                memcpy(bytes + offset, left->bytes, left->count);
+                offset += left->count;
+                node = right;
+            } else {
+                if (stack_count == stack_capacity) {
+                    size_t new_stack_capacity = pyro_grow_capacity(stack_capacity);
+                    PendingRope* new_stack = PYRO_REALLOCATE_ARRAY(vm, PendingRope, stack, stack_capacity, new_stack_capacity);
+                    if (!new_stack) {
+                        PYRO_FREE_ARRAY(vm, PendingRope, stack, stack_capacity);
+                        PYRO_FREE_ARRAY(vm, char, bytes, capacity);
+                        pyro_panic(vm, "out of memory");
+                        return false;
+                    }
+                    stack = new_stack;
+                    stack_capacity = new_stack_capacity;
+                }
+                stack[stack_count++] = (PendingRope){right, offset + left->count};
+                node = left;
+            }
+        }
+
+        memcpy(bytes + offset, node->bytes, node->count);
+
+        if (stack_count == 0) {
+            break;
+        }
+
+        stack_count--;
+        node = stack[stack_count].rope;
+        offset = stack[stack_count].offset;
+    }
+
+    PYRO_FREE_ARRAY(vm, PendingRope, stack, stack_capacity);
+    bytes[string->count] = '\0';
+
+    string->is_rope = false;
+    string->bytes = bytes;
+    string->capacity = capacity;
+    string->hash = 0;
+    return true;
+}
+
+
+bool PyroStr_materialize_slice(PyroStr* string, PyroVM* vm) {
+    size_t capacity = string->count + 1;
+    char* bytes = PYRO_ALLOCATE_ARRAY(vm, char, capacity);
+    if (!bytes) {
+        pyro_panic(vm, "out of memory");
+        return false;
+    }
+
+    memcpy(bytes, string->bytes, string->count);
+    bytes[string->count] = '\0';
+
+    // The content hasn't changed so a cached hash is still valid.
+    string->is_slice = false;
+    string->slice_parent = NULL;
+    string->bytes = bytes;
+    string->capacity = capacity;
+    return true;
+}
+
+
+PyroStr* PyroStr_slice(PyroStr* string, size_t index, size_t count, PyroVM* vm) {
+    assert(!string->is_rope);
+    assert(index + count <= string->count);
+
+    if (count == string->count) {
+        return string;
+    }
+
+    if (!PYRO_USE_STRING_SLICES || !PYRO_USE_LAZY_STRING_INTERNING || count < PYRO_MIN_SLICE_LENGTH) {
+        return PyroStr_copy_lazy(string->bytes + index, count, vm);
+    }
+
+    // Slices always point directly into a flat string so chains of slices don't build up.
+    PyroStr* parent = string->is_slice ? string->slice_parent : string;
+
+    PyroStr* slice = ALLOCATE_OBJECT(vm, PyroStr, PYRO_OBJECT_STR);
+    if (!slice) {
+        return NULL;
+    }
+
+    slice->obj.class = vm->class_str;
+    slice->count = count;
+    slice->capacity = 0;
+    slice->hash = 0;
+    slice->is_hashed = false;
+    slice->is_interned = false;
+    slice->is_rope = false;
+    slice->is_slice = true;
+    slice->slice_parent = parent;
+    slice->bytes = string->bytes + index;
+
+    pyro_write_barrier(vm, (PyroObject*)slice, pyro_obj(parent));
+
+    return slice;
+}
+
+
 PyroStr* PyroStr_prepend_codepoint_as_utf8(PyroStr* str, uint32_t codepoint, PyroVM* vm) {
     uint8_t buf[4];
     size_t buf_count = pyro_write_utf8_codepoint(codepoint, buf);
@@ -853,7 +1317,7 @@ PyroStr* PyroStr_prepend_codepoint_as_utf8(PyroStr* str, uint32_t codepoint, Pyr
     memcpy(dst + buf_count, str->bytes, str->count);
     dst[length] = '\0';
 
-    PyroStr* string = PyroStr_take(dst, length, length + 1, vm);
+    PyroStr* string = PyroStr_take_lazy(dst, length, length + 1, vm);
     if (!string) {
         PYRO_FREE_ARRAY(vm, char, dst, length + 1);
         return NULL;
@@ -877,7 +1341,7 @@ PyroStr* PyroStr_append_codepoint_as_utf8(PyroStr* str, uint32_t codepoint, Pyro
     memcpy(dst + str->count, buf, buf_count);
     dst[length] = '\0';
 
-    PyroStr* string = PyroStr_take(dst, length, length + 1, vm);
+    PyroStr* string = PyroStr_take_lazy(dst, length, length + 1, vm);
     if (!string) {
         PYRO_FREE_ARRAY(vm, char, dst, length + 1);
         return NULL;
@@ -904,7 +1368,7 @@ PyroStr* PyroStr_concat_codepoints_as_utf8(uint32_t cp1, uint32_t cp2, PyroVM* v
     memcpy(dst + buf1_count, buf2, buf2_count);
     dst[length] = '\0';
 
-    PyroStr* string = PyroStr_take(dst, length, length + 1, vm);
+    PyroStr* string = PyroStr_take_lazy(dst, length, length + 1, vm);
     if (!string) {
         PYRO_FREE_ARRAY(vm, char, dst, length + 1);
         return NULL;
@@ -944,6 +1408,13 @@ PyroFn* PyroFn_new(PyroVM* vm) {
     fn->bpl = NULL;
     fn->bpl_capacity = 0;
 
+    fn->inline_caches = NULL;
+    fn->inline_cache_count = 0;
+
+    fn->hotness = 0;
+    fn->reg_code = NULL;
+    fn->deopt_count = 0;
+
     return fn;
 }
 
@@ -985,6 +1456,22 @@ bool PyroFn_write(PyroFn* fn, uint8_t byte, size_t line_number, PyroVM* vm) {
 }
 
 
+void PyroFn_truncate(PyroFn* fn, size_t code_count) {
+    size_t excess = fn->code_count - code_count;
+    size_t offset = fn->bpl_capacity;
+
+    // The discarded bytes are the last ones written so they belong to the highest lines.
+    while (excess > 0 && offset > 0) {
+        offset--;
+        size_t count = fn->bpl[offset] < excess ? fn->bpl[offset] : excess;
+        fn->bpl[offset] -= count;
+        excess -= count;
+    }
+
+    fn->code_count = code_count;
+}
+
+
 size_t PyroFn_get_line_number(PyroFn* fn, size_t ip) {
     size_t offset = 0;
     size_t sum = 0;
@@ -1001,9 +1488,21 @@ size_t PyroFn_get_line_number(PyroFn* fn, size_t ip) {
 }
 
 
+// Returns true if [a] and [b] can share an entry in a constant table. Floats are compared
+// bitwise so [0.0] and [-0.0] stay distinct.
+static bool is_same_constant(PyroValue a, PyroValue b) {
+    if (PYRO_IS_F64(a) && PYRO_IS_F64(b)) {
+        double a_value = PYRO_AS_F64(a);
+        double b_value = PYRO_AS_F64(b);
+        return memcmp(&a_value, &b_value, sizeof(double)) == 0;
+    }
+    return pyro_compare_eq_strict(a, b);
+}
+
+
 int64_t PyroFn_add_constant(PyroFn* fn, PyroValue value, PyroVM* vm) {
     for (size_t i = 0; i < fn->constants_count; i++) {
-        if (pyro_compare_eq_strict(value, fn->constants[i])) {
+        if (is_same_constant(value, fn->constants[i])) {
             return i;
         }
     }
@@ -1023,6 +1522,31 @@ int64_t PyroFn_add_constant(PyroFn* fn, PyroValue value, PyroVM* vm) {
 }
 
 
+int64_t PyroFn_add_inline_cache(PyroFn* fn) {
+    if (fn->inline_cache_count > UINT16_MAX) {
+        return -1;
+    }
+    return fn->inline_cache_count++;
+}
+
+
+bool PyroFn_alloc_inline_caches(PyroFn* fn, PyroVM* vm) {
+    if (fn->inline_cache_count == 0) {
+        return true;
+    }
+
+    fn->inline_caches = PYRO_ALLOCATE_ARRAY(vm, PyroInlineCache, fn->inline_cache_count);
+    if (!fn->inline_caches) {
+        fn->inline_cache_count = 0;
+        return false;
+    }
+
+    // Layout IDs start at 1 so a zeroed cache never matches.
+    memset(fn->inline_caches, 0, sizeof(PyroInlineCache) * fn->inline_cache_count);
+    return true;
+}
+
+
 size_t PyroFn_opcode_argcount(PyroFn* fn, size_t ip) {
     switch (fn->code[ip]) {
         case PYRO_OPCODE_ASSERT_FAILED:
@@ -1045,6 +1569,22 @@ size_t PyroFn_opcode_argcount(PyroFn* fn, size_t ip) {
         case PYRO_OPCODE_BINARY_SLASH_SLASH:
         case PYRO_OPCODE_BINARY_STAR:
         case PYRO_OPCODE_BINARY_STAR_STAR:
+        case PYRO_OPCODE_BINARY_MOD:
+        case PYRO_OPCODE_BINARY_REM:
+        case PYRO_OPCODE_BINARY_PLUS_I64:
+        case PYRO_OPCODE_BINARY_PLUS_F64:
+        case PYRO_OPCODE_BINARY_MINUS_I64:
+        case PYRO_OPCODE_BINARY_MINUS_F64:
+        case PYRO_OPCODE_BINARY_STAR_I64:
+        case PYRO_OPCODE_BINARY_STAR_F64:
+        case PYRO_OPCODE_BINARY_LESS_I64:
+        case PYRO_OPCODE_BINARY_LESS_F64:
+        case PYRO_OPCODE_BINARY_LESS_EQUAL_I64:
+        case PYRO_OPCODE_BINARY_LESS_EQUAL_F64:
+        case PYRO_OPCODE_BINARY_GREATER_I64:
+        case PYRO_OPCODE_BINARY_GREATER_F64:
+        case PYRO_OPCODE_BINARY_GREATER_EQUAL_I64:
+        case PYRO_OPCODE_BINARY_GREATER_EQUAL_F64:
         case PYRO_OPCODE_CLOSE_UPVALUE:
         case PYRO_OPCODE_DUP:
         case PYRO_OPCODE_DUP_2:
@@ -1138,6 +1678,7 @@ size_t PyroFn_opcode_argcount(PyroFn* fn, size_t ip) {
         case PYRO_OPCODE_SET_UPVALUE:
         case PYRO_OPCODE_UNPACK:
         case PYRO_OPCODE_RETURN_TUPLE:
+        case PYRO_OPCODE_POP_SET_LOCAL:
             return 1;
 
         case PYRO_OPCODE_BREAK:
@@ -1149,12 +1690,7 @@ size_t PyroFn_opcode_argcount(PyroFn* fn, size_t ip) {
         case PYRO_OPCODE_DEFINE_PRI_METHOD:
         case PYRO_OPCODE_DEFINE_PUB_METHOD:
         case PYRO_OPCODE_DEFINE_STATIC_METHOD:
-        case PYRO_OPCODE_GET_FIELD:
-        case PYRO_OPCODE_GET_PUB_FIELD:
-        case PYRO_OPCODE_GET_GLOBAL:
         case PYRO_OPCODE_GET_MEMBER:
-        case PYRO_OPCODE_GET_METHOD:
-        case PYRO_OPCODE_GET_PUB_METHOD:
         case PYRO_OPCODE_GET_SUPER_METHOD:
         case PYRO_OPCODE_IMPORT_NAMED_MEMBERS:
         case PYRO_OPCODE_JUMP:
@@ -1164,6 +1700,12 @@ size_t PyroFn_opcode_argcount(PyroFn* fn, size_t ip) {
         case PYRO_OPCODE_JUMP_IF_NOT_ERR:
         case PYRO_OPCODE_JUMP_IF_NOT_NULL:
         case PYRO_OPCODE_JUMP_IF_TRUE:
+        case PYRO_OPCODE_JUMP_IF_EQUAL:
+        case PYRO_OPCODE_JUMP_IF_NOT_EQUAL:
+        case PYRO_OPCODE_JUMP_IF_NOT_GREATER:
+        case PYRO_OPCODE_JUMP_IF_NOT_GREATER_EQUAL:
+        case PYRO_OPCODE_JUMP_IF_NOT_LESS:
+        case PYRO_OPCODE_JUMP_IF_NOT_LESS_EQUAL:
         case PYRO_OPCODE_LOAD_CONSTANT:
         case PYRO_OPCODE_MAKE_CLASS:
         case PYRO_OPCODE_MAKE_MAP:
@@ -1171,21 +1713,41 @@ size_t PyroFn_opcode_argcount(PyroFn* fn, size_t ip) {
         case PYRO_OPCODE_MAKE_VEC:
         case PYRO_OPCODE_MAKE_TUP:
         case PYRO_OPCODE_POP_JUMP_IF_FALSE:
-        case PYRO_OPCODE_SET_FIELD:
-        case PYRO_OPCODE_SET_PUB_FIELD:
-        case PYRO_OPCODE_SET_GLOBAL:
         case PYRO_OPCODE_CONCAT_STRINGS:
         case PYRO_OPCODE_MAKE_OBJECT:
             return 2;
 
-        case PYRO_OPCODE_CALL_METHOD:
-        case PYRO_OPCODE_CALL_PUB_METHOD:
         case PYRO_OPCODE_CALL_METHOD_WITH_UNPACK:
         case PYRO_OPCODE_CALL_PUB_METHOD_WITH_UNPACK:
         case PYRO_OPCODE_CALL_SUPER_METHOD:
         case PYRO_OPCODE_CALL_SUPER_METHOD_WITH_UNPACK:
             return 3;
 
+        // 1 byte for the local index, plus 2 for the constant index.
+        case PYRO_OPCODE_GET_LOCAL_PLUS_CONSTANT:
+            return 3;
+
+        // 2 bytes for the constant index, plus 2 for the inline cache index.
+        case PYRO_OPCODE_GET_FIELD:
+        case PYRO_OPCODE_GET_PUB_FIELD:
+        case PYRO_OPCODE_GET_GLOBAL:
+        case PYRO_OPCODE_SET_FIELD:
+        case PYRO_OPCODE_SET_PUB_FIELD:
+        case PYRO_OPCODE_SET_GLOBAL:
+        case PYRO_OPCODE_GET_METHOD:
+        case PYRO_OPCODE_GET_PUB_METHOD:
+            return 4;
+
+        // 2 bytes for the constant index, 1 for the argument count, 2 for the inline cache index.
+        case PYRO_OPCODE_CALL_METHOD:
+        case PYRO_OPCODE_CALL_PUB_METHOD:
+            return 5;
+
+        // 1 byte for the local index, 2 for the constant index, plus 2 for the inline cache index.
+        case PYRO_OPCODE_GET_LOCAL_FIELD:
+        case PYRO_OPCODE_GET_LOCAL_PUB_FIELD:
+            return 5;
+
         case PYRO_OPCODE_MAKE_ENUM:
             return 4;
 
@@ -1272,6 +1834,7 @@ PyroMod* PyroMod_new(PyroVM* vm) {
     module->members = NULL;
     module->all_member_indexes = NULL;
     module->pub_member_indexes = NULL;
+    module->layout_id = pyro_new_layout_id(vm);
 
     module->members = PyroVec_new(vm);
     if (!module->members) {
@@ -1378,6 +1941,7 @@ bool PyroVec_append(PyroVec* vec, PyroValue value, PyroVM* vm) {
         vec->capacity = new_capacity;
         vec->values = new_array;
     }
+    pyro_write_barrier(vm, (PyroObject*)vec, value);
     vec->values[vec->count++] = value;
     return true;
 }
@@ -1402,6 +1966,9 @@ bool PyroVec_append_values(PyroVec* vec, PyroValue* values, size_t count, PyroVM
         vec->values = new_array;
     }
 
+    for (size_t i = 0; i < count; i++) {
+        pyro_write_barrier(vm, (PyroObject*)vec, values[i]);
+    }
     memcpy(vec->values + vec->count, values, sizeof(PyroValue) * count);
     vec->count += count;
     return true;
@@ -1492,6 +2059,7 @@ void PyroVec_insert_at_index(PyroVec* vec, size_t index, PyroValue value, PyroVM
     size_t bytes_to_move = sizeof(PyroValue) * (vec->count - index);
     memmove(&vec->values[index + 1], &vec->values[index], bytes_to_move);
 
+    pyro_write_barrier(vm, (PyroObject*)vec, value);
     vec->values[index] = value;
     vec->count++;
 }
@@ -1616,7 +2184,7 @@ PyroStr* PyroBuf_to_str(PyroBuf* buf, PyroVM* vm) {
     }
     buf->bytes[buf->count] = '\0';
 
-    PyroStr* string = PyroStr_take((char*)buf->bytes, buf->count, buf->capacity, vm);
+    PyroStr* string = PyroStr_take_lazy((char*)buf->bytes, buf->count, buf->capacity, vm);
     if (!string) {
         return NULL;
     }
@@ -1773,51 +2341,38 @@ PyroFile* PyroFile_new(PyroVM* vm, FILE* stream) {
     file->obj.class = vm->class_file;
     file->stream = stream;
     file->path = NULL;
+    file->line_buffer = NULL;
+    file->line_buffer_capacity = 0;
     return file;
 }
 
 
 PyroStr* PyroFile_read_line(PyroFile* file, PyroVM* vm) {
-    PyroBuf* buf = PyroBuf_new(vm);
-    if (!buf) {
-        pyro_panic(vm, "out of memory");
-        return NULL;
-    }
-
-    while (true) {
-        int c = fgetc(file->stream);
+    size_t old_capacity = file->line_buffer_capacity;
+    errno = 0;
 
-        if (c == EOF) {
-            if (ferror(file->stream)) {
-                pyro_panic(vm, "I/O read error");
-                return NULL;
-            }
-            break;
-        }
+    ssize_t count = getline(&file->line_buffer, &file->line_buffer_capacity, file->stream);
+    vm->bytes_allocated += file->line_buffer_capacity - old_capacity;
 
-        if (!PyroBuf_append_byte(buf, c, vm)) {
+    if (count < 0) {
+        if (ferror(file->stream)) {
+            pyro_panic(vm, "I/O read error");
+        } else if (errno == ENOMEM) {
             pyro_panic(vm, "out of memory");
-            return NULL;
-        }
-
-        if (c == '\n') {
-            break;
         }
-    }
-
-    if (buf->count == 0) {
         return NULL;
     }
 
-    if (buf->count >= 2 && buf->bytes[buf->count - 2] == '\r' && buf->bytes[buf->count - 1] == '\n') {
-        buf->count -= 2;
-    }
+    const char* line = file->line_buffer;
 
-    if (buf->count >= 1 && buf->bytes[buf->count - 1] == '\n') {
-        buf->count -= 1;
+    if (count >= 1 && line[count - 1] == '\n') {
+        count -= 1;
+        if (count >= 1 && line[count - 1] == '\r') {
+            count -= 1;
+        }
     }
 
-    PyroStr* string = PyroBuf_to_str(buf, vm);
+    PyroStr* string = PyroStr_copy_lazy(line, (size_t)count, vm);
     if (!string) {
         pyro_panic(vm, "out of memory");
         return NULL;
@@ -2202,14 +2757,14 @@ PyroValue PyroIter_next(PyroIter* iter, PyroVM* vm) {
             }
 
             const char* const line_start = str->bytes + iter->next_index;
-            size_t count = 0;
+            size_t count = str->count - iter->next_index;
 
-            while (iter->next_index < str->count) {
-                count++;
-                if (str->bytes[iter->next_index++] == '\n') {
-                    break;
-                }
+            // The count includes the newline, if there is one.
+            const char* newline = memchr(line_start, '\n', count);
+            if (newline) {
+                count = (size_t)(newline - line_start) + 1;
             }
+            iter->next_index += count;
 
             if (count >= 2 && line_start[count - 2] == '\r' && line_start[count - 1] == '\n') {
                 count -= 2;
@@ -2219,7 +2774,7 @@ PyroValue PyroIter_next(PyroIter* iter, PyroVM* vm) {
                 count -= 1;
             }
 
-            PyroStr* next_line = PyroStr_copy(line_start, count, false, vm);
+            PyroStr* next_line = PyroStr_slice(str, line_start - str->bytes, count, vm);
             if (!next_line) {
                 pyro_panic(vm, "out of memory");
                 return pyro_obj(vm->empty_error);
@@ -2349,6 +2904,7 @@ bool PyroQueue_enqueue(PyroQueue* queue, PyroValue value, PyroVM* vm) {
     }
     item->value = value;
     item->next = NULL;
+    pyro_write_barrier(vm, (PyroObject*)queue, value);
 
     if (queue->count == 0) {
         queue->head = item;
@@ -9,19 +9,19 @@
 // Returns [left] + [right]. Panics if the operation is not defined for the operand types.
 // This function can call into Pyro code and can set the panic and/or exit flags.
 PyroValue pyro_op_binary_plus(PyroVM* vm, PyroValue left, PyroValue right) {
-    switch (left.type) {
+    switch (PYRO_TYPE_OF(left)) {
         case PYRO_VALUE_I64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64: {
                     int64_t result;
-                    if (pyro_ckd_add(&result, left.as.i64, right.as.i64)) {
-                        pyro_panic(vm, "signed integer overflow: %" PRId64 " + %" PRId64, left.as.i64, right.as.i64);
+                    if (pyro_ckd_add(&result, PYRO_AS_I64(left), PYRO_AS_I64(right))) {
+                        pyro_panic(vm, "signed integer overflow: %" PRId64 " + %" PRId64, PYRO_AS_I64(left), PYRO_AS_I64(right));
                         return pyro_null();
                     }
                     return pyro_i64(result);
                 }
                 case PYRO_VALUE_F64:
-                    return pyro_f64((double)left.as.i64 + right.as.f64);
+                    return pyro_f64((double)PYRO_AS_I64(left) + PYRO_AS_F64(right));
                 default:
                     break;
             }
@@ -29,11 +29,11 @@ PyroValue pyro_op_binary_plus(PyroVM* vm, PyroValue left, PyroValue right) {
         }
 
         case PYRO_VALUE_F64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return pyro_f64(left.as.f64 + (double)right.as.i64);
+                    return pyro_f64(PYRO_AS_F64(left) + (double)PYRO_AS_I64(right));
                 case PYRO_VALUE_F64:
-                    return pyro_f64(left.as.f64 + right.as.f64);
+                    return pyro_f64(PYRO_AS_F64(left) + PYRO_AS_F64(right));
                 default:
                     break;
             }
@@ -42,7 +42,7 @@ PyroValue pyro_op_binary_plus(PyroVM* vm, PyroValue left, PyroValue right) {
 
         case PYRO_VALUE_RUNE: {
             if (PYRO_IS_RUNE(right)) {
-                PyroStr* result = PyroStr_concat_codepoints_as_utf8(left.as.u32, right.as.u32, vm);
+                PyroStr* result = PyroStr_concat_codepoints_as_utf8(PYRO_AS_RUNE(left), PYRO_AS_RUNE(right), vm);
                 if (!result) {
                     pyro_panic(vm, "out of memory");
                     return pyro_null();
@@ -50,7 +50,11 @@ PyroValue pyro_op_binary_plus(PyroVM* vm, PyroValue left, PyroValue right) {
                 return pyro_obj(result);
             }
             if (PYRO_IS_STR(right)) {
-                PyroStr* result = PyroStr_prepend_codepoint_as_utf8(PYRO_AS_STR(right), left.as.u32, vm);
+                PyroStr* right_str = PYRO_AS_STR(right);
+                if (!PyroStr_view(right_str, vm)) {
+                    return pyro_null();
+                }
+                PyroStr* result = PyroStr_prepend_codepoint_as_utf8(right_str, PYRO_AS_RUNE(left), vm);
                 if (!result) {
                     pyro_panic(vm, "out of memory");
                     return pyro_null();
@@ -62,9 +66,25 @@ PyroValue pyro_op_binary_plus(PyroVM* vm, PyroValue left, PyroValue right) {
 
         case PYRO_VALUE_OBJ: {
             switch (PYRO_AS_OBJ(left)->type) {
+                // The operands aren't flattened here -- if they're long enough, the result is a rope
+                // that refers to them.
                 case PYRO_OBJECT_STR: {
+                    PyroStr* left_str = PYRO_AS_STR(left);
                     if (PYRO_IS_STR(right)) {
-                        PyroStr* result = PyroStr_concat(PYRO_AS_STR(left), PYRO_AS_STR(right), vm);
+                        PyroStr* result = PyroStr_concat_as_rope(left_str, PYRO_AS_STR(right), vm);
+                        if (!result) {
+                            pyro_panic(vm, "out of memory");
+                            return pyro_null();
+                        }
+                        return pyro_obj(result);
+                    }
+                    if (PYRO_IS_RUNE(right) && PYRO_USE_ROPES && left_str->count + 4 >= PYRO_MIN_ROPE_LENGTH) {
+                        PyroStr* rune_str = PyroStr_append_codepoint_as_utf8(vm->empty_string, PYRO_AS_RUNE(right), vm);
+                        if (!rune_str) {
+                            pyro_panic(vm, "out of memory");
+                            return pyro_null();
+                        }
+                        PyroStr* result = PyroStr_concat_as_rope(left_str, rune_str, vm);
                         if (!result) {
                             pyro_panic(vm, "out of memory");
                             return pyro_null();
@@ -72,7 +92,10 @@ PyroValue pyro_op_binary_plus(PyroVM* vm, PyroValue left, PyroValue right) {
                         return pyro_obj(result);
                     }
                     if (PYRO_IS_RUNE(right)) {
-                        PyroStr* result = PyroStr_append_codepoint_as_utf8(PYRO_AS_STR(left), right.as.u32, vm);
+                        if (!PyroStr_view(left_str, vm)) {
+                            return pyro_null();
+                        }
+                        PyroStr* result = PyroStr_append_codepoint_as_utf8(left_str, PYRO_AS_RUNE(right), vm);
                         if (!result) {
                             pyro_panic(vm, "out of memory");
                             return pyro_null();
@@ -143,19 +166,19 @@ PyroValue pyro_op_binary_plus(PyroVM* vm, PyroValue left, PyroValue right) {
 // Returns [left] - [right]. Panics if the operation is not defined for the operand types.
 // This function can call into Pyro code and can set the panic or exit flags.
 PyroValue pyro_op_binary_minus(PyroVM* vm, PyroValue left, PyroValue right) {
-    switch (left.type) {
+    switch (PYRO_TYPE_OF(left)) {
         case PYRO_VALUE_I64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64: {
                     int64_t result;
-                    if (pyro_ckd_sub(&result, left.as.i64, right.as.i64)) {
-                        pyro_panic(vm, "signed integer overflow: %" PRId64 " - %" PRId64, left.as.i64, right.as.i64);
+                    if (pyro_ckd_sub(&result, PYRO_AS_I64(left), PYRO_AS_I64(right))) {
+                        pyro_panic(vm, "signed integer overflow: %" PRId64 " - %" PRId64, PYRO_AS_I64(left), PYRO_AS_I64(right));
                         return pyro_null();
                     }
                     return pyro_i64(result);
                 }
                 case PYRO_VALUE_F64:
-                    return pyro_f64((double)left.as.i64 - right.as.f64);
+                    return pyro_f64((double)PYRO_AS_I64(left) - PYRO_AS_F64(right));
                 default:
                     break;
             }
@@ -163,11 +186,11 @@ PyroValue pyro_op_binary_minus(PyroVM* vm, PyroValue left, PyroValue right) {
         }
 
         case PYRO_VALUE_F64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return pyro_f64(left.as.f64 - (double)right.as.i64);
+                    return pyro_f64(PYRO_AS_F64(left) - (double)PYRO_AS_I64(right));
                 case PYRO_VALUE_F64:
-                    return pyro_f64(left.as.f64 - right.as.f64);
+                    return pyro_f64(PYRO_AS_F64(left) - PYRO_AS_F64(right));
                 default:
                     break;
             }
@@ -205,23 +228,23 @@ PyroValue pyro_op_binary_minus(PyroVM* vm, PyroValue left, PyroValue right) {
 // Returns [left] * [right]. Panics if the operation is not defined for the operand types.
 // This function can call into Pyro code and can set the panic or exit flags.
 PyroValue pyro_op_binary_star(PyroVM* vm, PyroValue left, PyroValue right) {
-    switch (left.type) {
+    switch (PYRO_TYPE_OF(left)) {
         case PYRO_VALUE_I64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64: {
                     int64_t result;
-                    if (pyro_ckd_mul(&result, left.as.i64, right.as.i64)) {
-                        pyro_panic(vm, "signed integer overflow: %" PRId64 " * %" PRId64, left.as.i64, right.as.i64);
+                    if (pyro_ckd_mul(&result, PYRO_AS_I64(left), PYRO_AS_I64(right))) {
+                        pyro_panic(vm, "signed integer overflow: %" PRId64 " * %" PRId64, PYRO_AS_I64(left), PYRO_AS_I64(right));
                         return pyro_null();
                     }
                     return pyro_i64(result);
                 }
                 case PYRO_VALUE_F64: {
-                    return pyro_f64((double)left.as.i64 * right.as.f64);
+                    return pyro_f64((double)PYRO_AS_I64(left) * PYRO_AS_F64(right));
                 }
                 case PYRO_VALUE_RUNE: {
-                    if (left.as.i64 >= 0) {
-                        PyroStr* result = PyroStr_concat_n_codepoints_as_utf8(right.as.u32, left.as.i64, vm);
+                    if (PYRO_AS_I64(left) >= 0) {
+                        PyroStr* result = PyroStr_concat_n_codepoints_as_utf8(PYRO_AS_RUNE(right), PYRO_AS_I64(left), vm);
                         if (!result) {
                             pyro_panic(vm, "out of memory");
                             return pyro_null();
@@ -233,8 +256,12 @@ PyroValue pyro_op_binary_star(PyroVM* vm, PyroValue left, PyroValue right) {
                 }
                 case PYRO_VALUE_OBJ: {
                     if (PYRO_IS_STR(right)) {
-                        if (left.as.i64 >= 0) {
-                            PyroStr* result = PyroStr_concat_n_copies(PYRO_AS_STR(right), left.as.i64, vm);
+                        if (PYRO_AS_I64(left) >= 0) {
+                            PyroStr* right_str = PYRO_AS_STR(right);
+                            if (!PyroStr_view(right_str, vm)) {
+                                return pyro_null();
+                            }
+                            PyroStr* result = PyroStr_concat_n_copies(right_str, PYRO_AS_I64(left), vm);
                             if (!result) {
                                 pyro_panic(vm, "out of memory");
                                 return pyro_null();
@@ -253,11 +280,11 @@ PyroValue pyro_op_binary_star(PyroVM* vm, PyroValue left, PyroValue right) {
         }
 
         case PYRO_VALUE_F64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return pyro_f64(left.as.f64 * (double)right.as.i64);
+                    return pyro_f64(PYRO_AS_F64(left) * (double)PYRO_AS_I64(right));
                 case PYRO_VALUE_F64:
-                    return pyro_f64(left.as.f64 * right.as.f64);
+                    return pyro_f64(PYRO_AS_F64(left) * PYRO_AS_F64(right));
                 default:
                     break;
             }
@@ -266,8 +293,8 @@ PyroValue pyro_op_binary_star(PyroVM* vm, PyroValue left, PyroValue right) {
 
         case PYRO_VALUE_RUNE: {
             if (PYRO_IS_I64(right)) {
-                if (right.as.i64 >= 0) {
-                    PyroStr* result = PyroStr_concat_n_codepoints_as_utf8(left.as.u32, right.as.i64, vm);
+                if (PYRO_AS_I64(right) >= 0) {
+                    PyroStr* result = PyroStr_concat_n_codepoints_as_utf8(PYRO_AS_RUNE(left), PYRO_AS_I64(right), vm);
                     if (!result) {
                         pyro_panic(vm, "out of memory");
                         return pyro_null();
@@ -282,8 +309,12 @@ PyroValue pyro_op_binary_star(PyroVM* vm, PyroValue left, PyroValue right) {
 
         case PYRO_VALUE_OBJ: {
             if (PYRO_IS_STR(left) && PYRO_IS_I64(right)) {
-                if (right.as.i64 >= 0) {
-                    PyroStr* result = PyroStr_concat_n_copies(PYRO_AS_STR(left), right.as.i64, vm);
+                if (PYRO_AS_I64(right) >= 0) {
+                    PyroStr* left_str = PYRO_AS_STR(left);
+                    if (!PyroStr_view(left_str, vm)) {
+                        return pyro_null();
+                    }
+                    PyroStr* result = PyroStr_concat_n_copies(left_str, PYRO_AS_I64(right), vm);
                     if (!result) {
                         pyro_panic(vm, "out of memory");
                         return pyro_null();
@@ -327,21 +358,21 @@ PyroValue pyro_op_binary_star(PyroVM* vm, PyroValue left, PyroValue right) {
 // Returns [left] / [right]. Panics if the operation is not defined for the operand types.
 // This function can call into Pyro code and can set the panic or exit flags.
 PyroValue pyro_op_binary_slash(PyroVM* vm, PyroValue left, PyroValue right) {
-    switch (left.type) {
+    switch (PYRO_TYPE_OF(left)) {
         case PYRO_VALUE_I64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    if (right.as.i64 == 0) {
+                    if (PYRO_AS_I64(right) == 0) {
                         pyro_panic(vm, "division by zero");
                         return pyro_null();
                     }
-                    return pyro_f64((double)left.as.i64 / (double)right.as.i64);
+                    return pyro_f64((double)PYRO_AS_I64(left) / (double)PYRO_AS_I64(right));
                 case PYRO_VALUE_F64:
-                    if (right.as.f64 == 0.0) {
+                    if (PYRO_AS_F64(right) == 0.0) {
                         pyro_panic(vm, "division by zero");
                         return pyro_null();
                     }
-                    return pyro_f64((double)left.as.i64 / right.as.f64);
+                    return pyro_f64((double)PYRO_AS_I64(left) / PYRO_AS_F64(right));
                 default:
                     break;
             }
@@ -349,19 +380,19 @@ PyroValue pyro_op_binary_slash(PyroVM* vm, PyroValue left, PyroValue right) {
         }
 
         case PYRO_VALUE_F64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    if (right.as.i64 == 0) {
+                    if (PYRO_AS_I64(right) == 0) {
                         pyro_panic(vm, "division by zero");
                         return pyro_null();
                     }
-                    return pyro_f64(left.as.f64 / (double)right.as.i64);
+                    return pyro_f64(PYRO_AS_F64(left) / (double)PYRO_AS_I64(right));
                 case PYRO_VALUE_F64:
-                    if (right.as.f64 == 0.0) {
+                    if (PYRO_AS_F64(right) == 0.0) {
                         pyro_panic(vm, "division by zero");
                         return pyro_null();
                     }
-                    return pyro_f64(left.as.f64 / right.as.f64);
+                    return pyro_f64(PYRO_AS_F64(left) / PYRO_AS_F64(right));
                 default:
                     break;
             }
@@ -399,25 +430,25 @@ PyroValue pyro_op_binary_slash(PyroVM* vm, PyroValue left, PyroValue right) {
 // Returns [left] // [right]. Panics if the operation is not defined for the operand types.
 // This function can call into Pyro code and can set the panic or exit flags.
 PyroValue pyro_op_binary_slash_slash(PyroVM* vm, PyroValue left, PyroValue right) {
-    switch (left.type) {
+    switch (PYRO_TYPE_OF(left)) {
         case PYRO_VALUE_I64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    if (right.as.i64 == 0) {
+                    if (PYRO_AS_I64(right) == 0) {
                         pyro_panic(vm, "division by zero");
                         return pyro_null();
                     }
-                    if (left.as.i64 == INT64_MIN && right.as.i64 == -1) {
-                        pyro_panic(vm, "signed integer overflow: %" PRId64 " // %" PRId64, left.as.i64, right.as.i64);
+                    if (PYRO_AS_I64(left) == PYRO_I64_MIN && PYRO_AS_I64(right) == -1) {
+                        pyro_panic(vm, "signed integer overflow: %" PRId64 " // %" PRId64, PYRO_AS_I64(left), PYRO_AS_I64(right));
                         return pyro_null();
                     }
-                    return pyro_i64(left.as.i64 / right.as.i64);
+                    return pyro_i64(PYRO_AS_I64(left) / PYRO_AS_I64(right));
                 case PYRO_VALUE_F64:
-                    if (right.as.f64 == 0.0) {
+                    if (PYRO_AS_F64(right) == 0.0) {
                         pyro_panic(vm, "division by zero");
                         return pyro_null();
                     }
-                    return pyro_f64(trunc((double)left.as.i64 / right.as.f64));
+                    return pyro_f64(trunc((double)PYRO_AS_I64(left) / PYRO_AS_F64(right)));
                 default:
                     break;
             }
@@ -425,19 +456,19 @@ PyroValue pyro_op_binary_slash_slash(PyroVM* vm, PyroValue left, PyroValue right
         }
 
         case PYRO_VALUE_F64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    if (right.as.i64 == 0) {
+                    if (PYRO_AS_I64(right) == 0) {
                         pyro_panic(vm, "division by zero");
                         return pyro_null();
                     }
-                    return pyro_f64(trunc(left.as.f64 / (double)right.as.i64));
+                    return pyro_f64(trunc(PYRO_AS_F64(left) / (double)PYRO_AS_I64(right)));
                 case PYRO_VALUE_F64:
-                    if (right.as.f64 == 0.0) {
+                    if (PYRO_AS_F64(right) == 0.0) {
                         pyro_panic(vm, "division by zero");
                         return pyro_null();
                     }
-                    return pyro_f64(trunc(left.as.f64 / right.as.f64));
+                    return pyro_f64(trunc(PYRO_AS_F64(left) / PYRO_AS_F64(right)));
                 default:
                     break;
             }
@@ -476,7 +507,7 @@ PyroValue pyro_op_binary_slash_slash(PyroVM* vm, PyroValue left, PyroValue right
 // This function can call into Pyro code and can set the panic or exit flags.
 PyroValue pyro_op_binary_bar(PyroVM* vm, PyroValue left, PyroValue right) {
     if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
-        return pyro_i64(left.as.i64 | right.as.i64);
+        return pyro_i64(PYRO_AS_I64(left) | PYRO_AS_I64(right));
     }
 
     PyroValue left_method = pyro_get_method(vm, left, vm->str_op_binary_bar);
@@ -507,7 +538,7 @@ PyroValue pyro_op_binary_bar(PyroVM* vm, PyroValue left, PyroValue right) {
 // This function can call into Pyro code and can set the panic or exit flags.
 PyroValue pyro_op_binary_amp(PyroVM* vm, PyroValue left, PyroValue right) {
     if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
-        return pyro_i64(left.as.i64 & right.as.i64);
+        return pyro_i64(PYRO_AS_I64(left) & PYRO_AS_I64(right));
     }
 
     PyroValue left_method = pyro_get_method(vm, left, vm->str_op_binary_amp);
@@ -538,7 +569,7 @@ PyroValue pyro_op_binary_amp(PyroVM* vm, PyroValue left, PyroValue right) {
 // This function can call into Pyro code and can set the panic or exit flags.
 PyroValue pyro_op_binary_caret(PyroVM* vm, PyroValue left, PyroValue right) {
     if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
-        return pyro_i64(left.as.i64 ^ right.as.i64);
+        return pyro_i64(PYRO_AS_I64(left) ^ PYRO_AS_I64(right));
     }
 
     PyroValue left_method = pyro_get_method(vm, left, vm->str_op_binary_caret);
@@ -568,21 +599,21 @@ PyroValue pyro_op_binary_caret(PyroVM* vm, PyroValue left, PyroValue right) {
 // Returns [left] % [right]. Panics if the operation is not defined for the operand types.
 // This function can call into Pyro code and can set the panic or exit flags.
 PyroValue pyro_op_binary_percent(PyroVM* vm, PyroValue left, PyroValue right) {
-    switch (left.type) {
+    switch (PYRO_TYPE_OF(left)) {
         case PYRO_VALUE_I64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    if (right.as.i64 == 0) {
+                    if (PYRO_AS_I64(right) == 0) {
                         pyro_panic(vm, "division by zero");
                         return pyro_null();
                     }
-                    return pyro_i64(left.as.i64 % right.as.i64);
+                    return pyro_i64(PYRO_AS_I64(left) % PYRO_AS_I64(right));
                 case PYRO_VALUE_F64:
-                    if (right.as.f64 == 0.0) {
+                    if (PYRO_AS_F64(right) == 0.0) {
                         pyro_panic(vm, "division by zero");
                         return pyro_null();
                     }
-                    return pyro_f64(fmod((double)left.as.i64, right.as.f64));
+                    return pyro_f64(fmod((double)PYRO_AS_I64(left), PYRO_AS_F64(right)));
                 default:
                     break;
             }
@@ -590,19 +621,19 @@ PyroValue pyro_op_binary_percent(PyroVM* vm, PyroValue left, PyroValue right) {
         }
 
         case PYRO_VALUE_F64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    if (right.as.i64 == 0) {
+                    if (PYRO_AS_I64(right) == 0) {
                         pyro_panic(vm, "division by zero");
                         return pyro_null();
                     }
-                    return pyro_f64(fmod(left.as.f64, (double)right.as.i64));
+                    return pyro_f64(fmod(PYRO_AS_F64(left), (double)PYRO_AS_I64(right)));
                 case PYRO_VALUE_F64:
-                    if (right.as.f64 == 0.0) {
+                    if (PYRO_AS_F64(right) == 0.0) {
                         pyro_panic(vm, "division by zero");
                         return pyro_null();
                     }
-                    return pyro_f64(fmod(left.as.f64, right.as.f64));
+                    return pyro_f64(fmod(PYRO_AS_F64(left), PYRO_AS_F64(right)));
                 default:
                     break;
             }
@@ -640,21 +671,21 @@ PyroValue pyro_op_binary_percent(PyroVM* vm, PyroValue left, PyroValue right) {
 // Returns [left rem right]. Panics if the operation is not defined for the operand types.
 // This function can call into Pyro code and can set the panic or exit flags.
 PyroValue pyro_op_binary_rem(PyroVM* vm, PyroValue left, PyroValue right) {
-    switch (left.type) {
+    switch (PYRO_TYPE_OF(left)) {
         case PYRO_VALUE_I64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    if (right.as.i64 == 0) {
+                    if (PYRO_AS_I64(right) == 0) {
                         pyro_panic(vm, "division by zero");
                         return pyro_null();
                     }
-                    return pyro_i64(left.as.i64 % right.as.i64);
+                    return pyro_i64(PYRO_AS_I64(left) % PYRO_AS_I64(right));
                 case PYRO_VALUE_F64:
-                    if (right.as.f64 == 0.0) {
+                    if (PYRO_AS_F64(right) == 0.0) {
                         pyro_panic(vm, "division by zero");
                         return pyro_null();
                     }
-                    return pyro_f64(fmod((double)left.as.i64, right.as.f64));
+                    return pyro_f64(fmod((double)PYRO_AS_I64(left), PYRO_AS_F64(right)));
                 default:
                     break;
             }
@@ -662,19 +693,19 @@ PyroValue pyro_op_binary_rem(PyroVM* vm, PyroValue left, PyroValue right) {
         }
 
         case PYRO_VALUE_F64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    if (right.as.i64 == 0) {
+                    if (PYRO_AS_I64(right) == 0) {
                         pyro_panic(vm, "division by zero");
                         return pyro_null();
                     }
-                    return pyro_f64(fmod(left.as.f64, (double)right.as.i64));
+                    return pyro_f64(fmod(PYRO_AS_F64(left), (double)PYRO_AS_I64(right)));
                 case PYRO_VALUE_F64:
-                    if (right.as.f64 == 0.0) {
+                    if (PYRO_AS_F64(right) == 0.0) {
                         pyro_panic(vm, "division by zero");
                         return pyro_null();
                     }
-                    return pyro_f64(fmod(left.as.f64, right.as.f64));
+                    return pyro_f64(fmod(PYRO_AS_F64(left), PYRO_AS_F64(right)));
                 default:
                     break;
             }
@@ -713,13 +744,13 @@ PyroValue pyro_op_binary_rem(PyroVM* vm, PyroValue left, PyroValue right) {
 // This function can call into Pyro code and can set the panic or exit flags.
 PyroValue pyro_op_binary_mod(PyroVM* vm, PyroValue left, PyroValue right) {
     if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
-        if (right.as.i64 == 0) {
+        if (PYRO_AS_I64(right) == 0) {
             pyro_panic(vm, "division by zero");
             return pyro_null();
         }
 
         return pyro_i64(
-            pyro_modulo(left.as.i64, right.as.i64)
+            pyro_modulo(PYRO_AS_I64(left), PYRO_AS_I64(right))
         );
     }
 
@@ -750,13 +781,13 @@ PyroValue pyro_op_binary_mod(PyroVM* vm, PyroValue left, PyroValue right) {
 // Returns [left] ** [right]. Panics if the operation is not defined for the operand types.
 // This function can call into Pyro code and can set the panic or exit flags.
 PyroValue pyro_op_binary_star_star(PyroVM* vm, PyroValue left, PyroValue right) {
-    switch (left.type) {
+    switch (PYRO_TYPE_OF(left)) {
         case PYRO_VALUE_I64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return pyro_f64(pow((double)left.as.i64, (double)right.as.i64));
+                    return pyro_f64(pow((double)PYRO_AS_I64(left), (double)PYRO_AS_I64(right)));
                 case PYRO_VALUE_F64:
-                    return pyro_f64(pow((double)left.as.i64, right.as.f64));
+                    return pyro_f64(pow((double)PYRO_AS_I64(left), PYRO_AS_F64(right)));
                 default:
                     break;
             }
@@ -764,11 +795,11 @@ PyroValue pyro_op_binary_star_star(PyroVM* vm, PyroValue left, PyroValue right)
         }
 
         case PYRO_VALUE_F64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return pyro_f64(pow(left.as.f64, (double)right.as.i64));
+                    return pyro_f64(pow(PYRO_AS_F64(left), (double)PYRO_AS_I64(right)));
                 case PYRO_VALUE_F64:
-                    return pyro_f64(pow(left.as.f64, right.as.f64));
+                    return pyro_f64(pow(PYRO_AS_F64(left), PYRO_AS_F64(right)));
                 default:
                     break;
             }
@@ -807,7 +838,7 @@ PyroValue pyro_op_binary_star_star(PyroVM* vm, PyroValue left, PyroValue right)
 // This function can call into Pyro code and can set the panic or exit flags.
 PyroValue pyro_op_binary_less_less(PyroVM* vm, PyroValue left, PyroValue right) {
     if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
-        return pyro_i64(left.as.i64 << right.as.i64);
+        return pyro_i64(PYRO_AS_I64(left) << PYRO_AS_I64(right));
     }
 
     PyroValue left_method = pyro_get_method(vm, left, vm->str_op_binary_less_less);
@@ -838,7 +869,7 @@ PyroValue pyro_op_binary_less_less(PyroVM* vm, PyroValue left, PyroValue right)
 // This function can call into Pyro code and can set the panic or exit flags.
 PyroValue pyro_op_binary_greater_greater(PyroVM* vm, PyroValue left, PyroValue right) {
     if (PYRO_IS_I64(left) && PYRO_IS_I64(right)) {
-        return pyro_i64(left.as.i64 >> right.as.i64);
+        return pyro_i64(PYRO_AS_I64(left) >> PYRO_AS_I64(right));
     }
 
     PyroValue left_method = pyro_get_method(vm, left, vm->str_op_binary_greater_greater);
@@ -871,7 +902,7 @@ PyroValue pyro_op_binary_greater_greater(PyroVM* vm, PyroValue left, PyroValue r
 
 
 PyroValue pyro_op_unary_plus(PyroVM* vm, PyroValue operand) {
-    switch (operand.type) {
+    switch (PYRO_TYPE_OF(operand)) {
         case PYRO_VALUE_I64:
             return operand;
 
@@ -898,12 +929,12 @@ PyroValue pyro_op_unary_plus(PyroVM* vm, PyroValue operand) {
 
 
 PyroValue pyro_op_unary_minus(PyroVM* vm, PyroValue operand) {
-    switch (operand.type) {
+    switch (PYRO_TYPE_OF(operand)) {
         case PYRO_VALUE_I64:
-            return pyro_i64(-operand.as.i64);
+            return pyro_i64(-PYRO_AS_I64(operand));
 
         case PYRO_VALUE_F64:
-            return pyro_f64(-operand.as.f64);
+            return pyro_f64(-PYRO_AS_F64(operand));
 
         default:
             break;
@@ -926,7 +957,7 @@ PyroValue pyro_op_unary_minus(PyroVM* vm, PyroValue operand) {
 
 PyroValue pyro_op_unary_tilde(PyroVM* vm, PyroValue operand) {
     if (PYRO_IS_I64(operand)) {
-        return pyro_i64(~operand.as.i64);
+        return pyro_i64(~PYRO_AS_I64(operand));
     }
 
     PyroValue method = pyro_get_method(vm, operand, vm->str_op_unary_tilde);
@@ -953,11 +984,16 @@ PyroValue pyro_op_unary_tilde(PyroVM* vm, PyroValue operand) {
 // - Returns -1 if a < b.
 // - Returns 0 if a == b.
 // - Returns 1 if a > b.
-static int compare_strings(PyroStr* a, PyroStr* b) {
+// Ropes are flattened first -- if memory can't be allocated, panics and returns 0.
+static int compare_strings(PyroVM* vm, PyroStr* a, PyroStr* b) {
     if (a == b) {
         return 0;
     }
 
+    if (!PyroStr_view(a, vm) || !PyroStr_view(b, vm)) {
+        return 0;
+    }
+
     size_t min_len = a->count < b->count ? a->count : b->count;
 
     for (size_t i = 0; i < min_len; i++) {
@@ -965,6 +1001,10 @@ static int compare_strings(PyroStr* a, PyroStr* b) {
         if (a->bytes[i] > b->bytes[i]) return 1;
     }
 
+    if (a->count == b->count) {
+        return 0;
+    }
+
     return a->count < b->count ? -1 : 1;
 }
 
@@ -1052,15 +1092,15 @@ static int pyro_compare_int_and_float(int64_t a, double b) {
 // Returns true if [left] == [right].
 // This function can call into Pyro code and can set the panic or exit flags.
 bool pyro_op_compare_eq(PyroVM* vm, PyroValue left, PyroValue right) {
-    switch (left.type) {
+    switch (PYRO_TYPE_OF(left)) {
         case PYRO_VALUE_I64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return left.as.i64 == right.as.i64;
+                    return PYRO_AS_I64(left) == PYRO_AS_I64(right);
                 case PYRO_VALUE_F64:
-                    return pyro_compare_int_and_float(left.as.i64, right.as.f64) == 0;
+                    return pyro_compare_int_and_float(PYRO_AS_I64(left), PYRO_AS_F64(right)) == 0;
                 case PYRO_VALUE_RUNE:
-                    return left.as.i64 == (int64_t)right.as.u32;
+                    return PYRO_AS_I64(left) == (int64_t)PYRO_AS_RUNE(right);
                 default:
                     break;
             }
@@ -1068,13 +1108,13 @@ bool pyro_op_compare_eq(PyroVM* vm, PyroValue left, PyroValue right) {
         }
 
         case PYRO_VALUE_RUNE: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return (int64_t)left.as.u32 == right.as.i64;
+                    return (int64_t)PYRO_AS_RUNE(left) == PYRO_AS_I64(right);
                 case PYRO_VALUE_F64:
-                    return pyro_compare_int_and_float((int64_t)left.as.u32, right.as.f64) == 0;
+                    return pyro_compare_int_and_float((int64_t)PYRO_AS_RUNE(left), PYRO_AS_F64(right)) == 0;
                 case PYRO_VALUE_RUNE:
-                    return left.as.u32 == right.as.u32;
+                    return PYRO_AS_RUNE(left) == PYRO_AS_RUNE(right);
                 default:
                     break;
             }
@@ -1082,13 +1122,13 @@ bool pyro_op_compare_eq(PyroVM* vm, PyroValue left, PyroValue right) {
         }
 
         case PYRO_VALUE_F64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return pyro_compare_int_and_float(right.as.i64, left.as.f64) == 0;
+                    return pyro_compare_int_and_float(PYRO_AS_I64(right), PYRO_AS_F64(left)) == 0;
                 case PYRO_VALUE_F64:
-                    return left.as.f64 == right.as.f64;
+                    return PYRO_AS_F64(left) == PYRO_AS_F64(right);
                 case PYRO_VALUE_RUNE:
-                    return pyro_compare_int_and_float((int64_t)right.as.u32, left.as.f64) == 0;
+                    return pyro_compare_int_and_float((int64_t)PYRO_AS_RUNE(right), PYRO_AS_F64(left)) == 0;
                 default:
                     break;
             }
@@ -1097,7 +1137,7 @@ bool pyro_op_compare_eq(PyroVM* vm, PyroValue left, PyroValue right) {
 
         case PYRO_VALUE_BOOL: {
             if (PYRO_IS_BOOL(right)) {
-                return left.as.boolean == right.as.boolean;
+                return PYRO_AS_BOOL(left) == PYRO_AS_BOOL(right);
             }
             break;
         }
@@ -1114,10 +1154,15 @@ bool pyro_op_compare_eq(PyroVM* vm, PyroValue left, PyroValue right) {
         }
 
         case PYRO_VALUE_OBJ: {
-            switch (left.as.obj->type) {
+            switch (PYRO_AS_OBJ(left)->type) {
                 case PYRO_OBJECT_STR: {
                     if (PYRO_IS_STR(right)) {
-                        return left.as.obj == right.as.obj;
+                        PyroStr* left_str = PYRO_AS_STR(left);
+                        PyroStr* right_str = PYRO_AS_STR(right);
+                        if (!PyroStr_view(left_str, vm) || !PyroStr_view(right_str, vm)) {
+                            return false;
+                        }
+                        return PyroStr_check_equal(left_str, right_str);
                     }
                     break;
                 }
@@ -1173,7 +1218,7 @@ bool pyro_op_compare_eq(PyroVM* vm, PyroValue left, PyroValue right) {
     }
 
     if (PYRO_IS_OBJ(left) && PYRO_IS_OBJ(right)) {
-        return left.as.obj == right.as.obj;
+        return PYRO_AS_OBJ(left) == PYRO_AS_OBJ(right);
     }
 
     return false;
@@ -1183,15 +1228,15 @@ bool pyro_op_compare_eq(PyroVM* vm, PyroValue left, PyroValue right) {
 // Returns true if [left] < [right]. Panics if the values are not comparable.
 // This function can call into Pyro code and can set the panic or exit flags.
 bool pyro_op_compare_lt(PyroVM* vm, PyroValue left, PyroValue right) {
-    switch (left.type) {
+    switch (PYRO_TYPE_OF(left)) {
         case PYRO_VALUE_I64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return left.as.i64 < right.as.i64;
+                    return PYRO_AS_I64(left) < PYRO_AS_I64(right);
                 case PYRO_VALUE_F64:
-                    return pyro_compare_int_and_float(left.as.i64, right.as.f64) == -1;
+                    return pyro_compare_int_and_float(PYRO_AS_I64(left), PYRO_AS_F64(right)) == -1;
                 case PYRO_VALUE_RUNE:
-                    return left.as.i64 < (int64_t)right.as.u32;
+                    return PYRO_AS_I64(left) < (int64_t)PYRO_AS_RUNE(right);
                 default:
                     break;
             }
@@ -1199,13 +1244,13 @@ bool pyro_op_compare_lt(PyroVM* vm, PyroValue left, PyroValue right) {
         }
 
         case PYRO_VALUE_RUNE: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return (int64_t)left.as.u32 < right.as.i64;
+                    return (int64_t)PYRO_AS_RUNE(left) < PYRO_AS_I64(right);
                 case PYRO_VALUE_F64:
-                    return pyro_compare_int_and_float((int64_t)left.as.u32, right.as.f64) == -1;
+                    return pyro_compare_int_and_float((int64_t)PYRO_AS_RUNE(left), PYRO_AS_F64(right)) == -1;
                 case PYRO_VALUE_RUNE:
-                    return left.as.u32 < right.as.u32;
+                    return PYRO_AS_RUNE(left) < PYRO_AS_RUNE(right);
                 default:
                     break;
             }
@@ -1213,13 +1258,13 @@ bool pyro_op_compare_lt(PyroVM* vm, PyroValue left, PyroValue right) {
         }
 
         case PYRO_VALUE_F64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return pyro_compare_int_and_float(right.as.i64, left.as.f64) == 1;
+                    return pyro_compare_int_and_float(PYRO_AS_I64(right), PYRO_AS_F64(left)) == 1;
                 case PYRO_VALUE_F64:
-                    return left.as.f64 < right.as.f64;
+                    return PYRO_AS_F64(left) < PYRO_AS_F64(right);
                 case PYRO_VALUE_RUNE:
-                    return pyro_compare_int_and_float((int64_t)right.as.u32, left.as.f64) == 1;
+                    return pyro_compare_int_and_float((int64_t)PYRO_AS_RUNE(right), PYRO_AS_F64(left)) == 1;
                 default:
                     break;
             }
@@ -1228,7 +1273,7 @@ bool pyro_op_compare_lt(PyroVM* vm, PyroValue left, PyroValue right) {
 
         case PYRO_VALUE_OBJ: {
             if (PYRO_IS_STR(left) && PYRO_IS_STR(right)) {
-                return compare_strings(PYRO_AS_STR(left), PYRO_AS_STR(right)) == -1;
+                return compare_strings(vm, PYRO_AS_STR(left), PYRO_AS_STR(right)) == -1;
             }
             if (PYRO_IS_TUP(left) && PYRO_IS_TUP(right)) {
                 return compare_tuples(vm, PYRO_AS_TUP(left), PYRO_AS_TUP(right)) == -1;
@@ -1275,17 +1320,17 @@ bool pyro_op_compare_lt(PyroVM* vm, PyroValue left, PyroValue right) {
 // Returns true if [left] <= [right]. Panics if the values are not comparable.
 // This function can call into Pyro code and can set the panic or exit flags.
 bool pyro_op_compare_le(PyroVM* vm, PyroValue left, PyroValue right) {
-    switch (left.type) {
+    switch (PYRO_TYPE_OF(left)) {
         case PYRO_VALUE_I64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return left.as.i64 <= right.as.i64;
+                    return PYRO_AS_I64(left) <= PYRO_AS_I64(right);
                 case PYRO_VALUE_F64: {
-                    int result = pyro_compare_int_and_float(left.as.i64, right.as.f64);
+                    int result = pyro_compare_int_and_float(PYRO_AS_I64(left), PYRO_AS_F64(right));
                     return result == -1 || result == 0;
                 }
                 case PYRO_VALUE_RUNE:
-                    return left.as.i64 <= (int64_t)right.as.u32;
+                    return PYRO_AS_I64(left) <= (int64_t)PYRO_AS_RUNE(right);
                 default:
                     break;
             }
@@ -1293,15 +1338,15 @@ bool pyro_op_compare_le(PyroVM* vm, PyroValue left, PyroValue right) {
         }
 
         case PYRO_VALUE_RUNE: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return (int64_t)left.as.u32 <= right.as.i64;
+                    return (int64_t)PYRO_AS_RUNE(left) <= PYRO_AS_I64(right);
                 case PYRO_VALUE_F64: {
-                    int result = pyro_compare_int_and_float((int64_t)left.as.u32, right.as.f64);
+                    int result = pyro_compare_int_and_float((int64_t)PYRO_AS_RUNE(left), PYRO_AS_F64(right));
                     return result == -1 || result == 0;
                 }
                 case PYRO_VALUE_RUNE:
-                    return left.as.u32 <= right.as.u32;
+                    return PYRO_AS_RUNE(left) <= PYRO_AS_RUNE(right);
                 default:
                     break;
             }
@@ -1309,15 +1354,15 @@ bool pyro_op_compare_le(PyroVM* vm, PyroValue left, PyroValue right) {
         }
 
         case PYRO_VALUE_F64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64: {
-                    int result = pyro_compare_int_and_float(right.as.i64, left.as.f64);
+                    int result = pyro_compare_int_and_float(PYRO_AS_I64(right), PYRO_AS_F64(left));
                     return result == 0 || result == 1;
                 }
                 case PYRO_VALUE_F64:
-                    return left.as.f64 <= right.as.f64;
+                    return PYRO_AS_F64(left) <= PYRO_AS_F64(right);
                 case PYRO_VALUE_RUNE: {
-                    int result = pyro_compare_int_and_float((int64_t)right.as.u32, left.as.f64);
+                    int result = pyro_compare_int_and_float((int64_t)PYRO_AS_RUNE(right), PYRO_AS_F64(left));
                     return result == 0 || result == 1;
                 }
                 default:
@@ -1328,7 +1373,7 @@ bool pyro_op_compare_le(PyroVM* vm, PyroValue left, PyroValue right) {
 
         case PYRO_VALUE_OBJ: {
             if (PYRO_IS_STR(left) && PYRO_IS_STR(right)) {
-                return compare_strings(PYRO_AS_STR(left), PYRO_AS_STR(right)) <= 0;
+                return compare_strings(vm, PYRO_AS_STR(left), PYRO_AS_STR(right)) <= 0;
             }
             if (PYRO_IS_TUP(left) && PYRO_IS_TUP(right)) {
                 return compare_tuples(vm, PYRO_AS_TUP(left), PYRO_AS_TUP(right)) <= 0;
@@ -1375,15 +1420,15 @@ bool pyro_op_compare_le(PyroVM* vm, PyroValue left, PyroValue right) {
 // Returns true if [left] > [right]. Panics if the values are not comparable.
 // This function can call into Pyro code and can set the panic or exit flags.
 bool pyro_op_compare_gt(PyroVM* vm, PyroValue left, PyroValue right) {
-    switch (left.type) {
+    switch (PYRO_TYPE_OF(left)) {
         case PYRO_VALUE_I64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return left.as.i64 > right.as.i64;
+                    return PYRO_AS_I64(left) > PYRO_AS_I64(right);
                 case PYRO_VALUE_F64:
-                    return pyro_compare_int_and_float(left.as.i64, right.as.f64) == 1;
+                    return pyro_compare_int_and_float(PYRO_AS_I64(left), PYRO_AS_F64(right)) == 1;
                 case PYRO_VALUE_RUNE:
-                    return left.as.i64 > (int64_t)right.as.u32;
+                    return PYRO_AS_I64(left) > (int64_t)PYRO_AS_RUNE(right);
                 default:
                     break;
             }
@@ -1391,13 +1436,13 @@ bool pyro_op_compare_gt(PyroVM* vm, PyroValue left, PyroValue right) {
         }
 
         case PYRO_VALUE_RUNE: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return (int64_t)left.as.u32 > right.as.i64;
+                    return (int64_t)PYRO_AS_RUNE(left) > PYRO_AS_I64(right);
                 case PYRO_VALUE_F64:
-                    return pyro_compare_int_and_float((int64_t)left.as.u32, right.as.f64) == 1;
+                    return pyro_compare_int_and_float((int64_t)PYRO_AS_RUNE(left), PYRO_AS_F64(right)) == 1;
                 case PYRO_VALUE_RUNE:
-                    return left.as.u32 > right.as.u32;
+                    return PYRO_AS_RUNE(left) > PYRO_AS_RUNE(right);
                 default:
                     break;
             }
@@ -1405,13 +1450,13 @@ bool pyro_op_compare_gt(PyroVM* vm, PyroValue left, PyroValue right) {
         }
 
         case PYRO_VALUE_F64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return pyro_compare_int_and_float(right.as.i64, left.as.f64) == -1;
+                    return pyro_compare_int_and_float(PYRO_AS_I64(right), PYRO_AS_F64(left)) == -1;
                 case PYRO_VALUE_F64:
-                    return left.as.f64 > right.as.f64;
+                    return PYRO_AS_F64(left) > PYRO_AS_F64(right);
                 case PYRO_VALUE_RUNE:
-                    return pyro_compare_int_and_float((int64_t)right.as.u32, left.as.f64) == -1;
+                    return pyro_compare_int_and_float((int64_t)PYRO_AS_RUNE(right), PYRO_AS_F64(left)) == -1;
                 default:
                     break;
             }
@@ -1420,7 +1465,7 @@ bool pyro_op_compare_gt(PyroVM* vm, PyroValue left, PyroValue right) {
 
         case PYRO_VALUE_OBJ: {
             if (PYRO_IS_STR(left) && PYRO_IS_STR(right)) {
-                return compare_strings(PYRO_AS_STR(left), PYRO_AS_STR(right)) == 1;
+                return compare_strings(vm, PYRO_AS_STR(left), PYRO_AS_STR(right)) == 1;
             }
             if (PYRO_IS_TUP(left) && PYRO_IS_TUP(right)) {
                 return compare_tuples(vm, PYRO_AS_TUP(left), PYRO_AS_TUP(right)) == 1;
@@ -1467,17 +1512,17 @@ bool pyro_op_compare_gt(PyroVM* vm, PyroValue left, PyroValue right) {
 // Returns true if [left] >= [right]. Panics if the values are not comparable.
 // This function can call into Pyro code and can set the panic or exit flags.
 bool pyro_op_compare_ge(PyroVM* vm, PyroValue left, PyroValue right) {
-    switch (left.type) {
+    switch (PYRO_TYPE_OF(left)) {
         case PYRO_VALUE_I64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return left.as.i64 >= right.as.i64;
+                    return PYRO_AS_I64(left) >= PYRO_AS_I64(right);
                 case PYRO_VALUE_F64: {
-                    int result = pyro_compare_int_and_float(left.as.i64, right.as.f64);
+                    int result = pyro_compare_int_and_float(PYRO_AS_I64(left), PYRO_AS_F64(right));
                     return result == 1 || result == 0;
                 }
                 case PYRO_VALUE_RUNE:
-                    return left.as.i64 >= (int64_t)right.as.u32;
+                    return PYRO_AS_I64(left) >= (int64_t)PYRO_AS_RUNE(right);
                 default:
                     break;
             }
@@ -1485,15 +1530,15 @@ bool pyro_op_compare_ge(PyroVM* vm, PyroValue left, PyroValue right) {
         }
 
         case PYRO_VALUE_RUNE: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64:
-                    return (int64_t)left.as.u32 >= right.as.i64;
+                    return (int64_t)PYRO_AS_RUNE(left) >= PYRO_AS_I64(right);
                 case PYRO_VALUE_F64: {
-                    int result = pyro_compare_int_and_float((int64_t)left.as.u32, right.as.f64);
+                    int result = pyro_compare_int_and_float((int64_t)PYRO_AS_RUNE(left), PYRO_AS_F64(right));
                     return result == 1 || result == 0;
                 }
                 case PYRO_VALUE_RUNE:
-                    return left.as.u32 >= right.as.u32;
+                    return PYRO_AS_RUNE(left) >= PYRO_AS_RUNE(right);
                 default:
                     break;
             }
@@ -1501,15 +1546,15 @@ bool pyro_op_compare_ge(PyroVM* vm, PyroValue left, PyroValue right) {
         }
 
         case PYRO_VALUE_F64: {
-            switch (right.type) {
+            switch (PYRO_TYPE_OF(right)) {
                 case PYRO_VALUE_I64: {
-                    int result = pyro_compare_int_and_float(right.as.i64, left.as.f64);
+                    int result = pyro_compare_int_and_float(PYRO_AS_I64(right), PYRO_AS_F64(left));
                     return result == 0 || result == -1;
                 }
                 case PYRO_VALUE_F64:
-                    return left.as.f64 >= right.as.f64;
+                    return PYRO_AS_F64(left) >= PYRO_AS_F64(right);
                 case PYRO_VALUE_RUNE: {
-                    int result = pyro_compare_int_and_float((int64_t)right.as.u32, left.as.f64);
+                    int result = pyro_compare_int_and_float((int64_t)PYRO_AS_RUNE(right), PYRO_AS_F64(left));
                     return result == 0 || result == -1;
                 }
                 default:
@@ -1520,7 +1565,7 @@ bool pyro_op_compare_ge(PyroVM* vm, PyroValue left, PyroValue right) {
 
         case PYRO_VALUE_OBJ: {
             if (PYRO_IS_STR(left) && PYRO_IS_STR(right)) {
-                return compare_strings(PYRO_AS_STR(left), PYRO_AS_STR(right)) >= 0;
+                return compare_strings(vm, PYRO_AS_STR(left), PYRO_AS_STR(right)) >= 0;
             }
             if (PYRO_IS_TUP(left) && PYRO_IS_TUP(right)) {
                 return compare_tuples(vm, PYRO_AS_TUP(left), PYRO_AS_TUP(right)) >= 0;
@@ -1598,8 +1643,11 @@ PyroValue pyro_op_get_index(PyroVM* vm, PyroValue receiver, PyroValue key) {
             }
 
             PyroStr* str = PYRO_AS_STR(receiver);
+            if (!PyroStr_view(str, vm)) {
+                return pyro_null();
+            }
 
-            int64_t index = key.as.i64;
+            int64_t index = PYRO_AS_I64(key);
             if (index < 0) {
                 index += str->count;
             }
@@ -1629,7 +1677,7 @@ PyroValue pyro_op_get_index(PyroVM* vm, PyroValue receiver, PyroValue key) {
 
             PyroVec* vec = PYRO_AS_VEC(receiver);
 
-            int64_t index = key.as.i64;
+            int64_t index = PYRO_AS_I64(key);
             if (index < 0) {
                 index += vec->count;
             }
@@ -1653,7 +1701,7 @@ PyroValue pyro_op_get_index(PyroVM* vm, PyroValue receiver, PyroValue key) {
 
             PyroTup* tup = PYRO_AS_TUP(receiver);
 
-            int64_t index = key.as.i64;
+            int64_t index = PYRO_AS_I64(key);
             if (index < 0) {
                 index += tup->count;
             }
@@ -1714,7 +1762,7 @@ PyroValue pyro_op_set_index(PyroVM* vm, PyroValue receiver, PyroValue key, PyroV
 
             PyroVec* vec = PYRO_AS_VEC(receiver);
 
-            int64_t index = key.as.i64;
+            int64_t index = PYRO_AS_I64(key);
             if (index < 0) {
                 index += vec->count;
             }
@@ -1724,6 +1772,7 @@ PyroValue pyro_op_set_index(PyroVM* vm, PyroValue receiver, PyroValue key, PyroV
                 return pyro_null();
             }
 
+            pyro_write_barrier(vm, (PyroObject*)vec, value);
             vec->values[index] = value;
             vec->version++;
             return value;
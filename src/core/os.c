@@ -25,6 +25,12 @@
 // POSIX: ioctl()
 #include <sys/ioctl.h>
 
+// POSIX: mmap(), munmap()
+#include <sys/mman.h>
+
+// POSIX: open()
+#include <fcntl.h>
+
 // If [path] is a symlink, stat() returns info about the target of the link.
 bool pyro_exists(const char* path) {
     struct stat s;
@@ -435,3 +441,90 @@ PyroBuf* pyro_csrng_rand_bytes(PyroVM* vm, size_t num_bytes, const char* err_pre
     buf->count = num_bytes_read;
     return buf;
 }
+
+
+bool pyro_mmap_file(const char* path, void** addr, size_t* length) {
+    int fd = open(path, O_RDONLY);
+    if (fd == -1) {
+        return false;
+    }
+
+    struct stat s;
+    if (fstat(fd, &s) != 0 || !S_ISREG(s.st_mode)) {
+        close(fd);
+        return false;
+    }
+
+    // A zero-length mapping is invalid, so empty files aren't mapped.
+    if (s.st_size == 0) {
+        close(fd);
+        *addr = NULL;
+        *length = 0;
+        return true;
+    }
+
+    void* mapping = mmap(NULL, (size_t)s.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping remains valid after the file descriptor is closed.
+    close(fd);
+
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    *addr = mapping;
+    *length = (size_t)s.st_size;
+    return true;
+}
+
+
+void pyro_munmap(void* addr, size_t length) {
+    if (addr) {
+        munmap(addr, length);
+    }
+}
+
+
+bool pyro_write_file_atomically(const char* path, const uint8_t* bytes, size_t length) {
+    size_t path_length = strlen(path);
+    char* temp_path = malloc(path_length + strlen(".XXXXXX") + 1);
+    if (!temp_path) {
+        return false;
+    }
+
+    memcpy(temp_path, path, path_length);
+    memcpy(&temp_path[path_length], ".XXXXXX", strlen(".XXXXXX") + 1);
+
+    int fd = mkstemp(temp_path);
+    if (fd == -1) {
+        free(temp_path);
+        return false;
+    }
+
+    while (length > 0) {
+        ssize_t count = write(fd, bytes, length);
+        if (count == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            close(fd);
+            unlink(temp_path);
+            free(temp_path);
+            return false;
+        }
+        bytes += count;
+        length -= (size_t)count;
+    }
+
+    // The temporary file is created with mode 0600.
+    fchmod(fd, 0644);
+
+    if (close(fd) != 0 || rename(temp_path, path) != 0) {
+        unlink(temp_path);
+        free(temp_path);
+        return false;
+    }
+
+    free(temp_path);
+    return true;
+}
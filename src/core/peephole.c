@@ -0,0 +1,551 @@
+#include "../includes/pyro.h"
+
+
+// A jump instruction in the optimized bytecode whose offset still needs to be patched in. The
+// target is recorded as an address in the original bytecode.
+typedef struct {
+    size_t new_ip;
+    size_t old_target;
+} PendingJump;
+
+
+typedef struct {
+    PyroVM* vm;
+    PyroFn* fn;
+    bool failed;
+
+    // These arrays are indexed by instruction address in the original bytecode. [lines] stores
+    // the line number offset of each instruction, i.e. its index in the [bpl] array.
+    size_t* targets;
+    size_t* lines;
+    size_t* new_ips;
+    bool* is_jump_target;
+
+    // The optimized bytecode and its line number table.
+    uint8_t* code;
+    size_t code_count;
+    size_t code_capacity;
+    uint16_t* bpl;
+
+    PendingJump* jumps;
+    size_t jump_count;
+} Optimizer;
+
+
+/* ------------------ */
+/*  Instruction Info  */
+/* ------------------ */
+
+
+static size_t instruction_length(PyroFn* fn, size_t ip) {
+    return 1 + PyroFn_opcode_argcount(fn, ip);
+}
+
+
+static uint16_t read_be_u16(uint8_t* bytes) {
+    return (uint16_t)((bytes[0] << 8) | bytes[1]);
+}
+
+
+// Returns true if the opcode is a forward jump with a 2-byte offset argument.
+static bool is_forward_jump(uint8_t opcode) {
+    switch (opcode) {
+        case PYRO_OPCODE_JUMP:
+        case PYRO_OPCODE_JUMP_IF_ERR:
+        case PYRO_OPCODE_JUMP_IF_FALSE:
+        case PYRO_OPCODE_JUMP_IF_NOT_ERR:
+        case PYRO_OPCODE_JUMP_IF_NOT_NULL:
+        case PYRO_OPCODE_JUMP_IF_TRUE:
+        case PYRO_OPCODE_POP_JUMP_IF_FALSE:
+        case PYRO_OPCODE_JUMP_IF_EQUAL:
+        case PYRO_OPCODE_JUMP_IF_NOT_EQUAL:
+        case PYRO_OPCODE_JUMP_IF_NOT_GREATER:
+        case PYRO_OPCODE_JUMP_IF_NOT_GREATER_EQUAL:
+        case PYRO_OPCODE_JUMP_IF_NOT_LESS:
+        case PYRO_OPCODE_JUMP_IF_NOT_LESS_EQUAL:
+            return true;
+        default:
+            return false;
+    }
+}
+
+
+// Returns true if the opcode is a conditional jump that leaves the stack unchanged. If one of
+// these jumps lands on an identical jump, the second jump is guaranteed to be taken too.
+static bool is_non_popping_conditional_jump(uint8_t opcode) {
+    switch (opcode) {
+        case PYRO_OPCODE_JUMP_IF_ERR:
+        case PYRO_OPCODE_JUMP_IF_FALSE:
+        case PYRO_OPCODE_JUMP_IF_NOT_ERR:
+        case PYRO_OPCODE_JUMP_IF_NOT_NULL:
+        case PYRO_OPCODE_JUMP_IF_TRUE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+
+// Returns true if the instruction pushes a value without side effects, i.e. if the instruction
+// can be deleted along with a POP that immediately follows it.
+static bool is_pure_push(uint8_t opcode) {
+    if (opcode >= PYRO_OPCODE_GET_LOCAL_0 && opcode <= PYRO_OPCODE_GET_LOCAL_9) {
+        return true;
+    }
+
+    if (opcode >= PYRO_OPCODE_LOAD_CONSTANT_0 && opcode <= PYRO_OPCODE_LOAD_CONSTANT_9) {
+        return true;
+    }
+
+    if (opcode >= PYRO_OPCODE_LOAD_I64_0 && opcode <= PYRO_OPCODE_LOAD_I64_9) {
+        return true;
+    }
+
+    switch (opcode) {
+        case PYRO_OPCODE_DUP:
+        case PYRO_OPCODE_GET_LOCAL:
+        case PYRO_OPCODE_LOAD_CONSTANT:
+        case PYRO_OPCODE_LOAD_FALSE:
+        case PYRO_OPCODE_LOAD_NULL:
+        case PYRO_OPCODE_LOAD_TRUE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+
+// If the instruction at [ip] is a GET_LOCAL instruction, returns the local's index. Otherwise
+// returns -1.
+static int get_local_index(PyroFn* fn, size_t ip) {
+    uint8_t opcode = fn->code[ip];
+    if (opcode == PYRO_OPCODE_GET_LOCAL) {
+        return fn->code[ip + 1];
+    }
+    if (opcode >= PYRO_OPCODE_GET_LOCAL_0 && opcode <= PYRO_OPCODE_GET_LOCAL_9) {
+        return opcode - PYRO_OPCODE_GET_LOCAL_0;
+    }
+    return -1;
+}
+
+
+// If the instruction at [ip] is a SET_LOCAL instruction, returns the local's index. Otherwise
+// returns -1.
+static int set_local_index(PyroFn* fn, size_t ip) {
+    uint8_t opcode = fn->code[ip];
+    if (opcode == PYRO_OPCODE_SET_LOCAL) {
+        return fn->code[ip + 1];
+    }
+    if (opcode >= PYRO_OPCODE_SET_LOCAL_0 && opcode <= PYRO_OPCODE_SET_LOCAL_9) {
+        return opcode - PYRO_OPCODE_SET_LOCAL_0;
+    }
+    return -1;
+}
+
+
+// If the instruction at [ip] loads a constant, returns the value's index in the constant table,
+// adding the value to the table if necessary. Otherwise returns -1.
+static int64_t get_constant_index(Optimizer* opt, size_t ip) {
+    uint8_t opcode = opt->fn->code[ip];
+
+    if (opcode == PYRO_OPCODE_LOAD_CONSTANT) {
+        return read_be_u16(&opt->fn->code[ip + 1]);
+    }
+
+    if (opcode >= PYRO_OPCODE_LOAD_CONSTANT_0 && opcode <= PYRO_OPCODE_LOAD_CONSTANT_9) {
+        return opcode - PYRO_OPCODE_LOAD_CONSTANT_0;
+    }
+
+    if (opcode >= PYRO_OPCODE_LOAD_I64_0 && opcode <= PYRO_OPCODE_LOAD_I64_9) {
+        int64_t index = PyroFn_add_constant(opt->fn, pyro_i64(opcode - PYRO_OPCODE_LOAD_I64_0), opt->vm);
+        return index > UINT16_MAX ? -1 : index;
+    }
+
+    return -1;
+}
+
+
+// Returns the compare-and-branch superinstruction equivalent to the comparison [opcode]
+// followed by POP_JUMP_IF_FALSE, or 0 if there isn't one.
+static uint8_t get_compare_and_jump_opcode(uint8_t opcode) {
+    switch (opcode) {
+        case PYRO_OPCODE_BINARY_EQUAL_EQUAL:
+            return PYRO_OPCODE_JUMP_IF_NOT_EQUAL;
+        case PYRO_OPCODE_BINARY_BANG_EQUAL:
+            return PYRO_OPCODE_JUMP_IF_EQUAL;
+        case PYRO_OPCODE_BINARY_GREATER:
+            return PYRO_OPCODE_JUMP_IF_NOT_GREATER;
+        case PYRO_OPCODE_BINARY_GREATER_EQUAL:
+            return PYRO_OPCODE_JUMP_IF_NOT_GREATER_EQUAL;
+        case PYRO_OPCODE_BINARY_LESS:
+            return PYRO_OPCODE_JUMP_IF_NOT_LESS;
+        case PYRO_OPCODE_BINARY_LESS_EQUAL:
+            return PYRO_OPCODE_JUMP_IF_NOT_LESS_EQUAL;
+        default:
+            return 0;
+    }
+}
+
+
+/* ---------- */
+/*  Analysis  */
+/* ---------- */
+
+
+// Records the line number and jump target of each instruction in the original bytecode.
+static void decode_instructions(Optimizer* opt) {
+    PyroFn* fn = opt->fn;
+
+    // This mirrors PyroFn_get_line_number(): an instruction belongs to the first line whose
+    // running total of bytes exceeds its address.
+    size_t line_offset = 0;
+    size_t line_end = fn->bpl[0];
+
+    for (size_t ip = 0; ip < fn->code_count; ip += instruction_length(fn, ip)) {
+        while (line_end <= ip && line_offset + 1 < fn->bpl_capacity) {
+            line_offset++;
+            line_end += fn->bpl[line_offset];
+        }
+        opt->lines[ip] = line_offset;
+
+        uint8_t opcode = fn->code[ip];
+        if (is_forward_jump(opcode)) {
+            opt->targets[ip] = ip + 3 + read_be_u16(&fn->code[ip + 1]);
+        } else if (opcode == PYRO_OPCODE_JUMP_BACK) {
+            opt->targets[ip] = ip + 3 - read_be_u16(&fn->code[ip + 1]);
+        } else {
+            continue;
+        }
+
+        if (opt->targets[ip] > fn->code_count) {
+            opt->failed = true;
+            return;
+        }
+    }
+}
+
+
+// Retargets forward jumps that land on a jump which is guaranteed to be taken. Forward jumps
+// always land on a higher address so following a chain always terminates.
+static void thread_jumps(Optimizer* opt) {
+    PyroFn* fn = opt->fn;
+
+    for (size_t ip = 0; ip < fn->code_count; ip += instruction_length(fn, ip)) {
+        uint8_t opcode = fn->code[ip];
+        if (!is_forward_jump(opcode)) {
+            continue;
+        }
+
+        size_t target = opt->targets[ip];
+        while (target < fn->code_count) {
+            uint8_t target_opcode = fn->code[target];
+            if (target_opcode == PYRO_OPCODE_JUMP) {
+                target = opt->targets[target];
+            } else if (target_opcode == opcode && is_non_popping_conditional_jump(opcode)) {
+                target = opt->targets[target];
+            } else {
+                break;
+            }
+        }
+        opt->targets[ip] = target;
+    }
+
+    for (size_t ip = 0; ip < fn->code_count; ip += instruction_length(fn, ip)) {
+        uint8_t opcode = fn->code[ip];
+        if (is_forward_jump(opcode) || opcode == PYRO_OPCODE_JUMP_BACK) {
+            opt->is_jump_target[opt->targets[ip]] = true;
+        }
+    }
+}
+
+
+// Returns true if the [count] instructions starting at [ip] can be rewritten as a unit, i.e. if
+// they all exist and no jump lands inside the sequence. Writes their addresses to [ips].
+static bool is_fusable(Optimizer* opt, size_t ip, size_t count, size_t* ips) {
+    ips[0] = ip;
+    for (size_t i = 1; i < count; i++) {
+        ips[i] = ips[i - 1] + instruction_length(opt->fn, ips[i - 1]);
+        if (ips[i] >= opt->fn->code_count || opt->is_jump_target[ips[i]]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+/* ---------- */
+/*  Emitting  */
+/* ---------- */
+
+
+static void emit_byte(Optimizer* opt, uint8_t byte) {
+    if (opt->code_count == opt->code_capacity) {
+        opt->failed = true;
+        return;
+    }
+    opt->code[opt->code_count++] = byte;
+}
+
+
+static void emit_u16(Optimizer* opt, uint16_t value) {
+    emit_byte(opt, (value >> 8) & 0xff);
+    emit_byte(opt, value & 0xff);
+}
+
+
+// Attributes the instruction emitted at [new_ip] to the source line of the original instruction
+// at [old_ip]. Fused instructions take the line of the component that can panic so error
+// messages report the same line as before.
+static void add_line(Optimizer* opt, size_t new_ip, size_t old_ip) {
+    size_t line_offset = opt->lines[old_ip];
+    size_t length = opt->code_count - new_ip;
+    if (opt->bpl[line_offset] > UINT16_MAX - length) {
+        opt->failed = true;
+        return;
+    }
+    opt->bpl[line_offset] += length;
+}
+
+
+// Emits a jump instruction with a placeholder offset to be patched once the new address of
+// [old_target] is known.
+static void emit_jump(Optimizer* opt, uint8_t opcode, size_t old_target) {
+    opt->jumps[opt->jump_count].new_ip = opt->code_count;
+    opt->jumps[opt->jump_count].old_target = old_target;
+    opt->jump_count++;
+    emit_byte(opt, opcode);
+    emit_u16(opt, 0);
+}
+
+
+// Emits the optimized code for the instruction or instruction sequence starting at [ip].
+// Returns the address of the next unprocessed instruction.
+static size_t optimize_instruction(Optimizer* opt, size_t ip) {
+    PyroFn* fn = opt->fn;
+    uint8_t opcode = fn->code[ip];
+    size_t new_ip = opt->code_count;
+    size_t ips[3];
+
+    // JUMP +0, e.g. from an [if] statement with an empty [else] branch.
+    if (opcode == PYRO_OPCODE_JUMP && opt->targets[ip] == ip + 3) {
+        return ip + 3;
+    }
+
+    if (is_fusable(opt, ip, 3, ips)) {
+        int local_index = get_local_index(fn, ips[0]);
+        if (local_index >= 0 && fn->code[ips[2]] == PYRO_OPCODE_BINARY_PLUS) {
+            int64_t const_index = get_constant_index(opt, ips[1]);
+            if (const_index >= 0) {
+                emit_byte(opt, PYRO_OPCODE_GET_LOCAL_PLUS_CONSTANT);
+                emit_byte(opt, (uint8_t)local_index);
+                emit_u16(opt, (uint16_t)const_index);
+                add_line(opt, new_ip, ips[2]);
+                return ips[2] + 1;
+            }
+        }
+    }
+
+    if (is_fusable(opt, ip, 2, ips)) {
+        uint8_t next_opcode = fn->code[ips[1]];
+        size_t after = ips[1] + instruction_length(fn, ips[1]);
+
+        if (next_opcode == PYRO_OPCODE_POP) {
+            if (is_pure_push(opcode)) {
+                return after;
+            }
+
+            int local_index = set_local_index(fn, ip);
+            if (local_index >= 0) {
+                emit_byte(opt, PYRO_OPCODE_POP_SET_LOCAL);
+                emit_byte(opt, (uint8_t)local_index);
+                add_line(opt, new_ip, ip);
+                return after;
+            }
+        }
+
+        if (next_opcode == PYRO_OPCODE_POP_JUMP_IF_FALSE) {
+            if (opcode == PYRO_OPCODE_LOAD_TRUE) {
+                return after;
+            }
+
+            if (opcode == PYRO_OPCODE_LOAD_FALSE) {
+                emit_jump(opt, PYRO_OPCODE_JUMP, opt->targets[ips[1]]);
+                add_line(opt, new_ip, ips[1]);
+                return after;
+            }
+
+            uint8_t fused_opcode = get_compare_and_jump_opcode(opcode);
+            if (fused_opcode) {
+                emit_jump(opt, fused_opcode, opt->targets[ips[1]]);
+                add_line(opt, new_ip, ip);
+                return after;
+            }
+        }
+
+        if (next_opcode == PYRO_OPCODE_GET_FIELD || next_opcode == PYRO_OPCODE_GET_PUB_FIELD) {
+            int local_index = get_local_index(fn, ip);
+            if (local_index >= 0) {
+                emit_byte(opt, next_opcode == PYRO_OPCODE_GET_FIELD ? PYRO_OPCODE_GET_LOCAL_FIELD : PYRO_OPCODE_GET_LOCAL_PUB_FIELD);
+                emit_byte(opt, (uint8_t)local_index);
+                for (size_t i = 1; i <= 4; i++) {
+                    emit_byte(opt, fn->code[ips[1] + i]);
+                }
+                add_line(opt, new_ip, ips[1]);
+                return after;
+            }
+        }
+    }
+
+    if (is_forward_jump(opcode) || opcode == PYRO_OPCODE_JUMP_BACK) {
+        emit_jump(opt, opcode, opt->targets[ip]);
+        add_line(opt, new_ip, ip);
+        return ip + 3;
+    }
+
+    size_t length = instruction_length(fn, ip);
+    for (size_t i = 0; i < length; i++) {
+        emit_byte(opt, fn->code[ip + i]);
+    }
+    add_line(opt, new_ip, ip);
+    return ip + length;
+}
+
+
+// Writes the final offset into each jump instruction. Fails if an offset no longer fits in
+// 16 bits.
+static void patch_jumps(Optimizer* opt) {
+    for (size_t i = 0; i < opt->jump_count; i++) {
+        size_t new_ip = opt->jumps[i].new_ip;
+        size_t new_target = opt->new_ips[opt->jumps[i].old_target];
+        size_t next_ip = new_ip + 3;
+
+        size_t offset;
+        if (opt->code[new_ip] == PYRO_OPCODE_JUMP_BACK) {
+            offset = next_ip - new_target;
+            if (new_target > next_ip) {
+                opt->failed = true;
+                return;
+            }
+        } else {
+            offset = new_target - next_ip;
+            if (new_target < next_ip) {
+                opt->failed = true;
+                return;
+            }
+        }
+
+        if (new_target == SIZE_MAX || offset > UINT16_MAX) {
+            opt->failed = true;
+            return;
+        }
+
+        opt->code[new_ip + 1] = (offset >> 8) & 0xff;
+        opt->code[new_ip + 2] = offset & 0xff;
+    }
+}
+
+
+/* ----------- */
+/*  Interface  */
+/* ----------- */
+
+
+// Rewrites the function's bytecode, leaving it unchanged if any step fails.
+static void optimize(Optimizer* opt) {
+    PyroFn* fn = opt->fn;
+    size_t count = fn->code_count;
+
+    memset(opt->is_jump_target, 0, sizeof(bool) * (count + 1));
+    memset(opt->bpl, 0, sizeof(uint16_t) * fn->bpl_capacity);
+    for (size_t i = 0; i <= count; i++) {
+        opt->new_ips[i] = SIZE_MAX;
+    }
+
+    decode_instructions(opt);
+    if (opt->failed) {
+        return;
+    }
+
+    thread_jumps(opt);
+
+    size_t ip = 0;
+    while (ip < count && !opt->failed) {
+        opt->new_ips[ip] = opt->code_count;
+        ip = optimize_instruction(opt, ip);
+    }
+    opt->new_ips[count] = opt->code_count;
+
+    if (opt->failed) {
+        return;
+    }
+
+    patch_jumps(opt);
+    if (opt->failed) {
+        return;
+    }
+
+    if (opt->code_count <= fn->code_capacity) {
+        memcpy(fn->code, opt->code, opt->code_count);
+    } else {
+        PYRO_FREE_ARRAY(opt->vm, uint8_t, fn->code, fn->code_capacity);
+        fn->code = opt->code;
+        fn->code_capacity = opt->code_capacity;
+        opt->code = NULL;
+    }
+    fn->code_count = opt->code_count;
+    memcpy(fn->bpl, opt->bpl, sizeof(uint16_t) * fn->bpl_capacity);
+}
+
+
+void pyro_optimize_bytecode(PyroVM* vm, PyroFn* fn) {
+    if (fn->code_count == 0 || fn->bpl_capacity == 0) {
+        return;
+    }
+
+    size_t count = fn->code_count;
+    size_t bpl_capacity = fn->bpl_capacity;
+
+    // Fusing a three-byte sequence into GET_LOCAL_PLUS_CONSTANT is the only rewrite that grows
+    // the code, so twice the original length is always enough.
+    Optimizer opt = {
+        .vm = vm,
+        .fn = fn,
+        .failed = false,
+        .targets = PYRO_ALLOCATE_ARRAY(vm, size_t, count + 1),
+        .lines = PYRO_ALLOCATE_ARRAY(vm, size_t, count + 1),
+        .new_ips = PYRO_ALLOCATE_ARRAY(vm, size_t, count + 1),
+        .is_jump_target = PYRO_ALLOCATE_ARRAY(vm, bool, count + 1),
+        .code = PYRO_ALLOCATE_ARRAY(vm, uint8_t, count * 2),
+        .code_count = 0,
+        .code_capacity = count * 2,
+        .bpl = PYRO_ALLOCATE_ARRAY(vm, uint16_t, bpl_capacity),
+        .jumps = PYRO_ALLOCATE_ARRAY(vm, PendingJump, count / 3 + 1),
+        .jump_count = 0,
+    };
+
+    if (opt.targets && opt.lines && opt.new_ips && opt.is_jump_target && opt.code && opt.bpl && opt.jumps) {
+        optimize(&opt);
+    }
+
+    if (opt.targets) {
+        PYRO_FREE_ARRAY(vm, size_t, opt.targets, count + 1);
+    }
+    if (opt.lines) {
+        PYRO_FREE_ARRAY(vm, size_t, opt.lines, count + 1);
+    }
+    if (opt.new_ips) {
+        PYRO_FREE_ARRAY(vm, size_t, opt.new_ips, count + 1);
+    }
+    if (opt.is_jump_target) {
+        PYRO_FREE_ARRAY(vm, bool, opt.is_jump_target, count + 1);
+    }
+    if (opt.code) {
+        PYRO_FREE_ARRAY(vm, uint8_t, opt.code, count * 2);
+    }
+    if (opt.bpl) {
+        PYRO_FREE_ARRAY(vm, uint16_t, opt.bpl, bpl_capacity);
+    }
+    if (opt.jumps) {
+        PYRO_FREE_ARRAY(vm, PendingJump, opt.jumps, count / 3 + 1);
+    }
+}
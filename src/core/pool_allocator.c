@@ -0,0 +1,170 @@
+#include "../includes/pyro.h"
+
+
+// Blocks start at the first multiple of PYRO_POOL_SIZE_CLASS_STEP after the slab's header.
+#define SLAB_HEADER_SIZE \
+    ((sizeof(PyroPoolSlab) + PYRO_POOL_SIZE_CLASS_STEP - 1) & ~((size_t)PYRO_POOL_SIZE_CLASS_STEP - 1))
+
+
+static inline size_t get_size_class(size_t size) {
+    assert(size > 0 && size <= PYRO_POOL_MAX_BLOCK_SIZE);
+    return (size - 1) / PYRO_POOL_SIZE_CLASS_STEP;
+}
+
+
+static inline PyroPoolSlab* get_slab(void* block) {
+    return (PyroPoolSlab*)((uintptr_t)block & ~((uintptr_t)PYRO_POOL_SLAB_SIZE - 1));
+}
+
+
+static inline bool is_full(PyroPoolSlab* slab) {
+    return slab->free_list == NULL && slab->unused + slab->block_size > slab->end;
+}
+
+
+static void unlink_slab(PyroPoolSlab** list, PyroPoolSlab* slab) {
+    if (slab->prev) {
+        slab->prev->next = slab->next;
+    } else {
+        *list = slab->next;
+    }
+
+    if (slab->next) {
+        slab->next->prev = slab->prev;
+    }
+}
+
+
+static void push_slab(PyroPoolSlab** list, PyroPoolSlab* slab) {
+    slab->prev = NULL;
+    slab->next = *list;
+    if (*list) {
+        (*list)->prev = slab;
+    }
+    *list = slab;
+}
+
+
+static PyroPoolSlab* new_slab(size_t block_size) {
+    void* memory;
+    if (posix_memalign(&memory, PYRO_POOL_SLAB_SIZE, PYRO_POOL_SLAB_SIZE) != 0) {
+        return NULL;
+    }
+
+    PyroPoolSlab* slab = memory;
+    slab->next = NULL;
+    slab->prev = NULL;
+    slab->free_list = NULL;
+    slab->unused = (char*)memory + SLAB_HEADER_SIZE;
+    slab->end = (char*)memory + PYRO_POOL_SLAB_SIZE;
+    slab->block_size = block_size;
+    slab->live_count = 0;
+    slab->is_available = true;
+    return slab;
+}
+
+
+void PyroPoolAllocator_init(PyroPoolAllocator* allocator) {
+    for (size_t i = 0; i < PYRO_POOL_SIZE_CLASS_COUNT; i++) {
+        allocator->pools[i].available = NULL;
+        allocator->pools[i].full = NULL;
+    }
+}
+
+
+void* PyroPoolAllocator_alloc(PyroPoolAllocator* allocator, size_t size) {
+    size_t size_class = get_size_class(size);
+    PyroPool* pool = &allocator->pools[size_class];
+
+    PyroPoolSlab* slab = pool->available;
+    if (!slab) {
+        slab = new_slab((size_class + 1) * PYRO_POOL_SIZE_CLASS_STEP);
+        if (!slab) {
+            return NULL;
+        }
+        push_slab(&pool->available, slab);
+    }
+
+    void* block;
+    if (slab->free_list) {
+        block = slab->free_list;
+        slab->free_list = *(void**)block;
+    } else {
+        block = slab->unused;
+        slab->unused += slab->block_size;
+    }
+
+    slab->live_count++;
+
+    if (is_full(slab)) {
+        unlink_slab(&pool->available, slab);
+        push_slab(&pool->full, slab);
+        slab->is_available = false;
+    }
+
+    return block;
+}
+
+
+void PyroPoolAllocator_free(PyroPoolAllocator* allocator, void* block, size_t size) {
+    PyroPoolSlab* slab = get_slab(block);
+    assert(slab->block_size == (get_size_class(size) + 1) * PYRO_POOL_SIZE_CLASS_STEP);
+    assert(slab->live_count > 0);
+
+    #ifdef PYRO_DEBUG
+        memset(block, 0xDD, slab->block_size);
+    #endif
+
+    *(void**)block = slab->free_list;
+    slab->free_list = block;
+    slab->live_count--;
+
+    // Empty slabs stay on the [available] list until the next call to
+    // PyroPoolAllocator_release_empty_slabs(), so a sweep that frees and reallocates lots of
+    // blocks doesn't repeatedly return slabs to the OS.
+    if (!slab->is_available) {
+        PyroPool* pool = &allocator->pools[get_size_class(size)];
+        unlink_slab(&pool->full, slab);
+        push_slab(&pool->available, slab);
+        slab->is_available = true;
+    }
+}
+
+
+void PyroPoolAllocator_release_empty_slabs(PyroPoolAllocator* allocator) {
+    for (size_t i = 0; i < PYRO_POOL_SIZE_CLASS_COUNT; i++) {
+        PyroPool* pool = &allocator->pools[i];
+        bool kept_empty_slab = false;
+
+        PyroPoolSlab* slab = pool->available;
+        while (slab) {
+            PyroPoolSlab* next = slab->next;
+            if (slab->live_count == 0) {
+                if (kept_empty_slab) {
+                    unlink_slab(&pool->available, slab);
+                    free(slab);
+                } else {
+                    kept_empty_slab = true;
+                }
+            }
+            slab = next;
+        }
+    }
+}
+
+
+void PyroPoolAllocator_free_all(PyroPoolAllocator* allocator) {
+    for (size_t i = 0; i < PYRO_POOL_SIZE_CLASS_COUNT; i++) {
+        PyroPoolSlab* lists[] = {allocator->pools[i].available, allocator->pools[i].full};
+        for (size_t j = 0; j < 2; j++) {
+            PyroPoolSlab* slab = lists[j];
+            while (slab) {
+                PyroPoolSlab* next = slab->next;
+                free(slab);
+                slab = next;
+            }
+        }
+        allocator->pools[i].available = NULL;
+        allocator->pools[i].full = NULL;
+    }
+}
@@ -0,0 +1,985 @@
+#include "../includes/pyro.h"
+
+
+// Translates a function's stack bytecode into register code by running the bytecode over a
+// virtual value stack. Each stack slot has its own register, so a value pushed onto slot [i]
+// lives in register [i] and the function's locals keep their stack indexes. Pushes of locals and
+// constants are lazy: the slot just records the register that already holds the value, so an
+// expression like [x + 1] reads its operands straight from the local's register and a constant
+// register without any moves. Lazy slots are written to their own registers ("materialized")
+// before anything that needs the real stack layout, i.e. jumps, jump targets, and calls.
+
+
+// A jump in the register code whose target still needs to be patched in. The target is
+// recorded as an offset in the stack bytecode.
+typedef struct {
+    size_t reg_ip;
+    size_t target;
+} PendingJump;
+
+
+typedef struct {
+    PyroVM* vm;
+    PyroFn* fn;
+    bool failed;
+
+    // Set if the pass found the stack depth at a loop header it had already skipped as
+    // unreachable, e.g. a loop's increment block that sits above the loop body and is only
+    // reached by jumping back to it. Another pass can then translate the skipped code.
+    bool needs_another_pass;
+
+    // The virtual value stack. Each entry is the register holding the slot's value. A slot is
+    // materialized if its value is in its own register, i.e. if [slots[i] == i]. An entry only
+    // ever refers to a lower slot's register or to a constant register.
+    size_t* slots;
+    size_t slots_capacity;
+    size_t depth;
+    size_t max_depth;
+
+    // Registers from [const_base] upwards hold constants.
+    size_t const_base;
+
+    // These arrays are indexed by offset in the stack bytecode.
+    bool* is_target;
+    size_t* target_depths;
+    size_t* reg_ips;
+
+    // The end offset of the stack instruction being translated.
+    size_t ip_end;
+
+    PyroRegInstruction* code;
+    size_t code_count;
+    size_t code_capacity;
+
+    PyroValue* constants;
+    size_t const_count;
+    size_t const_capacity;
+
+    PendingJump* jumps;
+    size_t jump_count;
+    size_t jump_capacity;
+
+    PyroRegEntry* entries;
+    size_t entry_count;
+    size_t entry_capacity;
+} Translator;
+
+
+// Grows a dynamic array owned by the translator if it's full.
+#define GROW_IF_FULL(t, type, array, count, capacity) \
+    if ((t)->count == (t)->capacity) { \
+        size_t new_capacity = pyro_grow_capacity((t)->capacity); \
+        type* new_array = PYRO_REALLOCATE_ARRAY((t)->vm, type, (t)->array, (t)->capacity, new_capacity); \
+        if (!new_array) { \
+            (t)->failed = true; \
+            return; \
+        } \
+        (t)->array = new_array; \
+        (t)->capacity = new_capacity; \
+    }
+
+
+/* ------------------ */
+/*  Instruction Info  */
+/* ------------------ */
+
+
+static size_t instruction_length(PyroFn* fn, size_t ip) {
+    return 1 + PyroFn_opcode_argcount(fn, ip);
+}
+
+
+static uint16_t read_be_u16(uint8_t* bytes) {
+    return (uint16_t)((bytes[0] << 8) | bytes[1]);
+}
+
+
+// Returns the index of the local written by a SET_LOCAL instruction, or -1.
+static int set_local_index(PyroFn* fn, size_t ip) {
+    uint8_t opcode = fn->code[ip];
+    if (opcode == PYRO_OPCODE_SET_LOCAL) {
+        return fn->code[ip + 1];
+    }
+    if (opcode >= PYRO_OPCODE_SET_LOCAL_0 && opcode <= PYRO_OPCODE_SET_LOCAL_9) {
+        return opcode - PYRO_OPCODE_SET_LOCAL_0;
+    }
+    return -1;
+}
+
+
+// Returns the target offset of a jump instruction in the stack bytecode.
+static size_t jump_target(PyroFn* fn, size_t ip) {
+    size_t offset = read_be_u16(&fn->code[ip + 1]);
+    if (fn->code[ip] == PYRO_OPCODE_JUMP_BACK) {
+        return ip + 3 - offset;
+    }
+    return ip + 3 + offset;
+}
+
+
+static bool is_jump(uint8_t opcode) {
+    switch (opcode) {
+        case PYRO_OPCODE_JUMP:
+        case PYRO_OPCODE_JUMP_BACK:
+        case PYRO_OPCODE_JUMP_IF_ERR:
+        case PYRO_OPCODE_JUMP_IF_FALSE:
+        case PYRO_OPCODE_JUMP_IF_NOT_ERR:
+        case PYRO_OPCODE_JUMP_IF_NOT_NULL:
+        case PYRO_OPCODE_JUMP_IF_TRUE:
+        case PYRO_OPCODE_POP_JUMP_IF_FALSE:
+        case PYRO_OPCODE_JUMP_IF_EQUAL:
+        case PYRO_OPCODE_JUMP_IF_NOT_EQUAL:
+        case PYRO_OPCODE_JUMP_IF_NOT_GREATER:
+        case PYRO_OPCODE_JUMP_IF_NOT_GREATER_EQUAL:
+        case PYRO_OPCODE_JUMP_IF_NOT_LESS:
+        case PYRO_OPCODE_JUMP_IF_NOT_LESS_EQUAL:
+            return true;
+        default:
+            return false;
+    }
+}
+
+
+/* ---------- */
+/*  Emitting  */
+/* ---------- */
+
+
+static void emit(Translator* t, uint8_t opcode, size_t a, size_t b, size_t c, size_t x) {
+    GROW_IF_FULL(t, PyroRegInstruction, code, code_count, code_capacity);
+    PyroRegInstruction* instruction = &t->code[t->code_count++];
+    instruction->opcode = opcode;
+    instruction->a = (uint16_t)a;
+    instruction->b = (uint16_t)b;
+    instruction->c = (uint16_t)c;
+    instruction->x = (uint16_t)x;
+    instruction->ip = (uint32_t)t->ip_end;
+}
+
+
+// Records that the stack bytecode at [target] is reached with [depth] slots on the stack.
+// Every path to an instruction has to agree on the stack depth.
+static void record_target_depth(Translator* t, size_t target, size_t depth) {
+    if (t->target_depths[target] == SIZE_MAX) {
+        t->target_depths[target] = depth;
+    } else if (t->target_depths[target] != depth) {
+        t->failed = true;
+    }
+}
+
+
+// Emits a forward jump. The target is patched in once its address is known.
+static void emit_forward_jump(Translator* t, uint8_t opcode, size_t b, size_t c, size_t target) {
+    record_target_depth(t, target, t->depth);
+    if (t->failed) {
+        return;
+    }
+
+    GROW_IF_FULL(t, PendingJump, jumps, jump_count, jump_capacity);
+    t->jumps[t->jump_count].reg_ip = t->code_count;
+    t->jumps[t->jump_count].target = target;
+    t->jump_count++;
+
+    emit(t, opcode, 0, b, c, 0);
+}
+
+
+// Returns true if [a] and [b] can share a constant register. Floats are compared bitwise so
+// [0.0] and [-0.0] stay distinct.
+static bool is_same_constant(PyroValue a, PyroValue b) {
+    if (PYRO_IS_F64(a) && PYRO_IS_F64(b)) {
+        double a_value = PYRO_AS_F64(a);
+        double b_value = PYRO_AS_F64(b);
+        return memcmp(&a_value, &b_value, sizeof(double)) == 0;
+    }
+    return pyro_compare_eq_strict(a, b);
+}
+
+
+// Returns the register holding a copy of [value], adding it to the constant registers if
+// necessary.
+static size_t constant_register(Translator* t, PyroValue value) {
+    for (size_t i = 0; i < t->const_count; i++) {
+        if (is_same_constant(value, t->constants[i])) {
+            return t->const_base + i;
+        }
+    }
+
+    if (t->const_count == t->const_capacity) {
+        size_t new_capacity = pyro_grow_capacity(t->const_capacity);
+        PyroValue* new_array = PYRO_REALLOCATE_ARRAY(t->vm, PyroValue, t->constants, t->const_capacity, new_capacity);
+        if (!new_array) {
+            t->failed = true;
+            return t->const_base;
+        }
+        t->constants = new_array;
+        t->const_capacity = new_capacity;
+    }
+
+    t->constants[t->const_count] = value;
+    return t->const_base + t->const_count++;
+}
+
+
+/* ----------------- */
+/*  The Value Stack  */
+/* ----------------- */
+
+
+static void push_register(Translator* t, size_t reg) {
+    if (t->depth == t->slots_capacity) {
+        t->failed = true;
+        return;
+    }
+    t->slots[t->depth++] = reg;
+    if (t->depth > t->max_depth) {
+        t->max_depth = t->depth;
+    }
+}
+
+
+static size_t pop_register(Translator* t) {
+    if (t->depth == 0) {
+        t->failed = true;
+        return 0;
+    }
+    return t->slots[--t->depth];
+}
+
+
+static void materialize(Translator* t, size_t slot) {
+    if (t->slots[slot] != slot) {
+        emit(t, PYRO_REG_MOVE, slot, t->slots[slot], 0, 0);
+        t->slots[slot] = slot;
+    }
+}
+
+
+static void materialize_all(Translator* t) {
+    for (size_t i = 0; i < t->depth; i++) {
+        materialize(t, i);
+    }
+}
+
+
+// Called before writing to register [reg]. Materializes any slots that refer to the register's
+// current value.
+static void prepare_write(Translator* t, size_t reg) {
+    for (size_t i = 0; i < t->depth; i++) {
+        if (t->slots[i] == reg && i != reg) {
+            materialize(t, i);
+        }
+    }
+}
+
+
+// Describes where an instruction writes its result. By default the result goes to a new slot
+// on top of the stack, but if the instruction is followed by an assignment to a local the result
+// is written straight to the local's register.
+typedef struct {
+    size_t reg;
+    int local;
+    bool pop;
+    size_t next_ip;
+} Result;
+
+
+static Result begin_result(Translator* t, size_t next_ip) {
+    PyroFn* fn = t->fn;
+    Result result = {.reg = t->depth, .local = -1, .pop = false, .next_ip = next_ip};
+
+    if (next_ip < fn->code_count && !t->is_target[next_ip]) {
+        int local = set_local_index(fn, next_ip);
+        if (local < 0 && fn->code[next_ip] == PYRO_OPCODE_POP_SET_LOCAL) {
+            local = fn->code[next_ip + 1];
+            result.pop = true;
+        }
+
+        if (local >= 0 && (size_t)local < t->depth) {
+            result.reg = (size_t)local;
+            result.local = local;
+            result.next_ip = next_ip + instruction_length(fn, next_ip);
+        } else {
+            result.pop = false;
+        }
+    }
+
+    prepare_write(t, result.reg);
+    return result;
+}
+
+
+static size_t end_result(Translator* t, Result result) {
+    if (result.local >= 0) {
+        t->slots[result.local] = (size_t)result.local;
+    }
+    if (!result.pop) {
+        push_register(t, result.reg);
+    }
+    return result.next_ip;
+}
+
+
+/* ------------- */
+/*  Translation  */
+/* ------------- */
+
+
+static size_t translate_binary(Translator* t, uint8_t opcode, size_t next_ip) {
+    size_t right = pop_register(t);
+    size_t left = pop_register(t);
+    Result result = begin_result(t, next_ip);
+    emit(t, opcode, result.reg, left, right, 0);
+    return end_result(t, result);
+}
+
+
+static size_t translate_unary(Translator* t, uint8_t opcode, size_t next_ip) {
+    size_t operand = pop_register(t);
+    Result result = begin_result(t, next_ip);
+    emit(t, opcode, result.reg, operand, 0, 0);
+    return end_result(t, result);
+}
+
+
+static void translate_compare_and_jump(Translator* t, uint8_t opcode, size_t ip) {
+    size_t right = pop_register(t);
+    size_t left = pop_register(t);
+    materialize_all(t);
+    emit_forward_jump(t, opcode, left, right, jump_target(t->fn, ip));
+}
+
+
+static void translate_set_local(Translator* t, size_t local, bool pop) {
+    if (t->depth == 0 || local >= t->depth - 1) {
+        t->failed = true;
+        return;
+    }
+
+    size_t value = t->slots[t->depth - 1];
+    if (value != local) {
+        prepare_write(t, local);
+        emit(t, PYRO_REG_MOVE, local, value, 0, 0);
+    }
+    t->slots[local] = local;
+
+    if (pop) {
+        t->depth--;
+    } else {
+        t->slots[t->depth - 1] = local;
+    }
+}
+
+
+static void translate_get_local(Translator* t, size_t local) {
+    if (local >= t->depth) {
+        t->failed = true;
+        return;
+    }
+    materialize(t, local);
+    push_register(t, local);
+}
+
+
+// Translates a call. The callee or receiver and the arguments are already in place on the stack
+// so the register code calls them in place, leaving the return value in the callee's slot.
+static void translate_call(Translator* t, uint8_t opcode, size_t arg_count, size_t c, size_t x) {
+    if (t->depth < arg_count + 1) {
+        t->failed = true;
+        return;
+    }
+    materialize_all(t);
+    size_t callee = t->depth - arg_count - 1;
+    emit(t, opcode, callee, arg_count, c, x);
+    t->depth = callee + 1;
+}
+
+
+// Translates the stack instruction at [ip]. Returns the offset of the next instruction to
+// translate. Sets [reachable] to false if the instruction never falls through.
+static size_t translate_instruction(Translator* t, size_t ip, bool* reachable) {
+    PyroFn* fn = t->fn;
+    uint8_t opcode = fn->code[ip];
+    size_t next_ip = ip + instruction_length(fn, ip);
+    t->ip_end = next_ip;
+
+    switch (opcode) {
+        case PYRO_OPCODE_GET_LOCAL:
+            translate_get_local(t, fn->code[ip + 1]);
+            return next_ip;
+
+        case PYRO_OPCODE_GET_LOCAL_0:
+        case PYRO_OPCODE_GET_LOCAL_1:
+        case PYRO_OPCODE_GET_LOCAL_2:
+        case PYRO_OPCODE_GET_LOCAL_3:
+        case PYRO_OPCODE_GET_LOCAL_4:
+        case PYRO_OPCODE_GET_LOCAL_5:
+        case PYRO_OPCODE_GET_LOCAL_6:
+        case PYRO_OPCODE_GET_LOCAL_7:
+        case PYRO_OPCODE_GET_LOCAL_8:
+        case PYRO_OPCODE_GET_LOCAL_9:
+            translate_get_local(t, opcode - PYRO_OPCODE_GET_LOCAL_0);
+            return next_ip;
+
+        case PYRO_OPCODE_SET_LOCAL:
+            translate_set_local(t, fn->code[ip + 1], false);
+            return next_ip;
+
+        case PYRO_OPCODE_SET_LOCAL_0:
+        case PYRO_OPCODE_SET_LOCAL_1:
+        case PYRO_OPCODE_SET_LOCAL_2:
+        case PYRO_OPCODE_SET_LOCAL_3:
+        case PYRO_OPCODE_SET_LOCAL_4:
+        case PYRO_OPCODE_SET_LOCAL_5:
+        case PYRO_OPCODE_SET_LOCAL_6:
+        case PYRO_OPCODE_SET_LOCAL_7:
+        case PYRO_OPCODE_SET_LOCAL_8:
+        case PYRO_OPCODE_SET_LOCAL_9:
+            translate_set_local(t, opcode - PYRO_OPCODE_SET_LOCAL_0, false);
+            return next_ip;
+
+        case PYRO_OPCODE_POP_SET_LOCAL:
+            translate_set_local(t, fn->code[ip + 1], true);
+            return next_ip;
+
+        case PYRO_OPCODE_LOAD_CONSTANT:
+            push_register(t, constant_register(t, fn->constants[read_be_u16(&fn->code[ip + 1])]));
+            return next_ip;
+
+        case PYRO_OPCODE_LOAD_CONSTANT_0:
+        case PYRO_OPCODE_LOAD_CONSTANT_1:
+        case PYRO_OPCODE_LOAD_CONSTANT_2:
+        case PYRO_OPCODE_LOAD_CONSTANT_3:
+        case PYRO_OPCODE_LOAD_CONSTANT_4:
+        case PYRO_OPCODE_LOAD_CONSTANT_5:
+        case PYRO_OPCODE_LOAD_CONSTANT_6:
+        case PYRO_OPCODE_LOAD_CONSTANT_7:
+        case PYRO_OPCODE_LOAD_CONSTANT_8:
+        case PYRO_OPCODE_LOAD_CONSTANT_9:
+            push_register(t, constant_register(t, fn->constants[opcode - PYRO_OPCODE_LOAD_CONSTANT_0]));
+            return next_ip;
+
+        case PYRO_OPCODE_LOAD_I64_0:
+        case PYRO_OPCODE_LOAD_I64_1:
+        case PYRO_OPCODE_LOAD_I64_2:
+        case PYRO_OPCODE_LOAD_I64_3:
+        case PYRO_OPCODE_LOAD_I64_4:
+        case PYRO_OPCODE_LOAD_I64_5:
+        case PYRO_OPCODE_LOAD_I64_6:
+        case PYRO_OPCODE_LOAD_I64_7:
+        case PYRO_OPCODE_LOAD_I64_8:
+        case PYRO_OPCODE_LOAD_I64_9:
+            push_register(t, constant_register(t, pyro_i64(opcode - PYRO_OPCODE_LOAD_I64_0)));
+            return next_ip;
+
+        case PYRO_OPCODE_LOAD_TRUE:
+            push_register(t, constant_register(t, pyro_bool(true)));
+            return next_ip;
+
+        case PYRO_OPCODE_LOAD_FALSE:
+            push_register(t, constant_register(t, pyro_bool(false)));
+            return next_ip;
+
+        case PYRO_OPCODE_LOAD_NULL:
+            push_register(t, constant_register(t, pyro_null()));
+            return next_ip;
+
+        case PYRO_OPCODE_POP:
+            pop_register(t);
+            return next_ip;
+
+        case PYRO_OPCODE_DUP:
+            if (t->depth == 0) {
+                t->failed = true;
+                return next_ip;
+            }
+            push_register(t, t->slots[t->depth - 1]);
+            return next_ip;
+
+        case PYRO_OPCODE_BINARY_PLUS:
+        case PYRO_OPCODE_BINARY_PLUS_I64:
+        case PYRO_OPCODE_BINARY_PLUS_F64:
+            return translate_binary(t, PYRO_REG_ADD, next_ip);
+        case PYRO_OPCODE_BINARY_MINUS:
+        case PYRO_OPCODE_BINARY_MINUS_I64:
+        case PYRO_OPCODE_BINARY_MINUS_F64:
+            return translate_binary(t, PYRO_REG_SUB, next_ip);
+        case PYRO_OPCODE_BINARY_STAR:
+        case PYRO_OPCODE_BINARY_STAR_I64:
+        case PYRO_OPCODE_BINARY_STAR_F64:
+            return translate_binary(t, PYRO_REG_MUL, next_ip);
+        case PYRO_OPCODE_BINARY_SLASH:
+            return translate_binary(t, PYRO_REG_DIV, next_ip);
+        case PYRO_OPCODE_BINARY_SLASH_SLASH:
+            return translate_binary(t, PYRO_REG_FLOOR_DIV, next_ip);
+        case PYRO_OPCODE_BINARY_PERCENT:
+            return translate_binary(t, PYRO_REG_PERCENT, next_ip);
+        case PYRO_OPCODE_BINARY_REM:
+            return translate_binary(t, PYRO_REG_REM, next_ip);
+        case PYRO_OPCODE_BINARY_MOD:
+            return translate_binary(t, PYRO_REG_MOD, next_ip);
+        case PYRO_OPCODE_BINARY_STAR_STAR:
+            return translate_binary(t, PYRO_REG_POW, next_ip);
+        case PYRO_OPCODE_BINARY_AMP:
+            return translate_binary(t, PYRO_REG_BIT_AND, next_ip);
+        case PYRO_OPCODE_BINARY_BAR:
+            return translate_binary(t, PYRO_REG_BIT_OR, next_ip);
+        case PYRO_OPCODE_BINARY_CARET:
+            return translate_binary(t, PYRO_REG_BIT_XOR, next_ip);
+        case PYRO_OPCODE_BINARY_LESS_LESS:
+            return translate_binary(t, PYRO_REG_SHIFT_LEFT, next_ip);
+        case PYRO_OPCODE_BINARY_GREATER_GREATER:
+            return translate_binary(t, PYRO_REG_SHIFT_RIGHT, next_ip);
+        case PYRO_OPCODE_BINARY_EQUAL_EQUAL:
+            return translate_binary(t, PYRO_REG_EQUAL, next_ip);
+        case PYRO_OPCODE_BINARY_BANG_EQUAL:
+            return translate_binary(t, PYRO_REG_NOT_EQUAL, next_ip);
+        case PYRO_OPCODE_BINARY_LESS:
+        case PYRO_OPCODE_BINARY_LESS_I64:
+        case PYRO_OPCODE_BINARY_LESS_F64:
+            return translate_binary(t, PYRO_REG_LESS, next_ip);
+        case PYRO_OPCODE_BINARY_LESS_EQUAL:
+        case PYRO_OPCODE_BINARY_LESS_EQUAL_I64:
+        case PYRO_OPCODE_BINARY_LESS_EQUAL_F64:
+            return translate_binary(t, PYRO_REG_LESS_EQUAL, next_ip);
+        case PYRO_OPCODE_BINARY_GREATER:
+        case PYRO_OPCODE_BINARY_GREATER_I64:
+        case PYRO_OPCODE_BINARY_GREATER_F64:
+            return translate_binary(t, PYRO_REG_GREATER, next_ip);
+        case PYRO_OPCODE_BINARY_GREATER_EQUAL:
+        case PYRO_OPCODE_BINARY_GREATER_EQUAL_I64:
+        case PYRO_OPCODE_BINARY_GREATER_EQUAL_F64:
+            return translate_binary(t, PYRO_REG_GREATER_EQUAL, next_ip);
+        case PYRO_OPCODE_GET_INDEX:
+            return translate_binary(t, PYRO_REG_GET_INDEX, next_ip);
+
+        case PYRO_OPCODE_UNARY_MINUS:
+            return translate_unary(t, PYRO_REG_NEGATE, next_ip);
+        case PYRO_OPCODE_UNARY_PLUS:
+            return translate_unary(t, PYRO_REG_PLUS, next_ip);
+        case PYRO_OPCODE_UNARY_BANG:
+            return translate_unary(t, PYRO_REG_NOT, next_ip);
+        case PYRO_OPCODE_UNARY_TILDE:
+            return translate_unary(t, PYRO_REG_BIT_NOT, next_ip);
+
+        case PYRO_OPCODE_GET_LOCAL_PLUS_CONSTANT: {
+            size_t local = fn->code[ip + 1];
+            size_t constant = read_be_u16(&fn->code[ip + 2]);
+            translate_get_local(t, local);
+            push_register(t, constant_register(t, fn->constants[constant]));
+            return translate_binary(t, PYRO_REG_ADD, next_ip);
+        }
+
+        case PYRO_OPCODE_SET_INDEX: {
+            size_t value = pop_register(t);
+            size_t key = pop_register(t);
+            size_t receiver = pop_register(t);
+            Result result = begin_result(t, next_ip);
+            emit(t, PYRO_REG_SET_INDEX, result.reg, receiver, key, value);
+            return end_result(t, result);
+        }
+
+        case PYRO_OPCODE_GET_FIELD:
+        case PYRO_OPCODE_GET_PUB_FIELD: {
+            size_t receiver = pop_register(t);
+            Result result = begin_result(t, next_ip);
+            emit(t,
+                opcode == PYRO_OPCODE_GET_FIELD ? PYRO_REG_GET_FIELD : PYRO_REG_GET_PUB_FIELD,
+                result.reg,
+                receiver,
+                read_be_u16(&fn->code[ip + 1]),
+                read_be_u16(&fn->code[ip + 3])
+            );
+            return end_result(t, result);
+        }
+
+        case PYRO_OPCODE_GET_LOCAL_FIELD:
+        case PYRO_OPCODE_GET_LOCAL_PUB_FIELD: {
+            translate_get_local(t, fn->code[ip + 1]);
+            size_t receiver = pop_register(t);
+            Result result = begin_result(t, next_ip);
+            emit(t,
+                opcode == PYRO_OPCODE_GET_LOCAL_FIELD ? PYRO_REG_GET_FIELD : PYRO_REG_GET_PUB_FIELD,
+                result.reg,
+                receiver,
+                read_be_u16(&fn->code[ip + 2]),
+                read_be_u16(&fn->code[ip + 4])
+            );
+            return end_result(t, result);
+        }
+
+        case PYRO_OPCODE_GET_GLOBAL: {
+            Result result = begin_result(t, next_ip);
+            emit(t,
+                PYRO_REG_GET_GLOBAL,
+                result.reg,
+                0,
+                read_be_u16(&fn->code[ip + 1]),
+                read_be_u16(&fn->code[ip + 3])
+            );
+            return end_result(t, result);
+        }
+
+        case PYRO_OPCODE_SET_GLOBAL:
+            if (t->depth == 0) {
+                t->failed = true;
+                return next_ip;
+            }
+            emit(t,
+                PYRO_REG_SET_GLOBAL,
+                0,
+                t->slots[t->depth - 1],
+                read_be_u16(&fn->code[ip + 1]),
+                read_be_u16(&fn->code[ip + 3])
+            );
+            return next_ip;
+
+        case PYRO_OPCODE_GET_ITERATOR:
+            if (t->depth == 0) {
+                t->failed = true;
+                return next_ip;
+            }
+            materialize_all(t);
+            emit(t, PYRO_REG_GET_ITERATOR, t->depth - 1, 0, 0, 0);
+            return next_ip;
+
+        case PYRO_OPCODE_GET_NEXT_FROM_ITERATOR:
+            if (t->depth == 0) {
+                t->failed = true;
+                return next_ip;
+            }
+            materialize_all(t);
+            emit(t, PYRO_REG_GET_NEXT_FROM_ITERATOR, t->depth, t->depth - 1, 0, 0);
+            push_register(t, t->depth);
+            return next_ip;
+
+        case PYRO_OPCODE_CALL_VALUE:
+            translate_call(t, PYRO_REG_CALL, fn->code[ip + 1], 0, 0);
+            return next_ip;
+
+        case PYRO_OPCODE_CALL_VALUE_0:
+        case PYRO_OPCODE_CALL_VALUE_1:
+        case PYRO_OPCODE_CALL_VALUE_2:
+        case PYRO_OPCODE_CALL_VALUE_3:
+        case PYRO_OPCODE_CALL_VALUE_4:
+        case PYRO_OPCODE_CALL_VALUE_5:
+        case PYRO_OPCODE_CALL_VALUE_6:
+        case PYRO_OPCODE_CALL_VALUE_7:
+        case PYRO_OPCODE_CALL_VALUE_8:
+        case PYRO_OPCODE_CALL_VALUE_9:
+            translate_call(t, PYRO_REG_CALL, opcode - PYRO_OPCODE_CALL_VALUE_0, 0, 0);
+            return next_ip;
+
+        case PYRO_OPCODE_CALL_METHOD:
+        case PYRO_OPCODE_CALL_PUB_METHOD:
+            translate_call(t,
+                opcode == PYRO_OPCODE_CALL_METHOD ? PYRO_REG_CALL_METHOD : PYRO_REG_CALL_PUB_METHOD,
+                fn->code[ip + 3],
+                read_be_u16(&fn->code[ip + 1]),
+                read_be_u16(&fn->code[ip + 4])
+            );
+            return next_ip;
+
+        case PYRO_OPCODE_RETURN:
+            emit(t, PYRO_REG_RETURN, 0, pop_register(t), 0, 0);
+            *reachable = false;
+            return next_ip;
+
+        case PYRO_OPCODE_JUMP:
+            materialize_all(t);
+            emit_forward_jump(t, PYRO_REG_JUMP, 0, 0, jump_target(fn, ip));
+            *reachable = false;
+            return next_ip;
+
+        case PYRO_OPCODE_JUMP_BACK: {
+            size_t target = jump_target(fn, ip);
+            materialize_all(t);
+            record_target_depth(t, target, t->depth);
+            if (t->failed) {
+                return next_ip;
+            }
+            if (t->reg_ips[target] == SIZE_MAX) {
+                t->needs_another_pass = true;
+                *reachable = false;
+                return next_ip;
+            }
+            emit(t, PYRO_REG_LOOP, 0, 0, 0, t->reg_ips[target]);
+
+            if (t->entry_count == t->entry_capacity) {
+                size_t new_capacity = pyro_grow_capacity(t->entry_capacity);
+                PyroRegEntry* new_array = PYRO_REALLOCATE_ARRAY(t->vm, PyroRegEntry, t->entries, t->entry_capacity, new_capacity);
+                if (!new_array) {
+                    t->failed = true;
+                    return next_ip;
+                }
+                t->entries = new_array;
+                t->entry_capacity = new_capacity;
+            }
+            t->entries[t->entry_count].ip = target;
+            t->entries[t->entry_count].depth = t->depth;
+            t->entries[t->entry_count].reg_ip = t->reg_ips[target];
+            t->entry_count++;
+
+            *reachable = false;
+            return next_ip;
+        }
+
+        case PYRO_OPCODE_JUMP_IF_FALSE:
+        case PYRO_OPCODE_JUMP_IF_TRUE:
+        case PYRO_OPCODE_JUMP_IF_ERR:
+        case PYRO_OPCODE_JUMP_IF_NOT_ERR: {
+            if (t->depth == 0) {
+                t->failed = true;
+                return next_ip;
+            }
+            materialize_all(t);
+            uint8_t reg_opcode =
+                opcode == PYRO_OPCODE_JUMP_IF_FALSE ? PYRO_REG_JUMP_IF_FALSE :
+                opcode == PYRO_OPCODE_JUMP_IF_TRUE ? PYRO_REG_JUMP_IF_TRUE :
+                opcode == PYRO_OPCODE_JUMP_IF_ERR ? PYRO_REG_JUMP_IF_ERR :
+                PYRO_REG_JUMP_IF_NOT_ERR;
+            emit_forward_jump(t, reg_opcode, t->depth - 1, 0, jump_target(fn, ip));
+            return next_ip;
+        }
+
+        case PYRO_OPCODE_POP_JUMP_IF_FALSE: {
+            size_t condition = pop_register(t);
+            materialize_all(t);
+            emit_forward_jump(t, PYRO_REG_JUMP_IF_FALSE, condition, 0, jump_target(fn, ip));
+            return next_ip;
+        }
+
+        case PYRO_OPCODE_JUMP_IF_EQUAL:
+            translate_compare_and_jump(t, PYRO_REG_JUMP_IF_EQUAL, ip);
+            return next_ip;
+        case PYRO_OPCODE_JUMP_IF_NOT_EQUAL:
+            translate_compare_and_jump(t, PYRO_REG_JUMP_IF_NOT_EQUAL, ip);
+            return next_ip;
+        case PYRO_OPCODE_JUMP_IF_NOT_LESS:
+            translate_compare_and_jump(t, PYRO_REG_JUMP_IF_NOT_LESS, ip);
+            return next_ip;
+        case PYRO_OPCODE_JUMP_IF_NOT_LESS_EQUAL:
+            translate_compare_and_jump(t, PYRO_REG_JUMP_IF_NOT_LESS_EQUAL, ip);
+            return next_ip;
+        case PYRO_OPCODE_JUMP_IF_NOT_GREATER:
+            translate_compare_and_jump(t, PYRO_REG_JUMP_IF_NOT_GREATER, ip);
+            return next_ip;
+        case PYRO_OPCODE_JUMP_IF_NOT_GREATER_EQUAL:
+            translate_compare_and_jump(t, PYRO_REG_JUMP_IF_NOT_GREATER_EQUAL, ip);
+            return next_ip;
+
+        default:
+            t->failed = true;
+            return next_ip;
+    }
+}
+
+
+// Runs a complete translation pass over the function's stack bytecode. Stack depths recorded
+// at jump targets carry over from earlier passes.
+static void translate(Translator* t) {
+    PyroFn* fn = t->fn;
+
+    t->failed = false;
+    t->needs_another_pass = false;
+    t->depth = 0;
+    t->max_depth = 0;
+    t->code_count = 0;
+    t->const_count = 0;
+    t->jump_count = 0;
+    t->entry_count = 0;
+
+    for (size_t i = 0; i <= fn->code_count; i++) {
+        t->reg_ips[i] = SIZE_MAX;
+    }
+
+    // On entry, the stack holds the callee or receiver followed by the arguments.
+    for (size_t i = 0; i < (size_t)fn->arity + 1; i++) {
+        push_register(t, i);
+    }
+
+    bool reachable = true;
+    size_t ip = 0;
+
+    while (ip < fn->code_count && !t->failed) {
+        if (t->is_target[ip]) {
+            if (reachable) {
+                materialize_all(t);
+                record_target_depth(t, ip, t->depth);
+            } else if (t->target_depths[ip] != SIZE_MAX) {
+                reachable = true;
+                t->depth = t->target_depths[ip];
+                for (size_t i = 0; i < t->depth; i++) {
+                    t->slots[i] = i;
+                }
+            }
+        }
+
+        // Code after a return or jump that nothing jumps to is unreachable.
+        if (!reachable) {
+            ip += instruction_length(fn, ip);
+            continue;
+        }
+
+        t->reg_ips[ip] = t->code_count;
+        ip = translate_instruction(t, ip, &reachable);
+    }
+
+    // A function always ends with a return, so falling off the end means the translation went
+    // wrong somewhere.
+    if (reachable) {
+        t->failed = true;
+    }
+
+    for (size_t i = 0; i < t->jump_count && !t->failed; i++) {
+        size_t target_reg_ip = t->reg_ips[t->jumps[i].target];
+        if (target_reg_ip == SIZE_MAX) {
+            t->failed = true;
+            break;
+        }
+        t->code[t->jumps[i].reg_ip].x = (uint16_t)target_reg_ip;
+    }
+
+    if (t->max_depth + t->const_count > UINT16_MAX || t->code_count > UINT16_MAX) {
+        t->failed = true;
+    }
+}
+
+
+/* ----------- */
+/*  Interface  */
+/* ----------- */
+
+
+bool pyro_compile_register_code(PyroVM* vm, PyroFn* fn) {
+    if (fn->code_count == 0 || fn->reg_code) {
+        return false;
+    }
+
+    size_t count = fn->code_count;
+
+    // Each instruction pushes at most one value.
+    size_t slots_capacity = count + (size_t)fn->arity + 1;
+
+    Translator t = {
+        .vm = vm,
+        .fn = fn,
+        .failed = false,
+        .slots = PYRO_ALLOCATE_ARRAY(vm, size_t, slots_capacity),
+        .slots_capacity = slots_capacity,
+        .is_target = PYRO_ALLOCATE_ARRAY(vm, bool, count + 1),
+        .target_depths = PYRO_ALLOCATE_ARRAY(vm, size_t, count + 1),
+        .reg_ips = PYRO_ALLOCATE_ARRAY(vm, size_t, count + 1),
+    };
+
+    bool ok = t.slots && t.is_target && t.target_depths && t.reg_ips;
+
+    if (ok) {
+        memset(t.is_target, 0, sizeof(bool) * (count + 1));
+        for (size_t ip = 0; ip < count; ip += instruction_length(fn, ip)) {
+            if (is_jump(fn->code[ip])) {
+                size_t target = jump_target(fn, ip);
+                if (target > count) {
+                    ok = false;
+                    break;
+                }
+                t.is_target[target] = true;
+            }
+        }
+    }
+
+    // The constant registers sit above the stack slots, so we need to know the function's
+    // maximum stack depth before we can number them. The first pass finds the depth, the second
+    // emits the final code.
+    if (ok) {
+        for (size_t i = 0; i <= count; i++) {
+            t.target_depths[i] = SIZE_MAX;
+        }
+
+        t.const_base = UINT16_MAX;
+        for (size_t pass = 0; pass < 8; pass++) {
+            translate(&t);
+            if (t.failed || !t.needs_another_pass) {
+                break;
+            }
+        }
+        ok = !t.failed && !t.needs_another_pass;
+    }
+
+    if (ok) {
+        t.const_base = t.max_depth;
+        translate(&t);
+        ok = !t.failed && !t.needs_another_pass;
+    }
+
+    PyroRegCode* reg_code = NULL;
+    if (ok) {
+        reg_code = PYRO_ALLOCATE_ARRAY(vm, PyroRegCode, 1);
+        ok = reg_code != NULL;
+    }
+
+    if (ok) {
+        reg_code->code = t.code;
+        reg_code->code_count = t.code_count;
+        reg_code->code_capacity = t.code_capacity;
+        reg_code->constants = t.constants;
+        reg_code->const_base = t.const_base;
+        reg_code->const_count = t.const_count;
+        reg_code->const_capacity = t.const_capacity;
+        reg_code->frame_size = t.const_base + t.const_count;
+        reg_code->entries = t.entries;
+        reg_code->entry_count = t.entry_count;
+        reg_code->entry_capacity = t.entry_capacity;
+        fn->reg_code = reg_code;
+    } else {
+        if (t.code) {
+            PYRO_FREE_ARRAY(vm, PyroRegInstruction, t.code, t.code_capacity);
+        }
+        if (t.constants) {
+            PYRO_FREE_ARRAY(vm, PyroValue, t.constants, t.const_capacity);
+        }
+        if (t.entries) {
+            PYRO_FREE_ARRAY(vm, PyroRegEntry, t.entries, t.entry_capacity);
+        }
+    }
+
+    if (t.jumps) {
+        PYRO_FREE_ARRAY(vm, PendingJump, t.jumps, t.jump_capacity);
+    }
+    if (t.slots) {
+        PYRO_FREE_ARRAY(vm, size_t, t.slots, slots_capacity);
+    }
+    if (t.is_target) {
+        PYRO_FREE_ARRAY(vm, bool, t.is_target, count + 1);
+    }
+    if (t.target_depths) {
+        PYRO_FREE_ARRAY(vm, size_t, t.target_depths, count + 1);
+    }
+    if (t.reg_ips) {
+        PYRO_FREE_ARRAY(vm, size_t, t.reg_ips, count + 1);
+    }
+
+    return ok;
+}
+
+
+void pyro_free_register_code(PyroVM* vm, PyroRegCode* reg_code) {
+    PYRO_FREE_ARRAY(vm, PyroRegInstruction, reg_code->code, reg_code->code_capacity);
+    if (reg_code->constants) {
+        PYRO_FREE_ARRAY(vm, PyroValue, reg_code->constants, reg_code->const_capacity);
+    }
+    if (reg_code->entries) {
+        PYRO_FREE_ARRAY(vm, PyroRegEntry, reg_code->entries, reg_code->entry_capacity);
+    }
+    PYRO_FREE_ARRAY(vm, PyroRegCode, reg_code, 1);
+}
+
+
+PyroRegEntry* pyro_find_register_entry(PyroRegCode* reg_code, size_t ip) {
+    for (size_t i = 0; i < reg_code->entry_count; i++) {
+        if (reg_code->entries[i].ip == ip) {
+            return &reg_code->entries[i];
+        }
+    }
+    return NULL;
+}
@@ -32,6 +32,11 @@ PyroVM* pyro_new_vm(void) {
     vm->class_enum_member = NULL;
     vm->empty_error = NULL;
     vm->empty_string = NULL;
+    #if PYRO_RANDOMIZE_STRING_HASH_SEED
+        vm->string_hash_seed = pyro_random_seed();
+    #else
+        vm->string_hash_seed = 0;
+    #endif
     vm->empty_tuple = NULL;
     vm->exit_code = 0;
     vm->exit_flag = false;
@@ -49,7 +54,21 @@ PyroVM* pyro_new_vm(void) {
     vm->memory_allocation_failed = false;
     vm->module_cache = NULL;
     vm->next_gc_threshold = PYRO_INIT_GC_THRESHOLD;
-    vm->objects = NULL;
+    vm->next_full_gc_threshold = PYRO_INIT_GC_THRESHOLD;
+    vm->remembered_set = NULL;
+    vm->remembered_set_count = 0;
+    vm->remembered_set_capacity = 0;
+    vm->write_barrier_overflow = false;
+    vm->gc_is_minor = false;
+    vm->gc_phase = PYRO_GC_IDLE;
+    vm->gc_count = 0;
+    vm->gc_mark_threads = PYRO_GC_MARK_THREADS;
+    vm->gc_mark_pool = NULL;
+    vm->gc_is_parallel = false;
+    PyroPoolAllocator_init(&vm->pool_allocator);
+    PyroObjectHeap_init(&vm->object_heap);
+    vm->last_layout_id = 0;
+    memset(vm->method_cache, 0, sizeof(vm->method_cache));
     vm->open_upvalues = NULL;
     vm->panic_buffer = NULL;
     vm->panic_flag = false;
@@ -137,6 +156,7 @@ PyroVM* pyro_new_vm(void) {
     vm->str_rop_binary_greater_greater = NULL;
     vm->str_op_unary_tilde = NULL;
     vm->trace_execution = false;
+    vm->use_bytecode_cache = false;
     vm->str_enum = NULL;
     vm->str_count = NULL;
     vm->str_op_binary_mod = NULL;
@@ -326,19 +346,17 @@ PyroVM* pyro_new_vm(void) {
 
 
 void pyro_free_vm(PyroVM* vm) {
-    PyroObject* object = vm->objects;
-    while (object != NULL) {
-        PyroObject* next = object->next;
-        pyro_free_object(vm, object);
-        object = next;
-    }
+    pyro_free_gc_mark_pool(vm);
+    PyroObjectHeap_free_all(vm);
 
     PYRO_FREE_ARRAY(vm, PyroObject*, vm->grey_stack, vm->grey_stack_capacity);
+    PYRO_FREE_ARRAY(vm, PyroObject*, vm->remembered_set, vm->remembered_set_capacity);
     PYRO_FREE_ARRAY(vm, PyroCallFrame, vm->call_stack, vm->call_stack_capacity);
     PYRO_FREE_ARRAY(vm, PyroValue, vm->with_stack, vm->with_stack_capacity);
     PYRO_FREE_ARRAY(vm, PyroValue, vm->stack, vm->stack_max - vm->stack);
 
     PyroStrPool_free(&vm->string_pool, vm);
+    PyroPoolAllocator_free_all(&vm->pool_allocator);
 
     assert(vm->bytes_allocated == sizeof(PyroVM));
     free(vm);
@@ -362,6 +380,7 @@ bool pyro_define_pri_member(PyroVM* vm, PyroMod* module, const char* name, PyroV
         return false;
     }
 
+    module->layout_id = pyro_new_layout_id(vm);
     return true;
 }
 
@@ -389,6 +408,7 @@ bool pyro_define_pub_member(PyroVM* vm, PyroMod* module, const char* name, PyroV
         return false;
     }
 
+    module->layout_id = pyro_new_layout_id(vm);
     return true;
 }
 
@@ -426,6 +446,8 @@ bool pyro_define_pub_method(PyroVM* vm, PyroClass* class, const char* name, pyro
         return false;
     }
 
+    class->layout_id = pyro_new_layout_id(vm);
+
     if (!PyroMap_set(class->all_instance_methods, pyro_obj(name_string), pyro_obj(fn_obj), vm)) {
         return false;
     }
@@ -450,11 +472,14 @@ bool pyro_define_pri_method(PyroVM* vm, PyroClass* class, const char* name, pyro
         return false;
     }
 
+    class->layout_id = pyro_new_layout_id(vm);
+
     if (!PyroMap_set(class->all_instance_methods, pyro_obj(name_string), pyro_obj(fn_obj), vm)) {
         return false;
     }
 
     if (name_string == vm->str_dollar_init) {
+        pyro_write_barrier(vm, (PyroObject*)class, pyro_obj(fn_obj));
         class->init_method = pyro_obj(fn_obj);
     }
 
@@ -485,6 +510,7 @@ bool pyro_define_pub_field(PyroVM* vm, PyroClass* class, const char* name, PyroV
         return false;
     }
 
+    class->layout_id = pyro_new_layout_id(vm);
     return true;
 }
 
@@ -506,6 +532,7 @@ bool pyro_define_pri_field(PyroVM* vm, PyroClass* class, const char* name, PyroV
         return false;
     }
 
+    class->layout_id = pyro_new_layout_id(vm);
     return true;
 }
 
@@ -593,6 +620,11 @@ void pyro_set_max_memory(PyroVM* vm, size_t bytes) {
 }
 
 
+void pyro_set_gc_mark_threads(PyroVM* vm, size_t count) {
+    vm->gc_mark_threads = count > 0 ? count : 1;
+}
+
+
 void pyro_set_repl_flag(PyroVM* vm, bool flag) {
     vm->in_repl = flag;
 }
@@ -600,3 +632,7 @@ void pyro_set_repl_flag(PyroVM* vm, bool flag) {
 void pyro_set_trace_execution_flag(PyroVM* vm, bool flag) {
     vm->trace_execution = flag;
 }
+
+void pyro_set_bytecode_cache_flag(PyroVM* vm, bool flag) {
+    vm->use_bytecode_cache = flag;
+}
@@ -65,7 +65,7 @@ static void insertion_sort_slice_with_cb(PyroVM* vm, PyroValue* array, size_t lo
                 return;
             }
 
-            if (item_j_is_less_than_previous.as.boolean) {
+            if (PYRO_AS_BOOL(item_j_is_less_than_previous)) {
                 swap(&array[j], &array[j - 1]);
             } else {
                 break;
@@ -105,7 +105,7 @@ static size_t partition_slice_with_cb(PyroVM* vm, PyroValue* array, size_t low,
             return 0;
         }
 
-        if (item_j_is_less_than_pivot.as.boolean) {
+        if (PYRO_AS_BOOL(item_j_is_less_than_pivot)) {
             swap(&array[i], &array[j]);
             i++;
         }
@@ -309,7 +309,7 @@ static void merge_with_cb(
             return;
         }
 
-        if (item_j_is_less_than_item_i.as.boolean) {
+        if (PYRO_AS_BOOL(item_j_is_less_than_item_i)) {
             array[k] = aux_array[j];
             j++;
         } else {
@@ -460,7 +460,7 @@ bool pyro_is_sorted_with_callback(PyroVM* vm, PyroValue* values, size_t count, P
             return false;
         }
 
-        if (b_is_less_than_a.as.boolean) {
+        if (PYRO_AS_BOOL(b_is_less_than_a)) {
             return false;
         }
     }
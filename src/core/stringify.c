@@ -3,6 +3,10 @@
 
 // Returns a quoted, escaped string. Panics and returns NULL if memory allocation fails.
 static PyroStr* make_debug_string_for_string(PyroVM* vm, PyroStr* input_string) {
+    if (!PyroStr_view(input_string, vm)) {
+        return NULL;
+    }
+
     PyroBuf* buf = PyroBuf_new(vm);
     if (!buf) {
         pyro_panic(vm, "out of memory");
@@ -137,7 +141,7 @@ static PyroStr* make_debug_string_for_buf(PyroVM* vm, PyroBuf* buf) {
 // Returns a quoted, escaped string. Panics and returns NULL if memory allocation fails.
 static PyroStr* make_debug_string_for_rune(PyroVM* vm, PyroValue value) {
     uint8_t utf8_buffer[4];
-    size_t count = pyro_write_utf8_codepoint(value.as.u32, utf8_buffer);
+    size_t count = pyro_write_utf8_codepoint(PYRO_AS_RUNE(value), utf8_buffer);
 
     PyroBuf* buf = PyroBuf_new(vm);
     if (!buf) {
@@ -500,8 +504,13 @@ static PyroStr* stringify_queue(PyroVM* vm, PyroQueue* queue) {
 // Panics and returns NULL if an error occurs. May call into Pyro code and set the exit flag.
 static PyroStr* stringify_object(PyroVM* vm, PyroObject* object) {
     switch (object->type) {
-        case PYRO_OBJECT_STR:
-            return (PyroStr*)object;
+        case PYRO_OBJECT_STR: {
+            PyroStr* string = (PyroStr*)object;
+            if (!PyroStr_flatten(string, vm)) {
+                return NULL;
+            }
+            return string;
+        }
 
         case PYRO_OBJECT_MODULE:
             return pyro_copy_to_pyrostr(vm, "<module>");
@@ -568,7 +577,7 @@ static PyroStr* stringify_object(PyroVM* vm, PyroObject* object) {
                 return vm->empty_string;
             }
 
-            PyroStr* string = PyroStr_copy((char*)buf->bytes, buf->count, false, vm);
+            PyroStr* string = PyroStr_copy_lazy((char*)buf->bytes, buf->count, vm);
             if (!string) {
                 pyro_panic(vm, "out of memory");
                 return NULL;
@@ -628,7 +637,7 @@ static PyroStr* stringify_object(PyroVM* vm, PyroObject* object) {
                     pyro_panic(vm, "invalid return type for :$str() method, expected a string");
                     return NULL;
                 }
-                return PYRO_AS_STR(result);
+                return stringify_object(vm, PYRO_AS_OBJ(result));
             }
 
             PyroInstance* instance = (PyroInstance*)object;
@@ -704,7 +713,7 @@ static PyroStr* stringify_f64(PyroVM* vm, double value, size_t precision) {
         trimmed_length++;
     }
 
-    PyroStr* string = PyroStr_copy(array, trimmed_length, false, vm);
+    PyroStr* string = PyroStr_copy_lazy(array, trimmed_length, vm);
     PYRO_FREE_ARRAY(vm, char, array, original_length + 1);
     if (!string) {
         pyro_panic(vm, "out of memory");
@@ -772,7 +781,7 @@ PyroStr* pyro_sprintf_to_pyrostr(PyroVM* vm, const char* format_string, ...) {
     vsprintf(array, format_string, args);
     va_end(args);
 
-    PyroStr* string = PyroStr_take(array, length, length + 1, vm);
+    PyroStr* string = PyroStr_take_lazy(array, length, length + 1, vm);
     if (!string) {
         PYRO_FREE_ARRAY(vm, char, array, length + 1);
         pyro_panic(vm, "out of memory");
@@ -795,23 +804,23 @@ PyroStr* pyro_copy_to_pyrostr(PyroVM* vm, const char* cstring) {
 
 
 PyroStr* pyro_stringify_value(PyroVM* vm, PyroValue value) {
-    switch (value.type) {
+    switch (PYRO_TYPE_OF(value)) {
         case PYRO_VALUE_BOOL:
-            return value.as.boolean ? vm->str_true : vm->str_false;
+            return PYRO_AS_BOOL(value) ? vm->str_true : vm->str_false;
 
         case PYRO_VALUE_NULL:
             return vm->str_null;
 
         case PYRO_VALUE_I64:
-            return pyro_sprintf_to_pyrostr(vm, "%" PRId64, value.as.i64);
+            return pyro_sprintf_to_pyrostr(vm, "%" PRId64, PYRO_AS_I64(value));
 
         case PYRO_VALUE_F64:
-            return stringify_f64(vm, value.as.f64, 6);
+            return stringify_f64(vm, PYRO_AS_F64(value), 6);
 
         case PYRO_VALUE_RUNE: {
             char buffer[4];
-            size_t count = pyro_write_utf8_codepoint(value.as.u32, (uint8_t*)buffer);
-            PyroStr* string = PyroStr_copy(buffer, count, false, vm);
+            size_t count = pyro_write_utf8_codepoint(PYRO_AS_RUNE(value), (uint8_t*)buffer);
+            PyroStr* string = PyroStr_copy_lazy(buffer, count, vm);
             if (!string) {
                 pyro_panic(vm, "out of memory");
                 return NULL;
@@ -820,9 +829,6 @@ PyroStr* pyro_stringify_value(PyroVM* vm, PyroValue value) {
         }
 
         case PYRO_VALUE_OBJ: {
-            if (PYRO_AS_OBJ(value)->type == PYRO_OBJECT_STR) {
-                return PYRO_AS_STR(value);
-            }
             return stringify_object(vm, PYRO_AS_OBJ(value));
         }
 
@@ -873,7 +879,7 @@ static PyroStr* make_debug_string_for_f64(PyroVM* vm, double value) {
 
     size_t count = strlen(array);
 
-    PyroStr* string = PyroStr_take(array, count, count + 1, vm);
+    PyroStr* string = PyroStr_take_lazy(array, count, count + 1, vm);
     if (!string) {
         PYRO_FREE_ARRAY(vm, char, array, count + 1);
         pyro_panic(vm, "out of memory");
@@ -906,7 +912,7 @@ static PyroStr* make_debug_string_for_f64(PyroVM* vm, double value) {
 
 PyroStr* pyro_debugify_value(PyroVM* vm, PyroValue value) {
     if (PYRO_IS_F64(value)) {
-        return make_debug_string_for_f64(vm, value.as.f64);
+        return make_debug_string_for_f64(vm, PYRO_AS_F64(value));
     }
 
     if (PYRO_IS_STR(value)) {
@@ -947,7 +953,7 @@ PyroStr* pyro_debugify_value(PyroVM* vm, PyroValue value) {
             pyro_panic(vm, "invalid return type for :$debug(), expected a string");
             return NULL;
         }
-        return PYRO_AS_STR(result);
+        return stringify_object(vm, PYRO_AS_OBJ(result));
     }
 
     return pyro_stringify_value(vm, value);
@@ -970,19 +976,19 @@ static PyroStr* format_i64(PyroVM* vm, PyroValue value, const char* format_speci
     switch (format_specifier[format_specifier_length - 1]) {
         case 'd':
             memcpy(&buffer[buffer_count], PRId64, strlen(PRId64));
-            return pyro_sprintf_to_pyrostr(vm, buffer, value.as.i64);
+            return pyro_sprintf_to_pyrostr(vm, buffer, PYRO_AS_I64(value));
 
         case 'o':
             memcpy(&buffer[buffer_count], PRIo64, strlen(PRIo64));
-            return pyro_sprintf_to_pyrostr(vm, buffer, value.as.u64);
+            return pyro_sprintf_to_pyrostr(vm, buffer, (uint64_t)PYRO_AS_I64(value));
 
         case 'x':
             memcpy(&buffer[buffer_count], PRIx64, strlen(PRIx64));
-            return pyro_sprintf_to_pyrostr(vm, buffer, value.as.u64);
+            return pyro_sprintf_to_pyrostr(vm, buffer, (uint64_t)PYRO_AS_I64(value));
 
         case 'X':
             memcpy(&buffer[buffer_count], PRIX64, strlen(PRIX64));
-            return pyro_sprintf_to_pyrostr(vm, buffer, value.as.u64);
+            return pyro_sprintf_to_pyrostr(vm, buffer, (uint64_t)PYRO_AS_I64(value));
 
         default:
             pyro_panic(vm, "%s: invalid format specifier for type 'i64': '%s'", err_prefix, format_specifier);
@@ -1007,19 +1013,19 @@ static PyroStr* format_char(PyroVM* vm, PyroValue value, const char* format_spec
     switch (format_specifier[format_specifier_length - 1]) {
         case 'd':
             memcpy(&buffer[buffer_count], PRIu32, strlen(PRIu32));
-            return pyro_sprintf_to_pyrostr(vm, buffer, value.as.u32);
+            return pyro_sprintf_to_pyrostr(vm, buffer, PYRO_AS_RUNE(value));
 
         case 'o':
             memcpy(&buffer[buffer_count], PRIo32, strlen(PRIo32));
-            return pyro_sprintf_to_pyrostr(vm, buffer, value.as.u32);
+            return pyro_sprintf_to_pyrostr(vm, buffer, PYRO_AS_RUNE(value));
 
         case 'x':
             memcpy(&buffer[buffer_count], PRIx32, strlen(PRIx32));
-            return pyro_sprintf_to_pyrostr(vm, buffer, value.as.u32);
+            return pyro_sprintf_to_pyrostr(vm, buffer, PYRO_AS_RUNE(value));
 
         case 'X':
             memcpy(&buffer[buffer_count], PRIX32, strlen(PRIX32));
-            return pyro_sprintf_to_pyrostr(vm, buffer, value.as.u32);
+            return pyro_sprintf_to_pyrostr(vm, buffer, PYRO_AS_RUNE(value));
 
         default:
             pyro_panic(vm, "%s: invalid format specifier for type 'char': '%s'", err_prefix, format_specifier);
@@ -1048,7 +1054,7 @@ static PyroStr* format_f64(PyroVM* vm, PyroValue value, const char* format_speci
         case 'F':
         case 'g':
         case 'G':
-            return pyro_sprintf_to_pyrostr(vm, buffer, value.as.f64);
+            return pyro_sprintf_to_pyrostr(vm, buffer, PYRO_AS_F64(value));
 
         default:
             pyro_panic(vm, "%s: invalid format specifier for type 'f64': '%s'", err_prefix, format_specifier);
@@ -1058,6 +1064,10 @@ static PyroStr* format_f64(PyroVM* vm, PyroValue value, const char* format_speci
 
 
 static PyroStr* format_str(PyroVM* vm, PyroStr* string, const char* format_specifier, const char* err_prefix) {
+    if (!PyroStr_flatten(string, vm)) {
+        return NULL;
+    }
+
     char buffer[24] = {0};
     size_t buffer_count = 0;
 
@@ -1125,7 +1135,7 @@ static PyroStr* format_str(PyroVM* vm, PyroStr* string, const char* format_speci
 
     array[array_index] = '\0';
 
-    PyroStr* result = PyroStr_take(array, target_length, target_length + 1, vm);
+    PyroStr* result = PyroStr_take_lazy(array, target_length, target_length + 1, vm);
     if (!result) {
         PYRO_FREE_ARRAY(vm, char, array, target_length + 1);
         pyro_panic(vm, "%s: out of memory", err_prefix);
@@ -1177,7 +1187,7 @@ PyroStr* pyro_format_value(PyroVM* vm, PyroValue value, const char* format_speci
         if (vm->halt_flag) {
             return NULL;
         }
-        return PYRO_IS_STR(result) ? PYRO_AS_STR(result) : pyro_stringify_value(vm, result);
+        return pyro_stringify_value(vm, result);
     }
 
     PyroStr* type_name = pyro_get_type_name(vm, value);
@@ -1212,6 +1222,10 @@ PyroStr* pyro_format(
     size_t specifier_count = 0;
     char specifier[16];
 
+    if (!PyroStr_view(format_string, vm)) {
+        return NULL;
+    }
+
     const char* fs_bytes = format_string->bytes;
     const size_t fs_count = format_string->count;
     size_t fs_index = 0;
@@ -189,16 +189,52 @@ bool pyro_is_valid_utf8(const char* string, size_t length) {
     Utf8CodePoint cp;
 
     while (byte_index < length) {
+        // Skip over runs of ASCII in bulk; only multi-byte codepoints need to be decoded.
+        byte_index += pyro_count_ascii_prefix(&string[byte_index], length - byte_index);
+        if (byte_index == length) {
+            break;
+        }
+
+        uint8_t* src_buf = (uint8_t*)&string[byte_index];
+        size_t src_len = length - byte_index;
+
+        if (pyro_read_utf8_codepoint(src_buf, src_len, &cp)) {
+            byte_index += cp.length;
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+bool pyro_count_utf8_codepoints(const char* string, size_t length, size_t* count) {
+    size_t byte_index = 0;
+    size_t codepoint_count = 0;
+    Utf8CodePoint cp;
+
+    while (byte_index < length) {
+        size_t ascii_count = pyro_count_ascii_prefix(&string[byte_index], length - byte_index);
+        byte_index += ascii_count;
+        codepoint_count += ascii_count;
+        if (byte_index == length) {
+            break;
+        }
+
         uint8_t* src_buf = (uint8_t*)&string[byte_index];
         size_t src_len = length - byte_index;
 
         if (pyro_read_utf8_codepoint(src_buf, src_len, &cp)) {
             byte_index += cp.length;
+            codepoint_count++;
         } else {
+            *count = byte_index;
             return false;
         }
     }
 
+    *count = codepoint_count;
     return true;
 }
 
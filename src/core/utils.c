@@ -1,5 +1,9 @@
 #include "../includes/pyro.h"
 
+#if PYRO_USE_SSE2
+    #include <emmintrin.h>
+#endif
+
 
 PyroBuf* pyro_read_file_into_buf(PyroVM* vm, const char* path, const char* err_prefix) {
     FILE* file = fopen(path, "rb");
@@ -232,7 +236,7 @@ bool pyro_parse_string_as_int(const char* string, size_t length, int64_t* value)
     errno = 0;
     char* endptr;
     *value = strtoll(buffer, &endptr, base);
-    if (errno != 0 || *endptr != '\0') {
+    if (errno != 0 || *endptr != '\0' || *value > PYRO_I64_MAX || *value < PYRO_I64_MIN) {
         return false;
     }
 
@@ -494,3 +498,126 @@ uint64_t pyro_random_seed(void) {
 
     return seed;
 }
+
+
+// The SSE2 implementation compares the first and last bytes of the needle against 16 candidate
+// positions at a time and only calls memcmp() on positions where both match. The portable
+// implementation uses memchr() to find candidate positions -- the C library's memchr() is
+// usually vectorized already.
+const char* pyro_find_bytes(const char* haystack, size_t haystack_count, const char* needle, size_t needle_count) {
+    if (needle_count == 0) {
+        return haystack;
+    }
+
+    if (needle_count > haystack_count) {
+        return NULL;
+    }
+
+    if (needle_count == 1) {
+        return memchr(haystack, needle[0], haystack_count);
+    }
+
+    size_t last_start = haystack_count - needle_count;
+    size_t index = 0;
+
+    #if PYRO_USE_SSE2
+        __m128i first = _mm_set1_epi8(needle[0]);
+        __m128i last = _mm_set1_epi8(needle[needle_count - 1]);
+
+        while (index + 16 <= last_start + 1) {
+            __m128i first_block = _mm_loadu_si128((const __m128i*)(haystack + index));
+            __m128i last_block = _mm_loadu_si128((const __m128i*)(haystack + index + needle_count - 1));
+
+            uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_and_si128(
+                _mm_cmpeq_epi8(first, first_block),
+                _mm_cmpeq_epi8(last, last_block)
+            ));
+
+            while (mask != 0) {
+                size_t offset = index + pyro_count_trailing_zeros(mask);
+                if (memcmp(haystack + offset + 1, needle + 1, needle_count - 2) == 0) {
+                    return haystack + offset;
+                }
+                mask &= mask - 1;
+            }
+
+            index += 16;
+        }
+    #endif
+
+    while (index <= last_start) {
+        const char* candidate = memchr(haystack + index, needle[0], last_start - index + 1);
+        if (!candidate) {
+            return NULL;
+        }
+
+        if (memcmp(candidate + 1, needle + 1, needle_count - 1) == 0) {
+            return candidate;
+        }
+
+        index = (size_t)(candidate - haystack) + 1;
+    }
+
+    return NULL;
+}
+
+
+const char* pyro_find_ascii_ws(const char* start, const char* end) {
+    const char* current = start;
+
+    #if PYRO_USE_SSE2
+        // The ASCII whitespace characters are the space and the range ['\t', '\r'].
+        const __m128i space = _mm_set1_epi8(' ');
+        const __m128i tab = _mm_set1_epi8('\t');
+        const __m128i range = _mm_set1_epi8('\r' - '\t');
+
+        while (end - current >= 16) {
+            __m128i block = _mm_loadu_si128((const __m128i*)current);
+            __m128i offset = _mm_sub_epi8(block, tab);
+            __m128i in_range = _mm_cmpeq_epi8(_mm_min_epu8(offset, range), offset);
+            __m128i is_space = _mm_cmpeq_epi8(block, space);
+
+            uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_or_si128(in_range, is_space));
+            if (mask != 0) {
+                return current + pyro_count_trailing_zeros(mask);
+            }
+
+            current += 16;
+        }
+    #endif
+
+    while (current < end && !pyro_is_ascii_ws(*current)) {
+        current++;
+    }
+
+    return current;
+}
+
+
+size_t pyro_count_ascii_prefix(const char* string, size_t count) {
+    size_t index = 0;
+
+    #if PYRO_USE_SSE2
+        while (index + 16 <= count) {
+            __m128i block = _mm_loadu_si128((const __m128i*)(string + index));
+            uint32_t mask = (uint32_t)_mm_movemask_epi8(block);
+            if (mask != 0) {
+                return index + pyro_count_trailing_zeros(mask);
+            }
+            index += 16;
+        }
+    #else
+        while (index + 8 <= count) {
+            if (pyro_read_u64((const uint8_t*)(string + index)) & UINT64_C(0x8080808080808080)) {
+                break;
+            }
+            index += 8;
+        }
+    #endif
+
+    while (index < count && (string[index] & 0x80) == 0) {
+        index++;
+    }
+
+    return index;
+}
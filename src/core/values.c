@@ -2,7 +2,7 @@
 
 
 PyroClass* pyro_get_class(PyroVM* vm, PyroValue value) {
-    switch (value.type) {
+    switch (PYRO_TYPE_OF(value)) {
         case PYRO_VALUE_RUNE:
             return vm->class_rune;
         case PYRO_VALUE_OBJ:
@@ -13,6 +13,40 @@ PyroClass* pyro_get_class(PyroVM* vm, PyroValue value) {
 }
 
 
+// Looks up an instance method, checking the VM's global method cache first. Returns [null] if the
+// method doesn't exist. Only successful lookups are cached.
+static PyroValue get_instance_method(PyroVM* vm, PyroClass* class, PyroStr* method_name, bool is_pub) {
+    PyroMap* methods = is_pub ? class->pub_instance_methods : class->all_instance_methods;
+    PyroValue method;
+
+    // The cache is keyed on the name's address so only interned names can be cached.
+    if (!method_name->is_interned) {
+        if (!PyroMap_fast_get(methods, method_name, &method, vm)) {
+            return pyro_null();
+        }
+        return method;
+    }
+
+    uint64_t hash = class->layout_id ^ ((uint64_t)(uintptr_t)method_name >> 4) ^ (uint64_t)is_pub;
+    hash *= 0x9E3779B97F4A7C15;
+    PyroMethodCacheEntry* entry = &vm->method_cache[(hash >> 32) & (PYRO_METHOD_CACHE_SIZE - 1)];
+
+    if (entry->layout_id == class->layout_id && entry->name == method_name && entry->is_pub == is_pub) {
+        return entry->method;
+    }
+
+    if (!PyroMap_fast_get(methods, method_name, &method, vm)) {
+        return pyro_null();
+    }
+
+    entry->layout_id = class->layout_id;
+    entry->name = method_name;
+    entry->is_pub = is_pub;
+    entry->method = method;
+    return method;
+}
+
+
 PyroValue pyro_get_method(PyroVM* vm, PyroValue receiver, PyroStr* method_name) {
     if (PYRO_IS_CLASS(receiver)) {
         PyroValue method;
@@ -24,10 +58,7 @@ PyroValue pyro_get_method(PyroVM* vm, PyroValue receiver, PyroStr* method_name)
 
     PyroClass* class = pyro_get_class(vm, receiver);
     if (class) {
-        PyroValue method;
-        if (PyroMap_fast_get(class->all_instance_methods, method_name, &method, vm)) {
-            return method;
-        }
+        return get_instance_method(vm, class, method_name, false);
     }
 
     return pyro_null();
@@ -45,10 +76,7 @@ PyroValue pyro_get_pub_method(PyroVM* vm, PyroValue receiver, PyroStr* method_na
 
     PyroClass* class = pyro_get_class(vm, receiver);
     if (class) {
-        PyroValue method;
-        if (PyroMap_fast_get(class->pub_instance_methods, method_name, &method, vm)) {
-            return method;
-        }
+        return get_instance_method(vm, class, method_name, true);
     }
 
     return pyro_null();
@@ -66,18 +94,18 @@ bool pyro_has_pub_method(PyroVM* vm, PyroValue receiver, PyroStr* method_name) {
 
 
 bool pyro_compare_eq_strict(PyroValue a, PyroValue b) {
-    if (a.type == b.type) {
-        switch (a.type) {
+    if (PYRO_TYPE_OF(a) == PYRO_TYPE_OF(b)) {
+        switch (PYRO_TYPE_OF(a)) {
             case PYRO_VALUE_BOOL:
-                return a.as.boolean == b.as.boolean;
+                return PYRO_AS_BOOL(a) == PYRO_AS_BOOL(b);
             case PYRO_VALUE_I64:
-                return a.as.i64 == b.as.i64;
+                return PYRO_AS_I64(a) == PYRO_AS_I64(b);
             case PYRO_VALUE_F64:
-                return a.as.f64 == b.as.f64;
+                return PYRO_AS_F64(a) == PYRO_AS_F64(b);
             case PYRO_VALUE_RUNE:
-                return a.as.u32 == b.as.u32;
+                return PYRO_AS_RUNE(a) == PYRO_AS_RUNE(b);
             case PYRO_VALUE_OBJ:
-                return a.as.obj == b.as.obj;
+                return PYRO_AS_OBJ(a) == PYRO_AS_OBJ(b);
             case PYRO_VALUE_NULL:
                 return true;
             case PYRO_VALUE_TOMBSTONE:
@@ -101,61 +129,78 @@ inline static bool is_numerically_equal_to_i64(double value) {
 
 // All builtin types follow the rule that values that compare as equal also hash as equal.
 uint64_t pyro_hash_value(PyroVM* vm, PyroValue value) {
-    switch (value.type) {
+    switch (PYRO_TYPE_OF(value)) {
         case PYRO_VALUE_NULL:
             return 123;
 
         case PYRO_VALUE_BOOL:
-            return value.as.boolean ? 456 : 789;
+            return PYRO_AS_BOOL(value) ? 456 : 789;
 
+        // Integers, runes, and integer-valued floats that compare as equal must hash to the same
+        // value.
         case PYRO_VALUE_I64:
-            return value.as.u64;
+            return pyro_mix_u64((uint64_t)PYRO_AS_I64(value));
 
         case PYRO_VALUE_RUNE:
-            return (uint64_t)value.as.u32;
+            return pyro_mix_u64((uint64_t)PYRO_AS_RUNE(value));
 
         case PYRO_VALUE_F64: {
-            if (is_numerically_equal_to_i64(value.as.f64)) {
-                return (uint64_t)(int64_t)value.as.f64;
+            if (is_numerically_equal_to_i64(PYRO_AS_F64(value))) {
+                return pyro_mix_u64((uint64_t)(int64_t)PYRO_AS_F64(value));
             }
-            if (isinf(value.as.f64)) {
+            if (isinf(PYRO_AS_F64(value))) {
                 return 123456789;
             }
-            if (isnan(value.as.f64)) {
+            if (isnan(PYRO_AS_F64(value))) {
                 return 0;
             }
-            return value.as.u64;
+            double f64 = PYRO_AS_F64(value);
+            uint64_t bits;
+            memcpy(&bits, &f64, sizeof(uint64_t));
+            return pyro_mix_u64(bits);
         }
 
         case PYRO_VALUE_OBJ:
-            switch (value.as.obj->type) {
-                case PYRO_OBJECT_STR:
-                    return PYRO_AS_STR(value)->hash;
+            switch (PYRO_AS_OBJ(value)->type) {
+                case PYRO_OBJECT_STR: {
+                    PyroStr* string = PYRO_AS_STR(value);
+                    if (!PyroStr_view(string, vm)) {
+                        return 0;
+                    }
+                    return PyroStr_get_hash(string, vm);
+                }
 
+                // Tuples use an order-sensitive combiner as (a, b) != (b, a).
                 case PYRO_OBJECT_TUP: {
-                    uint64_t hash = 0;
                     PyroTup* tup = PYRO_AS_TUP(value);
+                    uint64_t hash = (uint64_t)tup->count;
 
                     for (size_t i = 0; i < tup->count; i++) {
-                        hash ^= pyro_hash_value(vm, tup->values[i]);
+                        uint64_t element_hash = pyro_hash_value(vm, tup->values[i]);
+                        if (vm->halt_flag) {
+                            return 0;
+                        }
+                        hash = pyro_hash_combine(hash, element_hash);
                     }
 
-                    return hash;
+                    return pyro_mix_u64(hash);
                 }
 
+                // Sets that compare as equal can store their members in different orders so the
+                // member hashes are combined by addition, which is order-independent.
                 case PYRO_OBJECT_MAP_AS_SET: {
-                    uint64_t hash = 0;
                     PyroMap* map = PYRO_AS_MAP(value);
+                    uint64_t hash = 0;
 
                     for (size_t i = 0; i < map->entry_array_count; i++) {
                         PyroMapEntry* entry = &map->entry_array[i];
                         if (PYRO_IS_TOMBSTONE(entry->key)) {
                             continue;
                         }
-                        hash ^= pyro_hash_value(vm, entry->key);
+                        hash += entry->hash;
                     }
 
-                    return hash;
+                    return pyro_mix_u64(hash + (uint64_t)map->live_entry_count);
                 }
 
                 default: {
@@ -166,9 +211,9 @@ uint64_t pyro_hash_value(PyroVM* vm, PyroValue value) {
                         if (vm->halt_flag) {
                             return 0;
                         }
-                        return result.as.u64;
+                        return (uint64_t)PYRO_AS_I64(result);
                     }
-                    return (uint64_t)value.as.obj;
+                    return pyro_mix_u64((uint64_t)PYRO_AS_OBJ(value));
                 }
             }
 
@@ -182,6 +227,9 @@ static void pyro_dump_object(PyroVM* vm, PyroObject* object) {
     switch (object->type) {
         case PYRO_OBJECT_STR: {
             PyroStr* string = (PyroStr*)object;
+            if (!PyroStr_flatten(string, vm)) {
+                break;
+            }
             pyro_stdout_write_f(vm, "\"%s\"", string->bytes);
             break;
         }
@@ -291,9 +339,9 @@ static void pyro_dump_object(PyroVM* vm, PyroObject* object) {
 
 
 void pyro_dump_value(PyroVM* vm, PyroValue value) {
-    switch (value.type) {
+    switch (PYRO_TYPE_OF(value)) {
         case PYRO_VALUE_BOOL:
-            pyro_stdout_write_f(vm, "%s", value.as.boolean ? "true" : "false");
+            pyro_stdout_write_f(vm, "%s", PYRO_AS_BOOL(value) ? "true" : "false");
             break;
 
         case PYRO_VALUE_NULL:
@@ -301,11 +349,11 @@ void pyro_dump_value(PyroVM* vm, PyroValue value) {
             break;
 
         case PYRO_VALUE_I64:
-            pyro_stdout_write_f(vm, "%lld", value.as.i64);
+            pyro_stdout_write_f(vm, "%lld", PYRO_AS_I64(value));
             break;
 
         case PYRO_VALUE_F64:
-            pyro_stdout_write_f(vm, "%.2f", value.as.f64);
+            pyro_stdout_write_f(vm, "%.2f", PYRO_AS_F64(value));
             break;
 
         case PYRO_VALUE_OBJ:
@@ -320,7 +368,7 @@ void pyro_dump_value(PyroVM* vm, PyroValue value) {
 
 
 PyroStr* pyro_get_type_name(PyroVM* vm, PyroValue value) {
-    switch (value.type) {
+    switch (PYRO_TYPE_OF(value)) {
         case PYRO_VALUE_BOOL:
             return vm->str_bool;
 
@@ -0,0 +1,19 @@
+#ifndef pyro_bytecode_cache_h
+#define pyro_bytecode_cache_h
+
+// The bytecode cache for a source file at 'path/to/module.pyro' is stored alongside the source
+// file at 'path/to/module.pyroc'. A cache file records the length and hash of the source code it
+// was compiled from along with the version and instruction set of the VM that compiled it and is
+// only used if all of these still match.
+
+// Attempts to load the compiled bytecode for the source file at [src_path] from its cache file.
+// [src_code] should be the current content of the source file. Returns NULL if there's no cache
+// file or if the cache file is stale, corrupt, or can't be loaded. Never panics.
+PyroFn* pyro_load_bytecode_cache(PyroVM* vm, const char* src_path, const uint8_t* src_code, size_t src_len);
+
+// Writes the compiled bytecode [fn] for the source file at [src_path] to its cache file. [fn]
+// should be the output of pyro_compile() for [src_code] and shouldn't have been executed yet.
+// Writing the cache is best-effort -- failures are silently ignored. Never panics.
+void pyro_write_bytecode_cache(PyroVM* vm, const char* src_path, const uint8_t* src_code, size_t src_len, PyroFn* fn);
+
+#endif
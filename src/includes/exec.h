@@ -14,6 +14,11 @@ void pyro_exec_code(PyroVM* vm, const char* code, size_t code_length, const char
 // - If [module] is NULL, the code will be executed in the context of the VM's main module.
 void pyro_exec_file(PyroVM* vm, const char* filepath, PyroMod* module);
 
+// Like pyro_exec_file() but used for imported modules. If the VM's bytecode cache flag is set,
+// loads the compiled bytecode from the file's bytecode cache if it's up to date, otherwise
+// compiles the file and writes the bytecode cache.
+void pyro_exec_module_file(PyroVM* vm, const char* filepath, PyroMod* module);
+
 // Loads and executes a source file in the context of the specified module.
 // - If [module] is NULL, the code will be executed in the context of the VM's main module.
 // - If [path] is a source file, loads and executes that file.
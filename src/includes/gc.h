@@ -2,7 +2,70 @@
 #define pyro_gc_h
 
 // Runs Pyro's garbage collector which uses a simple mark-and-sweep algorithm.
+// - If the generational garbage collector is enabled, this runs a minor collection unless the
+//   heap has grown past the threshold for a full collection.
+// - If the incremental garbage collector is enabled, a full collection starts an incremental
+//   cycle. While a cycle is in progress, each call runs the next slice of the cycle.
 // - This function can panic and set the [vm->panic_flag] if garbage collection fails.
 void pyro_collect_garbage(PyroVM* vm);
 
+// Runs a full garbage collection, freeing every unreachable object. Completes any incremental
+// cycle in progress.
+// - This function can panic and set the [vm->panic_flag] if garbage collection fails.
+void pyro_collect_all_garbage(PyroVM* vm);
+
+// Stops the worker threads used for parallel marking and frees the pool.
+void pyro_free_gc_mark_pool(PyroVM* vm);
+
+// Adds an old object to the remembered set. Use pyro_write_barrier() instead of calling this
+// function directly.
+void pyro_remember_object(PyroVM* vm, PyroObject* object);
+
+// Marks an object and pushes it onto the grey stack during an incremental cycle. Use
+// pyro_write_barrier() instead of calling this function directly.
+void pyro_mark_grey(PyroVM* vm, PyroObject* object);
+
+// Call this function when storing a reference to [value] into an existing object, i.e. into any
+// object that may have survived a garbage collection since it was allocated. (Writes into an
+// object that has just been allocated don't need the barrier as the garbage collector can't
+// have run.)
+// - If [object] is old, it's added to the remembered set so a minor collection can find any
+//   young objects it references. (An object marked by an incremental cycle will be old once it's
+//   swept.)
+// - If [object] has been marked by an incremental cycle, [value] is marked too. This maintains
+//   the invariant that a marked object can't reference an unmarked object after it's been
+//   scanned.
+// - Objects can only be marked while an incremental cycle is in progress, so the mark bit is only
+//   checked then.
+static inline void pyro_write_barrier(PyroVM* vm, PyroObject* object, PyroValue value) {
+    #if PYRO_USE_GENERATIONAL_GC
+        if (!object->is_remembered) {
+            if (object->is_old || (vm->gc_phase != PYRO_GC_IDLE && pyro_is_marked(object))) {
+                pyro_remember_object(vm, object);
+            }
+        }
+    #endif
+
+    #if PYRO_USE_INCREMENTAL_GC
+        if (vm->gc_phase == PYRO_GC_MARKING && PYRO_IS_OBJ(value) && pyro_is_marked(object)) {
+            if (!pyro_is_marked(PYRO_AS_OBJ(value))) {
+                pyro_mark_grey(vm, PYRO_AS_OBJ(value));
+            }
+        }
+    #endif
+}
+
+// Call this function when returning an interned string found in the string pool. If the string
+// is garbage that the incremental sweeper hasn't reached yet, this marks it to keep it alive.
+static inline void pyro_revive_string(PyroVM* vm, PyroStr* string) {
+    #if PYRO_USE_INCREMENTAL_GC
+        if (vm->gc_phase == PYRO_GC_SWEEPING) {
+            PyroHeapPage* page = pyro_get_page(&string->obj);
+            if (page->swept_epoch != vm->object_heap.sweep_epoch) {
+                pyro_set_marked(&string->obj);
+            }
+        }
+    #endif
+}
+
 #endif
@@ -40,12 +40,13 @@ static inline size_t pyro_grow_capacity(size_t old_capacity) {
 // To free a block of memory set [new_size = 0]. Allocation/reallocation can fail if
 // sufficient memory is not available; in this case the function returns NULL. If reallocation
 // fails, the input pointer remains valid, i.e. the memory it points to will not have been
-// freed.
+// freed. Small blocks are served from the VM's size-class pools so [old_size] must always be the
+// exact size the block was allocated with.
 void* pyro_realloc(PyroVM* vm, void* pointer, size_t old_size, size_t new_size);
 
-// This frees the object along with any heap-allocated memory it owns. This function should
-// only be called from two places -- (1) from inside the garbage collector, and (2) from
-// inside the pyro_free_vm() function.
+// This frees any heap-allocated memory owned by the object. The object's own block is reclaimed by
+// the VM's object heap. This function should only be called from two places -- (1) from inside
+// the garbage collector, and (2) from inside the pyro_free_vm() function.
 void pyro_free_object(PyroVM* vm, PyroObject* object);
 
 #endif
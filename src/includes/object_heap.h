@@ -0,0 +1,131 @@
+#ifndef pyro_object_heap_h
+#define pyro_object_heap_h
+
+// Objects are allocated in size classes: 16-byte steps up to 256 bytes, then 64-byte steps up to
+// PYRO_HEAP_MAX_BLOCK_SIZE bytes. Larger objects are each given a page of their own.
+#define PYRO_HEAP_MAX_BLOCK_SIZE 1024
+#define PYRO_HEAP_SIZE_CLASS_COUNT (16 + (PYRO_HEAP_MAX_BLOCK_SIZE - 256) / 64)
+
+// Index of the list of pages holding large objects.
+#define PYRO_HEAP_LARGE_OBJECTS PYRO_HEAP_SIZE_CLASS_COUNT
+
+// One word of a page's bitmaps, covering 64 blocks. The three bitmaps are interleaved so a
+// single-block page only needs a single word.
+// - [allocated]: the block holds a live object.
+// - [marked]: the object has been marked as reachable by the garbage collector.
+// - [old]: the object has survived a collection and belongs to the old generation.
+typedef struct {
+    uint64_t allocated;
+    uint64_t marked;
+    uint64_t old;
+} PyroHeapBitmap;
+
+// A page is a PYRO_HEAP_PAGE_SIZE-aligned chunk of memory holding objects of a single size class.
+// The header lives at the start of the page so an object's page can be found by masking the
+// object's address.
+typedef struct PyroHeapPage {
+    // Every page in the same size class.
+    struct PyroHeapPage* next;
+
+    // Pages in the same size class with at least one free block.
+    struct PyroHeapPage* next_available;
+    struct PyroHeapPage* prev_available;
+    bool is_available;
+
+    char* blocks;
+    size_t block_size;
+    size_t block_count;
+    size_t size_class;
+
+    // Used to convert an offset from [blocks] into a block index without a division:
+    // [index = (offset * reciprocal) >> 32]. Exact for any offset within the page.
+    uint64_t reciprocal;
+
+    size_t live_count;
+
+    // The number of objects allocated since the page was last swept.
+    size_t young_count;
+
+    // The first bitmap word which may have a free block.
+    size_t free_word;
+
+    // Set to the heap's [sweep_epoch] when the page is swept.
+    size_t swept_epoch;
+
+    size_t bitmap_count;
+    PyroHeapBitmap bitmaps[];
+} PyroHeapPage;
+
+typedef struct {
+    PyroHeapPage* pages[PYRO_HEAP_SIZE_CLASS_COUNT + 1];
+    PyroHeapPage* available[PYRO_HEAP_SIZE_CLASS_COUNT];
+
+    // Empty pages kept for reuse instead of being returned to the OS, linked by their [next]
+    // fields. At most PYRO_HEAP_MAX_FREE_PAGES pages are kept.
+    PyroHeapPage* free_pages;
+    size_t free_page_count;
+
+    // Incremented at the start of each incremental sweep.
+    size_t sweep_epoch;
+
+    // Position of an incremental sweep -- the size class being swept and the link holding the
+    // next page to sweep.
+    size_t sweep_class;
+    PyroHeapPage** sweep_link;
+} PyroObjectHeap;
+
+void PyroObjectHeap_init(PyroObjectHeap* heap);
+
+// Allocates a block for an object of [size] bytes. Adds the block size to [vm->bytes_allocated].
+// Returns NULL and sets [vm->memory_allocation_failed] if memory can't be allocated.
+PyroObject* PyroObjectHeap_alloc(PyroVM* vm, size_t size);
+
+// Calls pyro_free_object() on every object and frees every page.
+void PyroObjectHeap_free_all(PyroVM* vm);
+
+// Calls [callback] on every object in the heap.
+void PyroObjectHeap_for_each_object(PyroVM* vm, void (*callback)(PyroVM* vm, PyroObject* object));
+
+// Clears every object's mark bit.
+void PyroObjectHeap_clear_marks(PyroObjectHeap* heap);
+
+// Frees every unmarked object and promotes every marked object to the old generation. A minor
+// sweep only visits pages holding young objects and ignores old objects.
+void PyroObjectHeap_sweep(PyroVM* vm, bool is_minor);
+
+// Starts an incremental sweep. From here until the sweep is complete, a page which hasn't been
+// swept yet is swept before any new object is allocated in it.
+void PyroObjectHeap_start_sweep(PyroObjectHeap* heap);
+
+// Sweeps pages until at least [budget] objects have been visited. Returns true if the sweep is
+// complete.
+bool PyroObjectHeap_sweep_some(PyroVM* vm, size_t budget);
+
+static inline PyroHeapPage* pyro_get_page(PyroObject* object) {
+    return (PyroHeapPage*)((uintptr_t)object & ~((uintptr_t)PYRO_HEAP_PAGE_SIZE - 1));
+}
+
+// Returns the bitmap word for [object] and sets [bit] to the object's bit within it.
+static inline PyroHeapBitmap* pyro_get_bitmap(PyroObject* object, uint64_t* bit) {
+    PyroHeapPage* page = pyro_get_page(object);
+    size_t index = (size_t)(((uint64_t)((char*)object - page->blocks) * page->reciprocal) >> 32);
+    *bit = (uint64_t)1 << (index & 63);
+    return &page->bitmaps[index >> 6];
+}
+
+static inline bool pyro_is_marked(PyroObject* object) {
+    uint64_t bit;
+    return (pyro_get_bitmap(object, &bit)->marked & bit) != 0;
+}
+
+static inline void pyro_set_marked(PyroObject* object) {
+    uint64_t bit;
+    pyro_get_bitmap(object, &bit)->marked |= bit;
+}
+
+static inline bool pyro_is_old(PyroObject* object) {
+    uint64_t bit;
+    return (pyro_get_bitmap(object, &bit)->old & bit) != 0;
+}
+
+#endif
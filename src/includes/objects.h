@@ -9,8 +9,35 @@ struct PyroStr {
     PyroObject obj;
     size_t count;
     size_t capacity;
-    char* bytes;
-    uint64_t hash;
+
+    // If [is_rope] is true, the string is the concatenation of [rope_left] and [rope_right] and
+    // its bytes haven't been copied into a buffer yet. Code that reads [bytes] or [hash] must
+    // call PyroStr_flatten() or PyroStr_view() first.
+    union {
+        char* bytes;
+        PyroStr* rope_left;
+    };
+
+    union {
+        // Strings which aren't interned are hashed lazily -- use PyroStr_get_hash().
+        uint64_t hash;
+        PyroStr* rope_right;
+    };
+
+    bool is_hashed;
+
+    // True if the string is in the VM's string pool. There's only one interned string with any
+    // given content so two interned strings can be compared by address.
+    bool is_interned;
+
+    bool is_rope;
+
+    // If [is_slice] is true, [bytes] points into the buffer of the flat string [slice_parent]
+    // and isn't null-terminated. The slice keeps its parent alive until PyroStr_flatten() copies
+    // the bytes into a buffer of its own. Code that only reads the [count] bytes at [bytes] can
+    // use the slice as it is.
+    bool is_slice;
+    PyroStr* slice_parent;
 };
 
 // Creates a new string object by copying the null-terminated C-string [src].
@@ -32,10 +59,92 @@ PyroStr* PyroStr_copy(const char* src, size_t count, bool process_backslashed_es
 // - Precondition: [bytes[count] == '\0'].
 PyroStr* PyroStr_take(char* bytes, size_t count, size_t capacity, PyroVM* vm);
 
+// Like PyroStr_take() and PyroStr_copy() but, if PYRO_USE_LAZY_STRING_INTERNING is enabled, the
+// new string isn't hashed or added to the string pool. Use these functions for strings built from
+// runtime data rather than for identifiers or names.
+PyroStr* PyroStr_take_lazy(char* bytes, size_t count, size_t capacity, PyroVM* vm);
+PyroStr* PyroStr_copy_lazy(const char* src, size_t count, PyroVM* vm);
+
+// Returns the interned string with the same content as [string]. If the string pool doesn't
+// contain a match, [string] itself is added to the pool after being flattened. Returns NULL if
+// memory can't be allocated.
+PyroStr* PyroStr_intern(PyroStr* string, PyroVM* vm);
+
+// Computes and caches the string's hash. Use PyroStr_get_hash() instead. Ropes have to be
+// flattened first as the hash shares storage with [rope_right].
+uint64_t PyroStr_compute_hash(PyroStr* string, PyroVM* vm);
+
+static inline uint64_t PyroStr_get_hash(PyroStr* string, PyroVM* vm) {
+    if (string->is_hashed) {
+        return string->hash;
+    }
+    return PyroStr_compute_hash(string, vm);
+}
+
+// Copies the bytes of the rope [string] into a new buffer, turning it into a flat string in place.
+// If memory can't be allocated, panics and returns false. Use PyroStr_flatten() or PyroStr_view().
+bool PyroStr_flatten_rope(PyroStr* string, PyroVM* vm);
+
+// Copies the bytes of the slice [string] into a new buffer, detaching it from its parent in place.
+// If memory can't be allocated, panics and returns false. Use PyroStr_flatten() instead.
+bool PyroStr_materialize_slice(PyroStr* string, PyroVM* vm);
+
+// Makes the bytes of [string] available and null-terminated. Ropes are flattened and slices are
+// materialized in place. Returns true if [string] is flat, or panics and returns false if memory
+// can't be allocated. Call this before using [bytes] for a string that could be a rope or slice.
+static inline bool PyroStr_flatten(PyroStr* string, PyroVM* vm) {
+    if (string->is_rope) {
+        return PyroStr_flatten_rope(string, vm);
+    }
+    if (string->is_slice) {
+        return PyroStr_materialize_slice(string, vm);
+    }
+    return true;
+}
+
+// Like PyroStr_flatten() but slices are left as they are, so the [count] bytes at [bytes] are
+// available but may not be null-terminated. Use this for code that only reads the bytes.
+static inline bool PyroStr_view(PyroStr* string, PyroVM* vm) {
+    if (string->is_rope) {
+        return PyroStr_flatten_rope(string, vm);
+    }
+    return true;
+}
+
+// Returns a string containing the [count] bytes of [string] starting at [index]. If the result is
+// at least PYRO_MIN_SLICE_LENGTH bytes long, it's a slice sharing its parent's buffer; otherwise
+// the bytes are copied. Returns NULL if memory can't be allocated.
+// - Precondition: [string] isn't a rope.
+// - Precondition: [index + count <= string->count].
+PyroStr* PyroStr_slice(PyroStr* string, size_t index, size_t count, PyroVM* vm);
+
+// Returns true if the strings have the same content. Ropes have to be flattened first.
+static inline bool PyroStr_check_equal(PyroStr* a, PyroStr* b) {
+    if (a == b) {
+        return true;
+    }
+    if (a->is_interned && b->is_interned) {
+        return false;
+    }
+    if (a->count != b->count) {
+        return false;
+    }
+    if (a->is_hashed && b->is_hashed && a->hash != b->hash) {
+        return false;
+    }
+    return memcmp(a->bytes, b->bytes, a->count) == 0;
+}
+
 // Creates a new string object by concatenating two source strings. Returns NULL if memory
 // cannot be allocated for the new string.
 PyroStr* PyroStr_concat(PyroStr* s1, PyroStr* s2, PyroVM* vm);
 
+// Like PyroStr_concat() but, if the result is at least PYRO_MIN_ROPE_LENGTH bytes long, returns a
+// rope which defers copying the bytes until the string is accessed. This makes building a long
+// string by repeated concatenation linear rather than quadratic. The arguments can be ropes.
+// Returns NULL if memory can't be allocated.
+PyroStr* PyroStr_concat_as_rope(PyroStr* s1, PyroStr* s2, PyroVM* vm);
+
 // Creates a new string object by concatenating [n] copies of the source string.
 // Returns NULL if memory cannot be allocated for the new string.
 PyroStr* PyroStr_concat_n_copies(PyroStr* str, size_t n, PyroVM* vm);
@@ -60,16 +169,19 @@ PyroStr* PyroStr_append_codepoint_as_utf8(PyroStr* str, uint32_t codepoint, Pyro
 typedef struct {
     PyroValue key;
     PyroValue value;
+
+    // The cached hash of [key]. The index never needs to rehash keys when it's rebuilt.
+    uint64_t hash;
 } PyroMapEntry;
 
-// A linear-probing hash map. New entries are appended to [entry_array] so iterating over this
-// array returns the entries in insertion order.
+// A Swiss-table style hash map. New entries are appended to [entry_array] so iterating over
+// this array returns the entries in insertion order.
 struct PyroMap {
     PyroObject obj;
     size_t version;
 
     // The number of live entries in the map. In addition to these live entries [entry_array]
-    // and [index_array] can contain independently varying numbers of tombstones.
+    // and the index can contain independently varying numbers of tombstones.
     size_t live_entry_count;
 
     // This array is the map's data store -- new entries are appended to this array so
@@ -80,22 +192,33 @@ struct PyroMap {
     size_t entry_array_capacity;
     size_t entry_array_count;
 
-    // This is the array that gets linearly-probed using key hashes. It stores the indexes of
-    // entries in [entry_array]. Negative values indicate that a slot is empty or a tombstone.
-    // - [index_array_capacity] IS guaranteed to be either 0 or a power of 2.
-    // - [index_array_count] includes both live entries and tombstones.
-    int64_t* index_array;
-    size_t index_array_capacity;
-    size_t index_array_count;
-
-    // This gets recalculated every time [index_array] is resized using the formula:
+    // The index is an open-addressing table that gets probed in groups of 16 slots using key
+    // hashes. Each slot has a control byte -- either a sentinel (empty/deleted) or the low 7 bits
+    // of the entry's hash -- and an index into [entry_array]. The control bytes and the indexes
+    // share a single allocation, with [index_array] pointing just past the control bytes.
+    // - [index_capacity] IS guaranteed to be either 0 or a power of 2 no smaller than 16.
+    // - [index_count] includes both live slots and deleted slots.
+    // - If [has_wide_indexes] is true, [index_array] holds uint64_t values, otherwise it holds
+    //   uint32_t values.
+    uint8_t* control_bytes;
+    void* index_array;
+    size_t index_capacity;
+    size_t index_count;
+    bool has_wide_indexes;
+
+    // This gets recalculated every time the index is rebuilt using the formula:
     //
-    //   [max_load_threshold] = [index_array_capacity] * PYRO_MAX_HASHMAP_LOAD
+    //   [max_load_threshold] = [index_capacity] * PYRO_MAP_MAX_LOAD
     //
-    // Invariant: [index_array_count] <= [max_load_threshold].
+    // Invariant: [index_count] <= [max_load_threshold].
     size_t max_load_threshold;
 };
 
+// Returns the number of bytes allocated for the map's index.
+static inline size_t PyroMap_index_size(PyroMap* map) {
+    return map->index_capacity * (1 + (map->has_wide_indexes ? sizeof(uint64_t) : sizeof(uint32_t)));
+}
+
 PyroMap* PyroMap_new(PyroVM* vm);
 PyroMap* PyroMap_new_as_set(PyroVM* vm);
 
@@ -148,7 +271,8 @@ void PyroMap_clear(PyroMap* map, PyroVM* vm);
 
 // Optimized methods for maps where all keys are guaranteed to be PyroStr values. These functions
 // cannot exit/panic/trigger-garbage-collection and are safe to call while the VM is in a panicking
-// state.
+// state. (Map keys are always interned so entries are compared by address. A [key] which isn't
+// interned is swapped for its interned twin first.)
 bool PyroMap_fast_remove(PyroMap* map, PyroStr* key, PyroVM* vm);
 bool PyroMap_fast_get(PyroMap* map, PyroStr* key, PyroValue* value, PyroVM* vm);
 
@@ -223,6 +347,9 @@ struct PyroMod {
     // - [pub_member_indexes] contains indexes for only public members.
     PyroMap* all_member_indexes;
     PyroMap* pub_member_indexes;
+
+    // Changes whenever a member is added -- see pyro_new_layout_id().
+    uint64_t layout_id;
 };
 
 PyroMod* PyroMod_new(PyroVM* vm);
@@ -231,6 +358,17 @@ PyroMod* PyroMod_new(PyroVM* vm);
 /* Pyro Functions */
 /* -------------- */
 
+// An inline cache for an instruction that looks up a field, global variable, or method by name.
+// Stores the index or method resolved by the instruction's last lookup along with the layout ID
+// of the class or module the lookup was made against.
+typedef struct {
+    uint64_t layout_id;
+    union {
+        size_t index;
+        PyroValue method;
+    } as;
+} PyroInlineCache;
+
 typedef struct {
     PyroObject obj;
     PyroStr* name;
@@ -263,8 +401,23 @@ typedef struct {
     uint16_t* bpl;
     size_t bpl_capacity;
 
+    // Instructions that look up fields, global variables, or methods by name take a two-byte
+    // argument indexing into this array of inline caches.
+    PyroInlineCache* inline_caches;
+    size_t inline_cache_count;
+
     // True if the function is a wrapper around a default-value expression.
     bool is_default_value_expression;
+
+    // Counts calls and backward jumps. When this reaches PYRO_REGISTER_TIER_THRESHOLD the VM
+    // tries to translate the function to register code.
+    size_t hotness;
+
+    // The function's register code, or NULL if the function hasn't been translated.
+    PyroRegCode* reg_code;
+
+    // Counts quickened instructions that have reverted to their generic form.
+    size_t deopt_count;
 } PyroFn;
 
 PyroFn* PyroFn_new(PyroVM* vm);
@@ -273,12 +426,24 @@ PyroFn* PyroFn_new(PyroVM* vm);
 // [false] if the write failed because memory could not be allocated.
 bool PyroFn_write(PyroFn* fn, uint8_t byte, size_t line_number, PyroVM* vm);
 
+// Discards the bytecode from index [code_count] onwards, along with its line number entries.
+// Assumes bytes were written in line number order, as the compiler writes them.
+void PyroFn_truncate(PyroFn* fn, size_t code_count);
+
 // This method adds a value to the function's constant table and returns its index. If an
 // identical value is already present in the table it avoids adding a duplicate and returns
 // the index of the existing entry instead. Returns -1 if the operation failed because
 // sufficient memory could not be allocated for the constant table.
 int64_t PyroFn_add_constant(PyroFn* fn, PyroValue value, PyroVM* vm);
 
+// Reserves a new inline cache for the function and returns its index. Returns -1 if the
+// function already has the maximum number of inline caches.
+int64_t PyroFn_add_inline_cache(PyroFn* fn);
+
+// Allocates the function's inline caches. Should be called once the function's bytecode is
+// complete. Returns false if memory could not be allocated.
+bool PyroFn_alloc_inline_caches(PyroFn* fn, PyroVM* vm);
+
 // Returns the length in bytes of the arguments for the opcode at the specified index.
 size_t PyroFn_opcode_argcount(PyroFn* fn, size_t ip);
 
@@ -331,6 +496,9 @@ struct PyroClass {
     PyroMap* all_field_indexes;
     PyroMap* pub_field_indexes;
 
+    // Changes whenever a field or method is added -- see pyro_new_layout_id().
+    uint64_t layout_id;
+
     // Static members.
     PyroMap* static_methods;
     PyroMap* static_fields;
@@ -394,6 +562,7 @@ typedef struct {
 
 PyroBoundMethod* PyroBoundMethod_new(PyroVM* vm, PyroValue receiver, PyroObject* method);
 
+
 /* ------ */
 /* Tuples */
 /* ------ */
@@ -461,6 +630,10 @@ struct PyroFile {
     PyroObject obj;
     FILE* stream; // May be NULL.
     PyroStr* path; // May be NULL.
+
+    // Reusable line buffer for PyroFile_read_line(), allocated by getline(). May be NULL.
+    char* line_buffer;
+    size_t line_buffer_capacity;
 };
 
 PyroFile* PyroFile_new(PyroVM* vm, FILE* stream);
@@ -468,6 +641,8 @@ PyroFile* PyroFile_new(PyroVM* vm, FILE* stream);
 // Reads the next line from the file and returns it as a string, stripping the terminating LF
 // or CRLF. Returns NULL on EOF. Will panic and return NULL if memory allocation fails or if
 // an I/O read error occurs.
+// - Lines are read with getline(), which scans the stream's own block buffer for the newline,
+//   so line reads can be freely mixed with other reads, seeks, and tells on the same stream.
 PyroStr* PyroFile_read_line(PyroFile* file, PyroVM* vm);
 
 // Reads the file into a a buffer. Panics and returns NULL if an error occurs.
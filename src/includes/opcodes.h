@@ -24,6 +24,20 @@ typedef enum {
     PYRO_OPCODE_BINARY_STAR_STAR,
     PYRO_OPCODE_BINARY_MOD,
     PYRO_OPCODE_BINARY_REM,
+    PYRO_OPCODE_BINARY_PLUS_I64,
+    PYRO_OPCODE_BINARY_PLUS_F64,
+    PYRO_OPCODE_BINARY_MINUS_I64,
+    PYRO_OPCODE_BINARY_MINUS_F64,
+    PYRO_OPCODE_BINARY_STAR_I64,
+    PYRO_OPCODE_BINARY_STAR_F64,
+    PYRO_OPCODE_BINARY_LESS_I64,
+    PYRO_OPCODE_BINARY_LESS_F64,
+    PYRO_OPCODE_BINARY_LESS_EQUAL_I64,
+    PYRO_OPCODE_BINARY_LESS_EQUAL_F64,
+    PYRO_OPCODE_BINARY_GREATER_I64,
+    PYRO_OPCODE_BINARY_GREATER_F64,
+    PYRO_OPCODE_BINARY_GREATER_EQUAL_I64,
+    PYRO_OPCODE_BINARY_GREATER_EQUAL_F64,
     PYRO_OPCODE_BREAK,
     PYRO_OPCODE_CALL_COUNT,
     PYRO_OPCODE_CALL_METHOD,
@@ -76,6 +90,9 @@ typedef enum {
     PYRO_OPCODE_GET_LOCAL_7,
     PYRO_OPCODE_GET_LOCAL_8,
     PYRO_OPCODE_GET_LOCAL_9,
+    PYRO_OPCODE_GET_LOCAL_FIELD,
+    PYRO_OPCODE_GET_LOCAL_PLUS_CONSTANT,
+    PYRO_OPCODE_GET_LOCAL_PUB_FIELD,
     PYRO_OPCODE_GET_MEMBER,
     PYRO_OPCODE_GET_METHOD,
     PYRO_OPCODE_GET_NEXT_FROM_ITERATOR,
@@ -94,9 +111,15 @@ typedef enum {
     PYRO_OPCODE_INHERIT,
     PYRO_OPCODE_JUMP,
     PYRO_OPCODE_JUMP_BACK,
+    PYRO_OPCODE_JUMP_IF_EQUAL,
     PYRO_OPCODE_JUMP_IF_ERR,
     PYRO_OPCODE_JUMP_IF_FALSE,
+    PYRO_OPCODE_JUMP_IF_NOT_EQUAL,
     PYRO_OPCODE_JUMP_IF_NOT_ERR,
+    PYRO_OPCODE_JUMP_IF_NOT_GREATER,
+    PYRO_OPCODE_JUMP_IF_NOT_GREATER_EQUAL,
+    PYRO_OPCODE_JUMP_IF_NOT_LESS,
+    PYRO_OPCODE_JUMP_IF_NOT_LESS_EQUAL,
     PYRO_OPCODE_JUMP_IF_NOT_NULL,
     PYRO_OPCODE_JUMP_IF_TRUE,
     PYRO_OPCODE_LOAD_CONSTANT,
@@ -136,6 +159,7 @@ typedef enum {
     PYRO_OPCODE_POP,
     PYRO_OPCODE_POP_ECHO_IN_REPL,
     PYRO_OPCODE_POP_JUMP_IF_FALSE,
+    PYRO_OPCODE_POP_SET_LOCAL,
     PYRO_OPCODE_RETURN,
     PYRO_OPCODE_RETURN_TUPLE,
     PYRO_OPCODE_SET_FIELD,
@@ -83,4 +83,18 @@ bool pyro_get_terminal_size(FILE* file, int64_t* width, int64_t* height);
 // Reads [num_bytes] from the operating system's cryptographically-secure random number source.
 PyroBuf* pyro_csrng_rand_bytes(PyroVM* vm, size_t num_bytes, const char* err_prefix);
 
+// Maps the regular file at [path] into memory as read-only. Returns true on success, storing the
+// address of the mapping in [addr] and its length in [length]. An empty file can't be mapped, so
+// for an empty file [addr] is set to NULL and [length] to zero. Returns false if the file can't
+// be opened or mapped.
+bool pyro_mmap_file(const char* path, void** addr, size_t* length);
+
+// Unmaps a mapping created by pyro_mmap_file(). Does nothing if [addr] is NULL.
+void pyro_munmap(void* addr, size_t length);
+
+// Writes [length] bytes to the file at [path], replacing any existing file. The bytes are first
+// written to a temporary file in the same directory which is then renamed into place, so other
+// processes never see a partially-written file. Returns false if an error occurs.
+bool pyro_write_file_atomically(const char* path, const uint8_t* bytes, size_t length);
+
 #endif
@@ -0,0 +1,12 @@
+#ifndef pyro_peephole_h
+#define pyro_peephole_h
+
+// Runs a peephole optimization pass over the function's finished bytecode. This threads jumps,
+// deletes redundant instruction sequences, and fuses common sequences into superinstructions,
+// rebuilding the jump offsets and the line number table to match. Should be called once the
+// function's bytecode is complete and before its inline caches are allocated. The function's
+// bytecode is left unchanged if the pass can't allocate memory or if a rewritten jump would
+// overflow its 16-bit offset.
+void pyro_optimize_bytecode(PyroVM* vm, PyroFn* fn);
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef pyro_pool_allocator_h
+#define pyro_pool_allocator_h
+
+// Blocks are allocated in size classes which are multiples of this many bytes.
+#define PYRO_POOL_SIZE_CLASS_STEP 16
+
+// The number of size classes.
+#define PYRO_POOL_SIZE_CLASS_COUNT (PYRO_POOL_MAX_BLOCK_SIZE / PYRO_POOL_SIZE_CLASS_STEP)
+
+// A slab is a single PYRO_POOL_SLAB_SIZE-aligned chunk of memory carved into blocks of a single
+// size class. The header lives at the start of the slab so a block's slab can be found by
+// masking the block's address.
+typedef struct PyroPoolSlab {
+    struct PyroPoolSlab* next;
+    struct PyroPoolSlab* prev;
+
+    // Singly-linked list of freed blocks, threaded through the blocks themselves.
+    void* free_list;
+
+    // Blocks from here to the end of the slab have never been allocated.
+    char* unused;
+    char* end;
+
+    size_t block_size;
+    size_t live_count;
+
+    // True if the slab is on its pool's [available] list, false if it's on the [full] list.
+    bool is_available;
+} PyroPoolSlab;
+
+// A pool of slabs for a single size class.
+typedef struct {
+    // Slabs with at least one free block. Allocations come from the slab at the head of the list.
+    PyroPoolSlab* available;
+
+    // Slabs with no free blocks.
+    PyroPoolSlab* full;
+} PyroPool;
+
+// A size-class allocator for small blocks of memory. Freed blocks are returned to their slabs;
+// slabs which have been completely drained are returned to the OS in bulk by
+// PyroPoolAllocator_release_empty_slabs().
+typedef struct {
+    PyroPool pools[PYRO_POOL_SIZE_CLASS_COUNT];
+} PyroPoolAllocator;
+
+void PyroPoolAllocator_init(PyroPoolAllocator* allocator);
+
+// Allocates a block of [size] bytes where [0 < size <= PYRO_POOL_MAX_BLOCK_SIZE]. Returns NULL
+// if memory can't be allocated.
+void* PyroPoolAllocator_alloc(PyroPoolAllocator* allocator, size_t size);
+
+// Frees a block allocated by PyroPoolAllocator_alloc(). [size] must be the size the block was
+// allocated with.
+void PyroPoolAllocator_free(PyroPoolAllocator* allocator, void* block, size_t size);
+
+// Returns every empty slab to the OS, keeping at most one empty slab per size class.
+void PyroPoolAllocator_release_empty_slabs(PyroPoolAllocator* allocator);
+
+// Returns every slab to the OS, whether empty or not. Frees the memory owned by the allocator,
+// not the [allocator] object itself.
+void PyroPoolAllocator_free_all(PyroPoolAllocator* allocator);
+
+// Returns true if a block of [size] bytes is allocated from the pools.
+static inline bool pyro_is_pool_size(size_t size) {
+    #if PYRO_USE_POOL_ALLOCATOR
+        return size > 0 && size <= PYRO_POOL_MAX_BLOCK_SIZE;
+    #else
+        return false;
+    #endif
+}
+
+// Returns true if blocks of [size_a] and [size_b] bytes are allocated from the same size class.
+static inline bool pyro_is_same_size_class(size_t size_a, size_t size_b) {
+    return (size_a - 1) / PYRO_POOL_SIZE_CLASS_STEP == (size_b - 1) / PYRO_POOL_SIZE_CLASS_STEP;
+}
+
+#endif
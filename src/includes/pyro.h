@@ -16,16 +16,79 @@
     #define PYRO_VERSION_BUILD ""
 #endif
 
-// Selects the hash function for strings.
+// Selects the hash function for strings: pyro_wyhash_64, pyro_djb2_64, or pyro_fnv1a_64.
 #ifndef PYRO_STRING_HASH_FUNC
-    #define PYRO_STRING_HASH_FUNC pyro_djb2_64
+    #define PYRO_STRING_HASH_FUNC pyro_wyhash_64
 #endif
 
-// Sets the (count/capacity) threshold for map resizing.
+// If this macro is 1, each VM hashes strings using its own random seed, so an attacker can't
+// precompute a set of keys that collide in a map. If it's 0, string hashes are reproducible
+// across runs.
+#ifndef PYRO_RANDOMIZE_STRING_HASH_SEED
+    #define PYRO_RANDOMIZE_STRING_HASH_SEED 1
+#endif
+
+// If this macro is 1, strings built from runtime data -- e.g. concatenations, formatted strings,
+// and lines read from files -- aren't interned when they're created. They're hashed lazily and
+// only interned if they're used as map keys. Identifiers, constants, and names are always
+// interned.
+#ifndef PYRO_USE_LAZY_STRING_INTERNING
+    #define PYRO_USE_LAZY_STRING_INTERNING 1
+#endif
+
+// If this macro is 1, concatenating strings with the '+' operator builds a rope when the result is
+// at least PYRO_MIN_ROPE_LENGTH bytes long. The rope is only flattened when its bytes are accessed.
+#ifndef PYRO_USE_ROPES
+    #define PYRO_USE_ROPES 1
+#endif
+
+// The minimum length of a string built as a rope. Debug builds use a low value to stress-test ropes.
+#ifndef PYRO_MIN_ROPE_LENGTH
+    #ifdef PYRO_DEBUG
+        #define PYRO_MIN_ROPE_LENGTH 8
+    #else
+        #define PYRO_MIN_ROPE_LENGTH 512
+    #endif
+#endif
+
+// If this macro is 1, substrings produced by methods like :slice(), :split(), :lines(), and
+// :strip() share their parent's buffer instead of copying their bytes. A slice keeps its whole
+// parent alive until it's materialized.
+#ifndef PYRO_USE_STRING_SLICES
+    #define PYRO_USE_STRING_SLICES 1
+#endif
+
+// The minimum length of a substring created as a slice. Shorter substrings are copied. Debug
+// builds use a low value to stress-test slices.
+#ifndef PYRO_MIN_SLICE_LENGTH
+    #ifdef PYRO_DEBUG
+        #define PYRO_MIN_SLICE_LENGTH 1
+    #else
+        #define PYRO_MIN_SLICE_LENGTH 32
+    #endif
+#endif
+
+// Sets the (count/capacity) threshold for string pool resizing.
 #ifndef PYRO_MAX_HASHMAP_LOAD
     #define PYRO_MAX_HASHMAP_LOAD 0.5
 #endif
 
+// Sets the (count/capacity) threshold for map index resizing. Must be less than 1.0 so there's
+// always at least one empty slot in the index.
+#ifndef PYRO_MAP_MAX_LOAD
+    #define PYRO_MAP_MAX_LOAD 0.875
+#endif
+
+// If this macro is 1, map lookups use SSE2 instructions to probe 16 index slots at a time, and
+// string searches and scans process 16 bytes at a time. Otherwise they use portable fallbacks.
+#ifndef PYRO_USE_SSE2
+    #if defined(__SSE2__)
+        #define PYRO_USE_SSE2 1
+    #else
+        #define PYRO_USE_SSE2 0
+    #endif
+#endif
+
 // Sets the initial capacity of the call stack -- the argument is the number of call frames.
 #ifndef PYRO_INITIAL_CALL_STACK_CAPACITY
     #ifdef PYRO_DEBUG
@@ -44,6 +107,22 @@
     #endif
 #endif
 
+// Functions are translated to register code once they've been called or have looped back this
+// many times. Set to 0 to disable the register tier.
+#ifndef PYRO_REGISTER_TIER_THRESHOLD
+    #ifdef PYRO_DEBUG
+        #define PYRO_REGISTER_TIER_THRESHOLD 2
+    #else
+        #define PYRO_REGISTER_TIER_THRESHOLD 1000
+    #endif
+#endif
+
+// Functions stop quickening arithmetic and comparison instructions once their quickened
+// instructions have reverted to the generic form this many times.
+#ifndef PYRO_MAX_DEOPTIMIZATIONS
+    #define PYRO_MAX_DEOPTIMIZATIONS 32
+#endif
+
 // Initial garbage collection threshold in bytes. Defaults to 4MB.
 #ifndef PYRO_INIT_GC_THRESHOLD
     #define PYRO_INIT_GC_THRESHOLD (1024 * 1024 * 4)
@@ -56,6 +135,128 @@
     #define PYRO_GC_HEAP_GROW_FACTOR 2
 #endif
 
+// If this macro is 1, the garbage collector is generational. Newly allocated objects are only
+// traced and swept by frequent minor collections; objects that survive a collection are promoted
+// to the old generation, which is only collected by less frequent full collections.
+#ifndef PYRO_USE_GENERATIONAL_GC
+    #define PYRO_USE_GENERATIONAL_GC 1
+#endif
+
+// When the generational garbage collector is enabled, a minor collection is triggered whenever
+// this many bytes have been allocated since the last collection. Defaults to 8MB.
+#ifndef PYRO_GC_NURSERY_SIZE
+    #define PYRO_GC_NURSERY_SIZE (1024 * 1024 * 8)
+#endif
+
+// If this macro is 1, full collections are incremental. Marking and sweeping are split into
+// slices which are interleaved with the running program, limiting the length of each pause.
+#ifndef PYRO_USE_INCREMENTAL_GC
+    #define PYRO_USE_INCREMENTAL_GC 1
+#endif
+
+// The number of objects the incremental garbage collector will mark or sweep in a single slice.
+// Debug builds use a smaller budget so cycles are spread across more slices.
+#ifndef PYRO_GC_SLICE_BUDGET
+    #ifdef PYRO_DEBUG
+        #define PYRO_GC_SLICE_BUDGET 1024
+    #else
+        #define PYRO_GC_SLICE_BUDGET 4096
+    #endif
+#endif
+
+// While an incremental cycle is in progress, the next slice runs when this many bytes have been
+// allocated since the last slice. Defaults to 64KB.
+#ifndef PYRO_GC_SLICE_INTERVAL
+    #define PYRO_GC_SLICE_INTERVAL (1024 * 64)
+#endif
+
+// The default number of threads used to mark the heap during a full collection. If this is
+// greater than 1, full collections of heaps larger than PYRO_GC_PARALLEL_MARK_THRESHOLD are
+// marked in parallel by a pool of worker threads in a single pause instead of incrementally.
+// Can be changed at runtime by calling pyro_set_gc_mark_threads().
+#ifndef PYRO_GC_MARK_THREADS
+    #define PYRO_GC_MARK_THREADS 1
+#endif
+
+// Full collections are only marked in parallel if the heap is at least this large. Defaults to
+// 8MB. In stress-testing mode, every full collection can be marked in parallel.
+#ifndef PYRO_GC_PARALLEL_MARK_THRESHOLD
+    #ifdef PYRO_DEBUG_STRESS_GARBAGE_COLLECTION
+        #define PYRO_GC_PARALLEL_MARK_THRESHOLD 0
+    #else
+        #define PYRO_GC_PARALLEL_MARK_THRESHOLD (1024 * 1024 * 8)
+    #endif
+#endif
+
+// This macro is 1 if the build is instrumented by AddressSanitizer.
+#if defined(__SANITIZE_ADDRESS__)
+    #define PYRO_HAS_ASAN 1
+#elif defined(__has_feature)
+    #if __has_feature(address_sanitizer)
+        #define PYRO_HAS_ASAN 1
+    #endif
+#endif
+#ifndef PYRO_HAS_ASAN
+    #define PYRO_HAS_ASAN 0
+#endif
+
+// If this macro is 1, small allocations are served from per-VM size-class pools instead of
+// directly by malloc(). Disabled by default in AddressSanitizer builds as pooled blocks are
+// invisible to the sanitizer.
+#ifndef PYRO_USE_POOL_ALLOCATOR
+    #if PYRO_HAS_ASAN
+        #define PYRO_USE_POOL_ALLOCATOR 0
+    #else
+        #define PYRO_USE_POOL_ALLOCATOR 1
+    #endif
+#endif
+
+// The largest allocation in bytes served by the pool allocator. Must be a multiple of 16.
+#ifndef PYRO_POOL_MAX_BLOCK_SIZE
+    #define PYRO_POOL_MAX_BLOCK_SIZE 256
+#endif
+
+// The size in bytes of each slab of memory allocated by the pool allocator. Must be a power of 2.
+// Defaults to 64KB.
+#ifndef PYRO_POOL_SLAB_SIZE
+    #define PYRO_POOL_SLAB_SIZE (1024 * 64)
+#endif
+
+// The size in bytes of each page of objects in the VM's object heap. Must be a power of 2.
+// Defaults to 64KB.
+#ifndef PYRO_HEAP_PAGE_SIZE
+    #define PYRO_HEAP_PAGE_SIZE (1024 * 64)
+#endif
+
+// The maximum number of empty pages the object heap keeps for reuse. Any other empty page is
+// returned to the OS. Defaults to 128 pages, i.e. 8MB.
+#ifndef PYRO_HEAP_MAX_FREE_PAGES
+    #define PYRO_HEAP_MAX_FREE_PAGES 128
+#endif
+
+// Sets the number of entries in the VM's global method cache. Must be a power of 2.
+#ifndef PYRO_METHOD_CACHE_SIZE
+    #define PYRO_METHOD_CACHE_SIZE 1024
+#endif
+
+// If this macro is 1, the VM dispatches instructions using 'computed gotos', i.e. the
+// labels-as-values extension supported by GCC and Clang, instead of a portable switch statement.
+// Debug builds always use the switch statement so every instruction can be traced.
+#ifndef PYRO_USE_COMPUTED_GOTOS
+    #if defined(__GNUC__) || defined(__clang__)
+        #define PYRO_USE_COMPUTED_GOTOS 1
+    #else
+        #define PYRO_USE_COMPUTED_GOTOS 0
+    #endif
+#endif
+
+// If this macro is 1, values are stored as 8-byte NaN-boxed floats instead of 16-byte tagged
+// unions. This halves the size of the value stack, vectors, tuples, and maps, but limits integers
+// to 50 bits -- see PYRO_I64_MIN and PYRO_I64_MAX. Requires a platform with 47-bit pointers.
+#ifndef PYRO_USE_NAN_BOXING
+    #define PYRO_USE_NAN_BOXING 0
+#endif
+
 // Pi to the maximum accuracy limit of 64-bit IEEE 754 floats.
 #ifndef PYRO_PI
     #define PYRO_PI 3.14159265358979323846
@@ -114,17 +315,23 @@ typedef struct PyroVec PyroVec;
 typedef struct PyroClass PyroClass;
 typedef struct PyroMod PyroMod;
 typedef struct PyroFile PyroFile;
+typedef struct PyroRegCode PyroRegCode;
 
 // Pyro headers.
 #include "./opcodes.h"
 #include "./lexer.h"
 #include "./values.h"
 #include "./objects.h"
+#include "./register_code.h"
 #include "./panics.h"
 #include "./prng.h"
 #include "./string_pool.h"
+#include "./pool_allocator.h"
+#include "./object_heap.h"
 #include "./vm.h"
 #include "./compiler.h"
+#include "./bytecode_cache.h"
+#include "./peephole.h"
 #include "./debug.h"
 #include "./exec.h"
 #include "./gc.h"
@@ -0,0 +1,110 @@
+#ifndef pyro_register_code_h
+#define pyro_register_code_h
+
+// Opcodes for the register tier. Operands [a], [b], [c] are register indexes relative to the
+// frame pointer unless noted otherwise. [a] is the destination register.
+typedef enum {
+    PYRO_REG_MOVE,                      // a = b
+    PYRO_REG_ADD,                       // a = b + c
+    PYRO_REG_SUB,                       // a = b - c
+    PYRO_REG_MUL,                       // a = b * c
+    PYRO_REG_DIV,                       // a = b / c
+    PYRO_REG_FLOOR_DIV,                 // a = b // c
+    PYRO_REG_PERCENT,                   // a = b % c
+    PYRO_REG_REM,                       // a = b rem c
+    PYRO_REG_MOD,                       // a = b mod c
+    PYRO_REG_POW,                       // a = b ** c
+    PYRO_REG_BIT_AND,                   // a = b & c
+    PYRO_REG_BIT_OR,                    // a = b | c
+    PYRO_REG_BIT_XOR,                   // a = b ^ c
+    PYRO_REG_SHIFT_LEFT,                // a = b << c
+    PYRO_REG_SHIFT_RIGHT,               // a = b >> c
+    PYRO_REG_EQUAL,                     // a = b == c
+    PYRO_REG_NOT_EQUAL,                 // a = b != c
+    PYRO_REG_LESS,                      // a = b < c
+    PYRO_REG_LESS_EQUAL,                // a = b <= c
+    PYRO_REG_GREATER,                   // a = b > c
+    PYRO_REG_GREATER_EQUAL,             // a = b >= c
+    PYRO_REG_NEGATE,                    // a = -b
+    PYRO_REG_PLUS,                      // a = +b
+    PYRO_REG_NOT,                       // a = !b
+    PYRO_REG_BIT_NOT,                   // a = ~b
+    PYRO_REG_GET_INDEX,                 // a = b[c]
+    PYRO_REG_SET_INDEX,                 // a = (b[c] = x), [x] is a register
+    PYRO_REG_GET_FIELD,                 // a = b.constants[c], [x] is an inline cache index
+    PYRO_REG_GET_PUB_FIELD,             // a = b.constants[c], [x] is an inline cache index
+    PYRO_REG_GET_GLOBAL,                // a = global constants[c], [x] is an inline cache index
+    PYRO_REG_SET_GLOBAL,                // global constants[c] = b, [x] is an inline cache index
+    PYRO_REG_GET_ITERATOR,              // a = a:$iter()
+    PYRO_REG_GET_NEXT_FROM_ITERATOR,    // a = b:$next()
+    PYRO_REG_CALL,                      // a = a(a + 1, ..., a + b)
+    PYRO_REG_CALL_METHOD,               // a = a:constants[c](a + 1, ..., a + b), [x] is an inline cache index
+    PYRO_REG_CALL_PUB_METHOD,           // a = a:constants[c](a + 1, ..., a + b), [x] is an inline cache index
+    PYRO_REG_RETURN,                    // return b
+    PYRO_REG_JUMP,                      // jump to x
+    PYRO_REG_LOOP,                      // jump back to x, a garbage collection safepoint
+    PYRO_REG_JUMP_IF_FALSE,             // if !b, jump to x
+    PYRO_REG_JUMP_IF_TRUE,              // if b, jump to x
+    PYRO_REG_JUMP_IF_ERR,               // if b is an err, jump to x
+    PYRO_REG_JUMP_IF_NOT_ERR,           // if b is not an err, jump to x
+    PYRO_REG_JUMP_IF_EQUAL,             // if b == c, jump to x
+    PYRO_REG_JUMP_IF_NOT_EQUAL,         // if !(b == c), jump to x
+    PYRO_REG_JUMP_IF_NOT_LESS,          // if !(b < c), jump to x
+    PYRO_REG_JUMP_IF_NOT_LESS_EQUAL,    // if !(b <= c), jump to x
+    PYRO_REG_JUMP_IF_NOT_GREATER,       // if !(b > c), jump to x
+    PYRO_REG_JUMP_IF_NOT_GREATER_EQUAL, // if !(b >= c), jump to x
+} PyroRegOpcode;
+
+typedef struct {
+    uint8_t opcode;
+    uint16_t a;
+    uint16_t b;
+    uint16_t c;
+    uint16_t x;
+
+    // Offset of the end of the corresponding instruction in the function's stack bytecode. The
+    // frame's [ip] is set from this before anything that can panic or call a function so line
+    // numbers and stack traces are reported exactly as for the stack bytecode.
+    uint32_t ip;
+} PyroRegInstruction;
+
+// A point in the stack bytecode where a running frame can switch to the register code, i.e. the
+// target of a backward jump.
+typedef struct {
+    size_t ip;
+    size_t depth;
+    size_t reg_ip;
+} PyroRegEntry;
+
+// A function's register code. Registers [0, const_base) mirror the function's value stack slots
+// so locals keep their stack indexes. Registers [const_base, frame_size) hold copies of the
+// constant operands, which are reloaded each time the frame enters the register code.
+struct PyroRegCode {
+    PyroRegInstruction* code;
+    size_t code_count;
+    size_t code_capacity;
+
+    PyroValue* constants;
+    size_t const_base;
+    size_t const_count;
+    size_t const_capacity;
+    size_t frame_size;
+
+    PyroRegEntry* entries;
+    size_t entry_count;
+    size_t entry_capacity;
+};
+
+// Translates the function's stack bytecode into register code. Returns false if the function
+// uses an instruction the register tier doesn't support or if memory can't be allocated -- the
+// function then keeps running as stack bytecode.
+bool pyro_compile_register_code(PyroVM* vm, PyroFn* fn);
+
+// Frees the function's register code.
+void pyro_free_register_code(PyroVM* vm, PyroRegCode* reg_code);
+
+// Returns the register code entry point for the stack bytecode offset [ip], or NULL if there
+// isn't one.
+PyroRegEntry* pyro_find_register_entry(PyroRegCode* reg_code, size_t ip);
+
+#endif
@@ -10,6 +10,10 @@ void pyro_free_vm(PyroVM* vm);
 // Sets the maximum memory allocation for the VM in bytes.
 void pyro_set_max_memory(PyroVM* vm, size_t bytes);
 
+// Sets the number of threads used by the garbage collector to mark the heap during a full
+// collection. A [count] of 1 disables parallel marking.
+void pyro_set_gc_mark_threads(PyroVM* vm, size_t count);
+
 // Returns the VM's exit code.
 int64_t pyro_get_exit_code(PyroVM* vm);
 
@@ -79,4 +83,9 @@ void pyro_set_repl_flag(PyroVM* vm, bool flag);
 // Sets the value of the VM's trace_execution flag.
 void pyro_set_trace_execution_flag(PyroVM* vm, bool flag);
 
+// Sets the value of the VM's bytecode cache flag. If true, imported modules are loaded from
+// '.pyroc' bytecode cache files when they're up to date, and the cache files are written when
+// they're missing or stale. Defaults to false.
+void pyro_set_bytecode_cache_flag(PyroVM* vm, bool flag);
+
 #endif
@@ -9,5 +9,6 @@ void pyro_load_stdlib_module_csrng(PyroVM* vm, PyroMod* module);
 void pyro_load_stdlib_module_pyro(PyroVM* vm, PyroMod* module);
 void pyro_load_stdlib_module_fs(PyroVM* vm, PyroMod* module);
 void pyro_load_stdlib_module_log(PyroVM* vm, PyroMod* module);
+void pyro_load_stdlib_module_json(PyroVM* vm, PyroMod* module);
 
 #endif
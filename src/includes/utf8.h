@@ -28,6 +28,11 @@ bool pyro_is_unicode_whitespace(uint32_t codepoint);
 // Returns [true] if [string] is empty or contains only valid utf-8 codepoints.
 bool pyro_is_valid_utf8(const char* string, size_t length);
 
+// Counts the utf-8 encoded codepoints in [string] and returns [true], storing the result in
+// [count]. If [string] contains invalid utf-8, returns [false], storing the byte index of the
+// first invalid codepoint in [count].
+bool pyro_count_utf8_codepoints(const char* string, size_t length, size_t* count);
+
 // Returns [true] if [string] contains the utf-8 encoded [codepoint]. [string] should contain
 // only valid utf-8; the function will return [false] if it encounters invalid utf-8.
 bool pyro_contains_utf8_codepoint(const char* string, size_t length, uint32_t codepoint);
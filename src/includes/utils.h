@@ -81,13 +81,28 @@ bool pyro_is_ascii_lower(char c);
 // Returns true if [c] is in the ASCII range [A-Z].
 bool pyro_is_ascii_upper(char c);
 
+// Returns a pointer to the first occurrence of [needle] in [haystack], or NULL if there's no
+// match. Returns [haystack] if [needle_count] is zero.
+const char* pyro_find_bytes(const char* haystack, size_t haystack_count, const char* needle, size_t needle_count);
+
+// Returns a pointer to the first ASCII whitespace character in the range [start, end), or [end]
+// if there are none.
+const char* pyro_find_ascii_ws(const char* start, const char* end);
+
+// Returns the number of bytes at the start of [string] which are ASCII, i.e. have their high bit
+// unset.
+size_t pyro_count_ascii_prefix(const char* string, size_t count);
+
 // Generates a randomish value suitable for seeding a PRNG. Uses locally available sources of
 // entropy. Not suitable for cryptographic use.
 uint64_t pyro_random_seed(void);
 
+// String hash functions take a [seed] argument which is mixed into the initial state. The VM
+// passes its own per-instance seed -- see PYRO_RANDOMIZE_STRING_HASH_SEED.
+
 // String hash: DJB2, 64-bit version.
-static inline uint64_t pyro_djb2_64(const uint8_t* string, size_t length) {
-    uint64_t hash = UINT64_C(5381);
+static inline uint64_t pyro_djb2_64(const uint8_t* string, size_t length, uint64_t seed) {
+    uint64_t hash = UINT64_C(5381) ^ seed;
 
     // Function: hash(i) = hash(i - 1) * 33 + string[i]
     for (size_t i = 0; i < length; i++) {
@@ -98,8 +113,8 @@ static inline uint64_t pyro_djb2_64(const uint8_t* string, size_t length) {
 }
 
 // String hash: FNV-1a, 64-bit version.
-static inline uint64_t pyro_fnv1a_64(const uint8_t* string, size_t length) {
-    uint64_t hash = UINT64_C(14695981039346656037);
+static inline uint64_t pyro_fnv1a_64(const uint8_t* string, size_t length, uint64_t seed) {
+    uint64_t hash = UINT64_C(14695981039346656037) ^ seed;
 
     // Function: hash(i) = (hash(i - 1) XOR string[i]) * 1099511628211
     for (size_t i = 0; i < length; i++) {
@@ -110,6 +125,112 @@ static inline uint64_t pyro_fnv1a_64(const uint8_t* string, size_t length) {
     return hash;
 }
 
+// Reads an unaligned little- or big-endian (i.e. native) integer from [p].
+static inline uint64_t pyro_read_u64(const uint8_t* p) {
+    uint64_t value;
+    memcpy(&value, p, sizeof(uint64_t));
+    return value;
+}
+
+static inline uint64_t pyro_read_u32(const uint8_t* p) {
+    uint32_t value;
+    memcpy(&value, p, sizeof(uint32_t));
+    return value;
+}
+
+// Multiplies [a] and [b] as 128-bit integers, returning the low and high halves of the product.
+static inline void pyro_multiply_u128(uint64_t a, uint64_t b, uint64_t* lo, uint64_t* hi) {
+    #if defined(__SIZEOF_INT128__)
+        __extension__ unsigned __int128 product = (unsigned __int128)a * b;
+        *lo = (uint64_t)product;
+        *hi = (uint64_t)(product >> 64);
+    #else
+        uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+        uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+        uint64_t lo_lo = a_lo * b_lo;
+        uint64_t hi_lo = a_hi * b_lo;
+        uint64_t lo_hi = a_lo * b_hi;
+        uint64_t hi_hi = a_hi * b_hi;
+        uint64_t cross = (lo_lo >> 32) + (uint32_t)hi_lo + lo_hi;
+        *hi = hi_hi + (hi_lo >> 32) + (cross >> 32);
+        *lo = (cross << 32) | (uint32_t)lo_lo;
+    #endif
+}
+
+// Multiplies [a] and [b] as 128-bit integers and folds the high half of the product into the
+// low half.
+static inline uint64_t pyro_fold_multiply(uint64_t a, uint64_t b) {
+    uint64_t lo, hi;
+    pyro_multiply_u128(a, b, &lo, &hi);
+    return lo ^ hi;
+}
+
+// String hash: a wyhash-style hash that consumes the input 16 or 48 bytes at a time using
+// 64x64->128-bit multiplies. Much faster than DJB2 or FNV-1a on anything but tiny strings.
+static inline uint64_t pyro_wyhash_64(const uint8_t* string, size_t length, uint64_t seed) {
+    const uint64_t s0 = UINT64_C(0x2D358DCCAA6C78A5);
+    const uint64_t s1 = UINT64_C(0x8BB84B93962EACC9);
+    const uint64_t s2 = UINT64_C(0x4B33A62ED433D4A3);
+    const uint64_t s3 = UINT64_C(0x4D5A2DA51DE1AA47);
+
+    const uint8_t* p = string;
+    seed ^= s0;
+    uint64_t a, b;
+
+    if (length <= 16) {
+        if (length >= 4) {
+            // Two possibly-overlapping 4-byte reads from each end cover every byte.
+            size_t offset = (length >> 3) << 2;
+            a = (pyro_read_u32(p) << 32) | pyro_read_u32(p + offset);
+            b = (pyro_read_u32(p + length - 4) << 32) | pyro_read_u32(p + length - 4 - offset);
+        } else if (length > 0) {
+            a = ((uint64_t)p[0] << 16) | ((uint64_t)p[length >> 1] << 8) | p[length - 1];
+            b = 0;
+        } else {
+            a = 0;
+            b = 0;
+        }
+    } else {
+        size_t i = length;
+        if (i > 48) {
+            // Three independent lanes so the multiplies can run in parallel.
+            uint64_t seed1 = seed;
+            uint64_t seed2 = seed;
+            do {
+                seed = pyro_fold_multiply(pyro_read_u64(p) ^ s1, pyro_read_u64(p + 8) ^ seed);
+                seed1 = pyro_fold_multiply(pyro_read_u64(p + 16) ^ s2, pyro_read_u64(p + 24) ^ seed1);
+                seed2 = pyro_fold_multiply(pyro_read_u64(p + 32) ^ s3, pyro_read_u64(p + 40) ^ seed2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (i > 16) {
+            seed = pyro_fold_multiply(pyro_read_u64(p) ^ s1, pyro_read_u64(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+        // The last 16 bytes, possibly overlapping bytes already consumed.
+        a = pyro_read_u64(p + i - 16);
+        b = pyro_read_u64(p + i - 8);
+    }
+
+    pyro_multiply_u128(a ^ s1, b ^ seed, &a, &b);
+    return pyro_fold_multiply(a ^ s0 ^ length, b ^ s1);
+}
+
+// Integer hash: the SplitMix64 finalizer. This is a bijection on 64-bit integers that spreads
+// every input bit across the output, so keys that differ only in a few bits -- e.g. multiples of
+// a power of 2 -- don't cluster together in hash tables.
+static inline uint64_t pyro_mix_u64(uint64_t x) {
+    x ^= x >> 30;
+    x *= UINT64_C(0xBF58476D1CE4E5B9);
+    x ^= x >> 27;
+    x *= UINT64_C(0x94D049BB133111EB);
+    x ^= x >> 31;
+    return x;
+}
+
 // Returns true if the string [s1] is equal to the string [s2].
 static inline bool pyro_str_eq(const char* s1, size_t s1_count, const char* s2, size_t s2_count) {
     if (s1_count == s2_count) {
@@ -126,9 +247,14 @@ static inline uint64_t pyro_hash_combine(uint64_t h1, uint64_t h2) {
     return (h1 << 1) + h1 + h2;
 }
 
-// Like C23's ckd_add(). Returns true if the result would overflow.
+// Like C23's ckd_add(). Returns true if the result would overflow. If NaN-boxing is enabled, results
+// outside the range [PYRO_I64_MIN, PYRO_I64_MAX] count as overflowing.
 static inline bool pyro_ckd_add(int64_t* result, int64_t a, int64_t b) {
-    #if __pyro_has_include(<stdckdint.h>)
+    #if PYRO_USE_NAN_BOXING
+        // Boxed integers have 50 bits so this can't overflow an int64_t.
+        *result = a + b;
+        return *result < PYRO_I64_MIN || *result > PYRO_I64_MAX;
+    #elif __pyro_has_include(<stdckdint.h>)
         return ckd_add(result, a, b);
     #elif __pyro_has_builtin(__builtin_add_overflow)
         return __builtin_add_overflow(a, b, result);
@@ -146,9 +272,14 @@ static inline bool pyro_ckd_add(int64_t* result, int64_t a, int64_t b) {
     #endif
 }
 
-// Like C23's ckd_sub(). Returns true if the result would overflow.
+// Like C23's ckd_sub(). Returns true if the result would overflow. If NaN-boxing is enabled, results
+// outside the range [PYRO_I64_MIN, PYRO_I64_MAX] count as overflowing.
 static inline bool pyro_ckd_sub(int64_t* result, int64_t a, int64_t b) {
-    #if __pyro_has_include(<stdckdint.h>)
+    #if PYRO_USE_NAN_BOXING
+        // Boxed integers have 50 bits so this can't overflow an int64_t.
+        *result = a - b;
+        return *result < PYRO_I64_MIN || *result > PYRO_I64_MAX;
+    #elif __pyro_has_include(<stdckdint.h>)
         return ckd_sub(result, a, b);
     #elif __pyro_has_builtin(__builtin_sub_overflow)
         return __builtin_sub_overflow(a, b, result);
@@ -166,9 +297,18 @@ static inline bool pyro_ckd_sub(int64_t* result, int64_t a, int64_t b) {
     #endif
 }
 
-// Like C23's ckd_mul(). Returns true if the result would overflow.
+// Like C23's ckd_mul(). Returns true if the result would overflow. If NaN-boxing is enabled, results
+// outside the range [PYRO_I64_MIN, PYRO_I64_MAX] count as overflowing.
 static inline bool pyro_ckd_mul(int64_t* result, int64_t a, int64_t b) {
-    #if __pyro_has_include(<stdckdint.h>)
+    #if PYRO_USE_NAN_BOXING
+        // Boxed integers have 50 bits so we can check the magnitude of the result before
+        // multiplying without overflowing an int64_t.
+        if (a != 0 && imaxabs(b) > (PYRO_I64_MAX / imaxabs(a)) + 1) {
+            return true;
+        }
+        *result = a * b;
+        return *result < PYRO_I64_MIN || *result > PYRO_I64_MAX;
+    #elif __pyro_has_include(<stdckdint.h>)
         return ckd_mul(result, a, b);
     #elif __pyro_has_builtin(__builtin_mul_overflow)
         return __builtin_mul_overflow(a, b, result);
@@ -220,4 +360,18 @@ static inline int64_t pyro_modulo(int64_t numerator, int64_t denominator) {
     return ((numerator % denominator) + denominator) % denominator;
 }
 
+// Returns the number of trailing zero bits in [word]. [word] must be non-zero.
+static inline size_t pyro_count_trailing_zeros(uint64_t word) {
+    #if defined(__GNUC__) || defined(__clang__)
+        return (size_t)__builtin_ctzll(word);
+    #else
+        size_t count = 0;
+        while ((word & 1) == 0) {
+            word >>= 1;
+            count++;
+        }
+        return count;
+    #endif
+}
+
 #endif
@@ -1,8 +1,8 @@
 #ifndef pyro_values_h
 #define pyro_values_h
 
-// Type-set for Pyro's fundamental [PyroValue] type. Every [PyroValue] has a [.type] field
-// with one of these enum values.
+// Type-set for Pyro's fundamental [PyroValue] type. Every [PyroValue] has one of these types --
+// use PYRO_TYPE_OF() to read it.
 typedef enum {
     PYRO_VALUE_BOOL,       // A Pyro boolean, true or false.
     PYRO_VALUE_RUNE,       // A 32-bit unsigned integer representing a Unicode code point.
@@ -13,19 +13,37 @@ typedef enum {
     PYRO_VALUE_TOMBSTONE,  // Used internally by the map implementation.
 } PyroValueType;
 
-// Tagged union for Pyro's fundamental [PyroValue] type. Every value in Pyro is a [PyroValue],
-// e.g.  variables, vector entries, map keys, map values, etc.
-typedef struct {
-    PyroValueType type;
-    union {
-        bool boolean;
-        double f64;
-        int64_t i64;
-        uint64_t u64;
-        uint32_t u32;
-        PyroObject* obj;
-    } as;
-} PyroValue;
+#if PYRO_USE_NAN_BOXING
+    // NaN-boxed representation of Pyro's fundamental [PyroValue] type. Every value in Pyro is a
+    // [PyroValue], e.g. variables, vector entries, map keys, map values, etc.
+    //
+    // A float is stored as its own bit pattern. Every other type is stored in the payload bits
+    // of a quiet NaN with bits 50-62 set -- a bit pattern that no float can have as floating-point
+    // NaNs are canonicalized when they're boxed.
+    //
+    // - If the sign bit is set, bits 0-49 hold a 50-bit two's complement integer.
+    // - Otherwise, bits 47-49 hold the value's [PyroValueType] and bits 0-46 hold the payload,
+    //   i.e. a boolean, a rune, or an object pointer.
+    //
+    // The struct wrapper exists so PyroValue can't be silently mixed up with a C integer.
+    typedef struct {
+        uint64_t bits;
+    } PyroValue;
+#else
+    // Tagged union for Pyro's fundamental [PyroValue] type. Every value in Pyro is a [PyroValue],
+    // e.g.  variables, vector entries, map keys, map values, etc.
+    typedef struct {
+        PyroValueType type;
+        union {
+            bool boolean;
+            double f64;
+            int64_t i64;
+            uint64_t u64;
+            uint32_t u32;
+            PyroObject* obj;
+        } as;
+    } PyroValue;
+#endif
 
 // Type-set for heap-allocated Pyro objects, i.e. Pyro values with type [PYRO_VALUE_OBJ].
 // Every [PyroObject] has a [.type] field with one of these enum values.
@@ -55,58 +73,176 @@ typedef enum {
 } PyroObjectType;
 
 // Base type for all heap-allocated objects, i.e. Pyro values with type [PYRO_VALUE_OBJ].
-// The VM maintains a linked list of all heap-allocated objects using the [.next] pointers.
+// Objects live in the pages of the VM's object heap. The garbage collector's mark and generation
+// flags are stored in each page's bitmaps -- see pyro_is_marked() and pyro_is_old().
 // Not every object has an associated class so [.class] can be NULL.
 struct PyroObject {
-    PyroObject* next;
     PyroClass* class;
     PyroObjectType type;
-    bool is_marked;
+
+    // Used by the generational garbage collector. [is_old] mirrors the object's bit in its page's
+    // [old] bitmap so the write barrier can check it cheaply. [is_remembered] is set while the
+    // object is in the VM's remembered set.
+    bool is_old;
+    bool is_remembered;
 };
 
-// Converts a C boolean to a Pyro value.
-static inline PyroValue pyro_bool(bool value) {
-    return (PyroValue){PYRO_VALUE_BOOL, {.boolean = value}};
-}
+#if PYRO_USE_NAN_BOXING
+    #define PYRO_NAN_BOX_SIGN_BIT       ((uint64_t)0x8000000000000000)
+    #define PYRO_NAN_BOX_QNAN           ((uint64_t)0x7FFC000000000000)
+    #define PYRO_NAN_BOX_CANONICAL_NAN  ((uint64_t)0x7FF8000000000000)
+    #define PYRO_NAN_BOX_TAG_SHIFT      47
+    #define PYRO_NAN_BOX_TAG_MASK       ((uint64_t)0x7 << PYRO_NAN_BOX_TAG_SHIFT)
+    #define PYRO_NAN_BOX_I64_MASK       ((uint64_t)0x0003FFFFFFFFFFFF)
+    #define PYRO_NAN_BOX_PAYLOAD_MASK   ((uint64_t)0x00007FFFFFFFFFFF)
+    #define PYRO_NAN_BOX_I64_TAG        (PYRO_NAN_BOX_SIGN_BIT | PYRO_NAN_BOX_QNAN)
+    #define PYRO_NAN_BOX_TAG(type)      (PYRO_NAN_BOX_QNAN | ((uint64_t)(type) << PYRO_NAN_BOX_TAG_SHIFT))
 
-// Converts a C integer to a Pyro value.
-static inline PyroValue pyro_i64(int64_t value) {
-    return (PyroValue){PYRO_VALUE_I64, {.i64 = value}};
-}
+    // The range of integers that can be boxed.
+    #define PYRO_I64_MAX ((int64_t)0x0001FFFFFFFFFFFF)
+    #define PYRO_I64_MIN (-PYRO_I64_MAX - 1)
 
-// Converts a C double to a Pyro value.
-static inline PyroValue pyro_f64(double value) {
-    return (PyroValue){PYRO_VALUE_F64, {.f64 = value}};
-}
+    // Converts a C boolean to a Pyro value.
+    static inline PyroValue pyro_bool(bool value) {
+        return (PyroValue){PYRO_NAN_BOX_TAG(PYRO_VALUE_BOOL) | (value ? 1 : 0)};
+    }
 
-// Converts a C integer to a Pyro value.
-static inline PyroValue pyro_rune(uint32_t value) {
-    return (PyroValue){PYRO_VALUE_RUNE, {.u32 = value}};
-}
+    // Converts a C integer to a Pyro value. The integer must be in the range
+    // [PYRO_I64_MIN, PYRO_I64_MAX], otherwise it's truncated.
+    static inline PyroValue pyro_i64(int64_t value) {
+        return (PyroValue){PYRO_NAN_BOX_I64_TAG | ((uint64_t)value & PYRO_NAN_BOX_I64_MASK)};
+    }
 
-// Converts a C pointer (which must be a pointer to a PyroObject) to a Pyro value.
-static inline PyroValue pyro_obj(void* value) {
-    return (PyroValue){PYRO_VALUE_OBJ, {.obj = (PyroObject*)value}};
-}
+    // Converts a C double to a Pyro value.
+    static inline PyroValue pyro_f64(double value) {
+        if (isnan(value)) {
+            return (PyroValue){PYRO_NAN_BOX_CANONICAL_NAN};
+        }
+        PyroValue result;
+        memcpy(&result.bits, &value, sizeof(double));
+        return result;
+    }
 
-// Creates a Pyro tombstone value.
-static inline PyroValue pyro_tombstone(void) {
-    return (PyroValue){PYRO_VALUE_TOMBSTONE, {.i64 = 0}};
-}
+    // Converts a C integer to a Pyro value.
+    static inline PyroValue pyro_rune(uint32_t value) {
+        return (PyroValue){PYRO_NAN_BOX_TAG(PYRO_VALUE_RUNE) | value};
+    }
 
-// Creates a Pyro null value.
-static inline PyroValue pyro_null(void) {
-    return (PyroValue){PYRO_VALUE_NULL, {.i64 = 0}};
-}
+    // Converts a C pointer (which must be a pointer to a PyroObject) to a Pyro value.
+    static inline PyroValue pyro_obj(void* value) {
+        assert(((uintptr_t)value & ~PYRO_NAN_BOX_PAYLOAD_MASK) == 0);
+        return (PyroValue){PYRO_NAN_BOX_TAG(PYRO_VALUE_OBJ) | (uint64_t)(uintptr_t)value};
+    }
+
+    // Creates a Pyro tombstone value.
+    static inline PyroValue pyro_tombstone(void) {
+        return (PyroValue){PYRO_NAN_BOX_TAG(PYRO_VALUE_TOMBSTONE)};
+    }
+
+    // Creates a Pyro null value.
+    static inline PyroValue pyro_null(void) {
+        return (PyroValue){PYRO_NAN_BOX_TAG(PYRO_VALUE_NULL)};
+    }
+
+    // Returns the value's [PyroValueType].
+    static inline PyroValueType pyro_nan_box_type(PyroValue value) {
+        if ((value.bits & PYRO_NAN_BOX_QNAN) != PYRO_NAN_BOX_QNAN) {
+            return PYRO_VALUE_F64;
+        }
+        if (value.bits & PYRO_NAN_BOX_SIGN_BIT) {
+            return PYRO_VALUE_I64;
+        }
+        return (PyroValueType)((value.bits & PYRO_NAN_BOX_TAG_MASK) >> PYRO_NAN_BOX_TAG_SHIFT);
+    }
+
+    // Unboxes a float.
+    static inline double pyro_nan_box_f64(PyroValue value) {
+        double result;
+        memcpy(&result, &value.bits, sizeof(double));
+        return result;
+    }
 
-// Macros for checking the type of a PyroValue instance.
-#define PYRO_IS_BOOL(value)              ((value).type == PYRO_VALUE_BOOL)
-#define PYRO_IS_NULL(value)              ((value).type == PYRO_VALUE_NULL)
-#define PYRO_IS_I64(value)               ((value).type == PYRO_VALUE_I64)
-#define PYRO_IS_F64(value)               ((value).type == PYRO_VALUE_F64)
-#define PYRO_IS_OBJ(value)               ((value).type == PYRO_VALUE_OBJ)
-#define PYRO_IS_TOMBSTONE(value)         ((value).type == PYRO_VALUE_TOMBSTONE)
-#define PYRO_IS_RUNE(value)              ((value).type == PYRO_VALUE_RUNE)
+    // Returns true if the value has the specified non-numeric type.
+    #define PYRO_NAN_BOX_HAS_TAG(value, type) \
+        (((value).bits & (PYRO_NAN_BOX_SIGN_BIT | PYRO_NAN_BOX_QNAN | PYRO_NAN_BOX_TAG_MASK)) == PYRO_NAN_BOX_TAG(type))
+
+    // Returns the value's type as a [PyroValueType].
+    #define PYRO_TYPE_OF(value)              pyro_nan_box_type(value)
+
+    // Macros for checking the type of a PyroValue instance.
+    #define PYRO_IS_BOOL(value)              PYRO_NAN_BOX_HAS_TAG(value, PYRO_VALUE_BOOL)
+    #define PYRO_IS_NULL(value)              PYRO_NAN_BOX_HAS_TAG(value, PYRO_VALUE_NULL)
+    #define PYRO_IS_I64(value)               (((value).bits & PYRO_NAN_BOX_I64_TAG) == PYRO_NAN_BOX_I64_TAG)
+    #define PYRO_IS_F64(value)               (((value).bits & PYRO_NAN_BOX_QNAN) != PYRO_NAN_BOX_QNAN)
+    #define PYRO_IS_OBJ(value)               PYRO_NAN_BOX_HAS_TAG(value, PYRO_VALUE_OBJ)
+    #define PYRO_IS_TOMBSTONE(value)         PYRO_NAN_BOX_HAS_TAG(value, PYRO_VALUE_TOMBSTONE)
+    #define PYRO_IS_RUNE(value)              PYRO_NAN_BOX_HAS_TAG(value, PYRO_VALUE_RUNE)
+
+    // Macros for extracting C values from PyroValue instances.
+    #define PYRO_AS_BOOL(value)              ((bool)((value).bits & 1))
+    #define PYRO_AS_I64(value)               ((int64_t)((value).bits << 14) >> 14)
+    #define PYRO_AS_F64(value)               pyro_nan_box_f64(value)
+    #define PYRO_AS_RUNE(value)              ((uint32_t)(value).bits)
+    #define PYRO_AS_OBJ(value)               ((PyroObject*)(uintptr_t)((value).bits & PYRO_NAN_BOX_PAYLOAD_MASK))
+#else
+    // The range of integers that can be stored in a Pyro value.
+    #define PYRO_I64_MAX INT64_MAX
+    #define PYRO_I64_MIN INT64_MIN
+
+    // Converts a C boolean to a Pyro value.
+    static inline PyroValue pyro_bool(bool value) {
+        return (PyroValue){PYRO_VALUE_BOOL, {.boolean = value}};
+    }
+
+    // Converts a C integer to a Pyro value.
+    static inline PyroValue pyro_i64(int64_t value) {
+        return (PyroValue){PYRO_VALUE_I64, {.i64 = value}};
+    }
+
+    // Converts a C double to a Pyro value.
+    static inline PyroValue pyro_f64(double value) {
+        return (PyroValue){PYRO_VALUE_F64, {.f64 = value}};
+    }
+
+    // Converts a C integer to a Pyro value.
+    static inline PyroValue pyro_rune(uint32_t value) {
+        return (PyroValue){PYRO_VALUE_RUNE, {.u32 = value}};
+    }
+
+    // Converts a C pointer (which must be a pointer to a PyroObject) to a Pyro value.
+    static inline PyroValue pyro_obj(void* value) {
+        return (PyroValue){PYRO_VALUE_OBJ, {.obj = (PyroObject*)value}};
+    }
+
+    // Creates a Pyro tombstone value.
+    static inline PyroValue pyro_tombstone(void) {
+        return (PyroValue){PYRO_VALUE_TOMBSTONE, {.i64 = 0}};
+    }
+
+    // Creates a Pyro null value.
+    static inline PyroValue pyro_null(void) {
+        return (PyroValue){PYRO_VALUE_NULL, {.i64 = 0}};
+    }
+
+    // Returns the value's type as a [PyroValueType].
+    #define PYRO_TYPE_OF(value)              ((value).type)
+
+    // Macros for checking the type of a PyroValue instance.
+    #define PYRO_IS_BOOL(value)              ((value).type == PYRO_VALUE_BOOL)
+    #define PYRO_IS_NULL(value)              ((value).type == PYRO_VALUE_NULL)
+    #define PYRO_IS_I64(value)               ((value).type == PYRO_VALUE_I64)
+    #define PYRO_IS_F64(value)               ((value).type == PYRO_VALUE_F64)
+    #define PYRO_IS_OBJ(value)               ((value).type == PYRO_VALUE_OBJ)
+    #define PYRO_IS_TOMBSTONE(value)         ((value).type == PYRO_VALUE_TOMBSTONE)
+    #define PYRO_IS_RUNE(value)              ((value).type == PYRO_VALUE_RUNE)
+
+    // Macros for extracting C values from PyroValue instances.
+    #define PYRO_AS_BOOL(value)              ((value).as.boolean)
+    #define PYRO_AS_I64(value)               ((value).as.i64)
+    #define PYRO_AS_F64(value)               ((value).as.f64)
+    #define PYRO_AS_RUNE(value)              ((value).as.u32)
+    #define PYRO_AS_OBJ(value)               ((value).as.obj)
+#endif
 
 // Macros for checking if a PyroValue instance is an object of a specific type.
 #define PYRO_IS_STR(value)               pyro_is_obj_of_type(value, PYRO_OBJECT_STR)
@@ -132,7 +268,7 @@ static inline PyroValue pyro_null(void) {
 #define PYRO_IS_ENUM_MEMBER(value)       pyro_is_obj_of_type(value, PYRO_OBJECT_ENUM_MEMBER)
 
 // Macros for extracting object pointers from PyroValue instances.
-#define PYRO_AS_OBJ(value)               ((value).as.obj)
+// Strings can be ropes or slices -- see PyroStr_flatten() before reading a string's bytes.
 #define PYRO_AS_STR(value)               ((PyroStr*)PYRO_AS_OBJ(value))
 #define PYRO_AS_PYRO_FN(value)           ((PyroFn*)PYRO_AS_OBJ(value))
 #define PYRO_AS_CLOSURE(value)           ((PyroClosure*)PYRO_AS_OBJ(value))
@@ -176,13 +312,13 @@ bool pyro_compare_eq_strict(PyroValue a, PyroValue b);
 
 // Returns true if the value is truthy.
 static inline bool pyro_is_truthy(PyroValue value) {
-    switch (value.type) {
+    switch (PYRO_TYPE_OF(value)) {
         case PYRO_VALUE_BOOL:
-            return value.as.boolean;
+            return PYRO_AS_BOOL(value);
         case PYRO_VALUE_NULL:
             return false;
         case PYRO_VALUE_OBJ:
-            return value.as.obj->type != PYRO_OBJECT_ERR;
+            return PYRO_AS_OBJ(value)->type != PYRO_OBJECT_ERR;
         default:
             return true;
     }
@@ -6,13 +6,34 @@
 //   executed.
 // - [fp] is the frame pointer -- it points to slot zero on the value stack for the function
 //   call.
+// - [reg_ip] is NULL if the frame is running stack bytecode. If the frame is running register
+//   code, it points to the next register instruction to be executed.
 typedef struct {
     PyroClosure* closure;
     uint8_t* ip;
     PyroValue* fp;
     size_t with_stack_count_on_entry;
+    PyroRegInstruction* reg_ip;
 } PyroCallFrame;
 
+// An entry in the VM's global method cache. An entry is valid only if its [layout_id] matches the
+// current layout ID of the receiver's class. A valid entry implies that the class is still alive
+// and its method maps are unchanged, so [name] and [method] are still alive too.
+typedef struct {
+    uint64_t layout_id;
+    PyroStr* name;
+    bool is_pub;
+    PyroValue method;
+} PyroMethodCacheEntry;
+
+// The phases of an incremental garbage collection cycle. While a cycle is in progress, each
+// safepoint that would have triggered a collection runs a single slice of marking or sweeping.
+typedef enum {
+    PYRO_GC_IDLE,
+    PYRO_GC_MARKING,
+    PYRO_GC_SWEEPING,
+} PyroGCPhase;
+
 struct PyroVM {
     // Class objects for builtin types.
     PyroClass* class_str;
@@ -100,12 +121,19 @@ struct PyroVM {
     // Interned string pool.
     PyroStrPool string_pool;
 
+    // Seed for the string hash function. This is fixed when the VM is created as every string's
+    // hash depends on it.
+    uint64_t string_hash_seed;
+
+    // Size-class pools for small allocations.
+    PyroPoolAllocator pool_allocator;
+
+    // Pages holding every heap-allocated object.
+    PyroObjectHeap object_heap;
+
     // Linked list of open upvalues pointing to variables still on the stack.
     PyroUpvalue* open_upvalues;
 
-    // Linked list of all heap-allocated objects.
-    PyroObject* objects;
-
     // Canned objects.
     PyroStr* empty_string;
     PyroErr* empty_error;
@@ -208,6 +236,39 @@ struct PyroVM {
     // threshold.
     size_t next_gc_threshold;
 
+    // If the generational garbage collector is enabled, a collection triggered when
+    // [bytes_allocated] exceeds this threshold will be a full collection.
+    size_t next_full_gc_threshold;
+
+    // The remembered set for the generational garbage collector -- old objects that may hold
+    // references to young objects.
+    PyroObject** remembered_set;
+    size_t remembered_set_count;
+    size_t remembered_set_capacity;
+
+    // This flag is set if the write barrier can't grow the remembered set or the grey stack. It
+    // forces the next collection to be a full, non-incremental collection, and an incremental
+    // cycle in progress to redo its marking.
+    bool write_barrier_overflow;
+
+    // This flag is true while the garbage collector is running a minor collection.
+    bool gc_is_minor;
+
+    // The current phase of the incremental garbage collector.
+    PyroGCPhase gc_phase;
+
+    // The number of collections the garbage collector has run.
+    size_t gc_count;
+
+    // The number of threads used to mark the heap during a full collection.
+    size_t gc_mark_threads;
+
+    // The pool of worker threads used for parallel marking. Created on first use.
+    struct PyroMarkPool* gc_mark_pool;
+
+    // This flag is true while the heap is being marked in parallel.
+    bool gc_is_parallel;
+
     // This flag starts off false. It gets toggled to true if an attempt to allocate memory
     // fails.
     bool memory_allocation_failed;
@@ -227,8 +288,25 @@ struct PyroVM {
 
     // Prints an execution trace for debugging.
     bool trace_execution;
+
+    // If true, imported modules are loaded from and saved to the bytecode cache.
+    bool use_bytecode_cache;
+
+    // The last layout ID assigned to a class or module -- see pyro_new_layout_id().
+    uint64_t last_layout_id;
+
+    // Global cache for instance-method lookups -- see pyro_get_method().
+    PyroMethodCacheEntry method_cache[PYRO_METHOD_CACHE_SIZE];
 };
 
+// Returns a new layout ID. Classes and modules are assigned a new layout ID whenever a field,
+// method, or member is added. Inline caches store the layout ID they were filled against so
+// assigning a new ID invalidates them. IDs are never reused so a cache can't be fooled by a new
+// class or module being allocated at the address of a freed one.
+static inline uint64_t pyro_new_layout_id(PyroVM* vm) {
+    return ++vm->last_layout_id;
+}
+
 // Reallocates the stack.
 bool pyro_reallocate_stack(PyroVM* vm);
 
@@ -12,12 +12,12 @@ void pyro_load_stdlib_module_constants(PyroVM* vm, PyroMod* module) {
     pyro_define_pub_member(vm, module, "i8_max", pyro_i64(INT8_MAX));
     pyro_define_pub_member(vm, module, "i16_max", pyro_i64(INT16_MAX));
     pyro_define_pub_member(vm, module, "i32_max", pyro_i64(INT32_MAX));
-    pyro_define_pub_member(vm, module, "i64_max", pyro_i64(INT64_MAX));
+    pyro_define_pub_member(vm, module, "i64_max", pyro_i64(PYRO_I64_MAX));
 
     pyro_define_pub_member(vm, module, "i8_min", pyro_i64(INT8_MIN));
     pyro_define_pub_member(vm, module, "i16_min", pyro_i64(INT16_MIN));
     pyro_define_pub_member(vm, module, "i32_min", pyro_i64(INT32_MIN));
-    pyro_define_pub_member(vm, module, "i64_min", pyro_i64(INT64_MIN));
+    pyro_define_pub_member(vm, module, "i64_min", pyro_i64(PYRO_I64_MIN));
 
     pyro_define_pub_member(vm, module, "u8_max", pyro_i64(UINT8_MAX));
     pyro_define_pub_member(vm, module, "u16_max", pyro_i64(UINT16_MAX));
@@ -6,7 +6,12 @@ static PyroValue fn_exists(PyroVM* vm, size_t arg_count, PyroValue* args) {
         pyro_panic(vm, "exists(): invalid argument [path], expected a string");
         return pyro_null();
     }
-    return pyro_bool(pyro_exists(PYRO_AS_STR(args[0])->bytes));
+
+    PyroStr* path = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(path, vm)) {
+        return pyro_null();
+    }
+    return pyro_bool(pyro_exists(path->bytes));
 }
 
 
@@ -15,7 +20,12 @@ static PyroValue fn_is_file(PyroVM* vm, size_t arg_count, PyroValue* args) {
         pyro_panic(vm, "is_file(): invalid argument [path], expected a string");
         return pyro_null();
     }
-    return pyro_bool(pyro_is_file(PYRO_AS_STR(args[0])->bytes));
+
+    PyroStr* path = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(path, vm)) {
+        return pyro_null();
+    }
+    return pyro_bool(pyro_is_file(path->bytes));
 }
 
 
@@ -24,7 +34,12 @@ static PyroValue fn_is_dir(PyroVM* vm, size_t arg_count, PyroValue* args) {
         pyro_panic(vm, "is_dir(): invalid argument [path], expected a string");
         return pyro_null();
     }
-    return pyro_bool(pyro_is_dir(PYRO_AS_STR(args[0])->bytes));
+
+    PyroStr* path = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(path, vm)) {
+        return pyro_null();
+    }
+    return pyro_bool(pyro_is_dir(path->bytes));
 }
 
 
@@ -33,7 +48,12 @@ static PyroValue fn_is_symlink(PyroVM* vm, size_t arg_count, PyroValue* args) {
         pyro_panic(vm, "is_symlink(): invalid argument [path], expected a string");
         return pyro_null();
     }
-    return pyro_bool(pyro_is_symlink(PYRO_AS_STR(args[0])->bytes));
+
+    PyroStr* path = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(path, vm)) {
+        return pyro_null();
+    }
+    return pyro_bool(pyro_is_symlink(path->bytes));
 }
 
 
@@ -44,6 +64,9 @@ static PyroValue fn_dirname(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     PyroStr* path = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(path, vm)) {
+        return pyro_null();
+    }
     size_t dirname_length = pyro_dirname(path->bytes);
 
     PyroStr* result = PyroStr_copy(path->bytes, dirname_length, false, vm);
@@ -63,6 +86,9 @@ static PyroValue fn_basename(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     PyroStr* path = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(path, vm)) {
+        return pyro_null();
+    }
     const char* basename_ptr = pyro_basename(path->bytes);
 
     PyroStr* result = PyroStr_COPY(basename_ptr);
@@ -96,6 +122,9 @@ static PyroValue fn_join(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
     for (size_t i = 0; i < arg_count; i++) {
         PyroStr* arg = PYRO_AS_STR(args[i]);
+        if (!PyroStr_view(arg, vm)) {
+            return pyro_null();
+        }
         if (arg->count == 0) {
             continue;
         }
@@ -152,7 +181,12 @@ static PyroValue fn_listdir(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    PyroVec* vec = pyro_listdir(vm, PYRO_AS_STR(args[0])->bytes);
+    PyroStr* path = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(path, vm)) {
+        return pyro_null();
+    }
+
+    PyroVec* vec = pyro_listdir(vm, path->bytes);
     if (vm->halt_flag) {
         return pyro_null();
     }
@@ -168,6 +202,9 @@ static PyroValue fn_realpath(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     PyroStr* path = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(path, vm)) {
+        return pyro_null();
+    }
 
     char* real_path = pyro_realpath(path->bytes);
     if (!real_path) {
@@ -194,6 +231,9 @@ static PyroValue fn_chdir(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     PyroStr* path = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(path, vm)) {
+        return pyro_null();
+    }
     if (!pyro_chdir(path->bytes)) {
         pyro_panic(vm, "chdir(): failed to change the current working directory to '%s'", path->bytes);
         return pyro_null();
@@ -210,6 +250,9 @@ static PyroValue fn_normpath(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     PyroStr* path = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(path, vm)) {
+        return pyro_null();
+    }
     const char* src = path->bytes;
     size_t len = path->count;
 
@@ -396,6 +439,412 @@ static PyroValue fn_abspath(PyroVM* vm, size_t arg_count, PyroValue* args) {
 }
 
 
+/* ------------ */
+/*  MappedFile  */
+/* ------------ */
+
+
+// Field indexes for MappedFile instances.
+enum {
+    MAPPED_FILE_MAPPING,
+    MAPPED_FILE_LINES_CLASS,
+};
+
+
+// Field indexes for the iterator instances returned by MappedFile:lines().
+enum {
+    MAPPED_LINES_MAPPING,
+    MAPPED_LINES_NEXT_INDEX,
+};
+
+
+typedef struct {
+    const char* bytes; // NULL if the file is empty or the mapping has been closed.
+    size_t count;
+    bool is_closed;
+} Mapping;
+
+
+static void free_mapping(PyroVM* vm, void* pointer) {
+    Mapping* mapping = pointer;
+    pyro_munmap((void*)mapping->bytes, mapping->count);
+    free(mapping);
+    vm->bytes_allocated -= sizeof(Mapping);
+}
+
+
+// Returns the receiver's mapping. Panics and returns NULL if the mapping has been closed.
+static Mapping* get_mapping(PyroVM* vm, PyroValue receiver, const char* err_prefix) {
+    PyroInstance* instance = PYRO_AS_INSTANCE(receiver);
+    Mapping* mapping = PYRO_AS_RESOURCE_POINTER(instance->fields[MAPPED_FILE_MAPPING])->pointer;
+    if (mapping->is_closed) {
+        pyro_panic(vm, "%s: file is closed", err_prefix);
+        return NULL;
+    }
+    return mapping;
+}
+
+
+static PyroValue mapped_file_init(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    PyroInstance* instance = PYRO_AS_INSTANCE(args[-1]);
+
+    if (!PYRO_IS_STR(args[0])) {
+        pyro_panic(vm, "mmap(): invalid argument [path], expected a string");
+        return pyro_null();
+    }
+    PyroStr* path = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(path, vm)) {
+        return pyro_null();
+    }
+
+    Mapping* mapping = malloc(sizeof(Mapping));
+    if (!mapping) {
+        pyro_panic(vm, "mmap(): out of memory");
+        return pyro_null();
+    }
+
+    void* addr;
+    size_t length;
+    if (!pyro_mmap_file(path->bytes, &addr, &length)) {
+        free(mapping);
+        pyro_panic(vm, "mmap(): unable to map file '%s'", path->bytes);
+        return pyro_null();
+    }
+
+    mapping->bytes = addr;
+    mapping->count = length;
+    mapping->is_closed = false;
+    vm->bytes_allocated += sizeof(Mapping);
+
+    PyroResourcePointer* rp = PyroResourcePointer_new(mapping, free_mapping, vm);
+    if (!rp) {
+        free_mapping(vm, mapping);
+        pyro_panic(vm, "mmap(): out of memory");
+        return pyro_null();
+    }
+
+    instance->fields[MAPPED_FILE_MAPPING] = pyro_obj(rp);
+    return pyro_obj(instance);
+}
+
+
+static PyroValue mapped_file_close(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    PyroInstance* instance = PYRO_AS_INSTANCE(args[-1]);
+    Mapping* mapping = PYRO_AS_RESOURCE_POINTER(instance->fields[MAPPED_FILE_MAPPING])->pointer;
+
+    if (!mapping->is_closed) {
+        pyro_munmap((void*)mapping->bytes, mapping->count);
+        mapping->bytes = NULL;
+        mapping->count = 0;
+        mapping->is_closed = true;
+    }
+
+    return pyro_null();
+}
+
+
+static PyroValue mapped_file_count(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    Mapping* mapping = get_mapping(vm, args[-1], "count()");
+    if (!mapping) {
+        return pyro_null();
+    }
+    return pyro_i64((int64_t)mapping->count);
+}
+
+
+static PyroValue mapped_file_byte(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    Mapping* mapping = get_mapping(vm, args[-1], "byte()");
+    if (!mapping) {
+        return pyro_null();
+    }
+
+    if (!PYRO_IS_I64(args[0])) {
+        pyro_panic(vm,
+            "byte(): invalid argument [index], expected i64, got %s",
+            pyro_get_type_name(vm, args[0])->bytes
+        );
+        return pyro_null();
+    }
+
+    int64_t index = PYRO_AS_I64(args[0]);
+    if (index < 0) {
+        index += mapping->count;
+    }
+
+    if (index < 0 || (size_t)index >= mapping->count) {
+        pyro_panic(vm, "byte(): index %" PRId64 " is out of range", index);
+        return pyro_null();
+    }
+
+    return pyro_i64((uint8_t)mapping->bytes[index]);
+}
+
+
+static PyroValue mapped_file_slice(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    Mapping* mapping = get_mapping(vm, args[-1], "slice()");
+    if (!mapping) {
+        return pyro_null();
+    }
+
+    if (!(arg_count == 1 || arg_count == 2)) {
+        pyro_panic(vm, "slice(): expected 1 or 2 arguments, found %zu", arg_count);
+        return pyro_null();
+    }
+
+    if (!PYRO_IS_I64(args[0])) {
+        pyro_panic(vm, "slice(): invalid argument [start_index], expected an integer");
+        return pyro_null();
+    }
+
+    size_t start_index;
+    if (PYRO_AS_I64(args[0]) >= 0 && (size_t)PYRO_AS_I64(args[0]) <= mapping->count) {
+        start_index = (size_t)PYRO_AS_I64(args[0]);
+    } else if (PYRO_AS_I64(args[0]) < 0 && (size_t)(PYRO_AS_I64(args[0]) * -1) <= mapping->count) {
+        start_index = (size_t)((int64_t)mapping->count + PYRO_AS_I64(args[0]));
+    } else {
+        pyro_panic(vm, "slice(): invalid argument [start_index], out of range");
+        return pyro_null();
+    }
+
+    size_t length = mapping->count - start_index;
+    if (arg_count == 2) {
+        if (!PYRO_IS_I64(args[1])) {
+            pyro_panic(vm, "slice(): invalid argument [length], expected an integer");
+            return pyro_null();
+        }
+        if (PYRO_AS_I64(args[1]) < 0) {
+            pyro_panic(vm, "slice(): invalid argument [length], expected a positive integer");
+            return pyro_null();
+        }
+        if (start_index + (size_t)PYRO_AS_I64(args[1]) > mapping->count) {
+            pyro_panic(vm, "slice(): invalid argument [length], out of range");
+            return pyro_null();
+        }
+        length = (size_t)PYRO_AS_I64(args[1]);
+    }
+
+    PyroBuf* buf = PyroBuf_new_with_capacity(length, vm);
+    if (!buf) {
+        pyro_panic(vm, "slice(): out of memory");
+        return pyro_null();
+    }
+
+    if (length > 0) {
+        memcpy(buf->bytes, &mapping->bytes[start_index], length);
+        buf->count = length;
+    }
+
+    return pyro_obj(buf);
+}
+
+
+// Extracts the bytes of a string or buffer argument. Panics and returns false if [arg] is
+// neither or if memory can't be allocated to flatten a rope.
+static bool get_target_bytes(PyroVM* vm, PyroValue arg, const char** bytes, size_t* count, const char* err_prefix) {
+    if (PYRO_IS_STR(arg)) {
+        PyroStr* string = PYRO_AS_STR(arg);
+        if (!PyroStr_view(string, vm)) {
+            return false;
+        }
+        *bytes = string->bytes;
+        *count = string->count;
+        return true;
+    }
+
+    if (PYRO_IS_BUF(arg)) {
+        *bytes = (const char*)PYRO_AS_BUF(arg)->bytes;
+        *count = PYRO_AS_BUF(arg)->count;
+        return true;
+    }
+
+    pyro_panic(vm,
+        "%s: invalid argument [target], expected a string or buffer, found %s",
+        err_prefix,
+        pyro_get_type_name(vm, arg)->bytes
+    );
+    return false;
+}
+
+
+static PyroValue mapped_file_match(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    Mapping* mapping = get_mapping(vm, args[-1], "match()");
+    if (!mapping) {
+        return pyro_null();
+    }
+
+    const char* target;
+    size_t target_count;
+    if (!get_target_bytes(vm, args[0], &target, &target_count, "match()")) {
+        return pyro_null();
+    }
+
+    if (!PYRO_IS_I64(args[1]) || PYRO_AS_I64(args[1]) < 0) {
+        pyro_panic(vm, "match(): invalid argument [index], expected a positive integer");
+        return pyro_null();
+    }
+    size_t index = (size_t)PYRO_AS_I64(args[1]);
+
+    if (index > mapping->count || target_count > mapping->count - index) {
+        return pyro_bool(false);
+    }
+
+    // Returns 0 if [target_count] is zero.
+    return pyro_bool(memcmp(&mapping->bytes[index], target, target_count) == 0);
+}
+
+
+static PyroValue mapped_file_index_of(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    Mapping* mapping = get_mapping(vm, args[-1], "index_of()");
+    if (!mapping) {
+        return pyro_null();
+    }
+
+    if (!(arg_count == 1 || arg_count == 2)) {
+        pyro_panic(vm, "index_of(): expected 1 or 2 arguments, found %zu", arg_count);
+        return pyro_null();
+    }
+
+    const char* target;
+    size_t target_count;
+    if (!get_target_bytes(vm, args[0], &target, &target_count, "index_of()")) {
+        return pyro_null();
+    }
+
+    size_t start_index = 0;
+    if (arg_count == 2) {
+        if (!PYRO_IS_I64(args[1])) {
+            pyro_panic(vm, "index_of(): invalid argument [start_index], expected an integer");
+            return pyro_null();
+        }
+        if (PYRO_AS_I64(args[1]) < 0 || (size_t)PYRO_AS_I64(args[1]) > mapping->count) {
+            pyro_panic(vm, "index_of(): invalid argument [start_index], integer is out of range");
+            return pyro_null();
+        }
+        start_index = (size_t)PYRO_AS_I64(args[1]);
+    }
+
+    if (target_count == 0) {
+        return pyro_i64((int64_t)start_index);
+    }
+
+    if (!mapping->bytes) {
+        return pyro_obj(vm->empty_error);
+    }
+
+    const char* match = pyro_find_bytes(
+        mapping->bytes + start_index,
+        mapping->count - start_index,
+        target,
+        target_count
+    );
+
+    if (match) {
+        return pyro_i64((int64_t)(match - mapping->bytes));
+    }
+
+    return pyro_obj(vm->empty_error);
+}
+
+
+static PyroValue mapped_file_contains(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    Mapping* mapping = get_mapping(vm, args[-1], "contains()");
+    if (!mapping) {
+        return pyro_null();
+    }
+
+    const char* target;
+    size_t target_count;
+    if (!get_target_bytes(vm, args[0], &target, &target_count, "contains()")) {
+        return pyro_null();
+    }
+
+    if (target_count == 0) {
+        return pyro_bool(true);
+    }
+
+    if (!mapping->bytes) {
+        return pyro_bool(false);
+    }
+
+    return pyro_bool(pyro_find_bytes(mapping->bytes, mapping->count, target, target_count) != NULL);
+}
+
+
+static PyroValue mapped_file_lines(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    PyroInstance* instance = PYRO_AS_INSTANCE(args[-1]);
+    if (!get_mapping(vm, args[-1], "lines()")) {
+        return pyro_null();
+    }
+
+    PyroClass* lines_class = PYRO_AS_CLASS(instance->fields[MAPPED_FILE_LINES_CLASS]);
+    PyroInstance* lines = PyroInstance_new(vm, lines_class);
+    if (!lines) {
+        pyro_panic(vm, "lines(): out of memory");
+        return pyro_null();
+    }
+
+    // The iterator shares the resource pointer so the file stays mapped while it's alive.
+    lines->fields[MAPPED_LINES_MAPPING] = instance->fields[MAPPED_FILE_MAPPING];
+    lines->fields[MAPPED_LINES_NEXT_INDEX] = pyro_i64(0);
+
+    if (!pyro_push(vm, pyro_obj(lines))) {
+        return pyro_null();
+    }
+
+    PyroIter* iter = PyroIter_new((PyroObject*)lines, PYRO_ITER_GENERIC, vm);
+    if (!iter) {
+        pyro_panic(vm, "lines(): out of memory");
+        return pyro_null();
+    }
+
+    pyro_pop(vm);
+    return pyro_obj(iter);
+}
+
+
+// Returns the next line, stripping the terminating LF or CRLF. Each line is copied out of the
+// mapping into a new string.
+static PyroValue mapped_lines_next(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    PyroInstance* lines = PYRO_AS_INSTANCE(args[-1]);
+    Mapping* mapping = PYRO_AS_RESOURCE_POINTER(lines->fields[MAPPED_LINES_MAPPING])->pointer;
+    size_t next_index = (size_t)PYRO_AS_I64(lines->fields[MAPPED_LINES_NEXT_INDEX]);
+
+    if (mapping->is_closed) {
+        pyro_panic(vm, "lines(): file is closed");
+        return pyro_obj(vm->empty_error);
+    }
+
+    if (next_index >= mapping->count) {
+        return pyro_obj(vm->empty_error);
+    }
+
+    const char* line_start = mapping->bytes + next_index;
+    size_t count = mapping->count - next_index;
+
+    // The count includes the newline, if there is one.
+    const char* newline = memchr(line_start, '\n', count);
+    if (newline) {
+        count = (size_t)(newline - line_start) + 1;
+    }
+    lines->fields[MAPPED_LINES_NEXT_INDEX] = pyro_i64((int64_t)(next_index + count));
+
+    if (count >= 1 && line_start[count - 1] == '\n') {
+        count -= 1;
+        if (count >= 1 && line_start[count - 1] == '\r') {
+            count -= 1;
+        }
+    }
+
+    PyroStr* line = PyroStr_copy_lazy(line_start, count, vm);
+    if (!line) {
+        pyro_panic(vm, "lines(): out of memory");
+        return pyro_obj(vm->empty_error);
+    }
+
+    return pyro_obj(line);
+}
+
+
 void pyro_load_stdlib_module_fs(PyroVM* vm, PyroMod* module) {
     pyro_define_pub_member_fn(vm, module, "exists", fn_exists, 1);
     pyro_define_pub_member_fn(vm, module, "is_file", fn_is_file, 1);
@@ -410,4 +859,39 @@ void pyro_load_stdlib_module_fs(PyroVM* vm, PyroMod* module) {
     pyro_define_pub_member_fn(vm, module, "getcwd", fn_getcwd, 0);
     pyro_define_pub_member_fn(vm, module, "normpath", fn_normpath, 1);
     pyro_define_pub_member_fn(vm, module, "abspath", fn_abspath, 1);
+
+    PyroClass* lines_class = PyroClass_new(vm);
+    if (!lines_class) {
+        return;
+    }
+
+    lines_class->name = PyroStr_COPY("MappedFileLines");
+    pyro_define_pri_field(vm, lines_class, "mapping", pyro_null());
+    pyro_define_pri_field(vm, lines_class, "next_index", pyro_i64(0));
+    pyro_define_pri_method(vm, lines_class, "$next", mapped_lines_next, 0);
+
+    PyroClass* mapped_file_class = PyroClass_new(vm);
+    if (!mapped_file_class) {
+        return;
+    }
+
+    mapped_file_class->name = PyroStr_COPY("MappedFile");
+    pyro_define_pub_member(vm, module, "MappedFile", pyro_obj(mapped_file_class));
+    pyro_define_pub_member(vm, module, "mmap", pyro_obj(mapped_file_class));
+
+    pyro_define_pri_field(vm, mapped_file_class, "mapping", pyro_null());
+    pyro_define_pri_field(vm, mapped_file_class, "lines_class", pyro_obj(lines_class));
+
+    pyro_define_pri_method(vm, mapped_file_class, "$init", mapped_file_init, 1);
+    pyro_define_pri_method(vm, mapped_file_class, "$get", mapped_file_byte, 1);
+    pyro_define_pri_method(vm, mapped_file_class, "$contains", mapped_file_contains, 1);
+    pyro_define_pri_method(vm, mapped_file_class, "$exit", mapped_file_close, 0);
+    pyro_define_pub_method(vm, mapped_file_class, "byte", mapped_file_byte, 1);
+    pyro_define_pub_method(vm, mapped_file_class, "close", mapped_file_close, 0);
+    pyro_define_pub_method(vm, mapped_file_class, "contains", mapped_file_contains, 1);
+    pyro_define_pub_method(vm, mapped_file_class, "count", mapped_file_count, 0);
+    pyro_define_pub_method(vm, mapped_file_class, "index_of", mapped_file_index_of, -1);
+    pyro_define_pub_method(vm, mapped_file_class, "lines", mapped_file_lines, 0);
+    pyro_define_pub_method(vm, mapped_file_class, "match", mapped_file_match, 2);
+    pyro_define_pub_method(vm, mapped_file_class, "slice", mapped_file_slice, -1);
 }
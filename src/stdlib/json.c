@@ -0,0 +1,1657 @@
+#include "../includes/pyro.h"
+
+
+// Arrays and objects nested more deeply than this are rejected by both the parser and the
+// marshaller. This stops deeply nested input from exhausting the C stack.
+#define MAX_NESTING_DEPTH 512
+
+// The Reader class reads file input in chunks of this size.
+#define READER_CHUNK_SIZE (64 * 1024)
+
+
+/* -------- */
+/*  Parser  */
+/* -------- */
+
+
+typedef struct {
+    PyroVM* vm;
+    const char* bytes;
+    size_t count;
+    size_t index;
+
+    // If [bytes] belongs to a string, unescaped string values can share its bytes. May be NULL.
+    PyroStr* source;
+
+    bool strict;
+    const char* err_prefix;
+    size_t depth;
+
+    // The position of [bytes] in the input stream, added to the byte indexes in error messages.
+    // This is only non-zero for a Reader parsing a value from its file buffer.
+    size_t base_offset;
+} Parser;
+
+
+static PyroValue parse_value(Parser* p);
+
+
+static inline bool is_json_whitespace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+
+static inline bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+
+// Skips whitespace and, unless the parser is in strict mode, single-line comments. Panics and
+// returns false if the parser finds a comment in strict mode.
+static bool skip_whitespace(Parser* p) {
+    while (true) {
+        while (p->index < p->count && is_json_whitespace(p->bytes[p->index])) {
+            p->index++;
+        }
+
+        if (p->index + 1 < p->count && p->bytes[p->index] == '/' && p->bytes[p->index + 1] == '/') {
+            if (p->strict) {
+                pyro_panic(p->vm,
+                    "%s: invalid comment at byte index %zu, comments are not allowed in strict mode",
+                    p->err_prefix,
+                    p->base_offset + p->index
+                );
+                return false;
+            }
+
+            const char* newline = memchr(p->bytes + p->index, '\n', p->count - p->index);
+            p->index = newline ? (size_t)(newline - p->bytes) + 1 : p->count;
+            continue;
+        }
+
+        return true;
+    }
+}
+
+
+static void panic_unexpected_character(Parser* p) {
+    uint8_t c = (uint8_t)p->bytes[p->index];
+
+    if (c >= 32 && c < 127) {
+        pyro_panic(p->vm,
+            "%s: unexpected character '%c' at byte index %zu",
+            p->err_prefix,
+            c,
+            p->base_offset + p->index
+        );
+    } else {
+        pyro_panic(p->vm,
+            "%s: unexpected character '\\x%02X' at byte index %zu",
+            p->err_prefix,
+            c,
+            p->base_offset + p->index
+        );
+    }
+}
+
+
+// Powers of ten that can be represented exactly as doubles.
+static const double exact_powers_of_ten[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+
+// Parses the float literal bytes[start:end]. The literal has already been validated. If the
+// decimal significand fits in 53 bits and the exponent is small, the result is computed exactly
+// with a single multiplication or division (Clinger's fast path). Otherwise we fall back on
+// strtod().
+static PyroValue parse_float(Parser* p, size_t start, size_t end, bool is_negative) {
+    uint64_t significand = 0;
+    size_t significant_digits = 0;
+    int64_t exponent = 0;
+    size_t i = start;
+
+    while (i < end && is_digit(p->bytes[i])) {
+        if (significand == 0 && p->bytes[i] == '0') {
+            i++;
+            continue;
+        }
+        if (significant_digits < 19) {
+            significand = significand * 10 + (uint64_t)(p->bytes[i] - '0');
+        } else {
+            exponent++;
+        }
+        significant_digits++;
+        i++;
+    }
+
+    if (i < end && p->bytes[i] == '.') {
+        i++;
+        while (i < end && is_digit(p->bytes[i])) {
+            if (significand == 0 && p->bytes[i] == '0') {
+                exponent--;
+                i++;
+                continue;
+            }
+            if (significant_digits < 19) {
+                significand = significand * 10 + (uint64_t)(p->bytes[i] - '0');
+                exponent--;
+            }
+            significant_digits++;
+            i++;
+        }
+    }
+
+    if (i < end && (p->bytes[i] == 'e' || p->bytes[i] == 'E')) {
+        i++;
+        bool exponent_is_negative = false;
+        if (p->bytes[i] == '+' || p->bytes[i] == '-') {
+            exponent_is_negative = p->bytes[i] == '-';
+            i++;
+        }
+        int64_t explicit_exponent = 0;
+        while (i < end) {
+            if (explicit_exponent < 100000) {
+                explicit_exponent = explicit_exponent * 10 + (p->bytes[i] - '0');
+            }
+            i++;
+        }
+        exponent += exponent_is_negative ? -explicit_exponent : explicit_exponent;
+    }
+
+    if (significant_digits <= 19 && significand <= ((uint64_t)1 << 53) && exponent >= -22 && exponent <= 22) {
+        double value = (double)significand;
+        if (exponent < 0) {
+            value /= exact_powers_of_ten[-exponent];
+        } else {
+            value *= exact_powers_of_ten[exponent];
+        }
+        return pyro_f64(is_negative ? -value : value);
+    }
+
+    size_t length = end - start;
+    char stack_buffer[64];
+    char* literal = stack_buffer;
+
+    if (length >= sizeof(stack_buffer)) {
+        literal = PYRO_ALLOCATE_ARRAY(p->vm, char, length + 1);
+        if (!literal) {
+            pyro_panic(p->vm, "%s: out of memory", p->err_prefix);
+            return pyro_null();
+        }
+    }
+
+    memcpy(literal, p->bytes + start, length);
+    literal[length] = '\0';
+    double value = strtod(literal, NULL);
+
+    if (literal != stack_buffer) {
+        PYRO_FREE_ARRAY(p->vm, char, literal, length + 1);
+    }
+
+    if (isinf(value)) {
+        pyro_panic(p->vm,
+            "%s: invalid number: '%s%.*s' is out of range at byte index %zu",
+            p->err_prefix,
+            is_negative ? "-" : "",
+            (int)length,
+            p->bytes + start,
+            p->base_offset + start
+        );
+        return pyro_null();
+    }
+
+    return pyro_f64(is_negative ? -value : value);
+}
+
+
+// Parses a number starting at the current index. A leading '-' has already been consumed. Like
+// the original lexer, we scan the longest run of number characters first, then validate it.
+static PyroValue parse_number(Parser* p, bool is_negative) {
+    size_t start = p->index;
+    bool is_float = false;
+
+    while (p->index < p->count) {
+        char c = p->bytes[p->index];
+        if (is_digit(c) || c == '+' || c == '-') {
+            p->index++;
+        } else if (c == '.' || c == 'e' || c == 'E') {
+            is_float = true;
+            p->index++;
+        } else {
+            break;
+        }
+    }
+
+    size_t end = p->index;
+
+    // Validate the literal: digits ['.' digits] [('e'|'E') ['+'|'-'] digits].
+    size_t i = start;
+    while (i < end && is_digit(p->bytes[i])) {
+        i++;
+    }
+    bool is_valid = i > start;
+
+    if (is_valid && i < end && p->bytes[i] == '.') {
+        i++;
+        while (i < end && is_digit(p->bytes[i])) {
+            i++;
+        }
+    }
+
+    if (is_valid && i < end && (p->bytes[i] == 'e' || p->bytes[i] == 'E')) {
+        i++;
+        if (i < end && (p->bytes[i] == '+' || p->bytes[i] == '-')) {
+            i++;
+        }
+        size_t exponent_start = i;
+        while (i < end && is_digit(p->bytes[i])) {
+            i++;
+        }
+        is_valid = i > exponent_start;
+    }
+
+    if (!is_valid || i != end) {
+        pyro_panic(p->vm,
+            "%s: invalid number '%.*s' at byte index %zu",
+            p->err_prefix,
+            (int)(end - start),
+            p->bytes + start,
+            p->base_offset + start
+        );
+        return pyro_null();
+    }
+
+    if (is_float) {
+        return parse_float(p, start, end, is_negative);
+    }
+
+    // The magnitude of PYRO_I64_MIN is one larger than PYRO_I64_MAX.
+    uint64_t limit = is_negative ? (uint64_t)PYRO_I64_MAX + 1 : (uint64_t)PYRO_I64_MAX;
+    uint64_t value = 0;
+
+    for (i = start; i < end; i++) {
+        uint64_t digit = (uint64_t)(p->bytes[i] - '0');
+        if (value > (limit - digit) / 10) {
+            pyro_panic(p->vm,
+                "%s: invalid number: unable to parse '%s%.*s' as i64",
+                p->err_prefix,
+                is_negative ? "-" : "",
+                (int)(end - start),
+                p->bytes + start
+            );
+            return pyro_null();
+        }
+        value = value * 10 + digit;
+    }
+
+    if (is_negative) {
+        return pyro_i64((int64_t)(0 - value));
+    }
+
+    return pyro_i64((int64_t)value);
+}
+
+
+static bool read_hex4(const char* bytes, uint32_t* out) {
+    uint32_t value = 0;
+
+    for (size_t i = 0; i < 4; i++) {
+        char c = bytes[i];
+        if (c >= '0' && c <= '9') {
+            value = value * 16 + (uint32_t)(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            value = value * 16 + (uint32_t)(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+            value = value * 16 + (uint32_t)(c - 'A' + 10);
+        } else {
+            return false;
+        }
+    }
+
+    *out = value;
+    return true;
+}
+
+
+// Decodes the escaped string content bytes[start:end] into a new string. Unrecognised escape
+// sequences are copied through verbatim. Panics and returns NULL if an error occurs.
+static PyroStr* decode_escaped_string(Parser* p, size_t start, size_t end, bool intern) {
+    // The decoded string is never longer than its escaped source.
+    size_t capacity = end - start + 1;
+    char* array = PYRO_ALLOCATE_ARRAY(p->vm, char, capacity);
+    if (!array) {
+        pyro_panic(p->vm, "%s: out of memory", p->err_prefix);
+        return NULL;
+    }
+
+    size_t count = 0;
+    size_t i = start;
+
+    while (i < end) {
+        const char* next_backslash = memchr(p->bytes + i, '\\', end - i);
+        size_t run_end = next_backslash ? (size_t)(next_backslash - p->bytes) : end;
+
+        memcpy(array + count, p->bytes + i, run_end - i);
+        count += run_end - i;
+        i = run_end;
+
+        if (i == end) {
+            break;
+        }
+
+        char c = (i + 1 < end) ? p->bytes[i + 1] : '\0';
+
+        switch (c) {
+            case '"': array[count++] = '"'; i += 2; continue;
+            case '\\': array[count++] = '\\'; i += 2; continue;
+            case '/': array[count++] = '/'; i += 2; continue;
+            case 'b': array[count++] = '\b'; i += 2; continue;
+            case 'f': array[count++] = '\f'; i += 2; continue;
+            case 'n': array[count++] = '\n'; i += 2; continue;
+            case 'r': array[count++] = '\r'; i += 2; continue;
+            case 't': array[count++] = '\t'; i += 2; continue;
+            case 'u': break;
+            default: array[count++] = '\\'; i += 1; continue;
+        }
+
+        uint32_t codepoint;
+        if (end - i < 6 || !read_hex4(p->bytes + i + 2, &codepoint)) {
+            PYRO_FREE_ARRAY(p->vm, char, array, capacity);
+            pyro_panic(p->vm,
+                "%s: invalid unicode escape sequence at byte index %zu, requires 4 hex digits",
+                p->err_prefix,
+                p->base_offset + i
+            );
+            return NULL;
+        }
+        i += 6;
+
+        // Combine a UTF-16 surrogate pair into a single codepoint.
+        uint32_t low_surrogate;
+        if (codepoint >= 0xD800 && codepoint <= 0xDBFF && end - i >= 6 && p->bytes[i] == '\\'
+            && p->bytes[i + 1] == 'u' && read_hex4(p->bytes + i + 2, &low_surrogate)
+            && low_surrogate >= 0xDC00 && low_surrogate <= 0xDFFF) {
+            codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low_surrogate - 0xDC00);
+            i += 6;
+        }
+
+        count += pyro_write_utf8_codepoint(codepoint, (uint8_t*)array + count);
+    }
+
+    array[count] = '\0';
+
+    PyroStr* string;
+    if (intern) {
+        string = PyroStr_take(array, count, capacity, p->vm);
+    } else {
+        string = PyroStr_take_lazy(array, count, capacity, p->vm);
+    }
+
+    if (!string) {
+        PYRO_FREE_ARRAY(p->vm, char, array, capacity);
+        pyro_panic(p->vm, "%s: out of memory", p->err_prefix);
+        return NULL;
+    }
+
+    return string;
+}
+
+
+// Parses a string starting at the opening quote. Keys are interned -- repeated keys resolve to
+// a single string object without allocating. Unescaped values share the source string's bytes
+// where possible.
+static PyroStr* parse_string(Parser* p, bool is_key) {
+    size_t start = p->index + 1;
+    size_t i = start;
+    bool has_escapes = false;
+
+    while (true) {
+        while (i < p->count && p->bytes[i] != '"' && p->bytes[i] != '\\') {
+            i++;
+        }
+
+        if (i >= p->count) {
+            pyro_panic(p->vm,
+                "%s: unterminated string: opened at byte index %zu",
+                p->err_prefix,
+                p->base_offset + start - 1
+            );
+            return NULL;
+        }
+
+        if (p->bytes[i] == '"') {
+            break;
+        }
+
+        has_escapes = true;
+        i += 2;
+    }
+
+    p->index = i + 1;
+    size_t count = i - start;
+
+    if (has_escapes) {
+        return decode_escaped_string(p, start, i, is_key);
+    }
+
+    PyroStr* string;
+    if (is_key) {
+        string = PyroStr_copy(p->bytes + start, count, false, p->vm);
+    } else if (p->source) {
+        string = PyroStr_slice(p->source, (size_t)(p->bytes + start - p->source->bytes), count, p->vm);
+    } else {
+        string = PyroStr_copy_lazy(p->bytes + start, count, p->vm);
+    }
+
+    if (!string) {
+        pyro_panic(p->vm, "%s: out of memory", p->err_prefix);
+        return NULL;
+    }
+
+    return string;
+}
+
+
+static bool match_literal(Parser* p, const char* literal, size_t length) {
+    if (p->count - p->index >= length && memcmp(p->bytes + p->index, literal, length) == 0) {
+        p->index += length;
+        return true;
+    }
+    return false;
+}
+
+
+static PyroValue parse_array(Parser* p) {
+    if (++p->depth > MAX_NESTING_DEPTH) {
+        pyro_panic(p->vm, "%s: nesting depth exceeds the limit of %d", p->err_prefix, MAX_NESTING_DEPTH);
+        return pyro_null();
+    }
+
+    PyroVec* vec = PyroVec_new(p->vm);
+    if (!vec) {
+        pyro_panic(p->vm, "%s: out of memory", p->err_prefix);
+        return pyro_null();
+    }
+
+    // Skip the opening '['.
+    p->index++;
+
+    while (true) {
+        if (!skip_whitespace(p)) {
+            return pyro_null();
+        }
+
+        if (p->index < p->count && p->bytes[p->index] == ']') {
+            break;
+        }
+
+        PyroValue value = parse_value(p);
+        if (p->vm->halt_flag) {
+            return pyro_null();
+        }
+
+        if (!PyroVec_append(vec, value, p->vm)) {
+            pyro_panic(p->vm, "%s: out of memory", p->err_prefix);
+            return pyro_null();
+        }
+
+        if (!skip_whitespace(p)) {
+            return pyro_null();
+        }
+
+        if (p->index < p->count && p->bytes[p->index] == ',') {
+            p->index++;
+            if (p->strict) {
+                if (!skip_whitespace(p)) {
+                    return pyro_null();
+                }
+                if (p->index < p->count && p->bytes[p->index] == ']') {
+                    pyro_panic(p->vm,
+                        "%s: invalid comma, trailing commas in arrays are not allowed in strict mode",
+                        p->err_prefix
+                    );
+                    return pyro_null();
+                }
+            }
+            continue;
+        }
+
+        break;
+    }
+
+    if (p->index >= p->count || p->bytes[p->index] != ']') {
+        pyro_panic(p->vm, "%s: expected ']' after array at byte index %zu", p->err_prefix, p->base_offset + p->index);
+        return pyro_null();
+    }
+
+    p->index++;
+    p->depth--;
+    return pyro_obj(vec);
+}
+
+
+static PyroValue parse_object(Parser* p) {
+    if (++p->depth > MAX_NESTING_DEPTH) {
+        pyro_panic(p->vm, "%s: nesting depth exceeds the limit of %d", p->err_prefix, MAX_NESTING_DEPTH);
+        return pyro_null();
+    }
+
+    PyroMap* map = PyroMap_new(p->vm);
+    if (!map) {
+        pyro_panic(p->vm, "%s: out of memory", p->err_prefix);
+        return pyro_null();
+    }
+
+    // Skip the opening '{'.
+    p->index++;
+
+    while (true) {
+        if (!skip_whitespace(p)) {
+            return pyro_null();
+        }
+
+        if (p->index < p->count && p->bytes[p->index] == '}') {
+            break;
+        }
+
+        if (p->index >= p->count || p->bytes[p->index] != '"') {
+            pyro_panic(p->vm, "%s: invalid key at byte index %zu, expected a string", p->err_prefix, p->base_offset + p->index);
+            return pyro_null();
+        }
+
+        PyroStr* key = parse_string(p, true);
+        if (!key) {
+            return pyro_null();
+        }
+
+        if (!skip_whitespace(p)) {
+            return pyro_null();
+        }
+
+        if (p->index >= p->count || p->bytes[p->index] != ':') {
+            pyro_panic(p->vm, "%s: expected ':' after key at byte index %zu", p->err_prefix, p->base_offset + p->index);
+            return pyro_null();
+        }
+        p->index++;
+
+        PyroValue value = parse_value(p);
+        if (p->vm->halt_flag) {
+            return pyro_null();
+        }
+
+        if (PyroMap_set(map, pyro_obj(key), value, p->vm) == 0) {
+            pyro_panic(p->vm, "%s: out of memory", p->err_prefix);
+            return pyro_null();
+        }
+
+        if (!skip_whitespace(p)) {
+            return pyro_null();
+        }
+
+        if (p->index < p->count && p->bytes[p->index] == ',') {
+            p->index++;
+            if (p->strict) {
+                if (!skip_whitespace(p)) {
+                    return pyro_null();
+                }
+                if (p->index < p->count && p->bytes[p->index] == '}') {
+                    pyro_panic(p->vm,
+                        "%s: invalid comma, trailing commas in objects are not allowed in strict mode",
+                        p->err_prefix
+                    );
+                    return pyro_null();
+                }
+            }
+            continue;
+        }
+
+        break;
+    }
+
+    if (p->index >= p->count || p->bytes[p->index] != '}') {
+        pyro_panic(p->vm, "%s: expected '}' after object at byte index %zu", p->err_prefix, p->base_offset + p->index);
+        return pyro_null();
+    }
+
+    p->index++;
+    p->depth--;
+    return pyro_obj(map);
+}
+
+
+// Parses the next value. Check [vm->halt_flag] on return.
+static PyroValue parse_value(Parser* p) {
+    if (!skip_whitespace(p)) {
+        return pyro_null();
+    }
+
+    if (p->index >= p->count) {
+        pyro_panic(p->vm, "%s: expected a JSON value, found end of input", p->err_prefix);
+        return pyro_null();
+    }
+
+    switch (p->bytes[p->index]) {
+        case '{':
+            return parse_object(p);
+
+        case '[':
+            return parse_array(p);
+
+        case '"': {
+            PyroStr* string = parse_string(p, false);
+            return string ? pyro_obj(string) : pyro_null();
+        }
+
+        case '-':
+            p->index++;
+            if (!skip_whitespace(p)) {
+                return pyro_null();
+            }
+            if (p->index >= p->count) {
+                pyro_panic(p->vm, "%s: expected a number after '-', found end of input", p->err_prefix);
+                return pyro_null();
+            }
+            if (!is_digit(p->bytes[p->index])) {
+                pyro_panic(p->vm, "%s: expected a number after '-' at byte index %zu", p->err_prefix, p->base_offset + p->index);
+                return pyro_null();
+            }
+            return parse_number(p, true);
+
+        case '0': case '1': case '2': case '3': case '4':
+        case '5': case '6': case '7': case '8': case '9':
+            return parse_number(p, false);
+
+        case 't':
+            if (match_literal(p, "true", 4)) {
+                return pyro_bool(true);
+            }
+            break;
+
+        case 'f':
+            if (match_literal(p, "false", 5)) {
+                return pyro_bool(false);
+            }
+            break;
+
+        case 'n':
+            if (match_literal(p, "null", 4)) {
+                return pyro_null();
+            }
+            break;
+    }
+
+    panic_unexpected_character(p);
+    return pyro_null();
+}
+
+
+// Parses a complete JSON document. Check [vm->halt_flag] on return.
+static PyroValue parse_document(Parser* p) {
+    PyroValue value = parse_value(p);
+    if (p->vm->halt_flag) {
+        return pyro_null();
+    }
+
+    if (!skip_whitespace(p)) {
+        return pyro_null();
+    }
+
+    if (p->index < p->count) {
+        pyro_panic(p->vm, "%s: trailing content at byte index %zu", p->err_prefix, p->base_offset + p->index);
+        return pyro_null();
+    }
+
+    return value;
+}
+
+
+// Initializes a parser for [input], which must be a string or a buffer. Panics and returns false
+// if memory can't be allocated to flatten a rope.
+static bool init_parser(Parser* p, PyroVM* vm, PyroValue input, bool strict, const char* err_prefix) {
+    p->vm = vm;
+    p->index = 0;
+    p->strict = strict;
+    p->err_prefix = err_prefix;
+    p->depth = 0;
+    p->base_offset = 0;
+
+    if (PYRO_IS_STR(input)) {
+        PyroStr* string = PYRO_AS_STR(input);
+        if (!PyroStr_view(string, vm)) {
+            return false;
+        }
+        p->bytes = string->bytes;
+        p->count = string->count;
+        p->source = string;
+    } else {
+        PyroBuf* buf = PYRO_AS_BUF(input);
+        p->bytes = (const char*)buf->bytes;
+        p->count = buf->count;
+        p->source = NULL;
+    }
+
+    return true;
+}
+
+
+static PyroValue fn_from_json(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    if (arg_count == 0 || arg_count > 2) {
+        pyro_panic(vm, "from_json(): expected 1 or 2 arguments, found %zu", arg_count);
+        return pyro_null();
+    }
+
+    if (!PYRO_IS_STR(args[0]) && !PYRO_IS_BUF(args[0])) {
+        pyro_panic(vm,
+            "from_json(): invalid argument [json], expected a string or buffer, found %s",
+            pyro_get_type_name(vm, args[0])->bytes
+        );
+        return pyro_null();
+    }
+
+    bool strict = arg_count == 2 && pyro_is_truthy(args[1]);
+
+    Parser parser;
+    if (!init_parser(&parser, vm, args[0], strict, "from_json()")) {
+        return pyro_null();
+    }
+
+    if (parser.count == 0) {
+        pyro_panic(vm, "from_json(): invalid argument [json], empty input");
+        return pyro_null();
+    }
+
+    return parse_document(&parser);
+}
+
+
+/* ---------- */
+/*  Marshall  */
+/* ---------- */
+
+
+typedef struct {
+    PyroVM* vm;
+    PyroBuf* buf;
+    const char* err_prefix;
+
+    // If [pretty] is true, nested values are written on separate lines, indented by [indent]
+    // spaces per level.
+    bool pretty;
+    size_t indent;
+
+    // The chain of containers currently being marshalled, used to detect cycles.
+    PyroObject* containers[MAX_NESTING_DEPTH];
+    size_t depth;
+
+    // Lazily initialized with the string "$json".
+    PyroStr* json_method_name;
+} Writer;
+
+
+static bool write_value(Writer* w, PyroValue value, size_t current_indent);
+
+
+static bool write_bytes(Writer* w, const char* bytes, size_t count) {
+    if (!PyroBuf_append_bytes(w->buf, count, (uint8_t*)bytes, w->vm)) {
+        pyro_panic(w->vm, "%s: out of memory", w->err_prefix);
+        return false;
+    }
+    return true;
+}
+
+
+static bool write_byte(Writer* w, char byte) {
+    if (!PyroBuf_append_byte(w->buf, (uint8_t)byte, w->vm)) {
+        pyro_panic(w->vm, "%s: out of memory", w->err_prefix);
+        return false;
+    }
+    return true;
+}
+
+
+static bool write_newline_and_indent(Writer* w, size_t indent) {
+    if (w->buf->count + indent + 1 > w->buf->capacity) {
+        size_t new_capacity = pyro_grow_capacity(w->buf->capacity);
+        if (new_capacity < w->buf->count + indent + 1) {
+            new_capacity = w->buf->count + indent + 1;
+        }
+        if (!PyroBuf_resize_capacity(w->buf, new_capacity, w->vm)) {
+            pyro_panic(w->vm, "%s: out of memory", w->err_prefix);
+            return false;
+        }
+    }
+
+    w->buf->bytes[w->buf->count++] = '\n';
+    memset(w->buf->bytes + w->buf->count, ' ', indent);
+    w->buf->count += indent;
+    return true;
+}
+
+
+// Writes a quoted string. Quotes and control characters are escaped; for compatibility with
+// earlier versions of this module, backslashes are written as-is.
+static bool write_string(Writer* w, PyroStr* string) {
+    if (!PyroStr_view(string, w->vm)) {
+        return false;
+    }
+
+    if (!write_byte(w, '"')) {
+        return false;
+    }
+
+    const char* bytes = string->bytes;
+    size_t count = string->count;
+    size_t run_start = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        uint8_t c = (uint8_t)bytes[i];
+        if (c >= 32 && c != '"') {
+            continue;
+        }
+
+        if (!write_bytes(w, bytes + run_start, i - run_start)) {
+            return false;
+        }
+        run_start = i + 1;
+
+        bool ok;
+        switch (c) {
+            case '"': ok = write_bytes(w, "\\\"", 2); break;
+            case '\b': ok = write_bytes(w, "\\b", 2); break;
+            case '\f': ok = write_bytes(w, "\\f", 2); break;
+            case '\n': ok = write_bytes(w, "\\n", 2); break;
+            case '\r': ok = write_bytes(w, "\\r", 2); break;
+            case '\t': ok = write_bytes(w, "\\t", 2); break;
+            default: ok = PyroBuf_write_f(w->buf, w->vm, "\\u%04X", c) >= 0; break;
+        }
+
+        if (!ok) {
+            if (!w->vm->halt_flag) {
+                pyro_panic(w->vm, "%s: out of memory", w->err_prefix);
+            }
+            return false;
+        }
+    }
+
+    if (!write_bytes(w, bytes + run_start, count - run_start)) {
+        return false;
+    }
+
+    return write_byte(w, '"');
+}
+
+
+static bool push_container(Writer* w, PyroObject* container, const char* description) {
+    for (size_t i = 0; i < w->depth; i++) {
+        if (w->containers[i] == container) {
+            pyro_panic(w->vm, "%s: cycle detected: %s contains itself", w->err_prefix, description);
+            return false;
+        }
+    }
+
+    if (w->depth == MAX_NESTING_DEPTH) {
+        pyro_panic(w->vm, "%s: nesting depth exceeds the limit of %d", w->err_prefix, MAX_NESTING_DEPTH);
+        return false;
+    }
+
+    w->containers[w->depth++] = container;
+    return true;
+}
+
+
+// Writes a separator before the element at [index] of a container.
+static bool write_separator(Writer* w, size_t index, size_t indent) {
+    if (index > 0 && !write_byte(w, ',')) {
+        return false;
+    }
+
+    if (w->pretty) {
+        return write_newline_and_indent(w, indent);
+    }
+
+    return index == 0 || write_byte(w, ' ');
+}
+
+
+static bool write_closing_bracket(Writer* w, char bracket, size_t current_indent) {
+    if (w->pretty && !write_newline_and_indent(w, current_indent)) {
+        return false;
+    }
+    return write_byte(w, bracket);
+}
+
+
+static bool write_values(Writer* w, PyroValue* values, size_t count, size_t current_indent) {
+    if (count == 0) {
+        return write_bytes(w, "[]", 2);
+    }
+
+    if (!write_byte(w, '[')) {
+        return false;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (!write_separator(w, i, current_indent + w->indent)) {
+            return false;
+        }
+        if (!write_value(w, values[i], current_indent + w->indent)) {
+            return false;
+        }
+    }
+
+    return write_closing_bracket(w, ']', current_indent);
+}
+
+
+static bool write_map(Writer* w, PyroMap* map, size_t current_indent) {
+    PyroVM* vm = w->vm;
+
+    if (map->live_entry_count == 0) {
+        return write_bytes(w, "{}", 2);
+    }
+
+    if (!write_byte(w, '{')) {
+        return false;
+    }
+
+    size_t entry_index = 0;
+
+    for (size_t i = 0; i < map->entry_array_count; i++) {
+        PyroMapEntry* entry = &map->entry_array[i];
+        if (PYRO_IS_TOMBSTONE(entry->key)) {
+            continue;
+        }
+
+        if (!PYRO_IS_STR(entry->key)) {
+            pyro_panic(vm,
+                "%s: invalid key type %s in map, expected a string",
+                w->err_prefix,
+                pyro_get_type_name(vm, entry->key)->bytes
+            );
+            return false;
+        }
+
+        if (!write_separator(w, entry_index++, current_indent + w->indent)) {
+            return false;
+        }
+        if (!write_string(w, PYRO_AS_STR(entry->key))) {
+            return false;
+        }
+        if (!write_bytes(w, ": ", 2)) {
+            return false;
+        }
+
+        // Writing the value can call into Pyro code which can modify the map, so we reload the
+        // entry from the array.
+        if (!write_value(w, map->entry_array[i].value, current_indent + w->indent)) {
+            return false;
+        }
+    }
+
+    return write_closing_bracket(w, '}', current_indent);
+}
+
+
+// Writes an instance's public fields as a JSON object.
+static bool write_instance_fields(Writer* w, PyroInstance* instance, size_t current_indent) {
+    PyroMap* field_indexes = instance->obj.class->pub_field_indexes;
+
+    if (field_indexes->live_entry_count == 0) {
+        return write_bytes(w, "{}", 2);
+    }
+
+    if (!write_byte(w, '{')) {
+        return false;
+    }
+
+    size_t entry_index = 0;
+
+    for (size_t i = 0; i < field_indexes->entry_array_count; i++) {
+        PyroMapEntry* entry = &field_indexes->entry_array[i];
+        if (PYRO_IS_TOMBSTONE(entry->key)) {
+            continue;
+        }
+
+        if (!write_separator(w, entry_index++, current_indent + w->indent)) {
+            return false;
+        }
+        if (!write_string(w, PYRO_AS_STR(entry->key))) {
+            return false;
+        }
+        if (!write_bytes(w, ": ", 2)) {
+            return false;
+        }
+
+        PyroValue field_value = instance->fields[PYRO_AS_I64(entry->value)];
+        if (!write_value(w, field_value, current_indent + w->indent)) {
+            return false;
+        }
+    }
+
+    return write_closing_bracket(w, '}', current_indent);
+}
+
+
+// Writes the JSON returned by the object's :$json() method. In pretty mode, the JSON is parsed
+// and reformatted so it nests correctly.
+static bool write_json_from_method(Writer* w, PyroValue value, PyroValue method, size_t current_indent) {
+    PyroVM* vm = w->vm;
+
+    if (!pyro_push(vm, value)) {
+        return false;
+    }
+
+    PyroValue json = pyro_call_method(vm, method, 0);
+    if (vm->halt_flag) {
+        return false;
+    }
+
+    if (!PYRO_IS_STR(json)) {
+        pyro_panic(vm,
+            "%s: method $json() on object of type %s returned invalid type %s, expected a string",
+            w->err_prefix,
+            pyro_get_type_name(vm, value)->bytes,
+            pyro_get_type_name(vm, json)->bytes
+        );
+        return false;
+    }
+
+    if (!w->pretty) {
+        PyroStr* string = PYRO_AS_STR(json);
+        if (!PyroStr_view(string, vm)) {
+            return false;
+        }
+        return write_bytes(w, string->bytes, string->count);
+    }
+
+    char err_prefix[256];
+    snprintf(
+        err_prefix,
+        sizeof(err_prefix),
+        "%s: method $json() on object of type %s returned invalid JSON",
+        w->err_prefix,
+        pyro_get_type_name(vm, value)->bytes
+    );
+
+    if (!pyro_push(vm, json)) {
+        return false;
+    }
+
+    Parser parser;
+    if (!init_parser(&parser, vm, json, false, err_prefix)) {
+        return false;
+    }
+    PyroValue parsed_value = parse_document(&parser);
+    if (vm->halt_flag) {
+        return false;
+    }
+
+    if (!pyro_push(vm, parsed_value)) {
+        return false;
+    }
+
+    bool ok = write_value(w, parsed_value, current_indent);
+
+    pyro_pop(vm);
+    pyro_pop(vm);
+    return ok;
+}
+
+
+static bool write_value(Writer* w, PyroValue value, size_t current_indent) {
+    PyroVM* vm = w->vm;
+
+    if (PYRO_IS_STR(value)) {
+        return write_string(w, PYRO_AS_STR(value));
+    }
+
+    if (PYRO_IS_I64(value)) {
+        char digits[24];
+        int count = snprintf(digits, sizeof(digits), "%" PRId64, PYRO_AS_I64(value));
+        return write_bytes(w, digits, (size_t)count);
+    }
+
+    if (PYRO_IS_F64(value)) {
+        PyroStr* string = pyro_debugify_value(vm, value);
+        if (!string) {
+            return false;
+        }
+        return write_bytes(w, string->bytes, string->count);
+    }
+
+    if (PYRO_IS_BOOL(value)) {
+        return PYRO_AS_BOOL(value) ? write_bytes(w, "true", 4) : write_bytes(w, "false", 5);
+    }
+
+    if (PYRO_IS_NULL(value)) {
+        return write_bytes(w, "null", 4);
+    }
+
+    if (PYRO_IS_MAP(value)) {
+        if (!push_container(w, PYRO_AS_OBJ(value), "map")) {
+            return false;
+        }
+        bool ok = write_map(w, PYRO_AS_MAP(value), current_indent);
+        w->depth--;
+        return ok;
+    }
+
+    if (PYRO_IS_VEC(value)) {
+        if (!push_container(w, PYRO_AS_OBJ(value), "vector")) {
+            return false;
+        }
+        PyroVec* vec = PYRO_AS_VEC(value);
+        bool ok = write_values(w, vec->values, vec->count, current_indent);
+        w->depth--;
+        return ok;
+    }
+
+    if (PYRO_IS_TUP(value)) {
+        if (!push_container(w, PYRO_AS_OBJ(value), "tuple")) {
+            return false;
+        }
+        PyroTup* tup = PYRO_AS_TUP(value);
+        bool ok = write_values(w, tup->values, tup->count, current_indent);
+        w->depth--;
+        return ok;
+    }
+
+    if (!w->json_method_name) {
+        w->json_method_name = PyroStr_COPY("$json");
+        if (!w->json_method_name) {
+            pyro_panic(vm, "%s: out of memory", w->err_prefix);
+            return false;
+        }
+    }
+
+    PyroValue method = pyro_get_method(vm, value, w->json_method_name);
+    if (!PYRO_IS_NULL(method)) {
+        return write_json_from_method(w, value, method, current_indent);
+    }
+
+    if (PYRO_IS_INSTANCE(value)) {
+        if (!push_container(w, PYRO_AS_OBJ(value), "object")) {
+            return false;
+        }
+        bool ok = write_instance_fields(w, PYRO_AS_INSTANCE(value), current_indent);
+        w->depth--;
+        return ok;
+    }
+
+    PyroStr* type_name = pyro_get_type_name(vm, value);
+    PyroStr* debug_string = pyro_debugify_value(vm, value);
+    if (vm->halt_flag) {
+        return false;
+    }
+
+    pyro_panic(vm,
+        "%s: invalid input: type: %s, value: %s",
+        w->err_prefix,
+        type_name->bytes,
+        debug_string ? debug_string->bytes : "?"
+    );
+    return false;
+}
+
+
+// Marshalls [value] to a JSON string. Panics and returns NULL if an error occurs.
+static PyroStr* marshall(PyroVM* vm, PyroValue value, bool pretty, size_t indent, const char* err_prefix) {
+    // The writer holds pointers to objects that stay reachable from [value] or the VM stack.
+    Writer* w = malloc(sizeof(Writer));
+    if (!w) {
+        pyro_panic(vm, "%s: out of memory", err_prefix);
+        return NULL;
+    }
+
+    w->vm = vm;
+    w->err_prefix = err_prefix;
+    w->pretty = pretty;
+    w->indent = indent;
+    w->depth = 0;
+    w->json_method_name = NULL;
+
+    // The buffer needs to be on the stack as marshalling can call into Pyro code.
+    w->buf = PyroBuf_new(vm);
+    if (!w->buf || !pyro_push(vm, pyro_obj(w->buf))) {
+        if (!vm->halt_flag) {
+            pyro_panic(vm, "%s: out of memory", err_prefix);
+        }
+        free(w);
+        return NULL;
+    }
+
+    bool ok = write_value(w, value, 0);
+    PyroBuf* buf = w->buf;
+    free(w);
+
+    if (!ok) {
+        return NULL;
+    }
+
+    PyroStr* string = PyroBuf_to_str(buf, vm);
+    if (!string) {
+        pyro_panic(vm, "%s: out of memory", err_prefix);
+        return NULL;
+    }
+
+    pyro_pop(vm);
+    return string;
+}
+
+
+static PyroValue fn_to_json(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    if (arg_count == 0 || arg_count > 2) {
+        pyro_panic(vm, "to_json(): expected 1 or 2 arguments, found %zu", arg_count);
+        return pyro_null();
+    }
+
+    int64_t indent = 0;
+
+    if (arg_count == 2) {
+        if (!PYRO_IS_I64(args[1]) || PYRO_AS_I64(args[1]) < 0) {
+            pyro_panic(vm, "to_json(): invalid argument [indent], expected a non-negative integer");
+            return pyro_null();
+        }
+        indent = PYRO_AS_I64(args[1]);
+    }
+
+    PyroStr* json = marshall(vm, args[0], indent > 0, (size_t)indent, "to_json()");
+    return json ? pyro_obj(json) : pyro_null();
+}
+
+
+static PyroValue fn_format(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    if (arg_count == 0 || arg_count > 2) {
+        pyro_panic(vm, "format(): expected 1 or 2 arguments, found %zu", arg_count);
+        return pyro_null();
+    }
+
+    if (!PYRO_IS_STR(args[0]) && !PYRO_IS_BUF(args[0])) {
+        pyro_panic(vm,
+            "format(): invalid argument [json], expected a string or buffer, found %s",
+            pyro_get_type_name(vm, args[0])->bytes
+        );
+        return pyro_null();
+    }
+
+    int64_t indent = 2;
+
+    if (arg_count == 2) {
+        if (!PYRO_IS_I64(args[1]) || PYRO_AS_I64(args[1]) < 0) {
+            pyro_panic(vm, "format(): invalid argument [indent], expected a non-negative integer");
+            return pyro_null();
+        }
+        indent = PYRO_AS_I64(args[1]);
+    }
+
+    Parser parser;
+    if (!init_parser(&parser, vm, args[0], false, "format(): invalid argument [json]")) {
+        return pyro_null();
+    }
+
+    PyroValue value = parse_document(&parser);
+    if (vm->halt_flag) {
+        return pyro_null();
+    }
+
+    if (!pyro_push(vm, value)) {
+        return pyro_null();
+    }
+
+    PyroStr* json = marshall(vm, value, true, (size_t)indent, "format()");
+    if (!json) {
+        return pyro_null();
+    }
+
+    pyro_pop(vm);
+    return pyro_obj(json);
+}
+
+
+/* -------- */
+/*  Reader  */
+/* -------- */
+
+
+// Field indexes for Reader instances.
+enum {
+    READER_SOURCE,
+    READER_BUFFER,
+    READER_INDEX,
+    READER_STRICT,
+    READER_AT_EOF,
+    READER_BUFFER_OFFSET,
+};
+
+
+static PyroValue reader_init(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    PyroInstance* instance = PYRO_AS_INSTANCE(args[-1]);
+
+    if (arg_count == 0 || arg_count > 2) {
+        pyro_panic(vm, "Reader(): expected 1 or 2 arguments, found %zu", arg_count);
+        return pyro_null();
+    }
+
+    if (!PYRO_IS_FILE(args[0]) && !PYRO_IS_STR(args[0]) && !PYRO_IS_BUF(args[0])) {
+        pyro_panic(vm,
+            "Reader(): invalid argument [source], expected a file, string, or buffer, found %s",
+            pyro_get_type_name(vm, args[0])->bytes
+        );
+        return pyro_null();
+    }
+
+    if (PYRO_IS_FILE(args[0])) {
+        PyroBuf* buf = PyroBuf_new_with_capacity(READER_CHUNK_SIZE, vm);
+        if (!buf) {
+            pyro_panic(vm, "Reader(): out of memory");
+            return pyro_null();
+        }
+        instance->fields[READER_BUFFER] = pyro_obj(buf);
+    }
+
+    instance->fields[READER_SOURCE] = args[0];
+    instance->fields[READER_INDEX] = pyro_i64(0);
+    instance->fields[READER_STRICT] = pyro_bool(arg_count == 2 && pyro_is_truthy(args[1]));
+    instance->fields[READER_AT_EOF] = pyro_bool(false);
+    instance->fields[READER_BUFFER_OFFSET] = pyro_i64(0);
+
+    return pyro_obj(instance);
+}
+
+
+static PyroValue reader_iter(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    return args[-1];
+}
+
+
+// Discards the consumed bytes before [*start] and reads the next chunk of the file into the
+// buffer. Offsets into the buffer are shifted to match and the buffer's offset in the file is
+// advanced by the number of bytes discarded. Panics and returns false if an error occurs.
+static bool read_next_chunk(PyroVM* vm, PyroInstance* instance, size_t* start, size_t* pos) {
+    PyroFile* file = PYRO_AS_FILE(instance->fields[READER_SOURCE]);
+    PyroBuf* buf = PYRO_AS_BUF(instance->fields[READER_BUFFER]);
+
+    if (!file->stream) {
+        pyro_panic(vm, "$next(): unable to read from closed file");
+        return false;
+    }
+
+    if (*start > 0) {
+        memmove(buf->bytes, buf->bytes + *start, buf->count - *start);
+        buf->count -= *start;
+        *pos -= *start;
+        int64_t buffer_offset = PYRO_AS_I64(instance->fields[READER_BUFFER_OFFSET]);
+        instance->fields[READER_BUFFER_OFFSET] = pyro_i64(buffer_offset + (int64_t)*start);
+        *start = 0;
+    }
+
+    if (buf->capacity - buf->count < READER_CHUNK_SIZE) {
+        size_t new_capacity = buf->capacity * 2;
+        if (new_capacity < buf->count + READER_CHUNK_SIZE) {
+            new_capacity = buf->count + READER_CHUNK_SIZE;
+        }
+        if (!PyroBuf_resize_capacity(buf, new_capacity, vm)) {
+            pyro_panic(vm, "$next(): out of memory");
+            return false;
+        }
+    }
+
+    size_t num_bytes_read = fread(buf->bytes + buf->count, sizeof(uint8_t), READER_CHUNK_SIZE, file->stream);
+    buf->count += num_bytes_read;
+
+    if (num_bytes_read < READER_CHUNK_SIZE) {
+        if (ferror(file->stream)) {
+            pyro_panic(vm, "$next(): error reading file");
+            return false;
+        }
+        instance->fields[READER_AT_EOF] = pyro_bool(true);
+    }
+
+    return true;
+}
+
+
+// State for scanning the extent of a top-level value in a partially-read file. The scan can be
+// suspended at the end of the buffered input and resumed after reading the next chunk.
+typedef struct {
+    size_t depth;
+    bool in_string;
+    bool in_escape;
+    bool in_comment;
+} Scan;
+
+
+static inline bool is_scalar_delimiter(char c) {
+    return is_json_whitespace(c) || c == '{' || c == '}' || c == '[' || c == ']'
+        || c == '"' || c == ',' || c == ':' || c == '/';
+}
+
+
+// Advances [*pos] through the value starting at [start]. Returns true if the end of the value
+// has been found, in which case [*pos] is the index just past it. Returns false if the scan
+// reached the end of the buffered input.
+static bool scan_value(Scan* scan, const char* bytes, size_t count, size_t start, size_t* pos, bool at_eof) {
+    size_t i = *pos;
+
+    for (; i < count; i++) {
+        char c = bytes[i];
+
+        if (scan->in_comment) {
+            if (c == '\n') {
+                scan->in_comment = false;
+            }
+            continue;
+        }
+
+        if (scan->in_string) {
+            if (scan->in_escape) {
+                scan->in_escape = false;
+            } else if (c == '\\') {
+                scan->in_escape = true;
+            } else if (c == '"') {
+                scan->in_string = false;
+                if (scan->depth == 0) {
+                    *pos = i + 1;
+                    return true;
+                }
+            }
+            continue;
+        }
+
+        if (scan->depth == 0 && i > start) {
+            // We're in a top-level scalar.
+            if (is_scalar_delimiter(c)) {
+                *pos = i;
+                return true;
+            }
+            continue;
+        }
+
+        switch (c) {
+            case '"':
+                scan->in_string = true;
+                break;
+
+            case '{':
+            case '[':
+                scan->depth++;
+                break;
+
+            case '}':
+            case ']':
+                if (scan->depth > 0 && --scan->depth == 0) {
+                    *pos = i + 1;
+                    return true;
+                }
+                break;
+
+            case '/':
+                if (i + 1 == count && !at_eof) {
+                    // We need the next byte to tell if this starts a comment.
+                    *pos = i;
+                    return false;
+                }
+                if (scan->depth > 0 && i + 1 < count && bytes[i + 1] == '/') {
+                    scan->in_comment = true;
+                    i++;
+                }
+                break;
+        }
+    }
+
+    *pos = i;
+    return false;
+}
+
+
+// Returns the next top-level value from a file source.
+static PyroValue reader_next_from_file(PyroVM* vm, PyroInstance* instance) {
+    PyroBuf* buf = PYRO_AS_BUF(instance->fields[READER_BUFFER]);
+    bool strict = PYRO_AS_BOOL(instance->fields[READER_STRICT]);
+    size_t start = (size_t)PYRO_AS_I64(instance->fields[READER_INDEX]);
+    size_t pos = start;
+
+    // Skip whitespace and comments between values.
+    while (true) {
+        bool at_eof = PYRO_AS_BOOL(instance->fields[READER_AT_EOF]);
+
+        while (pos < buf->count && is_json_whitespace((char)buf->bytes[pos])) {
+            pos++;
+        }
+        start = pos;
+
+        if (pos == buf->count || (buf->bytes[pos] == '/' && pos + 1 == buf->count)) {
+            if (at_eof) {
+                break;
+            }
+            if (!read_next_chunk(vm, instance, &start, &pos)) {
+                return pyro_null();
+            }
+            continue;
+        }
+
+        if (buf->bytes[pos] == '/' && buf->bytes[pos + 1] == '/') {
+            if (strict) {
+                pyro_panic(vm, "$next(): invalid comment, comments are not allowed in strict mode");
+                return pyro_null();
+            }
+
+            uint8_t* newline = memchr(buf->bytes + pos, '\n', buf->count - pos);
+            while (!newline && !PYRO_AS_BOOL(instance->fields[READER_AT_EOF])) {
+                start = pos = buf->count;
+                if (!read_next_chunk(vm, instance, &start, &pos)) {
+                    return pyro_null();
+                }
+                newline = memchr(buf->bytes + pos, '\n', buf->count - pos);
+            }
+            pos = newline ? (size_t)(newline - buf->bytes) + 1 : buf->count;
+            continue;
+        }
+
+        break;
+    }
+
+    if (start == buf->count) {
+        instance->fields[READER_INDEX] = pyro_i64((int64_t)start);
+        return pyro_obj(vm->empty_error);
+    }
+
+    Scan scan = {0};
+
+    while (!scan_value(&scan, (const char*)buf->bytes, buf->count, start, &pos, PYRO_AS_BOOL(instance->fields[READER_AT_EOF]))) {
+        if (PYRO_AS_BOOL(instance->fields[READER_AT_EOF])) {
+            // The value is truncated. We let the parser report the error.
+            pos = buf->count;
+            break;
+        }
+        if (!read_next_chunk(vm, instance, &start, &pos)) {
+            return pyro_null();
+        }
+    }
+
+    Parser parser = {
+        .vm = vm,
+        .bytes = (const char*)buf->bytes + start,
+        .count = pos - start,
+        .index = 0,
+        .source = NULL,
+        .strict = strict,
+        .err_prefix = "$next()",
+        .depth = 0,
+        .base_offset = (size_t)PYRO_AS_I64(instance->fields[READER_BUFFER_OFFSET]) + start,
+    };
+
+    PyroValue value = parse_document(&parser);
+    if (vm->halt_flag) {
+        return pyro_null();
+    }
+
+    instance->fields[READER_INDEX] = pyro_i64((int64_t)pos);
+    return value;
+}
+
+
+// Returns the next top-level value from the source or an [err] if the source is exhausted.
+static PyroValue reader_next(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    PyroInstance* instance = PYRO_AS_INSTANCE(args[-1]);
+    PyroValue source = instance->fields[READER_SOURCE];
+
+    if (PYRO_IS_FILE(source)) {
+        return reader_next_from_file(vm, instance);
+    }
+
+    Parser parser;
+    if (!init_parser(&parser, vm, source, PYRO_AS_BOOL(instance->fields[READER_STRICT]), "$next()")) {
+        return pyro_null();
+    }
+
+    parser.index = (size_t)PYRO_AS_I64(instance->fields[READER_INDEX]);
+    if (parser.index > parser.count) {
+        parser.index = parser.count;
+    }
+
+    if (!skip_whitespace(&parser)) {
+        return pyro_null();
+    }
+
+    if (parser.index == parser.count) {
+        instance->fields[READER_INDEX] = pyro_i64((int64_t)parser.index);
+        return pyro_obj(vm->empty_error);
+    }
+
+    PyroValue value = parse_value(&parser);
+    if (vm->halt_flag) {
+        return pyro_null();
+    }
+
+    instance->fields[READER_INDEX] = pyro_i64((int64_t)parser.index);
+    return value;
+}
+
+
+void pyro_load_stdlib_module_json(PyroVM* vm, PyroMod* module) {
+    pyro_define_pub_member_fn(vm, module, "from_json", fn_from_json, -1);
+    pyro_define_pub_member_fn(vm, module, "to_json", fn_to_json, -1);
+    pyro_define_pub_member_fn(vm, module, "format", fn_format, -1);
+
+    PyroClass* reader_class = PyroClass_new(vm);
+    if (!reader_class) {
+        return;
+    }
+
+    reader_class->name = PyroStr_COPY("Reader");
+    pyro_define_pub_member(vm, module, "Reader", pyro_obj(reader_class));
+
+    pyro_define_pri_field(vm, reader_class, "source", pyro_null());
+    pyro_define_pri_field(vm, reader_class, "buffer", pyro_null());
+    pyro_define_pri_field(vm, reader_class, "index", pyro_i64(0));
+    pyro_define_pri_field(vm, reader_class, "strict", pyro_bool(false));
+    pyro_define_pri_field(vm, reader_class, "at_eof", pyro_bool(false));
+    pyro_define_pri_field(vm, reader_class, "buffer_offset", pyro_i64(0));
+
+    pyro_define_pri_method(vm, reader_class, "$init", reader_init, -1);
+    pyro_define_pri_method(vm, reader_class, "$iter", reader_iter, 0);
+    pyro_define_pri_method(vm, reader_class, "$next", reader_next, 0);
+}
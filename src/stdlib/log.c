@@ -91,7 +91,7 @@ static void write_msg(
     int64_t milliseconds = microseconds / 1000;
 
     struct tm tm;
-    if (show_utc.as.boolean) {
+    if (PYRO_AS_BOOL(show_utc)) {
         gmtime_r(&timestamp_now_seconds, &tm);
     } else {
         localtime_r(&timestamp_now_seconds, &tm);
@@ -119,28 +119,28 @@ static void write_msg(
         timestamp_str = timestamp_buf;
     }
 
-    if (show_microseconds.as.boolean) {
+    if (PYRO_AS_BOOL(show_microseconds)) {
         int result = fprintf(
             PYRO_AS_FILE(file)->stream,
             "[%5s]  %s.%06d%s  ",
             log_level_name,
             timestamp_str,
             (int)microseconds,
-            show_tz_offset.as.boolean ? tz_offset_str : ""
+            PYRO_AS_BOOL(show_tz_offset) ? tz_offset_str : ""
         );
 
         if (result < 0) {
             pyro_panic(vm, "%s: failed to write log message", err_prefix);
             return;
         }
-    } else if (show_milliseconds.as.boolean) {
+    } else if (PYRO_AS_BOOL(show_milliseconds)) {
         int result = fprintf(
             PYRO_AS_FILE(file)->stream,
             "[%5s]  %s.%03d%s  ",
             log_level_name,
             timestamp_str,
             (int)milliseconds,
-            show_tz_offset.as.boolean ? tz_offset_str : ""
+            PYRO_AS_BOOL(show_tz_offset) ? tz_offset_str : ""
         );
 
         if (result < 0) {
@@ -152,7 +152,7 @@ static void write_msg(
             "[%5s]  %s%s  ",
             log_level_name,
             timestamp_str,
-            show_tz_offset.as.boolean ? tz_offset_str : ""
+            PYRO_AS_BOOL(show_tz_offset) ? tz_offset_str : ""
         );
 
         if (result < 0) {
@@ -212,7 +212,7 @@ static PyroValue logger_debug(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
     if (PYRO_IS_ENUM_MEMBER(instance->fields[0])) {
         if (PYRO_AS_ENUM_MEMBER(instance->fields[0])->enum_type == PYRO_AS_ENUM_TYPE(instance->fields[6])) {
-            int64_t logging_level = PYRO_AS_ENUM_MEMBER(instance->fields[0])->value.as.i64;
+            int64_t logging_level = PYRO_AS_I64(PYRO_AS_ENUM_MEMBER(instance->fields[0])->value);
 
             if (PYRO_STD_LOG_LEVEL_DEBUG >= logging_level) {
                 write_msg(vm, "debug()", "DEBUG", instance->fields[1], instance->fields[2], instance->fields[3], instance->fields[4], instance->fields[5], arg_count, args);
@@ -232,7 +232,7 @@ static PyroValue logger_info(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
     if (PYRO_IS_ENUM_MEMBER(instance->fields[0])) {
         if (PYRO_AS_ENUM_MEMBER(instance->fields[0])->enum_type == PYRO_AS_ENUM_TYPE(instance->fields[6])) {
-            int64_t logging_level = PYRO_AS_ENUM_MEMBER(instance->fields[0])->value.as.i64;
+            int64_t logging_level = PYRO_AS_I64(PYRO_AS_ENUM_MEMBER(instance->fields[0])->value);
 
             if (PYRO_STD_LOG_LEVEL_INFO >= logging_level) {
                 write_msg(vm, "info()", "INFO", instance->fields[1], instance->fields[2], instance->fields[3], instance->fields[4], instance->fields[5], arg_count, args);
@@ -252,7 +252,7 @@ static PyroValue logger_warn(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
     if (PYRO_IS_ENUM_MEMBER(instance->fields[0])) {
         if (PYRO_AS_ENUM_MEMBER(instance->fields[0])->enum_type == PYRO_AS_ENUM_TYPE(instance->fields[6])) {
-            int64_t logging_level = PYRO_AS_ENUM_MEMBER(instance->fields[0])->value.as.i64;
+            int64_t logging_level = PYRO_AS_I64(PYRO_AS_ENUM_MEMBER(instance->fields[0])->value);
 
             if (PYRO_STD_LOG_LEVEL_WARN >= logging_level) {
                 write_msg(vm, "warn()", "WARN", instance->fields[1], instance->fields[2], instance->fields[3], instance->fields[4], instance->fields[5], arg_count, args);
@@ -272,7 +272,7 @@ static PyroValue logger_error(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
     if (PYRO_IS_ENUM_MEMBER(instance->fields[0])) {
         if (PYRO_AS_ENUM_MEMBER(instance->fields[0])->enum_type == PYRO_AS_ENUM_TYPE(instance->fields[6])) {
-            int64_t logging_level = PYRO_AS_ENUM_MEMBER(instance->fields[0])->value.as.i64;
+            int64_t logging_level = PYRO_AS_I64(PYRO_AS_ENUM_MEMBER(instance->fields[0])->value);
 
             if (PYRO_STD_LOG_LEVEL_ERROR >= logging_level) {
                 write_msg(vm, "error()", "ERROR", instance->fields[1], instance->fields[2], instance->fields[3], instance->fields[4], instance->fields[5], arg_count, args);
@@ -292,7 +292,7 @@ static PyroValue logger_fatal(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
     if (PYRO_IS_ENUM_MEMBER(instance->fields[0])) {
         if (PYRO_AS_ENUM_MEMBER(instance->fields[0])->enum_type == PYRO_AS_ENUM_TYPE(instance->fields[6])) {
-            int64_t logging_level = PYRO_AS_ENUM_MEMBER(instance->fields[0])->value.as.i64;
+            int64_t logging_level = PYRO_AS_I64(PYRO_AS_ENUM_MEMBER(instance->fields[0])->value);
 
             if (PYRO_STD_LOG_LEVEL_FATAL >= logging_level) {
                 write_msg(vm, "fatal()", "FATAL", instance->fields[1], instance->fields[2], instance->fields[3], instance->fields[4], instance->fields[5], arg_count, args);
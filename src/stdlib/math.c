@@ -3,15 +3,15 @@
 
 static PyroValue fn_abs(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0])) {
-        if (args[0].as.i64 == INT64_MIN) {
+        if (PYRO_AS_I64(args[0]) == PYRO_I64_MIN) {
             pyro_panic(vm, "abs(): invalid argument i64_min, result would overflow");
             return pyro_null();
         }
-        return pyro_i64(imaxabs(args[0].as.i64));
+        return pyro_i64(imaxabs(PYRO_AS_I64(args[0])));
     }
 
     if (PYRO_IS_F64(args[0])) {
-        return pyro_f64(fabs(args[0].as.f64));
+        return pyro_f64(fabs(PYRO_AS_F64(args[0])));
     }
 
     pyro_panic(vm, "abs(): invalid argument, expected a number");
@@ -21,9 +21,9 @@ static PyroValue fn_abs(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue fn_acos(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0])) {
-        return pyro_f64(acos((double)args[0].as.i64));
+        return pyro_f64(acos((double)PYRO_AS_I64(args[0])));
     } else if (PYRO_IS_F64(args[0])) {
-        return pyro_f64(acos(args[0].as.f64));
+        return pyro_f64(acos(PYRO_AS_F64(args[0])));
     }
     pyro_panic(vm, "acos(): invalid argument, expected a number");
     return pyro_null();
@@ -32,9 +32,9 @@ static PyroValue fn_acos(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue fn_asin(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0])) {
-        return pyro_f64(asin((double)args[0].as.i64));
+        return pyro_f64(asin((double)PYRO_AS_I64(args[0])));
     } else if (PYRO_IS_F64(args[0])) {
-        return pyro_f64(asin(args[0].as.f64));
+        return pyro_f64(asin(PYRO_AS_F64(args[0])));
     }
     pyro_panic(vm, "asin(): invalid argument, expected a number");
     return pyro_null();
@@ -43,9 +43,9 @@ static PyroValue fn_asin(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue fn_atan(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0])) {
-        return pyro_f64(atan((double)args[0].as.i64));
+        return pyro_f64(atan((double)PYRO_AS_I64(args[0])));
     } else if (PYRO_IS_F64(args[0])) {
-        return pyro_f64(atan(args[0].as.f64));
+        return pyro_f64(atan(PYRO_AS_F64(args[0])));
     }
     pyro_panic(vm, "atan(): invalid argument, expected a number");
     return pyro_null();
@@ -54,9 +54,9 @@ static PyroValue fn_atan(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue fn_cos(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0])) {
-        return pyro_f64(cos((double)args[0].as.i64));
+        return pyro_f64(cos((double)PYRO_AS_I64(args[0])));
     } else if (PYRO_IS_F64(args[0])) {
-        return pyro_f64(cos(args[0].as.f64));
+        return pyro_f64(cos(PYRO_AS_F64(args[0])));
     }
     pyro_panic(vm, "cos(): invalid argument, expected a number");
     return pyro_null();
@@ -65,9 +65,9 @@ static PyroValue fn_cos(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue fn_sin(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0])) {
-        return pyro_f64(sin((double)args[0].as.i64));
+        return pyro_f64(sin((double)PYRO_AS_I64(args[0])));
     } else if (PYRO_IS_F64(args[0])) {
-        return pyro_f64(sin(args[0].as.f64));
+        return pyro_f64(sin(PYRO_AS_F64(args[0])));
     }
     pyro_panic(vm, "sin(): invalid argument, expected a number");
     return pyro_null();
@@ -76,9 +76,9 @@ static PyroValue fn_sin(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue fn_tan(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0])) {
-        return pyro_f64(tan((double)args[0].as.i64));
+        return pyro_f64(tan((double)PYRO_AS_I64(args[0])));
     } else if (PYRO_IS_F64(args[0])) {
-        return pyro_f64(tan(args[0].as.f64));
+        return pyro_f64(tan(PYRO_AS_F64(args[0])));
     }
     pyro_panic(vm, "tan(): invalid argument, expected a number");
     return pyro_null();
@@ -87,9 +87,9 @@ static PyroValue fn_tan(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue fn_ln(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0])) {
-        return pyro_f64(log((double)args[0].as.i64));
+        return pyro_f64(log((double)PYRO_AS_I64(args[0])));
     } else if (PYRO_IS_F64(args[0])) {
-        return pyro_f64(log(args[0].as.f64));
+        return pyro_f64(log(PYRO_AS_F64(args[0])));
     }
     pyro_panic(vm, "ln(): invalid argument, expected a number");
     return pyro_null();
@@ -98,9 +98,9 @@ static PyroValue fn_ln(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue fn_log10(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0])) {
-        return pyro_f64(log10((double)args[0].as.i64));
+        return pyro_f64(log10((double)PYRO_AS_I64(args[0])));
     } else if (PYRO_IS_F64(args[0])) {
-        return pyro_f64(log10(args[0].as.f64));
+        return pyro_f64(log10(PYRO_AS_F64(args[0])));
     }
     pyro_panic(vm, "log10(): invalid argument, expected a number");
     return pyro_null();
@@ -109,9 +109,9 @@ static PyroValue fn_log10(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue fn_log2(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0])) {
-        return pyro_f64(log((double)args[0].as.i64) / log(2.0));
+        return pyro_f64(log((double)PYRO_AS_I64(args[0])) / log(2.0));
     } else if (PYRO_IS_F64(args[0])) {
-        return pyro_f64(log(args[0].as.f64) / log(2.0));
+        return pyro_f64(log(PYRO_AS_F64(args[0])) / log(2.0));
     }
     pyro_panic(vm, "log2(): invalid argument, expected a number");
     return pyro_null();
@@ -123,18 +123,18 @@ static PyroValue fn_log(PyroVM* vm, size_t arg_count, PyroValue* args) {
     double operand;
 
     if (PYRO_IS_F64(args[0])) {
-        base = args[0].as.f64;
+        base = PYRO_AS_F64(args[0]);
     } else if (PYRO_IS_I64(args[0])) {
-        base = (double)args[0].as.i64;
+        base = (double)PYRO_AS_I64(args[0]);
     } else {
         pyro_panic(vm, "log(): invalid argument, expected a number");
         return pyro_null();
     }
 
     if (PYRO_IS_F64(args[1])) {
-        operand = args[1].as.f64;
+        operand = PYRO_AS_F64(args[1]);
     } else if (PYRO_IS_I64(args[1])) {
-        operand = (double)args[1].as.i64;
+        operand = (double)PYRO_AS_I64(args[1]);
     } else {
         pyro_panic(vm, "log(): invalid argument, expected a number");
         return pyro_null();
@@ -149,18 +149,18 @@ static PyroValue fn_atan2(PyroVM* vm, size_t arg_count, PyroValue* args) {
     double x;
 
     if (PYRO_IS_F64(args[0])) {
-        y = args[0].as.f64;
+        y = PYRO_AS_F64(args[0]);
     } else if (PYRO_IS_I64(args[0])) {
-        y = (double)args[0].as.i64;
+        y = (double)PYRO_AS_I64(args[0]);
     } else {
         pyro_panic(vm, "atan2(): invalid argument, expected a number");
         return pyro_null();
     }
 
     if (PYRO_IS_F64(args[1])) {
-        x = args[1].as.f64;
+        x = PYRO_AS_F64(args[1]);
     } else if (PYRO_IS_I64(args[1])) {
-        x = (double)args[1].as.i64;
+        x = (double)PYRO_AS_I64(args[1]);
     } else {
         pyro_panic(vm, "atan2(): invalid argument, expected a number");
         return pyro_null();
@@ -172,9 +172,9 @@ static PyroValue fn_atan2(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue fn_exp(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0])) {
-        return pyro_f64(exp((double)args[0].as.i64));
+        return pyro_f64(exp((double)PYRO_AS_I64(args[0])));
     } else if (PYRO_IS_F64(args[0])) {
-        return pyro_f64(exp(args[0].as.f64));
+        return pyro_f64(exp(PYRO_AS_F64(args[0])));
     }
     pyro_panic(vm, "exp(): invalid argument, expected a number");
     return pyro_null();
@@ -183,9 +183,9 @@ static PyroValue fn_exp(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue fn_sqrt(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0])) {
-        return pyro_f64(sqrt((double)args[0].as.i64));
+        return pyro_f64(sqrt((double)PYRO_AS_I64(args[0])));
     } else if (PYRO_IS_F64(args[0])) {
-        return pyro_f64(sqrt(args[0].as.f64));
+        return pyro_f64(sqrt(PYRO_AS_F64(args[0])));
     }
     pyro_panic(vm, "sqrt(): invalid argument, expected a number");
     return pyro_null();
@@ -194,9 +194,9 @@ static PyroValue fn_sqrt(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue fn_cbrt(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0])) {
-        return pyro_f64(cbrt((double)args[0].as.i64));
+        return pyro_f64(cbrt((double)PYRO_AS_I64(args[0])));
     } else if (PYRO_IS_F64(args[0])) {
-        return pyro_f64(cbrt(args[0].as.f64));
+        return pyro_f64(cbrt(PYRO_AS_F64(args[0])));
     }
     pyro_panic(vm, "cbrt(): invalid argument, expected a number");
     return pyro_null();
@@ -205,9 +205,9 @@ static PyroValue fn_cbrt(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue fn_ceil(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0])) {
-        return pyro_f64(ceil((double)args[0].as.i64));
+        return pyro_f64(ceil((double)PYRO_AS_I64(args[0])));
     } else if (PYRO_IS_F64(args[0])) {
-        return pyro_f64(ceil(args[0].as.f64));
+        return pyro_f64(ceil(PYRO_AS_F64(args[0])));
     }
     pyro_panic(vm, "ceil(): invalid argument, expected a number");
     return pyro_null();
@@ -216,9 +216,9 @@ static PyroValue fn_ceil(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 static PyroValue fn_floor(PyroVM* vm, size_t arg_count, PyroValue* args) {
     if (PYRO_IS_I64(args[0])) {
-        return pyro_f64(floor((double)args[0].as.i64));
+        return pyro_f64(floor((double)PYRO_AS_I64(args[0])));
     } else if (PYRO_IS_F64(args[0])) {
-        return pyro_f64(floor(args[0].as.f64));
+        return pyro_f64(floor(PYRO_AS_F64(args[0])));
     }
     pyro_panic(vm, "floor(): invalid argument, must be a number");
     return pyro_null();
@@ -242,12 +242,12 @@ static PyroValue fn_trunc_div(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    if (args[1].as.i64 == 0) {
+    if (PYRO_AS_I64(args[1]) == 0) {
         pyro_panic(vm, "div(): invalid argument [denominator]: value cannot be zero");
         return pyro_null();
     }
 
-    lldiv_t result = lldiv(args[0].as.i64, args[1].as.i64);
+    lldiv_t result = lldiv(PYRO_AS_I64(args[0]), PYRO_AS_I64(args[1]));
 
     PyroTup* tup = PyroTup_new(2, vm);
     if (!tup) {
@@ -279,13 +279,13 @@ static PyroValue fn_floor_div(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    if (args[1].as.i64 == 0) {
+    if (PYRO_AS_I64(args[1]) == 0) {
         pyro_panic(vm, "floor_div(): invalid argument [denominator]: value cannot be zero");
         return pyro_null();
     }
 
-    int64_t numerator = args[0].as.i64;
-    int64_t denominator = args[1].as.i64;
+    int64_t numerator = PYRO_AS_I64(args[0]);
+    int64_t denominator = PYRO_AS_I64(args[1]);
 
     PyroTup* tup = PyroTup_new(2, vm);
     if (!tup) {
@@ -326,13 +326,13 @@ static PyroValue fn_modulo(PyroVM* vm, size_t arg_count, PyroValue* args) {
         return pyro_null();
     }
 
-    if (args[1].as.i64 == 0) {
+    if (PYRO_AS_I64(args[1]) == 0) {
         pyro_panic(vm, "modulo(): invalid argument [y]: value cannot be zero");
         return pyro_null();
     }
 
     return pyro_i64(
-        pyro_modulo(args[0].as.i64, args[1].as.i64)
+        pyro_modulo(PYRO_AS_I64(args[0]), PYRO_AS_I64(args[1]))
     );
 }
 
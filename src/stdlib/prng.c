@@ -8,12 +8,12 @@ static PyroValue fn_rand_int(PyroVM* vm, size_t arg_count, PyroValue* args) {
     }
 
     if (arg_count == 1) {
-        if (!PYRO_IS_I64(args[0]) || args[0].as.i64 <= 0) {
+        if (!PYRO_IS_I64(args[0]) || PYRO_AS_I64(args[0]) <= 0) {
             pyro_panic(vm, "rand_int(): invalid argument [n], expected a positive integer");
             return pyro_null();
         }
 
-        uint64_t rand_u64 = pyro_xoshiro256ss_next_in_range(&vm->prng_state, (uint64_t)args[0].as.i64);
+        uint64_t rand_u64 = pyro_xoshiro256ss_next_in_range(&vm->prng_state, (uint64_t)PYRO_AS_I64(args[0]));
         return pyro_i64((int64_t)rand_u64);
     }
 
@@ -33,8 +33,8 @@ static PyroValue fn_rand_int_in_range(PyroVM* vm, size_t arg_count, PyroValue* a
         return pyro_null();
     }
 
-    int64_t low = args[0].as.i64;
-    int64_t high = args[1].as.i64;
+    int64_t low = PYRO_AS_I64(args[0]);
+    int64_t high = PYRO_AS_I64(args[1]);
 
     if (low >= high) {
         pyro_panic(vm, "rand_int_in_range(): invalid arguments, [n] must be less than [m]");
@@ -72,8 +72,8 @@ static PyroValue fn_rand_float_in_range(PyroVM* vm, size_t arg_count, PyroValue*
         return pyro_null();
     }
 
-    double low = args[0].as.f64;
-    double high = args[1].as.f64;
+    double low = PYRO_AS_F64(args[0]);
+    double high = PYRO_AS_F64(args[1]);
 
     if (low >= high) {
         pyro_panic(vm, "rand_float_in_range(): invalid arguments, [x] must be less than [y]");
@@ -114,7 +114,7 @@ static PyroValue generator_init(PyroVM* vm, size_t arg_count, PyroValue* args) {
             pyro_panic(vm, "Generator(): invalid argument, expected an integer");
             return pyro_null();
         }
-        seed = args[0].as.u64;
+        seed = (uint64_t)PYRO_AS_I64(args[0]);
     }
 
     pyro_xoshiro256ss_state_t* state = malloc(sizeof(pyro_xoshiro256ss_state_t));
@@ -150,12 +150,12 @@ static PyroValue generator_rand_int(PyroVM* vm, size_t arg_count, PyroValue* arg
     }
 
     if (arg_count == 1) {
-        if (!PYRO_IS_I64(args[0]) || args[0].as.i64 <= 0) {
+        if (!PYRO_IS_I64(args[0]) || PYRO_AS_I64(args[0]) <= 0) {
             pyro_panic(vm, "rand_int(): invalid argument [n], expected a positive integer");
             return pyro_null();
         }
 
-        uint64_t rand_u64 = pyro_xoshiro256ss_next_in_range(state, (uint64_t)args[0].as.i64);
+        uint64_t rand_u64 = pyro_xoshiro256ss_next_in_range(state, (uint64_t)PYRO_AS_I64(args[0]));
         return pyro_i64((int64_t)rand_u64);
     }
 
@@ -179,8 +179,8 @@ static PyroValue generator_rand_int_in_range(PyroVM* vm, size_t arg_count, PyroV
         return pyro_null();
     }
 
-    int64_t low = args[0].as.i64;
-    int64_t high = args[1].as.i64;
+    int64_t low = PYRO_AS_I64(args[0]);
+    int64_t high = PYRO_AS_I64(args[1]);
 
     if (low >= high) {
         pyro_panic(vm, "rand_int_in_range(): invalid arguments, [n] must be less than [m]");
@@ -226,8 +226,8 @@ static PyroValue generator_rand_float_in_range(PyroVM* vm, size_t arg_count, Pyr
         return pyro_null();
     }
 
-    double low = args[0].as.f64;
-    double high = args[1].as.f64;
+    double low = PYRO_AS_F64(args[0]);
+    double high = PYRO_AS_F64(args[1]);
 
     if (low >= high) {
         pyro_panic(vm, "rand_float_in_range(): invalid arguments, [x] must be less than [y]");
@@ -255,7 +255,7 @@ static PyroValue generator_seed(PyroVM* vm, size_t arg_count, PyroValue* args) {
     PyroResourcePointer* rp = PYRO_AS_RESOURCE_POINTER(instance->fields[0]);
     pyro_xoshiro256ss_state_t* state = rp->pointer;
 
-    pyro_xoshiro256ss_init(state, args[0].as.u64);
+    pyro_xoshiro256ss_init(state, (uint64_t)PYRO_AS_I64(args[0]));
     return pyro_null();
 }
 
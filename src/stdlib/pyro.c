@@ -8,7 +8,40 @@ static PyroValue fn_memory(PyroVM* vm, size_t arg_count, PyroValue* args) {
 
 
 static PyroValue fn_gc(PyroVM* vm, size_t arg_count, PyroValue* args) {
-    pyro_collect_garbage(vm);
+    pyro_collect_all_garbage(vm);
+    return pyro_null();
+}
+
+
+static PyroValue fn_set_bytecode_cache(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    if (!PYRO_IS_BOOL(args[0])) {
+        pyro_panic(vm,
+            "set_bytecode_cache(): expected bool argument, found %s",
+            pyro_get_type_name(vm, args[0])->bytes
+        );
+        return pyro_null();
+    }
+
+    pyro_set_bytecode_cache_flag(vm, PYRO_AS_BOOL(args[0]));
+    return pyro_null();
+}
+
+
+static PyroValue fn_set_gc_mark_threads(PyroVM* vm, size_t arg_count, PyroValue* args) {
+    if (!PYRO_IS_I64(args[0])) {
+        pyro_panic(vm,
+            "set_gc_mark_threads(): expected i64 argument, found %s",
+            pyro_get_type_name(vm, args[0])->bytes
+        );
+        return pyro_null();
+    }
+
+    if (PYRO_AS_I64(args[0]) < 1) {
+        pyro_panic(vm, "set_gc_mark_threads(): invalid argument, must be greater than 0");
+        return pyro_null();
+    }
+
+    pyro_set_gc_mark_threads(vm, (size_t)PYRO_AS_I64(args[0]));
     return pyro_null();
 }
 
@@ -36,7 +69,7 @@ static PyroValue fn_sizeof(PyroVM* vm, size_t arg_count, PyroValue* args) {
             return pyro_i64(
                 sizeof(PyroMap) +
                     sizeof(PyroMapEntry) * map->entry_array_capacity +
-                    sizeof(int64_t) * map->index_array_capacity
+                    PyroMap_index_size(map)
             );
         }
 
@@ -115,11 +148,16 @@ static PyroValue fn_load_embedded_file(PyroVM* vm, size_t arg_count, PyroValue*
         return pyro_null();
     }
 
-    PyroBuf* buf = pyro_load_embedded_file(vm, PYRO_AS_STR(args[0])->bytes);
+    PyroStr* path = PYRO_AS_STR(args[0]);
+    if (!PyroStr_flatten(path, vm)) {
+        return pyro_null();
+    }
+
+    PyroBuf* buf = pyro_load_embedded_file(vm, path->bytes);
     if (!buf) {
         pyro_panic(vm,
             "load_embedded_file(): failed to load file: %s",
-            PYRO_AS_STR(args[0])->bytes
+            path->bytes
         );
         return pyro_null();
     }
@@ -153,6 +191,8 @@ void pyro_load_stdlib_module_pyro(PyroVM* vm, PyroMod* module) {
 
     pyro_define_pub_member_fn(vm, module, "memory", fn_memory, 0);
     pyro_define_pub_member_fn(vm, module, "gc", fn_gc, 0);
+    pyro_define_pub_member_fn(vm, module, "set_bytecode_cache", fn_set_bytecode_cache, 1);
+    pyro_define_pub_member_fn(vm, module, "set_gc_mark_threads", fn_set_gc_mark_threads, 1);
     pyro_define_pub_member_fn(vm, module, "sizeof", fn_sizeof, 1);
     pyro_define_pub_member_fn(vm, module, "address", fn_address, 1);
     pyro_define_pub_member_fn(vm, module, "path", fn_path, 0);